@@ -6,7 +6,6 @@
 
 #include "../utils/shaders.hpp"
 #include "../utils/utils.hpp"
-#include "glslang/Public/ShaderLang.h"
 
 #include <iostream>
 
@@ -29,30 +28,17 @@ int main()
 
     /* VULKAN_HPP_KEY_START */
 
-    glslang::InitializeProcess();
-
-    std::vector<unsigned int> vertexShaderSPV;
-#if !defined( NDEBUG )
-    bool ok =
-#endif
-      vk::su::GLSLtoSPV( vk::ShaderStageFlagBits::eVertex, vertexShaderText_PC_C, vertexShaderSPV );
-    assert( ok );
+    // compiles GLSL to SPIR-V, reusing the SPIR-V cached on disk by earlier runs
+    vk::su::ShaderCompiler shaderCompiler( vk::su::samplesShaderCacheFileName );
 
+    std::vector<unsigned int>  vertexShaderSPV = shaderCompiler.compile( vk::ShaderStageFlagBits::eVertex, vertexShaderText_PC_C );
     vk::ShaderModuleCreateInfo vertexShaderModuleCreateInfo( {}, vertexShaderSPV );
     vk::raii::ShaderModule     vertexShaderModule( device, vertexShaderModuleCreateInfo );
 
-    std::vector<unsigned int> fragmentShaderSPV;
-#if !defined( NDEBUG )
-    ok =
-#endif
-      vk::su::GLSLtoSPV( vk::ShaderStageFlagBits::eFragment, fragmentShaderText_C_C, fragmentShaderSPV );
-    assert( ok );
-
+    std::vector<unsigned int>  fragmentShaderSPV = shaderCompiler.compile( vk::ShaderStageFlagBits::eFragment, fragmentShaderText_C_C );
     vk::ShaderModuleCreateInfo fragmentShaderModuleCreateInfo( {}, fragmentShaderSPV );
     vk::raii::ShaderModule     fragmentShaderModule( device, fragmentShaderModuleCreateInfo );
 
-    glslang::FinalizeProcess();
-
     /* VULKAN_HPP_KEY_END */
   }
   catch ( vk::SystemError & err )
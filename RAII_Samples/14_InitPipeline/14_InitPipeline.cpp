@@ -18,7 +18,6 @@
 #include "../../samples/utils/math.hpp"
 #include "../utils/shaders.hpp"
 #include "../utils/utils.hpp"
-#include "glslang/Public/ShaderLang.h"
 
 #include <iostream>
 
@@ -49,10 +48,12 @@ int main()
       vk::raii::su::makeDescriptorSetLayout( device, { { vk::DescriptorType::eUniformBuffer, 1, vk::ShaderStageFlagBits::eVertex } } );
     vk::raii::PipelineLayout pipelineLayout( device, { {}, *descriptorSetLayout } );
 
-    glslang::InitializeProcess();
-    vk::raii::ShaderModule vertexShaderModule   = vk::raii::su::makeShaderModule( device, vk::ShaderStageFlagBits::eVertex, vertexShaderText_PC_C );
-    vk::raii::ShaderModule fragmentShaderModule = vk::raii::su::makeShaderModule( device, vk::ShaderStageFlagBits::eFragment, fragmentShaderText_C_C );
-    glslang::FinalizeProcess();
+    vk::su::ShaderCompiler shaderCompiler( vk::su::samplesShaderCacheFileName );
+
+    vk::raii::ShaderModule vertexShaderModule =
+      vk::raii::su::makeShaderModule( device, vk::ShaderStageFlagBits::eVertex, vertexShaderText_PC_C, shaderCompiler );
+    vk::raii::ShaderModule fragmentShaderModule =
+      vk::raii::su::makeShaderModule( device, vk::ShaderStageFlagBits::eFragment, fragmentShaderText_C_C, shaderCompiler );
 
     /* VULKAN_KEY_START */
 
@@ -18,7 +18,6 @@
 #include "../../samples/utils/math.hpp"
 #include "../utils/shaders.hpp"
 #include "../utils/utils.hpp"
-#include "glslang/Public/ShaderLang.h"
 
 #include <iostream>
 #include <thread>
@@ -71,10 +70,12 @@ int main()
     vk::Format           colorFormat = vk::su::pickSurfaceFormat( physicalDevice.getSurfaceFormatsKHR( surfaceData.surface ) ).format;
     vk::raii::RenderPass renderPass  = vk::raii::su::makeRenderPass( device, colorFormat, depthBufferData.format );
 
-    glslang::InitializeProcess();
-    vk::raii::ShaderModule vertexShaderModule   = vk::raii::su::makeShaderModule( device, vk::ShaderStageFlagBits::eVertex, vertexShaderText_PC_C );
-    vk::raii::ShaderModule fragmentShaderModule = vk::raii::su::makeShaderModule( device, vk::ShaderStageFlagBits::eFragment, fragmentShaderText_C_C );
-    glslang::FinalizeProcess();
+    vk::su::ShaderCompiler shaderCompiler( vk::su::samplesShaderCacheFileName );
+
+    vk::raii::ShaderModule vertexShaderModule =
+      vk::raii::su::makeShaderModule( device, vk::ShaderStageFlagBits::eVertex, vertexShaderText_PC_C, shaderCompiler );
+    vk::raii::ShaderModule fragmentShaderModule =
+      vk::raii::su::makeShaderModule( device, vk::ShaderStageFlagBits::eFragment, fragmentShaderText_C_C, shaderCompiler );
 
     std::vector<vk::raii::Framebuffer> framebuffers =
       vk::raii::su::makeFramebuffers( device, renderPass, swapChainData.imageViews, &depthBufferData.imageView, surfaceData.extent );
@@ -0,0 +1,325 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <vector>
+#include <vulkan/vulkan_raii.hpp>
+
+namespace vk
+{
+  namespace raii
+  {
+    namespace su
+    {
+      // Builds many bottom-level acceleration structures (VK_KHR_acceleration_structure) with just a few commands:
+      //   vk::raii::su::AccelerationStructureBuilder builder( physicalDevice, device, true );
+      //   for ( auto const & mesh : meshes )
+      //     mesh.blasIndex = builder.add( mesh.geometries, mesh.buildRanges );
+      //   builder.build( commandBuffer );    // submit, wait
+      //   builder.compact( commandBuffer );  // submit, wait
+      //   builder.finish();
+      // - add() gets the sizes right away via vk::raii::Device::getAccelerationStructureBuildSizesKHR; build() places all the acceleration
+      //   structures into one buffer, at 256 byte aligned offsets
+      // - build() packs the scratch ranges, aligned to minAccelerationStructureScratchOffsetAlignment, into one shared scratch buffer of at
+      //   most scratchBudget bytes (or the largest scratch size, if that's more); all builds fitting into it at once are recorded with a single
+      //   buildAccelerationStructuresKHR, and only between those batches, when the scratch memory is reused, a barrier is needed
+      // - with compaction, every build gets eAllowCompaction, build() writes the compacted sizes into a query pool, and compact() copies all
+      //   the acceleration structures into a tightly packed buffer of their own
+      // - after the builds, there is one barrier from the acceleration structure writes to the acceleration structure build stage, which
+      //   covers building top-level acceleration structures; any other use needs a barrier of its own
+      // The builder owns the acceleration structures and the memory backing them; the commands recorded by one step have to be completed
+      // before calling the next one.
+      class AccelerationStructureBuilder
+      {
+      public:
+        AccelerationStructureBuilder( vk::raii::PhysicalDevice const & physicalDevice,
+                                      vk::raii::Device const &         device,
+                                      bool                             compaction    = false,
+                                      vk::DeviceSize                   scratchBudget = 64 * 1024 * 1024 )
+          : m_device( &device ), m_memoryProperties( physicalDevice.getMemoryProperties() ), m_compaction( compaction ), m_scratchBudget( scratchBudget )
+        {
+          m_scratchAlignment = physicalDevice.getProperties2<vk::PhysicalDeviceProperties2, vk::PhysicalDeviceAccelerationStructurePropertiesKHR>()
+                                 .get<vk::PhysicalDeviceAccelerationStructurePropertiesKHR>()
+                                 .minAccelerationStructureScratchOffsetAlignment;
+          m_scratchAlignment = ( std::max )( m_scratchAlignment, vk::DeviceSize( 1 ) );
+        }
+
+        AccelerationStructureBuilder( AccelerationStructureBuilder const & )             = delete;
+        AccelerationStructureBuilder & operator=( AccelerationStructureBuilder const & ) = delete;
+
+        // adds a bottom-level acceleration structure, with one build range per geometry; both are copied, but whatever they refer to has to
+        // stay valid until build(); returns the index of the acceleration structure
+        uint32_t add( vk::ArrayProxy<vk::AccelerationStructureGeometryKHR const> const &     geometries,
+                      vk::ArrayProxy<vk::AccelerationStructureBuildRangeInfoKHR const> const & buildRanges,
+                      vk::BuildAccelerationStructureFlagsKHR flags = vk::BuildAccelerationStructureFlagBitsKHR::ePreferFastTrace )
+        {
+          assert( ( geometries.size() == buildRanges.size() ) && m_storage.accelerationStructures.empty() );
+
+          Request request;
+          request.firstGeometry = static_cast<uint32_t>( m_geometries.size() );
+          request.geometryCount = geometries.size();
+          request.flags         = m_compaction ? ( flags | vk::BuildAccelerationStructureFlagBitsKHR::eAllowCompaction ) : flags;
+          m_geometries.insert( m_geometries.end(), geometries.begin(), geometries.end() );
+          m_buildRanges.insert( m_buildRanges.end(), buildRanges.begin(), buildRanges.end() );
+
+          m_primitiveCounts.clear();
+          for ( auto const & buildRange : buildRanges )
+          {
+            m_primitiveCounts.push_back( buildRange.primitiveCount );
+          }
+          vk::AccelerationStructureBuildSizesInfoKHR buildSizes =
+            m_device->getAccelerationStructureBuildSizesKHR( vk::AccelerationStructureBuildTypeKHR::eDevice, makeBuildInfo( request ), m_primitiveCounts );
+          request.size        = buildSizes.accelerationStructureSize;
+          request.scratchSize = alignUp( buildSizes.buildScratchSize, m_scratchAlignment );
+
+          m_requests.push_back( request );
+          return static_cast<uint32_t>( m_requests.size() - 1 );
+        }
+
+        // records the builds of all the acceleration structures added
+        void build( vk::raii::CommandBuffer const & commandBuffer )
+        {
+          assert( !m_requests.empty() && m_storage.accelerationStructures.empty() );
+
+          m_sizes.clear();
+          vk::DeviceSize maxScratchSize   = 0;
+          vk::DeviceSize totalScratchSize = 0;
+          for ( auto const & request : m_requests )
+          {
+            m_sizes.push_back( request.size );
+            maxScratchSize = ( std::max )( maxScratchSize, request.scratchSize );
+            totalScratchSize += request.scratchSize;
+          }
+          m_storage = createStorage( m_sizes );
+
+          // the buffer's address is aligned to the scratch alignment by hand, as there's no way to request that alignment for the memory
+          vk::DeviceSize scratchSize = ( std::min )( totalScratchSize, ( std::max )( m_scratchBudget, maxScratchSize ) );
+          m_scratch                  = createBuffer( scratchSize + m_scratchAlignment, vk::BufferUsageFlagBits::eStorageBuffer );
+          vk::DeviceAddress scratchAddress =
+            alignUp( m_device->getBufferAddress( vk::BufferDeviceAddressInfo( *m_scratch.buffer ) ), m_scratchAlignment );
+
+          if ( m_compaction )
+          {
+            m_queryPool = vk::raii::QueryPool(
+              *m_device, vk::QueryPoolCreateInfo( {}, vk::QueryType::eAccelerationStructureCompactedSizeKHR, static_cast<uint32_t>( m_requests.size() ) ) );
+            commandBuffer.resetQueryPool( *m_queryPool, 0, static_cast<uint32_t>( m_requests.size() ) );
+          }
+
+          m_buildInfos.clear();
+          m_pBuildRanges.clear();
+          vk::DeviceSize scratchOffset = 0;
+          for ( size_t i = 0; i < m_requests.size(); ++i )
+          {
+            if ( scratchSize < scratchOffset + m_requests[i].scratchSize )
+            {
+              // the scratch buffer is used up: build what's gathered so far, and wait for it before reusing the scratch memory
+              commandBuffer.buildAccelerationStructuresKHR( m_buildInfos, m_pBuildRanges );
+              barrier( commandBuffer );
+              m_buildInfos.clear();
+              m_pBuildRanges.clear();
+              scratchOffset = 0;
+            }
+            m_buildInfos.push_back( makeBuildInfo( m_requests[i] )
+                                      .setDstAccelerationStructure( m_storage.handles[i] )
+                                      .setScratchData( vk::DeviceOrHostAddressKHR( scratchAddress + scratchOffset ) ) );
+            m_pBuildRanges.push_back( m_buildRanges.data() + m_requests[i].firstGeometry );
+            scratchOffset += m_requests[i].scratchSize;
+          }
+          commandBuffer.buildAccelerationStructuresKHR( m_buildInfos, m_pBuildRanges );
+          barrier( commandBuffer );
+
+          if ( m_compaction )
+          {
+            commandBuffer.writeAccelerationStructuresPropertiesKHR(
+              m_storage.handles, vk::QueryType::eAccelerationStructureCompactedSizeKHR, *m_queryPool, 0 );
+          }
+        }
+
+        // to be called once the commands recorded by build() have completed: records the copies of all the acceleration structures into
+        // their compacted counterparts, which replace them
+        void compact( vk::raii::CommandBuffer const & commandBuffer )
+        {
+          assert( m_compaction && !m_storage.accelerationStructures.empty() && m_uncompactedStorage.accelerationStructures.empty() );
+
+          m_sizes.resize( m_requests.size() );
+          vk::Result result = m_queryPool.getResults( 0,
+                                                      static_cast<uint32_t>( m_sizes.size() ),
+                                                      m_sizes.size() * sizeof( vk::DeviceSize ),
+                                                      m_sizes.data(),
+                                                      sizeof( vk::DeviceSize ),
+                                                      vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWait );
+          if ( result != vk::Result::eSuccess )
+          {
+            throw std::runtime_error( "AccelerationStructureBuilder: failed to get the compacted sizes" );
+          }
+
+          m_uncompactedStorage = std::move( m_storage );
+          m_storage            = createStorage( m_sizes );
+          for ( size_t i = 0; i < m_requests.size(); ++i )
+          {
+            commandBuffer.copyAccelerationStructureKHR( vk::CopyAccelerationStructureInfoKHR(
+              m_uncompactedStorage.handles[i], m_storage.handles[i], vk::CopyAccelerationStructureModeKHR::eCompact ) );
+          }
+          barrier( commandBuffer );
+        }
+
+        // to be called once the commands recorded by the last step have completed: releases the scratch buffer, the query pool, and the
+        // acceleration structures replaced by compaction
+        void finish()
+        {
+          m_scratch            = DeviceBuffer();
+          m_queryPool          = nullptr;
+          m_uncompactedStorage = Storage();
+        }
+
+        uint32_t size() const
+        {
+          return static_cast<uint32_t>( m_requests.size() );
+        }
+
+        // valid after build(), and changing with compact()
+        vk::AccelerationStructureKHR getAccelerationStructure( uint32_t index ) const
+        {
+          assert( index < m_storage.handles.size() );
+          return m_storage.handles[index];
+        }
+
+        vk::DeviceAddress getDeviceAddress( uint32_t index ) const
+        {
+          return m_device->getAccelerationStructureAddressKHR( vk::AccelerationStructureDeviceAddressInfoKHR( getAccelerationStructure( index ) ) );
+        }
+
+        // the total size of the buffer holding the acceleration structures
+        vk::DeviceSize getStorageSize() const
+        {
+          return m_storage.size;
+        }
+
+      private:
+        struct Request
+        {
+          uint32_t                               firstGeometry = 0;
+          uint32_t                               geometryCount = 0;
+          vk::BuildAccelerationStructureFlagsKHR flags;
+          vk::DeviceSize                         size          = 0;
+          vk::DeviceSize                         scratchSize   = 0;
+        };
+
+        struct DeviceBuffer
+        {
+          vk::raii::Buffer       buffer = nullptr;
+          vk::raii::DeviceMemory memory = nullptr;
+        };
+
+        struct Storage
+        {
+          DeviceBuffer                                    buffer;
+          vk::DeviceSize                                  size = 0;
+          std::vector<vk::raii::AccelerationStructureKHR> accelerationStructures;
+          std::vector<vk::AccelerationStructureKHR>       handles;
+        };
+
+        static vk::DeviceSize alignUp( vk::DeviceSize value, vk::DeviceSize alignment )
+        {
+          return ( value + alignment - 1 ) / alignment * alignment;
+        }
+
+        static void barrier( vk::raii::CommandBuffer const & commandBuffer )
+        {
+          commandBuffer.pipelineBarrier( vk::PipelineStageFlagBits::eAccelerationStructureBuildKHR,
+                                         vk::PipelineStageFlagBits::eAccelerationStructureBuildKHR,
+                                         {},
+                                         vk::MemoryBarrier( vk::AccessFlagBits::eAccelerationStructureWriteKHR,
+                                                            vk::AccessFlagBits::eAccelerationStructureReadKHR |
+                                                              vk::AccessFlagBits::eAccelerationStructureWriteKHR ),
+                                         nullptr,
+                                         nullptr );
+        }
+
+        vk::AccelerationStructureBuildGeometryInfoKHR makeBuildInfo( Request const & request ) const
+        {
+          return vk::AccelerationStructureBuildGeometryInfoKHR(
+            vk::AccelerationStructureTypeKHR::eBottomLevel, request.flags, vk::BuildAccelerationStructureModeKHR::eBuild )
+            .setGeometryCount( request.geometryCount )
+            .setPGeometries( m_geometries.data() + request.firstGeometry );
+        }
+
+        uint32_t findMemoryType( uint32_t memoryTypeBits, vk::MemoryPropertyFlags memoryPropertyFlags ) const
+        {
+          for ( uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; ++i )
+          {
+            if ( ( memoryTypeBits & ( 1u << i ) ) && ( ( m_memoryProperties.memoryTypes[i].propertyFlags & memoryPropertyFlags ) == memoryPropertyFlags ) )
+            {
+              return i;
+            }
+          }
+          throw std::runtime_error( "AccelerationStructureBuilder: no device local memory type for the buffer" );
+        }
+
+        DeviceBuffer createBuffer( vk::DeviceSize size, vk::BufferUsageFlags usage ) const
+        {
+          DeviceBuffer buffer;
+          buffer.buffer = vk::raii::Buffer( *m_device, vk::BufferCreateInfo( {}, size, usage | vk::BufferUsageFlagBits::eShaderDeviceAddress ) );
+
+          vk::MemoryRequirements memoryRequirements = buffer.buffer.getMemoryRequirements();
+          uint32_t               memoryTypeIndex    = findMemoryType( memoryRequirements.memoryTypeBits, vk::MemoryPropertyFlagBits::eDeviceLocal );
+          vk::StructureChain<vk::MemoryAllocateInfo, vk::MemoryAllocateFlagsInfo> memoryAllocateInfo(
+            { memoryRequirements.size, memoryTypeIndex }, { vk::MemoryAllocateFlagBits::eDeviceAddress } );
+          buffer.memory = vk::raii::DeviceMemory( *m_device, memoryAllocateInfo.get<vk::MemoryAllocateInfo>() );
+          buffer.buffer.bindMemory( *buffer.memory, 0 );
+          return buffer;
+        }
+
+        // one buffer holding an acceleration structure of each size, at 256 byte aligned offsets, as required by the specification
+        Storage createStorage( std::vector<vk::DeviceSize> const & sizes ) const
+        {
+          Storage storage;
+          for ( auto size : sizes )
+          {
+            storage.size = alignUp( storage.size, 256 ) + size;
+          }
+          storage.buffer = createBuffer( storage.size, vk::BufferUsageFlagBits::eAccelerationStructureStorageKHR );
+
+          storage.accelerationStructures.reserve( sizes.size() );
+          storage.handles.reserve( sizes.size() );
+          vk::DeviceSize offset = 0;
+          for ( auto size : sizes )
+          {
+            offset = alignUp( offset, 256 );
+            storage.accelerationStructures.push_back( vk::raii::AccelerationStructureKHR(
+              *m_device, vk::AccelerationStructureCreateInfoKHR( {}, *storage.buffer.buffer, offset, size, vk::AccelerationStructureTypeKHR::eBottomLevel ) ) );
+            storage.handles.push_back( *storage.accelerationStructures.back() );
+            offset += size;
+          }
+          return storage;
+        }
+
+      private:
+        vk::raii::Device const *           m_device;
+        vk::PhysicalDeviceMemoryProperties m_memoryProperties;
+        bool                               m_compaction;
+        vk::DeviceSize                     m_scratchBudget;
+        vk::DeviceSize                     m_scratchAlignment;
+
+        std::vector<Request>                                    m_requests;
+        std::vector<vk::AccelerationStructureGeometryKHR>       m_geometries;
+        std::vector<vk::AccelerationStructureBuildRangeInfoKHR> m_buildRanges;
+
+        Storage             m_storage;
+        Storage             m_uncompactedStorage;
+        DeviceBuffer        m_scratch;
+        vk::raii::QueryPool m_queryPool = nullptr;
+
+        // temporaries of add(), build() and compact(), kept to reuse their capacity
+        std::vector<uint32_t>                                           m_primitiveCounts;
+        std::vector<vk::DeviceSize>                                     m_sizes;
+        std::vector<vk::AccelerationStructureBuildGeometryInfoKHR>      m_buildInfos;
+        std::vector<vk::AccelerationStructureBuildRangeInfoKHR const *> m_pBuildRanges;
+      };
+    }  // namespace su
+  }    // namespace raii
+}  // namespace vk
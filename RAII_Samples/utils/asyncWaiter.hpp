@@ -0,0 +1,305 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
+#include <vulkan/vulkan_raii.hpp>
+
+namespace vk
+{
+  namespace raii
+  {
+    namespace su
+    {
+      // Lets coroutines co_await timeline semaphore values and fences, instead of blocking a thread per wait:
+      //   co_await asyncWaiter.asyncWait( timelineSemaphore, value );
+      //   co_await asyncWaiter.asyncWait( fence );
+      // - an awaitable that is already complete doesn't suspend at all
+      // - poll() waits for all outstanding timeline semaphore values with a single vk::raii::Device::waitSemaphores with eAny semantics, using
+      //   just the smallest outstanding value per semaphore, and then resumes every coroutine whose wait completed
+      // - fences can't be part of that wait; they are checked with vk::raii::Fence::getStatus on each poll(), and while any fence is
+      //   outstanding, poll() doesn't block for longer than fencePollInterval
+      // - asyncWait() from another thread wakes up a blocking poll() by signaling an internal timeline semaphore that is part of each wait
+      // - resumed coroutines are handed to the executor, or resumed right on the polling thread if there is none
+      // - if a wait fails (say, with vk::Result::eErrorDeviceLost), all outstanding coroutines are resumed, and co_await rethrows the error
+      // - if waking up a blocking poll() fails, the co_await that tried it throws right away, and its wait is dropped
+      // asyncWait() may be called from any thread; poll() and run() are to be called from one thread only.
+      class AsyncWaiter
+      {
+      public:
+        using Executor = std::function<void( std::coroutine_handle<> )>;
+
+        class Awaitable
+        {
+        public:
+          bool await_ready() const
+          {
+            return m_semaphore ? ( m_value <= m_semaphore->getCounterValue() ) : ( m_fence->getStatus() == vk::Result::eSuccess );
+          }
+
+          void await_suspend( std::coroutine_handle<> handle )
+          {
+            m_asyncWaiter->enqueue( Wait{ m_semaphore, m_value, m_fence, handle, &m_exception } );
+          }
+
+          void await_resume() const
+          {
+            if ( m_exception )
+            {
+              std::rethrow_exception( m_exception );
+            }
+          }
+
+        private:
+          friend class AsyncWaiter;
+
+          Awaitable( AsyncWaiter * asyncWaiter, vk::raii::Semaphore const * semaphore, uint64_t value, vk::raii::Fence const * fence )
+            : m_asyncWaiter( asyncWaiter ), m_semaphore( semaphore ), m_value( value ), m_fence( fence )
+          {
+          }
+
+        private:
+          AsyncWaiter *               m_asyncWaiter;
+          vk::raii::Semaphore const * m_semaphore;
+          uint64_t                    m_value;
+          vk::raii::Fence const *     m_fence;
+          std::exception_ptr          m_exception;
+        };
+
+        AsyncWaiter( vk::raii::Device const & device, Executor executor = nullptr, uint64_t fencePollInterval = 100 * 1000 )
+          : m_device( &device )
+          , m_executor( std::move( executor ) )
+          , m_fencePollInterval( fencePollInterval )
+          , m_wakeSemaphore( device,
+                             vk::StructureChain<vk::SemaphoreCreateInfo, vk::SemaphoreTypeCreateInfo>( {}, { vk::SemaphoreType::eTimeline, 0 } )
+                               .get<vk::SemaphoreCreateInfo>() )
+        {
+        }
+
+        AsyncWaiter( AsyncWaiter const & )             = delete;
+        AsyncWaiter & operator=( AsyncWaiter const & ) = delete;
+
+        // the semaphore or fence has to outlive the wait
+        Awaitable asyncWait( vk::raii::Semaphore const & timelineSemaphore, uint64_t value )
+        {
+          return Awaitable( this, &timelineSemaphore, value, nullptr );
+        }
+
+        Awaitable asyncWait( vk::raii::Fence const & fence )
+        {
+          return Awaitable( this, nullptr, 0, &fence );
+        }
+
+        // waits up to timeout nanoseconds for any outstanding wait to complete, and resumes the coroutines of all completed waits;
+        // returns the number of coroutines resumed
+        size_t poll( uint64_t timeout = UINT64_MAX )
+        {
+          uint64_t wakeValue = 0;
+          {
+            std::lock_guard<std::mutex> guard( m_mutex );
+            m_waits.insert( m_waits.end(), m_incomingWaits.begin(), m_incomingWaits.end() );
+            m_incomingWaits.clear();
+            if ( m_stopped && m_waits.empty() )
+            {
+              // nothing to wait for, and nothing to come
+              timeout = 0;
+            }
+            m_sleeping = ( timeout != 0 );
+            wakeValue  = m_wakeValue + 1;
+          }
+
+          // sorted by semaphore and value, the first wait of each semaphore is the first one that can complete
+          std::sort( m_waits.begin(),
+                     m_waits.end(),
+                     []( Wait const & lhs, Wait const & rhs )
+                     { return ( lhs.semaphore != rhs.semaphore ) ? std::less<void const *>()( lhs.semaphore, rhs.semaphore ) : ( lhs.value < rhs.value ); } );
+          m_ready.clear();
+          try
+          {
+            if ( timeout != 0 )
+            {
+              m_semaphores.assign( 1, *m_wakeSemaphore );
+              m_values.assign( 1, wakeValue );
+              bool fencePending = false;
+              for ( size_t i = 0; i < m_waits.size(); ++i )
+              {
+                if ( !m_waits[i].semaphore )
+                {
+                  fencePending = true;
+                }
+                else if ( ( i == 0 ) || ( m_waits[i].semaphore != m_waits[i - 1].semaphore ) )
+                {
+                  m_semaphores.push_back( **m_waits[i].semaphore );
+                  m_values.push_back( m_waits[i].value );
+                }
+              }
+              vk::SemaphoreWaitInfo waitInfo(
+                vk::SemaphoreWaitFlagBits::eAny, static_cast<uint32_t>( m_semaphores.size() ), m_semaphores.data(), m_values.data() );
+              static_cast<void>( m_device->waitSemaphores( waitInfo, fencePending ? ( std::min )( timeout, m_fencePollInterval ) : timeout ) );
+
+              std::lock_guard<std::mutex> guard( m_mutex );
+              m_sleeping = false;
+            }
+
+            // first determine which waits completed, querying each semaphore just once, and only then move them over to m_ready, such that
+            // an error leaves m_waits untouched
+            m_completed.resize( m_waits.size() );
+            uint64_t counterValue = 0;
+            for ( size_t i = 0; i < m_waits.size(); ++i )
+            {
+              if ( !m_waits[i].semaphore )
+              {
+                m_completed[i] = ( m_waits[i].fence->getStatus() == vk::Result::eSuccess );
+              }
+              else
+              {
+                if ( ( i == 0 ) || ( m_waits[i].semaphore != m_waits[i - 1].semaphore ) )
+                {
+                  counterValue = m_waits[i].semaphore->getCounterValue();
+                }
+                m_completed[i] = ( m_waits[i].value <= counterValue );
+              }
+            }
+            size_t kept = 0;
+            for ( size_t i = 0; i < m_waits.size(); ++i )
+            {
+              if ( m_completed[i] )
+              {
+                m_ready.push_back( m_waits[i] );
+              }
+              else
+              {
+                m_waits[kept++] = m_waits[i];
+              }
+            }
+            m_waits.resize( kept );
+          }
+          catch ( ... )
+          {
+            {
+              std::lock_guard<std::mutex> guard( m_mutex );
+              m_sleeping = false;
+            }
+            for ( auto & wait : m_waits )
+            {
+              *wait.pException = std::current_exception();
+            }
+            m_ready.swap( m_waits );
+            m_waits.clear();
+          }
+
+          for ( auto const & wait : m_ready )
+          {
+            resume( wait.handle );
+          }
+          return m_ready.size();
+        }
+
+        // polls until stop() has been called and no wait is outstanding any more
+        void run()
+        {
+          while ( !stoppedAndIdle() )
+          {
+            poll();
+          }
+        }
+
+        // lets run() return as soon as all outstanding waits have completed; may be called from any thread
+        void stop()
+        {
+          std::lock_guard<std::mutex> guard( m_mutex );
+          m_stopped = true;
+          wakeUp();
+        }
+
+        // to be called from the polling thread
+        size_t pendingCount() const
+        {
+          std::lock_guard<std::mutex> guard( m_mutex );
+          return m_waits.size() + m_incomingWaits.size();
+        }
+
+      private:
+        struct Wait
+        {
+          vk::raii::Semaphore const * semaphore;
+          uint64_t                    value;
+          vk::raii::Fence const *     fence;
+          std::coroutine_handle<>     handle;
+          std::exception_ptr *        pException;
+        };
+
+        bool stoppedAndIdle() const
+        {
+          std::lock_guard<std::mutex> guard( m_mutex );
+          return m_stopped && m_waits.empty() && m_incomingWaits.empty();
+        }
+
+        void enqueue( Wait const & wait )
+        {
+          std::lock_guard<std::mutex> guard( m_mutex );
+          m_incomingWaits.push_back( wait );
+          try
+          {
+            wakeUp();
+          }
+          catch ( ... )
+          {
+            // an exception thrown from await_suspend resumes the coroutine right away, so poll() must not resume it once more
+            m_incomingWaits.pop_back();
+            throw;
+          }
+        }
+
+        // to be called with m_mutex locked
+        void wakeUp()
+        {
+          if ( m_sleeping )
+          {
+            m_device->signalSemaphore( vk::SemaphoreSignalInfo( *m_wakeSemaphore, ++m_wakeValue ) );
+            m_sleeping = false;
+          }
+        }
+
+        void resume( std::coroutine_handle<> handle ) const
+        {
+          if ( m_executor )
+          {
+            m_executor( handle );
+          }
+          else
+          {
+            handle.resume();
+          }
+        }
+
+      private:
+        vk::raii::Device const * m_device;
+        Executor                 m_executor;
+        uint64_t                 m_fencePollInterval;
+        vk::raii::Semaphore      m_wakeSemaphore;
+
+        // guarded by m_mutex
+        mutable std::mutex m_mutex;
+        std::vector<Wait>  m_incomingWaits;
+        uint64_t           m_wakeValue = 0;
+        bool               m_sleeping  = false;
+        bool               m_stopped   = false;
+
+        // only accessed by the polling thread
+        std::vector<Wait>          m_waits;
+        std::vector<Wait>          m_ready;
+        std::vector<char>          m_completed;
+        std::vector<vk::Semaphore> m_semaphores;
+        std::vector<uint64_t>      m_values;
+      };
+    }  // namespace su
+  }    // namespace raii
+}  // namespace vk
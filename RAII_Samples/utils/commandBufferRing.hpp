@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cassert>
+#include <deque>
+#include <memory>
+#include <vector>
+#include <vulkan/vulkan_raii.hpp>
+
+namespace vk
+{
+  namespace raii
+  {
+    namespace su
+    {
+      // A ring of transient vk::raii::CommandPools, one per recording thread and per frame in flight.
+      // - acquire() hands out command buffers from a per-pool free list, allocating a new batch only if that list is exhausted
+      // - beginFrame() waits for the fence or timeline value registered by the endFrame() of the frame that last used the same slot, and then
+      //   recycles all its command buffers with one resetCommandPool per used pool
+      // - command buffers are never freed individually, but only with their command pools when the CommandBufferRing is destroyed
+      // Each recording thread exclusively uses its own threadIndex, so acquire() needs no locking; beginFrame() and endFrame() are to be
+      // called from the thread driving the frames, while no other thread is acquiring.
+      class CommandBufferRing
+      {
+      public:
+        CommandBufferRing( vk::raii::Device const & device,
+                           uint32_t                 queueFamilyIndex,
+                           uint32_t                 framesInFlight,
+                           uint32_t                 threadCount,
+                           uint32_t                 allocationBatchSize = 8 )
+          : m_device( &device ), m_allocationBatchSize( allocationBatchSize ), m_frames( framesInFlight )
+        {
+          assert( ( 0 < framesInFlight ) && ( 0 < threadCount ) && ( 0 < allocationBatchSize ) );
+          vk::CommandPoolCreateInfo commandPoolCreateInfo( vk::CommandPoolCreateFlagBits::eTransient, queueFamilyIndex );
+          for ( auto & frame : m_frames )
+          {
+            frame.threadPools.reserve( threadCount );
+            for ( uint32_t i = 0; i < threadCount; ++i )
+            {
+              // separately allocated, to keep the threads from writing to the same cache lines
+              frame.threadPools.push_back( std::unique_ptr<ThreadPool>( new ThreadPool( device, commandPoolCreateInfo ) ) );
+            }
+          }
+        }
+
+        CommandBufferRing( CommandBufferRing const & )             = delete;
+        CommandBufferRing & operator=( CommandBufferRing const & ) = delete;
+
+        // starts the next frame; returns false if the frame slot's previous work did not complete within timeout
+        bool beginFrame( uint64_t timeout = UINT64_MAX )
+        {
+          FrameSlot & frame = m_frames[( m_frameCounter + 1 ) % m_frames.size()];
+          if ( frame.fence )
+          {
+            if ( m_device->waitForFences( frame.fence, VK_TRUE, timeout ) == vk::Result::eTimeout )
+            {
+              return false;
+            }
+          }
+          else if ( frame.timelineSemaphore )
+          {
+            vk::SemaphoreWaitInfo semaphoreWaitInfo( {}, 1, &frame.timelineSemaphore, &frame.timelineValue );
+            if ( m_device->waitSemaphores( semaphoreWaitInfo, timeout ) == vk::Result::eTimeout )
+            {
+              return false;
+            }
+          }
+          frame.fence             = nullptr;
+          frame.timelineSemaphore = nullptr;
+
+          for ( auto & threadPool : frame.threadPools )
+          {
+            if ( threadPool->used[0] || threadPool->used[1] )
+            {
+              threadPool->commandPool.reset();
+              threadPool->used[0] = 0;
+              threadPool->used[1] = 0;
+            }
+          }
+          ++m_frameCounter;
+          return true;
+        }
+
+        // registers the fence signaled by the last submission of the current frame
+        void endFrame( vk::Fence fence )
+        {
+          m_frames[m_frameCounter % m_frames.size()].fence = fence;
+        }
+
+        // registers the timeline semaphore value signaled by the last submission of the current frame
+        void endFrame( vk::Semaphore timelineSemaphore, uint64_t value )
+        {
+          FrameSlot & frame       = m_frames[m_frameCounter % m_frames.size()];
+          frame.timelineSemaphore = timelineSemaphore;
+          frame.timelineValue     = value;
+        }
+
+        // hands out a command buffer, which is not yet begun, from the pool of threadIndex in the current frame;
+        // it stays valid until the beginFrame() that reuses this frame slot
+        vk::raii::CommandBuffer const & acquire( uint32_t threadIndex, vk::CommandBufferLevel level = vk::CommandBufferLevel::ePrimary )
+        {
+          assert( ( 0 < m_frameCounter ) && "CommandBufferRing::beginFrame has not been called" );
+          ThreadPool & threadPool = *m_frames[m_frameCounter % m_frames.size()].threadPools[threadIndex];
+
+          size_t                                levelIndex     = ( level == vk::CommandBufferLevel::ePrimary ) ? 0 : 1;
+          std::deque<vk::raii::CommandBuffer> & commandBuffers = threadPool.commandBuffers[levelIndex];
+          if ( threadPool.used[levelIndex] == commandBuffers.size() )
+          {
+            // a std::deque keeps the references to previously acquired command buffers valid
+            vk::raii::CommandBuffers newCommandBuffers( *m_device, vk::CommandBufferAllocateInfo( threadPool.commandPool, level, m_allocationBatchSize ) );
+            for ( auto & commandBuffer : newCommandBuffers )
+            {
+              commandBuffers.push_back( std::move( commandBuffer ) );
+            }
+          }
+          return commandBuffers[threadPool.used[levelIndex]++];
+        }
+
+        uint64_t frameCounter() const
+        {
+          return m_frameCounter;
+        }
+
+        uint32_t threadCount() const
+        {
+          return static_cast<uint32_t>( m_frames[0].threadPools.size() );
+        }
+
+      private:
+        struct ThreadPool
+        {
+          ThreadPool( vk::raii::Device const & device, vk::CommandPoolCreateInfo const & commandPoolCreateInfo )
+            : commandPool( device, commandPoolCreateInfo )
+          {
+          }
+
+          ~ThreadPool()
+          {
+            // destroying the command pool frees all its command buffers at once
+            for ( auto & levelCommandBuffers : commandBuffers )
+            {
+              for ( auto & commandBuffer : levelCommandBuffers )
+              {
+                commandBuffer.release();
+              }
+            }
+          }
+
+          vk::raii::CommandPool               commandPool;
+          std::deque<vk::raii::CommandBuffer> commandBuffers[2];  // primary and secondary ones
+          size_t                              used[2] = {};
+        };
+
+        struct FrameSlot
+        {
+          std::vector<std::unique_ptr<ThreadPool>> threadPools;
+          vk::Fence                                fence;
+          vk::Semaphore                            timelineSemaphore;
+          uint64_t                                 timelineValue = 0;
+        };
+
+      private:
+        vk::raii::Device const * m_device;
+        uint32_t                 m_allocationBatchSize;
+        std::vector<FrameSlot>   m_frames;
+        uint64_t                 m_frameCounter = 0;
+      };
+    }  // namespace su
+  }  // namespace raii
+}  // namespace vk
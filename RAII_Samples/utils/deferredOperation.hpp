@@ -0,0 +1,293 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <vulkan/vulkan_raii.hpp>
+
+namespace vk
+{
+  namespace raii
+  {
+    namespace su
+    {
+      // Owns a vk::raii::DeferredOperationKHR, and runs it to completion on the threads of some thread pool:
+      //   vk::raii::su::DeferredOperation deferredOperation( device );
+      //   vk::Result result = device.buildAccelerationStructuresKHR( *deferredOperation, infos, pBuildRangeInfos );
+      //   std::shared_future<vk::Result> future = deferredOperation.join( result, executor );
+      // - join() hands up to getMaxConcurrency() joiners to the executor, which runs each of them on some thread, typically by pushing it
+      //   into the queue of a thread pool
+      // - a joiner calls vkDeferredOperationJoinKHR until it returns eSuccess or eThreadDoneKHR, and yields on eThreadIdleKHR; the last
+      //   joiner never leaves on eThreadDoneKHR, so the operation can't be left incomplete
+      // - the future holds the result of the deferred command, or the vk::SystemError it failed with; if the command didn't defer at all,
+      //   it is ready right away
+      // - wait() lets the calling thread join as well, instead of just blocking on the future
+      // - the destructor waits for all joiners to leave, as a deferred operation must not be destroyed while in flight; whatever was
+      //   passed to the deferred command has to stay valid that long as well
+      // join() and wait() are to be called from one thread; the executor has to run each joiner eventually.
+      class DeferredOperation
+      {
+      public:
+        using Executor = std::function<void( std::function<void()> )>;
+
+        explicit DeferredOperation( vk::raii::Device const & device ) : m_state( new State( device ) ) {}
+
+        ~DeferredOperation()
+        {
+          std::unique_lock<std::mutex> lock( m_state->mutex );
+          m_state->joinersDone.wait( lock, [this]() { return m_state->joinerCount == 0; } );
+        }
+
+        DeferredOperation( DeferredOperation const & )             = delete;
+        DeferredOperation & operator=( DeferredOperation const & ) = delete;
+
+        // to be passed to the deferrable command
+        vk::raii::DeferredOperationKHR const & operator*() const
+        {
+          return m_state->operation;
+        }
+
+        // to be called once, with the result of the command the operation was passed to; a maxJoinerCount of 0 limits the joiners to
+        // std::thread::hardware_concurrency()
+        std::shared_future<vk::Result> join( vk::Result commandResult, Executor const & executor, uint32_t maxJoinerCount = 0 )
+        {
+          assert( !m_future.valid() );
+          m_future = m_state->promise.get_future().share();
+          if ( commandResult == vk::Result::eOperationDeferredKHR )
+          {
+            if ( maxJoinerCount == 0 )
+            {
+              maxJoinerCount = ( std::max )( 1u, std::thread::hardware_concurrency() );
+            }
+            uint32_t joinerCount = ( std::min )( ( std::max )( 1u, m_state->operation.getMaxConcurrency() ), maxJoinerCount );
+            {
+              // all joiners are counted up front, such that none of them takes itself for the last one while others are yet to start
+              std::lock_guard<std::mutex> guard( m_state->mutex );
+              m_state->joinerCount = joinerCount;
+            }
+            State * state = m_state.get();
+            for ( uint32_t i = 0; i < joinerCount; ++i )
+            {
+              try
+              {
+                executor( [state]() { runJoiner( *state ); } );
+              }
+              catch ( ... )
+              {
+                // the executor refused a joiner: the remaining ones are not started, and the calling thread takes over their part
+                {
+                  std::lock_guard<std::mutex> guard( m_state->mutex );
+                  m_state->joinerCount -= joinerCount - i - 1;
+                }
+                runJoiner( *m_state );
+                break;
+              }
+            }
+          }
+          else if ( static_cast<int32_t>( commandResult ) < 0 )
+          {
+            fulfill( *m_state, makeExceptionPtr( commandResult ) );
+          }
+          else
+          {
+            // eOperationNotDeferredKHR means the command completed successfully right away
+            fulfill( *m_state, ( commandResult == vk::Result::eOperationNotDeferredKHR ) ? vk::Result::eSuccess : commandResult );
+          }
+          return m_future;
+        }
+
+        // joins the operation on the calling thread as well, and returns its result, or throws the error it failed with
+        vk::Result wait()
+        {
+          assert( m_future.valid() );
+          bool joining = false;
+          {
+            std::lock_guard<std::mutex> guard( m_state->mutex );
+            if ( !m_state->fulfilled )
+            {
+              ++m_state->joinerCount;
+              joining = true;
+            }
+          }
+          if ( joining )
+          {
+            runJoiner( *m_state );
+          }
+          return m_future.get();
+        }
+
+      private:
+        struct State
+        {
+          explicit State( vk::raii::Device const & device ) : operation( device ) {}
+
+          vk::raii::DeferredOperationKHR operation;
+          std::promise<vk::Result>       promise;
+
+          // guarded by mutex
+          std::mutex              mutex;
+          std::condition_variable joinersDone;
+          uint32_t                joinerCount = 0;
+          bool                    fulfilled   = false;
+        };
+
+        static void runJoiner( State & state )
+        {
+          try
+          {
+            for ( ;; )
+            {
+              vk::Result result = state.operation.join();
+              if ( result == vk::Result::eSuccess )
+              {
+                fulfill( state, getResult( state.operation ) );
+                break;
+              }
+              if ( ( result == vk::Result::eThreadDoneKHR ) && tryLeave( state ) )
+              {
+                return;
+              }
+              // eThreadIdleKHR, or eThreadDoneKHR for the last joiner: there might be more work later on
+              std::this_thread::yield();
+            }
+          }
+          catch ( ... )
+          {
+            fulfill( state, std::current_exception() );
+          }
+          leave( state );
+        }
+
+        // vk::raii::DeferredOperationKHR::getResult treats any result but eSuccess and eNotReady as an error, while the deferred command
+        // might have returned some other success code, like ePipelineCompileRequired
+        static vk::Result getResult( vk::raii::DeferredOperationKHR const & operation )
+        {
+          vk::Result result = static_cast<vk::Result>( operation.getDispatcher()->vkGetDeferredOperationResultKHR(
+            static_cast<VkDevice>( operation.getDevice() ), static_cast<VkDeferredOperationKHR>( *operation ) ) );
+          if ( static_cast<int32_t>( result ) < 0 )
+          {
+            vk::detail::throwResultException( result, "vk::raii::su::DeferredOperation" );
+          }
+          assert( result != vk::Result::eNotReady );
+          return result;
+        }
+
+        static std::exception_ptr makeExceptionPtr( vk::Result result )
+        {
+          try
+          {
+            vk::detail::throwResultException( result, "vk::raii::su::DeferredOperation" );
+          }
+          catch ( ... )
+          {
+            return std::current_exception();
+          }
+        }
+
+        template <typename T>
+        static void fulfill( State & state, T const & resultOrException )
+        {
+          std::lock_guard<std::mutex> guard( state.mutex );
+          if ( !state.fulfilled )
+          {
+            state.fulfilled = true;
+            setPromise( state.promise, resultOrException );
+          }
+        }
+
+        static void setPromise( std::promise<vk::Result> & promise, vk::Result result )
+        {
+          promise.set_value( result );
+        }
+
+        static void setPromise( std::promise<vk::Result> & promise, std::exception_ptr const & exception )
+        {
+          promise.set_exception( exception );
+        }
+
+        // a joiner may leave on eThreadDoneKHR only if some other one is still around to complete the operation
+        static bool tryLeave( State & state )
+        {
+          std::lock_guard<std::mutex> guard( state.mutex );
+          if ( state.fulfilled || ( 1 < state.joinerCount ) )
+          {
+            --state.joinerCount;
+            return true;
+          }
+          return false;
+        }
+
+        static void leave( State & state )
+        {
+          std::lock_guard<std::mutex> guard( state.mutex );
+          assert( 0 < state.joinerCount );
+          if ( --state.joinerCount == 0 )
+          {
+            // notified under the lock, as the destructor might destroy the state as soon as it gets hold of the mutex
+            state.joinersDone.notify_all();
+          }
+        }
+
+      private:
+        std::unique_ptr<State>         m_state;
+        std::shared_future<vk::Result> m_future;
+      };
+
+      // creates ray tracing pipelines through a deferred operation, spreading their compilation over the threads of the executor and the
+      // calling thread; unlike vk::raii::Device::createRayTracingPipelinesKHR, this keeps the pipeline handles of a deferred creation
+      inline std::vector<vk::raii::Pipeline> createRayTracingPipelines( vk::raii::Device const &                                          device,
+                                                                        vk::Optional<vk::raii::PipelineCache const> const &               pipelineCache,
+                                                                        vk::ArrayProxy<vk::RayTracingPipelineCreateInfoKHR const> const & createInfos,
+                                                                        DeferredOperation::Executor const &                               executor,
+                                                                        uint32_t                                                          maxJoinerCount = 0 )
+      {
+        std::vector<vk::Pipeline> pipelines( createInfos.size() );
+        std::exception_ptr        exception;
+        vk::Result                result = vk::Result::eSuccess;
+        {
+          DeferredOperation deferredOperation( device );
+          result = static_cast<vk::Result>(
+            device.getDispatcher()->vkCreateRayTracingPipelinesKHR( static_cast<VkDevice>( *device ),
+                                                                    static_cast<VkDeferredOperationKHR>( **deferredOperation ),
+                                                                    pipelineCache ? static_cast<VkPipelineCache>( **pipelineCache ) : 0,
+                                                                    createInfos.size(),
+                                                                    reinterpret_cast<VkRayTracingPipelineCreateInfoKHR const *>( createInfos.data() ),
+                                                                    nullptr,
+                                                                    reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
+          deferredOperation.join( result, executor, maxJoinerCount );
+          try
+          {
+            result = deferredOperation.wait();
+          }
+          catch ( ... )
+          {
+            exception = std::current_exception();
+          }
+        }
+
+        // on failure, some of the pipelines might have been created nevertheless; wrapping them first takes care of destroying them
+        std::vector<vk::raii::Pipeline> pipelinesRAII;
+        pipelinesRAII.reserve( pipelines.size() );
+        for ( auto const & pipeline : pipelines )
+        {
+          pipelinesRAII.push_back( vk::raii::Pipeline( device, static_cast<VkPipeline>( pipeline ), nullptr, result ) );
+        }
+        if ( exception )
+        {
+          std::rethrow_exception( exception );
+        }
+        return pipelinesRAII;
+      }
+    }  // namespace su
+  }    // namespace raii
+}  // namespace vk
@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+#include <vulkan/vulkan_raii.hpp>
+
+namespace vk
+{
+  namespace raii
+  {
+    namespace su
+    {
+      // Hands out descriptor sets from a growing list of vk::raii::DescriptorPools.
+      // - the pools are sized from a template of DescriptorPoolSizes, holding the number of descriptors of each type per descriptor set
+      // - if a pool is exhausted (eErrorOutOfPoolMemory or eErrorFragmentedPool), the next pool is used, or a new one twice as large is created,
+      //   and the allocation is retried
+      // - individual descriptor sets are never freed; reset() recycles all pools at once, typically once per frame, after the fence of
+      //   that frame has been signaled
+      // A DescriptorAllocator is not synchronized in any way: use one per thread (and per frame in flight).
+      class DescriptorAllocator
+      {
+      public:
+        DescriptorAllocator( vk::raii::Device const &                    device,
+                             std::vector<vk::DescriptorPoolSize> const & poolSizesPerSet,
+                             uint32_t                                    initialSetsPerPool = 64,
+                             uint32_t                                    maxSetsPerPool     = 4096,
+                             vk::DescriptorPoolCreateFlags               poolCreateFlags    = {} )
+          : m_device( &device )
+          , m_poolSizesPerSet( poolSizesPerSet )
+          , m_setsPerPool( initialSetsPerPool )
+          , m_maxSetsPerPool( ( std::max )( initialSetsPerPool, maxSetsPerPool ) )
+          , m_poolCreateFlags( poolCreateFlags )
+        {
+          assert( !m_poolSizesPerSet.empty() && ( 0 < initialSetsPerPool ) );
+          // descriptor sets are not freed individually
+          assert( !( poolCreateFlags & vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet ) );
+        }
+
+        DescriptorAllocator( DescriptorAllocator const & )             = delete;
+        DescriptorAllocator( DescriptorAllocator && )                  = default;
+        DescriptorAllocator & operator=( DescriptorAllocator const & ) = delete;
+        DescriptorAllocator & operator=( DescriptorAllocator && )      = default;
+
+        vk::DescriptorSet allocate( vk::DescriptorSetLayout const & descriptorSetLayout, void const * pNext = nullptr )
+        {
+          vk::DescriptorSet descriptorSet;
+          allocate( descriptorSetLayout, &descriptorSet, pNext );
+          return descriptorSet;
+        }
+
+        std::vector<vk::DescriptorSet> allocate( vk::ArrayProxy<const vk::DescriptorSetLayout> const & descriptorSetLayouts, void const * pNext = nullptr )
+        {
+          std::vector<vk::DescriptorSet> descriptorSets( descriptorSetLayouts.size() );
+          allocate( descriptorSetLayouts, descriptorSets.data(), pNext );
+          return descriptorSets;
+        }
+
+        // allocates descriptorSetLayouts.size() descriptor sets into pDescriptorSets, without any additional heap allocation
+        void allocate( vk::ArrayProxy<const vk::DescriptorSetLayout> const & descriptorSetLayouts, vk::DescriptorSet * pDescriptorSets, void const * pNext = nullptr )
+        {
+          bool freshPool = m_pools.empty();
+          if ( freshPool )
+          {
+            addPool();
+          }
+
+          vk::DescriptorSetAllocateInfo descriptorSetAllocateInfo(
+            *m_pools[m_currentPool], descriptorSetLayouts.size(), descriptorSetLayouts.data(), pNext );
+          vk::Result result = tryAllocate( descriptorSetAllocateInfo, pDescriptorSets );
+          while ( ( ( result == vk::Result::eErrorOutOfPoolMemory ) || ( result == vk::Result::eErrorFragmentedPool ) ) && !freshPool )
+          {
+            // the current pool is exhausted -> move on to the next one, which after a reset() might be an existing one, and try again; a fresh
+            // pool can only fail if the request itself is larger than a pool, which is reported like any other error
+            freshPool = ( ++m_currentPool == m_pools.size() );
+            if ( freshPool )
+            {
+              addPool();
+            }
+            descriptorSetAllocateInfo.descriptorPool = *m_pools[m_currentPool];
+            result                                   = tryAllocate( descriptorSetAllocateInfo, pDescriptorSets );
+          }
+          vk::detail::resultCheck( result, "vk::raii::su::DescriptorAllocator::allocate" );
+        }
+
+        // returns all descriptor sets allocated so far to their pools; they must no longer be in use by the device
+        void reset()
+        {
+          if ( !m_pools.empty() )
+          {
+            for ( size_t i = 0; i <= m_currentPool; ++i )
+            {
+              m_pools[i].reset();
+            }
+            m_currentPool = 0;
+          }
+        }
+
+        size_t poolCount() const
+        {
+          return m_pools.size();
+        }
+
+      private:
+        vk::Result tryAllocate( vk::DescriptorSetAllocateInfo const & descriptorSetAllocateInfo, vk::DescriptorSet * pDescriptorSets ) const
+        {
+          // call the dispatcher directly: running out of pool memory is an expected result here, not an exception
+          return static_cast<vk::Result>(
+            m_device->getDispatcher()->vkAllocateDescriptorSets( static_cast<VkDevice>( **m_device ),
+                                                                 reinterpret_cast<VkDescriptorSetAllocateInfo const *>( &descriptorSetAllocateInfo ),
+                                                                 reinterpret_cast<VkDescriptorSet *>( pDescriptorSets ) ) );
+        }
+
+        void addPool()
+        {
+          if ( !m_pools.empty() )
+          {
+            m_setsPerPool = ( std::min )( 2 * m_setsPerPool, m_maxSetsPerPool );
+          }
+
+          std::vector<vk::DescriptorPoolSize> poolSizes( m_poolSizesPerSet );
+          for ( auto & poolSize : poolSizes )
+          {
+            poolSize.descriptorCount *= m_setsPerPool;
+          }
+          vk::DescriptorPoolCreateInfo descriptorPoolCreateInfo( m_poolCreateFlags, m_setsPerPool, poolSizes );
+          m_pools.emplace_back( *m_device, descriptorPoolCreateInfo );
+          m_currentPool = m_pools.size() - 1;
+        }
+
+      private:
+        vk::raii::Device const *              m_device;
+        std::vector<vk::DescriptorPoolSize>   m_poolSizesPerSet;
+        uint32_t                              m_setsPerPool;
+        uint32_t                              m_maxSetsPerPool;
+        vk::DescriptorPoolCreateFlags         m_poolCreateFlags;
+        std::vector<vk::raii::DescriptorPool> m_pools;
+        size_t                                m_currentPool = 0;
+      };
+    }  // namespace su
+  }  // namespace raii
+}  // namespace vk
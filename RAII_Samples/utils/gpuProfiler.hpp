@@ -0,0 +1,414 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <vulkan/vulkan_raii.hpp>
+
+namespace vk
+{
+  namespace raii
+  {
+    namespace su
+    {
+      namespace detail
+      {
+        // writes nanoseconds as microseconds, the time unit of the Chrome trace format, keeping their precision
+        inline void writeMicroseconds( std::ostream & os, uint64_t ns )
+        {
+          char fraction[4] = { static_cast<char>( '0' + ns % 1000 / 100 ), static_cast<char>( '0' + ns % 100 / 10 ), static_cast<char>( '0' + ns % 10 ), 0 };
+          os << ns / 1000 << '.' << fraction;
+        }
+
+        inline void writeJsonString( std::ostream & os, char const * s )
+        {
+          static char const hexDigits[] = "0123456789abcdef";
+          os << '"';
+          for ( ; *s; ++s )
+          {
+            unsigned char c = static_cast<unsigned char>( *s );
+            if ( ( c == '"' ) || ( c == '\\' ) )
+            {
+              os << '\\' << *s;
+            }
+            else if ( c < 0x20 )
+            {
+              os << "\\u00" << hexDigits[c >> 4] << hexDigits[c & 0xF];
+            }
+            else
+            {
+              os << *s;
+            }
+          }
+          os << '"';
+        }
+      }  // namespace detail
+
+      // GPU timing of nested scopes in the command buffers of each frame, by pairs of timestamps written into a ring of query pools:
+      //   vk::raii::su::GpuProfiler profiler( device, physicalDevice, graphicsQueueFamilyIndex, framesInFlight );
+      //   profiler.calibrate();
+      //   profiler.beginFrame();
+      //   {
+      //     vk::raii::su::GpuProfiler::Scope scope( profiler, commandBuffer, "shadow pass" );
+      //     ...
+      //   }
+      //   profiler.writeChromeTrace( traceFile );
+      // - each frame in flight has a query pool of its own; beginFrame() reads back the results of the frames completed by now with
+      //   eWithAvailability, without ever waiting, and does not profile the new frame if its query pool is still waiting for results
+      // - the query pools are reset on the host right after their results have been read, so the device needs the hostQueryReset feature
+      // - the timestamps are written with eAllCommands, and converted to nanoseconds with timestampPeriod, respecting timestampValidBits
+      // - calibrate() correlates the timestamps with a host clock by getCalibratedTimestampsKHR; by default, that's CLOCK_MONOTONIC, as used
+      //   by std::chrono::steady_clock on Linux; without calibration, the times count from the first scope read back
+      // - the timings of the latest maxHistory scopes are kept, and each scope name accumulates count and total, minimum, and maximum duration;
+      //   the statistics are keyed by the name pointers, compared by contents, so reading back a scope doesn't allocate once its name is known
+      // - writeChromeTrace() exports the kept timings as JSON, to be viewed with chrome://tracing or Perfetto
+      // Just the pointers to the scope names are kept, so string literals serve best. Every profiled frame has to be submitted, and all
+      // functions are to be called from the thread recording the scopes.
+      class GpuProfiler
+      {
+      public:
+        struct ScopeTiming
+        {
+          char const * name;
+          uint32_t     depth;  // the nesting depth, 0 for outermost scopes
+          uint64_t     frame;  // the frameCounter() of the frame the scope was recorded in
+          uint64_t     beginNs;
+          uint64_t     endNs;
+        };
+
+        struct ScopeStatistics
+        {
+          uint64_t count   = 0;
+          uint64_t totalNs = 0;
+          uint64_t minNs   = UINT64_MAX;
+          uint64_t maxNs   = 0;
+        };
+
+        struct NameLess
+        {
+          bool operator()( char const * lhs, char const * rhs ) const
+          {
+            return strcmp( lhs, rhs ) < 0;
+          }
+        };
+
+        // writes a timestamp on construction and another one on destruction; scopes beyond maxScopesPerFrame, or in frames not profiled,
+        // write nothing
+        class Scope
+        {
+        public:
+          Scope( GpuProfiler & profiler, vk::raii::CommandBuffer const & commandBuffer, char const * name )
+            : m_profiler( profiler ), m_commandBuffer( commandBuffer ), m_query( profiler.beginScope( commandBuffer, name ) )
+          {
+          }
+
+          ~Scope()
+          {
+            m_profiler.endScope( m_commandBuffer, m_query );
+          }
+
+          Scope( Scope const & )             = delete;
+          Scope & operator=( Scope const & ) = delete;
+
+        private:
+          GpuProfiler &                   m_profiler;
+          vk::raii::CommandBuffer const & m_commandBuffer;
+          uint32_t                        m_query;
+        };
+
+        GpuProfiler( vk::raii::Device const &         device,
+                     vk::raii::PhysicalDevice const & physicalDevice,
+                     uint32_t                         queueFamilyIndex,
+                     uint32_t                         framesInFlight,
+                     uint32_t                         maxScopesPerFrame = 256,
+                     size_t                           maxHistory        = 65536 )
+          : m_device( &device )
+          , m_timestampPeriod( physicalDevice.getProperties().limits.timestampPeriod )
+          , m_maxScopesPerFrame( maxScopesPerFrame )
+          , m_maxHistory( maxHistory )
+          , m_results( 4 * size_t( maxScopesPerFrame ) )
+        {
+          assert( ( 0 < framesInFlight ) && ( 0 < maxScopesPerFrame ) );
+          std::vector<vk::QueueFamilyProperties> queueFamilyProperties = physicalDevice.getQueueFamilyProperties();
+          assert( queueFamilyIndex < queueFamilyProperties.size() );
+          uint32_t timestampValidBits = queueFamilyProperties[queueFamilyIndex].timestampValidBits;
+          if ( timestampValidBits == 0 )
+          {
+            throw std::runtime_error( "GpuProfiler: queue family " + std::to_string( queueFamilyIndex ) + " does not support timestamps" );
+          }
+          m_timestampMask = ( timestampValidBits < 64 ) ? ( ( uint64_t( 1 ) << timestampValidBits ) - 1 ) : UINT64_MAX;
+
+          vk::QueryPoolCreateInfo queryPoolCreateInfo( {}, vk::QueryType::eTimestamp, 2 * maxScopesPerFrame );
+          m_frames.reserve( framesInFlight );
+          for ( uint32_t i = 0; i < framesInFlight; ++i )
+          {
+            m_frames.push_back( FrameSlot( device, queryPoolCreateInfo ) );
+            m_frames.back().queryPool.reset( 0, 2 * maxScopesPerFrame );
+          }
+        }
+
+        GpuProfiler( GpuProfiler const & )             = delete;
+        GpuProfiler & operator=( GpuProfiler const & ) = delete;
+
+        // correlates the timestamps with the host clock of hostTimeDomain, which counts hostTicksPerSecond; on Windows, that would be
+        // vk::TimeDomainKHR::eQueryPerformanceCounter with the frequency given by QueryPerformanceFrequency;
+        // to be called again now and then, as the clocks drift apart; returns the maximal deviation of the sampled timestamps in nanoseconds
+        uint64_t calibrate( vk::TimeDomainKHR hostTimeDomain = vk::TimeDomainKHR::eClockMonotonic, uint64_t hostTicksPerSecond = 1000000000 )
+        {
+          std::array<vk::CalibratedTimestampInfoKHR, 2> timestampInfos = { { vk::CalibratedTimestampInfoKHR( vk::TimeDomainKHR::eDevice ),
+                                                                               vk::CalibratedTimestampInfoKHR( hostTimeDomain ) } };
+          std::pair<std::vector<uint64_t>, uint64_t> timestamps = m_device->getCalibratedTimestampsKHR( timestampInfos );
+
+          uint64_t hostTicks = timestamps.first[1];
+          m_referenceTicks   = timestamps.first[0];
+          m_referenceNs      = hostTicks / hostTicksPerSecond * 1000000000 + hostTicks % hostTicksPerSecond * 1000000000 / hostTicksPerSecond;
+          m_hasReference     = true;
+          return timestamps.second;
+        }
+
+        // starts the next frame; returns false if that frame is not profiled, as its query pool still waits for the results of an earlier frame
+        bool beginFrame()
+        {
+          assert( ( m_depth == 0 ) && "GpuProfiler::beginFrame called within a scope" );
+          collect();
+          ++m_frameCounter;
+          FrameSlot & frame = m_frames[m_frameCounter % m_frames.size()];
+          m_profiling       = frame.scopes.empty();
+          if ( m_profiling )
+          {
+            frame.frame = m_frameCounter;
+          }
+          else
+          {
+            ++m_skippedFrameCount;
+          }
+          return m_profiling;
+        }
+
+        // reads back the results of all frames completed by now, in the order of the frames, without waiting for any of them
+        void collect()
+        {
+          for ( ;; )
+          {
+            FrameSlot * oldestFrame = nullptr;
+            for ( auto & frame : m_frames )
+            {
+              if ( !frame.scopes.empty() && ( !oldestFrame || ( frame.frame < oldestFrame->frame ) ) )
+              {
+                oldestFrame = &frame;
+              }
+            }
+            if ( !oldestFrame || !readBack( *oldestFrame ) )
+            {
+              break;
+            }
+          }
+        }
+
+        std::deque<ScopeTiming> const & timings() const
+        {
+          return m_timings;
+        }
+
+        std::map<char const *, ScopeStatistics, NameLess> const & statistics() const
+        {
+          return m_statistics;
+        }
+
+        void clear()
+        {
+          m_timings.clear();
+          m_statistics.clear();
+        }
+
+        uint64_t frameCounter() const
+        {
+          return m_frameCounter;
+        }
+
+        // the number of frames not profiled, as their query pool was still waiting for results
+        uint64_t skippedFrameCount() const
+        {
+          return m_skippedFrameCount;
+        }
+
+        // the number of scopes not timed, as their frame already held maxScopesPerFrame scopes
+        uint64_t droppedScopeCount() const
+        {
+          return m_droppedScopeCount;
+        }
+
+        // writes the kept timings as complete events of a thread named "GPU"
+        void writeChromeTrace( std::ostream & os, uint32_t processId = 0, uint32_t threadId = 0 ) const
+        {
+          os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+          os << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << processId << ",\"tid\":" << threadId << ",\"args\":{\"name\":\"GPU\"}}";
+          for ( auto const & timing : m_timings )
+          {
+            os << ",\n{\"name\":";
+            detail::writeJsonString( os, timing.name );
+            os << ",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":" << processId << ",\"tid\":" << threadId << ",\"ts\":";
+            detail::writeMicroseconds( os, timing.beginNs );
+            os << ",\"dur\":";
+            detail::writeMicroseconds( os, timing.endNs - timing.beginNs );
+            os << ",\"args\":{\"frame\":" << timing.frame << ",\"depth\":" << timing.depth << "}}";
+          }
+          os << "\n]}\n";
+        }
+
+      private:
+        static const uint32_t NoQuery = ~0u;
+
+        struct ScopeRecord
+        {
+          char const * name;
+          uint32_t     depth;
+        };
+
+        struct FrameSlot
+        {
+          FrameSlot( vk::raii::Device const & device, vk::QueryPoolCreateInfo const & queryPoolCreateInfo ) : queryPool( device, queryPoolCreateInfo ) {}
+
+          vk::raii::QueryPool      queryPool;
+          std::vector<ScopeRecord> scopes;  // the scope with index i uses the queries 2 * i and 2 * i + 1
+          uint64_t                 frame = 0;
+        };
+
+        uint32_t beginScope( vk::raii::CommandBuffer const & commandBuffer, char const * name )
+        {
+          assert( ( 0 < m_frameCounter ) && "GpuProfiler::beginFrame has not been called" );
+          uint32_t depth = m_depth++;
+          if ( !m_profiling )
+          {
+            return NoQuery;
+          }
+          FrameSlot & frame = m_frames[m_frameCounter % m_frames.size()];
+          if ( frame.scopes.size() == m_maxScopesPerFrame )
+          {
+            ++m_droppedScopeCount;
+            return NoQuery;
+          }
+          uint32_t query = 2 * static_cast<uint32_t>( frame.scopes.size() );
+          frame.scopes.push_back( { name, depth } );
+          commandBuffer.writeTimestamp2( vk::PipelineStageFlagBits2::eAllCommands, frame.queryPool, query );
+          return query;
+        }
+
+        void endScope( vk::raii::CommandBuffer const & commandBuffer, uint32_t query )
+        {
+          assert( 0 < m_depth );
+          --m_depth;
+          if ( query != NoQuery )
+          {
+            commandBuffer.writeTimestamp2( vk::PipelineStageFlagBits2::eAllCommands, m_frames[m_frameCounter % m_frames.size()].queryPool, query + 1 );
+          }
+        }
+
+        // returns false if not all of the frame's timestamps are available yet
+        bool readBack( FrameSlot & frame )
+        {
+          // each query gives its value and its availability
+          vk::ResultValue<vk::QueryResultView<uint64_t>> results =
+            frame.queryPool.getResults<uint64_t>( 0, 2 * static_cast<uint32_t>( frame.scopes.size() ), m_results, vk::QueryResultFlagBits::eWithAvailability );
+          if ( results.result == vk::Result::eNotReady )
+          {
+            return false;
+          }
+          vk::QueryResultView<uint64_t> const & timestamps = results.value;
+
+          if ( !m_hasReference )
+          {
+            // without calibration, the times count from the earliest timestamp of the first frame read back
+            m_referenceTicks = timestamps[0];
+            for ( uint32_t i = 1; i < frame.scopes.size(); ++i )
+            {
+              if ( ticksSince( timestamps[2 * i], m_referenceTicks ) < 0 )
+              {
+                m_referenceTicks = timestamps[2 * i];
+              }
+            }
+            m_referenceNs  = 0;
+            m_hasReference = true;
+          }
+
+          for ( uint32_t i = 0; i < frame.scopes.size(); ++i )
+          {
+            uint64_t beginTicks = timestamps[2 * i];
+            uint64_t endTicks   = timestamps[2 * i + 1];
+            assert( timestamps.isAvailable( 2 * i ) && timestamps.isAvailable( 2 * i + 1 ) );
+
+            ScopeTiming timing;
+            timing.name    = frame.scopes[i].name;
+            timing.depth   = frame.scopes[i].depth;
+            timing.frame   = frame.frame;
+            timing.beginNs = m_referenceNs + static_cast<uint64_t>( toNanoseconds( ticksSince( beginTicks, m_referenceTicks ) ) );
+            timing.endNs   = timing.beginNs + static_cast<uint64_t>( toNanoseconds( static_cast<int64_t>( ( endTicks - beginTicks ) & m_timestampMask ) ) );
+
+            uint64_t          durationNs = timing.endNs - timing.beginNs;
+            ScopeStatistics & statistics = m_statistics[timing.name];
+            statistics.count++;
+            statistics.totalNs += durationNs;
+            statistics.minNs = ( std::min )( statistics.minNs, durationNs );
+            statistics.maxNs = ( std::max )( statistics.maxNs, durationNs );
+
+            if ( m_timings.size() == m_maxHistory )
+            {
+              m_timings.pop_front();
+            }
+            m_timings.push_back( timing );
+          }
+
+          frame.queryPool.reset( 0, timestamps.size() );
+          frame.scopes.clear();
+          return true;
+        }
+
+        int64_t toNanoseconds( int64_t ticks ) const
+        {
+          return static_cast<int64_t>( std::llround( static_cast<double>( ticks ) * m_timestampPeriod ) );
+        }
+
+        // the difference of two timestamps, modulo 2^timestampValidBits, sign-extended
+        int64_t ticksSince( uint64_t ticks, uint64_t referenceTicks ) const
+        {
+          uint64_t difference = ( ticks - referenceTicks ) & m_timestampMask;
+          if ( difference & ~( m_timestampMask >> 1 ) )
+          {
+            difference |= ~m_timestampMask;
+          }
+          return static_cast<int64_t>( difference );
+        }
+
+      private:
+        vk::raii::Device const *                          m_device;
+        float                                             m_timestampPeriod;
+        uint64_t                                          m_timestampMask;
+        uint32_t                                          m_maxScopesPerFrame;
+        size_t                                            m_maxHistory;
+        std::vector<FrameSlot>                            m_frames;
+        std::vector<uint64_t>                             m_results;
+        uint64_t                                          m_frameCounter      = 0;
+        uint64_t                                          m_skippedFrameCount = 0;
+        uint64_t                                          m_droppedScopeCount = 0;
+        uint32_t                                          m_depth             = 0;
+        bool                                              m_profiling         = false;
+        bool                                              m_hasReference      = false;
+        uint64_t                                          m_referenceTicks    = 0;
+        uint64_t                                          m_referenceNs       = 0;
+        std::deque<ScopeTiming>                           m_timings;
+        std::map<char const *, ScopeStatistics, NameLess> m_statistics;
+      };
+    }  // namespace su
+  }    // namespace raii
+}  // namespace vk
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cassert>
+#include <cstring>
+#include <vulkan/vulkan.hpp>
+
+#if defined( __SSE__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( 1 <= _M_IX86_FP ) )
+#  include <xmmintrin.h>
+#elif defined( __ARM_NEON ) || defined( _M_ARM64 )
+#  include <arm_neon.h>
+#endif
+
+namespace vk
+{
+  namespace raii
+  {
+    namespace su
+    {
+      // the fields of an acceleration structure instance besides its transform
+      struct InstanceAttributes
+      {
+        uint32_t                     instanceCustomIndex                    = 0;  // just the lower 24 bits are used
+        uint32_t                     instanceShaderBindingTableRecordOffset = 0;  // just the lower 24 bits are used
+        uint8_t                      mask                                   = 0xFF;
+        vk::GeometryInstanceFlagsKHR flags;
+        uint64_t                     accelerationStructureReference = 0;
+      };
+
+      namespace detail
+      {
+        static_assert( sizeof( vk::TransformMatrixKHR ) == 12 * sizeof( float ), "unexpected layout of vk::TransformMatrixKHR" );
+
+        // transposes the top three rows of a column-major 4x4 matrix into the row-major 3x4 matrix of an instance
+        inline void packTransform( float const * pMatrix, vk::TransformMatrixKHR & transform )
+        {
+          float * pRows = reinterpret_cast<float *>( &transform );
+#if defined( __SSE__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( 1 <= _M_IX86_FP ) )
+          __m128 column0 = _mm_loadu_ps( pMatrix );
+          __m128 column1 = _mm_loadu_ps( pMatrix + 4 );
+          __m128 column2 = _mm_loadu_ps( pMatrix + 8 );
+          __m128 column3 = _mm_loadu_ps( pMatrix + 12 );
+          _MM_TRANSPOSE4_PS( column0, column1, column2, column3 );
+          _mm_storeu_ps( pRows, column0 );
+          _mm_storeu_ps( pRows + 4, column1 );
+          _mm_storeu_ps( pRows + 8, column2 );
+#elif defined( __ARM_NEON ) || defined( _M_ARM64 )
+          // vld4q_f32 de-interleaves by four, which loads the rows of a column-major matrix
+          float32x4x4_t rows = vld4q_f32( pMatrix );
+          vst1q_f32( pRows, rows.val[0] );
+          vst1q_f32( pRows + 4, rows.val[1] );
+          vst1q_f32( pRows + 8, rows.val[2] );
+#else
+          for ( int row = 0; row < 3; ++row )
+          {
+            for ( int column = 0; column < 4; ++column )
+            {
+              pRows[4 * row + column] = pMatrix[4 * column + row];
+            }
+          }
+#endif
+        }
+      }  // namespace detail
+
+      // Bulk packing of model matrices into vk::AccelerationStructureInstanceKHR (aka vk::AccelerationStructureInstanceNV), typically
+      // right into the mapped instance buffer of a top-level acceleration structure:
+      //   std::vector<glm::mat4x4> models;
+      //   vk::raii::su::packInstances( vk::StridedArrayProxy<float const>( count, &models[0][0][0], sizeof( glm::mat4x4 ) ),
+      //                                attributes,
+      //                                static_cast<vk::AccelerationStructureInstanceKHR *>( instanceMemory.mapMemory( 0, size ) ) );
+      // - each matrix is a column-major 4x4 matrix of floats, as glm::mat4x4, with its translation in the fourth column; just its top three
+      //   rows are used; the stride allows picking the matrices out of an array of larger structures
+      // - the transposition is done with SSE on x86 and x64, with NEON on ARM64, and with plain loops anywhere else
+      // - the instances are written front to back, as write-combined mapped memory likes it, and never read
+      // - packTransforms() just rewrites the transforms of instances whose other fields are already set, as needed for animated instances
+      inline void packTransforms( vk::StridedArrayProxy<float const> const & matrices, vk::AccelerationStructureInstanceKHR * pInstances )
+      {
+        assert( matrices.empty() || ( 16 * sizeof( float ) <= matrices.stride() ) );
+        uint8_t const * pMatrix = reinterpret_cast<uint8_t const *>( matrices.data() );
+        for ( uint32_t i = 0; i < matrices.size(); ++i, pMatrix += matrices.stride() )
+        {
+          detail::packTransform( reinterpret_cast<float const *>( pMatrix ), pInstances[i].transform );
+        }
+      }
+
+      inline void packInstances( vk::StridedArrayProxy<float const> const &              matrices,
+                                 vk::StridedArrayProxy<InstanceAttributes const> const & attributes,
+                                 vk::AccelerationStructureInstanceKHR *                  pInstances )
+      {
+        assert( ( matrices.size() == attributes.size() ) && ( matrices.empty() || ( 16 * sizeof( float ) <= matrices.stride() ) ) );
+        uint8_t const * pMatrix     = reinterpret_cast<uint8_t const *>( matrices.data() );
+        uint8_t const * pAttributes = reinterpret_cast<uint8_t const *>( attributes.data() );
+        for ( uint32_t i = 0; i < matrices.size(); ++i, pMatrix += matrices.stride(), pAttributes += attributes.stride() )
+        {
+          InstanceAttributes const & instanceAttributes = *reinterpret_cast<InstanceAttributes const *>( pAttributes );
+          assert( !( instanceAttributes.instanceCustomIndex & 0xFF000000 ) && !( instanceAttributes.instanceShaderBindingTableRecordOffset & 0xFF000000 ) );
+
+          // assembled on the stack, as assigning the bit fields in place would read the mapped memory
+          vk::AccelerationStructureInstanceKHR instance;
+          detail::packTransform( reinterpret_cast<float const *>( pMatrix ), instance.transform );
+          instance.instanceCustomIndex                    = instanceAttributes.instanceCustomIndex;
+          instance.mask                                   = instanceAttributes.mask;
+          instance.instanceShaderBindingTableRecordOffset = instanceAttributes.instanceShaderBindingTableRecordOffset;
+          instance.flags                                  = static_cast<VkGeometryInstanceFlagsKHR>( instanceAttributes.flags );
+          instance.accelerationStructureReference         = instanceAttributes.accelerationStructureReference;
+          memcpy( pInstances + i, &instance, sizeof( instance ) );
+        }
+      }
+    }  // namespace su
+  }    // namespace raii
+}  // namespace vk
@@ -0,0 +1,703 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#include <vulkan/vulkan_raii.hpp>
+
+namespace vk
+{
+  namespace raii
+  {
+    namespace su
+    {
+      namespace detail
+      {
+        // One vk::raii::DeviceMemory, sub-allocated with a two-level segregated fit (TLSF) allocator:
+        // - free ranges are kept in size-segregated lists, two levels of bitmaps find a fitting list in constant time
+        // - allocated and free ranges are linked in address order, such that freeing merges with its free neighbours in constant time
+        // - nodes live in a vector and are recycled, so allocating and freeing doesn't touch the heap once the block is warmed up
+        class MemoryBlock
+        {
+        public:
+          static const uint32_t InvalidNode = ~0u;
+
+          MemoryBlock( vk::raii::DeviceMemory && memory, vk::DeviceSize size, uint32_t listIndex, void * mappedData )
+            : m_memory( std::move( memory ) ), m_size( size ), m_listIndex( listIndex ), m_mappedData( static_cast<uint8_t *>( mappedData ) )
+          {
+            std::fill( m_secondLevelBitmaps, m_secondLevelBitmaps + FirstLevelCount, uint16_t( 0 ) );
+            insertFree( createNode( 0, size, InvalidNode, InvalidNode ) );
+          }
+
+          MemoryBlock( MemoryBlock const & )             = delete;
+          MemoryBlock & operator=( MemoryBlock const & ) = delete;
+
+          // returns InvalidNode if there is no free range of size bytes at the requested alignment
+          uint32_t allocate( vk::DeviceSize size, vk::DeviceSize alignment, vk::DeviceSize & offset )
+          {
+            assert( ( 0 < size ) && ( 0 < alignment ) && ( ( alignment & ( alignment - 1 ) ) == 0 ) );
+
+            // the head of the list found for size bytes is large enough, but it might not be after aligning its offset; only searching for
+            // size + alignment - 1 bytes guarantees a fit, at the price of skipping over some smaller free ranges
+            uint32_t node = findFree( size );
+            if ( ( node != InvalidNode ) && ( m_nodes[node].offset + m_nodes[node].size < alignUp( m_nodes[node].offset, alignment ) + size ) )
+            {
+              node = findFree( size + alignment - 1 );
+            }
+            if ( node == InvalidNode )
+            {
+              return InvalidNode;
+            }
+            removeFree( node );
+
+            vk::DeviceSize padding = alignUp( m_nodes[node].offset, alignment ) - m_nodes[node].offset;
+            if ( padding )
+            {
+              // the physically preceding node can't be free (it would have been merged), so the padding just becomes a free node of its own
+              uint32_t paddingNode = createNode( m_nodes[node].offset, padding, m_nodes[node].prevPhysical, node );
+              if ( m_nodes[paddingNode].prevPhysical != InvalidNode )
+              {
+                m_nodes[m_nodes[paddingNode].prevPhysical].nextPhysical = paddingNode;
+              }
+              m_nodes[node].prevPhysical = paddingNode;
+              m_nodes[node].offset += padding;
+              m_nodes[node].size -= padding;
+              insertFree( paddingNode );
+            }
+            if ( size < m_nodes[node].size )
+            {
+              uint32_t remainderNode = createNode( m_nodes[node].offset + size, m_nodes[node].size - size, node, m_nodes[node].nextPhysical );
+              if ( m_nodes[remainderNode].nextPhysical != InvalidNode )
+              {
+                m_nodes[m_nodes[remainderNode].nextPhysical].prevPhysical = remainderNode;
+              }
+              m_nodes[node].nextPhysical = remainderNode;
+              m_nodes[node].size         = size;
+              insertFree( remainderNode );
+            }
+
+            m_allocatedSize += size;
+            ++m_allocationCount;
+            offset = m_nodes[node].offset;
+            return node;
+          }
+
+          void free( uint32_t node )
+          {
+            assert( ( node < m_nodes.size() ) && !m_nodes[node].free );
+            m_allocatedSize -= m_nodes[node].size;
+            --m_allocationCount;
+
+            uint32_t prev = m_nodes[node].prevPhysical;
+            if ( ( prev != InvalidNode ) && m_nodes[prev].free )
+            {
+              removeFree( prev );
+              m_nodes[prev].size += m_nodes[node].size;
+              unlinkPhysical( node );
+              node = prev;
+            }
+            uint32_t next = m_nodes[node].nextPhysical;
+            if ( ( next != InvalidNode ) && m_nodes[next].free )
+            {
+              removeFree( next );
+              m_nodes[node].size += m_nodes[next].size;
+              unlinkPhysical( next );
+            }
+            insertFree( node );
+          }
+
+          bool empty() const
+          {
+            return m_allocationCount == 0;
+          }
+
+          vk::DeviceSize allocatedSize() const
+          {
+            return m_allocatedSize;
+          }
+
+          uint32_t allocationCount() const
+          {
+            return m_allocationCount;
+          }
+
+          vk::DeviceMemory memory() const
+          {
+            return *m_memory;
+          }
+
+          // the index of the block list in the MemoryAllocator this block belongs to
+          uint32_t listIndex() const
+          {
+            return m_listIndex;
+          }
+
+          uint8_t * mappedData() const
+          {
+            return m_mappedData;
+          }
+
+          vk::DeviceSize size() const
+          {
+            return m_size;
+          }
+
+        private:
+          // each power of two is split into SecondLevelCount linearly spaced size classes; sizes below SecondLevelCount get one class each
+          static const uint32_t SecondLevelBits  = 4;
+          static const uint32_t SecondLevelCount = 1 << SecondLevelBits;
+          static const uint32_t FirstLevelCount  = 64 - SecondLevelBits + 1;
+
+          struct Node
+          {
+            vk::DeviceSize offset;
+            vk::DeviceSize size;
+            uint32_t       prevPhysical;
+            uint32_t       nextPhysical;
+            uint32_t       prevFree;
+            uint32_t       nextFree;
+            bool           free;
+          };
+
+          static vk::DeviceSize alignUp( vk::DeviceSize value, vk::DeviceSize alignment )
+          {
+            return ( value + alignment - 1 ) & ~( alignment - 1 );
+          }
+
+          static uint32_t findMSB( uint64_t value )
+          {
+            assert( value );
+            uint32_t msb = 0;
+            for ( uint32_t shift = 32; shift; shift >>= 1 )
+            {
+              if ( value >> shift )
+              {
+                value >>= shift;
+                msb += shift;
+              }
+            }
+            return msb;
+          }
+
+          static uint32_t findLSB( uint64_t value )
+          {
+            return findMSB( value & ( ~value + 1 ) );
+          }
+
+          static void mapping( vk::DeviceSize size, uint32_t & firstLevel, uint32_t & secondLevel )
+          {
+            if ( size < SecondLevelCount )
+            {
+              firstLevel  = 0;
+              secondLevel = static_cast<uint32_t>( size );
+            }
+            else
+            {
+              uint32_t msb = findMSB( size );
+              firstLevel   = msb - SecondLevelBits + 1;
+              secondLevel  = static_cast<uint32_t>( size >> ( msb - SecondLevelBits ) ) - SecondLevelCount;
+            }
+          }
+
+          uint32_t findFree( vk::DeviceSize size ) const
+          {
+            // round up to the next size class, such that any free range in the list found is large enough
+            if ( SecondLevelCount <= size )
+            {
+              size += ( vk::DeviceSize( 1 ) << ( findMSB( size ) - SecondLevelBits ) ) - 1;
+            }
+            uint32_t firstLevel, secondLevel;
+            mapping( size, firstLevel, secondLevel );
+            if ( FirstLevelCount <= firstLevel )
+            {
+              return InvalidNode;
+            }
+
+            uint32_t secondLevelBitmap = m_secondLevelBitmaps[firstLevel] & ( ~0u << secondLevel );
+            if ( !secondLevelBitmap )
+            {
+              uint64_t firstLevelBitmap = m_firstLevelBitmap & ( ~uint64_t( 0 ) << ( firstLevel + 1 ) );
+              if ( !firstLevelBitmap )
+              {
+                return InvalidNode;
+              }
+              firstLevel        = findLSB( firstLevelBitmap );
+              secondLevelBitmap = m_secondLevelBitmaps[firstLevel];
+            }
+            return m_freeLists[firstLevel][findLSB( secondLevelBitmap )];
+          }
+
+          uint32_t createNode( vk::DeviceSize offset, vk::DeviceSize size, uint32_t prevPhysical, uint32_t nextPhysical )
+          {
+            Node     node = { offset, size, prevPhysical, nextPhysical, InvalidNode, InvalidNode, false };
+            uint32_t index;
+            if ( m_unusedNodes.empty() )
+            {
+              index = static_cast<uint32_t>( m_nodes.size() );
+              m_nodes.push_back( node );
+            }
+            else
+            {
+              index = m_unusedNodes.back();
+              m_unusedNodes.pop_back();
+              m_nodes[index] = node;
+            }
+            return index;
+          }
+
+          void unlinkPhysical( uint32_t node )
+          {
+            if ( m_nodes[node].prevPhysical != InvalidNode )
+            {
+              m_nodes[m_nodes[node].prevPhysical].nextPhysical = m_nodes[node].nextPhysical;
+            }
+            if ( m_nodes[node].nextPhysical != InvalidNode )
+            {
+              m_nodes[m_nodes[node].nextPhysical].prevPhysical = m_nodes[node].prevPhysical;
+            }
+            m_unusedNodes.push_back( node );
+          }
+
+          void insertFree( uint32_t node )
+          {
+            uint32_t firstLevel, secondLevel;
+            mapping( m_nodes[node].size, firstLevel, secondLevel );
+
+            uint32_t & head         = m_freeLists[firstLevel][secondLevel];
+            m_nodes[node].free      = true;
+            m_nodes[node].prevFree  = InvalidNode;
+            m_nodes[node].nextFree  = ( m_secondLevelBitmaps[firstLevel] & ( 1u << secondLevel ) ) ? head : InvalidNode;
+            if ( m_nodes[node].nextFree != InvalidNode )
+            {
+              m_nodes[m_nodes[node].nextFree].prevFree = node;
+            }
+            head = node;
+            m_firstLevelBitmap |= uint64_t( 1 ) << firstLevel;
+            m_secondLevelBitmaps[firstLevel] |= static_cast<uint16_t>( 1u << secondLevel );
+          }
+
+          void removeFree( uint32_t node )
+          {
+            uint32_t firstLevel, secondLevel;
+            mapping( m_nodes[node].size, firstLevel, secondLevel );
+
+            m_nodes[node].free = false;
+            if ( m_nodes[node].prevFree != InvalidNode )
+            {
+              m_nodes[m_nodes[node].prevFree].nextFree = m_nodes[node].nextFree;
+            }
+            else
+            {
+              m_freeLists[firstLevel][secondLevel] = m_nodes[node].nextFree;
+              if ( m_nodes[node].nextFree == InvalidNode )
+              {
+                m_secondLevelBitmaps[firstLevel] &= static_cast<uint16_t>( ~( 1u << secondLevel ) );
+                if ( !m_secondLevelBitmaps[firstLevel] )
+                {
+                  m_firstLevelBitmap &= ~( uint64_t( 1 ) << firstLevel );
+                }
+              }
+            }
+            if ( m_nodes[node].nextFree != InvalidNode )
+            {
+              m_nodes[m_nodes[node].nextFree].prevFree = m_nodes[node].prevFree;
+            }
+          }
+
+        private:
+          vk::raii::DeviceMemory m_memory;
+          vk::DeviceSize         m_size;
+          uint32_t               m_listIndex;
+          uint8_t *              m_mappedData;
+          vk::DeviceSize         m_allocatedSize   = 0;
+          uint32_t               m_allocationCount = 0;
+          std::vector<Node>      m_nodes;
+          std::vector<uint32_t>  m_unusedNodes;
+          uint64_t               m_firstLevelBitmap = 0;
+          uint16_t               m_secondLevelBitmaps[FirstLevelCount];
+          uint32_t               m_freeLists[FirstLevelCount][SecondLevelCount];  // only valid where the corresponding bitmap bit is set
+        };
+      }  // namespace detail
+
+      class MemoryAllocator;
+
+      // A range of device memory handed out by a MemoryAllocator, returned to it on destruction.
+      // The MemoryAllocator has to outlive all of its MemoryAllocations, and a MemoryAllocation has to outlive the resource bound to it.
+      class MemoryAllocation
+      {
+      public:
+        MemoryAllocation( std::nullptr_t ) {}
+
+        MemoryAllocation( MemoryAllocation const & ) = delete;
+
+        MemoryAllocation( MemoryAllocation && rhs ) VULKAN_HPP_NOEXCEPT
+          : m_allocator( rhs.m_allocator )
+          , m_block( rhs.m_block )
+          , m_node( rhs.m_node )
+          , m_dedicatedMemory( std::move( rhs.m_dedicatedMemory ) )
+          , m_memory( rhs.m_memory )
+          , m_offset( rhs.m_offset )
+          , m_size( rhs.m_size )
+          , m_mappedData( rhs.m_mappedData )
+        {
+          rhs.m_allocator = nullptr;
+        }
+
+        ~MemoryAllocation()
+        {
+          clear();
+        }
+
+        MemoryAllocation & operator=( MemoryAllocation const & ) = delete;
+
+        MemoryAllocation & operator=( MemoryAllocation && rhs ) VULKAN_HPP_NOEXCEPT
+        {
+          if ( this != &rhs )
+          {
+            clear();
+            m_allocator       = rhs.m_allocator;
+            m_block           = rhs.m_block;
+            m_node            = rhs.m_node;
+            m_dedicatedMemory = std::move( rhs.m_dedicatedMemory );
+            m_memory          = rhs.m_memory;
+            m_offset          = rhs.m_offset;
+            m_size            = rhs.m_size;
+            m_mappedData      = rhs.m_mappedData;
+            rhs.m_allocator   = nullptr;
+          }
+          return *this;
+        }
+
+        explicit operator bool() const
+        {
+          return m_allocator != nullptr;
+        }
+
+        // returns the memory range to its MemoryAllocator
+        inline void clear();
+
+        bool isDedicated() const
+        {
+          return m_block == nullptr;
+        }
+
+        vk::DeviceMemory memory() const
+        {
+          return m_memory;
+        }
+
+        vk::DeviceSize offset() const
+        {
+          return m_offset;
+        }
+
+        vk::DeviceSize size() const
+        {
+          return m_size;
+        }
+
+        // nullptr, unless the memory is host visible; the whole block is persistently mapped, so there's no need to map or unmap anything
+        void * mappedData() const
+        {
+          return m_mappedData;
+        }
+
+        // the bind infos can be collected and passed to vk::raii::Device::bindBufferMemory2 or bindImageMemory2 in one go
+        vk::BindBufferMemoryInfo makeBindInfo( vk::Buffer buffer, void const * pNext = nullptr ) const
+        {
+          return vk::BindBufferMemoryInfo( buffer, m_memory, m_offset, pNext );
+        }
+
+        vk::BindImageMemoryInfo makeBindInfo( vk::Image image, void const * pNext = nullptr ) const
+        {
+          return vk::BindImageMemoryInfo( image, m_memory, m_offset, pNext );
+        }
+
+        inline void bind( vk::raii::Buffer const & buffer ) const;
+        inline void bind( vk::raii::Image const & image ) const;
+
+      private:
+        friend class MemoryAllocator;
+
+        MemoryAllocation( MemoryAllocator * allocator, detail::MemoryBlock * block, uint32_t node, vk::DeviceSize offset, vk::DeviceSize size )
+          : m_allocator( allocator )
+          , m_block( block )
+          , m_node( node )
+          , m_memory( block->memory() )
+          , m_offset( offset )
+          , m_size( size )
+          , m_mappedData( block->mappedData() ? block->mappedData() + offset : nullptr )
+        {
+        }
+
+        MemoryAllocation( MemoryAllocator * allocator, vk::raii::DeviceMemory && dedicatedMemory, vk::DeviceSize size, void * mappedData )
+          : m_allocator( allocator )
+          , m_dedicatedMemory( std::move( dedicatedMemory ) )
+          , m_memory( *m_dedicatedMemory )
+          , m_size( size )
+          , m_mappedData( mappedData )
+        {
+        }
+
+      private:
+        MemoryAllocator *      m_allocator       = nullptr;
+        detail::MemoryBlock *  m_block           = nullptr;
+        uint32_t               m_node            = detail::MemoryBlock::InvalidNode;
+        vk::raii::DeviceMemory m_dedicatedMemory = nullptr;
+        vk::DeviceMemory       m_memory;
+        vk::DeviceSize         m_offset     = 0;
+        vk::DeviceSize         m_size       = 0;
+        void *                 m_mappedData = nullptr;
+      };
+
+      // Sub-allocates device memory out of a few large vk::raii::DeviceMemory blocks, instead of calling vkAllocateMemory per resource.
+      // - there is a list of blocks per memory type, each block is sub-allocated with a TLSF allocator (see detail::MemoryBlock)
+      // - linear resources (buffers, linearly tiled images) and optimally tiled images never share a block if bufferImageGranularity is
+      //   larger than 1, such that no padding between them is ever needed
+      // - resources that prefer or require a dedicated allocation (vk::MemoryDedicatedRequirements), and resources larger than half a block of
+      //   their memory type, get a vk::raii::DeviceMemory of their own
+      // - host visible blocks are persistently mapped
+      // - an emptied block is released, unless it's the only empty one of its memory type, which is kept to avoid allocating it again right away
+      // Allocating and freeing is synchronized with a mutex; binding the resources is left to the caller.
+      class MemoryAllocator
+      {
+      public:
+        enum class ResourceKind
+        {
+          eLinear,
+          eOptimal
+        };
+
+        struct Statistics
+        {
+          uint32_t       blockCount          = 0;
+          uint32_t       dedicatedCount      = 0;
+          uint32_t       allocationCount     = 0;  // sub-allocations, excluding the dedicated ones
+          vk::DeviceSize blockBytes          = 0;
+          vk::DeviceSize allocatedBlockBytes = 0;
+          vk::DeviceSize dedicatedBytes      = 0;
+        };
+
+        MemoryAllocator( vk::raii::PhysicalDevice const & physicalDevice, vk::raii::Device const & device, vk::DeviceSize blockSize = 64 * 1024 * 1024 )
+          : m_device( &device ), m_memoryProperties( physicalDevice.getMemoryProperties() ), m_blockSize( blockSize )
+        {
+          m_bufferImageGranularity = ( std::max )( physicalDevice.getProperties().limits.bufferImageGranularity, vk::DeviceSize( 1 ) );
+          m_blocks.resize( 2 * m_memoryProperties.memoryTypeCount );
+        }
+
+        MemoryAllocator( MemoryAllocator const & )             = delete;
+        MemoryAllocator & operator=( MemoryAllocator const & ) = delete;
+
+        MemoryAllocation allocate( vk::raii::Buffer const & buffer, vk::MemoryPropertyFlags memoryPropertyFlags )
+        {
+          vk::StructureChain<vk::MemoryRequirements2, vk::MemoryDedicatedRequirements> requirements =
+            m_device->getBufferMemoryRequirements2<vk::MemoryRequirements2, vk::MemoryDedicatedRequirements>( vk::BufferMemoryRequirementsInfo2( *buffer ) );
+          vk::MemoryDedicatedRequirements const & dedicatedRequirements = requirements.get<vk::MemoryDedicatedRequirements>();
+          vk::MemoryDedicatedAllocateInfo         dedicatedAllocateInfo( {}, *buffer );
+          return allocate( requirements.get<vk::MemoryRequirements2>().memoryRequirements,
+                           memoryPropertyFlags,
+                           ResourceKind::eLinear,
+                           wantsDedicatedAllocation( dedicatedRequirements ) ? &dedicatedAllocateInfo : nullptr );
+        }
+
+        MemoryAllocation
+          allocate( vk::raii::Image const & image, vk::MemoryPropertyFlags memoryPropertyFlags, vk::ImageTiling tiling = vk::ImageTiling::eOptimal )
+        {
+          vk::StructureChain<vk::MemoryRequirements2, vk::MemoryDedicatedRequirements> requirements =
+            m_device->getImageMemoryRequirements2<vk::MemoryRequirements2, vk::MemoryDedicatedRequirements>( vk::ImageMemoryRequirementsInfo2( *image ) );
+          vk::MemoryDedicatedRequirements const & dedicatedRequirements = requirements.get<vk::MemoryDedicatedRequirements>();
+          vk::MemoryDedicatedAllocateInfo         dedicatedAllocateInfo( *image );
+          return allocate( requirements.get<vk::MemoryRequirements2>().memoryRequirements,
+                           memoryPropertyFlags,
+                           ( tiling == vk::ImageTiling::eLinear ) ? ResourceKind::eLinear : ResourceKind::eOptimal,
+                           wantsDedicatedAllocation( dedicatedRequirements ) ? &dedicatedAllocateInfo : nullptr );
+        }
+
+        // the low-level entry point: pDedicatedAllocateInfo, if not nullptr, forces a dedicated allocation and is chained into its vk::MemoryAllocateInfo
+        MemoryAllocation allocate( vk::MemoryRequirements const &          memoryRequirements,
+                                   vk::MemoryPropertyFlags                 memoryPropertyFlags,
+                                   ResourceKind                            resourceKind,
+                                   vk::MemoryDedicatedAllocateInfo const * pDedicatedAllocateInfo = nullptr )
+        {
+          uint32_t memoryTypeIndex = findMemoryType( memoryRequirements.memoryTypeBits, memoryPropertyFlags );
+          if ( pDedicatedAllocateInfo || ( getBlockSize( memoryTypeIndex ) / 2 < memoryRequirements.size ) )
+          {
+            return allocateDedicated( memoryRequirements.size, memoryTypeIndex, pDedicatedAllocateInfo );
+          }
+
+          uint32_t listIndex = 2 * memoryTypeIndex + ( ( ( 1 < m_bufferImageGranularity ) && ( resourceKind == ResourceKind::eOptimal ) ) ? 1 : 0 );
+          std::vector<std::unique_ptr<detail::MemoryBlock>> & blocks = m_blocks[listIndex];
+
+          {
+            std::lock_guard<std::mutex> guard( m_mutex );
+            for ( auto & block : blocks )
+            {
+              vk::DeviceSize offset;
+              uint32_t       node = block->allocate( memoryRequirements.size, memoryRequirements.alignment, offset );
+              if ( node != detail::MemoryBlock::InvalidNode )
+              {
+                return MemoryAllocation( this, block.get(), node, offset, memoryRequirements.size );
+              }
+            }
+
+            blocks.push_back( createBlock( memoryTypeIndex, listIndex ) );
+            vk::DeviceSize offset;
+            uint32_t       node = blocks.back()->allocate( memoryRequirements.size, memoryRequirements.alignment, offset );
+            if ( node != detail::MemoryBlock::InvalidNode )
+            {
+              return MemoryAllocation( this, blocks.back().get(), node, offset, memoryRequirements.size );
+            }
+
+            // the alignment padding doesn't fit into a fresh block either; any other block of this size would fail the same way
+            blocks.pop_back();
+          }
+          return allocateDedicated( memoryRequirements.size, memoryTypeIndex, nullptr );
+        }
+
+        vk::raii::Device const & getDevice() const
+        {
+          return *m_device;
+        }
+
+        Statistics getStatistics() const
+        {
+          std::lock_guard<std::mutex> guard( m_mutex );
+          Statistics                  statistics;
+          for ( auto const & blocks : m_blocks )
+          {
+            for ( auto const & block : blocks )
+            {
+              ++statistics.blockCount;
+              statistics.allocationCount += block->allocationCount();
+              statistics.blockBytes += block->size();
+              statistics.allocatedBlockBytes += block->allocatedSize();
+            }
+          }
+          statistics.dedicatedCount = m_dedicatedCount;
+          statistics.dedicatedBytes = m_dedicatedBytes;
+          return statistics;
+        }
+
+      private:
+        friend class MemoryAllocation;
+
+        static bool wantsDedicatedAllocation( vk::MemoryDedicatedRequirements const & dedicatedRequirements )
+        {
+          return dedicatedRequirements.prefersDedicatedAllocation || dedicatedRequirements.requiresDedicatedAllocation;
+        }
+
+        uint32_t findMemoryType( uint32_t memoryTypeBits, vk::MemoryPropertyFlags memoryPropertyFlags ) const
+        {
+          for ( uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; ++i )
+          {
+            if ( ( memoryTypeBits & ( 1u << i ) ) && ( ( m_memoryProperties.memoryTypes[i].propertyFlags & memoryPropertyFlags ) == memoryPropertyFlags ) )
+            {
+              return i;
+            }
+          }
+          throw std::runtime_error( "MemoryAllocator: no memory type with the requested properties" );
+        }
+
+        void * mapIfHostVisible( vk::raii::DeviceMemory const & memory, uint32_t memoryTypeIndex ) const
+        {
+          return ( m_memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & vk::MemoryPropertyFlagBits::eHostVisible )
+                 ? memory.mapMemory( 0, VK_WHOLE_SIZE )
+                 : nullptr;
+        }
+
+        vk::DeviceSize getBlockSize( uint32_t memoryTypeIndex ) const
+        {
+          // don't let a single block take more than an eighth of a small heap
+          vk::DeviceSize blockSize =
+            ( std::min )( m_blockSize, m_memoryProperties.memoryHeaps[m_memoryProperties.memoryTypes[memoryTypeIndex].heapIndex].size / 8 );
+          return ( std::max )( blockSize, vk::DeviceSize( 1 ) );
+        }
+
+        std::unique_ptr<detail::MemoryBlock> createBlock( uint32_t memoryTypeIndex, uint32_t listIndex )
+        {
+          vk::DeviceSize         blockSize = getBlockSize( memoryTypeIndex );
+          vk::raii::DeviceMemory memory( *m_device, vk::MemoryAllocateInfo( blockSize, memoryTypeIndex ) );
+          void *                 mappedData = mapIfHostVisible( memory, memoryTypeIndex );
+          return std::unique_ptr<detail::MemoryBlock>( new detail::MemoryBlock( std::move( memory ), blockSize, listIndex, mappedData ) );
+        }
+
+        MemoryAllocation allocateDedicated( vk::DeviceSize size, uint32_t memoryTypeIndex, vk::MemoryDedicatedAllocateInfo const * pDedicatedAllocateInfo )
+        {
+          vk::raii::DeviceMemory memory( *m_device, vk::MemoryAllocateInfo( size, memoryTypeIndex, pDedicatedAllocateInfo ) );
+          void *                 mappedData = mapIfHostVisible( memory, memoryTypeIndex );
+
+          std::lock_guard<std::mutex> guard( m_mutex );
+          ++m_dedicatedCount;
+          m_dedicatedBytes += size;
+          return MemoryAllocation( this, std::move( memory ), size, mappedData );
+        }
+
+        void free( MemoryAllocation & allocation )
+        {
+          std::lock_guard<std::mutex> guard( m_mutex );
+          if ( allocation.isDedicated() )
+          {
+            --m_dedicatedCount;
+            m_dedicatedBytes -= allocation.m_size;
+            allocation.m_dedicatedMemory.clear();
+            return;
+          }
+
+          detail::MemoryBlock * block = allocation.m_block;
+          block->free( allocation.m_node );
+          if ( block->empty() )
+          {
+            std::vector<std::unique_ptr<detail::MemoryBlock>> & blocks = m_blocks[block->listIndex()];
+            auto                                                otherEmpty = std::find_if( blocks.begin(),
+                                            blocks.end(),
+                                            [block]( std::unique_ptr<detail::MemoryBlock> const & b ) { return ( b.get() != block ) && b->empty(); } );
+            if ( otherEmpty != blocks.end() )
+            {
+              blocks.erase( std::find_if( blocks.begin(),
+                                          blocks.end(),
+                                          [block]( std::unique_ptr<detail::MemoryBlock> const & b ) { return b.get() == block; } ) );
+            }
+          }
+        }
+
+      private:
+        vk::raii::Device const *                                       m_device;
+        vk::PhysicalDeviceMemoryProperties                             m_memoryProperties;
+        vk::DeviceSize                                                 m_blockSize;
+        vk::DeviceSize                                                 m_bufferImageGranularity;
+        std::vector<std::vector<std::unique_ptr<detail::MemoryBlock>>> m_blocks;  // two lists per memory type: linear and optimal resources
+        uint32_t                                                       m_dedicatedCount = 0;
+        vk::DeviceSize                                                 m_dedicatedBytes = 0;
+        mutable std::mutex                                             m_mutex;
+      };
+
+      inline void MemoryAllocation::clear()
+      {
+        if ( m_allocator )
+        {
+          m_allocator->free( *this );
+          m_allocator  = nullptr;
+          m_mappedData = nullptr;
+        }
+      }
+
+      inline void MemoryAllocation::bind( vk::raii::Buffer const & buffer ) const
+      {
+        assert( m_allocator );
+        m_allocator->getDevice().bindBufferMemory2( makeBindInfo( *buffer ) );
+      }
+
+      inline void MemoryAllocation::bind( vk::raii::Image const & image ) const
+      {
+        assert( m_allocator );
+        m_allocator->getDevice().bindImageMemory2( makeBindInfo( *image ) );
+      }
+    }  // namespace su
+  }    // namespace raii
+}  // namespace vk
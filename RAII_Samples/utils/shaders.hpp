@@ -23,6 +23,16 @@ namespace vk
 
         return vk::raii::ShaderModule( device, vk::ShaderModuleCreateInfo( vk::ShaderModuleCreateFlags(), shaderSPV ) );
       }
+
+      template <typename Dispatcher = VULKAN_HPP_DEFAULT_DISPATCHER_TYPE>
+      vk::raii::ShaderModule makeShaderModule( vk::raii::Device const & device,
+                                               vk::ShaderStageFlagBits  shaderStage,
+                                               std::string const &      shaderText,
+                                               vk::su::ShaderCompiler & shaderCompiler )
+      {
+        std::vector<unsigned int> shaderSPV = shaderCompiler.compile( shaderStage, shaderText );
+        return vk::raii::ShaderModule( device, vk::ShaderModuleCreateInfo( vk::ShaderModuleCreateFlags(), shaderSPV ) );
+      }
     }  // namespace su
   }    // namespace raii
 }  // namespace vk
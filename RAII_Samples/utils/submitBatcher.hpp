@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <vector>
+#include <vulkan/vulkan_raii.hpp>
+
+namespace vk
+{
+  namespace raii
+  {
+    namespace su
+    {
+      // Collects the submissions of many threads to one vk::raii::Queue, and submits them with a single vk::raii::Queue::submit2 per flush().
+      // - each thread enqueues into its own list, so enqueue() takes no lock; the only shared state is an atomic sequence counter
+      // - flush() submits in sequence order, which keeps the order of the submissions of each thread, as well as the order of submissions
+      //   made visible from one thread to another (say, by some job dependency)
+      // - consecutive submissions are merged into one vk::SubmitInfo2 as long as that doesn't change their semantics: a submission starts a new
+      //   vk::SubmitInfo2 if its wait semaphores differ from those of the current one and that already has wait semaphores or command buffers,
+      //   and a submission following one with signal semaphores always starts a new one; identical wait semaphores are waited on just once
+      // - all the lists keep their capacity, so after some warm-up frames neither enqueue() nor flush() allocate any memory
+      // Each thread exclusively uses its own threadIndex; flush() is to be called from the thread driving the frames, while no other thread is
+      // enqueuing.
+      class SubmitBatcher
+      {
+      public:
+        SubmitBatcher( vk::raii::Queue const & queue, uint32_t threadCount ) : m_queue( &queue )
+        {
+          assert( 0 < threadCount );
+          m_threadQueues.reserve( threadCount );
+          for ( uint32_t i = 0; i < threadCount; ++i )
+          {
+            // separately allocated, to keep the threads from writing to the same cache lines
+            m_threadQueues.push_back( std::unique_ptr<ThreadQueue>( new ThreadQueue() ) );
+          }
+        }
+
+        SubmitBatcher( SubmitBatcher const & )             = delete;
+        SubmitBatcher & operator=( SubmitBatcher const & ) = delete;
+
+        void enqueue( uint32_t                                                threadIndex,
+                      vk::ArrayProxy<const vk::CommandBufferSubmitInfo> const & commandBufferInfos,
+                      vk::ArrayProxy<const vk::SemaphoreSubmitInfo> const &     waitSemaphoreInfos   = nullptr,
+                      vk::ArrayProxy<const vk::SemaphoreSubmitInfo> const &     signalSemaphoreInfos = nullptr )
+        {
+          assert( threadIndex < m_threadQueues.size() );
+          ThreadQueue & threadQueue = *m_threadQueues[threadIndex];
+
+          Submission submission;
+          submission.sequence       = m_sequence.fetch_add( 1, std::memory_order_relaxed );
+          submission.waits          = append( threadQueue.waitInfos, waitSemaphoreInfos );
+          submission.commandBuffers = append( threadQueue.commandBufferInfos, commandBufferInfos );
+          submission.signals        = append( threadQueue.signalInfos, signalSemaphoreInfos );
+          threadQueue.submissions.push_back( submission );
+        }
+
+        void enqueue( uint32_t threadIndex, vk::CommandBuffer commandBuffer )
+        {
+          enqueue( threadIndex, vk::CommandBufferSubmitInfo( commandBuffer ) );
+        }
+
+        // submits everything enqueued since the last flush, and signals fence (if any) once all of it has completed;
+        // returns the number of vk::SubmitInfo2 the submissions were merged into
+        uint32_t flush( vk::Fence fence = {} )
+        {
+          m_order.clear();
+          for ( uint32_t t = 0; t < m_threadQueues.size(); ++t )
+          {
+            std::vector<Submission> const & submissions = m_threadQueues[t]->submissions;
+            for ( uint32_t i = 0; i < submissions.size(); ++i )
+            {
+              m_order.push_back( SubmissionRef( submissions[i].sequence, t, i ) );
+            }
+          }
+          if ( m_order.empty() && !fence )
+          {
+            return 0;
+          }
+          std::sort( m_order.begin(), m_order.end(), []( SubmissionRef const & lhs, SubmissionRef const & rhs ) { return lhs.sequence < rhs.sequence; } );
+
+          m_waitInfos.clear();
+          m_commandBufferInfos.clear();
+          m_signalInfos.clear();
+          m_batches.clear();
+          for ( auto const & ref : m_order )
+          {
+            ThreadQueue const & threadQueue = *m_threadQueues[ref.threadIndex];
+            Submission const &  submission  = threadQueue.submissions[ref.index];
+            bool sameWaits = !m_batches.empty() && equal( m_waitInfos, m_batches.back().waits, threadQueue.waitInfos, submission.waits );
+            if ( m_batches.empty() || m_batches.back().signals.count ||
+                 ( !sameWaits && ( m_batches.back().waits.count || m_batches.back().commandBuffers.count ) ) )
+            {
+              m_batches.push_back( Submission() );
+              m_batches.back().waits.offset          = static_cast<uint32_t>( m_waitInfos.size() );
+              m_batches.back().commandBuffers.offset = static_cast<uint32_t>( m_commandBufferInfos.size() );
+              m_batches.back().signals.offset        = static_cast<uint32_t>( m_signalInfos.size() );
+            }
+            // the batch is always the last one, so appending to the gathered arrays keeps its ranges contiguous
+            if ( !m_batches.back().waits.count )
+            {
+              m_batches.back().waits.count = gather( m_waitInfos, threadQueue.waitInfos, submission.waits );
+            }
+            m_batches.back().commandBuffers.count += gather( m_commandBufferInfos, threadQueue.commandBufferInfos, submission.commandBuffers );
+            m_batches.back().signals.count += gather( m_signalInfos, threadQueue.signalInfos, submission.signals );
+          }
+
+          // the gathered arrays are complete now, and won't be reallocated any more
+          m_submitInfos.clear();
+          for ( auto const & batch : m_batches )
+          {
+            m_submitInfos.push_back( vk::SubmitInfo2( {},
+                                                      batch.waits.count,
+                                                      m_waitInfos.data() + batch.waits.offset,
+                                                      batch.commandBuffers.count,
+                                                      m_commandBufferInfos.data() + batch.commandBuffers.offset,
+                                                      batch.signals.count,
+                                                      m_signalInfos.data() + batch.signals.offset ) );
+          }
+          m_queue->submit2( m_submitInfos, fence );
+
+          for ( auto & threadQueue : m_threadQueues )
+          {
+            threadQueue->submissions.clear();
+            threadQueue->waitInfos.clear();
+            threadQueue->commandBufferInfos.clear();
+            threadQueue->signalInfos.clear();
+          }
+          return static_cast<uint32_t>( m_submitInfos.size() );
+        }
+
+      private:
+        struct Range
+        {
+          uint32_t offset = 0;
+          uint32_t count  = 0;
+        };
+
+        struct Submission
+        {
+          uint64_t sequence = 0;
+          Range    waits;
+          Range    commandBuffers;
+          Range    signals;
+        };
+
+        struct SubmissionRef
+        {
+          SubmissionRef( uint64_t sequence_, uint32_t threadIndex_, uint32_t index_ ) : sequence( sequence_ ), threadIndex( threadIndex_ ), index( index_ ) {}
+
+          uint64_t sequence;
+          uint32_t threadIndex;
+          uint32_t index;
+        };
+
+        struct ThreadQueue
+        {
+          std::vector<Submission>                  submissions;
+          std::vector<vk::SemaphoreSubmitInfo>     waitInfos;
+          std::vector<vk::CommandBufferSubmitInfo> commandBufferInfos;
+          std::vector<vk::SemaphoreSubmitInfo>     signalInfos;
+        };
+
+        template <typename T>
+        static Range append( std::vector<T> & dst, vk::ArrayProxy<const T> const & src )
+        {
+          Range range;
+          range.offset = static_cast<uint32_t>( dst.size() );
+          range.count  = src.size();
+          dst.insert( dst.end(), src.begin(), src.end() );
+          return range;
+        }
+
+        template <typename T>
+        static bool equal( std::vector<T> const & lhs, Range const & lhsRange, std::vector<T> const & rhs, Range const & rhsRange )
+        {
+          return ( lhsRange.count == rhsRange.count ) &&
+                 std::equal( lhs.begin() + lhsRange.offset, lhs.begin() + lhsRange.offset + lhsRange.count, rhs.begin() + rhsRange.offset );
+        }
+
+        template <typename T>
+        static uint32_t gather( std::vector<T> & dst, std::vector<T> const & src, Range const & range )
+        {
+          dst.insert( dst.end(), src.begin() + range.offset, src.begin() + range.offset + range.count );
+          return range.count;
+        }
+
+      private:
+        vk::raii::Queue const *                   m_queue;
+        std::vector<std::unique_ptr<ThreadQueue>> m_threadQueues;
+        std::atomic<uint64_t>                     m_sequence{ 0 };
+
+        // scratch space of flush(), kept to reuse its capacity
+        std::vector<SubmissionRef>               m_order;
+        std::vector<Submission>                  m_batches;
+        std::vector<vk::SemaphoreSubmitInfo>     m_waitInfos;
+        std::vector<vk::CommandBufferSubmitInfo> m_commandBufferInfos;
+        std::vector<vk::SemaphoreSubmitInfo>     m_signalInfos;
+        std::vector<vk::SubmitInfo2>             m_submitInfos;
+      };
+    }  // namespace su
+  }    // namespace raii
+}  // namespace vk
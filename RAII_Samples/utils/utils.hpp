@@ -13,6 +13,7 @@
 // unknown compiler... just ignore the warnings for yourselves ;)
 #endif
 
+#include "../../samples/utils/pipelineCache.hpp"
 #include "../../samples/utils/utils.hpp"
 
 #include <numeric>
@@ -742,6 +743,12 @@ namespace vk
         return vk::raii::Instance( context, instanceCreateInfoChain.get<vk::InstanceCreateInfo>() );
       }
 
+      vk::raii::PipelineCache
+        makePipelineCache( vk::raii::Device const & device, vk::su::PipelineCacheStore const & pipelineCacheStore, vk::PipelineCacheCreateFlags flags = {} )
+      {
+        return vk::raii::PipelineCache( device, pipelineCacheStore.makeCreateInfo( flags ) );
+      }
+
       vk::raii::RenderPass makeRenderPass( vk::raii::Device const & device,
                                            vk::Format               colorFormat,
                                            vk::Format               depthFormat,
@@ -798,6 +805,18 @@ namespace vk
         throw std::runtime_error( "failed to find supported format!" );
       }
 
+      // merges the (optional) srcCaches into dstCache and stores the resulting data
+      bool savePipelineCache( vk::su::PipelineCacheStore &                    pipelineCacheStore,
+                              vk::raii::PipelineCache const &                 dstCache,
+                              vk::ArrayProxy<const vk::PipelineCache> const & srcCaches = nullptr )
+      {
+        if ( !srcCaches.empty() )
+        {
+          dstCache.merge( srcCaches );
+        }
+        return pipelineCacheStore.store( dstCache.getData() );
+      }
+
       void submitAndWait( vk::raii::Device const & device, vk::raii::Queue const & queue, vk::raii::CommandBuffer const & commandBuffer )
       {
         vk::raii::Fence fence( device, vk::FenceCreateInfo() );
@@ -0,0 +1,200 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Benchmarks : CommandBufferRing
+//                        Multi-threaded recording of secondary command buffers, with vk::raii::su::CommandBufferRing versus allocating and
+//                        freeing vk::raii::CommandBuffers every frame, against the null driver
+
+#include "../../RAII_Samples/utils/commandBufferRing.hpp"
+#include "../../tests/null_driver_fixture.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// a simple spinning barrier, to keep thread synchronization out of the measurements as far as possible
+class SpinBarrier
+{
+public:
+  SpinBarrier( uint32_t threadCount ) : m_threadCount( threadCount ) {}
+
+  void wait()
+  {
+    uint32_t generation = m_generation.load( std::memory_order_acquire );
+    if ( m_arrived.fetch_add( 1, std::memory_order_acq_rel ) + 1 == m_threadCount )
+    {
+      m_arrived.store( 0, std::memory_order_relaxed );
+      m_generation.fetch_add( 1, std::memory_order_acq_rel );
+    }
+    else
+    {
+      while ( m_generation.load( std::memory_order_acquire ) == generation )
+      {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+private:
+  uint32_t              m_threadCount;
+  std::atomic<uint32_t> m_arrived{ 0 };
+  std::atomic<uint32_t> m_generation{ 0 };
+};
+
+const uint32_t ThreadCount          = 4;
+const uint32_t FramesInFlight       = 2;
+const uint32_t FrameCount           = 2000;
+const uint32_t SecondariesPerThread = 16;
+const uint32_t DrawsPerSecondary    = 32;
+
+void recordSecondary( vk::raii::CommandBuffer const & commandBuffer, vk::CommandBufferBeginInfo const & beginInfo )
+{
+  commandBuffer.begin( beginInfo );
+  for ( uint32_t i = 0; i < DrawsPerSecondary; ++i )
+  {
+    commandBuffer.draw( 3, 1, 0, i );
+  }
+  commandBuffer.end();
+}
+
+template <typename FrameFunc>
+double runThreads( FrameFunc const & frameFunc )
+{
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+  std::vector<std::thread> threads;
+  for ( uint32_t t = 1; t < ThreadCount; ++t )
+  {
+    threads.push_back( std::thread( frameFunc, t ) );
+  }
+  frameFunc( 0 );
+  for ( auto & thread : threads )
+  {
+    thread.join();
+  }
+
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::high_resolution_clock::now() - start;
+  return elapsed.count() / ( FrameCount * ThreadCount * SecondariesPerThread );
+}
+
+double benchmarkCommandBufferRing( vk::raii::Device const & device )
+{
+  vk::raii::su::CommandBufferRing commandBufferRing( device, 0, FramesInFlight, ThreadCount, SecondariesPerThread );
+  vk::raii::Fence                 fence( device, vk::FenceCreateInfo() );
+
+  vk::CommandBufferInheritanceInfo inheritanceInfo;
+  vk::CommandBufferBeginInfo       secondaryBeginInfo( vk::CommandBufferUsageFlagBits::eOneTimeSubmit, &inheritanceInfo );
+  std::vector<vk::CommandBuffer>   secondaries( ThreadCount * SecondariesPerThread );
+  SpinBarrier                      barrier( ThreadCount );
+
+  return runThreads(
+    [&]( uint32_t threadIndex )
+    {
+      for ( uint32_t frame = 0; frame < FrameCount; ++frame )
+      {
+        if ( threadIndex == 0 )
+        {
+          commandBufferRing.beginFrame();
+        }
+        barrier.wait();
+
+        for ( uint32_t i = 0; i < SecondariesPerThread; ++i )
+        {
+          vk::raii::CommandBuffer const & secondary = commandBufferRing.acquire( threadIndex, vk::CommandBufferLevel::eSecondary );
+          recordSecondary( secondary, secondaryBeginInfo );
+          secondaries[threadIndex * SecondariesPerThread + i] = secondary;
+        }
+        barrier.wait();
+
+        if ( threadIndex == 0 )
+        {
+          vk::raii::CommandBuffer const & primary = commandBufferRing.acquire( 0 );
+          primary.begin( vk::CommandBufferBeginInfo( vk::CommandBufferUsageFlagBits::eOneTimeSubmit ) );
+          primary.executeCommands( secondaries );
+          primary.end();
+          commandBufferRing.endFrame( *fence );
+        }
+      }
+    } );
+}
+
+double benchmarkAllocateAndFree( vk::raii::Device const & device )
+{
+  // the straight-forward approach: per thread one (resettable) command pool, and per frame freshly allocated command buffers
+  std::vector<vk::raii::CommandPool> commandPools;
+  for ( uint32_t t = 0; t < ThreadCount; ++t )
+  {
+    commandPools.push_back( vk::raii::CommandPool( device, vk::CommandPoolCreateInfo( vk::CommandPoolCreateFlagBits::eResetCommandBuffer, 0 ) ) );
+  }
+  std::vector<vk::raii::CommandBuffers> threadSecondaries;
+  for ( uint32_t t = 0; t < ThreadCount; ++t )
+  {
+    threadSecondaries.push_back( vk::raii::CommandBuffers( nullptr ) );
+  }
+  vk::raii::CommandBuffers primaries( nullptr );
+  vk::raii::Fence          fence( device, vk::FenceCreateInfo() );
+
+  vk::CommandBufferInheritanceInfo inheritanceInfo;
+  vk::CommandBufferBeginInfo       secondaryBeginInfo( vk::CommandBufferUsageFlagBits::eOneTimeSubmit, &inheritanceInfo );
+  std::vector<vk::CommandBuffer>   secondaries( ThreadCount * SecondariesPerThread );
+  SpinBarrier                      barrier( ThreadCount );
+
+  return runThreads(
+    [&]( uint32_t threadIndex )
+    {
+      for ( uint32_t frame = 0; frame < FrameCount; ++frame )
+      {
+        barrier.wait();
+
+        // frees the command buffers of the previous frame one by one, and allocates new ones
+        threadSecondaries[threadIndex] =
+          vk::raii::CommandBuffers( device, vk::CommandBufferAllocateInfo( commandPools[threadIndex], vk::CommandBufferLevel::eSecondary, SecondariesPerThread ) );
+        for ( uint32_t i = 0; i < SecondariesPerThread; ++i )
+        {
+          recordSecondary( threadSecondaries[threadIndex][i], secondaryBeginInfo );
+          secondaries[threadIndex * SecondariesPerThread + i] = threadSecondaries[threadIndex][i];
+        }
+        barrier.wait();
+
+        if ( threadIndex == 0 )
+        {
+          primaries = vk::raii::CommandBuffers( device, vk::CommandBufferAllocateInfo( commandPools[0], vk::CommandBufferLevel::ePrimary, 1 ) );
+          primaries[0].begin( vk::CommandBufferBeginInfo( vk::CommandBufferUsageFlagBits::eOneTimeSubmit ) );
+          primaries[0].executeCommands( secondaries );
+          primaries[0].end();
+          device.waitForFences( *fence, VK_TRUE, UINT64_MAX );
+        }
+      }
+    } );
+}
+
+int main()
+{
+  try
+  {
+    fixture::NullDevice nullDevice;
+
+    std::cout << "threads: " << ThreadCount << ", frames: " << FrameCount << ", secondary command buffers per thread and frame: " << SecondariesPerThread
+              << ", draws per secondary command buffer: " << DrawsPerSecondary << "\n";
+    std::cout << "CommandBufferRing : " << benchmarkCommandBufferRing( nullDevice.device ) << " ns per secondary command buffer\n";
+    std::cout << "allocate and free : " << benchmarkAllocateAndFree( nullDevice.device ) << " ns per secondary command buffer\n";
+  }
+  catch ( vk::SystemError & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+  return 0;
+}
@@ -0,0 +1,94 @@
+# SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+# SPDX-License-Identifier: Apache-2.0
+
+# VulkanHpp Benchmarks : CompiledRAII
+#                        Compile time and binary size of the RAII samples, built with the header-only vk::raii, and built against the
+#                        Vulkan::HppCompiled library (VULKAN_HPP_COMPILED_BUILD). Both variants are configured and built from scratch, into
+#                        build-raii-headerOnly and build-raii-compiled in the current directory. The time of building the samples' utils (with
+#                        the external libraries and Vulkan::HppCompiled) is reported separately from the one of building the samples themselves.
+#                        Usage: cmake [-DCONFIG=Release] [-DGENERATOR=Ninja] [-DJOBS=8] [-DPRECOMPILE=OFF] -P <path>/CompareBuilds.cmake
+#                        PRECOMPILE (default OFF) forwards to VULKAN_HPP_PRECOMPILE; with a precompiled header, most of the header parsing is
+#                        shared by all samples anyway.
+
+cmake_minimum_required( VERSION 3.22 )
+
+get_filename_component( SOURCE_DIR "${CMAKE_CURRENT_LIST_DIR}/../.." ABSOLUTE )
+if( NOT CONFIG )
+	set( CONFIG Release )
+endif()
+if( NOT DEFINED PRECOMPILE )
+	set( PRECOMPILE OFF )
+endif()
+set( GENERATOR_ARGS )
+if( GENERATOR )
+	set( GENERATOR_ARGS -G "${GENERATOR}" )
+endif()
+set( JOBS_ARGS --parallel )
+if( JOBS )
+	list( APPEND JOBS_ARGS ${JOBS} )
+endif()
+
+# every subdirectory of RAII_Samples but utils is a sample, built as target RAII_<subdirectory>
+file( GLOB SAMPLE_DIRS RELATIVE "${SOURCE_DIR}/RAII_Samples" "${SOURCE_DIR}/RAII_Samples/*" )
+set( SAMPLE_TARGETS )
+foreach( SAMPLE_DIR ${SAMPLE_DIRS} )
+	if( IS_DIRECTORY "${SOURCE_DIR}/RAII_Samples/${SAMPLE_DIR}" AND NOT SAMPLE_DIR STREQUAL "utils" )
+		list( APPEND SAMPLE_TARGETS RAII_${SAMPLE_DIR} )
+	endif()
+endforeach()
+list( LENGTH SAMPLE_TARGETS SAMPLE_COUNT )
+
+function( build_variant VARIANT COMPILED )
+	set( BINARY_DIR "${CMAKE_CURRENT_BINARY_DIR}/build-raii-${VARIANT}" )
+	file( REMOVE_RECURSE "${BINARY_DIR}" )
+	execute_process(
+		COMMAND ${CMAKE_COMMAND} -S "${SOURCE_DIR}" -B "${BINARY_DIR}" ${GENERATOR_ARGS}
+			-D CMAKE_BUILD_TYPE=${CONFIG}
+			-D VULKAN_HPP_GENERATOR_BUILD=OFF
+			-D VULKAN_HPP_SAMPLES_BUILD=ON
+			-D VULKAN_HPP_PRECOMPILE=${PRECOMPILE}
+			-D VULKAN_HPP_COMPILED_BUILD=${COMPILED}
+		OUTPUT_QUIET
+		RESULT_VARIABLE RESULT )
+	if( RESULT )
+		message( FATAL_ERROR "Configuring ${VARIANT} failed" )
+	endif()
+
+	# the utils, with the external libraries they need (the same in both variants), and Vulkan::HppCompiled, if used
+	set( UTILS_TARGETS utils_dynamic )
+	if( COMPILED )
+		list( APPEND UTILS_TARGETS VulkanHppCompiled )
+	endif()
+	string( TIMESTAMP START "%s" )
+	execute_process( COMMAND ${CMAKE_COMMAND} --build "${BINARY_DIR}" --config ${CONFIG} ${JOBS_ARGS} --target ${UTILS_TARGETS} OUTPUT_QUIET RESULT_VARIABLE RESULT )
+	string( TIMESTAMP MIDDLE "%s" )
+	if( RESULT )
+		message( FATAL_ERROR "Building the utils of ${VARIANT} failed" )
+	endif()
+	execute_process( COMMAND ${CMAKE_COMMAND} --build "${BINARY_DIR}" --config ${CONFIG} ${JOBS_ARGS} --target ${SAMPLE_TARGETS} OUTPUT_QUIET RESULT_VARIABLE RESULT )
+	string( TIMESTAMP END "%s" )
+	if( RESULT )
+		message( FATAL_ERROR "Building the samples of ${VARIANT} failed" )
+	endif()
+	math( EXPR UTILS_SECONDS "${MIDDLE} - ${START}" )
+	math( EXPR SAMPLES_SECONDS "${END} - ${MIDDLE}" )
+
+	# the executables are RAII_<sample> (or RAII_<sample>.exe), possibly in a per-configuration subdirectory
+	file( GLOB_RECURSE EXECUTABLES "${BINARY_DIR}/RAII_Samples/RAII_*" )
+	set( TOTAL_SIZE 0 )
+	set( EXECUTABLE_COUNT 0 )
+	foreach( EXECUTABLE ${EXECUTABLES} )
+		get_filename_component( NAME_WE "${EXECUTABLE}" NAME_WE )
+		get_filename_component( EXTENSION "${EXECUTABLE}" LAST_EXT )
+		if( NAME_WE IN_LIST SAMPLE_TARGETS AND ( EXTENSION STREQUAL "" OR EXTENSION STREQUAL ".exe" ) )
+			file( SIZE "${EXECUTABLE}" SIZE )
+			math( EXPR TOTAL_SIZE "${TOTAL_SIZE} + ${SIZE}" )
+			math( EXPR EXECUTABLE_COUNT "${EXECUTABLE_COUNT} + 1" )
+		endif()
+	endforeach()
+	math( EXPR TOTAL_KIB "${TOTAL_SIZE} / 1024" )
+	message( STATUS "${VARIANT}: utils ${UTILS_SECONDS} s, ${SAMPLE_COUNT} samples ${SAMPLES_SECONDS} s, ${EXECUTABLE_COUNT} executables ${TOTAL_KIB} KiB" )
+endfunction()
+
+build_variant( headerOnly OFF )
+build_variant( compiled ON )
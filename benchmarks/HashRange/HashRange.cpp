@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Benchmarks : HashRange
+//                        Hashing arrays of handles, as done by descriptor set or render pass caches,
+//                        element by element vs. all at once with vk::hashRange
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <vulkan/vulkan_hash.hpp>
+
+const uint32_t HandleCount = 1 << 24;
+
+template <typename Func>
+double measure( uint32_t iterationCount, Func const & func )
+{
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  for ( uint32_t i = 0; i < iterationCount; ++i )
+  {
+    func();
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::high_resolution_clock::now() - start;
+  return elapsed.count() / iterationCount;
+}
+
+int main()
+{
+  size_t checkSum = 0;
+  for ( size_t count : { 8, 64, 1024 } )
+  {
+    std::vector<vk::ImageView> imageViews( count );
+    for ( size_t i = 0; i < count; ++i )
+    {
+      uint64_t    value = 0x55550000 + 128 * i;
+      VkImageView imageView;
+      memcpy( &imageView, &value, sizeof( imageView ) );
+      imageViews[i] = imageView;
+    }
+
+    auto hashElementWise = [&]()
+    {
+      size_t seed = imageViews.size();
+      for ( auto const & imageView : imageViews )
+      {
+        seed ^= std::hash<vk::ImageView>{}( imageView ) + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 );
+      }
+      checkSum += seed;
+    };
+    auto hashAllAtOnce = [&]() { checkSum += vk::hashRange( imageViews.data(), imageViews.size() ); };
+
+    uint32_t iterationCount = static_cast<uint32_t>( HandleCount / count );
+    double   elementWise    = measure( iterationCount, hashElementWise );
+    double   allAtOnce      = measure( iterationCount, hashAllAtOnce );
+    std::cout << count << " handles: element by element " << elementWise << " ns, vk::hashRange " << allAtOnce << " ns\n";
+  }
+  std::cout << "(checksum " << checkSum << ")\n";
+  return 0;
+}
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Benchmarks : InstancePacking
+//                        Packing column-major model matrices into vk::AccelerationStructureInstanceKHR, one instance at a time as done by the
+//                        RayTracing samples, versus vk::raii::su::packInstances and vk::raii::su::packTransforms
+
+#include "../../RAII_Samples/utils/instancePacking.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+const uint32_t InstanceCount  = 100000;
+const uint32_t IterationCount = 200;
+
+// the per-instance data of some scene, with the model matrix as glm::mat4x4 would hold it
+struct SceneObject
+{
+  std::array<float, 16> model;
+  uint32_t              meshIndex;
+  uint32_t              materialIndex;
+};
+
+template <typename Func>
+double measure( Func const & func )
+{
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  for ( uint32_t i = 0; i < IterationCount; ++i )
+  {
+    func();
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::high_resolution_clock::now() - start;
+  return elapsed.count() / ( IterationCount * InstanceCount );
+}
+
+int main()
+{
+  std::mt19937                          generator( 42 );
+  std::uniform_real_distribution<float> distribution( -100.0f, 100.0f );
+
+  std::vector<SceneObject>                      sceneObjects( InstanceCount );
+  std::vector<vk::raii::su::InstanceAttributes> attributes( InstanceCount );
+  for ( uint32_t i = 0; i < InstanceCount; ++i )
+  {
+    for ( auto & value : sceneObjects[i].model )
+    {
+      value = distribution( generator );
+    }
+    sceneObjects[i].meshIndex     = i % 64;
+    sceneObjects[i].materialIndex = i % 16;
+
+    attributes[i].instanceCustomIndex                    = i;
+    attributes[i].instanceShaderBindingTableRecordOffset = 2 * sceneObjects[i].materialIndex;
+    attributes[i].flags                                  = vk::GeometryInstanceFlagBitsKHR::eTriangleFacingCullDisable;
+    attributes[i].accelerationStructureReference         = 0x10000 * ( sceneObjects[i].meshIndex + 1 );
+  }
+
+  // the instance buffer, standing in for mapped memory
+  std::vector<vk::AccelerationStructureInstanceKHR> perInstance( InstanceCount );
+  std::vector<vk::AccelerationStructureInstanceKHR> packed( InstanceCount );
+
+  auto packPerInstance = [&]()
+  {
+    std::vector<vk::AccelerationStructureInstanceKHR> instances;
+    instances.reserve( InstanceCount );
+    for ( uint32_t i = 0; i < InstanceCount; ++i )
+    {
+      std::array<std::array<float, 4>, 3> transform;
+      for ( size_t row = 0; row < 3; ++row )
+      {
+        for ( size_t column = 0; column < 4; ++column )
+        {
+          transform[row][column] = sceneObjects[i].model[4 * column + row];
+        }
+      }
+      instances.push_back( vk::AccelerationStructureInstanceKHR( transform,
+                                                                 attributes[i].instanceCustomIndex,
+                                                                 attributes[i].mask,
+                                                                 attributes[i].instanceShaderBindingTableRecordOffset,
+                                                                 attributes[i].flags,
+                                                                 attributes[i].accelerationStructureReference ) );
+    }
+    memcpy( perInstance.data(), instances.data(), InstanceCount * sizeof( vk::AccelerationStructureInstanceKHR ) );
+  };
+  auto packAll = [&]()
+  {
+    vk::raii::su::packInstances(
+      vk::StridedArrayProxy<float const>( InstanceCount, sceneObjects[0].model.data(), sizeof( SceneObject ) ), attributes, packed.data() );
+  };
+  auto packTransforms = [&]()
+  { vk::raii::su::packTransforms( vk::StridedArrayProxy<float const>( InstanceCount, sceneObjects[0].model.data(), sizeof( SceneObject ) ), packed.data() ); };
+
+  double perInstanceTime    = measure( packPerInstance );
+  double packInstancesTime  = measure( packAll );
+  double packTransformsTime = measure( packTransforms );
+
+  if ( memcmp( perInstance.data(), packed.data(), InstanceCount * sizeof( vk::AccelerationStructureInstanceKHR ) ) != 0 )
+  {
+    std::cout << "packed instances differ from the ones packed one at a time\n";
+    return 1;
+  }
+
+  std::cout << InstanceCount << " instances:\n";
+  std::cout << "one at a time  : " << perInstanceTime << " ns per instance\n";
+  std::cout << "packInstances  : " << packInstancesTime << " ns per instance\n";
+  std::cout << "packTransforms : " << packTransformsTime << " ns per instance\n";
+  return 0;
+}
@@ -0,0 +1,238 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Benchmarks : MemoryAllocator
+//                        Throughput and fragmentation of vk::raii::su::MemoryAllocator versus one vk::raii::DeviceMemory per resource, against
+//                        the null driver with a memory layout and memory requirements faked by a few overrides
+
+#include "../../RAII_Samples/utils/memoryAllocator.hpp"
+#include "../../tests/null_driver_fixture.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace fake
+{
+  uint64_t allocateMemoryCount    = 0;
+  uint64_t bindBufferMemory2Count = 0;
+
+  vk::DeviceSize const BufferImageGranularity = 1024;
+  vk::DeviceSize const DedicatedThreshold     = 16 * 1024 * 1024;
+
+  std::unordered_map<VkBuffer, VkDeviceSize> bufferSizes;
+
+  VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceProperties( VkPhysicalDevice, VkPhysicalDeviceProperties * pProperties )
+  {
+    memset( pProperties, 0, sizeof( VkPhysicalDeviceProperties ) );
+    pProperties->limits.bufferImageGranularity   = BufferImageGranularity;
+    pProperties->limits.maxMemoryAllocationCount = 4096;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL allocateMemory( VkDevice, VkMemoryAllocateInfo const *, VkAllocationCallbacks const *, VkDeviceMemory * pMemory )
+  {
+    ++allocateMemoryCount;
+    *pMemory = vk::detail::NullDriver::nextHandle<VkDeviceMemory>();
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL createBuffer( VkDevice, VkBufferCreateInfo const * pCreateInfo, VkAllocationCallbacks const *, VkBuffer * pBuffer )
+  {
+    *pBuffer              = vk::detail::NullDriver::nextHandle<VkBuffer>();
+    bufferSizes[*pBuffer] = pCreateInfo->size;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL destroyBuffer( VkDevice, VkBuffer buffer, VkAllocationCallbacks const * )
+  {
+    bufferSizes.erase( buffer );
+  }
+
+  // buffers are padded to 256 bytes, and the large ones prefer a dedicated allocation
+  VKAPI_ATTR void VKAPI_CALL getBufferMemoryRequirements2( VkDevice,
+                                                           VkBufferMemoryRequirementsInfo2 const * pInfo,
+                                                           VkMemoryRequirements2 *                 pMemoryRequirements )
+  {
+    VkDeviceSize size = bufferSizes[pInfo->buffer];
+
+    pMemoryRequirements->memoryRequirements.size           = ( size + 255 ) & ~VkDeviceSize( 255 );
+    pMemoryRequirements->memoryRequirements.alignment      = 256;
+    pMemoryRequirements->memoryRequirements.memoryTypeBits = 0x3;
+    for ( VkBaseOutStructure * pNext = static_cast<VkBaseOutStructure *>( pMemoryRequirements->pNext ); pNext; pNext = pNext->pNext )
+    {
+      if ( pNext->sType == VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS )
+      {
+        reinterpret_cast<VkMemoryDedicatedRequirements *>( pNext )->prefersDedicatedAllocation = DedicatedThreshold <= size;
+      }
+    }
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL bindBufferMemory2( VkDevice, uint32_t, VkBindBufferMemoryInfo const * )
+  {
+    ++bindBufferMemory2Count;
+    return VK_SUCCESS;
+  }
+
+  void install()
+  {
+    fixture::addOverride( "vkGetPhysicalDeviceMemoryProperties", &fixture::getPhysicalDeviceMemoryProperties );
+    fixture::addOverride( "vkGetPhysicalDeviceProperties", &getPhysicalDeviceProperties );
+    fixture::addOverride( "vkAllocateMemory", &allocateMemory );
+    fixture::addOverride( "vkCreateBuffer", &createBuffer );
+    fixture::addOverride( "vkDestroyBuffer", &destroyBuffer );
+    fixture::addOverride( "vkGetBufferMemoryRequirements2", &getBufferMemoryRequirements2 );
+    fixture::addOverride( "vkBindBufferMemory2", &bindBufferMemory2 );
+  }
+}  // namespace fake
+
+const uint32_t LiveAllocations = 4096;
+const uint32_t Iterations      = 200000;
+
+// sizes between 256 bytes and 4 MiB, evenly distributed over the powers of two, with alignments between 256 bytes and 64 KiB
+struct RandomRequirements
+{
+  std::mt19937_64 generator{ 42 };
+
+  vk::MemoryRequirements operator()()
+  {
+    vk::DeviceSize alignment = vk::DeviceSize( 256 ) << ( generator() % 9 );
+    vk::DeviceSize size      = ( vk::DeviceSize( 256 ) << ( generator() % 15 ) ) + ( generator() % 4096 );
+    return vk::MemoryRequirements( ( size + alignment - 1 ) & ~( alignment - 1 ), alignment, 0x3 );
+  }
+};
+
+template <typename Allocation, typename AllocateFunc>
+double churn( AllocateFunc const & allocateFunc )
+{
+  // fill up to LiveAllocations, then replace a random allocation by a new one in each iteration
+  RandomRequirements      randomRequirements;
+  std::vector<Allocation> allocations;
+  allocations.reserve( LiveAllocations );
+  for ( uint32_t i = 0; i < LiveAllocations; ++i )
+  {
+    allocations.push_back( allocateFunc( randomRequirements(), i ) );
+  }
+
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  for ( uint32_t i = 0; i < Iterations; ++i )
+  {
+    size_t index       = randomRequirements.generator() % LiveAllocations;
+    allocations[index] = allocateFunc( randomRequirements(), i );
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::high_resolution_clock::now() - start;
+  return elapsed.count() / Iterations;
+}
+
+void benchmarkChurn( vk::raii::PhysicalDevice const & physicalDevice, vk::raii::Device const & device )
+{
+  vk::PhysicalDeviceMemoryProperties memoryProperties = physicalDevice.getMemoryProperties();
+
+  fake::allocateMemoryCount = 0;
+  double perResourceTime = churn<vk::raii::DeviceMemory>(
+    [&]( vk::MemoryRequirements const & memoryRequirements, uint32_t ) -> vk::raii::DeviceMemory
+    {
+      // the equivalent of vk::raii::su::allocateDeviceMemory
+      uint32_t memoryTypeIndex = 0;
+      while ( !( memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & vk::MemoryPropertyFlagBits::eDeviceLocal ) )
+      {
+        ++memoryTypeIndex;
+      }
+      return vk::raii::DeviceMemory( device, vk::MemoryAllocateInfo( memoryRequirements.size, memoryTypeIndex ) );
+    } );
+
+  uint64_t perResourceCount = fake::allocateMemoryCount;
+
+  fake::allocateMemoryCount = 0;
+  vk::raii::su::MemoryAllocator::Statistics statistics;
+  double                                    allocatorTime;
+  {
+    vk::raii::su::MemoryAllocator memoryAllocator( physicalDevice, device );
+    allocatorTime = churn<vk::raii::su::MemoryAllocation>(
+      [&]( vk::MemoryRequirements const & memoryRequirements, uint32_t i )
+      {
+        // every fourth allocation is for an optimally tiled image, which is kept apart from the buffers due to the bufferImageGranularity
+        return memoryAllocator.allocate( memoryRequirements,
+                                         vk::MemoryPropertyFlagBits::eDeviceLocal,
+                                         ( i % 4 ) ? vk::raii::su::MemoryAllocator::ResourceKind::eLinear
+                                                   : vk::raii::su::MemoryAllocator::ResourceKind::eOptimal );
+      } );
+    statistics = memoryAllocator.getStatistics();
+  }
+  uint64_t allocatorCount = fake::allocateMemoryCount;
+
+  std::cout << "churn with " << LiveAllocations << " live allocations, " << Iterations << " replacements:\n";
+  std::cout << "  vk::raii::DeviceMemory per resource : " << perResourceTime << " ns per replacement, " << perResourceCount << " calls to vkAllocateMemory\n";
+  std::cout << "  MemoryAllocator                     : " << allocatorTime << " ns per replacement, " << allocatorCount << " calls to vkAllocateMemory\n";
+  std::cout << "  MemoryAllocator after churn         : " << statistics.allocationCount << " sub-allocations in " << statistics.blockCount
+            << " blocks, " << 100.0 * statistics.allocatedBlockBytes / statistics.blockBytes << "% of the block memory in use, "
+            << statistics.dedicatedCount << " dedicated allocations\n";
+}
+
+void benchmarkBuffers( vk::raii::PhysicalDevice const & physicalDevice, vk::raii::Device const & device )
+{
+  const uint32_t BufferCount = 10000;
+
+  fake::allocateMemoryCount    = 0;
+  fake::bindBufferMemory2Count = 0;
+
+  vk::raii::su::MemoryAllocator memoryAllocator( physicalDevice, device );
+  std::mt19937_64               generator( 42 );
+  std::vector<vk::raii::Buffer> buffers;
+  buffers.reserve( BufferCount );
+  std::vector<vk::raii::su::MemoryAllocation> allocations;
+  allocations.reserve( BufferCount );
+  std::vector<vk::BindBufferMemoryInfo> bindInfos;
+  bindInfos.reserve( BufferCount );
+
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  for ( uint32_t i = 0; i < BufferCount; ++i )
+  {
+    // mostly small uniform and vertex buffers, and one in a thousand larger than the dedicated allocation threshold
+    vk::DeviceSize size = ( i % 1000 == 999 ) ? fake::DedicatedThreshold : ( vk::DeviceSize( 64 ) << ( generator() % 12 ) );
+    buffers.push_back( vk::raii::Buffer( device, vk::BufferCreateInfo( {}, size, vk::BufferUsageFlagBits::eUniformBuffer ) ) );
+    allocations.push_back( memoryAllocator.allocate( buffers.back(), vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent ) );
+    bindInfos.push_back( allocations.back().makeBindInfo( *buffers.back() ) );
+  }
+  device.bindBufferMemory2( bindInfos );
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::high_resolution_clock::now() - start;
+
+  vk::raii::su::MemoryAllocator::Statistics statistics = memoryAllocator.getStatistics();
+  std::cout << BufferCount << " host visible buffers, created, allocated, and bound in one go: " << elapsed.count() / BufferCount << " ns per buffer, "
+            << fake::allocateMemoryCount << " calls to vkAllocateMemory (" << statistics.blockCount << " blocks, " << statistics.dedicatedCount
+            << " dedicated), " << fake::bindBufferMemory2Count << " call to vkBindBufferMemory2\n";
+
+  // the allocations have to be released before the buffers bound to them are destroyed
+  allocations.clear();
+}
+
+int main()
+{
+  try
+  {
+    fake::install();
+
+    fixture::NullDevice nullDevice;
+
+    benchmarkChurn( nullDevice.physicalDevices[0], nullDevice.device );
+    benchmarkBuffers( nullDevice.physicalDevices[0], nullDevice.device );
+  }
+  catch ( vk::SystemError & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+  return 0;
+}
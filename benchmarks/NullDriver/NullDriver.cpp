@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Benchmarks : NullDriver
+//                        Creating and destroying buffers and command buffers through the C API, vk::, vk::UniqueHandle, vk::SharedHandle, and
+//                        vk::raii::, against the null driver; as the driver does nothing, the differences are the costs of the wrappers
+
+#include <chrono>
+#include <iostream>
+#include <vulkan/vulkan_null_driver.hpp>
+#include <vulkan/vulkan_raii.hpp>
+#include <vulkan/vulkan_shared.hpp>
+VULKAN_HPP_DEFAULT_DISPATCH_LOADER_DYNAMIC_STORAGE
+
+const uint32_t IterationCount     = 1000000;
+const uint32_t CommandBufferCount = 8;
+
+template <typename Func>
+double measure( Func const & func )
+{
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  for ( uint32_t i = 0; i < IterationCount; ++i )
+  {
+    func();
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::high_resolution_clock::now() - start;
+  return elapsed.count() / IterationCount;
+}
+
+int main()
+{
+  try
+  {
+    vk::detail::defaultDispatchLoaderDynamic.init( &vk::detail::NullDriver::getInstanceProcAddr );
+
+    vk::Instance instance = vk::createInstance( vk::InstanceCreateInfo() );
+    vk::detail::defaultDispatchLoaderDynamic.init( instance );
+
+    vk::PhysicalDevice        physicalDevice = instance.enumeratePhysicalDevices().front();
+    float                     queuePriority  = 0.0f;
+    vk::DeviceQueueCreateInfo deviceQueueCreateInfo( {}, 0, 1, &queuePriority );
+
+    // the SharedDevice is needed for the SharedHandles, and destroys the device at the end
+    vk::SharedDevice sharedDevice( physicalDevice.createDevice( vk::DeviceCreateInfo( {}, deviceQueueCreateInfo ) ) );
+    vk::Device       device = sharedDevice.get();
+    vk::detail::defaultDispatchLoaderDynamic.init( device );
+
+    vk::CommandPool               commandPool = device.createCommandPool( vk::CommandPoolCreateInfo() );
+    vk::BufferCreateInfo          bufferCreateInfo( {}, 256, vk::BufferUsageFlagBits::eVertexBuffer );
+    vk::CommandBufferAllocateInfo commandBufferAllocateInfo( commandPool, vk::CommandBufferLevel::ePrimary, CommandBufferCount );
+
+    vk::detail::DispatchLoaderDynamic const & d                          = vk::detail::defaultDispatchLoaderDynamic;
+    VkBufferCreateInfo const &                cBufferCreateInfo          = bufferCreateInfo;
+    VkCommandBufferAllocateInfo const &       cCommandBufferAllocateInfo = commandBufferAllocateInfo;
+
+    std::cout << "iterations: " << IterationCount << ", command buffers per allocation: " << CommandBufferCount << "\n";
+
+    std::cout << "create and destroy a buffer\n";
+    std::cout << "  C API           : " << measure(
+                                             [&]()
+                                             {
+                                               VkBuffer buffer;
+                                               d.vkCreateBuffer( device, &cBufferCreateInfo, nullptr, &buffer );
+                                               d.vkDestroyBuffer( device, buffer, nullptr );
+                                             } )
+              << " ns\n";
+    std::cout << "  vk::            : " << measure( [&]() { device.destroyBuffer( device.createBuffer( bufferCreateInfo ) ); } ) << " ns\n";
+    std::cout << "  vk::UniqueHandle: " << measure( [&]() { vk::UniqueBuffer buffer = device.createBufferUnique( bufferCreateInfo ); } ) << " ns\n";
+    std::cout << "  vk::SharedHandle: " << measure( [&]() { vk::SharedBuffer buffer( device.createBuffer( bufferCreateInfo ), sharedDevice ); } ) << " ns\n";
+
+    std::cout << "allocate and free " << CommandBufferCount << " command buffers\n";
+    std::cout << "  C API           : " << measure(
+                                             [&]()
+                                             {
+                                               VkCommandBuffer commandBuffers[CommandBufferCount];
+                                               d.vkAllocateCommandBuffers( device, &cCommandBufferAllocateInfo, commandBuffers );
+                                               d.vkFreeCommandBuffers( device, commandPool, CommandBufferCount, commandBuffers );
+                                             } )
+              << " ns\n";
+    std::cout << "  vk::            : "
+              << measure( [&]() { device.freeCommandBuffers( commandPool, device.allocateCommandBuffers( commandBufferAllocateInfo ) ); } ) << " ns\n";
+    std::cout << "  vk::UniqueHandle: "
+              << measure( [&]() { std::vector<vk::UniqueCommandBuffer> commandBuffers = device.allocateCommandBuffersUnique( commandBufferAllocateInfo ); } )
+              << " ns\n";
+    device.destroyCommandPool( commandPool );
+    sharedDevice.reset();
+    instance.destroy();
+
+    // vk::raii:: needs its own instance and device, with their own dispatchers
+    vk::raii::Context         context( &vk::detail::NullDriver::getInstanceProcAddr );
+    vk::raii::Instance        raiiInstance( context, vk::InstanceCreateInfo() );
+    vk::raii::PhysicalDevices raiiPhysicalDevices( raiiInstance );
+    vk::raii::Device          raiiDevice( raiiPhysicalDevices[0], vk::DeviceCreateInfo( {}, deviceQueueCreateInfo ) );
+    vk::raii::CommandPool     raiiCommandPool( raiiDevice, vk::CommandPoolCreateInfo() );
+    commandBufferAllocateInfo.commandPool = *raiiCommandPool;
+
+    std::cout << "create and destroy a buffer\n";
+    std::cout << "  vk::raii::      : " << measure( [&]() { vk::raii::Buffer buffer( raiiDevice, bufferCreateInfo ); } ) << " ns\n";
+    std::cout << "allocate and free " << CommandBufferCount << " command buffers\n";
+    std::cout << "  vk::raii::      : " << measure( [&]() { vk::raii::CommandBuffers commandBuffers( raiiDevice, commandBufferAllocateInfo ); } ) << " ns\n";
+  }
+  catch ( vk::SystemError & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+  return 0;
+}
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Benchmarks : ResultCheck
+//                        Latency of checking a vk::Result against the success codes of a command: std::find on an std::initializer_list (as
+//                        before), a chain of comparisons, and vk::detail::isSuccessCode (a constant mask plus comparisons for the large codes).
+//                        Every check is a separate non-inlined function, such that its code size can be read from the binary as well, for example
+//                        with "nm --size-sort -C ResultCheck | grep check_" or with dumpbin /disasm.
+
+#include <algorithm>
+#include <chrono>
+#include <initializer_list>
+#include <iostream>
+#include <vector>
+#include <vulkan/vulkan.hpp>
+
+#if defined( _MSC_VER )
+#  define NOINLINE __declspec( noinline )
+#else
+#  define NOINLINE __attribute__( ( noinline ) )
+#endif
+
+template <vk::Result SuccessCode>
+bool isSuccessCodeByComparisons( vk::Result result )
+{
+  return result == SuccessCode;
+}
+
+template <vk::Result SuccessCode, vk::Result NextSuccessCode, vk::Result... SuccessCodes>
+bool isSuccessCodeByComparisons( vk::Result result )
+{
+  return ( result == SuccessCode ) || isSuccessCodeByComparisons<NextSuccessCode, SuccessCodes...>( result );
+}
+
+#define RESULT_CHECKS( Name, ... )                                                                  \
+  NOINLINE bool check_##Name##_initializerList( vk::Result result )                                 \
+  {                                                                                                 \
+    std::initializer_list<vk::Result> successCodes = { __VA_ARGS__ };                               \
+    return std::find( successCodes.begin(), successCodes.end(), result ) != successCodes.end();     \
+  }                                                                                                 \
+  NOINLINE bool check_##Name##_comparisons( vk::Result result )                                     \
+  {                                                                                                 \
+    return isSuccessCodeByComparisons<__VA_ARGS__>( result );                                       \
+  }                                                                                                 \
+  NOINLINE bool check_##Name##_mask( vk::Result result )                                            \
+  {                                                                                                 \
+    return vk::detail::isSuccessCode<__VA_ARGS__>( result );                                        \
+  }
+
+// the success codes of a few commands, from small ones only to large ones only
+RESULT_CHECKS( GetFenceStatus, vk::Result::eSuccess, vk::Result::eNotReady )
+RESULT_CHECKS( GetQueryPoolResults, vk::Result::eSuccess, vk::Result::eNotReady, vk::Result::eIncomplete )
+RESULT_CHECKS( AcquireNextImageKHR, vk::Result::eSuccess, vk::Result::eTimeout, vk::Result::eNotReady, vk::Result::eSuboptimalKHR )
+RESULT_CHECKS( BuildAccelerationStructuresKHR, vk::Result::eSuccess, vk::Result::eOperationDeferredKHR, vk::Result::eOperationNotDeferredKHR )
+
+struct Scenario
+{
+  char const * name;
+  bool ( *initializerList )( vk::Result );
+  bool ( *comparisons )( vk::Result );
+  bool ( *mask )( vk::Result );
+};
+
+#define SCENARIO( Name ) { #Name, &check_##Name##_initializerList, &check_##Name##_comparisons, &check_##Name##_mask }
+
+template <typename Func>
+double measure( std::vector<vk::Result> const & results, uint32_t iterationCount, Func const & func, size_t & checkSum )
+{
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  for ( uint32_t i = 0; i < iterationCount; ++i )
+  {
+    for ( vk::Result result : results )
+    {
+      checkSum += func( result ) ? 1 : 0;
+    }
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::high_resolution_clock::now() - start;
+  return elapsed.count() / ( iterationCount * results.size() );
+}
+
+int main()
+{
+  // a mix of the results those commands return, in a pseudo-random order
+  vk::Result const returned[] = { vk::Result::eSuccess,       vk::Result::eNotReady,           vk::Result::eTimeout,          vk::Result::eIncomplete,
+                                 vk::Result::eSuboptimalKHR, vk::Result::eOperationDeferredKHR, vk::Result::eErrorOutOfDateKHR, vk::Result::eSuccess };
+
+  std::vector<vk::Result> results( 4096 );
+  uint32_t                state = 1;
+  for ( vk::Result & result : results )
+  {
+    state  = state * 1664525 + 1013904223;
+    result = returned[( state >> 16 ) % ( sizeof( returned ) / sizeof( returned[0] ) )];
+  }
+
+  Scenario const scenarios[] = {
+    SCENARIO( GetFenceStatus ), SCENARIO( GetQueryPoolResults ), SCENARIO( AcquireNextImageKHR ), SCENARIO( BuildAccelerationStructuresKHR )
+  };
+
+  uint32_t const iterationCount = 4096;
+  size_t         checkSum       = 0;
+  for ( Scenario const & scenario : scenarios )
+  {
+    double initializerList = measure( results, iterationCount, scenario.initializerList, checkSum );
+    double comparisons     = measure( results, iterationCount, scenario.comparisons, checkSum );
+    double mask            = measure( results, iterationCount, scenario.mask, checkSum );
+    std::cout << scenario.name << ": std::initializer_list " << initializerList << " ns, comparisons " << comparisons << " ns, vk::detail::isSuccessCode "
+              << mask << " ns\n";
+  }
+  std::cout << "(checksum " << checkSum << ")\n";
+  return 0;
+}
@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Benchmarks : Serialization
+//                        Throughput of vk::serialize and vk::deserialize on a graphics pipeline create info with a pNext chain
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <vulkan/vulkan_serialize.hpp>
+
+const uint32_t IterationCount = 200000;
+
+template <typename Func>
+double measure( Func const & func )
+{
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  for ( uint32_t i = 0; i < IterationCount; ++i )
+  {
+    func();
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::high_resolution_clock::now() - start;
+  return elapsed.count() / IterationCount;
+}
+
+void report( char const * name, double nanoSeconds, size_t size )
+{
+  std::cout << name << nanoSeconds << " ns per structure, " << size / nanoSeconds * 1000.0 << " MB/s\n";
+}
+
+int main()
+{
+  try
+  {
+    std::array<vk::SpecializationMapEntry, 4> mapEntries = { { vk::SpecializationMapEntry( 0, 0, 4 ),
+                                                               vk::SpecializationMapEntry( 1, 4, 4 ),
+                                                               vk::SpecializationMapEntry( 2, 8, 4 ),
+                                                               vk::SpecializationMapEntry( 3, 12, 4 ) } };
+    std::array<uint32_t, 4>                   constants  = { { 1, 2, 3, 4 } };
+    vk::SpecializationInfo                    specialization( mapEntries, vk::ArrayProxyNoTemporaries<const uint32_t>( constants ) );
+
+    std::array<vk::PipelineShaderStageCreateInfo, 2> stages = {
+      { vk::PipelineShaderStageCreateInfo( {}, vk::ShaderStageFlagBits::eVertex, {}, "main", &specialization ),
+        vk::PipelineShaderStageCreateInfo( {}, vk::ShaderStageFlagBits::eFragment, {}, "main", &specialization ) }
+    };
+
+    std::array<vk::VertexInputBindingDescription, 2>   bindings = { { vk::VertexInputBindingDescription( 0, 32 ),
+                                                                  vk::VertexInputBindingDescription( 1, 16 ) } };
+    std::array<vk::VertexInputAttributeDescription, 4> attributes = { { vk::VertexInputAttributeDescription( 0, 0, vk::Format::eR32G32B32Sfloat, 0 ),
+                                                                        vk::VertexInputAttributeDescription( 1, 0, vk::Format::eR32G32B32Sfloat, 12 ),
+                                                                        vk::VertexInputAttributeDescription( 2, 0, vk::Format::eR32G32Sfloat, 24 ),
+                                                                        vk::VertexInputAttributeDescription( 3, 1, vk::Format::eR32G32B32A32Sfloat, 0 ) } };
+    vk::PipelineVertexInputStateCreateInfo             vertexInputState( {}, bindings, attributes );
+    vk::PipelineInputAssemblyStateCreateInfo           inputAssemblyState( {}, vk::PrimitiveTopology::eTriangleList );
+    vk::PipelineViewportStateCreateInfo                viewportState( {}, 1, nullptr, 1, nullptr );
+    vk::PipelineRasterizationStateCreateInfo           rasterizationState;
+    vk::PipelineMultisampleStateCreateInfo             multisampleState;
+    vk::PipelineDepthStencilStateCreateInfo            depthStencilState( {}, true, true, vk::CompareOp::eLessOrEqual );
+
+    std::array<vk::PipelineColorBlendAttachmentState, 2> colorBlendAttachments;
+    vk::PipelineColorBlendStateCreateInfo                colorBlendState( {}, false, vk::LogicOp::eNoOp, colorBlendAttachments );
+    std::array<vk::DynamicState, 2>                      dynamicStates = { { vk::DynamicState::eViewport, vk::DynamicState::eScissor } };
+    vk::PipelineDynamicStateCreateInfo                   dynamicState( {}, dynamicStates );
+    std::array<vk::Format, 2>                            colorFormats = { { vk::Format::eB8G8R8A8Unorm, vk::Format::eR16G16B16A16Sfloat } };
+    vk::PipelineRenderingCreateInfo                      renderingCreateInfo( 0, colorFormats, vk::Format::eD32Sfloat );
+
+    vk::GraphicsPipelineCreateInfo graphicsPipelineCreateInfo( {},
+                                                                stages,
+                                                                &vertexInputState,
+                                                                &inputAssemblyState,
+                                                                nullptr,
+                                                                &viewportState,
+                                                                &rasterizationState,
+                                                                &multisampleState,
+                                                                &depthStencilState,
+                                                                &colorBlendState,
+                                                                &dynamicState,
+                                                                {},
+                                                                nullptr,
+                                                                0,
+                                                                nullptr,
+                                                                -1,
+                                                                &renderingCreateInfo );
+
+    std::vector<uint8_t> data = vk::serialize( graphicsPipelineCreateInfo );
+    std::cout << "serialized size: " << data.size() << " bytes\n";
+
+    size_t checkSum = 0;
+    report( "serialize   : ", measure( [&]() { checkSum += vk::serialize( graphicsPipelineCreateInfo ).size(); } ), data.size() );
+    report( "deserialize : ", measure( [&]() { checkSum += vk::deserialize<vk::GraphicsPipelineCreateInfo>( data )->stageCount; } ), data.size() );
+    std::cout << "(checksum " << checkSum << ")\n";
+  }
+  catch ( vk::SystemError & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+  return 0;
+}
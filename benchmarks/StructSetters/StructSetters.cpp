@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Benchmarks : StructSetters
+//                        Building vk::GraphicsPipelineCreateInfo and vk::RenderingInfo by constructor, by setter chains on a named structure,
+//                        and by setter chains on a temporary, either passed on right away or used to initialize a named structure
+
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <vulkan/vulkan.hpp>
+
+const uint32_t IterationCount = 10000000;
+
+// the structures are consumed through volatile function pointers, such that they can't be optimized away
+uint64_t checksum = 0;
+
+void consumeGraphicsPipelineCreateInfo( vk::GraphicsPipelineCreateInfo const & createInfo )
+{
+  checksum += createInfo.stageCount + createInfo.subpass + reinterpret_cast<uintptr_t>( createInfo.pVertexInputState );
+}
+
+void consumeRenderingInfo( vk::RenderingInfo const & renderingInfo )
+{
+  checksum += renderingInfo.renderArea.extent.width + renderingInfo.layerCount + reinterpret_cast<uintptr_t>( renderingInfo.pColorAttachments );
+}
+
+void ( *volatile consumeGraphicsPipeline )( vk::GraphicsPipelineCreateInfo const & ) = consumeGraphicsPipelineCreateInfo;
+void ( *volatile consumeRendering )( vk::RenderingInfo const & )                     = consumeRenderingInfo;
+
+template <typename Func>
+double measure( Func const & func )
+{
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  for ( uint32_t i = 0; i < IterationCount; ++i )
+  {
+    func( i );
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::high_resolution_clock::now() - start;
+  return elapsed.count() / IterationCount;
+}
+
+int main()
+{
+  std::array<vk::PipelineShaderStageCreateInfo, 2> stages;
+  vk::PipelineVertexInputStateCreateInfo           vertexInputState;
+  vk::PipelineInputAssemblyStateCreateInfo         inputAssemblyState( {}, vk::PrimitiveTopology::eTriangleList );
+  vk::PipelineViewportStateCreateInfo              viewportState( {}, 1, nullptr, 1, nullptr );
+  vk::PipelineRasterizationStateCreateInfo         rasterizationState;
+  vk::PipelineMultisampleStateCreateInfo           multisampleState;
+  vk::PipelineColorBlendStateCreateInfo            colorBlendState;
+  std::array<vk::RenderingAttachmentInfo, 4>       colorAttachments;
+  vk::RenderingAttachmentInfo                      depthAttachment;
+
+  auto pipelineByConstructor = [&]( uint32_t i )
+  {
+    vk::GraphicsPipelineCreateInfo createInfo(
+      {}, stages, &vertexInputState, &inputAssemblyState, nullptr, &viewportState, &rasterizationState, &multisampleState, nullptr, &colorBlendState );
+    createInfo.subpass = i;
+    consumeGraphicsPipeline( createInfo );
+  };
+  auto pipelineByLValueChain = [&]( uint32_t i )
+  {
+    vk::GraphicsPipelineCreateInfo createInfo;
+    createInfo.setStages( stages )
+      .setPVertexInputState( &vertexInputState )
+      .setPInputAssemblyState( &inputAssemblyState )
+      .setPViewportState( &viewportState )
+      .setPRasterizationState( &rasterizationState )
+      .setPMultisampleState( &multisampleState )
+      .setPColorBlendState( &colorBlendState )
+      .setSubpass( i );
+    consumeGraphicsPipeline( createInfo );
+  };
+  auto pipelineByRValueChain = [&]( uint32_t i )
+  {
+    consumeGraphicsPipeline( vk::GraphicsPipelineCreateInfo()
+                               .setStages( stages )
+                               .setPVertexInputState( &vertexInputState )
+                               .setPInputAssemblyState( &inputAssemblyState )
+                               .setPViewportState( &viewportState )
+                               .setPRasterizationState( &rasterizationState )
+                               .setPMultisampleState( &multisampleState )
+                               .setPColorBlendState( &colorBlendState )
+                               .setSubpass( i ) );
+  };
+  auto pipelineByRValueChainCopied = [&]( uint32_t i )
+  {
+    vk::GraphicsPipelineCreateInfo createInfo = vk::GraphicsPipelineCreateInfo()
+                                                  .setStages( stages )
+                                                  .setPVertexInputState( &vertexInputState )
+                                                  .setPInputAssemblyState( &inputAssemblyState )
+                                                  .setPViewportState( &viewportState )
+                                                  .setPRasterizationState( &rasterizationState )
+                                                  .setPMultisampleState( &multisampleState )
+                                                  .setPColorBlendState( &colorBlendState )
+                                                  .setSubpass( i );
+    consumeGraphicsPipeline( createInfo );
+  };
+
+  auto renderingByConstructor = [&]( uint32_t i )
+  {
+    vk::RenderingInfo renderingInfo( {}, vk::Rect2D( {}, vk::Extent2D( i, 1080 ) ), 1, 0, colorAttachments, &depthAttachment );
+    consumeRendering( renderingInfo );
+  };
+  auto renderingByLValueChain = [&]( uint32_t i )
+  {
+    vk::RenderingInfo renderingInfo;
+    renderingInfo.setRenderArea( vk::Rect2D( {}, vk::Extent2D( i, 1080 ) ) )
+      .setLayerCount( 1 )
+      .setColorAttachments( colorAttachments )
+      .setPDepthAttachment( &depthAttachment );
+    consumeRendering( renderingInfo );
+  };
+  auto renderingByRValueChain = [&]( uint32_t i )
+  {
+    consumeRendering( vk::RenderingInfo()
+                        .setRenderArea( vk::Rect2D( {}, vk::Extent2D( i, 1080 ) ) )
+                        .setLayerCount( 1 )
+                        .setColorAttachments( colorAttachments )
+                        .setPDepthAttachment( &depthAttachment ) );
+  };
+  auto renderingByRValueChainCopied = [&]( uint32_t i )
+  {
+    vk::RenderingInfo renderingInfo = vk::RenderingInfo()
+                                        .setRenderArea( vk::Rect2D( {}, vk::Extent2D( i, 1080 ) ) )
+                                        .setLayerCount( 1 )
+                                        .setColorAttachments( colorAttachments )
+                                        .setPDepthAttachment( &depthAttachment );
+    consumeRendering( renderingInfo );
+  };
+
+  double pipelineByConstructorTime        = measure( pipelineByConstructor );
+  double pipelineByLValueChainTime        = measure( pipelineByLValueChain );
+  double pipelineByRValueChainTime        = measure( pipelineByRValueChain );
+  double pipelineByRValueChainCopiedTime  = measure( pipelineByRValueChainCopied );
+  double renderingByConstructorTime       = measure( renderingByConstructor );
+  double renderingByLValueChainTime       = measure( renderingByLValueChain );
+  double renderingByRValueChainTime       = measure( renderingByRValueChain );
+  double renderingByRValueChainCopiedTime = measure( renderingByRValueChainCopied );
+
+  std::cout << "vk::GraphicsPipelineCreateInfo:\n";
+  std::cout << "constructor              : " << pipelineByConstructorTime << " ns\n";
+  std::cout << "setters on named struct  : " << pipelineByLValueChainTime << " ns\n";
+  std::cout << "setters on temporary     : " << pipelineByRValueChainTime << " ns\n";
+  std::cout << "setters on copied temp.  : " << pipelineByRValueChainCopiedTime << " ns\n";
+  std::cout << "vk::RenderingInfo:\n";
+  std::cout << "constructor              : " << renderingByConstructorTime << " ns\n";
+  std::cout << "setters on named struct  : " << renderingByLValueChainTime << " ns\n";
+  std::cout << "setters on temporary     : " << renderingByRValueChainTime << " ns\n";
+  std::cout << "setters on copied temp.  : " << renderingByRValueChainCopiedTime << " ns\n";
+  std::cout << "(checksum " << checksum << ")\n";
+  return 0;
+}
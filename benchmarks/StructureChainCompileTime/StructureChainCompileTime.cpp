@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Benchmarks : StructureChainCompileTime
+//                        Compile-time benchmark of vk::StructureChain on long feature query chains. This file is built twice, as
+//                        StructureChainCompileTime_Cpp11 (recursive helper templates) and StructureChainCompileTime_Cpp17 (fold expressions
+//                        and index tables). Compare the build times of those two targets, for example with clang's -ftime-trace.
+
+#include <iostream>
+#include <vulkan/vulkan.hpp>
+
+// every call with a different list of Features instantiates a new StructureChain, with its validation, and a get<>() per element
+template <typename... Features>
+size_t linkedElementCount()
+{
+  vk::StructureChain<vk::PhysicalDeviceFeatures2, Features...> chain;
+  vk::StructureChain<vk::PhysicalDeviceFeatures2, Features...> copy( chain );
+
+  bool   linked[] = { copy.template isLinked<Features>()... };
+  size_t count    = 1;
+  for ( bool l : linked )
+  {
+    count += l ? 1 : 0;
+  }
+  chain.template unlink<typename std::tuple_element<1, std::tuple<Features...>>::type>();
+  return count;
+}
+
+int main()
+{
+  size_t counts[] = {
+    // 25 elements following the head
+    linkedElementCount<vk::PhysicalDeviceVulkan11Features,
+                       vk::PhysicalDeviceVulkan12Features,
+                       vk::PhysicalDeviceVulkan13Features,
+                       vk::PhysicalDeviceVulkan14Features,
+                       vk::PhysicalDevice16BitStorageFeatures,
+                       vk::PhysicalDevice8BitStorageFeatures,
+                       vk::PhysicalDeviceShaderFloat16Int8Features,
+                       vk::PhysicalDeviceDescriptorIndexingFeatures,
+                       vk::PhysicalDeviceBufferDeviceAddressFeatures,
+                       vk::PhysicalDeviceTimelineSemaphoreFeatures,
+                       vk::PhysicalDeviceScalarBlockLayoutFeatures,
+                       vk::PhysicalDeviceUniformBufferStandardLayoutFeatures,
+                       vk::PhysicalDeviceVulkanMemoryModelFeatures,
+                       vk::PhysicalDeviceHostQueryResetFeatures,
+                       vk::PhysicalDeviceImagelessFramebufferFeatures,
+                       vk::PhysicalDeviceSeparateDepthStencilLayoutsFeatures,
+                       vk::PhysicalDeviceShaderSubgroupExtendedTypesFeatures,
+                       vk::PhysicalDeviceShaderAtomicInt64Features,
+                       vk::PhysicalDeviceSamplerYcbcrConversionFeatures,
+                       vk::PhysicalDeviceMultiviewFeatures,
+                       vk::PhysicalDeviceVariablePointersFeatures,
+                       vk::PhysicalDeviceProtectedMemoryFeatures,
+                       vk::PhysicalDeviceShaderDrawParametersFeatures,
+                       vk::PhysicalDeviceDynamicRenderingFeatures,
+                       vk::PhysicalDeviceSynchronization2Features>(),
+    // the same elements in reversed order
+    linkedElementCount<vk::PhysicalDeviceSynchronization2Features,
+                       vk::PhysicalDeviceDynamicRenderingFeatures,
+                       vk::PhysicalDeviceShaderDrawParametersFeatures,
+                       vk::PhysicalDeviceProtectedMemoryFeatures,
+                       vk::PhysicalDeviceVariablePointersFeatures,
+                       vk::PhysicalDeviceMultiviewFeatures,
+                       vk::PhysicalDeviceSamplerYcbcrConversionFeatures,
+                       vk::PhysicalDeviceShaderAtomicInt64Features,
+                       vk::PhysicalDeviceShaderSubgroupExtendedTypesFeatures,
+                       vk::PhysicalDeviceSeparateDepthStencilLayoutsFeatures,
+                       vk::PhysicalDeviceImagelessFramebufferFeatures,
+                       vk::PhysicalDeviceHostQueryResetFeatures,
+                       vk::PhysicalDeviceVulkanMemoryModelFeatures,
+                       vk::PhysicalDeviceUniformBufferStandardLayoutFeatures,
+                       vk::PhysicalDeviceScalarBlockLayoutFeatures,
+                       vk::PhysicalDeviceTimelineSemaphoreFeatures,
+                       vk::PhysicalDeviceBufferDeviceAddressFeatures,
+                       vk::PhysicalDeviceDescriptorIndexingFeatures,
+                       vk::PhysicalDeviceShaderFloat16Int8Features,
+                       vk::PhysicalDevice8BitStorageFeatures,
+                       vk::PhysicalDevice16BitStorageFeatures,
+                       vk::PhysicalDeviceVulkan14Features,
+                       vk::PhysicalDeviceVulkan13Features,
+                       vk::PhysicalDeviceVulkan12Features,
+                       vk::PhysicalDeviceVulkan11Features>(),
+    // 20 elements following the head
+    linkedElementCount<vk::PhysicalDeviceVulkan11Features,
+                       vk::PhysicalDeviceVulkan12Features,
+                       vk::PhysicalDeviceVulkan13Features,
+                       vk::PhysicalDeviceVulkan14Features,
+                       vk::PhysicalDevice16BitStorageFeatures,
+                       vk::PhysicalDevice8BitStorageFeatures,
+                       vk::PhysicalDeviceShaderFloat16Int8Features,
+                       vk::PhysicalDeviceDescriptorIndexingFeatures,
+                       vk::PhysicalDeviceBufferDeviceAddressFeatures,
+                       vk::PhysicalDeviceTimelineSemaphoreFeatures,
+                       vk::PhysicalDeviceScalarBlockLayoutFeatures,
+                       vk::PhysicalDeviceUniformBufferStandardLayoutFeatures,
+                       vk::PhysicalDeviceVulkanMemoryModelFeatures,
+                       vk::PhysicalDeviceHostQueryResetFeatures,
+                       vk::PhysicalDeviceImagelessFramebufferFeatures,
+                       vk::PhysicalDeviceSeparateDepthStencilLayoutsFeatures,
+                       vk::PhysicalDeviceShaderSubgroupExtendedTypesFeatures,
+                       vk::PhysicalDeviceShaderAtomicInt64Features,
+                       vk::PhysicalDeviceSamplerYcbcrConversionFeatures,
+                       vk::PhysicalDeviceMultiviewFeatures>(),
+    // 15 elements following the head
+    linkedElementCount<vk::PhysicalDeviceVariablePointersFeatures,
+                       vk::PhysicalDeviceProtectedMemoryFeatures,
+                       vk::PhysicalDeviceShaderDrawParametersFeatures,
+                       vk::PhysicalDeviceDynamicRenderingFeatures,
+                       vk::PhysicalDeviceSynchronization2Features,
+                       vk::PhysicalDeviceMaintenance4Features,
+                       vk::PhysicalDeviceVulkan11Features,
+                       vk::PhysicalDeviceVulkan12Features,
+                       vk::PhysicalDeviceVulkan13Features,
+                       vk::PhysicalDeviceVulkan14Features,
+                       vk::PhysicalDevice16BitStorageFeatures,
+                       vk::PhysicalDevice8BitStorageFeatures,
+                       vk::PhysicalDeviceShaderFloat16Int8Features,
+                       vk::PhysicalDeviceDescriptorIndexingFeatures,
+                       vk::PhysicalDeviceBufferDeviceAddressFeatures>()
+  };
+
+  std::cout << "C++ " << VULKAN_HPP_CPP_VERSION << ", linked elements per chain:";
+  for ( size_t count : counts )
+  {
+    std::cout << " " << count;
+  }
+  std::cout << "\n";
+  return 0;
+}
@@ -0,0 +1,250 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Benchmarks : SubmitBatcher
+//                        Multi-threaded queue submission, with vk::raii::su::SubmitBatcher versus each thread calling vk::raii::Queue::submit2
+//                        under a mutex, against the null driver with vkQueueSubmit2 replaced by a stub counting and checking the submissions
+
+#include "../../RAII_Samples/utils/submitBatcher.hpp"
+#include "../../tests/null_driver_fixture.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+const uint32_t ThreadCount             = 4;
+const uint32_t FrameCount              = 2000;
+const uint32_t SubmissionsPerThread    = 16;
+const uint32_t SignalingSubmissionStep = 8;  // every eighth submission of a thread signals that thread's timeline semaphore
+
+namespace counting
+{
+  uint64_t submitCallCount    = 0;
+  uint64_t submitInfoCount    = 0;
+  uint64_t commandBufferCount = 0;
+  uint64_t orderViolations    = 0;
+
+  // the command buffers are fake handles, encoding the submitting thread and the per-thread submission index
+  uint64_t lastSubmitted[ThreadCount];
+
+  VKAPI_ATTR VkResult VKAPI_CALL queueSubmit2( VkQueue, uint32_t submitCount, VkSubmitInfo2 const * pSubmits, VkFence )
+  {
+    ++submitCallCount;
+    submitInfoCount += submitCount;
+    for ( uint32_t i = 0; i < submitCount; ++i )
+    {
+      for ( uint32_t j = 0; j < pSubmits[i].commandBufferInfoCount; ++j )
+      {
+        uint64_t value       = static_cast<uint64_t>( reinterpret_cast<uintptr_t>( pSubmits[i].pCommandBufferInfos[j].commandBuffer ) );
+        uint32_t threadIndex = static_cast<uint32_t>( value >> 32 );
+        if ( value <= lastSubmitted[threadIndex] )
+        {
+          ++orderViolations;
+        }
+        lastSubmitted[threadIndex] = value;
+        ++commandBufferCount;
+      }
+    }
+    return VK_SUCCESS;
+  }
+
+  void install()
+  {
+    fixture::addOverride( "vkQueueSubmit2", &queueSubmit2 );
+  }
+
+  void reset()
+  {
+    submitCallCount = submitInfoCount = commandBufferCount = orderViolations = 0;
+    for ( uint32_t t = 0; t < ThreadCount; ++t )
+    {
+      lastSubmitted[t] = static_cast<uint64_t>( t ) << 32;
+    }
+  }
+}  // namespace counting
+
+vk::CommandBuffer makeCommandBuffer( uint32_t threadIndex, uint64_t submissionIndex )
+{
+  return vk::CommandBuffer( reinterpret_cast<VkCommandBuffer>( static_cast<uintptr_t>( ( static_cast<uint64_t>( threadIndex ) << 32 ) | submissionIndex ) ) );
+}
+
+std::vector<vk::raii::Semaphore> makeTimelineSemaphores( vk::raii::Device const & device )
+{
+  vk::StructureChain<vk::SemaphoreCreateInfo, vk::SemaphoreTypeCreateInfo> semaphoreCreateInfo( {}, { vk::SemaphoreType::eTimeline, 0 } );
+  std::vector<vk::raii::Semaphore>                                         semaphores;
+  for ( uint32_t t = 0; t < ThreadCount; ++t )
+  {
+    semaphores.push_back( vk::raii::Semaphore( device, semaphoreCreateInfo.get<vk::SemaphoreCreateInfo>() ) );
+  }
+  return semaphores;
+}
+
+// a simple spinning barrier, to keep thread synchronization out of the measurements as far as possible
+class SpinBarrier
+{
+public:
+  SpinBarrier( uint32_t threadCount ) : m_threadCount( threadCount ) {}
+
+  void wait()
+  {
+    uint32_t generation = m_generation.load( std::memory_order_acquire );
+    if ( m_arrived.fetch_add( 1, std::memory_order_acq_rel ) + 1 == m_threadCount )
+    {
+      m_arrived.store( 0, std::memory_order_relaxed );
+      m_generation.fetch_add( 1, std::memory_order_acq_rel );
+    }
+    else
+    {
+      while ( m_generation.load( std::memory_order_acquire ) == generation )
+      {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+private:
+  uint32_t              m_threadCount;
+  std::atomic<uint32_t> m_arrived{ 0 };
+  std::atomic<uint32_t> m_generation{ 0 };
+};
+
+template <typename FrameFunc>
+double runThreads( FrameFunc const & frameFunc )
+{
+  counting::reset();
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+  std::vector<std::thread> threads;
+  for ( uint32_t t = 1; t < ThreadCount; ++t )
+  {
+    threads.push_back( std::thread( frameFunc, t ) );
+  }
+  frameFunc( 0 );
+  for ( auto & thread : threads )
+  {
+    thread.join();
+  }
+
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::high_resolution_clock::now() - start;
+  return elapsed.count() / ( FrameCount * ThreadCount * SubmissionsPerThread );
+}
+
+void report( char const * name, double time )
+{
+  std::cout << name << time << " ns per submission, " << counting::submitCallCount << " calls to vkQueueSubmit2 with " << counting::submitInfoCount
+            << " VkSubmitInfo2 and " << counting::commandBufferCount << " command buffers, " << counting::orderViolations << " order violations\n";
+}
+
+double benchmarkSubmitBatcher( vk::raii::Device const & device, vk::raii::Queue const & queue )
+{
+  vk::raii::su::SubmitBatcher      submitBatcher( queue, ThreadCount );
+  std::vector<vk::raii::Semaphore> timelines = makeTimelineSemaphores( device );
+  vk::raii::Fence                  fence( device, vk::FenceCreateInfo() );
+  SpinBarrier                      barrier( ThreadCount );
+
+  return runThreads(
+    [&]( uint32_t threadIndex )
+    {
+      uint64_t submissionIndex = 0;
+      uint64_t timelineValue   = 0;
+      for ( uint32_t frame = 0; frame < FrameCount; ++frame )
+      {
+        for ( uint32_t i = 0; i < SubmissionsPerThread; ++i )
+        {
+          vk::CommandBufferSubmitInfo commandBufferSubmitInfo( makeCommandBuffer( threadIndex, ++submissionIndex ) );
+          if ( ( i + 1 ) % SignalingSubmissionStep == 0 )
+          {
+            vk::SemaphoreSubmitInfo signalInfo( *timelines[threadIndex], ++timelineValue, vk::PipelineStageFlagBits2::eAllCommands );
+            submitBatcher.enqueue( threadIndex, commandBufferSubmitInfo, nullptr, signalInfo );
+          }
+          else
+          {
+            submitBatcher.enqueue( threadIndex, commandBufferSubmitInfo );
+          }
+        }
+        barrier.wait();
+
+        if ( threadIndex == 0 )
+        {
+          submitBatcher.flush( *fence );
+        }
+        barrier.wait();
+      }
+    } );
+}
+
+double benchmarkLockedSubmit( vk::raii::Device const & device, vk::raii::Queue const & queue )
+{
+  // the straight-forward approach: each thread submits on its own, serialized by a mutex, as vkQueueSubmit2 requires external synchronization
+  std::vector<vk::raii::Semaphore> timelines = makeTimelineSemaphores( device );
+  vk::raii::Fence                  fence( device, vk::FenceCreateInfo() );
+  SpinBarrier                      barrier( ThreadCount );
+  std::mutex                       queueMutex;
+
+  return runThreads(
+    [&]( uint32_t threadIndex )
+    {
+      uint64_t submissionIndex = 0;
+      uint64_t timelineValue   = 0;
+      for ( uint32_t frame = 0; frame < FrameCount; ++frame )
+      {
+        for ( uint32_t i = 0; i < SubmissionsPerThread; ++i )
+        {
+          vk::CommandBufferSubmitInfo commandBufferSubmitInfo( makeCommandBuffer( threadIndex, ++submissionIndex ) );
+          vk::SubmitInfo2             submitInfo( {}, {}, commandBufferSubmitInfo );
+          vk::SemaphoreSubmitInfo     signalInfo( *timelines[threadIndex], 0, vk::PipelineStageFlagBits2::eAllCommands );
+          if ( ( i + 1 ) % SignalingSubmissionStep == 0 )
+          {
+            signalInfo.value = ++timelineValue;
+            submitInfo.setSignalSemaphoreInfos( signalInfo );
+          }
+
+          std::lock_guard<std::mutex> guard( queueMutex );
+          queue.submit2( submitInfo );
+        }
+        barrier.wait();
+
+        if ( threadIndex == 0 )
+        {
+          queue.submit2( nullptr, *fence );
+        }
+        barrier.wait();
+      }
+    } );
+}
+
+int main()
+{
+  try
+  {
+    counting::install();
+
+    fixture::NullDevice nullDevice;
+
+    std::cout << "threads: " << ThreadCount << ", frames: " << FrameCount << ", submissions per thread and frame: " << SubmissionsPerThread
+              << ", every " << SignalingSubmissionStep << "th submission signals a timeline semaphore\n";
+    double time = benchmarkSubmitBatcher( nullDevice.device, nullDevice.queue );
+    report( "SubmitBatcher         : ", time );
+    time = benchmarkLockedSubmit( nullDevice.device, nullDevice.queue );
+    report( "submit2 under a mutex : ", time );
+  }
+  catch ( vk::SystemError & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+  return 0;
+}
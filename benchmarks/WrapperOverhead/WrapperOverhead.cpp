@@ -0,0 +1,441 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Benchmarks : WrapperOverhead
+//                        The overhead of vk:: (with static and dynamic dispatch), vk::raii::, vk::UniqueHandle, and vk::SharedHandle compared to
+//                        the C API, measured against the null driver with the few commands used here replaced by counting stubs.
+//                        Usage: WrapperOverhead [--csv | --json]
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <vulkan/vulkan_null_driver.hpp>
+#include <vulkan/vulkan_raii.hpp>
+#include <vulkan/vulkan_shared.hpp>
+VULKAN_HPP_DEFAULT_DISPATCH_LOADER_DYNAMIC_STORAGE
+
+namespace counting
+{
+  // the commands measured here just count their calls, such that each variant of a scenario can be checked to reach the driver equally often
+  uint64_t callCount = 0;
+
+  VKAPI_ATTR void VKAPI_CALL cmdBindPipeline( VkCommandBuffer, VkPipelineBindPoint, VkPipeline )
+  {
+    ++callCount;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL cmdBindVertexBuffers( VkCommandBuffer, uint32_t, uint32_t, VkBuffer const *, VkDeviceSize const * )
+  {
+    ++callCount;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL cmdDraw( VkCommandBuffer, uint32_t, uint32_t, uint32_t, uint32_t )
+  {
+    ++callCount;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL createBuffer( VkDevice, VkBufferCreateInfo const *, VkAllocationCallbacks const *, VkBuffer * pBuffer )
+  {
+    ++callCount;
+    *pBuffer = vk::detail::NullDriver::nextHandle<VkBuffer>();
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL destroyBuffer( VkDevice, VkBuffer, VkAllocationCallbacks const * )
+  {
+    ++callCount;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL getFenceStatus( VkDevice, VkFence )
+  {
+    ++callCount;
+    return VK_NOT_READY;
+  }
+
+  uint32_t const PhysicalDeviceCount = 4;
+
+  VKAPI_ATTR VkResult VKAPI_CALL enumeratePhysicalDevices( VkInstance, uint32_t * pPhysicalDeviceCount, VkPhysicalDevice * pPhysicalDevices )
+  {
+    ++callCount;
+    if ( pPhysicalDevices )
+    {
+      uint32_t count = ( std::min )( *pPhysicalDeviceCount, PhysicalDeviceCount );
+      for ( uint32_t i = 0; i < count; ++i )
+      {
+        pPhysicalDevices[i] = reinterpret_cast<VkPhysicalDevice>( static_cast<uintptr_t>( i + 1 ) );
+      }
+      *pPhysicalDeviceCount = count;
+      return ( count < PhysicalDeviceCount ) ? VK_INCOMPLETE : VK_SUCCESS;
+    }
+    *pPhysicalDeviceCount = PhysicalDeviceCount;
+    return VK_SUCCESS;
+  }
+
+  void install()
+  {
+    std::vector<std::pair<std::string, PFN_vkVoidFunction>> & overrides = vk::detail::NullDriver::configuration().overrides;
+    overrides.emplace_back( "vkCmdBindPipeline", reinterpret_cast<PFN_vkVoidFunction>( &cmdBindPipeline ) );
+    overrides.emplace_back( "vkCmdBindVertexBuffers", reinterpret_cast<PFN_vkVoidFunction>( &cmdBindVertexBuffers ) );
+    overrides.emplace_back( "vkCmdDraw", reinterpret_cast<PFN_vkVoidFunction>( &cmdDraw ) );
+    overrides.emplace_back( "vkCreateBuffer", reinterpret_cast<PFN_vkVoidFunction>( &createBuffer ) );
+    overrides.emplace_back( "vkDestroyBuffer", reinterpret_cast<PFN_vkVoidFunction>( &destroyBuffer ) );
+    overrides.emplace_back( "vkGetFenceStatus", reinterpret_cast<PFN_vkVoidFunction>( &getFenceStatus ) );
+    overrides.emplace_back( "vkEnumeratePhysicalDevices", reinterpret_cast<PFN_vkVoidFunction>( &enumeratePhysicalDevices ) );
+  }
+}  // namespace counting
+
+// A dispatcher binding the commands at compile time, just like vk::detail::DispatchLoaderStatic does with the prototypes of the loader.
+class StaticDispatcher : public vk::detail::DispatchLoaderBase
+{
+public:
+  void vkCmdBindPipeline( VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline ) const VULKAN_HPP_NOEXCEPT
+  {
+    counting::cmdBindPipeline( commandBuffer, pipelineBindPoint, pipeline );
+  }
+
+  void vkCmdBindVertexBuffers( VkCommandBuffer      commandBuffer,
+                               uint32_t             firstBinding,
+                               uint32_t             bindingCount,
+                               VkBuffer const *     pBuffers,
+                               VkDeviceSize const * pOffsets ) const VULKAN_HPP_NOEXCEPT
+  {
+    counting::cmdBindVertexBuffers( commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets );
+  }
+
+  void vkCmdDraw( VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance ) const
+    VULKAN_HPP_NOEXCEPT
+  {
+    counting::cmdDraw( commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance );
+  }
+
+  VkResult vkCreateBuffer( VkDevice device, VkBufferCreateInfo const * pCreateInfo, VkAllocationCallbacks const * pAllocator, VkBuffer * pBuffer ) const
+    VULKAN_HPP_NOEXCEPT
+  {
+    return counting::createBuffer( device, pCreateInfo, pAllocator, pBuffer );
+  }
+
+  void vkDestroyBuffer( VkDevice device, VkBuffer buffer, VkAllocationCallbacks const * pAllocator ) const VULKAN_HPP_NOEXCEPT
+  {
+    counting::destroyBuffer( device, buffer, pAllocator );
+  }
+
+  VkResult vkGetFenceStatus( VkDevice device, VkFence fence ) const VULKAN_HPP_NOEXCEPT
+  {
+    return counting::getFenceStatus( device, fence );
+  }
+
+  VkResult vkEnumeratePhysicalDevices( VkInstance instance, uint32_t * pPhysicalDeviceCount, VkPhysicalDevice * pPhysicalDevices ) const VULKAN_HPP_NOEXCEPT
+  {
+    return counting::enumeratePhysicalDevices( instance, pPhysicalDeviceCount, pPhysicalDevices );
+  }
+};
+
+struct Result
+{
+  std::string scenario;
+  std::string variant;
+  double      nsPerOp;
+  double      callsPerOp;
+};
+
+// keeps the compiler from optimizing away what's measured
+volatile uint64_t sink = 0;
+
+const uint32_t IterationCount  = 200000;
+const uint32_t RepetitionCount = 5;
+
+template <typename Func>
+Result measure( std::string const & scenario, std::string const & variant, Func const & func )
+{
+  func();  // warm up
+
+  double   bestNs     = std::numeric_limits<double>::max();
+  uint64_t firstCount = counting::callCount;
+  for ( uint32_t r = 0; r < RepetitionCount; ++r )
+  {
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+    for ( uint32_t i = 0; i < IterationCount; ++i )
+    {
+      func();
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::high_resolution_clock::now() - start;
+    bestNs                                           = ( std::min )( bestNs, elapsed.count() / IterationCount );
+  }
+  return Result{ scenario, variant, bestNs, double( counting::callCount - firstCount ) / ( RepetitionCount * IterationCount ) };
+}
+
+void printText( std::vector<Result> const & results )
+{
+  std::string scenario;
+  for ( auto const & result : results )
+  {
+    if ( result.scenario != scenario )
+    {
+      scenario = result.scenario;
+      std::cout << scenario << "\n";
+    }
+    std::cout << "  " << std::left << std::setw( 22 ) << result.variant << std::right << std::fixed << std::setprecision( 2 ) << std::setw( 10 )
+              << result.nsPerOp << " ns/op" << std::setw( 8 ) << result.callsPerOp << " calls/op\n";
+  }
+}
+
+void printCsv( std::vector<Result> const & results )
+{
+  std::cout << "scenario,variant,ns_per_op,calls_per_op\n";
+  for ( auto const & result : results )
+  {
+    std::cout << result.scenario << "," << result.variant << "," << result.nsPerOp << "," << result.callsPerOp << "\n";
+  }
+}
+
+void printJson( std::vector<Result> const & results )
+{
+  std::cout << "{\n  \"header_version\": " << VK_HEADER_VERSION << ",\n  \"iterations\": " << IterationCount << ",\n  \"results\": [\n";
+  for ( size_t i = 0; i < results.size(); ++i )
+  {
+    std::cout << "    { \"scenario\": \"" << results[i].scenario << "\", \"variant\": \"" << results[i].variant << "\", \"ns_per_op\": " << results[i].nsPerOp
+              << ", \"calls_per_op\": " << results[i].callsPerOp << " }" << ( ( i + 1 < results.size() ) ? "," : "" ) << "\n";
+  }
+  std::cout << "  ]\n}\n";
+}
+
+int main( int argc, char ** argv )
+{
+  try
+  {
+    std::string format = ( 1 < argc ) ? argv[1] : "";
+    if ( !format.empty() && ( format != "--csv" ) && ( format != "--json" ) )
+    {
+      std::cout << "usage: " << argv[0] << " [--csv | --json]\n";
+      return 1;
+    }
+
+    counting::install();
+    StaticDispatcher staticDispatcher;
+
+    // vk:: with the default dispatcher
+    vk::detail::defaultDispatchLoaderDynamic.init( &vk::detail::NullDriver::getInstanceProcAddr );
+    vk::Instance instance = vk::createInstance( vk::InstanceCreateInfo() );
+    vk::detail::defaultDispatchLoaderDynamic.init( instance );
+    vk::PhysicalDevice physicalDevice = instance.enumeratePhysicalDevices().front();
+
+    float                     queuePriority = 0.0f;
+    vk::DeviceQueueCreateInfo deviceQueueCreateInfo( {}, 0, 1, &queuePriority );
+    vk::SharedDevice          sharedDevice( physicalDevice.createDevice( vk::DeviceCreateInfo( {}, deviceQueueCreateInfo ) ) );
+    vk::Device                device = sharedDevice.get();
+    vk::detail::defaultDispatchLoaderDynamic.init( device );
+
+    vk::CommandPool   commandPool = device.createCommandPool( vk::CommandPoolCreateInfo() );
+    vk::CommandBuffer commandBuffer =
+      device.allocateCommandBuffers( vk::CommandBufferAllocateInfo( commandPool, vk::CommandBufferLevel::ePrimary, 1 ) ).front();
+    vk::Pipeline pipeline = device.createGraphicsPipeline( nullptr, vk::GraphicsPipelineCreateInfo() ).value;
+    vk::Buffer   vertexBuffer( vk::detail::NullDriver::nextHandle<VkBuffer>() );
+    vk::Fence    fence = device.createFence( vk::FenceCreateInfo() );
+
+    // vk::raii::
+    vk::raii::Context         context( &vk::detail::NullDriver::getInstanceProcAddr );
+    vk::raii::Instance        raiiInstance( context, vk::InstanceCreateInfo() );
+    vk::raii::PhysicalDevices raiiPhysicalDevices( raiiInstance );
+    vk::raii::Device          raiiDevice( raiiPhysicalDevices[0], vk::DeviceCreateInfo( {}, deviceQueueCreateInfo ) );
+    vk::raii::CommandPool     raiiCommandPool( raiiDevice, vk::CommandPoolCreateInfo() );
+    vk::raii::CommandBuffer   raiiCommandBuffer =
+      std::move( vk::raii::CommandBuffers( raiiDevice, vk::CommandBufferAllocateInfo( *raiiCommandPool, vk::CommandBufferLevel::ePrimary, 1 ) ).front() );
+    vk::raii::Fence           raiiFence( raiiDevice, vk::FenceCreateInfo() );
+
+    // the C API, through the function pointers a loader would provide
+    vk::detail::DispatchLoaderDynamic const & d                 = vk::detail::defaultDispatchLoaderDynamic;
+    VkCommandBuffer                           cCommandBuffer    = commandBuffer;
+    VkPipeline                                cPipeline         = pipeline;
+    VkBuffer                                  cVertexBuffer     = vertexBuffer;
+    VkDeviceSize                              cOffset           = 0;
+    vk::BufferCreateInfo                      bufferCreateInfo( {}, 256, vk::BufferUsageFlagBits::eVertexBuffer );
+    VkBufferCreateInfo const &                cBufferCreateInfo = bufferCreateInfo;
+
+    std::vector<Result> results;
+
+    // command recording: binding a pipeline and a vertex buffer, and drawing
+    char const * recording = "command recording";
+    results.push_back( measure( recording,
+                                "C API",
+                                [&]()
+                                {
+                                  d.vkCmdBindPipeline( cCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, cPipeline );
+                                  d.vkCmdBindVertexBuffers( cCommandBuffer, 0, 1, &cVertexBuffer, &cOffset );
+                                  d.vkCmdDraw( cCommandBuffer, 3, 1, 0, 0 );
+                                } ) );
+    results.push_back( measure( recording,
+                                "vk:: static dispatch",
+                                [&]()
+                                {
+                                  commandBuffer.bindPipeline( vk::PipelineBindPoint::eGraphics, pipeline, staticDispatcher );
+                                  commandBuffer.bindVertexBuffers( 0, vertexBuffer, { 0 }, staticDispatcher );
+                                  commandBuffer.draw( 3, 1, 0, 0, staticDispatcher );
+                                } ) );
+    results.push_back( measure( recording,
+                                "vk:: dynamic dispatch",
+                                [&]()
+                                {
+                                  commandBuffer.bindPipeline( vk::PipelineBindPoint::eGraphics, pipeline );
+                                  commandBuffer.bindVertexBuffers( 0, vertexBuffer, { 0 } );
+                                  commandBuffer.draw( 3, 1, 0, 0 );
+                                } ) );
+    results.push_back( measure( recording,
+                                "vk::raii",
+                                [&]()
+                                {
+                                  raiiCommandBuffer.bindPipeline( vk::PipelineBindPoint::eGraphics, pipeline );
+                                  raiiCommandBuffer.bindVertexBuffers( 0, vertexBuffer, { 0 } );
+                                  raiiCommandBuffer.draw( 3, 1, 0, 0 );
+                                } ) );
+
+    // handle churn: creating and destroying a buffer
+    char const * churn = "handle churn";
+    results.push_back( measure( churn,
+                                "C API",
+                                [&]()
+                                {
+                                  VkBuffer buffer;
+                                  d.vkCreateBuffer( device, &cBufferCreateInfo, nullptr, &buffer );
+                                  d.vkDestroyBuffer( device, buffer, nullptr );
+                                } ) );
+    results.push_back(
+      measure( churn,
+               "vk:: static dispatch",
+               [&]() { device.destroyBuffer( device.createBuffer( bufferCreateInfo, nullptr, staticDispatcher ), nullptr, staticDispatcher ); } ) );
+    results.push_back( measure( churn, "vk:: dynamic dispatch", [&]() { device.destroyBuffer( device.createBuffer( bufferCreateInfo ) ); } ) );
+    results.push_back( measure( churn, "vk::UniqueHandle", [&]() { vk::UniqueBuffer buffer = device.createBufferUnique( bufferCreateInfo ); } ) );
+    results.push_back(
+      measure( churn, "vk::SharedHandle", [&]() { vk::SharedBuffer buffer( device.createBuffer( bufferCreateInfo ), sharedDevice ); } ) );
+    results.push_back( measure( churn, "vk::raii", [&]() { vk::raii::Buffer buffer( raiiDevice, bufferCreateInfo ); } ) );
+
+    // result checks: polling a fence, that is not ready, with two success codes to check against
+    char const * resultCheck = "result check";
+    results.push_back( measure( resultCheck, "C API", [&]() { sink = sink + ( d.vkGetFenceStatus( device, fence ) == VK_NOT_READY ); } ) );
+    results.push_back( measure(
+      resultCheck, "vk:: static dispatch", [&]() { sink = sink + ( device.getFenceStatus( fence, staticDispatcher ) == vk::Result::eNotReady ); } ) );
+    results.push_back( measure( resultCheck, "vk:: dynamic dispatch", [&]() { sink = sink + ( device.getFenceStatus( fence ) == vk::Result::eNotReady ); } ) );
+    results.push_back( measure( resultCheck, "vk::raii", [&]() { sink = sink + ( raiiFence.getStatus() == vk::Result::eNotReady ); } ) );
+
+    // enumerations: getting all physical devices with the two-call idiom
+    char const * enumeration = "enumeration";
+    results.push_back( measure( enumeration,
+                                "C API",
+                                [&]()
+                                {
+                                  uint32_t         count;
+                                  VkPhysicalDevice physicalDevices[counting::PhysicalDeviceCount];
+                                  d.vkEnumeratePhysicalDevices( instance, &count, nullptr );
+                                  d.vkEnumeratePhysicalDevices( instance, &count, physicalDevices );
+                                  sink = sink + count;
+                                } ) );
+    results.push_back( measure( enumeration,
+                                "vk:: static dispatch",
+                                [&]() { sink = sink + instance.enumeratePhysicalDevices( staticDispatcher ).size(); } ) );
+    results.push_back( measure( enumeration, "vk:: dynamic dispatch", [&]() { sink = sink + instance.enumeratePhysicalDevices().size(); } ) );
+    results.push_back( measure( enumeration, "vk::raii", [&]() { sink = sink + vk::raii::PhysicalDevices( raiiInstance ).size(); } ) );
+
+    // struct construction: a DeviceCreateInfo with a chain of feature structures
+    char const * construction = "struct construction";
+    results.push_back( measure( construction,
+                                "C API",
+                                [&]()
+                                {
+                                  VkPhysicalDeviceVulkan12Features vulkan12Features;
+                                  memset( &vulkan12Features, 0, sizeof( vulkan12Features ) );
+                                  vulkan12Features.sType               = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+                                  vulkan12Features.timelineSemaphore   = VK_TRUE;
+                                  VkPhysicalDeviceVulkan11Features vulkan11Features;
+                                  memset( &vulkan11Features, 0, sizeof( vulkan11Features ) );
+                                  vulkan11Features.sType                = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES;
+                                  vulkan11Features.pNext                = &vulkan12Features;
+                                  vulkan11Features.shaderDrawParameters = VK_TRUE;
+                                  VkPhysicalDeviceFeatures2 features2;
+                                  memset( &features2, 0, sizeof( features2 ) );
+                                  features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+                                  features2.pNext = &vulkan11Features;
+                                  VkDeviceCreateInfo deviceCreateInfo;
+                                  memset( &deviceCreateInfo, 0, sizeof( deviceCreateInfo ) );
+                                  deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+                                  deviceCreateInfo.pNext = &features2;
+                                  sink                   = sink + reinterpret_cast<VkPhysicalDeviceVulkan12Features const *>(
+                                                    reinterpret_cast<VkPhysicalDeviceVulkan11Features const *>(
+                                                      reinterpret_cast<VkPhysicalDeviceFeatures2 const *>( deviceCreateInfo.pNext )->pNext )
+                                                      ->pNext )
+                                                    ->timelineSemaphore;
+                                } ) );
+    results.push_back( measure( construction,
+                                "vk:: constructors",
+                                [&]()
+                                {
+                                  vk::PhysicalDeviceVulkan12Features vulkan12Features;
+                                  vulkan12Features.timelineSemaphore = true;
+                                  vk::PhysicalDeviceVulkan11Features vulkan11Features;
+                                  vulkan11Features.pNext                = &vulkan12Features;
+                                  vulkan11Features.shaderDrawParameters = true;
+                                  vk::PhysicalDeviceFeatures2 features2( {}, &vulkan11Features );
+                                  vk::DeviceCreateInfo        deviceCreateInfo( {}, {}, {}, {}, nullptr, &features2 );
+                                  sink = sink + static_cast<vk::PhysicalDeviceVulkan12Features const *>(
+                                                  static_cast<vk::PhysicalDeviceVulkan11Features const *>(
+                                                    static_cast<vk::PhysicalDeviceFeatures2 const *>( deviceCreateInfo.pNext )->pNext )
+                                                    ->pNext )
+                                                  ->timelineSemaphore;
+                                } ) );
+    results.push_back( measure( construction,
+                                "vk::StructureChain",
+                                [&]()
+                                {
+                                  vk::StructureChain<vk::DeviceCreateInfo,
+                                                     vk::PhysicalDeviceFeatures2,
+                                                     vk::PhysicalDeviceVulkan11Features,
+                                                     vk::PhysicalDeviceVulkan12Features>
+                                    structureChain;
+                                  structureChain.get<vk::PhysicalDeviceVulkan11Features>().shaderDrawParameters = true;
+                                  structureChain.get<vk::PhysicalDeviceVulkan12Features>().timelineSemaphore    = true;
+                                  sink = sink + static_cast<vk::PhysicalDeviceVulkan12Features const *>(
+                                                  static_cast<vk::PhysicalDeviceVulkan11Features const *>(
+                                                    static_cast<vk::PhysicalDeviceFeatures2 const *>( structureChain.get().pNext )->pNext )
+                                                    ->pNext )
+                                                  ->timelineSemaphore;
+                                } ) );
+
+    device.destroyFence( fence );
+    device.destroyPipeline( pipeline );
+    device.destroyCommandPool( commandPool );
+    sharedDevice.reset();
+    instance.destroy();
+
+    if ( format == "--csv" )
+    {
+      printCsv( results );
+    }
+    else if ( format == "--json" )
+    {
+      printJson( results );
+    }
+    else
+    {
+      printText( results );
+    }
+  }
+  catch ( vk::SystemError & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+  return 0;
+}
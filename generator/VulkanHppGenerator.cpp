@@ -7,9 +7,11 @@
 #include <array>
 #include <cassert>
 #include <fstream>
+#include <format>
 #include <future>
 #include <numeric>
 #include <regex>
+#include <utility>
 
 using namespace std::literals;
 
@@ -728,6 +730,14 @@ void VulkanHppGenerator::generateExtensionInspectionFile() const
                                      []( ExtensionData const & extension ) { return extension.deprecatedBy; } ) },
       { "deprecatedTest", generateExtensionReplacedTest( []( ExtensionData const & extension ) { return extension.isDeprecated; } ) },
       { "extensionDependencies", generateExtensionDependencies() },
+      { "extensionDependencyTable",
+        generateExtensionsTable( [this]( ExtensionData const & extension ) { return generateExtensionDependencyTable( extension ); } ) },
+      { "extensionIds", generateExtensionsTable( [this]( ExtensionData const & extension ) { return generateExtensionId( extension.name ) + ","; } ) },
+      { "extensionNames", generateExtensionsTable( []( ExtensionData const & extension ) { return "\"" + extension.name + "\","; } ) },
+      { "extensionPromotedToApiVersions",
+        generateExtensionsTable(
+          [this]( ExtensionData const & extension )
+          { return ( containsByName( m_features, extension.promotedTo ) ? generateApiVersionMacro( extension.promotedTo ) : "0" ) + ","; } ) },
       { "instanceExtensions", generateExtensionsList( "instance" ) },
       { "instanceTest", generateExtensionTypeTest( "instance" ) },
       { "obsoletedBy",
@@ -782,6 +792,7 @@ void VulkanHppGenerator::generateHashHppFile() const
   generateFileFromTemplate( m_api + "_hash.hpp",
                             "HashHppTemplate.hpp",
                             { { "api", m_api },
+                              { "bitwiseHashableStructures", generateBitwiseHashableStructures() },
                               { "copyrightMessage", m_copyrightMessage },
                               { "handleHashStructures", generateHandleHashStructures() },
                               { "structHashStructures", generateStructHashStructures() } } );
@@ -809,12 +820,14 @@ void VulkanHppGenerator::generateHppFile() const
       { "Exchange", readSnippet( "Exchange.hpp" ) },
       { "headerVersion", m_version },
       { "includes", replaceWithMap( readSnippet( "includes.hpp" ), { { "vulkan_h", ( m_api == "vulkansc" ) ? "vulkan_sc_core.h" : ( m_api + ".h" ) } } ) },
+      { "InstrumentingDispatcher", generateInstrumentingDispatcher() },
       { "IsDispatchedList", generateIsDispatchedList() },
       { "ObjectDestroy", readSnippet( "ObjectDestroy.hpp" ) },
       { "ObjectFree", readSnippet( "ObjectFree.hpp" ) },
       { "ObjectRelease", readSnippet( "ObjectRelease.hpp" ) },
       { "Optional", readSnippet( "Optional.hpp" ) },
       { "PoolFree", readSnippet( "PoolFree.hpp" ) },
+      { "QueryResultView", readSnippet( "QueryResultView.hpp" ) },
       { "resultChecks", readSnippet( "resultChecks.hpp" ) },
       { "resultExceptions", generateResultExceptions() },
       { "structExtendsStructs", generateStructExtendsStructs() },
@@ -834,6 +847,22 @@ void VulkanHppGenerator::generateMacrosFile() const
                               { "vulkan_64_bit_ptr_defines", m_defines.at( "VK_USE_64_BIT_PTR_DEFINES" ).possibleDefinition } } );
 }
 
+void VulkanHppGenerator::generateNullDriverHppFile() const
+{
+  generateFileFromTemplate( m_api + "_null_driver.hpp",
+                            "NullDriverHppTemplate.hpp",
+                            { { "api", m_api },
+                              { "commandEntries", generateNullDriverCommandEntries() },
+                              { "copyrightMessage", m_copyrightMessage },
+                              { "handleCounts", generateNullDriverHandleCounts() },
+                              { "structureSizes", generateNullDriverStructureSizes() } } );
+}
+
+void VulkanHppGenerator::generateRAIICppFile() const
+{
+  generateFileFromTemplate( m_api + "_raii.cpp", "RAIICppTemplate.hpp", { { "api", m_api }, { "copyrightMessage", m_copyrightMessage } } );
+}
+
 void VulkanHppGenerator::generateRAIIHppFile() const
 {
   generateFileFromTemplate( m_api + "_raii.hpp",
@@ -845,6 +874,79 @@ void VulkanHppGenerator::generateRAIIHppFile() const
                               { "RAIIHandles", generateRAIIHandles() } } );
 }
 
+void VulkanHppGenerator::generateSerializeHppFile() const
+{
+  std::set<std::string> serializableStructs = determineSerializableStructs();
+
+  auto serializeDeclaration = []( std::pair<std::string, StructData> const & structure )
+  {
+    std::string structureType = stripPrefix( structure.first, "Vk" );
+    return "    void serializeStructure( Serializer & serializer, " + structureType + " const & " + startLowerCase( structureType ) + " );\n" +
+           "    void deserializeStructure( Deserializer & deserializer, " + structureType + " & " + startLowerCase( structureType ) + " );\n";
+  };
+
+  auto serializeDefinition = [this, &serializableStructs]( std::pair<std::string, StructData> const & structure )
+  {
+    static std::string const definitionTemplate = R"(
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, ${structureType} const & ${structureName} )
+    {
+${serialize}    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, ${structureType} & ${structureName} )
+    {
+${deserialize}    }
+)";
+
+    std::string structureType = stripPrefix( structure.first, "Vk" );
+    std::string structureName = startLowerCase( structureType );
+    std::string serialize, deserialize;
+    if ( std::ranges::any_of( structure.second.members, []( MemberData const & member ) { return !member.bitCount.empty(); } ) )
+    {
+      // structures with bit fields don't hold any pointers, they are just copied as a whole
+      serialize   = "      serializer.writeValue( " + structureName + " );\n";
+      deserialize = "      deserializer.readValue( " + structureName + " );\n";
+    }
+    else
+    {
+      for ( size_t i = 0; i < structure.second.members.size(); ++i )
+      {
+        auto memberCode = generateSerializeMember( structureName, structure.second.members, i, serializableStructs );
+        assert( memberCode );
+        serialize += memberCode->first;
+        deserialize += memberCode->second;
+      }
+    }
+    return replaceWithMap(
+      definitionTemplate,
+      { { "deserialize", deserialize }, { "serialize", serialize }, { "structureName", structureName }, { "structureType", structureType } } );
+  };
+
+  auto chainCase = []( bool deserialize )
+  {
+    return [deserialize]( std::pair<std::string, StructData> const & structure )
+    {
+      if ( structure.second.members.empty() || structure.second.members.front().value.empty() )
+      {
+        return std::string();
+      }
+      assert( structure.second.members.front().name == "sType" );
+      std::string structureType = stripPrefix( structure.first, "Vk" );
+      return "        case " + structureType + "::structureType: " +
+             ( deserialize ? ( "return deserializer.readChainElement<" + structureType + ">();\n" )
+                           : ( "serializer.writeChainElement( *reinterpret_cast<" + structureType + " const *>( pNext ) ); break;\n" ) );
+    };
+  };
+
+  generateFileFromTemplate( m_api + "_serialize.hpp",
+                            "SerializeHppTemplate.hpp",
+                            { { "api", m_api },
+                              { "copyrightMessage", m_copyrightMessage },
+                              { "deserializeChainCases", generateSerializeStructures( serializableStructs, chainCase( true ) ) },
+                              { "serializeChainCases", generateSerializeStructures( serializableStructs, chainCase( false ) ) },
+                              { "structureDeclarations", generateSerializeStructures( serializableStructs, serializeDeclaration ) },
+                              { "structureDefinitions", generateSerializeStructures( serializableStructs, serializeDefinition ) } } );
+}
+
 void VulkanHppGenerator::generateSharedHppFile() const
 {
   generateFileFromTemplate( m_api + "_shared.hpp",
@@ -1585,6 +1687,18 @@ bool VulkanHppGenerator::containsFloatingPoints( std::vector<MemberData> const &
                               } );
 }
 
+bool VulkanHppGenerator::containsPointer( std::string const & type ) const
+{
+  // a simple recursive check if a type contains a pointer or a funcpointer
+  auto structureIt = m_structs.find( type );
+  return ( structureIt != m_structs.end() ) && std::ranges::any_of( structureIt->second.members,
+                                                                    [this, &type]( auto const & member )
+                                                                    {
+                                                                      return member.type.isPointer() || containsByName( m_vkxml.funcPointers, member.type.name ) ||
+                                                                             ( ( member.type.name != type ) && containsPointer( member.type.name ) );
+                                                                    } );
+}
+
 bool VulkanHppGenerator::containsUnion( std::string const & type ) const
 {
   // a simple recursive check if a type is or contains a union
@@ -1610,6 +1724,93 @@ bool VulkanHppGenerator::describesVector( StructData const & structure, std::str
                               } );
 }
 
+std::pair<size_t, size_t> VulkanHppGenerator::determineBitwiseLayout( std::string const & type ) const
+{
+  // determines size and alignment of a type, if each of its values has a unique bit pattern, that is, if it holds just integral values
+  // (no floating points, no pointers, no size_t) without any padding -> such a type can be compared and hashed bitwise; returns { 0, 0 } otherwise
+  static std::map<std::string, size_t> const integralSizes = { { "int8_t", 1 },  { "int16_t", 2 },  { "int32_t", 4 },  { "int64_t", 8 },
+                                                               { "uint8_t", 1 }, { "uint16_t", 2 }, { "uint32_t", 4 }, { "uint64_t", 8 } };
+
+  if ( auto integralIt = integralSizes.find( type ); integralIt != integralSizes.end() )
+  {
+    return { integralIt->second, integralIt->second };
+  }
+
+  auto typeIt = m_types.find( type );
+  if ( typeIt != m_types.end() )
+  {
+    switch ( typeIt->second.category )
+    {
+      case TypeCategory::BaseType:
+        if ( auto baseTypeIt = findByName( m_vkxml.baseTypes, type ); ( baseTypeIt != m_vkxml.baseTypes.end() ) && baseTypeIt->type.postfix.empty() )
+        {
+          return determineBitwiseLayout( baseTypeIt->type.name );
+        }
+        break;
+      case TypeCategory::Bitmask:
+        if ( auto bitmaskIt = findByName( m_vkxml.bitmasks, type ); bitmaskIt != m_vkxml.bitmasks.end() )
+        {
+          return determineBitwiseLayout( bitmaskIt->type.name );
+        }
+        break;
+      case TypeCategory::Enum:
+        if ( auto enumIt = m_enums.find( type ); enumIt != m_enums.end() )
+        {
+          return ( enumIt->second.bitwidth == "64" ) ? std::make_pair( size_t( 8 ), size_t( 8 ) ) : std::make_pair( size_t( 4 ), size_t( 4 ) );
+        }
+        break;
+      case TypeCategory::Handle:
+        // dispatchable handles are pointers, non-dispatchable handles are 64 bit on any platform
+        if ( auto handleIt = m_handles.find( type ); ( handleIt != m_handles.end() ) && !handleIt->second.isDispatchable )
+        {
+          return { 8, 8 };
+        }
+        break;
+      case TypeCategory::Struct:
+        if ( auto structIt = findByNameOrAlias( m_structs, type ); structIt != m_structs.end() )
+        {
+          size_t size      = 0;
+          size_t alignment = 1;
+          for ( auto const & member : structIt->second.members )
+          {
+            // deprecated members are not compared, and bit fields and pointers are never bitwise comparable
+            if ( !member.deprecated.empty() || !member.bitCount.empty() || member.type.isPointer() )
+            {
+              return { 0, 0 };
+            }
+            auto [memberSize, memberAlignment] = determineBitwiseLayout( member.type.name );
+            for ( auto const & arraySize : member.arraySizes )
+            {
+              std::string value = arraySize;
+              if ( auto constantIt = findByName( m_vkxml.constants.values, arraySize ); constantIt != m_vkxml.constants.values.end() )
+              {
+                value = constantIt->value;
+              }
+              if ( value.empty() || !std::ranges::all_of( value, []( char c ) { return isdigit( c ); } ) )
+              {
+                return { 0, 0 };
+              }
+              memberSize *= std::stoul( value );
+            }
+            if ( ( memberSize == 0 ) || ( size % memberAlignment != 0 ) )
+            {
+              return { 0, 0 };
+            }
+            size += memberSize;
+            alignment = ( std::max )( alignment, memberAlignment );
+          }
+          if ( ( size != 0 ) && ( size % alignment == 0 ) )
+          {
+            return { size, alignment };
+          }
+        }
+        break;
+      default: break;
+    }
+  }
+  return { 0, 0 };
+}
+
 std::vector<size_t> VulkanHppGenerator::determineChainedReturnParams( std::vector<ParamData> const & params, std::vector<size_t> const & returnParams ) const
 {
   std::vector<size_t> chainedParams;
@@ -1832,6 +2033,46 @@ std::map<std::string, VulkanHppGenerator::CommandData>::const_iterator VulkanHpp
   return destructorIt;
 }
 
+std::set<std::string> VulkanHppGenerator::determineSerializableStructs() const
+{
+  // start with all the structures, and drop those with some member that can't be serialized, until nothing changes any more
+  // -> structures referencing each other stay serializable, as long as they don't reference anything else that can't be serialized
+  std::set<std::string> serializableStructs;
+  for ( auto const & structure : m_structs )
+  {
+    if ( !structure.second.isUnion && !structure.second.mutualExclusiveLens )
+    {
+      serializableStructs.insert( structure.first );
+    }
+  }
+
+  bool changed = true;
+  while ( changed )
+  {
+    changed = false;
+    for ( auto it = serializableStructs.begin(); it != serializableStructs.end(); )
+    {
+      auto const & members = m_structs.at( *it ).members;
+      bool         hasBitFields = std::ranges::any_of( members, []( MemberData const & member ) { return !member.bitCount.empty(); } );
+      bool         serializable = true;
+      for ( size_t i = 0; serializable && ( i < members.size() ); ++i )
+      {
+        serializable = hasBitFields ? !members[i].type.isPointer() : generateSerializeMember( "", members, i, serializableStructs ).has_value();
+      }
+      if ( serializable )
+      {
+        ++it;
+      }
+      else
+      {
+        it      = serializableStructs.erase( it );
+        changed = true;
+      }
+    }
+  }
+  return serializableStructs;
+}
+
 std::set<size_t> VulkanHppGenerator::determineSingularParams( size_t returnParam, std::map<size_t, VectorParamData> const & vectorParams ) const
 {
   auto returnVectorIt = vectorParams.find( returnParam );
@@ -2061,7 +2302,8 @@ void VulkanHppGenerator::extendSpecialCommands( std::string const & name, bool d
     {
       if ( definition )
       {
-        cmd.append(
+        // a function template, collected with the others (see generateRAIICommandDefinitions)
+        m_RAIICommandTemplateDefinitions.append(
           R"(
     // wrapper function for command vkSetDebugUtilsObjectNameEXT, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkSetDebugUtilsObjectNameEXT.html
@@ -2137,7 +2379,7 @@ void VulkanHppGenerator::extendSpecialCommands( std::string const & name, bool d
     {
       if ( definition )
       {
-        cmd.append(
+        m_RAIICommandTemplateDefinitions.append(
           R"(
     // wrapper function for command vkSetDebugUtilsObjectTagEXT, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkSetDebugUtilsObjectTagEXT.html
@@ -2212,6 +2454,98 @@ void VulkanHppGenerator::extendSpecialCommands( std::string const & name, bool d
       }
     }
   }
+  else if ( name == "vkGetQueryPoolResults" )
+  {
+    // two more overloads, writing the results into caller-provided storage of 32 or 64 bit words, and returning a typed view onto it
+    std::string functionTemplate;
+    if ( raii )
+    {
+      functionTemplate = definition ? R"(
+    // wrapper function for command vkGetQueryPoolResults, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueryPoolResults.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE ResultValue<QueryResultView<DataType>>
+      QueryPool::getResults( uint32_t firstQuery, uint32_t queryCount, ArrayProxyNoTemporaries<${wordType}> const & data, QueryResultFlags flags ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetQueryPoolResults && "Function <vkGetQueryPoolResults> requires <VK_VERSION_1_0>" );
+
+      // e64 follows from the storage, the stride from DataType and the availability or status word
+      ${adjustFlags}
+      uint32_t stride = QueryResultView<DataType>::queryStride( flags );
+      VULKAN_HPP_ASSERT( queryCount * stride <= data.size() * sizeof( ${wordType} ) );
+      Result result = static_cast<Result>( getDispatcher()->vkGetQueryPoolResults( static_cast<VkDevice>( m_device ),
+                                                                                   static_cast<VkQueryPool>( m_queryPool ),
+                                                                                   firstQuery,
+                                                                                   queryCount,
+                                                                                   data.size() * sizeof( ${wordType} ),
+                                                                                   reinterpret_cast<void *>( data.data() ),
+                                                                                   static_cast<VkDeviceSize>( stride ),
+                                                                                   static_cast<VkQueryResultFlags>( flags ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eNotReady>( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::QueryPool::getResults" );
+
+      return { result, QueryResultView<DataType>( queryCount, reinterpret_cast<DataType const *>( data.data() ), flags ) };
+    }
+)"
+                                    : R"(
+      // wrapper function for command vkGetQueryPoolResults, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueryPoolResults.html
+      template <typename DataType>
+      VULKAN_HPP_NODISCARD ResultValue<QueryResultView<DataType>> getResults( uint32_t firstQuery, uint32_t queryCount, ArrayProxyNoTemporaries<${wordType}> const & data, QueryResultFlags flags VULKAN_HPP_DEFAULT_ASSIGNMENT( {} ) ) const;
+)";
+    }
+    else
+    {
+      functionTemplate = definition ? R"(
+  // wrapper function for command vkGetQueryPoolResults, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueryPoolResults.html
+  template <typename DataType, typename Dispatch, typename std::enable_if<IS_DISPATCHED( vkGetQueryPoolResults ), bool>::type>
+  VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE ResultValue<QueryResultView<DataType>> Device::getQueryPoolResults(
+    QueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, ArrayProxyNoTemporaries<${wordType}> const & data, QueryResultFlags flags, Dispatch const & d ) const
+  {
+    VULKAN_HPP_ASSERT( d.getVkHeaderVersion() == VK_HEADER_VERSION );
+#  if ( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC == 1 )
+    VULKAN_HPP_ASSERT( d.vkGetQueryPoolResults && "Function <vkGetQueryPoolResults> requires <VK_VERSION_1_0>" );
+#  endif
+
+    // e64 follows from the storage, the stride from DataType and the availability or status word
+    ${adjustFlags}
+    uint32_t stride = QueryResultView<DataType>::queryStride( flags );
+    VULKAN_HPP_ASSERT( queryCount * stride <= data.size() * sizeof( ${wordType} ) );
+    Result result = static_cast<Result>( d.vkGetQueryPoolResults( static_cast<VkDevice>( m_device ),
+                                                                  static_cast<VkQueryPool>( queryPool ),
+                                                                  firstQuery,
+                                                                  queryCount,
+                                                                  data.size() * sizeof( ${wordType} ),
+                                                                  reinterpret_cast<void *>( data.data() ),
+                                                                  static_cast<VkDeviceSize>( stride ),
+                                                                  static_cast<VkQueryResultFlags>( flags ) ) );
+    detail::resultCheck<Result::eSuccess, Result::eNotReady>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getQueryPoolResults" );
+
+    return { result, QueryResultView<DataType>( queryCount, reinterpret_cast<DataType const *>( data.data() ), flags ) };
+  }
+)"
+                                    : R"(    // wrapper function for command vkGetQueryPoolResults, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueryPoolResults.html
+    template <typename DataType, typename Dispatch = VULKAN_HPP_DEFAULT_DISPATCHER_TYPE, typename std::enable_if<IS_DISPATCHED( vkGetQueryPoolResults ), bool>::type = true>
+    VULKAN_HPP_NODISCARD ResultValue<QueryResultView<DataType>> getQueryPoolResults( QueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, ArrayProxyNoTemporaries<${wordType}> const & data,
+      QueryResultFlags flags VULKAN_HPP_DEFAULT_ASSIGNMENT( {} ), Dispatch const & d VULKAN_HPP_DEFAULT_DISPATCHER_ASSIGNMENT ) const;
+)";
+    }
+
+    std::vector<std::pair<std::string, std::string>> const wordTypes = { { "uint32_t", "flags &= ~QueryResultFlagBits::e64;" },
+                                                                         { "uint64_t", "flags |= QueryResultFlagBits::e64;" } };
+    std::string                                            functions;
+    for ( auto const & wordType : wordTypes )
+    {
+      functions += replaceWithMap( functionTemplate, { { "adjustFlags", wordType.second }, { "wordType", wordType.first } } );
+    }
+    if ( raii )
+    {
+      ( definition ? m_RAIICommandTemplateDefinitions : cmd ).append( functions );
+    }
+    else
+    {
+      static std::string const endOfCmd = "#endif /* VULKAN_HPP_DISABLE_ENHANCED_MODE */\n";
+      assert( cmd.ends_with( endOfCmd ) );
+      cmd.insert( cmd.size() - endOfCmd.size(), functions );
+    }
+  }
 }
 
 VulkanHppGenerator::FeatureData VulkanHppGenerator::featureToFeatureData( Feature const & feature, bool supported )
@@ -2523,6 +2857,15 @@ std::pair<std::string, std::string> VulkanHppGenerator::generateAllocatorTemplat
   return { allocatorTemplates, uniqueHandleAllocatorTemplates };
 }
 
+std::string VulkanHppGenerator::generateApiVersionMacro( std::string const & feature ) const
+{
+  // VK_VERSION_1_2 -> VK_API_VERSION_1_2
+  assert( containsByName( m_features, feature ) );
+  size_t pos = feature.find( "_VERSION_" );
+  assert( pos != std::string::npos );
+  return feature.substr( 0, pos ) + "_API" + feature.substr( pos );
+}
+
 std::string VulkanHppGenerator::generateArgumentListEnhanced( std::vector<ParamData> const &            params,
                                                               std::vector<size_t> const &               returnParams,
                                                               std::map<size_t, VectorParamData> const & vectorParams,
@@ -2957,6 +3300,22 @@ ${toStringChecks}
   return str;
 }
 
+std::string VulkanHppGenerator::generateBitwiseHashableStructures() const
+{
+  // structures with just integral members and no padding are hashed as a whole, and so are ranges of them
+  std::string str;
+  for ( auto const & structure : m_structs )
+  {
+    if ( isTypeUsed( structure.first ) && !containsUnion( structure.first ) && ( determineBitwiseLayout( structure.first ).first != 0 ) )
+    {
+      auto [enter, leave] = generateProtection( getProtectFromType( structure.first ) );
+      str += "\n" + enter + "    template <>\n    struct isBitwiseHashable<" + stripPrefix( structure.first, "Vk" ) + "> : std::true_type\n    {\n    };\n" +
+             leave;
+    }
+  }
+  return str;
+}
+
 std::string VulkanHppGenerator::generateCallArgumentsEnhanced( CommandData const &      commandData,
                                                                size_t                   initialSkipCount,
                                                                bool                     nonConstPointerAsNullptr,
@@ -3631,7 +3990,8 @@ std::string
     }
   }
 
-  if ( cmd.empty() )
+  // the definitions of vk::raii function templates are not returned, but collected in m_RAIICommandTemplateDefinitions
+  if ( cmd.empty() && !( raii && definition && !m_RAIICommandTemplateDefinitions.empty() ) )
   {
     throw std::runtime_error( "Never encountered a function like <" + name + "> !" );
   }
@@ -4823,14 +5183,28 @@ std::string VulkanHppGenerator::generateCommandSetInclusive( std::string const &
       {
         bool const noReturn = flag & CommandFlavourFlagBits::noReturn;
         assert( !noReturn || !raiiFactory );  // noReturn => !raiiFactory
-        raiiCommands += raiiFactory ? generateRAIIHandleCommandFactory( name, commandData, initialSkipCount, returnParams, vectorParams, definition, flag )
-                                    : generateRAIIHandleCommandEnhanced( name,
-                                                                         commandData,
-                                                                         initialSkipCount,
-                                                                         noReturn ? emptyReturnParams : returnParams,
-                                                                         noReturn ? emptyVectorParams : vectorParams,
-                                                                         definition,
-                                                                         flag );
+        if ( raiiFactory )
+        {
+          raiiCommands += generateRAIIHandleCommandFactory( name, commandData, initialSkipCount, returnParams, vectorParams, definition, flag );
+
+          // factories returning a vector of handles get an overload taking an allocator, used for the returned and the intermediate vector
+          auto vectorParamIt = vectorParams.find( returnParams.back() );
+          if ( !( flag & CommandFlavourFlagBits::singular ) && ( vectorParamIt != vectorParams.end() ) && !vectorParamIt->second.byStructure )
+          {
+            raiiCommands += generateRAIIHandleCommandFactory(
+              name, commandData, initialSkipCount, returnParams, vectorParams, definition, flag | CommandFlavourFlagBits::withAllocator );
+          }
+        }
+        else
+        {
+          raiiCommands += generateRAIIHandleCommandEnhanced( name,
+                                                             commandData,
+                                                             initialSkipCount,
+                                                             noReturn ? emptyReturnParams : returnParams,
+                                                             noReturn ? emptyVectorParams : vectorParams,
+                                                             definition,
+                                                             flag );
+        }
       }
     }
     return raiiCommands;
@@ -6695,6 +7069,49 @@ std::string VulkanHppGenerator::generateExtensionDependencies() const
   return extensionDependencies;
 }
 
+std::string VulkanHppGenerator::generateExtensionDependencyTable( ExtensionData const & extension ) const
+{
+  std::string table;
+  for ( auto const & dependsByVersion : extension.depends )
+  {
+    assert( containsByName( m_features, dependsByVersion.first ) );
+    std::string const apiVersion = generateApiVersionMacro( dependsByVersion.first );
+
+    // an empty list of alternatives is like one alternative without any dependency
+    std::vector<std::set<std::string>> const alternatives =
+      dependsByVersion.second.empty() ? std::vector<std::set<std::string>>( 1 ) : dependsByVersion.second;
+    size_t alternativeIndex = 0;
+    for ( auto const & alternative : alternatives )
+    {
+      // an alternative depending on an extension not listed for this api can't be resolved, and is skipped
+      if ( std::all_of( alternative.begin(), alternative.end(), [this]( std::string const & dep ) { return containsByName( m_extensions, dep ); } ) )
+      {
+        std::string const entryPrefix =
+          "{ ExtensionId::" + generateExtensionId( extension.name ) + ", " + apiVersion + ", " + std::to_string( alternativeIndex ) + ", ";
+        if ( alternative.empty() )
+        {
+          table += entryPrefix + "ExtensionId::eUnknown },\n";
+        }
+        for ( auto const & dep : alternative )
+        {
+          table += entryPrefix + "ExtensionId::" + generateExtensionId( dep ) + " },\n";
+        }
+        ++alternativeIndex;
+      }
+    }
+  }
+  if ( !table.empty() )
+  {
+    table.pop_back();
+  }
+  return table;
+}
+
+std::string VulkanHppGenerator::generateExtensionId( std::string const & extensionName ) const
+{
+  return "e" + generateTaggedCamelCase( toUpperCase( extensionName ) );
+}
+
 template <class Predicate, class Extraction>
 std::string VulkanHppGenerator::generateExtensionReplacedBy( Predicate p, Extraction e ) const
 {
@@ -6768,6 +7185,23 @@ std::string VulkanHppGenerator::generateExtensionsList( std::string const & type
   return extensionsList;
 }
 
+template <class Extraction>
+std::string VulkanHppGenerator::generateExtensionsTable( Extraction e ) const
+{
+  // the entries are ordered like the extensions, and thus like the ExtensionIds
+  // they hold just ids and strings and are not protected, as the ExtensionIds need to be the same in every translation unit
+  std::string table;
+  for ( auto const & extension : m_extensions )
+  {
+    std::string const entry = e( extension );
+    if ( !entry.empty() )
+    {
+      table += "\n" + entry;
+    }
+  }
+  return table;
+}
+
 std::string VulkanHppGenerator::generateExtensionTypeTest( std::string const & type ) const
 {
   std::string typeTest, previousEnter, previousLeave;
@@ -7597,6 +8031,53 @@ ${typeTraits}
   return replaceWithMap( typeTraitsTemplate, { { "typeTraits", typeTraits } } );
 }
 
+std::string VulkanHppGenerator::generateInstrumentingDispatcher() const
+{
+  std::string const instrumentingDispatcherTemplate = readSnippet( "InstrumentingDispatcher.hpp" );
+
+  std::string           commandBindings, commandMembers, commandNames;
+  std::set<std::string> listedCommands;  // some commands are listed with more than one extension!
+  for ( auto const & feature : m_features )
+  {
+    generateInstrumentingDispatcherCommands( feature.requireData, listedCommands, feature.name, commandBindings, commandMembers, commandNames );
+  }
+  for ( auto const & extension : m_extensions )
+  {
+    generateInstrumentingDispatcherCommands( extension.requireData, listedCommands, extension.name, commandBindings, commandMembers, commandNames );
+  }
+
+  return replaceWithMap( instrumentingDispatcherTemplate,
+                         { { "commandBindings", commandBindings },
+                           { "commandCount", std::to_string( listedCommands.size() ) },
+                           { "commandMembers", commandMembers },
+                           { "commandNames", commandNames } } );
+}
+
+void VulkanHppGenerator::generateInstrumentingDispatcherCommands( std::vector<RequireData> const & requireData,
+                                                                  std::set<std::string> &          listedCommands,
+                                                                  std::string const &              title,
+                                                                  std::string &                    commandBindings,
+                                                                  std::string &                    commandMembers,
+                                                                  std::string &                    commandNames ) const
+{
+  // the command indices, and with them the command names, don't depend on any platform protection, only the members and their bindings do
+  std::string bindings, members, placeholders;
+  forEachRequiredCommand( requireData,
+                          [&]( NameLine const & command, auto const & )
+                          {
+                            if ( listedCommands.insert( command.name ).second )
+                            {
+                              std::string const commandIndex = std::to_string( listedCommands.size() - 1 );
+                              bindings += "      " + command.name + ".bind( m_inner." + command.name + ", " + commandIndex + " );\n";
+                              members += "    InstrumentedCommand<PFN_" + command.name + "> " + command.name + ";\n";
+                              placeholders += "    InstrumentedCommandPlaceholder " + command.name + "_placeholder;\n";
+                              commandNames += "    \"" + command.name + "\",\n";
+                            }
+                          } );
+  commandBindings += addTitleAndProtection( title, bindings );
+  commandMembers += addTitleAndProtection( title, members, placeholders );
+}
+
 std::string VulkanHppGenerator::generateIsDispatchedList() const
 {
   std::string const isDispatchedListTemplate = R"(
@@ -7808,6 +8289,156 @@ std::string VulkanHppGenerator::generateNoExcept( std::vector<std::string> const
          : "";
 }
 
+std::string VulkanHppGenerator::generateNullDriverCommandEntries() const
+{
+  std::string           commandEntries;
+  std::set<std::string> listedCommands;  // some commands are listed with more than one extension!
+  for ( auto const & feature : m_features )
+  {
+    commandEntries += generateNullDriverCommandEntries( feature.requireData, feature.name, listedCommands );
+  }
+  for ( auto const & extension : m_extensions )
+  {
+    commandEntries += generateNullDriverCommandEntries( extension.requireData, extension.name, listedCommands );
+  }
+  return commandEntries;
+}
+
+std::string VulkanHppGenerator::generateNullDriverCommandEntries( std::vector<RequireData> const & requireData,
+                                                                  std::string const &              title,
+                                                                  std::set<std::string> &          listedCommands ) const
+{
+  std::string str;
+  forEachRequiredCommand( requireData,
+                          [&]( NameLine const & command, auto const & commandData )
+                          {
+                            if ( listedCommands.insert( command.name ).second )
+                            {
+                              // the non-const pointers are the outputs, except for the pointers to some native objects, like a Display
+                              uint32_t outputMask = 0;
+                              assert( commandData.second.params.size() <= 32 );
+                              for ( size_t i = 0; i < commandData.second.params.size(); ++i )
+                              {
+                                Type const & type = commandData.second.params[i].type;
+                                if ( type.isNonConstPointer() )
+                                {
+                                  auto typeIt = m_types.find( type.name );
+                                  if ( ( typeIt == m_types.end() ) || ( typeIt->second.category != TypeCategory::External ) || ( type.postfix != "*" ) ||
+                                       std::set<std::string>{ "HANDLE", "int", "size_t", "uint32_t", "uint64_t", "void", "zx_handle_t" }.contains( type.name ) )
+                                  {
+                                    outputMask |= 1u << i;
+                                  }
+                                }
+                              }
+                              str += "          { \"" + command.name + "\", NullDriverCommand<PFN_" + command.name + ", 0x" + std::format( "{:x}", outputMask ) +
+                                     ">::pfn() },\n";
+                            }
+                          } );
+  return addTitleAndProtection( title, str );
+}
+
+std::string VulkanHppGenerator::generateNullDriverHandleCounts() const
+{
+  std::string           handleCounts;
+  std::set<std::string> listedCommands;
+  for ( auto const & feature : m_features )
+  {
+    handleCounts += generateNullDriverHandleCounts( feature.requireData, feature.name, listedCommands );
+  }
+  for ( auto const & extension : m_extensions )
+  {
+    handleCounts += generateNullDriverHandleCounts( extension.requireData, extension.name, listedCommands );
+  }
+  return handleCounts;
+}
+
+std::string VulkanHppGenerator::generateNullDriverHandleCounts( std::vector<RequireData> const & requireData,
+                                                                std::string const &              title,
+                                                                std::set<std::string> &          listedCommands ) const
+{
+  std::string str;
+  forEachRequiredCommand(
+    requireData,
+    [&]( NameLine const &, auto const & commandData )
+    {
+      // an alias has the very same function pointer type, so there's just one specialization per command
+      if ( listedCommands.insert( commandData.first ).second )
+      {
+        std::vector<ParamData> const & params = commandData.second.params;
+
+        // the commands returning an array of handles sized by some input, in contrast to the handles returned by an enumeration
+        auto handleParamIt = std::ranges::find_if( params,
+                                                   [this, &params]( ParamData const & param )
+                                                   {
+                                                     return param.type.isNonConstPointer() && isHandleType( param.type.name ) && !param.lenParams.empty() &&
+                                                            std::ranges::none_of( param.lenParams,
+                                                                                  [&params]( std::pair<std::string, size_t> const & lenParam )
+                                                                                  { return params[lenParam.second].type.isNonConstPointer(); } );
+                                                   } );
+        if ( handleParamIt != params.end() )
+        {
+          std::string parameterList;
+          for ( size_t i = 0; i < params.size(); ++i )
+          {
+            bool isLenParam = std::ranges::any_of( handleParamIt->lenParams,
+                                                   [i]( std::pair<std::string, size_t> const & lenParam ) { return lenParam.second == i; } );
+            parameterList += params[i].type.compose( "" ) + ( isLenParam ? ( " " + params[i].name ) : "" ) + ", ";
+          }
+          assert( parameterList.ends_with( ", " ) );
+          parameterList.resize( parameterList.size() - 2 );
+
+          std::string const handleCountTemplate = R"(
+    template <>
+    struct NullDriverHandleCount<PFN_${commandName}>
+    {
+      static uint32_t get( ${parameterList} ) VULKAN_HPP_NOEXCEPT
+      {
+        return ${handleCount};
+      }
+    };
+)";
+
+          str += replaceWithMap( handleCountTemplate,
+                                 { { "commandName", commandData.first }, { "handleCount", handleParamIt->lenExpression }, { "parameterList", parameterList } } );
+        }
+      }
+    } );
+  return addTitleAndProtection( title, str );
+}
+
+std::string VulkanHppGenerator::generateNullDriverStructureSizes() const
+{
+  std::string           structureSizes;
+  std::set<std::string> listedStructs;
+  for ( auto const & feature : m_features )
+  {
+    structureSizes += generateNullDriverStructureSizes( feature.requireData, feature.name, listedStructs );
+  }
+  for ( auto const & extension : m_extensions )
+  {
+    structureSizes += generateNullDriverStructureSizes( extension.requireData, extension.name, listedStructs );
+  }
+  return structureSizes;
+}
+
+std::string VulkanHppGenerator::generateNullDriverStructureSizes( std::vector<RequireData> const & requireData,
+                                                                  std::string const &              title,
+                                                                  std::set<std::string> &          listedStructs ) const
+{
+  std::string str;
+  forEachRequiredStruct( requireData,
+                         [&str, &listedStructs]( std::pair<std::string, StructData> const & structData )
+                         {
+                           if ( listedStructs.insert( structData.first ).second && !structData.second.members.empty() &&
+                                !structData.second.members.front().value.empty() )
+                           {
+                             assert( structData.second.members.front().name == "sType" );
+                             str += "        case " + structData.second.members.front().value + ": return sizeof( " + structData.first + " );\n";
+                           }
+                         } );
+  return addTitleAndProtection( title, str );
+}
+
 std::string VulkanHppGenerator::generateObjectDeleter( std::string const & commandName,
                                                        CommandData const & commandData,
                                                        size_t              initialSkipCount,
@@ -7917,37 +8548,61 @@ std::string VulkanHppGenerator::generateRAIICommandDefinitions() const
   //=== COMMAND Definitions ===
   //===========================
 
+#if !defined( VULKAN_HPP_COMPILED ) || defined( VULKAN_HPP_COMPILED_DEFINITIONS )
+  // with VULKAN_HPP_COMPILED, the non-template functions are not defined here, but compiled once into a library (see ${api}_raii.cpp)
+#  if defined( VULKAN_HPP_COMPILED_DEFINITIONS )
+#    pragma push_macro( "VULKAN_HPP_INLINE" )
+#    undef VULKAN_HPP_INLINE
+#    define VULKAN_HPP_INLINE
+#  endif
 ${commandDefinitions}
+#  if defined( VULKAN_HPP_COMPILED_DEFINITIONS )
+#    pragma pop_macro( "VULKAN_HPP_INLINE" )
+#  endif
+#endif
+
+  //====================================
+  //=== COMMAND Template Definitions ===
+  //====================================
+
+${commandTemplateDefinitions}
 )";
 
-  std::string           commandDefinitions;
+  std::string           commandDefinitions, commandTemplateDefinitions;
   std::set<std::string> listedCommands;  // some commands are listed with more than one extension!
   for ( auto const & feature : m_features )
   {
-    commandDefinitions += generateRAIICommandDefinitions( feature.requireData, listedCommands, feature.name );
+    auto const [definitions, templateDefinitions] = generateRAIICommandDefinitions( feature.requireData, listedCommands, feature.name );
+    commandDefinitions += definitions;
+    commandTemplateDefinitions += templateDefinitions;
   }
   for ( auto const & extension : m_extensions )
   {
-    commandDefinitions += generateRAIICommandDefinitions( extension.requireData, listedCommands, extension.name );
+    auto const [definitions, templateDefinitions] = generateRAIICommandDefinitions( extension.requireData, listedCommands, extension.name );
+    commandDefinitions += definitions;
+    commandTemplateDefinitions += templateDefinitions;
   }
 
-  return replaceWithMap( commandDefinitionsTemplate, { { "commandDefinitions", commandDefinitions } } );
+  return replaceWithMap( commandDefinitionsTemplate,
+                         { { "api", m_api }, { "commandDefinitions", commandDefinitions }, { "commandTemplateDefinitions", commandTemplateDefinitions } } );
 }
 
-std::string VulkanHppGenerator::generateRAIICommandDefinitions( std::vector<RequireData> const & requireData,
-                                                                std::set<std::string> &          listedCommands,
-                                                                std::string const &              title ) const
+std::pair<std::string, std::string> VulkanHppGenerator::generateRAIICommandDefinitions( std::vector<RequireData> const & requireData,
+                                                                                        std::set<std::string> &          listedCommands,
+                                                                                        std::string const &              title ) const
 {
-  std::string str;
+  std::string definitions, templateDefinitions;
   forEachRequiredCommand( requireData,
                           [&]( NameLine const & command, auto const & )
                           {
                             if ( listedCommands.insert( command.name ).second )
                             {
-                              str += generateRAIIHandleCommand( command.name, determineInitialSkipCount( command.name ), true );
+                              // the function templates of this command are not returned, but collected in m_RAIICommandTemplateDefinitions
+                              definitions += generateRAIIHandleCommand( command.name, determineInitialSkipCount( command.name ), true );
+                              templateDefinitions += std::exchange( m_RAIICommandTemplateDefinitions, {} );
                             }
                           } );
-  return addTitleAndProtection( title, str );
+  return { addTitleAndProtection( title, definitions ), addTitleAndProtection( title, templateDefinitions ) };
 }
 
 std::string VulkanHppGenerator::generateRAIIDispatcherCommandsContextInitializers( std::vector<RequireData> const & requireData,
@@ -8159,7 +8814,8 @@ std::string VulkanHppGenerator::generateRAIIFactoryReturnStatements( CommandData
                                                                      bool                enumerating,
                                                                      std::string const & returnType,
                                                                      std::string const & returnVariable,
-                                                                     bool                singular ) const
+                                                                     bool                singular,
+                                                                     std::string const & vectorAllocator ) const
 {
   auto handleIt = findByNameOrAlias( m_handles, vkType );
   assert( handleIt != m_handles.end() );
@@ -8170,7 +8826,7 @@ std::string VulkanHppGenerator::generateRAIIFactoryReturnStatements( CommandData
   {
     assert( !commandData.successCodes.empty() );
 
-    std::string const & returnTemplate = R"(${returnType} ${returnVariable}RAII;
+    std::string const & returnTemplate = R"(${returnType} ${returnVariable}RAII${vectorAllocator};
         if ( result == Result::eSuccess )
         {
           ${returnVariable}RAII.reserve( ${returnVariable}.size() );
@@ -8190,10 +8846,12 @@ std::string VulkanHppGenerator::generateRAIIFactoryReturnStatements( CommandData
                              { "handleConstructorArguments", handleConstructorArguments },
                              { "successCodePassToElement", successCodePassToElement },
                              { "returnType", returnType },
-                             { "returnVariable", returnVariable } } );
+                             { "returnVariable", returnVariable },
+                             { "vectorAllocator", vectorAllocator } } );
   }
   else
   {
+    assert( vectorAllocator.empty() );
     std::string const & returnTypeTemplate = "${returnType}( *this, ${handleConstructorArguments}${successCodePassToElement} )";
 
     std::string handleConstructorArguments =
@@ -8658,23 +9316,30 @@ ${vectorSizeCheck}
     std::string vectorSizeCheckString =
       vectorSizeCheck.first ? generateVectorSizeCheck( name, commandData, initialSkipCount, vectorSizeCheck.second, skippedParams, false ) : "";
 
-    return replaceWithMap( definitionTemplate,
-                           { { "argumentList", argumentList },
-                             { "argumentTemplates", argumentTemplates },
-                             { "callSequence", callSequence },
-                             { "className", className },
-                             { "commandName", commandName },
-                             { "dataDeclarations", dataDeclarations },
-                             { "dataPreparation", dataPreparation },
-                             { "dataSizeChecks", dataSizeChecks },
-                             { "functionPointerCheck", generateFunctionPointerCheck( name, commandData.requiredBy, true ) },
-                             { "nodiscard", nodiscard },
-                             { "noexcept", noexceptString },
-                             { "resultCheck", resultCheck },
-                             { "returnStatement", returnStatement },
-                             { "returnType", decoratedReturnType },
-                             { "vectorSizeCheck", vectorSizeCheckString },
-                             { "vkCommandName", name } } );
+    std::string functionDefinition = replaceWithMap( definitionTemplate,
+                                                     { { "argumentList", argumentList },
+                                                       { "argumentTemplates", argumentTemplates },
+                                                       { "callSequence", callSequence },
+                                                       { "className", className },
+                                                       { "commandName", commandName },
+                                                       { "dataDeclarations", dataDeclarations },
+                                                       { "dataPreparation", dataPreparation },
+                                                       { "dataSizeChecks", dataSizeChecks },
+                                                       { "functionPointerCheck", generateFunctionPointerCheck( name, commandData.requiredBy, true ) },
+                                                       { "nodiscard", nodiscard },
+                                                       { "noexcept", noexceptString },
+                                                       { "resultCheck", resultCheck },
+                                                       { "returnStatement", returnStatement },
+                                                       { "returnType", decoratedReturnType },
+                                                       { "vectorSizeCheck", vectorSizeCheckString },
+                                                       { "vkCommandName", name } } );
+    if ( argumentTemplates.empty() )
+    {
+      return functionDefinition;
+    }
+    // function templates are collected separately, as they stay in the header with VULKAN_HPP_COMPILED (see generateRAIICommandDefinitions)
+    m_RAIICommandTemplateDefinitions += functionDefinition;
+    return "";
   }
   else
   {
@@ -8713,10 +9378,13 @@ std::string VulkanHppGenerator::generateRAIIHandleCommandFactory( std::string co
 
   bool const       enumerating    = determineEnumeration( vectorParams, returnParams );
   bool const       singular       = flavourFlags & CommandFlavourFlagBits::singular;
+  bool const       withAllocator  = flavourFlags & CommandFlavourFlagBits::withAllocator;
   std::set<size_t> skippedParams  = determineSkippedParams( commandData.params, initialSkipCount, vectorParams, returnParams, singular );
   std::set<size_t> singularParams = singular ? determineSingularParams( returnParams.back(), vectorParams ) : std::set<size_t>();
-  std::string      argumentList   = generateRAIIHandleCommandFactoryArgumentList( commandData.params, skippedParams, definition, singular );
-  std::string      commandName    = generateCommandName( name, commandData.params, initialSkipCount, flavourFlags );
+  // with an allocator argument following, there are no default arguments
+  std::string argumentList = generateRAIIHandleCommandFactoryArgumentList( commandData.params, skippedParams, definition || withAllocator, singular );
+  std::string commandName  = generateCommandName( name, commandData.params, initialSkipCount, flavourFlags );
+  std::vector<std::string> dataTypes = determineDataTypes( commandData.params, vectorParams, returnParams, {}, true );
 
   std::string handleType;
   if ( ( vectorParams.size() == 1 ) && vectorParams.begin()->second.byStructure )
@@ -8740,10 +9408,23 @@ std::string VulkanHppGenerator::generateRAIIHandleCommandFactory( std::string co
   handleType                 = stripPrefix( handleType, "Vk" );
   std::string noexceptString = enumerating ? "" : "VULKAN_HPP_NOEXCEPT_WHEN_NO_EXCEPTIONS";
   std::string returnType     = handleType;
+  std::string allocatorTemplate, allocatorType;
   if ( vectorParams.contains( returnParams.back() ) && !singular )
   {
     noexceptString = "";
-    returnType     = "std::vector<" + handleType + ">";
+    if ( withAllocator )
+    {
+      // the allocator is named like the ones of the intermediate vector, holding the plain handles (see generateDataDeclarations)
+      allocatorType     = startUpperCase( stripPrefix( dataTypes.back(), "VULKAN_HPP_NAMESPACE::" ) ) + "Allocator";
+      allocatorTemplate = "template <typename " + allocatorType + ", typename std::enable_if<std::is_same<typename " + allocatorType + "::value_type, " +
+                          handleType + ">::value, int>::type" + ( definition ? "" : " = 0" ) + ">";
+      argumentList += ( argumentList.empty() ? "" : ", " ) + allocatorType + " const & " + startLowerCase( allocatorType );
+      returnType = "std::vector<" + handleType + ", " + allocatorType + ">";
+    }
+    else
+    {
+      returnType = "std::vector<" + handleType + ">";
+    }
     handleType += "s";
   }
   std::string decoratedReturnType = returnType;
@@ -8755,8 +9436,14 @@ std::string VulkanHppGenerator::generateRAIIHandleCommandFactory( std::string co
   if ( definition )
   {
     std::string              className      = initialSkipCount ? stripPrefix( commandData.params[initialSkipCount - 1].type.name, "Vk" ) : "Context";
-    std::vector<std::string> dataTypes      = determineDataTypes( commandData.params, vectorParams, returnParams, {}, true );
     std::string              returnDataType = generateReturnDataType( vectorParams, returnParams, enumerating, dataTypes, flavourFlags, true );
+    if ( withAllocator )
+    {
+      // the intermediate vector gets the allocator rebound to the plain handles
+      assert( returnDataType == "std::vector<" + dataTypes.back() + ">" );
+      returnDataType = "std::vector<" + dataTypes.back() + ", typename std::allocator_traits<" + allocatorType + ">::template rebind_alloc<" +
+                       dataTypes.back() + ">>";
+    }
     std::string              returnVariable = generateReturnVariable( commandData, returnParams, vectorParams, flavourFlags );
     std::string              vulkanType;
     auto                     vectorParamIt = vectorParams.find( returnParams.back() );
@@ -8774,12 +9461,13 @@ std::string VulkanHppGenerator::generateRAIIHandleCommandFactory( std::string co
     std::string callSequence =
       generateCallSequence( name, commandData, returnParams, vectorParams, initialSkipCount, singularParams, {}, {}, flavourFlags, true, true );
     std::string resultCheck      = generateResultCheck( commandData, className, "::", commandName, enumerating, false, true );
-    std::string returnStatements = generateRAIIFactoryReturnStatements( commandData, vulkanType, enumerating, returnType, returnVariable, singular );
+    std::string returnStatements = generateRAIIFactoryReturnStatements(
+      commandData, vulkanType, enumerating, returnType, returnVariable, singular, withAllocator ? ( "( " + startLowerCase( allocatorType ) + " )" ) : "" );
 
     std::string const definitionTemplate =
       R"(
   // wrapper function for command ${vkCommandName}, see https://registry.khronos.org/vulkan/specs/latest/man/html/${vkCommandName}.html
-  VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE ${returnType} ${className}::${commandName}( ${argumentList} ) const ${noexcept}
+  ${allocatorTemplate} VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE ${returnType} ${className}::${commandName}( ${argumentList} ) const ${noexcept}
   {
     ${functionPointerCheck}
 
@@ -8790,29 +9478,38 @@ std::string VulkanHppGenerator::generateRAIIHandleCommandFactory( std::string co
   }
 )";
 
-    return replaceWithMap( definitionTemplate,
-                           { { "argumentList", argumentList },
-                             { "callSequence", callSequence },
-                             { "className", className },
-                             { "commandName", commandName },
-                             { "dataDeclarations", dataDeclarations },
-                             { "functionPointerCheck", generateFunctionPointerCheck( name, commandData.requiredBy, true ) },
-                             { "noexcept", noexceptString },
-                             { "resultCheck", resultCheck },
-                             { "returnStatements", returnStatements },
-                             { "returnType", decoratedReturnType },
-                             { "vkCommandName", name } } );
+    std::string functionDefinition = replaceWithMap( definitionTemplate,
+                                                     { { "allocatorTemplate", allocatorTemplate },
+                                                       { "argumentList", argumentList },
+                                                       { "callSequence", callSequence },
+                                                       { "className", className },
+                                                       { "commandName", commandName },
+                                                       { "dataDeclarations", dataDeclarations },
+                                                       { "functionPointerCheck", generateFunctionPointerCheck( name, commandData.requiredBy, true ) },
+                                                       { "noexcept", noexceptString },
+                                                       { "resultCheck", resultCheck },
+                                                       { "returnStatements", returnStatements },
+                                                       { "returnType", decoratedReturnType },
+                                                       { "vkCommandName", name } } );
+    if ( allocatorTemplate.empty() )
+    {
+      return functionDefinition;
+    }
+    // the overload taking an allocator is a function template, collected like those of generateRAIIHandleCommandEnhanced
+    m_RAIICommandTemplateDefinitions += functionDefinition;
+    return "";
   }
   else
   {
     std::string const declarationTemplate =
       R"(
   // wrapper function for command ${vkCommandName}, see https://registry.khronos.org/vulkan/specs/latest/man/html/${vkCommandName}.html
-  VULKAN_HPP_NODISCARD ${returnType} ${commandName}( ${argumentList} ) const ${noexcept};
+  ${allocatorTemplate} VULKAN_HPP_NODISCARD ${returnType} ${commandName}( ${argumentList} ) const ${noexcept};
 )";
 
     return replaceWithMap( declarationTemplate,
-                           { { "argumentList", argumentList },
+                           { { "allocatorTemplate", allocatorTemplate },
+                             { "argumentList", argumentList },
                              { "commandName", commandName },
                              { "noexcept", noexceptString },
                              { "returnType", decoratedReturnType },
@@ -9999,9 +10696,9 @@ std::string VulkanHppGenerator::generateResultCheck( CommandData const & command
 
       std::string const resultCheckTemplate = R"(
 #if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-  ${namespace}detail::resultCheck( result, ${namespaceString} "::${className}${classSeparator}${commandName}"${extendedSuccessCodeList} );
+  ${namespace}detail::resultCheck${extendedSuccessCodeList}( result, ${namespaceString} "::${className}${classSeparator}${commandName}" );
 #else
-  ${namespace}detail::resultCheck( result, ${namespaceString} "::${className}${classSeparator}${commandName}"${successCodeList} );
+  ${namespace}detail::resultCheck${successCodeList}( result, ${namespaceString} "::${className}${classSeparator}${commandName}" );
 #endif
  )";
 
@@ -10017,7 +10714,7 @@ std::string VulkanHppGenerator::generateResultCheck( CommandData const & command
     else if ( isMultiPipelineCreation )
     {
       std::string const resultCheckTemplate =
-        R"(${namespace}detail::resultCheck( result, ${namespaceString} "::${className}${classSeparator}${commandName}"${successCodeList}, ${device}, pipelines, allocator.get(), d );)";
+        R"(${namespace}detail::resultCheck${successCodeList}( result, ${namespaceString} "::${className}${classSeparator}${commandName}", ${device}, pipelines, allocator.get(), d );)";
 
       resultCheck = replaceWithMap( resultCheckTemplate,
                                     { { "className", className },
@@ -10031,7 +10728,7 @@ std::string VulkanHppGenerator::generateResultCheck( CommandData const & command
     else
     {
       std::string const resultCheckTemplate =
-        R"(${namespace}detail::resultCheck( result, ${namespaceString} "::${className}${classSeparator}${commandName}"${successCodeList} );)";
+        R"(${namespace}detail::resultCheck${successCodeList}( result, ${namespaceString} "::${className}${classSeparator}${commandName}" );)";
 
       resultCheck = replaceWithMap( resultCheckTemplate,
                                     { { "className", className },
@@ -10502,6 +11199,185 @@ std::string VulkanHppGenerator::generateReturnVariable( CommandData const &
   return returnVariable;
 }
 
+std::string VulkanHppGenerator::generateSerializeLength( std::string const & structName, std::vector<MemberData> const & members, size_t memberIndex ) const
+{
+  // replace the member names in the len (or altlen) expression by the corresponding member values, which need to be serialized before
+  // returns an empty string, if that's not possible
+  static std::regex const identifierRegex( "[A-Za-z_][A-Za-z0-9_]*" );
+
+  std::string const & lenExpression = members[memberIndex].lenExpressions.front();
+  std::string         length;
+  size_t              pos = 0;
+  for ( auto it = std::sregex_iterator( lenExpression.begin(), lenExpression.end(), identifierRegex ); it != std::sregex_iterator(); ++it )
+  {
+    length += lenExpression.substr( pos, it->position() - pos );
+    pos = it->position() + it->length();
+
+    auto lenMemberIt = findByName( members, it->str() );
+    if ( lenMemberIt == members.end() )
+    {
+      if ( !it->str().starts_with( "VK_" ) )
+      {
+        return "";
+      }
+      length += it->str();  // an API constant
+    }
+    else
+    {
+      if ( ( memberIndex <= static_cast<size_t>( std::distance( members.begin(), lenMemberIt ) ) ) || lenMemberIt->type.isPointer() ||
+           !lenMemberIt->arraySizes.empty() || !lenMemberIt->deprecated.empty() )
+      {
+        return "";
+      }
+      length += "static_cast<size_t>( " + structName + "." + lenMemberIt->name + " )";
+    }
+  }
+  return length + lenExpression.substr( pos );
+}
+
+std::optional<std::pair<std::string, std::string>> VulkanHppGenerator::generateSerializeMember( std::string const &             structName,
+                                                                                                std::vector<MemberData> const & members,
+                                                                                                size_t                          memberIndex,
+                                                                                                std::set<std::string> const &   serializableStructs ) const
+{
+  // returns the code to serialize and to deserialize the member, or nothing, if it can't be serialized
+  MemberData const & member = members[memberIndex];
+  std::string const  name   = structName + "." + member.name;
+
+  auto generate = [&name]( std::string const & serializeFunction, std::string const & deserializeFunction, std::string const & length = "" )
+  {
+    std::string arguments = name + ( length.empty() ? "" : ( ", " + length ) );
+    return std::make_optional( std::make_pair( "      serializer." + serializeFunction + "( " + arguments + " );\n",
+                                               "      deserializer." + deserializeFunction + "( " + arguments + " );\n" ) );
+  };
+  auto isByteCopyable = [this]( std::string const & type )
+  {
+    // anything but a structure, and unions without any pointers; a union holding a pointer can't be told apart from one holding plain data
+    auto structIt = m_structs.find( type );
+    return ( structIt == m_structs.end() ) || ( structIt->second.isUnion && !containsPointer( type ) );
+  };
+
+  if ( ( member.name == "sType" ) || !member.deprecated.empty() )
+  {
+    // the sType is implied by the structure type, and deprecated members are ignored
+    return std::make_optional( std::make_pair( std::string(), std::string() ) );
+  }
+  else if ( member.name == "pNext" )
+  {
+    return std::make_optional( std::make_pair( "      serializeChain( serializer, " + name + " );\n", "      " + name + " = deserializeChain( deserializer );\n" ) );
+  }
+  else if ( !member.arraySizes.empty() )
+  {
+    if ( isByteCopyable( member.type.name ) )
+    {
+      return generate( "writeValue", "readValue" );
+    }
+    if ( ( member.arraySizes.size() == 1 ) && serializableStructs.contains( member.type.name ) )
+    {
+      return std::make_optional( std::make_pair( "      for ( auto const & element : " + name + " )\n      {\n        serializeStructure( serializer, element );\n      }\n",
+                                                 "      for ( auto & element : " + name + " )\n      {\n        deserializeStructure( deserializer, element );\n      }\n" ) );
+    }
+  }
+  else if ( !member.type.isPointer() )
+  {
+    if ( isByteCopyable( member.type.name ) )
+    {
+      return generate( "writeValue", "readValue" );
+    }
+    if ( serializableStructs.contains( member.type.name ) )
+    {
+      return std::make_optional(
+        std::make_pair( "      serializeStructure( serializer, " + name + " );\n", "      deserializeStructure( deserializer, " + name + " );\n" ) );
+    }
+  }
+  else if ( member.type.name == "char" )
+  {
+    if ( ( member.lenExpressions.size() == 1 ) && ( member.lenExpressions[0] == "null-terminated" ) && ( member.type.postfix == "const *" ) )
+    {
+      return generate( "writeString", "readString" );
+    }
+    if ( ( member.lenExpressions.size() == 2 ) && ( member.lenExpressions[1] == "null-terminated" ) && ( member.type.postfix == "const * const *" ) )
+    {
+      std::string length = generateSerializeLength( structName, members, memberIndex );
+      if ( !length.empty() )
+      {
+        return generate( "writeStrings", "readStrings", length );
+      }
+    }
+  }
+  else if ( std::ranges::count( member.type.postfix, '*' ) == 1 )
+  {
+    if ( member.lenExpressions.empty() )
+    {
+      // a pointer to a single structure
+      if ( serializableStructs.contains( member.type.name ) )
+      {
+        return generate( "writeStructures", "readStructures", "1" );
+      }
+    }
+    else if ( member.lenExpressions.size() == 1 )
+    {
+      std::string length = generateSerializeLength( structName, members, memberIndex );
+      if ( !length.empty() )
+      {
+        if ( isByteCopyable( member.type.name ) )
+        {
+          // for void pointers, the length is the number of bytes
+          return generate( "writeValues", "readValues", length );
+        }
+        if ( serializableStructs.contains( member.type.name ) )
+        {
+          return generate( "writeStructures", "readStructures", length );
+        }
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+std::string VulkanHppGenerator::generateSerializeStructures( std::set<std::string> const &                                          serializableStructs,
+                                                             std::function<std::string( std::pair<std::string, StructData> const & )> const & structAction ) const
+{
+  std::string           str;
+  std::set<std::string> listedStructs;
+
+  // list the structures used by a structure along with it, in case they are not required on their own
+  std::function<std::string( std::pair<std::string, StructData> const & )> listStructure =
+    [&]( std::pair<std::string, StructData> const & structure )
+  {
+    std::string structs;
+    if ( serializableStructs.contains( structure.first ) && listedStructs.insert( structure.first ).second )
+    {
+      for ( auto const & member : structure.second.members )
+      {
+        if ( auto structIt = m_structs.find( member.type.name ); structIt != m_structs.end() )
+        {
+          structs += listStructure( *structIt );
+        }
+      }
+      structs += structAction( structure );
+    }
+    return structs;
+  };
+
+  auto generate = [&]( std::vector<RequireData> const & requireData, std::string const & title )
+  {
+    std::string structs;
+    forEachRequiredStruct( requireData, [&]( std::pair<std::string, StructData> const & structure ) { structs += listStructure( structure ); } );
+    return addTitleAndProtection( title, structs );
+  };
+
+  for ( auto const & feature : m_features )
+  {
+    str += generate( feature.requireData, feature.name );
+  }
+  for ( auto const & extension : m_extensions )
+  {
+    str += generate( extension.requireData, extension.name );
+  }
+  return str;
+}
+
 std::string VulkanHppGenerator::generateSizeCheck( std::vector<std::vector<MemberData>::const_iterator> const & arrayIts,
                                                    std::string const &                                          structName,
                                                    bool                                                         mutualExclusiveLens ) const
@@ -10839,7 +11715,12 @@ ${spaceshipMembers}
 #else
       return ${compareMembers};
 #endif)";
-    compareBody                                  = replaceWithMap( compareBodyTemplate, { { "compareMembers", compareMembers } } );
+    if ( determineBitwiseLayout( structData.first ).first != 0 )
+    {
+      // structures with just integral members and no padding are compared as a whole
+      compareMembers = "memcmp( this, &rhs, sizeof( " + stripPrefix( structData.first, "Vk" ) + " ) ) == 0";
+    }
+    compareBody = replaceWithMap( compareBodyTemplate, { { "compareMembers", compareMembers } } );
 
     if ( !containsFuncPointer( structData.first ) )
     {
@@ -11196,16 +12077,30 @@ ${hashSum}
   };
 ${leave})";
 
+    static std::string const bitwiseHashTemplate = R"(
+  ${enter}template <> struct hash<VULKAN_HPP_NAMESPACE::${structureType}>
+  {
+    std::size_t operator()(VULKAN_HPP_NAMESPACE::${structureType} const & ${structureName}) const VULKAN_HPP_NOEXCEPT
+    {
+      return VULKAN_HPP_NAMESPACE::detail::hashBytes( &${structureName}, sizeof( VULKAN_HPP_NAMESPACE::${structureType} ) );
+    }
+  };
+${leave})";
+
     auto [enter, leave] = generateProtection( getProtectFromType( structure.first ) );
 
     std::string structureType = stripPrefix( structure.first, "Vk" );
     std::string structureName = startLowerCase( structureType );
-    str += replaceWithMap( hashTemplate,
-                           { { "enter", enter },
-                             { "hashSum", generateStructHashSum( structureName, structure.second.members ) },
-                             { "leave", leave },
-                             { "structureName", structureName },
-                             { "structureType", structureType } } );
+    // structures with just integral members and no padding are hashed as a whole (see the static assertion following the structure)
+    bool bitwise = ( determineBitwiseLayout( structure.first ).first != 0 );
+    std::map<std::string, std::string> replacements = {
+      { "enter", enter }, { "leave", leave }, { "structureName", structureName }, { "structureType", structureType }
+    };
+    if ( !bitwise )
+    {
+      replacements["hashSum"] = generateStructHashSum( structureName, structure.second.members );
+    }
+    str += replaceWithMap( bitwise ? bitwiseHashTemplate : hashTemplate, replacements );
   }
 
   listedStructs.insert( structure.first );
@@ -11462,7 +12357,7 @@ ${compareOperators}
     public:
 ${members}
   };
-
+${bitwiseLayoutAssertion}
 #if 20 <= VULKAN_HPP_CPP_VERSION
   template <>
   struct CppType<Vk${structureType}>
@@ -11472,6 +12367,19 @@ ${members}
 #endif
 )";
 
+  std::string bitwiseLayoutAssertion;
+  if ( !containsUnion( structure.first ) && ( determineBitwiseLayout( structure.first ).first != 0 ) )
+  {
+    // operator==() and std::hash treat such a structure as a whole; make sure, there's really no padding in it
+    std::string memberSizes;
+    for ( auto const & member : structure.second.members )
+    {
+      memberSizes += " + sizeof( " + structureType + "::" + member.name + " )";
+    }
+    bitwiseLayoutAssertion = "  VULKAN_HPP_STATIC_ASSERT( sizeof( " + structureType + " ) ==" + memberSizes.substr( 2 ) + ", \"" + structureType +
+                             " is compared and hashed bitwise, but has some padding!\" );\n";
+  }
+
   std::string allowDuplicate, typeValue;
   if ( !sTypeValue.empty() )
   {
@@ -11480,6 +12388,7 @@ ${members}
   }
   str += replaceWithMap( structureTemplate,
                          { { "allowDuplicate", allowDuplicate },
+                           { "bitwiseLayoutAssertion", bitwiseLayoutAssertion },
                            { "constructorsAndSetters", constructorsAndSetters },
                            { "compareOperators", compareOperators },
                            { "members", members },
@@ -11771,7 +12680,7 @@ std::string VulkanHppGenerator::generateStructSetter( std::string const & struct
 
         static std::string const setStringTemplate = R"(
 #if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
-    ${structureName} & set${ArrayName}( std::string const & ${arrayName}_ ) VULKAN_HPP_NOEXCEPT
+    ${structureName} & set${ArrayName}( std::string const & ${arrayName}_ ) & VULKAN_HPP_NOEXCEPT
     {
       VULKAN_HPP_ASSERT( ${arrayName}_.size() < ${arraySize} );
 #if defined( _WIN32 )
@@ -11781,6 +12690,11 @@ std::string VulkanHppGenerator::generateStructSetter( std::string const & struct
 #endif
       return *this;
     }
+
+    ${structureName} && set${ArrayName}( std::string const & ${arrayName}_ ) && VULKAN_HPP_NOEXCEPT
+    {
+      return std::move( set${ArrayName}( ${arrayName}_ ) );
+    }
 #endif /*VULKAN_HPP_DISABLE_ENHANCED_MODE*/
 )";
 
@@ -11795,11 +12709,16 @@ std::string VulkanHppGenerator::generateStructSetter( std::string const & struct
         // VkLayerSettingEXT::pValues needs some special handling!
         assert( member.deprecated.empty() && ( member.name == "pValues" ) );
         static std::string const byTypeTemplate =
-          R"(    LayerSettingEXT & setValues( ArrayProxyNoTemporaries<const ${type}> const & values_ ) VULKAN_HPP_NOEXCEPT
+          R"(    LayerSettingEXT & setValues( ArrayProxyNoTemporaries<const ${type}> const & values_ ) & VULKAN_HPP_NOEXCEPT
     {
       valueCount = static_cast<uint32_t>( values_.size() );
       pValues    = values_.data();
       return *this;
+    }
+
+    LayerSettingEXT && setValues( ArrayProxyNoTemporaries<const ${type}> const & values_ ) && VULKAN_HPP_NOEXCEPT
+    {
+      return std::move( setValues( values_ ) );
     })";
 
         static std::string const setArrayTemplate = R"(
@@ -11890,11 +12809,17 @@ ${byString}
 
           static std::string const setArrayTemplate = R"(
 #if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
-    ${deprecated}${templateHeader}${structureName} & set${ArrayName}( ArrayProxyNoTemporaries<${memberType}> const & ${arrayName}_ ) VULKAN_HPP_NOEXCEPT
+    ${deprecated}${templateHeader}${structureName} & set${ArrayName}( ArrayProxyNoTemporaries<${memberType}> const & ${arrayName}_ ) & VULKAN_HPP_NOEXCEPT
     {
       ${functionBody}
       return *this;
     }
+
+    ${deprecated}${templateHeader}${structureName} && set${ArrayName}( ArrayProxyNoTemporaries<${memberType}> const & ${arrayName}_ ) && VULKAN_HPP_NOEXCEPT
+    {
+      ${functionBody}
+      return std::move( *this );
+    }
 #endif /*VULKAN_HPP_DISABLE_ENHANCED_MODE*/
 )";
 
@@ -11913,13 +12838,18 @@ ${byString}
 
           static std::string const setArrayTemplate = R"(
 #if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
-    ${templateHeader}${structureName} & set${ArrayName}( VULKAN_HPP_NAMESPACE::ArrayProxy<${memberType}> const & ${arrayName}_ ) VULKAN_HPP_NOEXCEPT
+    ${templateHeader}${structureName} & set${ArrayName}( VULKAN_HPP_NAMESPACE::ArrayProxy<${memberType}> const & ${arrayName}_ ) & VULKAN_HPP_NOEXCEPT
     {
       VULKAN_HPP_ASSERT( ${arrayName}_.size() <= ${arraySize} );
       ${lenName} = ${lenValue};
       memcpy( ${arrayName}, ${arrayName}_.data(), ${lenName} );
       return *this;
     }
+
+    ${templateHeader}${structureName} && set${ArrayName}( VULKAN_HPP_NAMESPACE::ArrayProxy<${memberType}> const & ${arrayName}_ ) && VULKAN_HPP_NOEXCEPT
+    {
+      return std::move( set${ArrayName}( ${arrayName}_ ) );
+    }
 #endif /*VULKAN_HPP_DISABLE_ENHANCED_MODE*/
 )";
 
@@ -12005,12 +12935,13 @@ std::string VulkanHppGenerator::generateSuccessCodeList( std::vector<std::string
   size_t      skipSize = ( enumerating && ( 1 < successCodes.size() ) && ( successCodes[1] == "VK_INCOMPLETE" ) ) ? 2 : 1;
   if ( skipSize < successCodes.size() )
   {
-    successCodeList = ", { " + generateSuccessCode( successCodes[0] );
+    // the success codes are template arguments of detail::resultCheck
+    successCodeList = "<" + generateSuccessCode( successCodes[0] );
     for ( size_t i = 1; i < successCodes.size(); ++i )
     {
       successCodeList += ", " + generateSuccessCode( successCodes[i] );
     }
-    successCodeList += " }";
+    successCodeList += ">";
   }
   return successCodeList;
 }
@@ -12034,7 +12965,7 @@ std::string VulkanHppGenerator::generateThrowResultException() const
   std::string const throwTemplate = R"(
   namespace detail
   {
-    [[noreturn]] VULKAN_HPP_INLINE void throwResultException( Result result, char const * message )
+    [[noreturn]] VULKAN_HPP_NOINLINE_COLD void throwResultException( Result result, char const * message )
     {
       switch ( result )
       {
@@ -13738,6 +14669,8 @@ int main( int argc, char const ** argv )
     generator.generateHandlesHppFile();
     generator.generateHashHppFile();
     generator.generateMacrosFile();
+    generator.generateNullDriverHppFile();
+    generator.generateSerializeHppFile();
     generator.generateSharedHppFile();
     generator.generateStaticAssertionsHppFile();
     generator.generateStructsHppFile();
@@ -13746,6 +14679,7 @@ int main( int argc, char const ** argv )
     // this modifies the generator data and needs to be done after all the other generations are done
     generator.distributeSecondLevelCommands();
     generator.generateRAIIHppFile();
+    generator.generateRAIICppFile();
   }
   catch ( std::exception const & e )
   {
@@ -9,6 +9,7 @@
 #include <functional>
 #include <iostream>
 #include <map>
+#include <optional>
 #include <set>
 #include <tinyxml2.h>
 #include <vector>
@@ -95,7 +96,10 @@ public:
   void generateHashHppFile() const;
   void generateHppFile() const;
   void generateMacrosFile() const;
+  void generateNullDriverHppFile() const;
+  void generateRAIICppFile() const;
   void generateRAIIHppFile() const;
+  void generateSerializeHppFile() const;
   void generateSharedHppFile() const;
   void generateStaticAssertionsHppFile() const;
   void generateStructsHppFile() const;
@@ -447,8 +451,10 @@ private:
   bool containsDeprecated( std::vector<MemberData> const & members ) const;
   bool containsFuncPointer( std::string const & type ) const;
   bool containsFloatingPoints( std::vector<MemberData> const & members ) const;
+  bool containsPointer( std::string const & type ) const;
   bool containsUnion( std::string const & type ) const;
   bool describesVector( StructData const & structure, std::string const & type = "" ) const;
+  std::pair<size_t, size_t> determineBitwiseLayout( std::string const & type ) const;
   std::vector<size_t>      determineChainedReturnParams( std::vector<ParamData> const & params, std::vector<size_t> const & returnParams ) const;
   std::vector<std::string> determineDataTypes( std::vector<VulkanHppGenerator::ParamData> const & params,
                                                std::map<size_t, VectorParamData> const &          vectorParams,
@@ -462,6 +468,7 @@ private:
   std::vector<std::map<std::string, CommandData>::const_iterator>
     determineRAIIHandleConstructors( std::string const & handleType, std::map<std::string, CommandData>::const_iterator destructorIt ) const;
   std::map<std::string, CommandData>::const_iterator determineRAIIHandleDestructor( std::string const & handleType ) const;
+  std::set<std::string>                              determineSerializableStructs() const;
   std::set<size_t>                        determineSingularParams( size_t returnParam, std::map<size_t, VectorParamData> const & vectorParams ) const;
   std::set<size_t>                        determineSkippedParams( std::vector<ParamData> const &            params,
                                                                   size_t                                    initialSkipCount,
@@ -505,6 +512,7 @@ private:
                                                                   std::vector<size_t> const &               chainedReturnParams,
                                                                   CommandFlavourFlags                       flavourFlags,
                                                                   bool                                      definition ) const;
+  std::string                         generateApiVersionMacro( std::string const & feature ) const;
   std::string                         generateArgumentListEnhanced( std::vector<ParamData> const &            params,
                                                                     std::vector<size_t> const &               returnParams,
                                                                     std::map<size_t, VectorParamData> const & vectorParams,
@@ -529,6 +537,7 @@ private:
   std::string generateBitmasksToString() const;
   std::string generateBitmasksToString( std::vector<RequireData> const & requireData, std::set<std::string> & listedBitmasks, std::string const & title ) const;
   std::string generateBitmaskToString( TypeBitmask const & bitmask ) const;
+  std::string generateBitwiseHashableStructures() const;
   std::string generateCallArgumentsEnhanced( CommandData const &      commandData,
                                              size_t                   initialSkipCount,
                                              bool                     nonConstPointerAsNullptr,
@@ -788,11 +797,15 @@ private:
   std::string generateEnumToString( std::pair<std::string, EnumData> const & enumData ) const;
   std::string generateEnumValueName( std::string const & enumName, std::string const & valueName, bool bitmask ) const;
   std::string generateExtensionDependencies() const;
+  std::string generateExtensionDependencyTable( ExtensionData const & extension ) const;
+  std::string generateExtensionId( std::string const & extensionName ) const;
   template <class Predicate, class Extraction>
   std::string generateExtensionReplacedBy( Predicate p, Extraction e ) const;
   template <class Predicate>
   std::string generateExtensionReplacedTest( Predicate p ) const;
   std::string generateExtensionsList( std::string const & type ) const;
+  template <class Extraction>
+  std::string generateExtensionsTable( Extraction e ) const;
   std::string generateExtensionTypeTest( std::string const & type ) const;
   std::string generateFormatTraits() const;
   std::string generateFormatTraitsCases( EnumData const &                                 enumData,
@@ -819,6 +832,13 @@ private:
   std::string generateHandleHashStructures() const;
   std::string generateHandles() const;
   std::string generateIndexTypeTraits( std::pair<std::string, EnumData> const & enumData ) const;
+  std::string generateInstrumentingDispatcher() const;
+  void        generateInstrumentingDispatcherCommands( std::vector<RequireData> const & requireData,
+                                                       std::set<std::string> &          listedCommands,
+                                                       std::string const &              title,
+                                                       std::string &                    commandBindings,
+                                                       std::string &                    commandMembers,
+                                                       std::string &                    commandNames ) const;
   std::string generateIsDispatchedList() const;
   std::string generateLayerSettingTypeTraits() const;
   std::string
@@ -832,11 +852,20 @@ private:
                                 CommandFlavourFlags                       flavourFlags,
                                 bool                                      vectorSizeCheck,
                                 bool                                      raii ) const;
+  std::string generateNullDriverCommandEntries() const;
+  std::string
+    generateNullDriverCommandEntries( std::vector<RequireData> const & requireData, std::string const & title, std::set<std::string> & listedCommands ) const;
+  std::string generateNullDriverHandleCounts() const;
+  std::string
+    generateNullDriverHandleCounts( std::vector<RequireData> const & requireData, std::string const & title, std::set<std::string> & listedCommands ) const;
+  std::string generateNullDriverStructureSizes() const;
+  std::string
+    generateNullDriverStructureSizes( std::vector<RequireData> const & requireData, std::string const & title, std::set<std::string> & listedStructs ) const;
   std::string generateObjectDeleter( std::string const & commandName, CommandData const & commandData, size_t initialSkipCount, size_t returnParam ) const;
   std::string generateObjectTypeToDebugReportObjectType() const;
   std::pair<std::string, std::string> generateProtection( std::string const & protect, bool defined = true ) const;
   std::string                         generateRAIICommandDefinitions() const;
-  std::string
+  std::pair<std::string, std::string>
     generateRAIICommandDefinitions( std::vector<RequireData> const & requireData, std::set<std::string> & listedCommands, std::string const & title ) const;
   std::string generateRAIIDispatcherCommandsContextInitializers( std::vector<RequireData> const & requireData,
                                                                  std::set<std::string> const &    listedCommands,
@@ -862,7 +891,8 @@ private:
                                                    bool                enumerating,
                                                    std::string const & returnType,
                                                    std::string const & returnVariable,
-                                                   bool                singular ) const;
+                                                   bool                singular,
+                                                   std::string const & vectorAllocator ) const;
   std::string generateRAIIHandle( std::pair<std::string, HandleData> const & handle,
                                   std::set<std::string> &                    listedHandles,
                                   std::set<std::string> const &              specialFunctions ) const;
@@ -972,6 +1002,13 @@ private:
                                       std::vector<size_t> const &               returnParams,
                                       std::map<size_t, VectorParamData> const & vectorParams,
                                       CommandFlavourFlags                       flavourFlags ) const;
+  std::string generateSerializeLength( std::string const & structName, std::vector<MemberData> const & members, size_t memberIndex ) const;
+  std::optional<std::pair<std::string, std::string>> generateSerializeMember( std::string const &             structName,
+                                                                              std::vector<MemberData> const & members,
+                                                                              size_t                          memberIndex,
+                                                                              std::set<std::string> const &   serializableStructs ) const;
+  std::string generateSerializeStructures( std::set<std::string> const &                                          serializableStructs,
+                                           std::function<std::string( std::pair<std::string, StructData> const & )> const & structAction ) const;
   std::string
     generateSizeCheck( std::vector<std::vector<MemberData>::const_iterator> const & arrayIts, std::string const & structName, bool mutualExclusiveLens ) const;
   std::string generateStaticAssertions() const;
@@ -1109,6 +1146,9 @@ private:
   Vkxml                              m_vkxml;
 
   mutable std::set<std::string> m_generatedCommands;
+  // while generating the definitions of a vk::raii command, its function templates are collected here, as they stay in the header with
+  // VULKAN_HPP_COMPILED (see generateRAIICommandDefinitions)
+  mutable std::string m_RAIICommandTemplateDefinitions;
 };
 
 template <typename T>
@@ -9,6 +9,18 @@ public:
 
   VULKAN_HPP_CONSTEXPR ArrayWrapper1D( std::array<T, N> const & data ) VULKAN_HPP_NOEXCEPT : std::array<T, N>( data ) {}
 
+  // allows brace initialization like a plain array, including within designated initializers; char arrays are initialized by strings instead
+  template <typename B = T, typename std::enable_if<!std::is_same<B, char>::value, int>::type = 0>
+  VULKAN_HPP_CONSTEXPR_14 ArrayWrapper1D( std::initializer_list<T> data ) VULKAN_HPP_NOEXCEPT : std::array<T, N>()
+  {
+    VULKAN_HPP_ASSERT( data.size() <= N );
+    size_t i = 0;
+    for ( auto it = data.begin(); ( it != data.end() ) && ( i < N ); ++it, ++i )
+    {
+      ( *this )[i] = *it;
+    }
+  }
+
   template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
   VULKAN_HPP_CONSTEXPR_14 ArrayWrapper1D( std::string const & data ) VULKAN_HPP_NOEXCEPT
   {
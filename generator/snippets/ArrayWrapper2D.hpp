@@ -12,4 +12,16 @@ public:
   VULKAN_HPP_CONSTEXPR ArrayWrapper2D( std::array<std::array<T, M>, N> const & data ) VULKAN_HPP_NOEXCEPT
     : std::array<ArrayWrapper1D<T, M>, N>( *reinterpret_cast<std::array<ArrayWrapper1D<T, M>, N> const *>( &data ) )
   {}
+
+  // allows brace initialization like a plain two-dimensional array, including within designated initializers
+  VULKAN_HPP_CONSTEXPR_14 ArrayWrapper2D( std::initializer_list<ArrayWrapper1D<T, M>> data ) VULKAN_HPP_NOEXCEPT
+    : std::array<ArrayWrapper1D<T, M>, N>()
+  {
+    VULKAN_HPP_ASSERT( data.size() <= N );
+    size_t i = 0;
+    for ( auto it = data.begin(); ( it != data.end() ) && ( i < N ); ++it, ++i )
+    {
+      ( *this )[i] = *it;
+    }
+  }
 };
@@ -7,6 +7,9 @@ ${copyrightMessage}
 #define VULKAN_EXTENSION_INSPECTION_HPP
 
 #if !defined( VULKAN_HPP_CXX_MODULE )
+#  include <algorithm>
+#  include <array>
+#  include <cstring>
 #  include <map>
 #  include <set>
 #  include <string>
@@ -22,6 +25,115 @@ ${copyrightMessage}
 
 VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 {
+  //===========================
+  //=== Extension ids, sets ===
+  //===========================
+
+  // dense ids of the extensions; eUnknown is the id of any unknown extension and the number of known extensions
+  enum class ExtensionId : uint16_t
+  {
+    ${extensionIds}
+    eUnknown
+  };
+
+  // a bitset of extensions, indexed by their ExtensionId
+  class ExtensionSet
+  {
+  public:
+    VULKAN_HPP_CONSTEXPR_14 ExtensionSet() VULKAN_HPP_NOEXCEPT = default;
+
+#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
+    ExtensionSet( ArrayProxy<ExtensionProperties const> const & extensionProperties ) VULKAN_HPP_NOEXCEPT;
+#endif
+
+    VULKAN_HPP_CONSTEXPR_14 ExtensionSet & set( ExtensionId extension ) VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( extension < ExtensionId::eUnknown );
+      m_bits[static_cast<size_t>( extension ) / 64] |= uint64_t( 1 ) << ( static_cast<size_t>( extension ) % 64 );
+      return *this;
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 ExtensionSet & reset( ExtensionId extension ) VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( extension < ExtensionId::eUnknown );
+      m_bits[static_cast<size_t>( extension ) / 64] &= ~( uint64_t( 1 ) << ( static_cast<size_t>( extension ) % 64 ) );
+      return *this;
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 bool test( ExtensionId extension ) const VULKAN_HPP_NOEXCEPT
+    {
+      return ( extension < ExtensionId::eUnknown ) &&
+             ( m_bits[static_cast<size_t>( extension ) / 64] & ( uint64_t( 1 ) << ( static_cast<size_t>( extension ) % 64 ) ) );
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 size_t count() const VULKAN_HPP_NOEXCEPT
+    {
+      size_t count = 0;
+      for ( uint64_t bits : m_bits )
+      {
+        for ( ; bits; bits &= bits - 1 )
+        {
+          ++count;
+        }
+      }
+      return count;
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 bool isSubsetOf( ExtensionSet const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      for ( size_t i = 0; i < wordCount; ++i )
+      {
+        if ( m_bits[i] & ~rhs.m_bits[i] )
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 ExtensionSet & operator|=( ExtensionSet const & rhs ) VULKAN_HPP_NOEXCEPT
+    {
+      for ( size_t i = 0; i < wordCount; ++i )
+      {
+        m_bits[i] |= rhs.m_bits[i];
+      }
+      return *this;
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 bool operator==( ExtensionSet const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return isSubsetOf( rhs ) && rhs.isSubsetOf( *this );
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 bool operator!=( ExtensionSet const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return !operator==( rhs );
+    }
+
+    // calls f( ExtensionId ) for each extension in this set, in ascending order
+    template <typename Function>
+    void forEach( Function f ) const
+    {
+      for ( size_t i = 0; i < wordCount; ++i )
+      {
+        for ( uint64_t bits = m_bits[i]; bits; bits &= bits - 1 )
+        {
+          size_t bit = 0;
+          while ( !( bits & ( uint64_t( 1 ) << bit ) ) )
+          {
+            ++bit;
+          }
+          f( static_cast<ExtensionId>( i * 64 + bit ) );
+        }
+      }
+    }
+
+  private:
+    static VULKAN_HPP_CONST_OR_CONSTEXPR size_t wordCount = ( static_cast<size_t>( ExtensionId::eUnknown ) + 63 ) / 64;
+
+    uint64_t m_bits[wordCount] = {};
+  };
+
   //======================================
   //=== Extension inspection functions ===
   //======================================
@@ -42,6 +154,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
   VULKAN_HPP_CONSTEXPR_20 bool        isObsoletedExtension( std::string const & extension );
   VULKAN_HPP_CONSTEXPR_20 bool        isPromotedExtension( std::string const & extension );
 
+  ExtensionId  getExtensionId( char const * extension ) VULKAN_HPP_NOEXCEPT;
+  char const * getExtensionName( ExtensionId extension ) VULKAN_HPP_NOEXCEPT;
+  uint32_t     getExtensionPromotedToApiVersion( ExtensionId extension ) VULKAN_HPP_NOEXCEPT;
+  bool         resolveExtensionDependencies( ExtensionSet const & requested,
+                                             uint32_t             apiVersion,
+                                             ExtensionSet const & available,
+                                             ExtensionSet &       enabled ) VULKAN_HPP_NOEXCEPT;
+
   //=====================================================
   //=== Extension inspection function implementations ===
   //=====================================================
@@ -156,6 +276,163 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
   {
     return ${promotedTest};
   }
+
+  namespace detail
+  {
+    struct ExtensionDependency
+    {
+      ExtensionId extension;
+      uint32_t    apiVersion;   // the dependency holds from this api version on, up to the next larger apiVersion listed for the same extension
+      uint32_t    alternative;  // all dependencies of an alternative need to be enabled, any one of the alternatives is sufficient
+      ExtensionId dependency;   // ExtensionId::eUnknown for an alternative without any dependency
+    };
+
+    // sorted by extension, then grouped by apiVersion and by alternative
+    VULKAN_HPP_INLINE std::pair<ExtensionDependency const *, ExtensionDependency const *> getExtensionDependencies( ExtensionId extension )
+    {
+      static ExtensionDependency const dependencies[] = { ${extensionDependencyTable}
+                                                          { ExtensionId::eUnknown, 0, 0, ExtensionId::eUnknown } };
+      return std::equal_range( std::begin( dependencies ),
+                               std::prev( std::end( dependencies ) ),
+                               ExtensionDependency{ extension, 0, 0, ExtensionId::eUnknown },
+                               []( ExtensionDependency const & lhs, ExtensionDependency const & rhs ) { return lhs.extension < rhs.extension; } );
+    }
+
+    // not VULKAN_HPP_INLINE, as it's recursive
+    inline bool resolveExtension( ExtensionId extension, uint32_t apiVersion, ExtensionSet const & available, ExtensionSet & enabled )
+    {
+      uint32_t promotedToApiVersion = getExtensionPromotedToApiVersion( extension );
+      if ( enabled.test( extension ) || ( ( promotedToApiVersion != 0 ) && ( promotedToApiVersion <= apiVersion ) ) )
+      {
+        // already enabled, or part of the core api
+        return true;
+      }
+      if ( !available.test( extension ) )
+      {
+        return false;
+      }
+      enabled.set( extension );
+
+      auto dependencies = getExtensionDependencies( extension );
+      if ( dependencies.first == dependencies.second )
+      {
+        return true;
+      }
+
+      // the dependencies are listed for the largest api version not exceeding apiVersion
+      ExtensionDependency const * versionBegin = nullptr;
+      for ( auto dependency = dependencies.first; dependency != dependencies.second; ++dependency )
+      {
+        if ( ( dependency->apiVersion <= apiVersion ) && ( !versionBegin || ( versionBegin->apiVersion < dependency->apiVersion ) ) )
+        {
+          versionBegin = dependency;
+        }
+      }
+      if ( !versionBegin )
+      {
+        // the extension is not supported on this api version
+        return false;
+      }
+      ExtensionDependency const * versionEnd = versionBegin;
+      while ( ( versionEnd != dependencies.second ) && ( versionEnd->apiVersion == versionBegin->apiVersion ) )
+      {
+        ++versionEnd;
+      }
+
+      // of all the alternatives that can be resolved, choose the one adding the fewest extensions
+      ExtensionSet resolved;
+      size_t       resolvedCount = 0;
+      bool         isResolved    = false;
+      for ( auto alternativeBegin = versionBegin; alternativeBegin != versionEnd; )
+      {
+        ExtensionSet trial   = enabled;
+        bool         success = true;
+        auto         it      = alternativeBegin;
+        for ( ; ( it != versionEnd ) && ( it->alternative == alternativeBegin->alternative ); ++it )
+        {
+          success = success && ( ( it->dependency == ExtensionId::eUnknown ) || resolveExtension( it->dependency, apiVersion, available, trial ) );
+        }
+        if ( success && ( !isResolved || ( trial.count() < resolvedCount ) ) )
+        {
+          resolved      = trial;
+          resolvedCount = trial.count();
+          isResolved    = true;
+        }
+        alternativeBegin = it;
+      }
+      if ( isResolved )
+      {
+        enabled = resolved;
+      }
+      return isResolved;
+    }
+  }  // namespace detail
+
+#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
+  VULKAN_HPP_INLINE ExtensionSet::ExtensionSet( ArrayProxy<ExtensionProperties const> const & extensionProperties ) VULKAN_HPP_NOEXCEPT
+  {
+    for ( auto const & properties : extensionProperties )
+    {
+      ExtensionId extension = getExtensionId( properties.extensionName );
+      if ( extension != ExtensionId::eUnknown )
+      {
+        set( extension );
+      }
+    }
+  }
+#endif
+
+  VULKAN_HPP_INLINE ExtensionId getExtensionId( char const * extension ) VULKAN_HPP_NOEXCEPT
+  {
+    static std::array<ExtensionId, static_cast<size_t>( ExtensionId::eUnknown )> const sortedIds = []()
+    {
+      std::array<ExtensionId, static_cast<size_t>( ExtensionId::eUnknown )> ids;
+      for ( size_t i = 0; i < ids.size(); ++i )
+      {
+        ids[i] = static_cast<ExtensionId>( i );
+      }
+      std::sort( ids.begin(), ids.end(), []( ExtensionId lhs, ExtensionId rhs ) { return strcmp( getExtensionName( lhs ), getExtensionName( rhs ) ) < 0; } );
+      return ids;
+    }();
+    auto it = std::lower_bound(
+      sortedIds.begin(), sortedIds.end(), extension, []( ExtensionId id, char const * name ) { return strcmp( getExtensionName( id ), name ) < 0; } );
+    return ( ( it != sortedIds.end() ) && ( strcmp( getExtensionName( *it ), extension ) == 0 ) ) ? *it : ExtensionId::eUnknown;
+  }
+
+  VULKAN_HPP_INLINE char const * getExtensionName( ExtensionId extension ) VULKAN_HPP_NOEXCEPT
+  {
+    static char const * const names[] = { ${extensionNames}
+                                          "" };
+    VULKAN_HPP_ASSERT( extension <= ExtensionId::eUnknown );
+    return names[static_cast<size_t>( extension )];
+  }
+
+  // the core api version an extension has been promoted to, or 0 if it has not been promoted to core
+  VULKAN_HPP_INLINE uint32_t getExtensionPromotedToApiVersion( ExtensionId extension ) VULKAN_HPP_NOEXCEPT
+  {
+    static uint32_t const apiVersions[] = { ${extensionPromotedToApiVersions}
+                                            0 };
+    VULKAN_HPP_ASSERT( extension <= ExtensionId::eUnknown );
+    return apiVersions[static_cast<size_t>( extension )];
+  }
+
+  // determines the set of extensions to enable, for using the requested extensions on the given api version with the available extensions;
+  // extensions promoted to a core version not exceeding apiVersion are never enabled, but considered to be always available
+  // returns false, with an empty set of enabled extensions, if any of the requested extensions can't be resolved
+  VULKAN_HPP_INLINE bool resolveExtensionDependencies( ExtensionSet const & requested,
+                                                       uint32_t             apiVersion,
+                                                       ExtensionSet const & available,
+                                                       ExtensionSet &       enabled ) VULKAN_HPP_NOEXCEPT
+  {
+    // ignore the patch version
+    apiVersion |= 0xFFF;
+
+    ExtensionSet resolved;
+    bool         success = true;
+    requested.forEach( [&]( ExtensionId extension ) { success = success && detail::resolveExtension( extension, apiVersion, available, resolved ); } );
+    enabled = success ? resolved : ExtensionSet();
+    return success;
+  }
 }  // namespace VULKAN_HPP_NAMESPACE
 
 #endif
@@ -10,6 +10,101 @@ ${copyrightMessage}
 #  include <vulkan/${api}.hpp>
 #endif
 
+VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
+{
+  namespace detail
+  {
+    // hashes the bytes of an object eight at a time, with a final avalanche step (from splitmix64)
+    // only used for values without padding, holding just integral values
+    // larger blocks are spread over four independent lanes, to keep several multiplications in flight at a time;
+    // the lanes are kept in scalar registers, as vectorizing 64-bit multiplications without AVX-512 is slower
+    inline std::size_t hashBytes( void const * data, std::size_t size ) VULKAN_HPP_NOEXCEPT
+    {
+      uint64_t const  multiplier = 0xBF58476D1CE4E5B9ull;
+      uint8_t const * bytes      = static_cast<uint8_t const *>( data );
+      uint64_t        hash       = 0x9E3779B97F4A7C15ull ^ size;
+      if ( 32 <= size )
+      {
+        uint64_t lane0 = hash;
+        uint64_t lane1 = hash + multiplier;
+        uint64_t lane2 = hash ^ 0x94D049BB133111EBull;
+        uint64_t lane3 = hash - 0x9E3779B97F4A7C15ull;
+        for ( ; 32 <= size; bytes += 32, size -= 32 )
+        {
+          uint64_t words[4];
+          memcpy( words, bytes, 32 );
+          lane0 = ( lane0 ^ words[0] ) * multiplier;
+          lane1 = ( lane1 ^ words[1] ) * multiplier;
+          lane2 = ( lane2 ^ words[2] ) * multiplier;
+          lane3 = ( lane3 ^ words[3] ) * multiplier;
+          lane0 ^= lane0 >> 29;
+          lane1 ^= lane1 >> 29;
+          lane2 ^= lane2 >> 29;
+          lane3 ^= lane3 >> 29;
+        }
+        hash = ( lane0 ^ ( lane1 >> 32 | lane1 << 32 ) ) * multiplier;
+        hash = ( hash ^ lane2 ^ ( hash >> 29 ) ) * multiplier;
+        hash = ( hash ^ lane3 ^ ( hash >> 29 ) ) * multiplier;
+        hash ^= hash >> 29;
+      }
+      for ( ; 8 <= size; bytes += 8, size -= 8 )
+      {
+        uint64_t word;
+        memcpy( &word, bytes, 8 );
+        hash = ( hash ^ word ) * multiplier;
+        hash ^= hash >> 29;
+      }
+      if ( size )
+      {
+        uint64_t word = 0;
+        memcpy( &word, bytes, size );
+        hash = ( hash ^ word ) * multiplier;
+        hash ^= hash >> 29;
+      }
+      hash = ( hash ^ ( hash >> 30 ) ) * multiplier;
+      hash = ( hash ^ ( hash >> 27 ) ) * 0x94D049BB133111EBull;
+      return static_cast<std::size_t>( hash ^ ( hash >> 31 ) );
+    }
+
+    // types whose values are equal exactly if their bytes are equal
+    template <typename T>
+    struct isBitwiseHashable
+      : std::integral_constant<bool, std::is_integral<T>::value || std::is_enum<T>::value || isVulkanHandleType<T>::value>
+    {
+    };
+
+    template <typename BitType>
+    struct isBitwiseHashable<Flags<BitType>> : std::true_type
+    {
+    };
+${bitwiseHashableStructures}
+    template <typename T>
+    std::size_t hashRange( T const * data, std::size_t count, std::true_type /*bitwise*/ ) VULKAN_HPP_NOEXCEPT
+    {
+      return hashBytes( data, count * sizeof( T ) );
+    }
+
+    template <typename T>
+    std::size_t hashRange( T const * data, std::size_t count, std::false_type /*bitwise*/ ) VULKAN_HPP_NOEXCEPT
+    {
+      std::size_t seed = count;
+      for ( std::size_t i = 0; i < count; ++i )
+      {
+        seed ^= std::hash<T>{}( data[i] ) + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 );
+      }
+      return seed;
+    }
+  }  // namespace detail
+
+  // hashes a contiguous range of values
+  // handles, enums, flags, integral values, and structures holding just those, are hashed all at once, anything else element by element
+  template <typename T>
+  std::size_t hashRange( T const * data, std::size_t count ) VULKAN_HPP_NOEXCEPT
+  {
+    return detail::hashRange( data, count, detail::isBitwiseHashable<T>() );
+  }
+}  // namespace VULKAN_HPP_NAMESPACE
+
 VULKAN_HPP_EXPORT namespace std
 {
   //=======================================
@@ -26,6 +121,40 @@ VULKAN_HPP_EXPORT namespace std
     }
   };
 
+  //=========================================================
+  //=== HASH structures for ArrayWrapper1D and ArrayProxy ===
+  //=========================================================
+
+  template <typename T, size_t N>
+  struct hash<VULKAN_HPP_NAMESPACE::ArrayWrapper1D<T, N>>
+  {
+    std::size_t operator()( VULKAN_HPP_NAMESPACE::ArrayWrapper1D<T, N> const & arrayWrapper ) const VULKAN_HPP_NOEXCEPT
+    {
+      return VULKAN_HPP_NAMESPACE::hashRange( arrayWrapper.data(), N );
+    }
+  };
+
+  // arrays of chars are compared as strings, and are hashed as such
+  template <size_t N>
+  struct hash<VULKAN_HPP_NAMESPACE::ArrayWrapper1D<char, N>>
+  {
+    std::size_t operator()( VULKAN_HPP_NAMESPACE::ArrayWrapper1D<char, N> const & arrayWrapper ) const VULKAN_HPP_NOEXCEPT
+    {
+      return VULKAN_HPP_NAMESPACE::detail::hashBytes( arrayWrapper.data(), strnlen( arrayWrapper.data(), N ) );
+    }
+  };
+
+#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
+  template <typename T>
+  struct hash<VULKAN_HPP_NAMESPACE::ArrayProxy<T>>
+  {
+    std::size_t operator()( VULKAN_HPP_NAMESPACE::ArrayProxy<T> const & arrayProxy ) const VULKAN_HPP_NOEXCEPT
+    {
+      return VULKAN_HPP_NAMESPACE::hashRange( arrayProxy.data(), arrayProxy.size() );
+    }
+  };
+#endif
+
 ${handleHashStructures}
 ${structHashStructures}
 } // namespace std
@@ -18,6 +18,13 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 #  if !defined( VULKAN_HPP_DEFAULT_DISPATCHER_HANDLED ) && VULKAN_HPP_DISPATCH_LOADER_DYNAMIC == 1
     extern VULKAN_HPP_STORAGE_API DispatchLoaderDynamic defaultDispatchLoaderDynamic;
 #  endif
+
+#  if defined( VULKAN_HPP_ENABLE_INSTRUMENTING_DISPATCHER )
+    template <typename Inner>
+    class InstrumentingDispatcher;
+
+    extern VULKAN_HPP_STORAGE_API InstrumentingDispatcher<DispatchLoaderDynamic> defaultInstrumentingDispatcher;
+#  endif
   }  // namespace detail
 }  // namespace VULKAN_HPP_NAMESPACE
 
@@ -87,6 +94,9 @@ ${throwResultException}
 #endif
 
 ${ResultValue}
+#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
+${QueryResultView}
+#endif
 ${resultChecks}
 ${constexprDefines}
 } // namespace VULKAN_HPP_NAMESPACE
@@ -108,6 +118,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
   {
     ${DynamicLoader}
     ${DispatchLoaderDynamic}
+    ${InstrumentingDispatcher}
 #   if defined( VULKAN_HPP_CXX_MODULE ) && !defined( VULKAN_HPP_DEFAULT_DISPATCHER_HANDLED ) && VULKAN_HPP_DISPATCH_LOADER_DYNAMIC == 1
       VULKAN_HPP_STORAGE_API DispatchLoaderDynamic defaultDispatchLoaderDynamic;
 #   endif
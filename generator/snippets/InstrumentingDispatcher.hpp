@@ -0,0 +1,369 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+#if defined( VULKAN_HPP_ENABLE_INSTRUMENTING_DISPATCHER )
+//===============================
+//=== InstrumentingDispatcher ===
+//===============================
+
+VULKAN_HPP_CONSTEXPR_INLINE uint32_t instrumentedCommandCount            = ${commandCount};
+VULKAN_HPP_CONSTEXPR_INLINE uint32_t instrumentationHistogramBucketCount = 32;
+
+inline char const * const * instrumentedCommandNames() VULKAN_HPP_NOEXCEPT
+{
+  static char const * const names[instrumentedCommandCount] = {
+${commandNames}
+  };
+  return names;
+}
+
+// the counters of one thread; they are written only by that thread, so relaxed loads and stores suffice, and a snapshot can read them
+// concurrently
+struct InstrumentationCounters
+{
+  std::atomic<uint64_t>     counts[instrumentedCommandCount];
+  std::atomic<uint64_t>     ticks[instrumentedCommandCount];
+  std::atomic<uint64_t>     histograms[instrumentedCommandCount][instrumentationHistogramBucketCount];
+  std::atomic<bool>         inUse;
+  InstrumentationCounters * next;
+};
+
+inline std::atomic<InstrumentationCounters *> & instrumentationCountersList() VULKAN_HPP_NOEXCEPT
+{
+  static std::atomic<InstrumentationCounters *> list( nullptr );
+  return list;
+}
+
+inline std::atomic<bool> & instrumentationTimingEnabled() VULKAN_HPP_NOEXCEPT
+{
+  static std::atomic<bool> timingEnabled( false );
+  return timingEnabled;
+}
+
+// the counters are never freed: when a thread exits, its counters are handed over to the next thread that starts calling commands,
+// such that no counts get lost
+inline InstrumentationCounters * acquireInstrumentationCounters()
+{
+  std::atomic<InstrumentationCounters *> & list = instrumentationCountersList();
+  for ( InstrumentationCounters * counters = list.load( std::memory_order_acquire ); counters; counters = counters->next )
+  {
+    bool inUse = false;
+    if ( counters->inUse.compare_exchange_strong( inUse, true, std::memory_order_acquire ) )
+    {
+      return counters;
+    }
+  }
+
+  InstrumentationCounters * counters = new InstrumentationCounters();
+  for ( uint32_t i = 0; i < instrumentedCommandCount; ++i )
+  {
+    counters->counts[i].store( 0, std::memory_order_relaxed );
+    counters->ticks[i].store( 0, std::memory_order_relaxed );
+    for ( uint32_t j = 0; j < instrumentationHistogramBucketCount; ++j )
+    {
+      counters->histograms[i][j].store( 0, std::memory_order_relaxed );
+    }
+  }
+  counters->inUse.store( true, std::memory_order_relaxed );
+  counters->next = list.load( std::memory_order_relaxed );
+  while ( !list.compare_exchange_weak( counters->next, counters, std::memory_order_release, std::memory_order_relaxed ) )
+    ;
+  return counters;
+}
+
+struct InstrumentationThreadSlot
+{
+  ~InstrumentationThreadSlot()
+  {
+    if ( counters )
+    {
+      counters->inUse.store( false, std::memory_order_release );
+    }
+  }
+
+  InstrumentationCounters * counters = nullptr;
+};
+
+inline InstrumentationCounters & threadInstrumentationCounters()
+{
+  static thread_local InstrumentationThreadSlot slot;
+  if ( !slot.counters )
+  {
+    slot.counters = acquireInstrumentationCounters();
+  }
+  return *slot.counters;
+}
+
+// a cheap, monotonic tick counter: the time-stamp counter on x86, std::chrono::steady_clock otherwise
+inline uint64_t instrumentationTicks() VULKAN_HPP_NOEXCEPT
+{
+#  if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+  return __rdtsc();
+#  elif ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+  return __builtin_ia32_rdtsc();
+#  else
+  return static_cast<uint64_t>( std::chrono::steady_clock::now().time_since_epoch().count() );
+#  endif
+}
+
+inline void incrementInstrumentationCounter( std::atomic<uint64_t> & counter, uint64_t value ) VULKAN_HPP_NOEXCEPT
+{
+  // no read-modify-write needed, as only the owning thread writes
+  counter.store( counter.load( std::memory_order_relaxed ) + value, std::memory_order_relaxed );
+}
+
+class InstrumentationScope
+{
+public:
+  explicit InstrumentationScope( uint32_t commandIndex )
+    : m_counters( threadInstrumentationCounters() )
+    , m_commandIndex( commandIndex )
+    , m_start( instrumentationTimingEnabled().load( std::memory_order_relaxed ) ? instrumentationTicks() : 0 )
+  {
+    incrementInstrumentationCounter( m_counters.counts[commandIndex], 1 );
+  }
+
+  ~InstrumentationScope()
+  {
+    if ( m_start )
+    {
+      uint64_t ticks = instrumentationTicks() - m_start;
+      incrementInstrumentationCounter( m_counters.ticks[m_commandIndex], ticks );
+
+      // bucket i holds the durations in [2^i, 2^(i+1)) ticks, bucket 0 also the ones below 1 tick
+      uint32_t bucket = 0;
+      for ( uint32_t shift = 32; 0 < shift; shift /= 2 )
+      {
+        if ( ticks >> shift )
+        {
+          ticks >>= shift;
+          bucket += shift;
+        }
+      }
+      incrementInstrumentationCounter( m_counters.histograms[m_commandIndex][( std::min )( bucket, instrumentationHistogramBucketCount - 1 )], 1 );
+    }
+  }
+
+  InstrumentationScope( InstrumentationScope const & )             = delete;
+  InstrumentationScope & operator=( InstrumentationScope const & ) = delete;
+
+private:
+  InstrumentationCounters & m_counters;
+  uint32_t                  m_commandIndex;
+  uint64_t                  m_start;
+};
+
+// a callable stand-in for a PFN_vk* member, counting (and optionally timing) each call before forwarding it
+template <typename PFN>
+class InstrumentedCommand;
+
+template <typename ReturnType, typename... Args>
+class InstrumentedCommand<ReturnType( VKAPI_PTR * )( Args... )>
+{
+public:
+  using PFNType = ReturnType( VKAPI_PTR * )( Args... );
+
+  void bind( PFNType pfn, uint32_t commandIndex ) VULKAN_HPP_NOEXCEPT
+  {
+    m_pfn          = pfn;
+    m_commandIndex = commandIndex;
+  }
+
+  ReturnType operator()( Args... args ) const
+  {
+    InstrumentationScope scope( m_commandIndex );
+    return m_pfn( args... );
+  }
+
+  explicit operator bool() const VULKAN_HPP_NOEXCEPT
+  {
+    return m_pfn != nullptr;
+  }
+
+  PFNType get() const VULKAN_HPP_NOEXCEPT
+  {
+    return m_pfn;
+  }
+
+private:
+  PFNType  m_pfn          = nullptr;
+  uint32_t m_commandIndex = 0;
+};
+
+// keeps the layout of an InstrumentingDispatcher independent of the platform defines, like the placeholders in DispatchLoaderDynamic
+struct InstrumentedCommandPlaceholder
+{
+  void *   pfn          = nullptr;
+  uint32_t commandIndex = 0;
+};
+
+struct InstrumentedCommandStatistics
+{
+  char const *                                              name;
+  uint64_t                                                  count;
+  uint64_t                                                  ticks;      // sum of the measured durations
+  std::array<uint64_t, instrumentationHistogramBucketCount> histogram;  // see InstrumentationScope for the bucket ranges
+};
+
+// Access to the counts and durations recorded by all InstrumentingDispatchers, summed up over all threads.
+class Instrumentation
+{
+public:
+  // timing is off by default, leaving just the counting on each call
+  static void enableTiming( bool enable ) VULKAN_HPP_NOEXCEPT
+  {
+    instrumentationTimingEnabled().store( enable, std::memory_order_relaxed );
+  }
+
+  static bool timingEnabled() VULKAN_HPP_NOEXCEPT
+  {
+    return instrumentationTimingEnabled().load( std::memory_order_relaxed );
+  }
+
+  // calibrates the tick counter against std::chrono::steady_clock once, which takes about 10 milliseconds
+  static double ticksPerNanosecond()
+  {
+    static double const ticksPerNanosecond = []()
+    {
+      std::chrono::steady_clock::time_point startTime  = std::chrono::steady_clock::now();
+      uint64_t                              startTicks = instrumentationTicks();
+      std::chrono::steady_clock::time_point endTime;
+      do
+      {
+        endTime = std::chrono::steady_clock::now();
+      } while ( endTime - startTime < std::chrono::milliseconds( 10 ) );
+      uint64_t endTicks = instrumentationTicks();
+      return static_cast<double>( endTicks - startTicks ) /
+             static_cast<double>( std::chrono::duration_cast<std::chrono::nanoseconds>( endTime - startTime ).count() );
+    }();
+    return ticksPerNanosecond;
+  }
+
+  static std::vector<InstrumentedCommandStatistics> snapshot( bool includeUncalledCommands = false )
+  {
+    std::vector<InstrumentedCommandStatistics> statistics( instrumentedCommandCount );
+    for ( uint32_t i = 0; i < instrumentedCommandCount; ++i )
+    {
+      statistics[i].name  = instrumentedCommandNames()[i];
+      statistics[i].count = 0;
+      statistics[i].ticks = 0;
+      statistics[i].histogram.fill( 0 );
+    }
+    for ( InstrumentationCounters * counters = instrumentationCountersList().load( std::memory_order_acquire ); counters; counters = counters->next )
+    {
+      for ( uint32_t i = 0; i < instrumentedCommandCount; ++i )
+      {
+        statistics[i].count += counters->counts[i].load( std::memory_order_relaxed );
+        statistics[i].ticks += counters->ticks[i].load( std::memory_order_relaxed );
+        for ( uint32_t j = 0; j < instrumentationHistogramBucketCount; ++j )
+        {
+          statistics[i].histogram[j] += counters->histograms[i][j].load( std::memory_order_relaxed );
+        }
+      }
+    }
+    if ( !includeUncalledCommands )
+    {
+      statistics.erase( std::remove_if( statistics.begin(),
+                                        statistics.end(),
+                                        []( InstrumentedCommandStatistics const & commandStatistics ) { return commandStatistics.count == 0; } ),
+                        statistics.end() );
+    }
+    return statistics;
+  }
+
+  // calls recorded concurrently to a reset might survive it
+  static void reset() VULKAN_HPP_NOEXCEPT
+  {
+    for ( InstrumentationCounters * counters = instrumentationCountersList().load( std::memory_order_acquire ); counters; counters = counters->next )
+    {
+      for ( uint32_t i = 0; i < instrumentedCommandCount; ++i )
+      {
+        counters->counts[i].store( 0, std::memory_order_relaxed );
+        counters->ticks[i].store( 0, std::memory_order_relaxed );
+        for ( uint32_t j = 0; j < instrumentationHistogramBucketCount; ++j )
+        {
+          counters->histograms[i][j].store( 0, std::memory_order_relaxed );
+        }
+      }
+    }
+  }
+
+  // one line per command: name,count,ticks,nanoseconds,bucket0,...,bucket31
+  static std::string toCSV( std::vector<InstrumentedCommandStatistics> const & statistics )
+  {
+    double      nanosecondsPerTick = 1.0 / ticksPerNanosecond();
+    std::string csv                = "command,count,ticks,nanoseconds";
+    for ( uint32_t j = 0; j < instrumentationHistogramBucketCount; ++j )
+    {
+      csv += ",bucket" + std::to_string( j );
+    }
+    csv += "\n";
+    for ( auto const & commandStatistics : statistics )
+    {
+      csv += std::string( commandStatistics.name ) + "," + std::to_string( commandStatistics.count ) + "," + std::to_string( commandStatistics.ticks ) + "," +
+             std::to_string( commandStatistics.ticks * nanosecondsPerTick );
+      for ( auto bucket : commandStatistics.histogram )
+      {
+        csv += "," + std::to_string( bucket );
+      }
+      csv += "\n";
+    }
+    return csv;
+  }
+
+  static std::string toJSON( std::vector<InstrumentedCommandStatistics> const & statistics )
+  {
+    std::string json = "{\n  \"ticksPerNanosecond\": " + std::to_string( ticksPerNanosecond() ) + ",\n  \"commands\": [";
+    for ( size_t i = 0; i < statistics.size(); ++i )
+    {
+      json += std::string( i ? "," : "" ) + "\n    { \"name\": \"" + statistics[i].name + "\", \"count\": " + std::to_string( statistics[i].count ) +
+              ", \"ticks\": " + std::to_string( statistics[i].ticks ) + ", \"histogram\": [";
+      for ( uint32_t j = 0; j < instrumentationHistogramBucketCount; ++j )
+      {
+        json += ( j ? ", " : "" ) + std::to_string( statistics[i].histogram[j] );
+      }
+      json += "] }";
+    }
+    json += "\n  ]\n}\n";
+    return json;
+  }
+};
+
+// A dispatcher with the same members as the Inner one (typically a DispatchLoaderDynamic), but each of them wrapped into an
+// InstrumentedCommand. It owns the Inner dispatcher and forwards init() to it.
+template <typename Inner>
+class InstrumentingDispatcher : public DispatchLoaderBase
+{
+public:
+  ${commandMembers}
+
+public:
+  InstrumentingDispatcher() VULKAN_HPP_NOEXCEPT = default;
+
+  explicit InstrumentingDispatcher( Inner const & inner ) : m_inner( inner )
+  {
+    bind();
+  }
+
+  template <typename... Args>
+  void init( Args &&... args )
+  {
+    m_inner.init( std::forward<Args>( args )... );
+    bind();
+  }
+
+  Inner const & getInner() const VULKAN_HPP_NOEXCEPT
+  {
+    return m_inner;
+  }
+
+  // to be called after the Inner dispatcher has been modified directly
+  void bind() VULKAN_HPP_NOEXCEPT
+  {
+    ${commandBindings}
+  }
+
+private:
+  Inner m_inner;
+};
+#endif
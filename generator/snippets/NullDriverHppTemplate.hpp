@@ -0,0 +1,475 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+${copyrightMessage}
+
+#ifndef VULKAN_NULL_DRIVER_HPP
+#define VULKAN_NULL_DRIVER_HPP
+
+#include <vulkan/${api}.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+// A driver implementing every command as a deterministic no-op, for running code using vulkan.hpp without any Vulkan loader or device:
+//  - commands returning a VkResult return VK_SUCCESS (or VK_INCOMPLETE, see below), all other commands return zero
+//  - each created, allocated, or otherwise returned handle is a new, unique value
+//  - two-call enumerations report NullDriverConfiguration::enumerationCount elements
+//  - returned structures are zeroed, except for sType and pNext, and so is each structure in their pNext chains
+//  - returned scalars are zeroed, and mapping memory returns NullDriverConfiguration::mappedMemory
+namespace VULKAN_HPP_NAMESPACE
+{
+  namespace detail
+  {
+    //==================
+    //=== NullDriver ===
+    //==================
+
+    // to be set up before any command is called
+    struct NullDriverConfiguration
+    {
+      uint32_t apiVersion       = VK_HEADER_VERSION_COMPLETE;  // returned by vkEnumerateInstanceVersion
+      uint32_t enumerationCount = 1;                           // number of elements returned by each two-call enumeration
+      void *   mappedMemory     = nullptr;                     // returned by vkMapMemory and friends; a static block of 1 MiB if nullptr
+
+      // commands to use instead of the null ones, looked up by name
+      std::vector<std::pair<std::string, PFN_vkVoidFunction>> overrides;
+    };
+
+    class NullDriver
+    {
+    public:
+      static NullDriverConfiguration & configuration() VULKAN_HPP_NOEXCEPT
+      {
+        static NullDriverConfiguration nullDriverConfiguration;
+        return nullDriverConfiguration;
+      }
+
+      static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getInstanceProcAddr( VkInstance, char const * pName )
+      {
+        return getProcAddr( pName );
+      }
+
+      static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getDeviceProcAddr( VkDevice, char const * pName )
+      {
+        return getProcAddr( pName );
+      }
+
+      template <typename HandleType>
+      static HandleType nextHandle() VULKAN_HPP_NOEXCEPT
+      {
+        static std::atomic<uint64_t> handleCounter( 0 );
+        return makeHandle<HandleType>( handleCounter.fetch_add( 1, std::memory_order_relaxed ) + 1, std::is_pointer<HandleType>() );
+      }
+
+      static void * mappedMemory() VULKAN_HPP_NOEXCEPT
+      {
+        static uint64_t memoryBlock[( 1 << 20 ) / sizeof( uint64_t )];
+        return configuration().mappedMemory ? configuration().mappedMemory : memoryBlock;
+      }
+
+    private:
+      template <typename HandleType>
+      static HandleType makeHandle( uint64_t value, std::true_type /*isPointer*/ ) VULKAN_HPP_NOEXCEPT
+      {
+        return reinterpret_cast<HandleType>( static_cast<uintptr_t>( value ) );
+      }
+
+      template <typename HandleType>
+      static HandleType makeHandle( uint64_t value, std::false_type /*isPointer*/ ) VULKAN_HPP_NOEXCEPT
+      {
+        return static_cast<HandleType>( value );
+      }
+
+      static VKAPI_ATTR VkResult VKAPI_CALL enumerateInstanceVersion( uint32_t * pApiVersion )
+      {
+        *pApiVersion = configuration().apiVersion;
+        return VK_SUCCESS;
+      }
+
+      static PFN_vkVoidFunction getProcAddr( char const * pName );
+    };
+
+    // the size of the structure identified by structureType, or 0 for an unknown one
+    inline size_t nullDriverStructureSize( VkStructureType structureType ) VULKAN_HPP_NOEXCEPT
+    {
+      switch ( structureType )
+      {
+${structureSizes}
+        default: return 0;
+      }
+    }
+
+    // the kinds of output parameters
+    struct NullDriverCountOutput
+    {
+    };
+
+    struct NullDriverHandleOutput
+    {
+    };
+
+    struct NullDriverMemoryOutput
+    {
+    };
+
+    struct NullDriverBytesOutput
+    {
+    };
+
+    struct NullDriverStructureOutput
+    {
+    };
+
+    struct NullDriverValueOutput
+    {
+    };
+
+    template <typename T>
+    struct NullDriverOutputKind
+    {
+      using type = typename std::conditional<
+        std::is_same<T, size_t>::value,
+        NullDriverCountOutput,
+        typename std::conditional<std::is_class<T>::value, NullDriverStructureOutput, NullDriverValueOutput>::type>::type;
+    };
+
+    // handles are pointers to incomplete structs, any other pointer is some memory
+    template <typename T>
+    struct NullDriverOutputKind<T *>
+    {
+      using type = typename std::conditional<std::is_class<T>::value, NullDriverHandleOutput, NullDriverMemoryOutput>::type;
+    };
+
+    template <>
+    struct NullDriverOutputKind<void>
+    {
+      using type = NullDriverBytesOutput;
+    };
+
+    // a uint32_t or size_t might be the count of an enumeration
+    template <>
+    struct NullDriverOutputKind<uint32_t>
+    {
+      using type = NullDriverCountOutput;
+    };
+
+    // on 32-bit platforms, the non-dispatchable handles are uint64_t; otherwise, a uint64_t is treated like a size_t
+    template <>
+    struct NullDriverOutputKind<uint64_t>
+    {
+#if ( VK_USE_64_BIT_PTR_DEFINES == 1 )
+      using type = NullDriverCountOutput;
+#else
+      using type = NullDriverHandleOutput;
+#endif
+    };
+
+    template <typename T, typename = void>
+    struct NullDriverHasStructureType : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct NullDriverHasStructureType<T, decltype( (void)std::declval<T &>().sType )> : std::true_type
+    {
+    };
+
+    template <typename ReturnType>
+    struct NullDriverResult
+    {
+      static ReturnType get( bool /*incomplete*/ ) VULKAN_HPP_NOEXCEPT
+      {
+        return ReturnType();
+      }
+    };
+
+    template <>
+    struct NullDriverResult<VkResult>
+    {
+      static VkResult get( bool incomplete ) VULKAN_HPP_NOEXCEPT
+      {
+        return incomplete ? VK_INCOMPLETE : VK_SUCCESS;
+      }
+    };
+
+    // Walks through the parameters of one call, in order, writing the outputs. A count output directly followed by an array output is
+    // treated as a two-call enumeration; all array outputs directly following it share its count.
+    class NullDriverCall
+    {
+    public:
+      explicit NullDriverCall( uint32_t handleCount ) VULKAN_HPP_NOEXCEPT : m_handleCount( handleCount ) {}
+
+      template <typename T>
+      void process( T const &, std::false_type /*isOutput*/ ) VULKAN_HPP_NOEXCEPT
+      {
+        endEnumeration();
+      }
+
+      template <typename T>
+      void process( T * pOutput, std::true_type /*isOutput*/ ) VULKAN_HPP_NOEXCEPT
+      {
+        output( pOutput, typename NullDriverOutputKind<T>::type() );
+      }
+
+      template <typename ReturnType>
+      ReturnType finish() VULKAN_HPP_NOEXCEPT
+      {
+        endEnumeration();
+        return NullDriverResult<ReturnType>::get( m_incomplete );
+      }
+
+    private:
+      template <typename T>
+      void output( T * pCount, NullDriverCountOutput ) VULKAN_HPP_NOEXCEPT
+      {
+        endEnumeration();
+        m_count     = pCount;
+        m_countSize = sizeof( T );
+      }
+
+      template <typename T>
+      void output( T * pMemory, NullDriverMemoryOutput ) VULKAN_HPP_NOEXCEPT
+      {
+        endEnumeration();
+        if ( pMemory )
+        {
+          *pMemory = NullDriver::mappedMemory();
+        }
+      }
+
+      template <typename T, typename Kind>
+      void output( T * pOutput, Kind kind ) VULKAN_HPP_NOEXCEPT
+      {
+        uint64_t count = std::is_same<Kind, NullDriverHandleOutput>::value ? m_handleCount : 1;
+        if ( m_count )
+        {
+          // the array of a two-call enumeration
+          uint64_t enumerationCount = NullDriver::configuration().enumerationCount;
+          count                     = pOutput ? ( std::min )( readCount(), enumerationCount ) : 0;
+          m_incomplete              = m_incomplete || ( pOutput && ( count < enumerationCount ) );
+          writeCount( pOutput ? count : enumerationCount );
+          m_count          = nullptr;
+          m_inEnumeration  = true;
+          m_enumeratedSize = count;
+        }
+        else if ( m_inEnumeration )
+        {
+          count = m_enumeratedSize;
+        }
+        if ( pOutput )
+        {
+          fill( pOutput, count, kind );
+        }
+      }
+
+      template <typename T>
+      void fill( T * pHandles, uint64_t count, NullDriverHandleOutput ) VULKAN_HPP_NOEXCEPT
+      {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+          pHandles[i] = NullDriver::nextHandle<T>();
+        }
+      }
+
+      void fill( void * pBytes, uint64_t count, NullDriverBytesOutput ) VULKAN_HPP_NOEXCEPT
+      {
+        // only the bytes of an enumeration have a known size
+        if ( m_inEnumeration )
+        {
+          memset( pBytes, 0, static_cast<size_t>( count ) );
+        }
+      }
+
+      template <typename T>
+      void fill( T * pStructures, uint64_t count, NullDriverStructureOutput ) VULKAN_HPP_NOEXCEPT
+      {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+          clearStructure( pStructures[i], NullDriverHasStructureType<T>() );
+        }
+      }
+
+      template <typename T>
+      void fill( T * pValues, uint64_t count, NullDriverValueOutput ) VULKAN_HPP_NOEXCEPT
+      {
+        memset( pValues, 0, static_cast<size_t>( count ) * sizeof( T ) );
+      }
+
+      template <typename T>
+      static void clearStructure( T & structure, std::true_type /*hasStructureType*/ ) VULKAN_HPP_NOEXCEPT
+      {
+        clearChainedStructure( reinterpret_cast<VkBaseOutStructure *>( &structure ), sizeof( T ) );
+      }
+
+      template <typename T>
+      static void clearStructure( T & structure, std::false_type /*hasStructureType*/ ) VULKAN_HPP_NOEXCEPT
+      {
+        memset( &structure, 0, sizeof( T ) );
+      }
+
+      // clears everything but sType and pNext, and continues with the next structure in the chain
+      static void clearChainedStructure( VkBaseOutStructure * structure, size_t size ) VULKAN_HPP_NOEXCEPT
+      {
+        while ( structure && ( sizeof( VkBaseOutStructure ) <= size ) )
+        {
+          memset( reinterpret_cast<uint8_t *>( structure ) + sizeof( VkBaseOutStructure ), 0, size - sizeof( VkBaseOutStructure ) );
+          structure = structure->pNext;
+          size      = structure ? nullDriverStructureSize( structure->sType ) : 0;
+        }
+      }
+
+      uint64_t readCount() const VULKAN_HPP_NOEXCEPT
+      {
+        if ( m_countSize == sizeof( uint32_t ) )
+        {
+          uint32_t count;
+          memcpy( &count, m_count, sizeof( count ) );
+          return count;
+        }
+        uint64_t count;
+        memcpy( &count, m_count, sizeof( count ) );
+        return count;
+      }
+
+      void writeCount( uint64_t count ) VULKAN_HPP_NOEXCEPT
+      {
+        if ( m_countSize == sizeof( uint32_t ) )
+        {
+          uint32_t count32 = static_cast<uint32_t>( count );
+          memcpy( m_count, &count32, sizeof( count32 ) );
+        }
+        else
+        {
+          memcpy( m_count, &count, sizeof( count ) );
+        }
+      }
+
+      void endEnumeration() VULKAN_HPP_NOEXCEPT
+      {
+        if ( m_count )
+        {
+          // a count output not followed by an array is just a scalar
+          writeCount( 0 );
+          m_count = nullptr;
+        }
+        m_inEnumeration = false;
+      }
+
+    private:
+      uint32_t m_handleCount;
+      void *   m_count          = nullptr;  // a pending count output, that might be followed by the array of an enumeration
+      size_t   m_countSize      = 0;
+      bool     m_inEnumeration  = false;
+      uint64_t m_enumeratedSize = 0;
+      bool     m_incomplete     = false;
+    };
+
+    // the number of handles returned by a command; specialized for the commands returning an array of handles
+    template <typename PFN>
+    struct NullDriverHandleCount
+    {
+      template <typename... Args>
+      static uint32_t get( Args... ) VULKAN_HPP_NOEXCEPT
+      {
+        return 1;
+      }
+    };
+
+${handleCounts}
+
+    // bit i of OutputMask is set if parameter i of the command is an output
+    template <typename PFN, uint32_t OutputMask>
+    class NullDriverCommand;
+
+    template <uint32_t OutputMask, typename ReturnType, typename... Args>
+    class NullDriverCommand<ReturnType( VKAPI_PTR * )( Args... ), OutputMask>
+    {
+    public:
+      static PFN_vkVoidFunction pfn() VULKAN_HPP_NOEXCEPT
+      {
+        return reinterpret_cast<PFN_vkVoidFunction>( &NullDriverCommand::call );
+      }
+
+    private:
+      static VKAPI_ATTR ReturnType VKAPI_CALL call( Args... args )
+      {
+        NullDriverCall nullDriverCall( NullDriverHandleCount<ReturnType( VKAPI_PTR * )( Args... )>::get( args... ) );
+        processArguments<OutputMask>( nullDriverCall, args... );
+        return nullDriverCall.finish<ReturnType>();
+      }
+
+      template <uint32_t Mask, typename Arg, typename... Rest>
+      static void processArguments( NullDriverCall & nullDriverCall, Arg arg, Rest... rest ) VULKAN_HPP_NOEXCEPT
+      {
+        nullDriverCall.process( arg, std::integral_constant<bool, ( Mask & 1 ) != 0>() );
+        processArguments<( Mask >> 1 )>( nullDriverCall, rest... );
+      }
+
+      template <uint32_t Mask>
+      static void processArguments( NullDriverCall & ) VULKAN_HPP_NOEXCEPT
+      {
+      }
+    };
+
+    struct NullDriverCommandEntry
+    {
+      char const *       name;
+      PFN_vkVoidFunction pfn;
+    };
+
+    inline PFN_vkVoidFunction NullDriver::getProcAddr( char const * pName )
+    {
+      for ( auto const & command : configuration().overrides )
+      {
+        if ( command.first == pName )
+        {
+          return command.second;
+        }
+      }
+      if ( strcmp( pName, "vkGetInstanceProcAddr" ) == 0 )
+      {
+        return reinterpret_cast<PFN_vkVoidFunction>( &NullDriver::getInstanceProcAddr );
+      }
+      if ( strcmp( pName, "vkGetDeviceProcAddr" ) == 0 )
+      {
+        return reinterpret_cast<PFN_vkVoidFunction>( &NullDriver::getDeviceProcAddr );
+      }
+      if ( strcmp( pName, "vkEnumerateInstanceVersion" ) == 0 )
+      {
+        return reinterpret_cast<PFN_vkVoidFunction>( &NullDriver::enumerateInstanceVersion );
+      }
+
+      // sorted once, to look up the commands by binary search
+      static std::vector<NullDriverCommandEntry> const commands = []()
+      {
+        std::vector<NullDriverCommandEntry> commands = {
+${commandEntries}
+        };
+        std::sort( commands.begin(),
+                   commands.end(),
+                   []( NullDriverCommandEntry const & lhs, NullDriverCommandEntry const & rhs ) { return strcmp( lhs.name, rhs.name ) < 0; } );
+        return commands;
+      }();
+
+      auto it = std::lower_bound(
+        commands.begin(), commands.end(), pName, []( NullDriverCommandEntry const & command, char const * name ) { return strcmp( command.name, name ) < 0; } );
+      return ( ( it != commands.end() ) && ( strcmp( it->name, pName ) == 0 ) ) ? it->pfn : nullptr;
+    }
+
+    // A DispatchLoaderDynamic with all function pointers set to the commands of the NullDriver, for a fake instance and device.
+    class DispatchLoaderNull : public DispatchLoaderDynamic
+    {
+    public:
+      DispatchLoaderNull() VULKAN_HPP_NOEXCEPT
+        : DispatchLoaderDynamic(
+            NullDriver::nextHandle<VkInstance>(), &NullDriver::getInstanceProcAddr, NullDriver::nextHandle<VkDevice>(), &NullDriver::getDeviceProcAddr )
+      {
+      }
+    };
+  }  // namespace detail
+}  // namespace VULKAN_HPP_NAMESPACE
+#endif
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// A typed view onto the results of vkGetQueryPoolResults, as written into caller-provided storage: each query gives a DataType,
+// followed by its availability or status word if eWithAvailability or eWithStatusKHR is set; the words are 64 bit wide if e64 is set.
+template <typename DataType>
+class QueryResultView : protected StridedArrayProxy<DataType>
+{
+public:
+  QueryResultView( uint32_t count, DataType const * ptr, QueryResultFlags flags ) VULKAN_HPP_NOEXCEPT
+    : StridedArrayProxy<DataType>( count, ptr, queryStride( flags ) )
+    , m_wordSize( wordSize( flags ) )
+    , m_hasAvailability( hasAvailability( flags ) )
+  {
+    VULKAN_HPP_ASSERT( sizeof( DataType ) % m_wordSize == 0 );
+  }
+
+  // the distance between the results of two consecutive queries, as to be passed to vkGetQueryPoolResults
+  static VULKAN_HPP_CONSTEXPR uint32_t queryStride( QueryResultFlags flags ) VULKAN_HPP_NOEXCEPT
+  {
+    return static_cast<uint32_t>( sizeof( DataType ) ) + ( hasAvailability( flags ) ? wordSize( flags ) : 0 );
+  }
+
+  using StridedArrayProxy<DataType>::empty;
+  using StridedArrayProxy<DataType>::size;
+  using StridedArrayProxy<DataType>::data;
+  using StridedArrayProxy<DataType>::stride;
+
+  DataType const & operator[]( uint32_t index ) const VULKAN_HPP_NOEXCEPT
+  {
+    VULKAN_HPP_ASSERT( index < size() );
+    return *reinterpret_cast<DataType const *>( reinterpret_cast<uint8_t const *>( data() ) + index * stride() );
+  }
+
+  bool hasAvailability() const VULKAN_HPP_NOEXCEPT
+  {
+    return m_hasAvailability;
+  }
+
+  // with eWithAvailability, whether the result of the query at index is available
+  bool isAvailable( uint32_t index ) const VULKAN_HPP_NOEXCEPT
+  {
+    return word( index ) != 0;
+  }
+
+  // with eWithStatusKHR, the status of the query at index
+  QueryResultStatusKHR status( uint32_t index ) const VULKAN_HPP_NOEXCEPT
+  {
+    return static_cast<QueryResultStatusKHR>( word( index ) );
+  }
+
+private:
+  static VULKAN_HPP_CONSTEXPR uint32_t wordSize( QueryResultFlags flags ) VULKAN_HPP_NOEXCEPT
+  {
+    return ( flags & QueryResultFlagBits::e64 ) ? 8 : 4;
+  }
+
+  static VULKAN_HPP_CONSTEXPR bool hasAvailability( QueryResultFlags flags ) VULKAN_HPP_NOEXCEPT
+  {
+    return !!( flags & ( QueryResultFlagBits::eWithAvailability | QueryResultFlagBits::eWithStatusKHR ) );
+  }
+
+  // the availability or status word following the result of the query at index, sign-extended
+  int64_t word( uint32_t index ) const VULKAN_HPP_NOEXCEPT
+  {
+    VULKAN_HPP_ASSERT( m_hasAvailability && ( index < size() ) );
+    uint8_t const * pWord = reinterpret_cast<uint8_t const *>( data() ) + index * stride() + sizeof( DataType );
+    return ( m_wordSize == 8 ) ? *reinterpret_cast<int64_t const *>( pWord ) : *reinterpret_cast<int32_t const *>( pWord );
+  }
+
+private:
+  uint32_t m_wordSize;
+  bool     m_hasAvailability;
+};
@@ -0,0 +1,11 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+${copyrightMessage}
+
+// The source of the Vulkan::HppCompiled library: compiles the non-template functions of ${api}_raii.hpp once, instead of inlining them into
+// every translation unit. Everything linking against that library is compiled with VULKAN_HPP_COMPILED, which leaves just their declarations.
+
+#define VULKAN_HPP_COMPILED_DEFINITIONS 1
+
+#include <vulkan/${api}_raii.hpp>
@@ -0,0 +1,506 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+${copyrightMessage}
+
+#ifndef VULKAN_SERIALIZE_HPP
+#define VULKAN_SERIALIZE_HPP
+
+#include <vulkan/${api}.hpp>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <vector>
+
+#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
+// Binary serialization of structures, including everything they point to:
+//  - vk::serialize( structure ) stores a structure into a compact sequence of bytes
+//  - vk::deserialize<Structure>( data ) rebuilds it in one single block of memory, owned by the returned vk::DeserializedStructure
+//  - the elements of pNext chains are tagged by their StructureType; counted arrays, strings, and pointed-to structures follow their owner
+//  - handles are stored by value, like all the other non-pointer members; they need to be replaced by valid ones after deserialization
+//  - deprecated members are not stored, and the data is only meant to be used on machines with the same byte order and size of size_t
+// Structures with members that can't be serialized (like opaque pointers, unions holding pointers, or mutually exclusive arrays) are not supported.
+namespace VULKAN_HPP_NAMESPACE
+{
+  namespace detail
+  {
+    //=====================
+    //=== Serialization ===
+    //=====================
+
+    struct SerializeHeader
+    {
+      uint32_t magic         = 0x5A53484B;  // "KHSZ"
+      uint32_t version       = 1;
+      uint64_t structureSize = 0;  // size of the serialized structure, as a simple plausibility check
+      uint64_t arenaSize     = 0;  // size of the memory block needed to deserialize it
+    };
+
+    class Serializer
+    {
+    public:
+      explicit Serializer( std::vector<uint8_t> & data ) : m_data( data ) {}
+
+      size_t getArenaSize() const VULKAN_HPP_NOEXCEPT
+      {
+        return m_arenaSize;
+      }
+
+      // keeps track of the memory the Deserializer will need, which allocates in the very same order
+      template <typename T>
+      void allocate( size_t count ) VULKAN_HPP_NOEXCEPT
+      {
+        m_arenaSize = ( m_arenaSize + alignof( T ) - 1 ) / alignof( T ) * alignof( T ) + count * sizeof( T );
+      }
+
+      void fail( char const * message )
+      {
+        m_failed = true;
+#  if defined( VULKAN_HPP_NO_EXCEPTIONS )
+        (void)message;
+#  else
+        throw LogicError( message );
+#  endif
+      }
+
+      bool hasFailed() const VULKAN_HPP_NOEXCEPT
+      {
+        return m_failed;
+      }
+
+      void write( void const * data, size_t size )
+      {
+        m_data.insert( m_data.end(), static_cast<uint8_t const *>( data ), static_cast<uint8_t const *>( data ) + size );
+      }
+
+      template <typename T>
+      void writeChainElement( T const & structure )
+      {
+        StructureType structureType = T::structureType;
+        writeValue( structureType );
+        allocate<T>( 1 );
+        serializeStructure( *this, structure );
+      }
+
+      void writeString( char const * string )
+      {
+        uint32_t length = string ? static_cast<uint32_t>( strlen( string ) + 1 ) : 0;
+        writeValue( length );
+        if ( length )
+        {
+          allocate<char>( length );
+          write( string, length - 1 );
+        }
+      }
+
+      void writeStrings( char const * const * strings, size_t count )
+      {
+        if ( writePresence( strings && count ) )
+        {
+          allocate<char const *>( count );
+          for ( size_t i = 0; i < count; ++i )
+          {
+            writeString( strings[i] );
+          }
+        }
+      }
+
+      template <typename T>
+      void writeStructures( T const * structures, size_t count )
+      {
+        if ( writePresence( structures && count ) )
+        {
+          allocate<T>( count );
+          for ( size_t i = 0; i < count; ++i )
+          {
+            serializeStructure( *this, structures[i] );
+          }
+        }
+      }
+
+      template <typename T>
+      void writeValue( T const & value )
+      {
+        write( &value, sizeof( T ) );
+      }
+
+      template <typename T>
+      void writeValues( T const * values, size_t count )
+      {
+        if ( writePresence( values && count ) )
+        {
+          allocate<T>( count );
+          write( values, count * sizeof( T ) );
+        }
+      }
+
+      // untyped data, with its size in bytes
+      void writeValues( void const * values, size_t size )
+      {
+        if ( writePresence( values && size ) )
+        {
+          allocate<uint64_t>( ( size + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t ) );
+          write( values, size );
+        }
+      }
+
+    private:
+      bool writePresence( bool present )
+      {
+        writeValue( static_cast<uint8_t>( present ) );
+        return present;
+      }
+
+    private:
+      std::vector<uint8_t> & m_data;
+      size_t                 m_arenaSize = 0;
+      bool                   m_failed    = false;
+    };
+
+    class Deserializer
+    {
+    public:
+      Deserializer( uint8_t const * data, size_t size ) VULKAN_HPP_NOEXCEPT
+        : m_data( data )
+        , m_size( size )
+      {
+      }
+
+      // all the memory is taken from one arena, which needs to be aligned for any type
+      template <typename T>
+      T * allocate( size_t count )
+      {
+        size_t offset = ( m_arenaOffset + alignof( T ) - 1 ) / alignof( T ) * alignof( T );
+        if ( m_failed || ( m_arenaSize < offset ) || ( ( m_arenaSize - offset ) / sizeof( T ) < count ) )
+        {
+          fail( VULKAN_HPP_NAMESPACE_STRING "::deserialize: the data is corrupt" );
+          return nullptr;
+        }
+        T * values = reinterpret_cast<T *>( m_arena + offset );
+        for ( size_t i = 0; i < count; ++i )
+        {
+          new ( values + i ) T();
+        }
+        m_arenaOffset = offset + count * sizeof( T );
+        return values;
+      }
+
+      void fail( char const * message )
+      {
+        m_failed = true;
+#  if defined( VULKAN_HPP_NO_EXCEPTIONS )
+        (void)message;
+#  else
+        throw LogicError( message );
+#  endif
+      }
+
+      bool hasFailed() const VULKAN_HPP_NOEXCEPT
+      {
+        return m_failed;
+      }
+
+      bool isAtEnd() const VULKAN_HPP_NOEXCEPT
+      {
+        return m_offset == m_size;
+      }
+
+      // on failure, the data read is zeroed
+      void read( void * data, size_t size )
+      {
+        if ( m_failed || ( m_size - m_offset < size ) )
+        {
+          memset( data, 0, size );
+          fail( VULKAN_HPP_NAMESPACE_STRING "::deserialize: unexpected end of data" );
+          return;
+        }
+        memcpy( data, m_data + m_offset, size );
+        m_offset += size;
+      }
+
+      template <typename T>
+      T * readChainElement()
+      {
+        T * structure = allocate<T>( 1 );
+        if ( structure )
+        {
+          deserializeStructure( *this, *structure );
+        }
+        return structure;
+      }
+
+      void readString( char const *& string )
+      {
+        uint32_t length = 0;
+        readValue( length );
+        string = nullptr;
+        if ( length )
+        {
+          char * characters = allocate<char>( length );
+          if ( characters )
+          {
+            read( characters, length - 1 );
+            string = characters;
+          }
+        }
+      }
+
+      void readStrings( char const * const *& strings, size_t count )
+      {
+        strings = nullptr;
+        if ( readPresence() )
+        {
+          char const ** s = allocate<char const *>( count );
+          if ( s )
+          {
+            for ( size_t i = 0; i < count; ++i )
+            {
+              readString( s[i] );
+            }
+            strings = s;
+          }
+        }
+      }
+
+      template <typename T>
+      void readStructures( T *& structures, size_t count )
+      {
+        structures = nullptr;
+        if ( readPresence() )
+        {
+          typename std::remove_const<T>::type * s = allocate<typename std::remove_const<T>::type>( count );
+          if ( s )
+          {
+            for ( size_t i = 0; i < count; ++i )
+            {
+              deserializeStructure( *this, s[i] );
+            }
+            structures = s;
+          }
+        }
+      }
+
+      template <typename T>
+      void readValue( T & value )
+      {
+        read( &value, sizeof( T ) );
+      }
+
+      template <typename T>
+      void readValues( T *& values, size_t count )
+      {
+        values = nullptr;
+        if ( readPresence() )
+        {
+          typename std::remove_const<T>::type * v = allocate<typename std::remove_const<T>::type>( count );
+          if ( v )
+          {
+            read( v, count * sizeof( T ) );
+            values = v;
+          }
+        }
+      }
+
+      // untyped data, with its size in bytes
+      void readValues( void const *& values, size_t size )
+      {
+        values = nullptr;
+        if ( readPresence() )
+        {
+          uint64_t * v = allocate<uint64_t>( ( size + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t ) );
+          if ( v )
+          {
+            read( v, size );
+            values = v;
+          }
+        }
+      }
+
+      void readValues( void *& values, size_t size )
+      {
+        void const * v;
+        readValues( v, size );
+        values = const_cast<void *>( v );
+      }
+
+      void setArena( void * arena, size_t arenaSize ) VULKAN_HPP_NOEXCEPT
+      {
+        m_arena       = static_cast<uint8_t *>( arena );
+        m_arenaSize   = arenaSize;
+        m_arenaOffset = 0;
+      }
+
+    private:
+      bool readPresence()
+      {
+        uint8_t present = 0;
+        readValue( present );
+        if ( 1 < present )
+        {
+          fail( VULKAN_HPP_NAMESPACE_STRING "::deserialize: the data is corrupt" );
+        }
+        return present == 1;
+      }
+
+    private:
+      uint8_t const * m_data;
+      size_t          m_size;
+      size_t          m_offset      = 0;
+      uint8_t *       m_arena       = nullptr;
+      size_t          m_arenaSize   = 0;
+      size_t          m_arenaOffset = 0;
+      bool            m_failed      = false;
+    };
+
+    void   serializeChain( Serializer & serializer, void const * pNext );
+    void * deserializeChain( Deserializer & deserializer );
+
+${structureDeclarations}
+${structureDefinitions}
+
+    VULKAN_HPP_INLINE void serializeChain( Serializer & serializer, void const * pNext )
+    {
+      // each element of the chain is tagged by its StructureType, and its serialization continues with the next element
+      StructureType const chainEnd = static_cast<StructureType>( 0x7FFFFFFF );
+      switch ( pNext ? static_cast<StructureType>( reinterpret_cast<VkBaseInStructure const *>( pNext )->sType ) : chainEnd )
+      {
+${serializeChainCases}
+        default:
+          if ( pNext )
+          {
+            serializer.fail( VULKAN_HPP_NAMESPACE_STRING "::serialize: the pNext chain holds a structure that can't be serialized" );
+          }
+          serializer.writeValue( chainEnd );
+          break;
+      }
+    }
+
+    VULKAN_HPP_INLINE void * deserializeChain( Deserializer & deserializer )
+    {
+      StructureType const chainEnd      = static_cast<StructureType>( 0x7FFFFFFF );
+      StructureType       structureType = chainEnd;
+      deserializer.readValue( structureType );
+      switch ( structureType )
+      {
+${deserializeChainCases}
+        default:
+          if ( structureType != chainEnd )
+          {
+            deserializer.fail( VULKAN_HPP_NAMESPACE_STRING "::deserialize: the pNext chain holds an unknown structure" );
+          }
+          return nullptr;
+      }
+    }
+  }  // namespace detail
+
+  // owns a deserialized structure, together with everything it points to
+  template <typename T>
+  class DeserializedStructure
+  {
+  public:
+    DeserializedStructure() = default;
+
+    DeserializedStructure( std::unique_ptr<std::max_align_t[]> && arena, T * structure ) VULKAN_HPP_NOEXCEPT
+      : m_arena( std::move( arena ) )
+      , m_structure( structure )
+    {
+    }
+
+    explicit operator bool() const VULKAN_HPP_NOEXCEPT
+    {
+      return m_structure != nullptr;
+    }
+
+    // the structure and all the data it points to can be modified, for example to replace the handles
+    T & get() VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( m_structure );
+      return *m_structure;
+    }
+
+    T const & get() const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( m_structure );
+      return *m_structure;
+    }
+
+    T const & operator*() const VULKAN_HPP_NOEXCEPT
+    {
+      return get();
+    }
+
+    T const * operator->() const VULKAN_HPP_NOEXCEPT
+    {
+      return &get();
+    }
+
+  private:
+    std::unique_ptr<std::max_align_t[]> m_arena;
+    T *                                 m_structure = nullptr;
+  };
+
+  // with VULKAN_HPP_NO_EXCEPTIONS, a structure that can't be serialized as a whole results in empty data
+  template <typename T>
+  VULKAN_HPP_NODISCARD std::vector<uint8_t> serialize( T const & structure )
+  {
+    std::vector<uint8_t> data( sizeof( detail::SerializeHeader ) );
+    detail::Serializer   serializer( data );
+    serializer.allocate<T>( 1 );
+    serializeStructure( serializer, structure );
+    if ( serializer.hasFailed() )
+    {
+      return std::vector<uint8_t>();
+    }
+
+    detail::SerializeHeader header;
+    header.structureSize = sizeof( T );
+    header.arenaSize     = serializer.getArenaSize();
+    memcpy( data.data(), &header, sizeof( header ) );
+    return data;
+  }
+
+  // with VULKAN_HPP_NO_EXCEPTIONS, corrupt data results in an empty DeserializedStructure
+  template <typename T>
+  VULKAN_HPP_NODISCARD DeserializedStructure<T> deserialize( ArrayProxy<uint8_t const> const & data )
+  {
+    detail::Deserializer    deserializer( data.data(), data.size() );
+    detail::SerializeHeader header;
+    detail::SerializeHeader expected;
+    deserializer.readValue( header );
+    if ( !deserializer.hasFailed() &&
+         ( ( header.magic != expected.magic ) || ( header.version != expected.version ) || ( header.structureSize != sizeof( T ) ) ) )
+    {
+      deserializer.fail( VULKAN_HPP_NAMESPACE_STRING "::deserialize: the data does not hold a serialized structure of this type" );
+    }
+    // any serialized byte accounts for just a few bytes of the arena (a pointer takes one byte to mark its presence, plus some padding)
+    // -> don't even try to allocate the arena for corrupt data that claims to need more than that
+    if ( !deserializer.hasFailed() && ( ( data.size() - sizeof( header ) ) * 64 + sizeof( T ) < header.arenaSize ) )
+    {
+      deserializer.fail( VULKAN_HPP_NAMESPACE_STRING "::deserialize: the data is corrupt" );
+    }
+    if ( !deserializer.hasFailed() )
+    {
+      std::unique_ptr<std::max_align_t[]> arena(
+        new std::max_align_t[static_cast<size_t>( ( header.arenaSize + sizeof( std::max_align_t ) - 1 ) / sizeof( std::max_align_t ) )] );
+      deserializer.setArena( arena.get(), static_cast<size_t>( header.arenaSize ) );
+
+      T * structure = deserializer.allocate<T>( 1 );
+      if ( structure )
+      {
+        deserializeStructure( deserializer, *structure );
+      }
+      if ( !deserializer.hasFailed() && !deserializer.isAtEnd() )
+      {
+        deserializer.fail( VULKAN_HPP_NAMESPACE_STRING "::deserialize: unexpected data after the structure" );
+      }
+      if ( !deserializer.hasFailed() )
+      {
+        return DeserializedStructure<T>( std::move( arena ), structure );
+      }
+    }
+    return DeserializedStructure<T>();
+  }
+}  // namespace VULKAN_HPP_NAMESPACE
+#endif
+#endif
@@ -10,6 +10,70 @@ struct StructExtends
   };
 };
 
+#if 17 <= VULKAN_HPP_CPP_VERSION
+// With C++17, the StructureChain helpers are built on fold expressions and constexpr index tables, instead of recursing over std::tuple_element.
+// That keeps the number of template instantiations linear in the chain length, and shares them between all the get<T>() of a chain.
+namespace detail
+{
+  // the index of the Which-th occurrence of T in ChainElements, or sizeof...( ChainElements ) if there is no such element
+  template <typename T, size_t Which, typename... ChainElements>
+  constexpr size_t structureChainElementIndex()
+  {
+    constexpr bool isSame[] = { std::is_same_v<T, ChainElements>... };
+    size_t         count    = 0;
+    for ( size_t i = 0; i < sizeof...( ChainElements ); ++i )
+    {
+      if ( isSame[i] && ( count++ == Which ) )
+      {
+        return i;
+      }
+    }
+    return sizeof...( ChainElements );
+  }
+
+  // checks the first Index elements following Head: they need to extend Head, and they must not occur more than once, unless allowed
+  template <size_t Index, typename Head, typename... Tail>
+  constexpr bool isValidStructureChain()
+  {
+    if constexpr ( sizeof...( Tail ) == 0 )
+    {
+      return true;
+    }
+    else
+    {
+      constexpr bool   extendsHead[]    = { bool( StructExtends<Tail, Head>::value )... };
+      constexpr bool   allowDuplicate[] = { Tail::allowDuplicate... };
+      constexpr size_t firstIndex[]     = { structureChainElementIndex<Tail, 0, Head, Tail...>()... };
+      for ( size_t i = 0; i < Index; ++i )
+      {
+        if ( !extendsHead[i] || ( !allowDuplicate[i] && ( firstIndex[i] != i + 1 ) ) )
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+  }
+}  // namespace detail
+
+template <typename Type, typename... ChainElements>
+struct IsPartOfStructureChain
+{
+  static bool const valid = ( std::is_same_v<Type, ChainElements> || ... );
+};
+
+template <size_t Index, typename T, typename... ChainElements>
+struct StructureChainContains
+{
+  static bool const value = detail::structureChainElementIndex<T, 0, ChainElements...>() <= Index;
+};
+
+template <size_t Index, typename... ChainElements>
+struct StructureChainValidation
+{
+  static bool const valid = detail::isValidStructureChain<Index, ChainElements...>();
+};
+#else
 template <typename Type, class...>
 struct IsPartOfStructureChain
 {
@@ -49,6 +113,7 @@ struct StructureChainValidation<0, ChainElements...>
 {
   static bool const valid = true;
 };
+#endif
 
 template <typename... ChainElements>
 class StructureChain : public std::tuple<ChainElements...>
@@ -215,6 +280,14 @@ public:
   }
 
 private:
+#if 17 <= VULKAN_HPP_CPP_VERSION
+  template <int Index, typename T, int Which, typename, class... Types>
+  struct ChainElementIndex : std::integral_constant<int, Index + static_cast<int>( detail::structureChainElementIndex<T, Which, Types...>() )>
+  {
+    VULKAN_HPP_STATIC_ASSERT( detail::structureChainElementIndex<T, Which, Types...>() < sizeof...( Types ),
+                              "Can't get Structure that's not part of this StructureChain!" );
+  };
+#else
   template <int Index, typename T, int Which, typename, class First, class... Types>
   struct ChainElementIndex : ChainElementIndex<Index + 1, T, Which, void, Types...>
   {
@@ -237,6 +310,7 @@ private:
     : std::integral_constant<int, Index>
   {
   };
+#endif
 
   VULKAN_HPP_NODISCARD bool isLinked( VkBaseInStructure const * pNext ) const VULKAN_HPP_NOEXCEPT
   {
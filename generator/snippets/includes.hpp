@@ -28,4 +28,12 @@
 #  if defined( VULKAN_HPP_SUPPORT_SPAN )
 #    include <span>
 #  endif
+#  if defined( VULKAN_HPP_ENABLE_INSTRUMENTING_DISPATCHER )
+#    include <atomic>
+#    include <chrono>
+#    include <vector>
+#    if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#      include <intrin.h>  // __rdtsc
+#    endif
+#  endif
 #endif
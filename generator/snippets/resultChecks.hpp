@@ -3,6 +3,52 @@
 
 namespace detail
 {
+  // the success codes of a command are template arguments, such that checking a result needs no loop: the codes in [0, 64) (eSuccess up to
+  // eIncomplete) are folded into a constant mask and checked by a single bit test, the few larger ones of extensions (like eSuboptimalKHR
+  // or eOperationDeferredKHR) are compared one by one; the throwing path is kept out of line in throwResultException
+  template <Result... SuccessCodes>
+  struct SuccessCodeMask;
+
+  template <>
+  struct SuccessCodeMask<>
+  {
+    static const uint64_t value = 0;
+  };
+
+  template <Result SuccessCode, Result... SuccessCodes>
+  struct SuccessCodeMask<SuccessCode, SuccessCodes...>
+  {
+    static const uint64_t value = ( ( static_cast<uint32_t>( SuccessCode ) < 64 ) ? ( uint64_t( 1 ) << ( static_cast<uint32_t>( SuccessCode ) & 63 ) ) : 0 ) |
+                                  SuccessCodeMask<SuccessCodes...>::value;
+  };
+
+  template <Result SuccessCode>
+  VULKAN_HPP_CONSTEXPR bool isLargeSuccessCode( Result result ) VULKAN_HPP_NOEXCEPT
+  {
+    return ( 64 <= static_cast<uint32_t>( SuccessCode ) ) && ( result == SuccessCode );
+  }
+
+  template <Result SuccessCode, Result NextSuccessCode, Result... SuccessCodes>
+  VULKAN_HPP_CONSTEXPR bool isLargeSuccessCode( Result result ) VULKAN_HPP_NOEXCEPT
+  {
+    return isLargeSuccessCode<SuccessCode>( result ) || isLargeSuccessCode<NextSuccessCode, SuccessCodes...>( result );
+  }
+
+  template <Result SuccessCode>
+  VULKAN_HPP_CONSTEXPR bool isSuccessCode( Result result ) VULKAN_HPP_NOEXCEPT
+  {
+    return result == SuccessCode;
+  }
+
+  template <Result SuccessCode, Result NextSuccessCode, Result... SuccessCodes>
+  VULKAN_HPP_CONSTEXPR bool isSuccessCode( Result result ) VULKAN_HPP_NOEXCEPT
+  {
+    // the bit test is done branch-free, with the range check masking its result
+    return ( ( ( SuccessCodeMask<SuccessCode, NextSuccessCode, SuccessCodes...>::value >> ( static_cast<uint32_t>( result ) & 63 ) ) &
+             static_cast<uint64_t>( static_cast<uint32_t>( result ) < 64 ) ) != 0 ) ||
+           isLargeSuccessCode<SuccessCode, NextSuccessCode, SuccessCodes...>( result );
+  }
+
   VULKAN_HPP_INLINE void resultCheck( Result result, char const * message )
   {
 #ifdef VULKAN_HPP_NO_EXCEPTIONS
@@ -17,15 +63,15 @@ namespace detail
 #endif
   }
 
-  VULKAN_HPP_INLINE void resultCheck( Result result, char const * message, std::initializer_list<Result> successCodes )
+  template <Result SuccessCode, Result... SuccessCodes>
+  VULKAN_HPP_INLINE void resultCheck( Result result, char const * message )
   {
 #ifdef VULKAN_HPP_NO_EXCEPTIONS
     ignore( result );  		// just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
     ignore( message );
-    ignore( successCodes );	// just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
-    VULKAN_HPP_ASSERT_ON_RESULT( std::find( successCodes.begin(), successCodes.end(), result ) != successCodes.end() );
+    VULKAN_HPP_ASSERT_ON_RESULT( ( isSuccessCode<SuccessCode, SuccessCodes...>( result ) ) );
 #else
-    if ( std::find( successCodes.begin(), successCodes.end(), result ) == successCodes.end() )
+    if ( !isSuccessCode<SuccessCode, SuccessCodes...>( result ) )
     {
       throwResultException( result, message );
     }
@@ -33,9 +79,20 @@ namespace detail
   }
 
   template <typename HandleType, typename AllocatorType, typename Dispatch>
+  VULKAN_HPP_NOINLINE_COLD void destroyPipelines( VkDevice                                       device,
+                                                  std::vector<HandleType, AllocatorType> const & pipelines,
+                                                  AllocationCallbacks const *                    pAllocator,
+                                                  Dispatch const &                               d )
+  {
+    for ( HandleType pipeline : pipelines )
+    {
+      d.vkDestroyPipeline( device, static_cast<VkPipeline>( pipeline ), reinterpret_cast<VkAllocationCallbacks const*>( pAllocator ) );
+    }
+  }
+
+  template <Result SuccessCode, Result... SuccessCodes, typename HandleType, typename AllocatorType, typename Dispatch>
   VULKAN_HPP_INLINE void resultCheck( Result                                         result,
                                       char const *                                   message,
-                                      std::initializer_list<Result>                  successCodes,
                                       VkDevice                                       device,
                                       std::vector<HandleType, AllocatorType> const & pipelines,
                                       AllocationCallbacks const *                    pAllocator,
@@ -44,19 +101,15 @@ namespace detail
 #ifdef VULKAN_HPP_NO_EXCEPTIONS
     ignore( result );  		// just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
     ignore( message );
-    ignore( successCodes );	// just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
     ignore( device );
     ignore( pipelines );
     ignore( pAllocator );
     ignore( d );
-    VULKAN_HPP_ASSERT_ON_RESULT( std::find( successCodes.begin(), successCodes.end(), result ) != successCodes.end() );
+    VULKAN_HPP_ASSERT_ON_RESULT( ( isSuccessCode<SuccessCode, SuccessCodes...>( result ) ) );
 #else
-    if ( std::find( successCodes.begin(), successCodes.end(), result ) == successCodes.end() )
+    if ( !isSuccessCode<SuccessCode, SuccessCodes...>( result ) )
     {
-      for ( HandleType pipeline : pipelines )
-      {
-        d.vkDestroyPipeline( device, static_cast<VkPipeline>( pipeline ), reinterpret_cast<VkAllocationCallbacks const*>( pAllocator ) );
-      }
+      destroyPipelines( device, pipelines, pAllocator, d );
       throwResultException( result, message );
     }
 #endif
@@ -15,12 +15,10 @@
 
 #include "../utils/geometries.hpp"
 #include "../utils/math.hpp"
+#include "../utils/pipelineCache.hpp"
 #include "../utils/shaders.hpp"
 #include "../utils/utils.hpp"
-#include "glslang/Public/ShaderLang.h"
 
-#include <fstream>
-#include <iomanip>
 #include <thread>
 
 // For timestamp code (getMilliseconds)
@@ -108,10 +106,10 @@ int main()
     vk::RenderPass renderPass = vk::su::createRenderPass(
       device, vk::su::pickSurfaceFormat( physicalDevice.getSurfaceFormatsKHR( surfaceData.surface ) ).format, depthBufferData.format );
 
-    glslang::InitializeProcess();
-    vk::ShaderModule vertexShaderModule   = vk::su::createShaderModule( device, vk::ShaderStageFlagBits::eVertex, vertexShaderText_PT_T );
-    vk::ShaderModule fragmentShaderModule = vk::su::createShaderModule( device, vk::ShaderStageFlagBits::eFragment, fragmentShaderText_T_C );
-    glslang::FinalizeProcess();
+    vk::su::ShaderCompiler shaderCompiler( vk::su::samplesShaderCacheFileName );
+
+    vk::ShaderModule vertexShaderModule   = vk::su::createShaderModule( device, vk::ShaderStageFlagBits::eVertex, vertexShaderText_PT_T, shaderCompiler );
+    vk::ShaderModule fragmentShaderModule = vk::su::createShaderModule( device, vk::ShaderStageFlagBits::eFragment, fragmentShaderText_T_C, shaderCompiler );
 
     std::vector<vk::Framebuffer> framebuffers =
       vk::su::createFramebuffers( device, renderPass, swapChainData.imageViews, depthBufferData.imageView, surfaceData.extent );
@@ -128,140 +126,30 @@ int main()
 
     /* VULKAN_KEY_START */
 
-    // Check disk for existing cache data
-    std::vector<char> startCacheData;
-
-    std::string   cacheFileName = "pipeline_cache_data.bin";
-    std::ifstream readCacheStream( cacheFileName, std::ios_base::in | std::ios_base::binary );
-    if ( readCacheStream.good() )
+    // Check disk for existing cache data; the PipelineCacheStore memory-maps the file and validates the VkPipelineCacheHeaderVersionOne
+    // in front of it against the vendorID, deviceID, and pipelineCacheUUID of the physical device
+    vk::su::PipelineCacheStore      pipelineCacheStore( "pipeline_cache_data.bin", properties );
+    vk::su::PipelineCacheDataStatus cacheDataStatus = pipelineCacheStore.load();
+    switch ( cacheDataStatus )
     {
-      // Determine cache size
-      readCacheStream.seekg( 0, readCacheStream.end );
-      size_t startCacheSize = static_cast<size_t>( readCacheStream.tellg() );
-      readCacheStream.seekg( 0, readCacheStream.beg );
-
-      // Allocate memory to hold the initial cache data
-      startCacheData.resize( startCacheSize );
-
-      // Read the data into our buffer
-      readCacheStream.read( startCacheData.data(), startCacheData.size() );
-
-      // Clean up and print results
-      readCacheStream.close();
-      std::cout << "  Pipeline cache HIT!\n";
-      std::cout << "  cacheData loaded from " << cacheFileName << "\n";
-    }
-    else
-    {
-      // No cache found on disk
-      std::cout << "  Pipeline cache miss!\n";
-    }
-
-    if ( !startCacheData.empty() )
-    {
-      // Check for cache validity
-      //
-      // TODO: Update this as the spec evolves. The fields are not defined by the header.
-      //
-      // The code below supports SDK 0.10 Vulkan spec, which contains the following table:
-      //
-      // Offset	 Size            Meaning
-      // ------    ------------    ------------------------------------------------------------------
-      //      0               4    a device ID equal to VkPhysicalDeviceProperties::DeviceId written
-      //                           as a stream of bytes, with the least significant byte first
-      //
-      //      4    VK_UUID_SIZE    a pipeline cache ID equal to VkPhysicalDeviceProperties::pipelineCacheUUID
-      //
-      //
-      // The code must be updated for latest Vulkan spec, which contains the following table:
-      //
-      // Offset	 Size            Meaning
-      // ------    ------------    ------------------------------------------------------------------
-      //      0               4    length in bytes of the entire pipeline cache header written as a
-      //                           stream of bytes, with the least significant byte first
-      //      4               4    a VkPipelineCacheHeaderVersion value written as a stream of bytes,
-      //                           with the least significant byte first
-      //      8               4    a vendor ID equal to VkPhysicalDeviceProperties::vendorID written
-      //                           as a stream of bytes, with the least significant byte first
-      //     12               4    a device ID equal to VkPhysicalDeviceProperties::deviceID written
-      //                           as a stream of bytes, with the least significant byte first
-      //     16    VK_UUID_SIZE    a pipeline cache ID equal to VkPhysicalDeviceProperties::pipelineCacheUUID
-
-      uint32_t headerLength                    = 0;
-      uint32_t cacheHeaderVersion              = 0;
-      uint32_t vendorID                        = 0;
-      uint32_t deviceID                        = 0;
-      uint8_t  pipelineCacheUUID[VK_UUID_SIZE] = {};
-
-      uint8_t * startCacheDataPtr = reinterpret_cast<uint8_t *>( startCacheData.data() );
-      memcpy( &headerLength, startCacheDataPtr + 0, 4 );
-      memcpy( &cacheHeaderVersion, startCacheDataPtr + 4, 4 );
-      memcpy( &vendorID, startCacheDataPtr + 8, 4 );
-      memcpy( &deviceID, startCacheDataPtr + 12, 4 );
-      memcpy( pipelineCacheUUID, startCacheDataPtr + 16, VK_UUID_SIZE );
-
-      // Check each field and report bad values before freeing existing cache
-      bool badCache = false;
-
-      if ( headerLength <= 0 )
-      {
-        badCache = true;
-        std::cout << "  Bad header length in " << cacheFileName << ".\n";
-        std::cout << "    Cache contains: " << std::hex << std::setw( 8 ) << headerLength << "\n";
-      }
-
-      if ( cacheHeaderVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE )
-      {
-        badCache = true;
-        std::cout << "  Unsupported cache header version in " << cacheFileName << ".\n";
-        std::cout << "    Cache contains: " << std::hex << std::setw( 8 ) << cacheHeaderVersion << "\n";
-      }
-
-      if ( vendorID != properties.vendorID )
-      {
-        badCache = true;
-        std::cout << "  Vender ID mismatch in " << cacheFileName << ".\n";
-        std::cout << "    Cache contains: " << std::hex << std::setw( 8 ) << vendorID << "\n";
-        std::cout << "    Driver expects: " << std::hex << std::setw( 8 ) << properties.vendorID << "\n";
-      }
-
-      if ( deviceID != properties.deviceID )
-      {
-        badCache = true;
-        std::cout << "  Device ID mismatch in " << cacheFileName << ".\n";
-        std::cout << "    Cache contains: " << std::hex << std::setw( 8 ) << deviceID << "\n";
-        std::cout << "    Driver expects: " << std::hex << std::setw( 8 ) << properties.deviceID << "\n";
-      }
-
-      if ( memcmp( pipelineCacheUUID, properties.pipelineCacheUUID, sizeof( pipelineCacheUUID ) ) != 0 )
-      {
-        badCache = true;
-        std::cout << "  UUID mismatch in " << cacheFileName << ".\n";
-        std::cout << "    Cache contains: " << vk::su::UUID( pipelineCacheUUID ) << "\n";
-        std::cout << "    Driver expects: " << vk::su::UUID( properties.pipelineCacheUUID ) << "\n";
-      }
-
-      if ( badCache )
-      {
-        // Don't submit initial cache data if any version info is incorrect
-        startCacheData.clear();
-
-        // And clear out the old cache file for use in next run
-        std::cout << "  Deleting cache entry " << cacheFileName << " to repopulate.\n";
-        if ( remove( cacheFileName.c_str() ) != 0 )
-        {
-          std::cerr << "Reading error";
-          exit( EXIT_FAILURE );
-        }
-      }
+      case vk::su::PipelineCacheDataStatus::eValid:
+        std::cout << "  Pipeline cache HIT!\n";
+        std::cout << "  cacheData loaded from " << pipelineCacheStore.fileName() << "\n";
+        break;
+      case vk::su::PipelineCacheDataStatus::eMissing:
+        // No cache found on disk
+        std::cout << "  Pipeline cache miss!\n";
+        break;
+      default:
+        // Don't submit initial cache data if any version info is incorrect, and clear out the old cache file for use in next run
+        std::cout << "  Bad pipeline cache data in " << pipelineCacheStore.fileName() << ": " << vk::su::to_string( cacheDataStatus ) << ".\n";
+        std::cout << "  Deleting cache entry " << pipelineCacheStore.fileName() << " to repopulate.\n";
+        pipelineCacheStore.remove();
+        break;
     }
 
     // Feed the initial cache data into cache creation
-    vk::PipelineCache pipelineCache =
-      device.createPipelineCache( vk::PipelineCacheCreateInfo( vk::PipelineCacheCreateFlags(), startCacheData.size(), startCacheData.data() ) );
-
-    // Free our initialData now that pipeline cache has been created
-    startCacheData.clear();
+    vk::PipelineCache pipelineCache = pipelineCacheStore.createPipelineCache( device );
 
     // Time (roughly) taken to create the graphics pipeline
     timestamp_t  start            = getMilliseconds();
@@ -325,15 +213,11 @@ int main()
     // Store away the cache that we've populated.  This could conceivably happen
     // earlier, depends on when the pipeline cache stops being populated
     // internally.
-    std::vector<uint8_t> endCacheData = device.getPipelineCacheData( pipelineCache );
-
-    // Write the file to disk, overwriting whatever was there
-    std::ofstream writeCacheStream( cacheFileName, std::ios_base::out | std::ios_base::binary );
-    if ( writeCacheStream.good() )
+    // Write the data to disk, overwriting whatever was there; this goes through a temporary file, such that an interrupted write never
+    // leaves a truncated cache behind
+    if ( pipelineCacheStore.save( device, pipelineCache ) )
     {
-      writeCacheStream.write( reinterpret_cast<char const *>( endCacheData.data() ), endCacheData.size() );
-      writeCacheStream.close();
-      std::cout << "  cacheData written to " << cacheFileName << "\n";
+      std::cout << "  cacheData written to " << pipelineCacheStore.fileName() << "\n";
     }
     else
     {
@@ -31,9 +31,9 @@
 #define GLM_FORCE_RADIANS
 #define GLM_ENABLE_EXPERIMENTAL
 #include "../utils/shaders.hpp"
+#include "../utils/uploadEngine.hpp"
 #include "../utils/utils.hpp"
 #include "CameraManipulator.hpp"
-#include "glslang/Public/ShaderLang.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_inverse.hpp>
@@ -850,14 +850,19 @@ int main()
                                          vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eVertexBuffer |
                                            vk::BufferUsageFlagBits::eStorageBuffer,
                                          vk::MemoryPropertyFlagBits::eDeviceLocal );
-    vertexBufferData.upload( physicalDevice, device, perFrameData[0].commandPool, graphicsQueue, vertices, VertexStride );
 
     vk::su::BufferData indexBufferData( physicalDevice,
                                         device,
                                         indices.size() * sizeof( uint32_t ),
                                         vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eIndexBuffer | vk::BufferUsageFlagBits::eStorageBuffer,
                                         vk::MemoryPropertyFlagBits::eDeviceLocal );
-    indexBufferData.upload( physicalDevice, device, perFrameData[0].commandPool, graphicsQueue, indices, sizeof( uint32_t ) );
+
+    {
+      // all of them are staged through the same UploadEngine and copied with one submission; its destructor waits for that
+      vk::su::UploadEngine uploadEngine( physicalDevice, device, graphicsAndPresentQueueFamilyIndex.first, graphicsQueue );
+      uploadEngine.upload( vertexBufferData, vertices, VertexStride );
+      uploadEngine.upload( indexBufferData, indices, sizeof( uint32_t ) );
+    }
 
     glm::mat4x4 transform( glm::mat4x4( 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f ) );
 
@@ -868,10 +873,10 @@ int main()
         { vk::DescriptorType::eCombinedImageSampler, static_cast<uint32_t>( textures.size() ), vk::ShaderStageFlagBits::eFragment } } );
     vk::PipelineLayout pipelineLayout = device.createPipelineLayout( vk::PipelineLayoutCreateInfo( {}, descriptorSetLayout ) );
 
-    glslang::InitializeProcess();
-    vk::ShaderModule vertexShaderModule   = vk::su::createShaderModule( device, vk::ShaderStageFlagBits::eVertex, vertexShaderText );
-    vk::ShaderModule fragmentShaderModule = vk::su::createShaderModule( device, vk::ShaderStageFlagBits::eFragment, fragmentShaderText );
-    glslang::FinalizeProcess();
+    vk::su::ShaderCompiler shaderCompiler( vk::su::samplesShaderCacheFileName );
+
+    vk::ShaderModule vertexShaderModule   = vk::su::createShaderModule( device, vk::ShaderStageFlagBits::eVertex, vertexShaderText, shaderCompiler );
+    vk::ShaderModule fragmentShaderModule = vk::su::createShaderModule( device, vk::ShaderStageFlagBits::eFragment, fragmentShaderText, shaderCompiler );
 
     vk::Pipeline graphicsPipeline =
       vk::su::createGraphicsPipeline( device,
@@ -997,12 +1002,11 @@ int main()
     }
 
     // create the ray-tracing shader modules
-    glslang::InitializeProcess();
-    vk::ShaderModule raygenShaderModule     = vk::su::createShaderModule( device, vk::ShaderStageFlagBits::eRaygenNV, raygenShaderText );
-    vk::ShaderModule missShaderModule       = vk::su::createShaderModule( device, vk::ShaderStageFlagBits::eMissNV, missShaderText );
-    vk::ShaderModule shadowMissShaderModule = vk::su::createShaderModule( device, vk::ShaderStageFlagBits::eMissNV, shadowMissShaderText );
-    vk::ShaderModule closestHitShaderModule = vk::su::createShaderModule( device, vk::ShaderStageFlagBits::eClosestHitNV, closestHitShaderText );
-    glslang::FinalizeProcess();
+    vk::ShaderModule raygenShaderModule     = vk::su::createShaderModule( device, vk::ShaderStageFlagBits::eRaygenNV, raygenShaderText, shaderCompiler );
+    vk::ShaderModule missShaderModule       = vk::su::createShaderModule( device, vk::ShaderStageFlagBits::eMissNV, missShaderText, shaderCompiler );
+    vk::ShaderModule shadowMissShaderModule = vk::su::createShaderModule( device, vk::ShaderStageFlagBits::eMissNV, shadowMissShaderText, shaderCompiler );
+    vk::ShaderModule closestHitShaderModule =
+      vk::su::createShaderModule( device, vk::ShaderStageFlagBits::eClosestHitNV, closestHitShaderText, shaderCompiler );
 
     // create the ray tracing pipeline
     std::vector<vk::PipelineShaderStageCreateInfo>     shaderStages;
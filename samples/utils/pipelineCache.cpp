@@ -0,0 +1,304 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+#include "pipelineCache.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#if defined( _WIN32 )
+#  if !defined( NOMINMAX )
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace vk
+{
+  namespace su
+  {
+    MappedFile::MappedFile( std::string const & fileName )
+    {
+#if defined( _WIN32 )
+      HANDLE fileHandle = CreateFileA( fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+      if ( fileHandle != INVALID_HANDLE_VALUE )
+      {
+        LARGE_INTEGER fileSize;
+        if ( GetFileSizeEx( fileHandle, &fileSize ) && ( 0 < fileSize.QuadPart ) )
+        {
+          HANDLE mappingHandle = CreateFileMappingA( fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr );
+          if ( mappingHandle )
+          {
+            m_data = MapViewOfFile( mappingHandle, FILE_MAP_READ, 0, 0, 0 );
+            if ( m_data )
+            {
+              m_size          = static_cast<size_t>( fileSize.QuadPart );
+              m_fileHandle    = fileHandle;
+              m_mappingHandle = mappingHandle;
+              return;
+            }
+            CloseHandle( mappingHandle );
+          }
+        }
+        CloseHandle( fileHandle );
+      }
+#else
+      int fd = open( fileName.c_str(), O_RDONLY );
+      if ( fd != -1 )
+      {
+        struct stat fileStat;
+        if ( ( fstat( fd, &fileStat ) == 0 ) && ( 0 < fileStat.st_size ) )
+        {
+          void * data = mmap( nullptr, static_cast<size_t>( fileStat.st_size ), PROT_READ, MAP_PRIVATE, fd, 0 );
+          if ( data != MAP_FAILED )
+          {
+            m_data = data;
+            m_size = static_cast<size_t>( fileStat.st_size );
+          }
+        }
+        // the mapping stays valid after the file descriptor is closed
+        close( fd );
+      }
+#endif
+    }
+
+    MappedFile::MappedFile( MappedFile && other ) noexcept
+      : m_data( other.m_data )
+      , m_size( other.m_size )
+#if defined( _WIN32 )
+      , m_fileHandle( other.m_fileHandle )
+      , m_mappingHandle( other.m_mappingHandle )
+#endif
+    {
+      other.m_data = nullptr;
+      other.m_size = 0;
+#if defined( _WIN32 )
+      other.m_fileHandle    = nullptr;
+      other.m_mappingHandle = nullptr;
+#endif
+    }
+
+    MappedFile::~MappedFile()
+    {
+      clear();
+    }
+
+    MappedFile & MappedFile::operator=( MappedFile && other ) noexcept
+    {
+      if ( this != &other )
+      {
+        clear();
+        std::swap( m_data, other.m_data );
+        std::swap( m_size, other.m_size );
+#if defined( _WIN32 )
+        std::swap( m_fileHandle, other.m_fileHandle );
+        std::swap( m_mappingHandle, other.m_mappingHandle );
+#endif
+      }
+      return *this;
+    }
+
+    void MappedFile::clear()
+    {
+      if ( m_data )
+      {
+#if defined( _WIN32 )
+        UnmapViewOfFile( m_data );
+        CloseHandle( m_mappingHandle );
+        CloseHandle( m_fileHandle );
+        m_fileHandle    = nullptr;
+        m_mappingHandle = nullptr;
+#else
+        munmap( m_data, m_size );
+#endif
+        m_data = nullptr;
+        m_size = 0;
+      }
+    }
+
+    std::string getTemporaryFileName( std::string const & fileName )
+    {
+      static std::atomic<uint32_t> counter( 0 );
+#if defined( _WIN32 )
+      unsigned long processId = GetCurrentProcessId();
+#else
+      long processId = static_cast<long>( getpid() );
+#endif
+      return fileName + "." + std::to_string( processId ) + "." + std::to_string( counter++ ) + ".tmp";
+    }
+
+    bool replaceFile( std::string const & srcFileName, std::string const & dstFileName )
+    {
+      // the data has to be on disk before the rename, or a crash right after it could leave an empty or truncated dstFileName behind
+      bool flushed = false;
+#if defined( _WIN32 )
+      HANDLE fileHandle = CreateFileA( srcFileName.c_str(), GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+      if ( fileHandle != INVALID_HANDLE_VALUE )
+      {
+        flushed = FlushFileBuffers( fileHandle ) != 0;
+        CloseHandle( fileHandle );
+      }
+      bool renamed = flushed && ( MoveFileExA( srcFileName.c_str(), dstFileName.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH ) != 0 );
+#else
+      int fd = open( srcFileName.c_str(), O_WRONLY );
+      if ( fd != -1 )
+      {
+        flushed = fsync( fd ) == 0;
+        close( fd );
+      }
+      bool renamed = flushed && ( std::rename( srcFileName.c_str(), dstFileName.c_str() ) == 0 );
+#endif
+      if ( !renamed )
+      {
+        std::remove( srcFileName.c_str() );
+      }
+      return renamed;
+    }
+
+    char const * to_string( PipelineCacheDataStatus status )
+    {
+      switch ( status )
+      {
+        case PipelineCacheDataStatus::eValid                     : return "valid";
+        case PipelineCacheDataStatus::eMissing                   : return "missing";
+        case PipelineCacheDataStatus::eTooSmall                  : return "too small to hold a pipeline cache header";
+        case PipelineCacheDataStatus::eHeaderSizeMismatch        : return "bad header size";
+        case PipelineCacheDataStatus::eHeaderVersionMismatch     : return "unsupported header version";
+        case PipelineCacheDataStatus::eVendorIDMismatch          : return "vendor ID mismatch";
+        case PipelineCacheDataStatus::eDeviceIDMismatch          : return "device ID mismatch";
+        case PipelineCacheDataStatus::ePipelineCacheUUIDMismatch : return "pipeline cache UUID mismatch";
+        default                                                  : assert( false ); return "unknown";
+      }
+    }
+
+    PipelineCacheDataStatus
+      validatePipelineCacheData( void const * data, size_t size, vk::PhysicalDeviceProperties const & properties, vk::PipelineCacheHeaderVersionOne * header )
+    {
+      if ( !data || ( size == 0 ) )
+      {
+        return PipelineCacheDataStatus::eMissing;
+      }
+      if ( size < sizeof( vk::PipelineCacheHeaderVersionOne ) )
+      {
+        return PipelineCacheDataStatus::eTooSmall;
+      }
+
+      // the data is not necessarily aligned, so copy the header out instead of reinterpreting it in place
+      vk::PipelineCacheHeaderVersionOne cacheHeader;
+      memcpy( static_cast<void *>( &cacheHeader ), data, sizeof( vk::PipelineCacheHeaderVersionOne ) );
+      if ( header )
+      {
+        *header = cacheHeader;
+      }
+
+      if ( ( cacheHeader.headerSize < sizeof( vk::PipelineCacheHeaderVersionOne ) ) || ( size < cacheHeader.headerSize ) )
+      {
+        return PipelineCacheDataStatus::eHeaderSizeMismatch;
+      }
+      if ( cacheHeader.headerVersion != vk::PipelineCacheHeaderVersion::eOne )
+      {
+        return PipelineCacheDataStatus::eHeaderVersionMismatch;
+      }
+      if ( cacheHeader.vendorID != properties.vendorID )
+      {
+        return PipelineCacheDataStatus::eVendorIDMismatch;
+      }
+      if ( cacheHeader.deviceID != properties.deviceID )
+      {
+        return PipelineCacheDataStatus::eDeviceIDMismatch;
+      }
+      if ( memcmp( cacheHeader.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE ) != 0 )
+      {
+        return PipelineCacheDataStatus::ePipelineCacheUUIDMismatch;
+      }
+      return PipelineCacheDataStatus::eValid;
+    }
+
+    PipelineCacheStore::PipelineCacheStore( std::string const & fileName, vk::PhysicalDeviceProperties const & properties )
+      : m_fileName( fileName ), m_properties( properties )
+    {
+    }
+
+    PipelineCacheDataStatus PipelineCacheStore::load()
+    {
+      m_mappedFile = MappedFile( m_fileName );
+      m_status     = validatePipelineCacheData( m_mappedFile.data(), m_mappedFile.size(), m_properties );
+      if ( m_status != PipelineCacheDataStatus::eValid )
+      {
+        // never hand out data a driver might choke on
+        m_mappedFile.clear();
+      }
+      return m_status;
+    }
+
+    void const * PipelineCacheStore::data() const
+    {
+      return ( m_status == PipelineCacheDataStatus::eValid ) ? m_mappedFile.data() : nullptr;
+    }
+
+    size_t PipelineCacheStore::size() const
+    {
+      return ( m_status == PipelineCacheDataStatus::eValid ) ? m_mappedFile.size() : 0;
+    }
+
+    vk::PipelineCacheCreateInfo PipelineCacheStore::makeCreateInfo( vk::PipelineCacheCreateFlags flags ) const
+    {
+      return vk::PipelineCacheCreateInfo( flags, size(), data() );
+    }
+
+    vk::PipelineCache PipelineCacheStore::createPipelineCache( vk::Device const & device, vk::PipelineCacheCreateFlags flags ) const
+    {
+      return device.createPipelineCache( makeCreateInfo( flags ) );
+    }
+
+    bool PipelineCacheStore::save( vk::Device const & device, vk::PipelineCache const & dstCache, vk::ArrayProxy<const vk::PipelineCache> const & srcCaches )
+    {
+      if ( !srcCaches.empty() )
+      {
+        device.mergePipelineCaches( dstCache, srcCaches );
+      }
+      return store( device.getPipelineCacheData( dstCache ) );
+    }
+
+    bool PipelineCacheStore::store( void const * data, size_t size )
+    {
+      if ( validatePipelineCacheData( data, size, m_properties ) != PipelineCacheDataStatus::eValid )
+      {
+        return false;
+      }
+
+      std::string tmpFileName = getTemporaryFileName( m_fileName );
+      {
+        std::ofstream stream( tmpFileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+        if ( !stream.write( static_cast<char const *>( data ), static_cast<std::streamsize>( size ) ) )
+        {
+          stream.close();
+          std::remove( tmpFileName.c_str() );
+          return false;
+        }
+      }
+
+      // data might have been pointing into the mapped file, which is not needed any longer now; on Windows, the mapping would also prevent
+      // the file from being replaced
+      m_mappedFile.clear();
+      m_status = PipelineCacheDataStatus::eMissing;
+
+      return replaceFile( tmpFileName, m_fileName );
+    }
+
+    void PipelineCacheStore::remove()
+    {
+      m_mappedFile.clear();
+      m_status = PipelineCacheDataStatus::eMissing;
+      std::remove( m_fileName.c_str() );
+    }
+  }  // namespace su
+}  // namespace vk
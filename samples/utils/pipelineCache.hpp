@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <vulkan/vulkan.hpp>
+
+namespace vk
+{
+  namespace su
+  {
+    // read-only memory mapping of a whole file; an empty MappedFile is returned if the file does not exist or can't be mapped
+    class MappedFile
+    {
+    public:
+      MappedFile() = default;
+      MappedFile( std::string const & fileName );
+      MappedFile( MappedFile const & ) = delete;
+      MappedFile( MappedFile && other ) noexcept;
+      ~MappedFile();
+
+      MappedFile & operator=( MappedFile const & ) = delete;
+      MappedFile & operator=( MappedFile && other ) noexcept;
+
+      void const * data() const
+      {
+        return m_data;
+      }
+
+      size_t size() const
+      {
+        return m_size;
+      }
+
+      bool empty() const
+      {
+        return m_size == 0;
+      }
+
+      void clear();
+
+    private:
+      void * m_data = nullptr;
+      size_t m_size = 0;
+#if defined( _WIN32 )
+      void * m_fileHandle    = nullptr;
+      void * m_mappingHandle = nullptr;
+#endif
+    };
+
+    // returns a name for a temporary file next to fileName, unique per process and call, such that concurrent writers of fileName don't
+    // overwrite each other's temporary files
+    std::string getTemporaryFileName( std::string const & fileName );
+
+    // flushes srcFileName to disk and renames it to dstFileName, replacing any existing dstFileName; on failure, srcFileName is removed
+    bool replaceFile( std::string const & srcFileName, std::string const & dstFileName );
+
+    enum class PipelineCacheDataStatus
+    {
+      eValid,
+      eMissing,
+      eTooSmall,
+      eHeaderSizeMismatch,
+      eHeaderVersionMismatch,
+      eVendorIDMismatch,
+      eDeviceIDMismatch,
+      ePipelineCacheUUIDMismatch
+    };
+
+    char const * to_string( PipelineCacheDataStatus status );
+
+    // checks the VkPipelineCacheHeaderVersionOne in front of some pipeline cache data against the properties of a physical device
+    PipelineCacheDataStatus
+      validatePipelineCacheData( void const * data, size_t size, vk::PhysicalDeviceProperties const & properties, vk::PipelineCacheHeaderVersionOne * header = nullptr );
+
+    // Persistent on-disk pipeline cache data:
+    //  - load() memory-maps the file and validates its header against the physical device, without copying the (possibly large) blob
+    //  - makeCreateInfo() points directly into that mapping, so it can be used for vk::Device::createPipelineCache as well as for
+    //    the vk::raii::PipelineCache constructor
+    //  - store() writes the data to a temporary file first and renames it afterwards, such that a crash never leaves a truncated cache behind
+    class PipelineCacheStore
+    {
+    public:
+      PipelineCacheStore( std::string const & fileName, vk::PhysicalDeviceProperties const & properties );
+
+      PipelineCacheDataStatus load();
+
+      // the data is valid until the next call to load() or store(), or until the PipelineCacheStore is destroyed
+      void const * data() const;
+      size_t       size() const;
+
+      std::string const & fileName() const
+      {
+        return m_fileName;
+      }
+
+      vk::PipelineCacheCreateInfo makeCreateInfo( vk::PipelineCacheCreateFlags flags = {} ) const;
+      vk::PipelineCache           createPipelineCache( vk::Device const & device, vk::PipelineCacheCreateFlags flags = {} ) const;
+
+      // merges the (optional) srcCaches into dstCache and stores the resulting data
+      bool save( vk::Device const & device, vk::PipelineCache const & dstCache, vk::ArrayProxy<const vk::PipelineCache> const & srcCaches = nullptr );
+
+      // stores some pipeline cache data, after validating its header; returns false if the data is invalid or couldn't be written
+      bool store( void const * data, size_t size );
+
+      bool store( std::vector<uint8_t> const & data )
+      {
+        return store( data.data(), data.size() );
+      }
+
+      // removes the file and releases any mapped data
+      void remove();
+
+    private:
+      std::string                  m_fileName;
+      vk::PhysicalDeviceProperties m_properties;
+      MappedFile                   m_mappedFile;
+      PipelineCacheDataStatus      m_status = PipelineCacheDataStatus::eMissing;
+    };
+  }  // namespace su
+}  // namespace vk
@@ -7,6 +7,12 @@
 #include "glslang/Public/ResourceLimits.h"
 #include "glslang/Public/ShaderLang.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <thread>
 #include <vulkan/vulkan.hpp>
 
 namespace vk
@@ -35,42 +41,95 @@ namespace vk
       }
     }
 
-    bool GLSLtoSPV( const vk::ShaderStageFlagBits shaderType, std::string const & glslShader, std::vector<unsigned int> & spvShader )
+    namespace
     {
-      EShLanguage stage = translateShaderStage( shaderType );
+      // Enable SPIR-V and Vulkan rules when parsing GLSL
+      EShMessages const compileMessages       = (EShMessages)( EShMsgSpvRules | EShMsgVulkanRules );
+      int const         compileDefaultVersion = 100;
 
-      const char * shaderStrings[1];
-      shaderStrings[0] = glslShader.data();
+      // the cache file starts with a CacheFileHeader, followed by entryCount CacheFileEntry, sorted by key, followed by the SPIR-V blobs
+      uint32_t const cacheFileMagic   = 0x43565053;  // "SPVC"
+      uint32_t const cacheFileVersion = 1;
 
-      glslang::TShader shader( stage );
-      shader.setStrings( shaderStrings, 1 );
+      struct CacheFileHeader
+      {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t entryCount;
+      };
 
-      // Enable SPIR-V and Vulkan rules when parsing GLSL
-      EShMessages messages = (EShMessages)( EShMsgSpvRules | EShMsgVulkanRules );
+      struct CacheFileEntry
+      {
+        uint64_t key;
+        uint64_t offset;  // in bytes, from the start of the file
+        uint64_t size;    // in bytes
+      };
 
-      if ( !shader.parse( GetDefaultResources(), 100, false, messages ) )
+      // FNV-1a
+      uint64_t hashBytes( uint64_t hash, void const * data, size_t size )
       {
-        puts( shader.getInfoLog() );
-        puts( shader.getInfoDebugLog() );
-        return false;  // something didn't work
+        for ( size_t i = 0; i < size; ++i )
+        {
+          hash = ( hash ^ static_cast<uint8_t const *>( data )[i] ) * 0x100000001b3;
+        }
+        return hash;
       }
 
-      glslang::TProgram program;
-      program.addShader( &shader );
+      uint64_t getShaderKey( vk::ShaderStageFlagBits shaderStage, std::string const & glslShader )
+      {
+        glslang::Version const version    = glslang::GetVersion();
+        int64_t const          options[]  = { static_cast<int64_t>( shaderStage ), compileMessages, compileDefaultVersion };
+        int64_t const          versions[] = { version.major, version.minor, version.patch };
+
+        uint64_t hash = hashBytes( 0xcbf29ce484222325, options, sizeof( options ) );
+        hash          = hashBytes( hash, versions, sizeof( versions ) );
+        return hashBytes( hash, glslShader.data(), glslShader.size() );
+      }
+
+      // the work horse of GLSLtoSPV and ShaderCompiler; info holds the glslang logs in case of failure
+      bool compileShader( const vk::ShaderStageFlagBits shaderType, std::string const & glslShader, std::vector<unsigned int> & spvShader, std::string & info )
+      {
+        EShLanguage stage = translateShaderStage( shaderType );
+
+        const char * shaderStrings[1];
+        shaderStrings[0] = glslShader.data();
 
-      //
-      // Program-level processing...
-      //
+        glslang::TShader shader( stage );
+        shader.setStrings( shaderStrings, 1 );
 
-      if ( !program.link( messages ) )
+        if ( !shader.parse( GetDefaultResources(), compileDefaultVersion, false, compileMessages ) )
+        {
+          info = std::string( shader.getInfoLog() ) + "\n" + shader.getInfoDebugLog();
+          return false;  // something didn't work
+        }
+
+        glslang::TProgram program;
+        program.addShader( &shader );
+
+        //
+        // Program-level processing...
+        //
+
+        if ( !program.link( compileMessages ) )
+        {
+          info = std::string( shader.getInfoLog() ) + "\n" + shader.getInfoDebugLog();
+          return false;
+        }
+
+        glslang::GlslangToSpv( *program.getIntermediate( stage ), spvShader );
+        return true;
+      }
+    }  // namespace
+
+    bool GLSLtoSPV( const vk::ShaderStageFlagBits shaderType, std::string const & glslShader, std::vector<unsigned int> & spvShader )
+    {
+      std::string info;
+      if ( !compileShader( shaderType, glslShader, spvShader, info ) )
       {
-        puts( shader.getInfoLog() );
-        puts( shader.getInfoDebugLog() );
+        puts( info.c_str() );
         fflush( stdout );
         return false;
       }
-
-      glslang::GlslangToSpv( *program.getIntermediate( stage ), spvShader );
       return true;
     }
 
@@ -84,5 +143,267 @@ namespace vk
 
       return device.createShaderModule( vk::ShaderModuleCreateInfo( vk::ShaderModuleCreateFlags(), shaderSPV ) );
     }
+
+    vk::ShaderModule
+      createShaderModule( vk::Device const & device, vk::ShaderStageFlagBits shaderStage, std::string const & shaderText, ShaderCompiler & shaderCompiler )
+    {
+      std::vector<unsigned int> shaderSPV = shaderCompiler.compile( shaderStage, shaderText );
+      return device.createShaderModule( vk::ShaderModuleCreateInfo( vk::ShaderModuleCreateFlags(), shaderSPV ) );
+    }
+
+    ShaderCompiler::GlslangProcess::GlslangProcess()
+    {
+      glslang::InitializeProcess();
+    }
+
+    ShaderCompiler::GlslangProcess::~GlslangProcess()
+    {
+      glslang::FinalizeProcess();
+    }
+
+    ShaderCompiler::ShaderCompiler( std::string const & cacheFileName, uint32_t threadCount )
+      : m_cacheFileName( cacheFileName ), m_threadCount( threadCount ? threadCount : ( std::max )( 1u, std::thread::hardware_concurrency() ) )
+    {
+      mapCacheFile();
+    }
+
+    ShaderCompiler::~ShaderCompiler()
+    {
+      flush();
+    }
+
+    std::vector<unsigned int> ShaderCompiler::compile( vk::ShaderStageFlagBits shaderStage, std::string const & glslShader )
+    {
+      uint64_t                  key = getShaderKey( shaderStage, glslShader );
+      std::vector<unsigned int> spvShader;
+      if ( lookup( key, spvShader ) )
+      {
+        ++m_cacheHits;
+      }
+      else
+      {
+        std::string info;
+        if ( !compileShader( shaderStage, glslShader, spvShader, info ) )
+        {
+          throw std::runtime_error( "Could not convert glsl shader to spir-v: " + info );
+        }
+        ++m_cacheMisses;
+        m_compiledShaders[key] = spvShader;
+      }
+      return spvShader;
+    }
+
+    std::vector<std::vector<unsigned int>> ShaderCompiler::compile( std::vector<std::pair<vk::ShaderStageFlagBits, std::string>> const & shaders )
+    {
+      std::vector<std::vector<unsigned int>> spvShaders( shaders.size() );
+      std::vector<uint64_t>                  keys( shaders.size() );
+      std::vector<size_t>                    missingShaders;  // indices of the shaders to compile, one per key
+      std::map<uint64_t, size_t>             missingKeys;     // key to index of the shader compiled for it
+      for ( size_t i = 0; i < shaders.size(); ++i )
+      {
+        keys[i] = getShaderKey( shaders[i].first, shaders[i].second );
+        if ( lookup( keys[i], spvShaders[i] ) )
+        {
+          ++m_cacheHits;
+        }
+        else if ( missingKeys.insert( std::make_pair( keys[i], i ) ).second )
+        {
+          missingShaders.push_back( i );
+        }
+      }
+
+      if ( !missingShaders.empty() )
+      {
+        // the workers pick the next shader to compile from a shared counter; the calling thread works as well
+        std::vector<std::string> infos( missingShaders.size() );
+        std::vector<uint8_t>     successes( missingShaders.size() );
+        std::atomic<size_t>      nextShader( 0 );
+        auto                     worker = [&]()
+        {
+          for ( size_t j = nextShader++; j < missingShaders.size(); j = nextShader++ )
+          {
+            size_t i     = missingShaders[j];
+            successes[j] = compileShader( shaders[i].first, shaders[i].second, spvShaders[i], infos[j] );
+          }
+        };
+
+        std::vector<std::thread> threads;
+        for ( size_t t = 1; t < ( std::min )( static_cast<size_t>( m_threadCount ), missingShaders.size() ); ++t )
+        {
+          threads.push_back( std::thread( worker ) );
+        }
+        worker();
+        for ( auto & thread : threads )
+        {
+          thread.join();
+        }
+
+        std::string errors;
+        for ( size_t j = 0; j < missingShaders.size(); ++j )
+        {
+          size_t i = missingShaders[j];
+          if ( successes[j] )
+          {
+            ++m_cacheMisses;
+            m_compiledShaders[keys[i]] = spvShaders[i];
+          }
+          else
+          {
+            errors += "\nshader " + std::to_string( i ) + ": " + infos[j];
+          }
+        }
+        if ( !errors.empty() )
+        {
+          throw std::runtime_error( "Could not convert glsl shaders to spir-v:" + errors );
+        }
+
+        // shaders with the same key as a shader compiled above
+        for ( size_t i = 0; i < shaders.size(); ++i )
+        {
+          auto missingIt = missingKeys.find( keys[i] );
+          if ( ( missingIt != missingKeys.end() ) && ( missingIt->second != i ) )
+          {
+            spvShaders[i] = spvShaders[missingIt->second];
+          }
+        }
+      }
+      return spvShaders;
+    }
+
+    bool ShaderCompiler::flush()
+    {
+      if ( m_cacheFileName.empty() || m_compiledShaders.empty() )
+      {
+        return true;
+      }
+
+      // merge the shaders from the cache file with the compiled ones, sorted by key
+      std::map<uint64_t, std::pair<void const *, size_t>> blobs;
+      uint8_t const *                                     mappedData = static_cast<uint8_t const *>( m_mappedFile.data() );
+      for ( size_t i = 0; i < m_mappedEntryCount; ++i )
+      {
+        CacheFileEntry entry;
+        memcpy( &entry, mappedData + sizeof( CacheFileHeader ) + i * sizeof( CacheFileEntry ), sizeof( CacheFileEntry ) );
+        blobs[entry.key] = std::make_pair( mappedData + entry.offset, static_cast<size_t>( entry.size ) );
+      }
+      for ( auto const & compiledShader : m_compiledShaders )
+      {
+        blobs[compiledShader.first] = std::make_pair( compiledShader.second.data(), compiledShader.second.size() * sizeof( unsigned int ) );
+      }
+
+      CacheFileHeader header = { cacheFileMagic, cacheFileVersion, blobs.size() };
+      std::string     tmpFileName = getTemporaryFileName( m_cacheFileName );
+      {
+        std::ofstream stream( tmpFileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+        stream.write( reinterpret_cast<char const *>( &header ), sizeof( header ) );
+        uint64_t offset = sizeof( CacheFileHeader ) + blobs.size() * sizeof( CacheFileEntry );
+        for ( auto const & blob : blobs )
+        {
+          CacheFileEntry entry = { blob.first, offset, blob.second.second };
+          stream.write( reinterpret_cast<char const *>( &entry ), sizeof( entry ) );
+          offset += blob.second.second;
+        }
+        for ( auto const & blob : blobs )
+        {
+          stream.write( static_cast<char const *>( blob.second.first ), static_cast<std::streamsize>( blob.second.second ) );
+        }
+        if ( !stream )
+        {
+          stream.close();
+          std::remove( tmpFileName.c_str() );
+          return false;
+        }
+      }
+
+      // on Windows, the mapping would prevent the file from being replaced
+      m_mappedFile.clear();
+      m_mappedEntryCount = 0;
+      bool replaced      = replaceFile( tmpFileName, m_cacheFileName );
+      if ( replaced )
+      {
+        m_compiledShaders.clear();
+      }
+      mapCacheFile();
+      return replaced;
+    }
+
+    bool ShaderCompiler::lookup( uint64_t key, std::vector<unsigned int> & spvShader ) const
+    {
+      auto compiledIt = m_compiledShaders.find( key );
+      if ( compiledIt != m_compiledShaders.end() )
+      {
+        spvShader = compiledIt->second;
+        return true;
+      }
+
+      // binary search in the index of the cache file; the entries are copied out, as the mapped data is not necessarily aligned
+      uint8_t const * mappedData = static_cast<uint8_t const *>( m_mappedFile.data() );
+      size_t          first = 0, last = m_mappedEntryCount;
+      CacheFileEntry  entry;
+      while ( first < last )
+      {
+        size_t middle = first + ( last - first ) / 2;
+        memcpy( &entry, mappedData + sizeof( CacheFileHeader ) + middle * sizeof( CacheFileEntry ), sizeof( CacheFileEntry ) );
+        if ( entry.key < key )
+        {
+          first = middle + 1;
+        }
+        else
+        {
+          last = middle;
+        }
+      }
+      if ( first < m_mappedEntryCount )
+      {
+        memcpy( &entry, mappedData + sizeof( CacheFileHeader ) + first * sizeof( CacheFileEntry ), sizeof( CacheFileEntry ) );
+        if ( entry.key == key )
+        {
+          spvShader.resize( static_cast<size_t>( entry.size / sizeof( unsigned int ) ) );
+          memcpy( spvShader.data(), mappedData + entry.offset, static_cast<size_t>( entry.size ) );
+          return true;
+        }
+      }
+      return false;
+    }
+
+    void ShaderCompiler::mapCacheFile()
+    {
+      if ( !m_cacheFileName.empty() )
+      {
+        m_mappedFile = MappedFile( m_cacheFileName );
+
+        // validate the whole index once, such that lookup() and flush() can rely on it
+        CacheFileHeader header = {};
+        bool            valid  = ( sizeof( CacheFileHeader ) <= m_mappedFile.size() );
+        if ( valid )
+        {
+          memcpy( &header, m_mappedFile.data(), sizeof( CacheFileHeader ) );
+          valid = ( header.magic == cacheFileMagic ) && ( header.version == cacheFileVersion ) &&
+                  ( header.entryCount <= ( m_mappedFile.size() - sizeof( CacheFileHeader ) ) / sizeof( CacheFileEntry ) );
+        }
+        uint8_t const * mappedData = static_cast<uint8_t const *>( m_mappedFile.data() );
+        for ( uint64_t i = 0; valid && ( i < header.entryCount ); ++i )
+        {
+          CacheFileEntry entry;
+          memcpy( &entry, mappedData + sizeof( CacheFileHeader ) + i * sizeof( CacheFileEntry ), sizeof( CacheFileEntry ) );
+          CacheFileEntry previousEntry = {};
+          if ( 0 < i )
+          {
+            memcpy( &previousEntry, mappedData + sizeof( CacheFileHeader ) + ( i - 1 ) * sizeof( CacheFileEntry ), sizeof( CacheFileEntry ) );
+          }
+          valid = ( ( i == 0 ) || ( previousEntry.key < entry.key ) ) && ( entry.size % sizeof( unsigned int ) == 0 ) &&
+                  ( entry.offset <= m_mappedFile.size() ) && ( entry.size <= m_mappedFile.size() - entry.offset );
+        }
+        if ( valid )
+        {
+          m_mappedEntryCount = static_cast<size_t>( header.entryCount );
+        }
+        else
+        {
+          m_mappedFile.clear();
+          m_mappedEntryCount = 0;
+        }
+      }
+    }
   }  // namespace su
 }  // namespace vk
@@ -3,7 +3,12 @@
 
 #pragma once
 
+#include "pipelineCache.hpp"
+
+#include <cstdint>
+#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 #include <vulkan/vulkan.hpp>
 
@@ -11,7 +16,70 @@ namespace vk
 {
   namespace su
   {
+    // Compiles GLSL to SPIR-V, caching the results in memory and on disk.
+    //  - the SPIR-V is addressed by a 64-bit hash of the shader stage, the source, the compile options and the glslang version
+    //  - the cache file holds an index of (key, offset, size), sorted by key, followed by the SPIR-V blobs; it is memory-mapped on construction,
+    //    and a lookup is a binary search in that index
+    //  - a batch of shaders missing in the cache is compiled on a pool of worker threads; glslang is initialized once per ShaderCompiler, not
+    //    per shader
+    //  - newly compiled shaders are written to the cache file by flush(), which is also called on destruction
+    class ShaderCompiler
+    {
+    public:
+      // an empty cacheFileName just caches in memory; a threadCount of 0 uses std::thread::hardware_concurrency() threads
+      ShaderCompiler( std::string const & cacheFileName = "", uint32_t threadCount = 0 );
+      ShaderCompiler( ShaderCompiler const & ) = delete;
+      ~ShaderCompiler();
+
+      ShaderCompiler & operator=( ShaderCompiler const & ) = delete;
+
+      // throws a std::runtime_error if the shader can't be compiled
+      std::vector<unsigned int> compile( vk::ShaderStageFlagBits shaderStage, std::string const & glslShader );
+
+      // compiles the shaders not found in the cache in parallel; throws a std::runtime_error if any of the shaders can't be compiled
+      std::vector<std::vector<unsigned int>> compile( std::vector<std::pair<vk::ShaderStageFlagBits, std::string>> const & shaders );
+
+      // writes the cache file, if there are any newly compiled shaders; returns false if the file couldn't be written
+      bool flush();
+
+      size_t cacheHits() const
+      {
+        return m_cacheHits;
+      }
+
+      size_t cacheMisses() const
+      {
+        return m_cacheMisses;
+      }
+
+    private:
+      // keeps glslang initialized as long as the ShaderCompiler lives, and releases it even if the constructor throws later on
+      struct GlslangProcess
+      {
+        GlslangProcess();
+        ~GlslangProcess();
+      };
+
+      bool lookup( uint64_t key, std::vector<unsigned int> & spvShader ) const;
+      void mapCacheFile();
+
+    private:
+      GlslangProcess                                m_glslangProcess;
+      std::string                                   m_cacheFileName;
+      uint32_t                                      m_threadCount;
+      MappedFile                                    m_mappedFile;
+      size_t                                        m_mappedEntryCount = 0;
+      std::map<uint64_t, std::vector<unsigned int>> m_compiledShaders;  // compiled, but not yet written to the cache file
+      size_t                                        m_cacheHits   = 0;
+      size_t                                        m_cacheMisses = 0;
+    };
+
+    // the cache file shared by all the samples; the shaders are addressed by their contents, so the samples don't get into each other's way
+    char const * const samplesShaderCacheFileName = "VulkanHppSamples.spvcache";
+
     vk::ShaderModule createShaderModule( vk::Device const & device, vk::ShaderStageFlagBits shaderStage, std::string const & shaderText );
+    vk::ShaderModule
+      createShaderModule( vk::Device const & device, vk::ShaderStageFlagBits shaderStage, std::string const & shaderText, ShaderCompiler & shaderCompiler );
 
     bool GLSLtoSPV( const vk::ShaderStageFlagBits shaderType, std::string const & glslShader, std::vector<unsigned int> & spvShader );
   }  // namespace su
@@ -0,0 +1,292 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+#include "uploadEngine.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace vk
+{
+  namespace su
+  {
+    namespace
+    {
+      vk::DeviceSize leastCommonMultiple( vk::DeviceSize a, vk::DeviceSize b )
+      {
+        vk::DeviceSize x = a;
+        vk::DeviceSize y = b;
+        while ( y != 0 )
+        {
+          vk::DeviceSize t = x % y;
+          x                = y;
+          y                = t;
+        }
+        return a / x * b;
+      }
+    }  // namespace
+
+    UploadEngine::UploadEngine(
+      vk::PhysicalDevice const & physicalDevice, vk::Device const & device, uint32_t queueFamilyIndex, vk::Queue const & queue, vk::DeviceSize ringSize )
+      : m_device( device )
+      , m_queue( queue )
+      , m_commandPool( device.createCommandPool(
+          vk::CommandPoolCreateInfo( vk::CommandPoolCreateFlagBits::eTransient | vk::CommandPoolCreateFlagBits::eResetCommandBuffer, queueFamilyIndex ) ) )
+      , m_ringBufferData( physicalDevice, device, ringSize, vk::BufferUsageFlagBits::eTransferSrc )
+      , m_ringData( static_cast<uint8_t *>( device.mapMemory( m_ringBufferData.deviceMemory, 0, ringSize ) ) )
+      , m_ringSize( ringSize )
+      , m_copyOffsetAlignment( ( std::max )( vk::DeviceSize( 4 ), physicalDevice.getProperties().limits.optimalBufferCopyOffsetAlignment ) )
+    {
+    }
+
+    UploadEngine::~UploadEngine()
+    {
+      try
+      {
+        waitIdle();
+      }
+      catch ( vk::SystemError const & )
+      {
+        // most likely a lost device, which is not going to execute any batch still in flight; there's nothing left to wait for then
+      }
+
+      for ( auto const & batch : m_batchesInFlight )
+      {
+        m_device.destroyFence( batch.fence );
+      }
+      for ( auto const & batch : m_freeBatches )
+      {
+        m_device.destroyFence( batch.fence );
+      }
+      m_device.destroyCommandPool( m_commandPool );  // implicitly frees all the command buffers
+      m_device.unmapMemory( m_ringBufferData.deviceMemory );
+      m_ringBufferData.clear( m_device );
+    }
+
+    void UploadEngine::uploadBuffer( vk::Buffer const & dstBuffer, vk::DeviceSize dstOffset, void const * data, vk::DeviceSize size )
+    {
+      assert( data && ( 0 < size ) );
+
+      // split large uploads into chunks of at most half the ring, such that one chunk can be filled while the previous one is copied
+      uint8_t const * src = static_cast<uint8_t const *>( data );
+      while ( 0 < size )
+      {
+        vk::DeviceSize chunkSize = ( std::min )( size, m_ringSize / 2 );
+        memcpy( allocateBufferCopy( dstBuffer, dstOffset, chunkSize ), src, static_cast<size_t>( chunkSize ) );
+        src += chunkSize;
+        dstOffset += chunkSize;
+        size -= chunkSize;
+      }
+    }
+
+    void UploadEngine::uploadImage( vk::Image const &    image,
+                                    vk::Format           format,
+                                    vk::Extent2D const & extent,
+                                    void const *         data,
+                                    vk::DeviceSize       size,
+                                    vk::DeviceSize       texelBlockSize,
+                                    vk::ImageLayout      finalLayout )
+    {
+      assert( data && ( 0 < size ) );
+      memcpy( allocateImageCopy( image, format, extent, size, texelBlockSize, finalLayout ), data, static_cast<size_t>( size ) );
+    }
+
+    uint64_t UploadEngine::flush()
+    {
+      if ( m_pendingBufferCopies.empty() && m_pendingImages.empty() )
+      {
+        return m_lastBatchId;
+      }
+
+      // recycle the command buffer and fence of some completed batch, if possible
+      reclaim( false );
+      Batch batch;
+      if ( m_freeBatches.empty() )
+      {
+        batch.commandBuffer = m_device.allocateCommandBuffers( vk::CommandBufferAllocateInfo( m_commandPool, vk::CommandBufferLevel::ePrimary, 1 ) ).front();
+        batch.fence         = m_device.createFence( vk::FenceCreateInfo() );
+      }
+      else
+      {
+        batch = m_freeBatches.back();
+        m_freeBatches.pop_back();
+        m_device.resetFences( batch.fence );
+        batch.commandBuffer.reset();
+      }
+
+      batch.commandBuffer.begin( vk::CommandBufferBeginInfo( vk::CommandBufferUsageFlagBits::eOneTimeSubmit ) );
+      for ( auto const & pendingImage : m_pendingImages )
+      {
+        if ( pendingImage.hasCopy )
+        {
+          vk::su::setImageLayout( batch.commandBuffer, pendingImage.image, pendingImage.format, pendingImage.oldLayout, vk::ImageLayout::eTransferDstOptimal );
+        }
+      }
+      for ( auto const & pendingBufferCopies : m_pendingBufferCopies )
+      {
+        batch.commandBuffer.copyBuffer( m_ringBufferData.buffer, pendingBufferCopies.dstBuffer, pendingBufferCopies.regions );
+      }
+      for ( auto const & pendingImage : m_pendingImages )
+      {
+        if ( pendingImage.hasCopy )
+        {
+          batch.commandBuffer.copyBufferToImage( m_ringBufferData.buffer, pendingImage.image, vk::ImageLayout::eTransferDstOptimal, pendingImage.region );
+        }
+        vk::su::setImageLayout( batch.commandBuffer,
+                                pendingImage.image,
+                                pendingImage.format,
+                                pendingImage.hasCopy ? vk::ImageLayout::eTransferDstOptimal : pendingImage.oldLayout,
+                                pendingImage.newLayout );
+      }
+      if ( !m_pendingBufferCopies.empty() )
+      {
+        // make the buffer copies visible to whatever comes next on this queue
+        batch.commandBuffer.pipelineBarrier( vk::PipelineStageFlagBits::eTransfer,
+                                             vk::PipelineStageFlagBits::eAllCommands,
+                                             {},
+                                             vk::MemoryBarrier( vk::AccessFlagBits::eTransferWrite, vk::AccessFlagBits::eMemoryRead ),
+                                             nullptr,
+                                             nullptr );
+      }
+      batch.commandBuffer.end();
+
+      m_queue.submit( vk::SubmitInfo( 0, nullptr, nullptr, 1, &batch.commandBuffer ), batch.fence );
+
+      batch.id      = ++m_lastBatchId;
+      batch.ringEnd = m_ringHead;
+      m_batchesInFlight.push_back( batch );
+      m_pendingBufferCopies.clear();
+      m_pendingImages.clear();
+      return batch.id;
+    }
+
+    bool UploadEngine::isComplete( uint64_t batchId )
+    {
+      assert( batchId <= m_lastBatchId );
+      reclaim( false );
+      return m_batchesInFlight.empty() || ( batchId < m_batchesInFlight.front().id );
+    }
+
+    void UploadEngine::wait( uint64_t batchId )
+    {
+      assert( batchId <= m_lastBatchId );
+      while ( !m_batchesInFlight.empty() && ( m_batchesInFlight.front().id <= batchId ) )
+      {
+        reclaim( true );
+      }
+    }
+
+    void UploadEngine::waitIdle()
+    {
+      wait( flush() );
+    }
+
+    void * UploadEngine::allocateBufferCopy( vk::Buffer const & dstBuffer, vk::DeviceSize dstOffset, vk::DeviceSize size )
+    {
+      vk::DeviceSize ringOffset = allocate( size, m_copyOffsetAlignment );
+
+      // collect all copies to the same buffer into one copyBuffer
+      auto it = std::find_if( m_pendingBufferCopies.begin(),
+                              m_pendingBufferCopies.end(),
+                              [&dstBuffer]( PendingBufferCopies const & pendingBufferCopies ) { return pendingBufferCopies.dstBuffer == dstBuffer; } );
+      if ( it == m_pendingBufferCopies.end() )
+      {
+        m_pendingBufferCopies.push_back( PendingBufferCopies{ dstBuffer, {} } );
+        it = std::prev( m_pendingBufferCopies.end() );
+      }
+      it->regions.push_back( vk::BufferCopy( ringOffset, dstOffset, size ) );
+
+      return m_ringData + ringOffset;
+    }
+
+    void * UploadEngine::allocateImageCopy( vk::Image const &    image,
+                                            vk::Format           format,
+                                            vk::Extent2D const & extent,
+                                            vk::DeviceSize       size,
+                                            vk::DeviceSize       texelBlockSize,
+                                            vk::ImageLayout      finalLayout )
+    {
+      assert( 0 < texelBlockSize );
+
+      // the bufferOffset of a vk::BufferImageCopy needs to be a multiple of 4 and of the texel block size
+      vk::DeviceSize ringOffset = allocate( size, leastCommonMultiple( texelBlockSize, m_copyOffsetAlignment ) );
+
+      m_pendingImages.push_back( PendingImage{ image,
+                                               format,
+                                               vk::ImageLayout::eUndefined,
+                                               finalLayout,
+                                               true,
+                                               vk::BufferImageCopy( ringOffset,
+                                                                    0,
+                                                                    0,
+                                                                    vk::ImageSubresourceLayers( vk::ImageAspectFlagBits::eColor, 0, 0, 1 ),
+                                                                    vk::Offset3D( 0, 0, 0 ),
+                                                                    vk::Extent3D( extent, 1 ) ) } );
+
+      return m_ringData + ringOffset;
+    }
+
+    vk::DeviceSize UploadEngine::allocate( vk::DeviceSize size, vk::DeviceSize alignment )
+    {
+      assert( 0 < size );
+      if ( m_ringSize < size )
+      {
+        // waiting for the batches in flight would never make enough room
+        throw std::runtime_error( "vk::su::UploadEngine: an upload of " + std::to_string( size ) + " bytes does not fit into the staging ring of " +
+                                  std::to_string( m_ringSize ) + " bytes" );
+      }
+
+      while ( true )
+      {
+        if ( m_batchesInFlight.empty() && m_pendingBufferCopies.empty() && m_pendingImages.empty() )
+        {
+          // nothing in use -> start over at the beginning of the ring
+          m_ringHead = 0;
+          m_ringTail = 0;
+        }
+
+        // align the offset into the ring, or wrap around to its beginning if the region wouldn't fit in front of its end
+        vk::DeviceSize offset        = m_ringHead % m_ringSize;
+        vk::DeviceSize alignedOffset = ( offset + alignment - 1 ) / alignment * alignment;
+        uint64_t       position      = m_ringHead - offset + ( ( alignedOffset + size <= m_ringSize ) ? alignedOffset : m_ringSize );
+        if ( position + size - m_ringTail <= m_ringSize )
+        {
+          m_ringHead = position + size;
+          return position % m_ringSize;
+        }
+
+        // the ring is full -> submit what's pending, and wait for the oldest batch
+        if ( m_batchesInFlight.empty() )
+        {
+          flush();
+        }
+        reclaim( true );
+      }
+    }
+
+    void UploadEngine::reclaim( bool waitForOldest )
+    {
+      while ( !m_batchesInFlight.empty() )
+      {
+        Batch const & batch = m_batchesInFlight.front();
+        if ( waitForOldest )
+        {
+          while ( vk::Result::eTimeout == m_device.waitForFences( batch.fence, VK_TRUE, vk::su::FenceTimeout ) )
+            ;
+          waitForOldest = false;
+        }
+        else if ( m_device.getFenceStatus( batch.fence ) != vk::Result::eSuccess )
+        {
+          break;
+        }
+        m_ringTail = batch.ringEnd;
+        m_freeBatches.push_back( batch );
+        m_batchesInFlight.pop_front();
+      }
+    }
+  }  // namespace su
+}  // namespace vk
@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "utils.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+#include <vulkan/vulkan.hpp>
+
+namespace vk
+{
+  namespace su
+  {
+    // Streams data into device-local buffers and images through one persistently mapped, host-visible staging ring.
+    //  - each upload sub-allocates an aligned region of the ring and copies the data right into it; nothing is submitted yet
+    //  - flush() records all copies since the previous flush into one command buffer (one copyBuffer per destination buffer, one
+    //    copyBufferToImage per image) and submits it with a fence, without waiting for it
+    //  - the ring space of a flushed batch is reclaimed as soon as its fence is signaled; only if the ring is full, an upload waits for the
+    //    oldest batch in flight (flushing the pending copies first, if needed)
+    // The copies are made visible to all later commands on the same queue; other queues need to wait for the batch (see wait()).
+    class UploadEngine
+    {
+    public:
+      UploadEngine( vk::PhysicalDevice const & physicalDevice,
+                    vk::Device const &         device,
+                    uint32_t                   queueFamilyIndex,
+                    vk::Queue const &          queue,
+                    vk::DeviceSize             ringSize = 16 * 1024 * 1024 );
+      UploadEngine( UploadEngine const & ) = delete;
+      ~UploadEngine();
+
+      UploadEngine & operator=( UploadEngine const & ) = delete;
+
+      // uploads that don't fit into the ring are split into several copies, possibly spread over several batches
+      void uploadBuffer( vk::Buffer const & dstBuffer, vk::DeviceSize dstOffset, void const * data, vk::DeviceSize size );
+
+      template <typename DataType>
+      void upload( BufferData const & bufferData, std::vector<DataType> const & data, size_t stride = 0 )
+      {
+        size_t elementSize = stride ? stride : sizeof( DataType );
+        assert( sizeof( DataType ) <= elementSize );
+
+        if ( elementSize == sizeof( DataType ) )
+        {
+          uploadBuffer( bufferData.buffer, 0, data.data(), data.size() * sizeof( DataType ) );
+        }
+        else
+        {
+          // scatter the elements right into the ring, in chunks of at most half the ring (see uploadBuffer)
+          size_t chunkCount = ( std::max )( size_t( 1 ), static_cast<size_t>( m_ringSize / 2 / elementSize ) );
+          for ( size_t first = 0; first < data.size(); first += chunkCount )
+          {
+            size_t    count = ( std::min )( chunkCount, data.size() - first );
+            uint8_t * dst   = static_cast<uint8_t *>( allocateBufferCopy( bufferData.buffer, first * elementSize, count * elementSize ) );
+            for ( size_t i = 0; i < count; ++i )
+            {
+              memcpy( dst, &data[first + i], sizeof( DataType ) );
+              dst += elementSize;
+            }
+          }
+        }
+      }
+
+      // uploads the (tightly packed) texels of mip level 0, array layer 0 of a 2D color image, and transitions it to finalLayout;
+      // texelBlockSize is the size of one texel block of format, and the whole image needs to fit into the ring, or a std::runtime_error is thrown
+      void uploadImage( vk::Image const &    image,
+                        vk::Format           format,
+                        vk::Extent2D const & extent,
+                        void const *         data,
+                        vk::DeviceSize       size,
+                        vk::DeviceSize       texelBlockSize = 4,
+                        vk::ImageLayout      finalLayout    = vk::ImageLayout::eShaderReadOnlyOptimal );
+
+      // the counterpart of TextureData::setImage: imageGenerator writes right into the ring (or into the linear image, if no staging is needed)
+      template <typename ImageGenerator>
+      void setImage( TextureData const & textureData, ImageGenerator const & imageGenerator )
+      {
+        if ( textureData.needsStaging )
+        {
+          vk::DeviceSize size = vk::DeviceSize( textureData.extent.width ) * textureData.extent.height * 4;
+          void *         data =
+            allocateImageCopy( textureData.imageData->image, textureData.format, textureData.extent, size, 4, vk::ImageLayout::eShaderReadOnlyOptimal );
+          imageGenerator( data, textureData.extent );
+        }
+        else
+        {
+          void * data =
+            m_device.mapMemory( textureData.imageData->deviceMemory, 0, m_device.getImageMemoryRequirements( textureData.imageData->image ).size );
+          imageGenerator( data, textureData.extent );
+          m_device.unmapMemory( textureData.imageData->deviceMemory );
+          m_pendingImages.push_back( PendingImage{
+            textureData.imageData->image, textureData.format, vk::ImageLayout::ePreinitialized, vk::ImageLayout::eShaderReadOnlyOptimal, false, {} } );
+        }
+      }
+
+      // submits all pending copies and returns the id of that batch; returns the id of the previous batch if nothing is pending
+      uint64_t flush();
+
+      bool isComplete( uint64_t batchId );
+
+      // waits until batch batchId has finished executing
+      void wait( uint64_t batchId );
+
+      // flushes all pending copies and waits until everything has finished executing
+      void waitIdle();
+
+    private:
+      struct Batch
+      {
+        vk::CommandBuffer commandBuffer;
+        vk::Fence         fence;
+        uint64_t          id;
+        uint64_t          ringEnd;  // ring position (see m_ringHead) just behind the last byte used by this batch
+      };
+
+      struct PendingBufferCopies
+      {
+        vk::Buffer                  dstBuffer;
+        std::vector<vk::BufferCopy> regions;
+      };
+
+      struct PendingImage
+      {
+        vk::Image           image;
+        vk::Format          format;
+        vk::ImageLayout     oldLayout;
+        vk::ImageLayout     newLayout;
+        bool                hasCopy;
+        vk::BufferImageCopy region;
+      };
+
+      void *         allocateBufferCopy( vk::Buffer const & dstBuffer, vk::DeviceSize dstOffset, vk::DeviceSize size );
+      void *         allocateImageCopy( vk::Image const &    image,
+                                        vk::Format           format,
+                                        vk::Extent2D const & extent,
+                                        vk::DeviceSize       size,
+                                        vk::DeviceSize       texelBlockSize,
+                                        vk::ImageLayout      finalLayout );
+      vk::DeviceSize allocate( vk::DeviceSize size, vk::DeviceSize alignment );
+      void           reclaim( bool waitForOldest );
+
+    private:
+      vk::Device                       m_device;
+      vk::Queue                        m_queue;
+      vk::CommandPool                  m_commandPool;
+      BufferData                       m_ringBufferData;
+      uint8_t *                        m_ringData;
+      vk::DeviceSize                   m_ringSize;
+      vk::DeviceSize                   m_copyOffsetAlignment;
+      uint64_t                         m_ringHead = 0;  // the ring positions increase monotonically; the offset into the ring is position % m_ringSize
+      uint64_t                         m_ringTail = 0;  // start of the oldest region still in use
+      std::vector<PendingBufferCopies> m_pendingBufferCopies;
+      std::vector<PendingImage>        m_pendingImages;
+      std::deque<Batch>                m_batchesInFlight;
+      std::vector<Batch>               m_freeBatches;  // command buffers and fences for reuse
+      uint64_t                         m_lastBatchId = 0;
+    };
+  }  // namespace su
+}  // namespace vk
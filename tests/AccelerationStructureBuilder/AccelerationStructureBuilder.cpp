@@ -0,0 +1,302 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Tests : AccelerationStructureBuilder
+//                   Runtime test on vk::raii::su::AccelerationStructureBuilder, running on the null driver with faked build sizes, buffer
+//                   addresses and compacted sizes, checking the recorded commands
+
+#if !defined( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC )
+#  define VULKAN_HPP_DISPATCH_LOADER_DYNAMIC 1
+#endif
+
+#include "../../RAII_Samples/utils/accelerationStructureBuilder.hpp"
+#include "../null_driver_fixture.hpp"
+
+#include <map>
+
+namespace fake
+{
+  // an acceleration structure takes 1000 bytes per primitive, its build 300 bytes of scratch memory per primitive
+  VkDeviceSize const AccelerationStructureBytesPerPrimitive = 1000;
+  VkDeviceSize const ScratchBytesPerPrimitive               = 300;
+  VkDeviceSize const ScratchAlignment                       = 128;
+
+  struct AccelerationStructure
+  {
+    VkBuffer     buffer;
+    VkDeviceSize offset;
+    VkDeviceSize size;
+    bool         built;
+  };
+
+  std::map<VkBuffer, VkDeviceSize>                            bufferSizes;
+  std::map<VkAccelerationStructureKHR, AccelerationStructure> accelerationStructures;
+  uint32_t                                                    buildCallCount   = 0;
+  uint32_t                                                    barrierCount     = 0;
+  uint32_t                                                    copyCount        = 0;
+  uint32_t                                                    resetQueryCount  = 0;
+  bool                                                        expectCompaction = false;
+
+  uint32_t primitiveCount( VkAccelerationStructureBuildRangeInfoKHR const * pBuildRanges, uint32_t geometryCount )
+  {
+    uint32_t count = 0;
+    for ( uint32_t i = 0; i < geometryCount; ++i )
+    {
+      count += pBuildRanges[i].primitiveCount;
+    }
+    return count;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceProperties2( VkPhysicalDevice, VkPhysicalDeviceProperties2 * pProperties )
+  {
+    for ( VkBaseOutStructure * pNext = static_cast<VkBaseOutStructure *>( pProperties->pNext ); pNext; pNext = pNext->pNext )
+    {
+      if ( pNext->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR )
+      {
+        reinterpret_cast<VkPhysicalDeviceAccelerationStructurePropertiesKHR *>( pNext )->minAccelerationStructureScratchOffsetAlignment =
+          static_cast<uint32_t>( ScratchAlignment );
+      }
+    }
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL createBuffer( VkDevice, VkBufferCreateInfo const * pCreateInfo, VkAllocationCallbacks const *, VkBuffer * pBuffer )
+  {
+    release_assert( pCreateInfo->usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT );
+    *pBuffer              = vk::detail::NullDriver::nextHandle<VkBuffer>();
+    bufferSizes[*pBuffer] = pCreateInfo->size;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL getBufferMemoryRequirements( VkDevice, VkBuffer buffer, VkMemoryRequirements * pMemoryRequirements )
+  {
+    pMemoryRequirements->size           = bufferSizes[buffer];
+    pMemoryRequirements->alignment      = 64;
+    pMemoryRequirements->memoryTypeBits = 0x1;
+  }
+
+  // the buffer addresses are just 64 byte aligned, less than what the scratch memory needs
+  VKAPI_ATTR VkDeviceAddress VKAPI_CALL getBufferDeviceAddress( VkDevice, VkBufferDeviceAddressInfo const * pInfo )
+  {
+    return ( static_cast<VkDeviceAddress>( std::distance( bufferSizes.begin(), bufferSizes.find( pInfo->buffer ) ) ) + 1 ) * 0x100000000ull + 64;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL getAccelerationStructureBuildSizes( VkDevice,
+                                                                 VkAccelerationStructureBuildTypeKHR,
+                                                                 VkAccelerationStructureBuildGeometryInfoKHR const * pBuildInfo,
+                                                                 uint32_t const *                                    pMaxPrimitiveCounts,
+                                                                 VkAccelerationStructureBuildSizesInfoKHR *          pSizeInfo )
+  {
+    uint32_t count = 0;
+    for ( uint32_t i = 0; i < pBuildInfo->geometryCount; ++i )
+    {
+      count += pMaxPrimitiveCounts[i];
+    }
+    pSizeInfo->accelerationStructureSize = count * AccelerationStructureBytesPerPrimitive;
+    pSizeInfo->buildScratchSize          = count * ScratchBytesPerPrimitive;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL createAccelerationStructure( VkDevice,
+                                                              VkAccelerationStructureCreateInfoKHR const * pCreateInfo,
+                                                              VkAllocationCallbacks const *,
+                                                              VkAccelerationStructureKHR * pAccelerationStructure )
+  {
+    release_assert( ( pCreateInfo->offset % 256 == 0 ) && ( pCreateInfo->offset + pCreateInfo->size <= bufferSizes[pCreateInfo->buffer] ) );
+    *pAccelerationStructure                         = vk::detail::NullDriver::nextHandle<VkAccelerationStructureKHR>();
+    accelerationStructures[*pAccelerationStructure] = { pCreateInfo->buffer, pCreateInfo->offset, pCreateInfo->size, false };
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL destroyAccelerationStructure( VkDevice, VkAccelerationStructureKHR accelerationStructure, VkAllocationCallbacks const * )
+  {
+    accelerationStructures.erase( accelerationStructure );
+  }
+
+  // the builds of one call run concurrently, so their scratch ranges must not overlap
+  VKAPI_ATTR void VKAPI_CALL cmdBuildAccelerationStructures( VkCommandBuffer,
+                                                             uint32_t                                                 infoCount,
+                                                             VkAccelerationStructureBuildGeometryInfoKHR const *      pInfos,
+                                                             VkAccelerationStructureBuildRangeInfoKHR const * const * ppBuildRangeInfos )
+  {
+    ++buildCallCount;
+    std::map<VkDeviceAddress, VkDeviceAddress> scratchRanges;
+    for ( uint32_t i = 0; i < infoCount; ++i )
+    {
+      AccelerationStructure & accelerationStructure = accelerationStructures[pInfos[i].dstAccelerationStructure];
+      uint32_t                count                 = primitiveCount( ppBuildRangeInfos[i], pInfos[i].geometryCount );
+      release_assert( !accelerationStructure.built && ( accelerationStructure.size == count * AccelerationStructureBytesPerPrimitive ) );
+      release_assert( !expectCompaction || ( pInfos[i].flags & VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR ) );
+      accelerationStructure.built = true;
+
+      VkDeviceAddress scratchAddress = pInfos[i].scratchData.deviceAddress;
+      release_assert( scratchAddress % ScratchAlignment == 0 );
+      scratchRanges[scratchAddress] = scratchAddress + count * ScratchBytesPerPrimitive;
+    }
+    VkDeviceAddress previousEnd = 0;
+    for ( auto const & scratchRange : scratchRanges )
+    {
+      release_assert( previousEnd <= scratchRange.first );
+      previousEnd = scratchRange.second;
+    }
+  }
+
+  VKAPI_ATTR void VKAPI_CALL cmdPipelineBarrier( VkCommandBuffer,
+                                                 VkPipelineStageFlags srcStageMask,
+                                                 VkPipelineStageFlags dstStageMask,
+                                                 VkDependencyFlags,
+                                                 uint32_t memoryBarrierCount,
+                                                 VkMemoryBarrier const *,
+                                                 uint32_t,
+                                                 VkBufferMemoryBarrier const *,
+                                                 uint32_t,
+                                                 VkImageMemoryBarrier const * )
+  {
+    release_assert( ( srcStageMask == VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR ) &&
+                    ( dstStageMask == VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR ) && ( memoryBarrierCount == 1 ) );
+    ++barrierCount;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL cmdResetQueryPool( VkCommandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount )
+  {
+    ++resetQueryCount;
+    fixture::resetQueries( queryPool, firstQuery, queryCount );
+  }
+
+  // each acceleration structure compacts to half its size
+  VKAPI_ATTR void VKAPI_CALL cmdWriteAccelerationStructuresProperties( VkCommandBuffer,
+                                                                       uint32_t                           accelerationStructureCount,
+                                                                       VkAccelerationStructureKHR const * pAccelerationStructures,
+                                                                       VkQueryType                        queryType,
+                                                                       VkQueryPool                        queryPool,
+                                                                       uint32_t                           firstQuery )
+  {
+    release_assert( queryType == VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR );
+    for ( uint32_t i = 0; i < accelerationStructureCount; ++i )
+    {
+      fixture::Query & query = fixture::queries()[std::make_pair( queryPool, firstQuery + i )];
+      query.values.assign( 1, accelerationStructures[pAccelerationStructures[i]].size / 2 );
+      query.available = true;
+    }
+  }
+
+  VKAPI_ATTR void VKAPI_CALL cmdCopyAccelerationStructure( VkCommandBuffer, VkCopyAccelerationStructureInfoKHR const * pInfo )
+  {
+    release_assert( pInfo->mode == VK_COPY_ACCELERATION_STRUCTURE_MODE_COMPACT_KHR );
+    AccelerationStructure const & src = accelerationStructures[pInfo->src];
+    AccelerationStructure &       dst = accelerationStructures[pInfo->dst];
+    release_assert( src.built && !dst.built && ( dst.size == src.size / 2 ) );
+    dst.built = true;
+    ++copyCount;
+  }
+
+  void install()
+  {
+    fixture::addOverride( "vkGetPhysicalDeviceMemoryProperties", &fixture::getPhysicalDeviceMemoryProperties );
+    fixture::addOverride( "vkGetPhysicalDeviceProperties2", &getPhysicalDeviceProperties2 );
+    fixture::addOverride( "vkCreateBuffer", &createBuffer );
+    fixture::addOverride( "vkGetBufferMemoryRequirements", &getBufferMemoryRequirements );
+    fixture::addOverride( "vkGetBufferDeviceAddress", &getBufferDeviceAddress );
+    fixture::addOverride( "vkGetAccelerationStructureBuildSizesKHR", &getAccelerationStructureBuildSizes );
+    fixture::addOverride( "vkCreateAccelerationStructureKHR", &createAccelerationStructure );
+    fixture::addOverride( "vkDestroyAccelerationStructureKHR", &destroyAccelerationStructure );
+    fixture::addOverride( "vkCmdBuildAccelerationStructuresKHR", &cmdBuildAccelerationStructures );
+    fixture::addOverride( "vkCmdPipelineBarrier", &cmdPipelineBarrier );
+    fixture::addOverride( "vkCmdResetQueryPool", &cmdResetQueryPool );
+    fixture::addOverride( "vkCmdWriteAccelerationStructuresPropertiesKHR", &cmdWriteAccelerationStructuresProperties );
+    fixture::addOverride( "vkGetQueryPoolResults", &fixture::getQueryPoolResults );
+    fixture::addOverride( "vkCmdCopyAccelerationStructureKHR", &cmdCopyAccelerationStructure );
+  }
+}  // namespace fake
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  fake::install();
+
+  fixture::NullDevice              nullDevice;
+  vk::raii::PhysicalDevice const & physicalDevice = nullDevice.physicalDevices[0];
+  vk::raii::Device const &         device         = nullDevice.device;
+  vk::raii::CommandBuffer const &  commandBuffer  = nullDevice.commandBuffer;
+
+  vk::DeviceSize const ScratchBudget = 64 * 1024;
+
+  {
+    // 100 meshes with 1 to 100 triangles, every other one split into two geometries
+    vk::raii::su::AccelerationStructureBuilder builder( physicalDevice, device, true, ScratchBudget );
+    fake::expectCompaction = true;
+
+    vk::AccelerationStructureGeometryKHR geometry( vk::GeometryTypeKHR::eTriangles, vk::AccelerationStructureGeometryTrianglesDataKHR() );
+    vk::DeviceSize                       expectedSize = 0;
+    for ( uint32_t i = 1; i <= 100; ++i )
+    {
+      if ( i % 2 )
+      {
+        release_assert( builder.add( geometry, vk::AccelerationStructureBuildRangeInfoKHR( i ) ) == i - 1 );
+      }
+      else
+      {
+        std::vector<vk::AccelerationStructureGeometryKHR>       geometries( 2, geometry );
+        std::vector<vk::AccelerationStructureBuildRangeInfoKHR> buildRanges = { vk::AccelerationStructureBuildRangeInfoKHR( i / 2 ),
+                                                                                vk::AccelerationStructureBuildRangeInfoKHR( i - i / 2 ) };
+        release_assert( builder.add( geometries, buildRanges ) == i - 1 );
+      }
+      expectedSize = ( expectedSize + 255 ) / 256 * 256 + i * fake::AccelerationStructureBytesPerPrimitive;
+    }
+    release_assert( builder.size() == 100 );
+
+    // the builds are batched by the scratch budget, with one barrier after each batch
+    uint32_t       expectedBuildCalls = 1;
+    vk::DeviceSize scratchOffset      = 0;
+    for ( uint32_t i = 1; i <= 100; ++i )
+    {
+      vk::DeviceSize scratchSize = ( i * fake::ScratchBytesPerPrimitive + fake::ScratchAlignment - 1 ) / fake::ScratchAlignment * fake::ScratchAlignment;
+      if ( ScratchBudget < scratchOffset + scratchSize )
+      {
+        ++expectedBuildCalls;
+        scratchOffset = 0;
+      }
+      scratchOffset += scratchSize;
+    }
+
+    builder.build( commandBuffer );
+    release_assert( ( 1 < fake::buildCallCount ) && ( fake::buildCallCount == expectedBuildCalls ) && ( fake::barrierCount == expectedBuildCalls ) );
+    release_assert( ( fake::resetQueryCount == 1 ) && ( fixture::queries().size() == 100 ) );
+    release_assert( ( fake::accelerationStructures.size() == 100 ) && ( builder.getStorageSize() == expectedSize ) );
+    for ( auto const & accelerationStructure : fake::accelerationStructures )
+    {
+      release_assert( accelerationStructure.second.built );
+    }
+
+    // compaction copies everything into new acceleration structures of half the size, the old ones being released by finish()
+    std::vector<vk::AccelerationStructureKHR> uncompacted;
+    for ( uint32_t i = 0; i < builder.size(); ++i )
+    {
+      uncompacted.push_back( builder.getAccelerationStructure( i ) );
+    }
+    fake::barrierCount = 0;
+    builder.compact( commandBuffer );
+    release_assert( ( fixture::lastQueryPoolResultsCall().flags & VK_QUERY_RESULT_64_BIT ) &&
+                    ( fixture::lastQueryPoolResultsCall().stride == sizeof( VkDeviceSize ) ) );
+    release_assert( ( fake::copyCount == 100 ) && ( fake::barrierCount == 1 ) && ( fake::accelerationStructures.size() == 200 ) );
+    release_assert( builder.getStorageSize() < expectedSize / 2 + 100 * 256 );
+    for ( uint32_t i = 0; i < builder.size(); ++i )
+    {
+      release_assert( builder.getAccelerationStructure( i ) != uncompacted[i] );
+    }
+    builder.finish();
+    release_assert( fake::accelerationStructures.size() == 100 );
+  }
+  release_assert( fake::accelerationStructures.empty() );
+
+  {
+    // a single build larger than the scratch budget still gets a scratch buffer large enough
+    vk::raii::su::AccelerationStructureBuilder builder( physicalDevice, device, false, ScratchBudget );
+    fake::expectCompaction = false;
+    fake::buildCallCount   = 0;
+    builder.add( vk::AccelerationStructureGeometryKHR(), vk::AccelerationStructureBuildRangeInfoKHR( 1000 ) );
+    builder.add( vk::AccelerationStructureGeometryKHR(), vk::AccelerationStructureBuildRangeInfoKHR( 1 ) );
+    builder.build( commandBuffer );
+    release_assert( fake::buildCallCount == 2 );
+    builder.finish();
+  }
+
+  return 0;
+}
@@ -2,7 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 // VulkanHpp Tests : ArrayWrapper
-//                   Compile test on using vk::ArrayWrapper1D
+//                   Compile test on using vk::ArrayWrapper1D and vk::ArrayWrapper2D
 
 #include "../test_macros.hpp"
 #ifdef VULKAN_HPP_USE_CXX_MODULE
@@ -84,5 +84,16 @@ int main()
 
   release_assert( foobah > awc4 );
 
+  // non-char arrays can be brace initialized like plain arrays, missing elements being zero
+  vk::ArrayWrapper1D<float, 4> awf1 = { 1.0f, 2.0f };
+  release_assert( ( awf1[1] == 2.0f ) && ( awf1[2] == 0.0f ) && ( awf1[3] == 0.0f ) );
+  vk::ArrayWrapper1D<float, 4> awf2 = { { 1.0f, 2.0f, 3.0f, 4.0f } };
+  release_assert( awf2[3] == 4.0f );
+  awf1 = { 4.0f, 3.0f, 2.0f, 1.0f };
+  release_assert( awf1[0] == 4.0f );
+
+  vk::ArrayWrapper2D<float, 3, 4> aw2f = { { 1.0f, 0.0f, 0.0f, 5.0f }, { 0.0f, 1.0f, 0.0f, 6.0f } };
+  release_assert( ( aw2f[0][3] == 5.0f ) && ( aw2f[1][3] == 6.0f ) && ( aw2f[2][2] == 0.0f ) );
+
   return 0;
 }
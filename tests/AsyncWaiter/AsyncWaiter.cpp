@@ -0,0 +1,274 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Tests : AsyncWaiter
+//                   Runtime test on vk::raii::su::AsyncWaiter, running on the null driver with faked timeline semaphores and fences
+
+#if !defined( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC )
+#  define VULKAN_HPP_DISPATCH_LOADER_DYNAMIC 1
+#endif
+
+#include "../../RAII_Samples/utils/asyncWaiter.hpp"
+#include "../null_driver_fixture.hpp"
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <set>
+
+namespace fake
+{
+  // timeline semaphores are just counters, fences just flags; vkWaitSemaphores never blocks, but reports a timeout if no value is reached
+  std::map<VkSemaphore, uint64_t> semaphoreValues;
+  std::set<VkFence>               signaledFences;
+  uint32_t                        waitSemaphoresCount    = 0;
+  uint32_t                        lastWaitSemaphoreCount = 0;
+  VkResult                        waitSemaphoresResult   = VK_SUCCESS;
+  uint32_t                        getCounterValueCount   = 0;
+  uint32_t                        signalSemaphoreCount   = 0;
+  VkResult                        signalSemaphoreResult  = VK_SUCCESS;
+  std::function<void()>           duringWait;  // called once by the next vkWaitSemaphores, as if another thread was running meanwhile
+
+  VKAPI_ATTR VkResult VKAPI_CALL createSemaphore( VkDevice, VkSemaphoreCreateInfo const * pCreateInfo, VkAllocationCallbacks const *, VkSemaphore * pSemaphore )
+  {
+    *pSemaphore                  = vk::detail::NullDriver::nextHandle<VkSemaphore>();
+    semaphoreValues[*pSemaphore] = 0;
+    for ( VkBaseInStructure const * pNext = static_cast<VkBaseInStructure const *>( pCreateInfo->pNext ); pNext; pNext = pNext->pNext )
+    {
+      if ( pNext->sType == VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO )
+      {
+        semaphoreValues[*pSemaphore] = reinterpret_cast<VkSemaphoreTypeCreateInfo const *>( pNext )->initialValue;
+      }
+    }
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL getSemaphoreCounterValue( VkDevice, VkSemaphore semaphore, uint64_t * pValue )
+  {
+    ++getCounterValueCount;
+    *pValue = semaphoreValues[semaphore];
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL signalSemaphore( VkDevice, VkSemaphoreSignalInfo const * pSignalInfo )
+  {
+    ++signalSemaphoreCount;
+    if ( signalSemaphoreResult != VK_SUCCESS )
+    {
+      return signalSemaphoreResult;
+    }
+    semaphoreValues[pSignalInfo->semaphore] = pSignalInfo->value;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL waitSemaphores( VkDevice, VkSemaphoreWaitInfo const * pWaitInfo, uint64_t )
+  {
+    ++waitSemaphoresCount;
+    lastWaitSemaphoreCount = pWaitInfo->semaphoreCount;
+    release_assert( pWaitInfo->flags == VK_SEMAPHORE_WAIT_ANY_BIT );
+    if ( duringWait )
+    {
+      std::function<void()> action = std::move( duringWait );
+      duringWait                   = nullptr;
+      action();
+    }
+    if ( waitSemaphoresResult != VK_SUCCESS )
+    {
+      return waitSemaphoresResult;
+    }
+    for ( uint32_t i = 0; i < pWaitInfo->semaphoreCount; ++i )
+    {
+      if ( pWaitInfo->pValues[i] <= semaphoreValues[pWaitInfo->pSemaphores[i]] )
+      {
+        return VK_SUCCESS;
+      }
+    }
+    return VK_TIMEOUT;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL getFenceStatus( VkDevice, VkFence fence )
+  {
+    return signaledFences.count( fence ) ? VK_SUCCESS : VK_NOT_READY;
+  }
+
+  void install()
+  {
+    fixture::addOverride( "vkCreateSemaphore", &createSemaphore );
+    fixture::addOverride( "vkGetSemaphoreCounterValue", &getSemaphoreCounterValue );
+    fixture::addOverride( "vkSignalSemaphore", &signalSemaphore );
+    fixture::addOverride( "vkWaitSemaphores", &waitSemaphores );
+    fixture::addOverride( "vkGetFenceStatus", &getFenceStatus );
+  }
+}  // namespace fake
+
+// a fire-and-forget coroutine, running eagerly up to its first suspension
+struct Task
+{
+  struct promise_type
+  {
+    Task get_return_object()
+    {
+      return {};
+    }
+
+    std::suspend_never initial_suspend() noexcept
+    {
+      return {};
+    }
+
+    std::suspend_never final_suspend() noexcept
+    {
+      return {};
+    }
+
+    void return_void() {}
+
+    void unhandled_exception()
+    {
+      std::abort();
+    }
+  };
+};
+
+Task waitForSemaphore( vk::raii::su::AsyncWaiter & asyncWaiter, vk::raii::Semaphore const & semaphore, uint64_t value, std::vector<uint64_t> & resumed )
+{
+  co_await asyncWaiter.asyncWait( semaphore, value );
+  resumed.push_back( value );
+}
+
+Task waitForFence( vk::raii::su::AsyncWaiter & asyncWaiter, vk::raii::Fence const & fence, uint32_t & resumed )
+{
+  co_await asyncWaiter.asyncWait( fence );
+  ++resumed;
+}
+
+Task waitForError( vk::raii::su::AsyncWaiter & asyncWaiter, vk::raii::Semaphore const & semaphore, uint64_t value, uint32_t & errors )
+{
+  try
+  {
+    co_await asyncWaiter.asyncWait( semaphore, value );
+  }
+  catch ( vk::DeviceLostError const & )
+  {
+    ++errors;
+  }
+}
+
+vk::raii::Semaphore makeTimelineSemaphore( vk::raii::Device const & device, uint64_t initialValue )
+{
+  vk::StructureChain<vk::SemaphoreCreateInfo, vk::SemaphoreTypeCreateInfo> semaphoreCreateInfo( {}, { vk::SemaphoreType::eTimeline, initialValue } );
+  return vk::raii::Semaphore( device, semaphoreCreateInfo.get<vk::SemaphoreCreateInfo>() );
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  fake::install();
+
+  fixture::NullDevice      nullDevice;
+  vk::raii::Device const & device = nullDevice.device;
+
+  std::vector<vk::raii::Semaphore> semaphores;
+  for ( uint32_t i = 0; i < 3; ++i )
+  {
+    semaphores.push_back( makeTimelineSemaphore( device, 1 ) );
+  }
+
+  {
+    vk::raii::su::AsyncWaiter asyncWaiter( device );
+    std::vector<uint64_t>     resumed;
+
+    // already reached values don't suspend
+    waitForSemaphore( asyncWaiter, semaphores[0], 1, resumed );
+    release_assert( ( resumed.size() == 1 ) && ( asyncWaiter.pendingCount() == 0 ) );
+    resumed.clear();
+
+    // many waits on a few semaphores are waited on with one call to vkWaitSemaphores, covering each semaphore just once
+    for ( uint64_t value = 2; value < 100; ++value )
+    {
+      for ( auto const & semaphore : semaphores )
+      {
+        waitForSemaphore( asyncWaiter, semaphore, value, resumed );
+      }
+    }
+    release_assert( resumed.empty() && ( asyncWaiter.pendingCount() == 3 * 98 ) );
+
+    fake::waitSemaphoresCount = 0;
+    release_assert( asyncWaiter.poll( 1000 ) == 0 );
+    release_assert( ( fake::waitSemaphoresCount == 1 ) && ( fake::lastWaitSemaphoreCount == 1 + 3 ) );
+
+    // the waits up to the signaled value are resumed, in the order of their values
+    asyncWaiter.poll( 0 );
+    release_assert( resumed.empty() );
+    device.signalSemaphore( vk::SemaphoreSignalInfo( *semaphores[1], 10 ) );
+    release_assert( asyncWaiter.poll( 1000 ) == 9 );
+    release_assert( resumed == std::vector<uint64_t>( { 2, 3, 4, 5, 6, 7, 8, 9, 10 } ) );
+    release_assert( asyncWaiter.pendingCount() == 3 * 98 - 9 );
+
+    device.signalSemaphore( vk::SemaphoreSignalInfo( *semaphores[0], 1000 ) );
+    device.signalSemaphore( vk::SemaphoreSignalInfo( *semaphores[1], 1000 ) );
+    device.signalSemaphore( vk::SemaphoreSignalInfo( *semaphores[2], 1000 ) );
+    fake::getCounterValueCount = 0;
+    release_assert( asyncWaiter.poll( 1000 ) == 3 * 98 - 9 );
+    release_assert( fake::getCounterValueCount == 3 );
+    release_assert( asyncWaiter.pendingCount() == 0 );
+
+    // fences are checked on each poll
+    vk::raii::Fence fence( device, vk::FenceCreateInfo() );
+    uint32_t        fenceResumed = 0;
+    waitForFence( asyncWaiter, fence, fenceResumed );
+    waitForFence( asyncWaiter, fence, fenceResumed );
+    release_assert( ( asyncWaiter.poll( 1000 ) == 0 ) && ( fenceResumed == 0 ) );
+    fake::signaledFences.insert( static_cast<VkFence>( *fence ) );
+    release_assert( ( asyncWaiter.poll( 1000 ) == 2 ) && ( fenceResumed == 2 ) );
+    waitForFence( asyncWaiter, fence, fenceResumed );
+    release_assert( ( fenceResumed == 3 ) && ( asyncWaiter.pendingCount() == 0 ) );
+
+    // an error resumes all outstanding waits, each co_await rethrowing it
+    uint32_t errors = 0;
+    waitForError( asyncWaiter, semaphores[0], 2000, errors );
+    waitForError( asyncWaiter, semaphores[2], 3000, errors );
+    fake::waitSemaphoresResult = VK_ERROR_DEVICE_LOST;
+    release_assert( ( asyncWaiter.poll( 1000 ) == 2 ) && ( errors == 2 ) );
+    fake::waitSemaphoresResult = VK_SUCCESS;
+
+    // a wait that fails to wake up the blocking poll() throws right away, and is not resumed by poll() once more
+    fake::signalSemaphoreResult = VK_ERROR_DEVICE_LOST;
+    fake::duringWait            = [&]() { waitForError( asyncWaiter, semaphores[1], 5000, errors ); };
+    release_assert( ( asyncWaiter.poll( 1000 ) == 0 ) && ( errors == 3 ) && ( asyncWaiter.pendingCount() == 0 ) );
+    fake::signalSemaphoreResult = VK_SUCCESS;
+    fake::duringWait            = nullptr;
+
+    // stop() lets run() return once nothing is outstanding
+    asyncWaiter.stop();
+    asyncWaiter.run();
+  }
+
+  {
+    // with an executor, the coroutines are resumed wherever the executor decides to
+    std::deque<std::coroutine_handle<>> executorQueue;
+    vk::raii::su::AsyncWaiter           asyncWaiter( device, [&executorQueue]( std::coroutine_handle<> handle ) { executorQueue.push_back( handle ); } );
+    std::vector<uint64_t>               resumed;
+
+    waitForSemaphore( asyncWaiter, semaphores[0], 1001, resumed );
+    waitForSemaphore( asyncWaiter, semaphores[0], 1002, resumed );
+    device.signalSemaphore( vk::SemaphoreSignalInfo( *semaphores[0], 1002 ) );
+    release_assert( ( asyncWaiter.poll( 1000 ) == 2 ) && resumed.empty() && ( executorQueue.size() == 2 ) );
+    while ( !executorQueue.empty() )
+    {
+      executorQueue.front().resume();
+      executorQueue.pop_front();
+    }
+    release_assert( resumed == std::vector<uint64_t>( { 1001, 1002 } ) );
+
+    // a wait enqueued while not polling doesn't need to wake up anything
+    fake::signalSemaphoreCount = 0;
+    waitForSemaphore( asyncWaiter, semaphores[1], 2000, resumed );
+    release_assert( fake::signalSemaphoreCount == 0 );
+    device.signalSemaphore( vk::SemaphoreSignalInfo( *semaphores[1], 2000 ) );
+    release_assert( asyncWaiter.poll( 1000 ) == 1 );
+    executorQueue.front().resume();
+    release_assert( resumed.back() == 2000 );
+  }
+
+  return 0;
+}
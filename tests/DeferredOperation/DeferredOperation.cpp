@@ -0,0 +1,291 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Tests : DeferredOperation
+//                   Runtime test on vk::raii::su::DeferredOperation, running on the null driver with faked deferred host operations
+
+#if !defined( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC )
+#  define VULKAN_HPP_DISPATCH_LOADER_DYNAMIC 1
+#endif
+
+#include "../../RAII_Samples/utils/deferredOperation.hpp"
+#include "../null_driver_fixture.hpp"
+
+#include <atomic>
+#include <deque>
+#include <stdexcept>
+
+namespace fake
+{
+  // a deferred operation is a number of work items, taken one by one by all the threads joining it
+  uint32_t              maxConcurrency  = 0;
+  uint32_t              workItemCount   = 0;
+  VkResult              operationResult = VK_SUCCESS;
+  std::atomic<uint32_t> nextWorkItem( 0 );
+  std::atomic<uint32_t> completedWorkItems( 0 );
+  std::atomic<int32_t>  idleJoins( 0 );
+  std::atomic<uint32_t> activeJoiners( 0 );
+  std::atomic<uint32_t> maxActiveJoiners( 0 );
+  uint32_t              destroyedPipelineCount = 0;
+
+  void reset( uint32_t maxConcurrency_, uint32_t workItemCount_, int32_t idleJoins_, VkResult operationResult_ )
+  {
+    maxConcurrency     = maxConcurrency_;
+    workItemCount      = workItemCount_;
+    operationResult    = operationResult_;
+    nextWorkItem       = 0;
+    completedWorkItems = 0;
+    idleJoins          = idleJoins_;
+    activeJoiners      = 0;
+    maxActiveJoiners   = 0;
+  }
+
+  VKAPI_ATTR uint32_t VKAPI_CALL getDeferredOperationMaxConcurrency( VkDevice, VkDeferredOperationKHR )
+  {
+    return maxConcurrency;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL getDeferredOperationResult( VkDevice, VkDeferredOperationKHR )
+  {
+    return ( completedWorkItems == workItemCount ) ? operationResult : VK_NOT_READY;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL deferredOperationJoin( VkDevice, VkDeferredOperationKHR )
+  {
+    if ( 0 < idleJoins.fetch_sub( 1 ) )
+    {
+      return VK_THREAD_IDLE_KHR;
+    }
+    uint32_t active    = ++activeJoiners;
+    uint32_t maxActive = maxActiveJoiners;
+    while ( ( maxActive < active ) && !maxActiveJoiners.compare_exchange_weak( maxActive, active ) )
+    {
+    }
+    while ( nextWorkItem++ < workItemCount )
+    {
+      std::this_thread::yield();
+      ++completedWorkItems;
+    }
+    --activeJoiners;
+    return ( completedWorkItems == workItemCount ) ? VK_SUCCESS : VK_THREAD_DONE_KHR;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL createRayTracingPipelines( VkDevice,
+                                                            VkDeferredOperationKHR deferredOperation,
+                                                            VkPipelineCache,
+                                                            uint32_t createInfoCount,
+                                                            VkRayTracingPipelineCreateInfoKHR const *,
+                                                            VkAllocationCallbacks const *,
+                                                            VkPipeline * pPipelines )
+  {
+    release_assert( deferredOperation != VK_NULL_HANDLE );
+    for ( uint32_t i = 0; i < createInfoCount; ++i )
+    {
+      pPipelines[i] = vk::detail::NullDriver::nextHandle<VkPipeline>();
+    }
+    return VK_OPERATION_DEFERRED_KHR;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL destroyPipeline( VkDevice, VkPipeline pipeline, VkAllocationCallbacks const * )
+  {
+    if ( pipeline != VK_NULL_HANDLE )
+    {
+      ++destroyedPipelineCount;
+    }
+  }
+
+  void install()
+  {
+    fixture::addOverride( "vkGetDeferredOperationMaxConcurrencyKHR", &getDeferredOperationMaxConcurrency );
+    fixture::addOverride( "vkGetDeferredOperationResultKHR", &getDeferredOperationResult );
+    fixture::addOverride( "vkDeferredOperationJoinKHR", &deferredOperationJoin );
+    fixture::addOverride( "vkCreateRayTracingPipelinesKHR", &createRayTracingPipelines );
+    fixture::addOverride( "vkDestroyPipeline", &destroyPipeline );
+  }
+}  // namespace fake
+
+// a minimal thread pool, just for the purpose of this test
+class ThreadPool
+{
+public:
+  ThreadPool( uint32_t threadCount )
+  {
+    for ( uint32_t i = 0; i < threadCount; ++i )
+    {
+      m_threads.push_back( std::thread( [this]() { work(); } ) );
+    }
+  }
+
+  ~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> guard( m_mutex );
+      m_stopped = true;
+    }
+    m_condition.notify_all();
+    for ( auto & thread : m_threads )
+    {
+      thread.join();
+    }
+  }
+
+  void push( std::function<void()> job )
+  {
+    {
+      std::lock_guard<std::mutex> guard( m_mutex );
+      m_jobs.push_back( std::move( job ) );
+      ++m_pushedCount;
+    }
+    m_condition.notify_one();
+  }
+
+  uint32_t pushedCount()
+  {
+    std::lock_guard<std::mutex> guard( m_mutex );
+    return m_pushedCount;
+  }
+
+private:
+  void work()
+  {
+    for ( ;; )
+    {
+      std::function<void()> job;
+      {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_condition.wait( lock, [this]() { return m_stopped || !m_jobs.empty(); } );
+        if ( m_jobs.empty() )
+        {
+          return;
+        }
+        job = std::move( m_jobs.front() );
+        m_jobs.pop_front();
+      }
+      job();
+    }
+  }
+
+private:
+  std::vector<std::thread>          m_threads;
+  std::mutex                        m_mutex;
+  std::condition_variable           m_condition;
+  std::deque<std::function<void()>> m_jobs;
+  uint32_t                          m_pushedCount = 0;
+  bool                              m_stopped     = false;
+};
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  fake::install();
+
+  fixture::NullDevice      nullDevice;
+  vk::raii::Device const & device = nullDevice.device;
+
+  ThreadPool                                threadPool( 8 );
+  vk::raii::su::DeferredOperation::Executor executor = [&threadPool]( std::function<void()> job ) { threadPool.push( std::move( job ) ); };
+
+  {
+    // a command that didn't defer leaves nothing to join
+    vk::raii::su::DeferredOperation deferredOperation( device );
+    std::shared_future<vk::Result>  future = deferredOperation.join( vk::Result::eOperationNotDeferredKHR, executor );
+    release_assert( ( future.wait_for( std::chrono::seconds( 0 ) ) == std::future_status::ready ) && ( future.get() == vk::Result::eSuccess ) );
+    release_assert( threadPool.pushedCount() == 0 );
+  }
+
+  {
+    // an error of the command itself is thrown by the future
+    vk::raii::su::DeferredOperation deferredOperation( device );
+    std::shared_future<vk::Result>  future = deferredOperation.join( vk::Result::eErrorOutOfHostMemory, executor );
+    bool                            caught = false;
+    try
+    {
+      future.get();
+    }
+    catch ( vk::OutOfHostMemoryError const & )
+    {
+      caught = true;
+    }
+    release_assert( caught );
+  }
+
+  {
+    // the operation is joined by no more threads than it can use, some of them being idle at first
+    fake::reset( 3, 1000, 5, VK_SUCCESS );
+    vk::raii::su::DeferredOperation deferredOperation( device );
+    std::shared_future<vk::Result>  future = deferredOperation.join( vk::Result::eOperationDeferredKHR, executor, 8 );
+    release_assert( future.get() == vk::Result::eSuccess );
+    release_assert( ( threadPool.pushedCount() == 3 ) && ( fake::completedWorkItems == 1000 ) && ( fake::maxActiveJoiners <= 3 ) );
+  }
+
+  {
+    // with wait(), the calling thread joins as well, and completes the operation even if no other joiner got to run yet
+    fake::reset( 2, 100, 0, VK_SUCCESS );
+    std::vector<std::function<void()>> parkedJoiners;
+    vk::raii::su::DeferredOperation    deferredOperation( device );
+    deferredOperation.join( vk::Result::eOperationDeferredKHR, [&parkedJoiners]( std::function<void()> job ) { parkedJoiners.push_back( job ); }, 8 );
+    release_assert( parkedJoiners.size() == 2 );
+    release_assert( deferredOperation.wait() == vk::Result::eSuccess );
+    release_assert( fake::completedWorkItems == 100 );
+
+    // joiners starting late still have to run before the operation can be destroyed
+    for ( auto const & joiner : parkedJoiners )
+    {
+      joiner();
+    }
+  }
+
+  {
+    // a failing operation throws from the future
+    fake::reset( 4, 100, 0, VK_ERROR_OUT_OF_DEVICE_MEMORY );
+    vk::raii::su::DeferredOperation deferredOperation( device );
+    std::shared_future<vk::Result>  future = deferredOperation.join( vk::Result::eOperationDeferredKHR, executor );
+    bool                            caught = false;
+    try
+    {
+      future.get();
+    }
+    catch ( vk::OutOfDeviceMemoryError const & )
+    {
+      caught = true;
+    }
+    release_assert( caught );
+  }
+
+  {
+    // if the executor refuses a joiner, the calling thread takes over
+    fake::reset( 4, 100, 0, VK_SUCCESS );
+    vk::raii::su::DeferredOperation deferredOperation( device );
+    std::shared_future<vk::Result>  future =
+      deferredOperation.join( vk::Result::eOperationDeferredKHR, []( std::function<void()> ) { throw std::runtime_error( "thread pool stopped" ); } );
+    release_assert( ( future.wait_for( std::chrono::seconds( 0 ) ) == std::future_status::ready ) && ( future.get() == vk::Result::eSuccess ) );
+    release_assert( fake::completedWorkItems == 100 );
+  }
+
+  {
+    // deferred ray tracing pipeline creation keeps the pipeline handles, and destroys them on failure
+    std::vector<vk::RayTracingPipelineCreateInfoKHR> createInfos( 4 );
+
+    fake::reset( 4, 400, 0, VK_SUCCESS );
+    std::vector<vk::raii::Pipeline> pipelines = vk::raii::su::createRayTracingPipelines( device, nullptr, createInfos, executor );
+    release_assert( pipelines.size() == 4 );
+    for ( auto const & pipeline : pipelines )
+    {
+      release_assert( *pipeline );
+    }
+
+    fake::reset( 4, 400, 0, VK_ERROR_OUT_OF_HOST_MEMORY );
+    fake::destroyedPipelineCount = 0;
+    bool caught                  = false;
+    try
+    {
+      pipelines = vk::raii::su::createRayTracingPipelines( device, nullptr, createInfos, executor );
+    }
+    catch ( vk::OutOfHostMemoryError const & )
+    {
+      caught = true;
+    }
+    release_assert( caught && ( fake::destroyedPipelineCount == 4 ) );
+  }
+
+  return 0;
+}
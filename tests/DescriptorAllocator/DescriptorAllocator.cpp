@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Tests : DescriptorAllocator
+//                   Runtime test on the pool management of vk::raii::su::DescriptorAllocator, running on the null driver with descriptor pools
+//                   that run out of sets, or fail on demand
+
+#if !defined( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC )
+#  define VULKAN_HPP_DISPATCH_LOADER_DYNAMIC 1
+#endif
+
+#include "../../RAII_Samples/utils/descriptorAllocator.hpp"
+#include "../null_driver_fixture.hpp"
+
+#include <map>
+#include <vector>
+
+namespace fake
+{
+  struct Pool
+  {
+    uint32_t                          maxSets       = 0;
+    uint32_t                          allocatedSets = 0;
+    std::vector<VkDescriptorPoolSize> poolSizes;
+  };
+
+  std::map<VkDescriptorPool, Pool> pools;
+  std::vector<VkDescriptorPool>    createdPools;  // in the order of creation
+  std::vector<VkDescriptorPool>    resetPools;    // in the order of the resets
+  uint32_t                         allocateCount = 0;
+  VkResult                         failure       = VK_SUCCESS;  // returned once by the next vkAllocateDescriptorSets, instead of allocating
+
+  VKAPI_ATTR VkResult VKAPI_CALL createDescriptorPool( VkDevice,
+                                                       VkDescriptorPoolCreateInfo const * pCreateInfo,
+                                                       VkAllocationCallbacks const *,
+                                                       VkDescriptorPool *                 pPool )
+  {
+    *pPool       = vk::detail::NullDriver::nextHandle<VkDescriptorPool>();
+    Pool & pool  = pools[*pPool];
+    pool.maxSets = pCreateInfo->maxSets;
+    pool.poolSizes.assign( pCreateInfo->pPoolSizes, pCreateInfo->pPoolSizes + pCreateInfo->poolSizeCount );
+    createdPools.push_back( *pPool );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL allocateDescriptorSets( VkDevice, VkDescriptorSetAllocateInfo const * pAllocateInfo, VkDescriptorSet * pDescriptorSets )
+  {
+    ++allocateCount;
+    if ( failure != VK_SUCCESS )
+    {
+      VkResult result = failure;
+      failure         = VK_SUCCESS;
+      return result;
+    }
+    Pool & pool = pools.at( pAllocateInfo->descriptorPool );
+    if ( pool.maxSets < pool.allocatedSets + pAllocateInfo->descriptorSetCount )
+    {
+      return VK_ERROR_OUT_OF_POOL_MEMORY;
+    }
+    pool.allocatedSets += pAllocateInfo->descriptorSetCount;
+    for ( uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; ++i )
+    {
+      pDescriptorSets[i] = vk::detail::NullDriver::nextHandle<VkDescriptorSet>();
+    }
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL resetDescriptorPool( VkDevice, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags )
+  {
+    pools.at( descriptorPool ).allocatedSets = 0;
+    resetPools.push_back( descriptorPool );
+    return VK_SUCCESS;
+  }
+
+  uint32_t allocatedSets( size_t poolIndex )
+  {
+    return pools.at( createdPools[poolIndex] ).allocatedSets;
+  }
+}  // namespace fake
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  fixture::addOverride( "vkCreateDescriptorPool", &fake::createDescriptorPool );
+  fixture::addOverride( "vkAllocateDescriptorSets", &fake::allocateDescriptorSets );
+  fixture::addOverride( "vkResetDescriptorPool", &fake::resetDescriptorPool );
+
+  fixture::NullDevice nullDevice;
+
+  vk::DescriptorSetLayout              layout( vk::detail::NullDriver::nextHandle<VkDescriptorSetLayout>() );
+  std::vector<vk::DescriptorSetLayout> layouts( 12, layout );
+
+  // pools of 2 uniform buffers and 1 combined image sampler per set, starting at 4 sets per pool, and growing up to 16 sets per pool
+  std::vector<vk::DescriptorPoolSize> poolSizesPerSet = { { vk::DescriptorType::eUniformBuffer, 2 }, { vk::DescriptorType::eCombinedImageSampler, 1 } };
+  vk::raii::su::DescriptorAllocator   descriptorAllocator( nullDevice.device, poolSizesPerSet, 4, 16 );
+  release_assert( descriptorAllocator.poolCount() == 0 );
+
+  // the first pool is created on the first allocation, sized for 4 sets
+  for ( int i = 0; i < 4; ++i )
+  {
+    release_assert( descriptorAllocator.allocate( layout ) );
+  }
+  release_assert( ( descriptorAllocator.poolCount() == 1 ) && ( fake::allocatedSets( 0 ) == 4 ) );
+  fake::Pool const & firstPool = fake::pools.at( fake::createdPools[0] );
+  release_assert( ( firstPool.maxSets == 4 ) && ( firstPool.poolSizes.size() == 2 ) );
+  release_assert( ( firstPool.poolSizes[0].type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER ) && ( firstPool.poolSizes[0].descriptorCount == 8 ) );
+  release_assert( ( firstPool.poolSizes[1].type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER ) && ( firstPool.poolSizes[1].descriptorCount == 4 ) );
+
+  // an exhausted pool is followed by one twice as large, and the allocation is retried there
+  fake::allocateCount = 0;
+  release_assert( descriptorAllocator.allocate( layout ) );
+  release_assert( ( descriptorAllocator.poolCount() == 2 ) && ( fake::allocateCount == 2 ) );
+  release_assert( ( fake::pools.at( fake::createdPools[1] ).maxSets == 8 ) && ( fake::pools.at( fake::createdPools[1] ).poolSizes[0].descriptorCount == 16 ) );
+
+  // a batch that doesn't fit into the rest of the current pool goes into the next one as a whole
+  std::vector<vk::DescriptorSet> descriptorSets = descriptorAllocator.allocate( vk::ArrayProxy<const vk::DescriptorSetLayout>( 8, layouts.data() ) );
+  release_assert( ( descriptorSets.size() == 8 ) && ( descriptorAllocator.poolCount() == 3 ) );
+  release_assert( ( fake::allocatedSets( 1 ) == 1 ) && ( fake::allocatedSets( 2 ) == 8 ) );
+  release_assert( fake::pools.at( fake::createdPools[2] ).maxSets == 16 );
+
+  // the pools don't grow beyond 16 sets
+  descriptorAllocator.allocate( vk::ArrayProxy<const vk::DescriptorSetLayout>( 12, layouts.data() ) );
+  release_assert( ( descriptorAllocator.poolCount() == 4 ) && ( fake::pools.at( fake::createdPools[3] ).maxSets == 16 ) );
+
+  // a fragmented pool is treated like an exhausted one
+  fake::failure = VK_ERROR_FRAGMENTED_POOL;
+  release_assert( descriptorAllocator.allocate( layout ) );
+  release_assert( ( descriptorAllocator.poolCount() == 5 ) && ( fake::allocatedSets( 3 ) == 12 ) && ( fake::allocatedSets( 4 ) == 1 ) );
+
+  // any other error is thrown right away, without moving on to another pool
+  fake::failure       = VK_ERROR_OUT_OF_DEVICE_MEMORY;
+  fake::allocateCount = 0;
+  bool caught         = false;
+  try
+  {
+    descriptorAllocator.allocate( layout );
+  }
+  catch ( vk::OutOfDeviceMemoryError const & )
+  {
+    caught = true;
+  }
+  release_assert( caught && ( fake::allocateCount == 1 ) && ( descriptorAllocator.poolCount() == 5 ) );
+
+  // reset() recycles all the pools used so far, in order, and the allocations start over in the first one
+  descriptorAllocator.reset();
+  release_assert( fake::resetPools == fake::createdPools );
+  for ( size_t i = 0; i < fake::createdPools.size(); ++i )
+  {
+    release_assert( fake::allocatedSets( i ) == 0 );
+  }
+  release_assert( descriptorAllocator.allocate( layout ) && ( fake::allocatedSets( 0 ) == 1 ) );
+
+  // after a reset, exhausted pools are followed by the existing ones before a new one is created
+  descriptorAllocator.allocate( vk::ArrayProxy<const vk::DescriptorSetLayout>( 4, layouts.data() ) );
+  release_assert( ( descriptorAllocator.poolCount() == 5 ) && ( fake::allocatedSets( 0 ) == 1 ) && ( fake::allocatedSets( 1 ) == 4 ) );
+
+  // a reset only recycles the pools up to the current one
+  fake::resetPools.clear();
+  descriptorAllocator.reset();
+  release_assert( ( fake::resetPools.size() == 2 ) && ( fake::resetPools[0] == fake::createdPools[0] ) && ( fake::resetPools[1] == fake::createdPools[1] ) );
+
+  // exhausted pools are skipped until one fits the request, even if that takes more than one try
+  fake::allocateCount = 0;
+  descriptorAllocator.allocate( vk::ArrayProxy<const vk::DescriptorSetLayout>( 10, layouts.data() ) );
+  release_assert( ( descriptorAllocator.poolCount() == 5 ) && ( fake::allocateCount == 3 ) && ( fake::allocatedSets( 2 ) == 10 ) );
+
+  // a request larger than a fresh pool can't be satisfied, and is reported as such
+  std::vector<vk::DescriptorSetLayout> tooManyLayouts( 17, layout );
+  caught = false;
+  try
+  {
+    descriptorAllocator.allocate( tooManyLayouts );
+  }
+  catch ( vk::OutOfPoolMemoryError const & )
+  {
+    caught = true;
+  }
+  release_assert( caught && ( descriptorAllocator.poolCount() == 6 ) );
+
+  return 0;
+}
@@ -2,16 +2,19 @@
 // SPDX-License-Identifier: Apache-2.0
 
 // VulkanHpp Tests : DesignatedInitializers
-//                   Compile test on using designated initializers
+//                   Compile test on using designated initializers, and on the value category of setter chains
 
 
+#include "../test_macros.hpp"
 #ifdef VULKAN_HPP_USE_CXX_MODULE
 #  include <cstdint>
 import std;
 import vulkan;
 #else
+#  include <array>
 #  include <cstdint>
 #  include <iostream>
+#  include <type_traits>
 #  include <vector>
 #  include <vulkan/vulkan.hpp>
 #endif
@@ -75,5 +78,24 @@ int main()
                       .ppEnabledExtensionNames = extensions.data(),
   };
 
+  // nested structures and arrays are initialized in place, arrays like plain arrays
+  vk::PipelineColorBlendStateCreateInfo colorBlendStateCreateInfo{ .logicOpEnable = vk::False, .blendConstants = { 0.0f, 0.0f, 0.0f, 1.0f } };
+  vk::RenderingInfo                     renderingInfo{ .renderArea = { .offset = { .x = 0, .y = 0 }, .extent = { .width = 640, .height = 480 } },
+                                                         .layerCount = 1 };
+  vk::AccelerationStructureInstanceKHR  instance{
+    .transform = { .matrix = { { 1.0f, 0.0f, 0.0f, 10.0f }, { 0.0f, 1.0f, 0.0f, 20.0f }, { 0.0f, 0.0f, 1.0f, 30.0f } } }, .mask = 0xFF
+  };
+  release_assert( colorBlendStateCreateInfo.blendConstants[3] == 1.0f );
+  release_assert( ( renderingInfo.renderArea.extent.height == 480 ) && ( instance.transform.matrix[2][3] == 30.0f ) );
+
+  // setters on a temporary keep it an rvalue, such that the chain can be passed on without a copy
+  std::array<uint32_t, 2> const queueFamilies = { 1U, 2U };
+  static_assert( std::is_same<decltype( vk::ImageCreateInfo{ .imageType = vk::ImageType::e2D }.setQueueFamilyIndices( queueFamilies ).setMipLevels( 1 ) ),
+                              vk::ImageCreateInfo &&>::value,
+                 "setter chains on temporaries yield rvalues" );
+  vk::ImageCreateInfo imageCreateInfo;
+  static_assert( std::is_same<decltype( imageCreateInfo.setQueueFamilyIndices( queueFamilies ).setMipLevels( 1 ) ), vk::ImageCreateInfo &>::value,
+                 "setter chains on lvalues yield lvalues" );
+
   return 0;
 }
@@ -25,6 +25,7 @@
 import std;
 import vulkan;
 #else
+#  include <cstring>
 #  include <set>
 #  include <map>
 #  include <vector>
@@ -84,5 +85,34 @@ int main()
   auto                                       promotedIt         = promotedExtensions.find( vk::EXTDebugMarkerExtensionName );
   release_assert( ( promotedIt != promotedExtensions.end() ) && ( promotedIt->second == vk::EXTDebugUtilsExtensionName ) );
 
+  vk::ExtensionId swapchainId = vk::getExtensionId( vk::KHRSwapchainExtensionName );
+  release_assert( ( swapchainId == vk::ExtensionId::eKHRSwapchain ) && ( strcmp( vk::getExtensionName( swapchainId ), vk::KHRSwapchainExtensionName ) == 0 ) );
+  release_assert( vk::getExtensionId( "VK_unknown_extension" ) == vk::ExtensionId::eUnknown );
+  release_assert( vk::getExtensionPromotedToApiVersion( vk::ExtensionId::eKHRDynamicRendering ) == vk::ApiVersion13 );
+
+  vk::ExtensionSet available, requested, enabled;
+  for ( std::string const & extension : deviceExtensions )
+  {
+    available.set( vk::getExtensionId( extension.c_str() ) );
+  }
+  requested.set( vk::ExtensionId::eKHRDynamicRendering );
+  release_assert( vk::resolveExtensionDependencies( requested, vk::ApiVersion11, available, enabled ) );
+  release_assert( ( enabled.count() == 3 ) && enabled.test( vk::ExtensionId::eKHRDynamicRendering ) && enabled.test( vk::ExtensionId::eKHRDepthStencilResolve ) &&
+                  enabled.test( vk::ExtensionId::eKHRCreateRenderpass2 ) );
+  release_assert( vk::resolveExtensionDependencies( requested, vk::ApiVersion12, available, enabled ) && ( enabled.count() == 1 ) );
+  release_assert( vk::resolveExtensionDependencies( requested, vk::ApiVersion13, available, enabled ) && ( enabled.count() == 0 ) );
+
+  requested = vk::ExtensionSet().set( vk::ExtensionId::eEXTShaderTileImage );
+  release_assert( !vk::resolveExtensionDependencies( requested, vk::ApiVersion11, available, enabled ) );
+
+  // a failed resolution doesn't leave any partial result
+  available.reset( vk::ExtensionId::eKHRDepthStencilResolve );
+  requested = vk::ExtensionSet().set( vk::ExtensionId::eKHRDynamicRendering );
+  release_assert( !vk::resolveExtensionDependencies( requested, vk::ApiVersion11, available, enabled ) && ( enabled.count() == 0 ) );
+
+  // the ids don't depend on the platform macros
+  release_assert( strcmp( vk::getExtensionName( vk::ExtensionId::eKHRWin32Surface ), "VK_KHR_win32_surface" ) == 0 );
+  release_assert( vk::getExtensionId( "VK_KHR_xcb_surface" ) == vk::ExtensionId::eKHRXcbSurface );
+
   return 0;
 }
@@ -22,6 +22,9 @@ import std;
 import vulkan;
 #else
 #  include <vulkan/vulkan_raii.hpp>
+#  if 17 <= VULKAN_HPP_CPP_VERSION
+#    include <memory_resource>
+#  endif
 #endif
 
 int main()
@@ -50,6 +53,15 @@ int main()
     vk::raii::Instance        instance = nullptr;
     vk::raii::PhysicalDevices physicalDevices( instance );
   }
+#if 17 <= VULKAN_HPP_CPP_VERSION || defined( VULKAN_HPP_USE_CXX_MODULE )
+  {
+    char                                       buffer[1024];
+    std::pmr::monotonic_buffer_resource        arena( buffer, sizeof( buffer ) );
+    vk::raii::Instance                         instance = nullptr;
+    std::pmr::vector<vk::raii::PhysicalDevice> physicalDevices =
+      instance.enumeratePhysicalDevices( std::pmr::polymorphic_allocator<vk::raii::PhysicalDevice>( &arena ) );
+  }
+#endif
 
   {
     vk::raii::PhysicalDevice   physicalDevice         = nullptr;
@@ -398,6 +410,16 @@ int main()
     vk::CommandBufferAllocateInfo commandBufferAllocateInfo;
     vk::raii::CommandBuffers      commandBuffers( device, commandBufferAllocateInfo );
   }
+#if 17 <= VULKAN_HPP_CPP_VERSION || defined( VULKAN_HPP_USE_CXX_MODULE )
+  {
+    char                                      buffer[1024];
+    std::pmr::monotonic_buffer_resource       arena( buffer, sizeof( buffer ) );
+    vk::raii::Device                          device = nullptr;
+    vk::CommandBufferAllocateInfo             commandBufferAllocateInfo;
+    std::pmr::vector<vk::raii::CommandBuffer> commandBuffers =
+      device.allocateCommandBuffers( commandBufferAllocateInfo, std::pmr::polymorphic_allocator<vk::raii::CommandBuffer>( &arena ) );
+  }
+#endif
 
   {
     vk::raii::CommandBuffer    commandBuffer = nullptr;
@@ -811,6 +833,17 @@ int main()
     std::vector<vk::GraphicsPipelineCreateInfo> graphicsPipelineCreateInfos;
     vk::raii::Pipelines                         pipelines( device, pipelineCache, graphicsPipelineCreateInfos );
   }
+#if 17 <= VULKAN_HPP_CPP_VERSION || defined( VULKAN_HPP_USE_CXX_MODULE )
+  {
+    char                                        buffer[1024];
+    std::pmr::monotonic_buffer_resource         arena( buffer, sizeof( buffer ) );
+    vk::raii::Device                            device        = nullptr;
+    vk::raii::PipelineCache                     pipelineCache = nullptr;
+    std::vector<vk::GraphicsPipelineCreateInfo> graphicsPipelineCreateInfos;
+    std::pmr::vector<vk::raii::Pipeline>        pipelines =
+      device.createGraphicsPipelines( pipelineCache, graphicsPipelineCreateInfos, nullptr, std::pmr::polymorphic_allocator<vk::raii::Pipeline>( &arena ) );
+  }
+#endif
   {
     vk::raii::Device               device        = nullptr;
     vk::raii::PipelineCache        pipelineCache = nullptr;
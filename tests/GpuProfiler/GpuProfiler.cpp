@@ -0,0 +1,240 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Tests : GpuProfiler
+//                   Runtime test on vk::raii::su::GpuProfiler, running on the null driver with faked timestamp queries, whose results become
+//                   available on demand
+
+#if !defined( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC )
+#  define VULKAN_HPP_DISPATCH_LOADER_DYNAMIC 1
+#endif
+
+#include "../../RAII_Samples/utils/gpuProfiler.hpp"
+#include "../null_driver_fixture.hpp"
+
+#include <cstring>
+#include <sstream>
+
+namespace fake
+{
+  float    timestampPeriod       = 2.5f;
+  uint32_t timestampValidBits    = 64;
+  uint64_t nextTimestamp         = 0;
+  uint64_t timestampStep         = 100;
+  uint32_t writeCount            = 0;
+  uint64_t calibratedDeviceTicks = 0;
+  uint64_t calibratedHostTicks   = 0;
+
+  // lets the "device" execute all the timestamp writes recorded so far
+  void execute()
+  {
+    for ( auto & query : fixture::queries() )
+    {
+      query.second.available = true;
+    }
+  }
+
+  VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceProperties( VkPhysicalDevice, VkPhysicalDeviceProperties * pProperties )
+  {
+    memset( pProperties, 0, sizeof( VkPhysicalDeviceProperties ) );
+    pProperties->limits.timestampPeriod = timestampPeriod;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceQueueFamilyProperties( VkPhysicalDevice, uint32_t * pCount, VkQueueFamilyProperties * pProperties )
+  {
+    if ( pProperties )
+    {
+      memset( pProperties, 0, sizeof( VkQueueFamilyProperties ) );
+      pProperties->queueFlags         = VK_QUEUE_GRAPHICS_BIT;
+      pProperties->queueCount         = 1;
+      pProperties->timestampValidBits = timestampValidBits;
+    }
+    *pCount = 1;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL cmdWriteTimestamp2( VkCommandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool, uint32_t query )
+  {
+    release_assert( stage == VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT );
+    release_assert( fixture::queries().find( std::make_pair( queryPool, query ) ) == fixture::queries().end() );  // has to be reset before being written again
+    uint64_t mask = ( timestampValidBits < 64 ) ? ( ( uint64_t( 1 ) << timestampValidBits ) - 1 ) : UINT64_MAX;
+    fixture::queries()[std::make_pair( queryPool, query )].values.assign( 1, nextTimestamp & mask );
+    nextTimestamp += timestampStep;
+    ++writeCount;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL getCalibratedTimestamps(
+    VkDevice, uint32_t timestampCount, VkCalibratedTimestampInfoKHR const * pTimestampInfos, uint64_t * pTimestamps, uint64_t * pMaxDeviation )
+  {
+    for ( uint32_t i = 0; i < timestampCount; ++i )
+    {
+      pTimestamps[i] = ( pTimestampInfos[i].timeDomain == VK_TIME_DOMAIN_DEVICE_KHR ) ? calibratedDeviceTicks : calibratedHostTicks;
+    }
+    *pMaxDeviation = 10;
+    return VK_SUCCESS;
+  }
+
+  void install()
+  {
+    fixture::addOverride( "vkGetPhysicalDeviceProperties", &getPhysicalDeviceProperties );
+    fixture::addOverride( "vkGetPhysicalDeviceQueueFamilyProperties", &getPhysicalDeviceQueueFamilyProperties );
+    fixture::addOverride( "vkCmdWriteTimestamp2", &cmdWriteTimestamp2 );
+    fixture::addOverride( "vkResetQueryPool", &fixture::resetQueryPool );
+    fixture::addOverride( "vkGetQueryPoolResults", &fixture::getQueryPoolResults );
+    fixture::addOverride( "vkGetCalibratedTimestampsKHR", &getCalibratedTimestamps );
+  }
+}  // namespace fake
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  fake::install();
+
+  fixture::NullDevice              nullDevice;
+  vk::raii::PhysicalDevice const & physicalDevice = nullDevice.physicalDevices[0];
+  vk::raii::Device const &         device         = nullDevice.device;
+  vk::raii::CommandBuffer const &  commandBuffer  = nullDevice.commandBuffer;
+
+  {
+    // a queue family without timestamps can't be profiled
+    fake::timestampValidBits = 0;
+    bool caught              = false;
+    try
+    {
+      vk::raii::su::GpuProfiler profiler( device, physicalDevice, 0, 2 );
+    }
+    catch ( std::runtime_error const & )
+    {
+      caught = true;
+    }
+    release_assert( caught );
+    fake::timestampValidBits = 64;
+  }
+
+  {
+    // two frames in flight, up to three scopes per frame
+    vk::raii::su::GpuProfiler profiler( device, physicalDevice, 0, 2, 3 );
+
+    // frame 1: nested scopes, timestamps 0 to 500
+    release_assert( profiler.beginFrame() );
+    {
+      vk::raii::su::GpuProfiler::Scope frameScope( profiler, commandBuffer, "frame" );
+      {
+        vk::raii::su::GpuProfiler::Scope shadowScope( profiler, commandBuffer, "shadow \"pass\"" );
+      }
+      {
+        vk::raii::su::GpuProfiler::Scope lightingScope( profiler, commandBuffer, "lighting" );
+      }
+    }
+    release_assert( fake::writeCount == 6 );
+
+    // frame 2: the results of frame 1 are not yet available, which doesn't keep frame 2 from being profiled in the other query pool
+    release_assert( profiler.beginFrame() );
+    release_assert( profiler.timings().empty() );
+    {
+      vk::raii::su::GpuProfiler::Scope lightingScope( profiler, commandBuffer, "lighting" );
+    }
+    release_assert( fake::writeCount == 8 );
+
+    // frame 3: the query pool of frame 1 is still waiting for results, so frame 3 is skipped instead of stalling
+    release_assert( !profiler.beginFrame() );
+    release_assert( profiler.skippedFrameCount() == 1 );
+    {
+      vk::raii::su::GpuProfiler::Scope lightingScope( profiler, commandBuffer, "lighting" );
+    }
+    release_assert( fake::writeCount == 8 );
+
+    // frame 4: frames 1 and 2 completed, and are read back in order, counting from the first timestamp of frame 1
+    fake::execute();
+    release_assert( profiler.beginFrame() );
+    std::deque<vk::raii::su::GpuProfiler::ScopeTiming> const & timings = profiler.timings();
+    release_assert( timings.size() == 4 );
+    release_assert( fixture::lastQueryPoolResultsCall().flags == ( VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT ) );
+    release_assert( fixture::lastQueryPoolResultsCall().stride == 2 * sizeof( uint64_t ) );
+    release_assert( ( strcmp( timings[0].name, "frame" ) == 0 ) && ( timings[0].depth == 0 ) && ( timings[0].frame == 1 ) );
+    release_assert( ( timings[0].beginNs == 0 ) && ( timings[0].endNs == 1250 ) );
+    release_assert( ( strcmp( timings[1].name, "shadow \"pass\"" ) == 0 ) && ( timings[1].depth == 1 ) );
+    release_assert( ( timings[1].beginNs == 250 ) && ( timings[1].endNs == 500 ) );
+    release_assert( ( strcmp( timings[2].name, "lighting" ) == 0 ) && ( timings[2].depth == 1 ) );
+    release_assert( ( timings[2].beginNs == 750 ) && ( timings[2].endNs == 1000 ) );
+    release_assert( ( strcmp( timings[3].name, "lighting" ) == 0 ) && ( timings[3].depth == 0 ) && ( timings[3].frame == 2 ) );
+    release_assert( ( timings[3].beginNs == 1500 ) && ( timings[3].endNs == 1750 ) );
+
+    vk::raii::su::GpuProfiler::ScopeStatistics const & lightingStatistics = profiler.statistics().at( "lighting" );
+    release_assert( ( lightingStatistics.count == 2 ) && ( lightingStatistics.totalNs == 500 ) );
+    release_assert( ( lightingStatistics.minNs == 250 ) && ( lightingStatistics.maxNs == 250 ) );
+    release_assert( profiler.statistics().at( "frame" ).totalNs == 1250 );
+
+    // the query pools are reset right after being read back, so there's nothing left to read
+    release_assert( fixture::queries().empty() );
+
+    // scopes beyond the capacity of a frame are dropped
+    for ( int i = 0; i < 4; ++i )
+    {
+      vk::raii::su::GpuProfiler::Scope scope( profiler, commandBuffer, "draw" );
+    }
+    release_assert( ( profiler.droppedScopeCount() == 1 ) && ( fake::writeCount == 14 ) );
+    fake::execute();
+    profiler.collect();
+    release_assert( ( timings.size() == 7 ) && ( timings.back().frame == 4 ) );
+    release_assert( profiler.statistics().at( "draw" ).count == 3 );
+
+    // the Chrome trace holds one complete event per scope timing, in microseconds
+    std::ostringstream trace;
+    profiler.writeChromeTrace( trace );
+    std::string json       = trace.str();
+    std::string frameEvent = "{\"name\":\"frame\",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":0,\"tid\":0,"
+                             "\"ts\":0.000,\"dur\":1.250,\"args\":{\"frame\":1,\"depth\":0}}";
+    release_assert( json.find( frameEvent ) != std::string::npos );
+    release_assert( json.find( "\"name\":\"shadow \\\"pass\\\"\"" ) != std::string::npos );
+    release_assert( json.find( "\"ts\":1.500,\"dur\":0.250" ) != std::string::npos );
+    release_assert( ( json.find( "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[" ) == 0 ) && ( json.rfind( "]}" ) == json.size() - 3 ) );
+
+    profiler.clear();
+    release_assert( profiler.timings().empty() && profiler.statistics().empty() );
+  }
+
+  {
+    // after calibration, the times are given on the host clock
+    fake::nextTimestamp         = 1100;
+    fake::calibratedDeviceTicks = 1000;
+    fake::calibratedHostTicks   = 5000000000;
+
+    vk::raii::su::GpuProfiler profiler( device, physicalDevice, 0, 2 );
+    release_assert( profiler.calibrate() == 10 );
+    profiler.beginFrame();
+    {
+      vk::raii::su::GpuProfiler::Scope scope( profiler, commandBuffer, "compute" );
+    }
+    fake::execute();
+    profiler.beginFrame();
+    release_assert( ( profiler.timings().size() == 1 ) && ( profiler.timings()[0].beginNs == 5000000250 ) && ( profiler.timings()[0].endNs == 5000000500 ) );
+
+    // a host clock counting 10 MHz, and a device timestamp taken before the calibration
+    fake::nextTimestamp       = 900;
+    fake::calibratedHostTicks = 50000000;
+    profiler.calibrate( vk::TimeDomainKHR::eClockMonotonic, 10000000 );
+    {
+      vk::raii::su::GpuProfiler::Scope scope( profiler, commandBuffer, "compute" );
+    }
+    fake::execute();
+    profiler.collect();
+    release_assert( ( profiler.timings().size() == 2 ) && ( profiler.timings()[1].beginNs == 4999999750 ) );
+  }
+
+  {
+    // with 8 valid timestamp bits, a scope may wrap around
+    fake::timestampValidBits = 8;
+    fake::nextTimestamp      = 250;
+    fake::timestampStep      = 10;
+
+    vk::raii::su::GpuProfiler profiler( device, physicalDevice, 0, 1 );
+    profiler.beginFrame();
+    {
+      vk::raii::su::GpuProfiler::Scope scope( profiler, commandBuffer, "wrapped" );
+    }
+    fake::execute();
+    profiler.beginFrame();
+    release_assert( ( profiler.timings().size() == 1 ) && ( profiler.timings()[0].endNs - profiler.timings()[0].beginNs == 25 ) );
+  }
+
+  return 0;
+}
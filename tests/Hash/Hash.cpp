@@ -25,6 +25,7 @@ import vulkan;
 #else
 #  include <vector>
 #  include <cstdint>
+#  include <cstring>
 #  include <iostream>
 #  include <unordered_map>
 #  include <unordered_set>
@@ -57,6 +58,40 @@ int main()
       auto                   hf = std::hash<vk::FormatFeatureFlags>{}( fff );
     }
 
+    {
+      // ranges of handles are hashed all at once
+      std::vector<vk::ImageView> imageViews( 37 );
+      for ( size_t i = 0; i < imageViews.size(); ++i )
+      {
+        uint64_t    value = 0x1000 + 64 * i;
+        VkImageView imageView;
+        memcpy( &imageView, &value, sizeof( imageView ) );
+        imageViews[i] = imageView;
+      }
+      std::vector<vk::ImageView> otherImageViews = imageViews;
+
+      auto h1 = vk::hashRange( imageViews.data(), imageViews.size() );
+      release_assert( h1 == vk::hashRange( otherImageViews.data(), otherImageViews.size() ) );
+      release_assert( h1 == std::hash<vk::ArrayProxy<const vk::ImageView>>{}( otherImageViews ) );
+
+      std::swap( otherImageViews[0], otherImageViews[1] );
+      release_assert( h1 != vk::hashRange( otherImageViews.data(), otherImageViews.size() ) );
+
+      vk::ArrayWrapper1D<uint32_t, 3> aw0, aw1;
+      aw0[0] = aw1[0] = 1;
+      aw0[1] = aw1[1] = 2;
+      aw0[2] = aw1[2] = 3;
+      release_assert( std::hash<vk::ArrayWrapper1D<uint32_t, 3>>{}( aw0 ) == std::hash<vk::ArrayWrapper1D<uint32_t, 3>>{}( aw1 ) );
+
+      // arrays of chars are hashed like the strings they hold
+      vk::ArrayWrapper1D<char, 16> name0, name1;
+      memset( name0.data(), 0, 16 );
+      memset( name1.data(), 'x', 16 );
+      memcpy( name0.data(), AppName, strlen( AppName ) + 1 );
+      memcpy( name1.data(), AppName, strlen( AppName ) + 1 );
+      release_assert( ( name0 == name1 ) && ( std::hash<vk::ArrayWrapper1D<char, 16>>{}( name0 ) == std::hash<vk::ArrayWrapper1D<char, 16>>{}( name1 ) ) );
+    }
+
 #if 14 <= VULKAN_HPP_CPP_VERSION
     {
       vk::AabbPositionsKHR aabb0, aabb1;
@@ -78,6 +113,50 @@ int main()
       auto                                       h4 = std::hash<vk::AccelerationStructureBuildSizesInfoKHR>{}( asbsi );
     }
 
+    {
+      // structures without padding, holding just integral values, are compared and hashed bitwise
+      static_assert( vk::detail::isBitwiseHashable<vk::ImageSubresourceRange>::value, "ImageSubresourceRange is not hashed bitwise" );
+      static_assert( vk::detail::isBitwiseHashable<vk::VertexInputAttributeDescription>::value, "VertexInputAttributeDescription is not hashed bitwise" );
+      static_assert( !vk::detail::isBitwiseHashable<vk::Viewport>::value, "Viewport holds floats and must not be hashed bitwise" );
+
+      vk::ImageSubresourceRange isr0( vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1 );
+      vk::ImageSubresourceRange isr1( vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1 );
+      release_assert( ( isr0 == isr1 ) && ( std::hash<vk::ImageSubresourceRange>{}( isr0 ) == std::hash<vk::ImageSubresourceRange>{}( isr1 ) ) );
+      release_assert( std::hash<vk::ImageSubresourceRange>{}( isr0 ) == vk::detail::hashBytes( &isr0, sizeof( isr0 ) ) );
+
+      isr1.layerCount = 2;
+      release_assert( ( isr0 != isr1 ) && ( std::hash<vk::ImageSubresourceRange>{}( isr0 ) != std::hash<vk::ImageSubresourceRange>{}( isr1 ) ) );
+
+      // the bitwise comparison agrees with the member-wise one, for any member that differs
+      std::vector<vk::VertexInputAttributeDescription> attributes = { vk::VertexInputAttributeDescription( 1, 2, vk::Format::eR8Unorm, 4 ),
+                                                                      vk::VertexInputAttributeDescription( 0, 2, vk::Format::eR8Unorm, 4 ),
+                                                                      vk::VertexInputAttributeDescription( 1, 0, vk::Format::eR8Unorm, 4 ),
+                                                                      vk::VertexInputAttributeDescription( 1, 2, vk::Format::eR8Snorm, 4 ),
+                                                                      vk::VertexInputAttributeDescription( 1, 2, vk::Format::eR8Unorm, 0 ),
+                                                                      vk::VertexInputAttributeDescription( 1, 2, vk::Format::eR8Unorm, 4 ) };
+      for ( auto const & lhs : attributes )
+      {
+        for ( auto const & rhs : attributes )
+        {
+          bool memberwiseEqual =
+            ( lhs.location == rhs.location ) && ( lhs.binding == rhs.binding ) && ( lhs.format == rhs.format ) && ( lhs.offset == rhs.offset );
+          release_assert( ( lhs == rhs ) == memberwiseEqual );
+          release_assert( !memberwiseEqual ||
+                          ( std::hash<vk::VertexInputAttributeDescription>{}( lhs ) == std::hash<vk::VertexInputAttributeDescription>{}( rhs ) ) );
+        }
+      }
+      release_assert( vk::hashRange( attributes.data(), attributes.size() ) ==
+                      vk::detail::hashBytes( attributes.data(), attributes.size() * sizeof( vk::VertexInputAttributeDescription ) ) );
+
+      std::unordered_map<vk::VertexInputAttributeDescription, uint32_t> attributeMap;
+      for ( uint32_t location = 0; location < 16; ++location )
+      {
+        attributeMap[vk::VertexInputAttributeDescription( location, 0, vk::Format::eR32G32B32A32Sfloat, 16 * location )] = location;
+      }
+      release_assert( attributeMap.size() == 16 );
+      release_assert( attributeMap[vk::VertexInputAttributeDescription( 5, 0, vk::Format::eR32G32B32A32Sfloat, 80 )] == 5 );
+    }
+
     {
       std::string         name1 = AppName;
       std::string         name2 = AppName;
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Tests : InstrumentingDispatcher
+//                   Runtime test on the counting and exporting of the InstrumentingDispatcher, using a fake loader
+
+#if !defined( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC )
+#  define VULKAN_HPP_DISPATCH_LOADER_DYNAMIC 1
+#endif
+#define VULKAN_HPP_ENABLE_INSTRUMENTING_DISPATCHER
+#define VULKAN_HPP_DEFAULT_DISPATCHER_TYPE ::vk::detail::InstrumentingDispatcher<::vk::detail::DispatchLoaderDynamic>
+#define VULKAN_HPP_DEFAULT_DISPATCHER      ::vk::detail::defaultInstrumentingDispatcher
+
+#include "../test_macros.hpp"
+
+#include <cstring>
+#include <vulkan/vulkan.hpp>
+VULKAN_HPP_DEFAULT_INSTRUMENTING_DISPATCHER_STORAGE
+
+VKAPI_ATTR VkResult VKAPI_CALL fakeEnumerateInstanceVersion( uint32_t * pApiVersion )
+{
+  *pApiVersion = VK_API_VERSION_1_3;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL fakeGetInstanceProcAddr( VkInstance, char const * pName )
+{
+  if ( strcmp( pName, "vkEnumerateInstanceVersion" ) == 0 )
+  {
+    return reinterpret_cast<PFN_vkVoidFunction>( &fakeEnumerateInstanceVersion );
+  }
+  return nullptr;
+}
+
+uint64_t countOf( std::vector<vk::detail::InstrumentedCommandStatistics> const & statistics, char const * name )
+{
+  for ( auto const & commandStatistics : statistics )
+  {
+    if ( strcmp( commandStatistics.name, name ) == 0 )
+    {
+      return commandStatistics.count;
+    }
+  }
+  return 0;
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  vk::detail::defaultInstrumentingDispatcher.init( fakeGetInstanceProcAddr );
+  release_assert( vk::detail::defaultInstrumentingDispatcher.vkEnumerateInstanceVersion );
+  release_assert( !vk::detail::defaultInstrumentingDispatcher.vkCreateDevice );
+
+  // counting only
+  for ( int i = 0; i < 3; ++i )
+  {
+    release_assert( vk::enumerateInstanceVersion() == VK_API_VERSION_1_3 );
+  }
+  std::vector<vk::detail::InstrumentedCommandStatistics> statistics = vk::detail::Instrumentation::snapshot();
+  release_assert( statistics.size() == 1 );
+  release_assert( countOf( statistics, "vkEnumerateInstanceVersion" ) == 3 );
+  release_assert( statistics[0].ticks == 0 );
+
+  // a dispatcher wrapping another copy of the inner dispatcher counts into the same counters
+  vk::detail::InstrumentingDispatcher<vk::detail::DispatchLoaderDynamic> instrumentingDispatcher( vk::detail::defaultInstrumentingDispatcher.getInner() );
+  release_assert( vk::enumerateInstanceVersion( instrumentingDispatcher ) == VK_API_VERSION_1_3 );
+  release_assert( countOf( vk::detail::Instrumentation::snapshot(), "vkEnumerateInstanceVersion" ) == 4 );
+
+  // timing fills the histogram
+  vk::detail::Instrumentation::reset();
+  vk::detail::Instrumentation::enableTiming( true );
+  for ( int i = 0; i < 5; ++i )
+  {
+    release_assert( vk::enumerateInstanceVersion() == VK_API_VERSION_1_3 );
+  }
+  vk::detail::Instrumentation::enableTiming( false );
+  statistics = vk::detail::Instrumentation::snapshot();
+  release_assert( countOf( statistics, "vkEnumerateInstanceVersion" ) == 5 );
+  uint64_t histogramCount = 0;
+  for ( auto bucket : statistics[0].histogram )
+  {
+    histogramCount += bucket;
+  }
+  release_assert( histogramCount == 5 );
+
+  release_assert( vk::detail::Instrumentation::snapshot( true ).size() == vk::detail::instrumentedCommandCount );
+
+  std::string csv = vk::detail::Instrumentation::toCSV( statistics );
+  release_assert( csv.find( "\nvkEnumerateInstanceVersion,5," ) != std::string::npos );
+  std::string json = vk::detail::Instrumentation::toJSON( statistics );
+  release_assert( json.find( "\"name\": \"vkEnumerateInstanceVersion\", \"count\": 5" ) != std::string::npos );
+
+  return 0;
+}
@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Tests : MemoryAllocator
+//                   Runtime test on the sub-allocation of vk::raii::su::MemoryAllocator, running on the null driver with faked memory
+//                   properties: alignment padding, merging of free ranges, separation of linear and optimal resources, dedicated
+//                   allocations, and the release of empty blocks
+
+#if !defined( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC )
+#  define VULKAN_HPP_DISPATCH_LOADER_DYNAMIC 1
+#endif
+
+#include "../../RAII_Samples/utils/memoryAllocator.hpp"
+#include "../null_driver_fixture.hpp"
+
+#include <map>
+
+namespace fake
+{
+  struct Memory
+  {
+    VkDeviceSize size            = 0;
+    uint32_t     memoryTypeIndex = 0;
+    bool         dedicated       = false;  // a VkMemoryDedicatedAllocateInfo was chained into the VkMemoryAllocateInfo
+  };
+
+  std::map<VkDeviceMemory, Memory> memories;  // the memories allocated and not yet freed
+  VkDeviceSize                     bufferImageGranularity = 1024;
+
+  VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceProperties( VkPhysicalDevice, VkPhysicalDeviceProperties * pProperties )
+  {
+    memset( pProperties, 0, sizeof( VkPhysicalDeviceProperties ) );
+    pProperties->limits.bufferImageGranularity = bufferImageGranularity;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL allocateMemory( VkDevice, VkMemoryAllocateInfo const * pAllocateInfo, VkAllocationCallbacks const *, VkDeviceMemory * pMemory )
+  {
+    *pMemory               = vk::detail::NullDriver::nextHandle<VkDeviceMemory>();
+    Memory & memory        = memories[*pMemory];
+    memory.size            = pAllocateInfo->allocationSize;
+    memory.memoryTypeIndex = pAllocateInfo->memoryTypeIndex;
+    for ( VkBaseInStructure const * pNext = static_cast<VkBaseInStructure const *>( pAllocateInfo->pNext ); pNext; pNext = pNext->pNext )
+    {
+      memory.dedicated = memory.dedicated || ( pNext->sType == VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO );
+    }
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL freeMemory( VkDevice, VkDeviceMemory memory, VkAllocationCallbacks const * )
+  {
+    release_assert( memories.erase( memory ) == 1 );
+  }
+
+  Memory const & memoryOf( vk::raii::su::MemoryAllocation const & allocation )
+  {
+    return memories.at( static_cast<VkDeviceMemory>( allocation.memory() ) );
+  }
+}  // namespace fake
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  fixture::addOverride( "vkGetPhysicalDeviceMemoryProperties", &fixture::getPhysicalDeviceMemoryProperties );
+  fixture::addOverride( "vkGetPhysicalDeviceProperties", &fake::getPhysicalDeviceProperties );
+  fixture::addOverride( "vkAllocateMemory", &fake::allocateMemory );
+  fixture::addOverride( "vkFreeMemory", &fake::freeMemory );
+
+  static uint8_t mappedMemory[1024 * 1024];
+  vk::detail::NullDriver::configuration().mappedMemory = mappedMemory;
+
+  fixture::NullDevice nullDevice;
+
+  using ResourceKind = vk::raii::su::MemoryAllocator::ResourceKind;
+
+  vk::DeviceSize const          blockSize = 1024 * 1024;
+  vk::MemoryPropertyFlags const deviceLocal( vk::MemoryPropertyFlagBits::eDeviceLocal );
+  vk::MemoryPropertyFlags const hostVisible( vk::MemoryPropertyFlagBits::eHostVisible );
+
+  {
+    vk::raii::su::MemoryAllocator memoryAllocator( nullDevice.physicalDevices[0], nullDevice.device, blockSize );
+
+    // the padding needed to align an allocation is a free range of its own, and is used by later allocations
+    vk::raii::su::MemoryAllocation a = memoryAllocator.allocate( vk::MemoryRequirements( 100, 1, 0x3 ), deviceLocal, ResourceKind::eLinear );
+    vk::raii::su::MemoryAllocation b = memoryAllocator.allocate( vk::MemoryRequirements( 256, 256, 0x3 ), deviceLocal, ResourceKind::eLinear );
+    vk::raii::su::MemoryAllocation c = memoryAllocator.allocate( vk::MemoryRequirements( 64, 4, 0x3 ), deviceLocal, ResourceKind::eLinear );
+    release_assert( ( a.offset() == 0 ) && ( b.offset() == 256 ) && ( c.offset() == 100 ) );
+    release_assert( ( a.memory() == b.memory() ) && ( b.memory() == c.memory() ) && !a.isDedicated() );
+    release_assert( ( fake::memories.size() == 1 ) && ( fake::memoryOf( a ).size == blockSize ) && ( fake::memoryOf( a ).memoryTypeIndex == 0 ) );
+    release_assert( !a.mappedData() );
+
+    vk::raii::su::MemoryAllocator::Statistics statistics = memoryAllocator.getStatistics();
+    release_assert( ( statistics.blockCount == 1 ) && ( statistics.allocationCount == 3 ) && ( statistics.blockBytes == blockSize ) );
+    release_assert( statistics.allocatedBlockBytes == 100 + 256 + 64 );
+
+    // a freed range merges with its free neighbours on both sides: once b is freed, the 768 bytes from 0 on are free again
+    vk::raii::su::MemoryAllocation d = memoryAllocator.allocate( vk::MemoryRequirements( 256, 256, 0x3 ), deviceLocal, ResourceKind::eLinear );
+    release_assert( d.offset() == 512 );
+    a.clear();
+    c.clear();
+    d.clear();
+    b.clear();
+    release_assert( ( memoryAllocator.getStatistics().allocationCount == 0 ) && ( fake::memories.size() == 1 ) );
+    vk::raii::su::MemoryAllocation e = memoryAllocator.allocate( vk::MemoryRequirements( 768, 256, 0x3 ), deviceLocal, ResourceKind::eLinear );
+    release_assert( e.offset() == 0 );
+
+    // ... up to the end of the block, so that two halves of it still fit
+    e.clear();
+    vk::MemoryRequirements const   halfBlock( blockSize / 2, 256, 0x3 );
+    vk::raii::su::MemoryAllocation firstHalf  = memoryAllocator.allocate( halfBlock, deviceLocal, ResourceKind::eLinear );
+    vk::raii::su::MemoryAllocation secondHalf = memoryAllocator.allocate( halfBlock, deviceLocal, ResourceKind::eLinear );
+    release_assert( ( firstHalf.offset() == 0 ) && ( secondHalf.offset() == blockSize / 2 ) && ( firstHalf.memory() == secondHalf.memory() ) );
+    release_assert( memoryAllocator.getStatistics().blockCount == 1 );
+
+    // a full block is followed by another one; once emptied, that one is kept, as it's the only empty block
+    vk::raii::su::MemoryAllocation f = memoryAllocator.allocate( vk::MemoryRequirements( 64, 64, 0x3 ), deviceLocal, ResourceKind::eLinear );
+    release_assert( ( f.memory() != firstHalf.memory() ) && ( fake::memories.size() == 2 ) );
+    vk::DeviceMemory firstBlock = firstHalf.memory();
+    f.clear();
+    release_assert( ( memoryAllocator.getStatistics().blockCount == 2 ) && ( fake::memories.size() == 2 ) );
+
+    // with another empty block around, an emptied block is released
+    firstHalf.clear();
+    release_assert( fake::memories.size() == 2 );
+    secondHalf.clear();
+    release_assert( ( memoryAllocator.getStatistics().blockCount == 1 ) && ( fake::memories.size() == 1 ) );
+    release_assert( fake::memories.find( static_cast<VkDeviceMemory>( firstBlock ) ) == fake::memories.end() );
+
+    // linear resources and optimal images don't share a block with a bufferImageGranularity larger than 1
+    vk::raii::su::MemoryAllocation linear  = memoryAllocator.allocate( vk::MemoryRequirements( 64, 64, 0x3 ), deviceLocal, ResourceKind::eLinear );
+    vk::raii::su::MemoryAllocation optimal = memoryAllocator.allocate( vk::MemoryRequirements( 64, 64, 0x3 ), deviceLocal, ResourceKind::eOptimal );
+    release_assert( ( linear.memory() != optimal.memory() ) && ( optimal.offset() == 0 ) && ( memoryAllocator.getStatistics().blockCount == 2 ) );
+
+    // resources larger than half a block, and those asking for it, get a dedicated allocation
+    vk::raii::su::MemoryAllocation large =
+      memoryAllocator.allocate( vk::MemoryRequirements( blockSize / 2 + 1, 256, 0x3 ), deviceLocal, ResourceKind::eLinear );
+    release_assert( large.isDedicated() && ( large.offset() == 0 ) && ( fake::memoryOf( large ).size == blockSize / 2 + 1 ) );
+    release_assert( !fake::memoryOf( large ).dedicated );
+
+    vk::Buffer                      buffer( vk::detail::NullDriver::nextHandle<VkBuffer>() );
+    vk::MemoryDedicatedAllocateInfo dedicatedAllocateInfo( {}, buffer );
+    vk::raii::su::MemoryAllocation  dedicated =
+      memoryAllocator.allocate( vk::MemoryRequirements( 64, 64, 0x3 ), deviceLocal, ResourceKind::eLinear, &dedicatedAllocateInfo );
+    release_assert( dedicated.isDedicated() && ( fake::memoryOf( dedicated ).size == 64 ) && fake::memoryOf( dedicated ).dedicated );
+
+    statistics = memoryAllocator.getStatistics();
+    release_assert( ( statistics.dedicatedCount == 2 ) && ( statistics.dedicatedBytes == blockSize / 2 + 1 + 64 ) && ( statistics.allocationCount == 2 ) );
+    large.clear();
+    dedicated.clear();
+    release_assert( ( memoryAllocator.getStatistics().dedicatedCount == 0 ) && ( fake::memories.size() == 2 ) );
+
+    // host visible blocks are persistently mapped, and each allocation points to its own range
+    vk::raii::su::MemoryAllocation mapped0 = memoryAllocator.allocate( vk::MemoryRequirements( 100, 1, 0x3 ), hostVisible, ResourceKind::eLinear );
+    vk::raii::su::MemoryAllocation mapped1 = memoryAllocator.allocate( vk::MemoryRequirements( 100, 64, 0x3 ), hostVisible, ResourceKind::eLinear );
+    release_assert( fake::memoryOf( mapped0 ).memoryTypeIndex == 1 );
+    release_assert( ( mapped0.mappedData() == mappedMemory ) && ( mapped1.mappedData() == mappedMemory + 128 ) );
+
+    // a memory type without the requested properties is an error
+    bool caught = false;
+    try
+    {
+      memoryAllocator.allocate( vk::MemoryRequirements( 64, 64, 0x1 ), hostVisible, ResourceKind::eLinear );
+    }
+    catch ( std::runtime_error const & )
+    {
+      caught = true;
+    }
+    release_assert( caught );
+  }
+  release_assert( fake::memories.empty() );
+
+  {
+    // with a bufferImageGranularity of 1, linear resources and optimal images share the blocks
+    fake::bufferImageGranularity = 1;
+    vk::raii::su::MemoryAllocator  memoryAllocator( nullDevice.physicalDevices[0], nullDevice.device, blockSize );
+    vk::raii::su::MemoryAllocation linear  = memoryAllocator.allocate( vk::MemoryRequirements( 64, 64, 0x3 ), deviceLocal, ResourceKind::eLinear );
+    vk::raii::su::MemoryAllocation optimal = memoryAllocator.allocate( vk::MemoryRequirements( 64, 64, 0x3 ), deviceLocal, ResourceKind::eOptimal );
+    release_assert( ( linear.memory() == optimal.memory() ) && ( optimal.offset() == 64 ) && ( memoryAllocator.getStatistics().blockCount == 1 ) );
+  }
+  release_assert( fake::memories.empty() );
+
+  return 0;
+}
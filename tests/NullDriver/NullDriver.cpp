@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Tests : NullDriver
+//                   Runtime test on vk::, vk::raii::, UniqueHandle, and SharedHandle, running on the null driver
+
+#if !defined( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC )
+#  define VULKAN_HPP_DISPATCH_LOADER_DYNAMIC 1
+#endif
+
+#include "../test_macros.hpp"
+
+#include <set>
+#include <vulkan/vulkan_null_driver.hpp>
+#include <vulkan/vulkan_raii.hpp>
+#include <vulkan/vulkan_shared.hpp>
+VULKAN_HPP_DEFAULT_DISPATCH_LOADER_DYNAMIC_STORAGE
+
+static uint32_t destroyBufferCount = 0;
+
+VKAPI_ATTR void VKAPI_CALL countingDestroyBuffer( VkDevice, VkBuffer, VkAllocationCallbacks const * )
+{
+  ++destroyBufferCount;
+}
+
+template <typename HandleType>
+size_t countDistinct( std::vector<HandleType> const & handles )
+{
+  std::set<typename HandleType::CType> distinctHandles;
+  for ( auto const & handle : handles )
+  {
+    release_assert( handle );
+    distinctHandles.insert( static_cast<typename HandleType::CType>( handle ) );
+  }
+  return distinctHandles.size();
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  vk::detail::NullDriverConfiguration & configuration = vk::detail::NullDriver::configuration();
+  configuration.apiVersion                              = VK_API_VERSION_1_3;
+  configuration.enumerationCount                        = 3;
+  configuration.overrides.emplace_back( "vkDestroyBuffer", reinterpret_cast<PFN_vkVoidFunction>( &countingDestroyBuffer ) );
+
+  float                     queuePriority = 0.0f;
+  vk::DeviceQueueCreateInfo deviceQueueCreateInfo( {}, 0, 1, &queuePriority );
+  vk::BufferCreateInfo      bufferCreateInfo( {}, 256, vk::BufferUsageFlagBits::eVertexBuffer );
+
+  // vk::
+  vk::detail::defaultDispatchLoaderDynamic.init( &vk::detail::NullDriver::getInstanceProcAddr );
+  release_assert( vk::enumerateInstanceVersion() == VK_API_VERSION_1_3 );
+
+  vk::Instance instance = vk::createInstance( vk::InstanceCreateInfo() );
+  release_assert( instance );
+  vk::detail::defaultDispatchLoaderDynamic.init( instance );
+
+  std::vector<vk::PhysicalDevice> physicalDevices = instance.enumeratePhysicalDevices();
+  release_assert( physicalDevices.size() == 3 );
+  release_assert( countDistinct( physicalDevices ) == 3 );
+
+  // an enumeration into a too small array is incomplete
+  uint32_t         physicalDeviceCount = 2;
+  VkPhysicalDevice rawPhysicalDevices[2];
+  release_assert( vk::detail::defaultDispatchLoaderDynamic.vkEnumeratePhysicalDevices( instance, &physicalDeviceCount, rawPhysicalDevices ) == VK_INCOMPLETE );
+  release_assert( physicalDeviceCount == 2 );
+
+  // returned structures are zeroed, but keep their sType and pNext
+  vk::PhysicalDeviceIDProperties idProperties;
+  idProperties.deviceNodeMask = 0xdeadbeef;
+  vk::PhysicalDeviceProperties2 properties2( {}, &idProperties );
+  properties2.properties.apiVersion = 42;
+  physicalDevices[0].getProperties2( &properties2 );
+  release_assert( ( properties2.sType == vk::StructureType::ePhysicalDeviceProperties2 ) && ( properties2.pNext == &idProperties ) );
+  release_assert( properties2.properties.apiVersion == 0 );
+  release_assert( ( idProperties.sType == vk::StructureType::ePhysicalDeviceIdProperties ) && !idProperties.pNext && ( idProperties.deviceNodeMask == 0 ) );
+
+  vk::StructureChain<vk::PhysicalDeviceProperties2, vk::PhysicalDeviceIDProperties> propertiesChain =
+    physicalDevices[0].getProperties2<vk::PhysicalDeviceProperties2, vk::PhysicalDeviceIDProperties>();
+  release_assert( propertiesChain.get<vk::PhysicalDeviceProperties2>().pNext == &propertiesChain.get<vk::PhysicalDeviceIDProperties>() );
+
+  vk::Device device = physicalDevices[0].createDevice( vk::DeviceCreateInfo( {}, deviceQueueCreateInfo ) );
+  release_assert( device );
+  vk::detail::defaultDispatchLoaderDynamic.init( device );
+
+  // an array of handles sized by some input
+  vk::CommandPool                commandPool = device.createCommandPool( vk::CommandPoolCreateInfo() );
+  std::vector<vk::CommandBuffer> commandBuffers =
+    device.allocateCommandBuffers( vk::CommandBufferAllocateInfo( commandPool, vk::CommandBufferLevel::ePrimary, 4 ) );
+  release_assert( countDistinct( commandBuffers ) == 4 );
+
+  vk::DeviceMemory deviceMemory = device.allocateMemory( vk::MemoryAllocateInfo( 256, 0 ) );
+  void *           data         = device.mapMemory( deviceMemory, 0, 256 );
+  release_assert( data == vk::detail::NullDriver::mappedMemory() );
+  device.unmapMemory( deviceMemory );
+  device.freeMemory( deviceMemory );
+
+  vk::Buffer buffer = device.createBuffer( bufferCreateInfo );
+  device.destroyBuffer( buffer );
+  release_assert( destroyBufferCount == 1 );
+
+  // a DispatchLoaderNull needs no initialization at all
+  vk::detail::DispatchLoaderNull dispatchLoaderNull;
+  release_assert( dispatchLoaderNull.vkCmdDraw );
+  commandBuffers[0].draw( 3, 1, 0, 0, dispatchLoaderNull );
+
+  // UniqueHandle
+  {
+    vk::UniqueBuffer uniqueBuffer = device.createBufferUnique( bufferCreateInfo );
+    release_assert( uniqueBuffer );
+  }
+  release_assert( destroyBufferCount == 2 );
+
+  device.destroyCommandPool( commandPool );
+
+  // SharedHandle
+  {
+    vk::SharedDevice sharedDevice( device );
+    vk::SharedBuffer sharedBuffer( device.createBuffer( bufferCreateInfo ), sharedDevice );
+    vk::SharedBuffer otherBuffer = sharedBuffer;
+    release_assert( otherBuffer.get() == sharedBuffer.get() );
+  }
+  release_assert( destroyBufferCount == 3 );
+
+  instance.destroy();
+
+  // vk::raii::
+  vk::raii::Context context( &vk::detail::NullDriver::getInstanceProcAddr );
+  release_assert( context.enumerateInstanceVersion() == VK_API_VERSION_1_3 );
+
+  vk::raii::Instance        raiiInstance( context, vk::InstanceCreateInfo() );
+  vk::raii::PhysicalDevices raiiPhysicalDevices( raiiInstance );
+  release_assert( raiiPhysicalDevices.size() == 3 );
+
+  vk::raii::Device raiiDevice( raiiPhysicalDevices[0], vk::DeviceCreateInfo( {}, deviceQueueCreateInfo ) );
+  {
+    vk::raii::Buffer raiiBuffer( raiiDevice, bufferCreateInfo );
+    release_assert( *raiiBuffer );
+  }
+  release_assert( destroyBufferCount == 4 );
+
+  vk::raii::CommandPool    raiiCommandPool( raiiDevice, vk::CommandPoolCreateInfo() );
+  vk::raii::CommandBuffers raiiCommandBuffers( raiiDevice, vk::CommandBufferAllocateInfo( raiiCommandPool, vk::CommandBufferLevel::ePrimary, 4 ) );
+  release_assert( raiiCommandBuffers.size() == 4 );
+
+  return 0;
+}
@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Tests : PipelineCacheStore
+//                   Runtime test on the header validation by vk::su::validatePipelineCacheData, and on storing and loading pipeline cache
+//                   data by vk::su::PipelineCacheStore
+
+#include "../../samples/utils/pipelineCache.hpp"
+#include "../test_macros.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+static std::string const cacheFileName = "PipelineCacheStore.bin";
+
+// the layout of a VkPipelineCacheHeaderVersionOne: { uint32_t headerSize, uint32_t headerVersion, uint32_t vendorID, uint32_t deviceID,
+// uint8_t pipelineCacheUUID[VK_UUID_SIZE] }
+static size_t const headerSizeOffset    = 0;
+static size_t const headerVersionOffset = 4;
+static size_t const vendorIDOffset      = 8;
+static size_t const deviceIDOffset      = 12;
+static size_t const uuidOffset          = 16;
+
+// pipeline cache data matching properties, with payloadSize bytes following the header
+static std::vector<uint8_t> makeCacheData( vk::PhysicalDeviceProperties const & properties, size_t payloadSize )
+{
+  vk::PipelineCacheHeaderVersionOne header(
+    sizeof( vk::PipelineCacheHeaderVersionOne ), vk::PipelineCacheHeaderVersion::eOne, properties.vendorID, properties.deviceID, properties.pipelineCacheUUID );
+  std::vector<uint8_t> data( sizeof( header ) + payloadSize );
+  memcpy( data.data(), &header, sizeof( header ) );
+  for ( size_t i = sizeof( header ); i < data.size(); ++i )
+  {
+    data[i] = static_cast<uint8_t>( i );
+  }
+  return data;
+}
+
+static void setValue( std::vector<uint8_t> & data, size_t offset, uint32_t value )
+{
+  memcpy( data.data() + offset, &value, sizeof( value ) );
+}
+
+static void writeCacheFile( std::vector<uint8_t> const & data )
+{
+  std::ofstream stream( cacheFileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+  stream.write( reinterpret_cast<char const *>( data.data() ), static_cast<std::streamsize>( data.size() ) );
+  release_assert( !!stream );
+}
+
+static std::vector<uint8_t> readCacheFile()
+{
+  std::ifstream stream( cacheFileName, std::ios_base::in | std::ios_base::binary );
+  return std::vector<uint8_t>( std::istreambuf_iterator<char>( stream ), std::istreambuf_iterator<char>() );
+}
+
+static bool holds( vk::su::PipelineCacheStore const & store, std::vector<uint8_t> const & data )
+{
+  return ( store.size() == data.size() ) && ( memcmp( store.data(), data.data(), data.size() ) == 0 );
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  vk::PhysicalDeviceProperties properties;
+  properties.vendorID = 0x10DE;
+  properties.deviceID = 0x2684;
+  for ( uint32_t i = 0; i < VK_UUID_SIZE; ++i )
+  {
+    properties.pipelineCacheUUID[i] = static_cast<uint8_t>( 0xA0 + i );
+  }
+  vk::PhysicalDeviceProperties otherProperties = properties;
+  otherProperties.deviceID                     = 0x2704;
+
+  std::vector<uint8_t> const validData = makeCacheData( properties, 100 );
+
+  {
+    // validatePipelineCacheData, on data at an unaligned address
+    std::vector<uint8_t> buffer( validData.size() + 1 );
+    memcpy( buffer.data() + 1, validData.data(), validData.size() );
+    vk::PipelineCacheHeaderVersionOne header;
+    release_assert( vk::su::validatePipelineCacheData( buffer.data() + 1, validData.size(), properties, &header ) == vk::su::PipelineCacheDataStatus::eValid );
+    release_assert( ( header.vendorID == properties.vendorID ) && ( header.deviceID == properties.deviceID ) );
+    release_assert( vk::su::validatePipelineCacheData( buffer.data() + 1, validData.size(), otherProperties ) ==
+                    vk::su::PipelineCacheDataStatus::eDeviceIDMismatch );
+
+    // truncated data
+    release_assert( vk::su::validatePipelineCacheData( nullptr, 0, properties ) == vk::su::PipelineCacheDataStatus::eMissing );
+    release_assert( vk::su::validatePipelineCacheData( validData.data(), 0, properties ) == vk::su::PipelineCacheDataStatus::eMissing );
+    release_assert( vk::su::validatePipelineCacheData( validData.data(), sizeof( vk::PipelineCacheHeaderVersionOne ) - 1, properties ) ==
+                    vk::su::PipelineCacheDataStatus::eTooSmall );
+    release_assert( vk::su::validatePipelineCacheData( validData.data(), sizeof( vk::PipelineCacheHeaderVersionOne ), properties ) ==
+                    vk::su::PipelineCacheDataStatus::eValid );
+
+    // corrupt headers, each one reported by the first mismatch
+    struct Corruption
+    {
+      size_t                          offset;
+      uint32_t                        value;
+      vk::su::PipelineCacheDataStatus status;
+    };
+    uint32_t const   oversized     = static_cast<uint32_t>( validData.size() + 1 );
+    Corruption const corruptions[] = { { headerSizeOffset, 16, vk::su::PipelineCacheDataStatus::eHeaderSizeMismatch },
+                                       { headerSizeOffset, oversized, vk::su::PipelineCacheDataStatus::eHeaderSizeMismatch },
+                                       { headerVersionOffset, 2, vk::su::PipelineCacheDataStatus::eHeaderVersionMismatch },
+                                       { vendorIDOffset, 0x1002, vk::su::PipelineCacheDataStatus::eVendorIDMismatch },
+                                       { deviceIDOffset, 0x2704, vk::su::PipelineCacheDataStatus::eDeviceIDMismatch },
+                                       { uuidOffset + 12, 0, vk::su::PipelineCacheDataStatus::ePipelineCacheUUIDMismatch } };
+    for ( Corruption const & corruption : corruptions )
+    {
+      std::vector<uint8_t> data = validData;
+      setValue( data, corruption.offset, corruption.value );
+      release_assert( vk::su::validatePipelineCacheData( data.data(), data.size(), properties ) == corruption.status );
+    }
+
+    // a larger header is fine, as long as the data holds it
+    std::vector<uint8_t> data = validData;
+    setValue( data, headerSizeOffset, static_cast<uint32_t>( data.size() ) );
+    release_assert( vk::su::validatePipelineCacheData( data.data(), data.size(), properties ) == vk::su::PipelineCacheDataStatus::eValid );
+  }
+
+  std::remove( cacheFileName.c_str() );
+
+  {
+    // without a file, there's no data to create a pipeline cache from
+    vk::su::PipelineCacheStore store( cacheFileName, properties );
+    release_assert( store.load() == vk::su::PipelineCacheDataStatus::eMissing );
+    release_assert( ( store.data() == nullptr ) && ( store.size() == 0 ) );
+    release_assert( ( store.makeCreateInfo().initialDataSize == 0 ) && ( store.makeCreateInfo().pInitialData == nullptr ) );
+
+    // stored data is loaded back as is
+    release_assert( store.store( validData ) );
+    release_assert( store.load() == vk::su::PipelineCacheDataStatus::eValid );
+    release_assert( holds( store, validData ) );
+    release_assert( ( store.makeCreateInfo().initialDataSize == validData.size() ) && ( store.makeCreateInfo().pInitialData == store.data() ) );
+
+    // invalid data is not stored, and the file is left alone
+    std::vector<uint8_t> otherData = makeCacheData( otherProperties, 50 );
+    release_assert( !store.store( otherData ) );
+    release_assert( readCacheFile() == validData );
+
+    // storing the loaded data, which points into the file to be replaced
+    release_assert( store.store( store.data(), store.size() ) );
+    release_assert( readCacheFile() == validData );
+
+    // a larger cache replaces the file
+    std::vector<uint8_t> largerData = makeCacheData( properties, 1000 );
+    release_assert( store.store( largerData ) );
+    release_assert( ( store.load() == vk::su::PipelineCacheDataStatus::eValid ) && holds( store, largerData ) );
+
+    // the file is not valid for another device
+    vk::su::PipelineCacheStore otherStore( cacheFileName, otherProperties );
+    release_assert( otherStore.load() == vk::su::PipelineCacheDataStatus::eDeviceIDMismatch );
+    release_assert( ( otherStore.data() == nullptr ) && ( otherStore.size() == 0 ) );
+  }
+
+  {
+    // a truncated file doesn't give any data
+    writeCacheFile( std::vector<uint8_t>( validData.begin(), validData.begin() + 20 ) );
+    vk::su::PipelineCacheStore store( cacheFileName, properties );
+    release_assert( store.load() == vk::su::PipelineCacheDataStatus::eTooSmall );
+    release_assert( ( store.data() == nullptr ) && ( store.size() == 0 ) );
+
+    // neither does an empty one
+    writeCacheFile( std::vector<uint8_t>() );
+    release_assert( store.load() == vk::su::PipelineCacheDataStatus::eMissing );
+
+    release_assert( store.store( validData ) && ( store.load() == vk::su::PipelineCacheDataStatus::eValid ) );
+    store.remove();
+    release_assert( ( store.data() == nullptr ) && ( store.load() == vk::su::PipelineCacheDataStatus::eMissing ) );
+  }
+
+  return 0;
+}
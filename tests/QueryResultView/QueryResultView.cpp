@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Tests : QueryResultView
+//                   Runtime test on the getQueryPoolResults overloads writing into caller-provided storage, running on the null driver with
+//                   faked query results
+
+#if !defined( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC )
+#  define VULKAN_HPP_DISPATCH_LOADER_DYNAMIC 1
+#endif
+
+#include "../null_driver_fixture.hpp"
+
+#include <array>
+#include <vector>
+VULKAN_HPP_DEFAULT_DISPATCH_LOADER_DYNAMIC_STORAGE
+
+// every query gives the values 100 * query + 0, 1, 2, and is available if it's odd
+void writeQueries( VkQueryPool queryPool, uint32_t queryCount )
+{
+  for ( uint32_t query = 0; query < queryCount; ++query )
+  {
+    fixture::Query & fakeQuery = fixture::queries()[std::make_pair( queryPool, query )];
+    fakeQuery.values           = { 100 * query, 100 * query + 1, 100 * query + 2 };
+    fakeQuery.available        = ( query % 2 ) != 0;
+  }
+}
+
+struct PipelineStatistics
+{
+  uint64_t inputAssemblyVertices;
+  uint64_t vertexShaderInvocations;
+};
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  fixture::addOverride( "vkGetQueryPoolResults", &fixture::getQueryPoolResults );
+  fixture::QueryPoolResultsCall const & lastCall = fixture::lastQueryPoolResultsCall();
+
+  static_assert( vk::QueryResultView<uint32_t>::queryStride( {} ) == 4, "" );
+  static_assert( vk::QueryResultView<uint64_t>::queryStride( vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWithAvailability ) == 16, "" );
+  static_assert( vk::QueryResultView<PipelineStatistics>::queryStride( vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWithAvailability ) == 24,
+                 "" );
+
+  float                     queuePriority = 0.0f;
+  vk::DeviceQueueCreateInfo deviceQueueCreateInfo( {}, 0, 1, &queuePriority );
+
+  // vk::
+  {
+    vk::detail::defaultDispatchLoaderDynamic.init( &vk::detail::NullDriver::getInstanceProcAddr );
+    vk::Instance instance = vk::createInstance( vk::InstanceCreateInfo() );
+    vk::detail::defaultDispatchLoaderDynamic.init( instance );
+    vk::PhysicalDevice physicalDevice = instance.enumeratePhysicalDevices().front();
+    vk::Device         device         = physicalDevice.createDevice( vk::DeviceCreateInfo( {}, deviceQueueCreateInfo ) );
+    vk::detail::defaultDispatchLoaderDynamic.init( device );
+    vk::QueryPool queryPool = device.createQueryPool( vk::QueryPoolCreateInfo( {}, vk::QueryType::eTimestamp, 8 ) );
+    writeQueries( queryPool, 8 );
+
+    // 64 bit storage implies e64, the stride follows from the availability word
+    std::array<uint64_t, 8>                        storage64;
+    vk::ResultValue<vk::QueryResultView<uint64_t>> results =
+      device.getQueryPoolResults<uint64_t>( queryPool, 0, 4, storage64, vk::QueryResultFlagBits::eWithAvailability );
+    release_assert( results.result == vk::Result::eNotReady );
+    release_assert( lastCall.flags == ( VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT ) );
+    release_assert( ( lastCall.stride == 16 ) && ( lastCall.dataSize == sizeof( storage64 ) ) );
+    release_assert( ( results.value.size() == 4 ) && ( results.value.stride() == 16 ) && results.value.hasAvailability() );
+    release_assert( results.value.data() == reinterpret_cast<uint64_t const *>( storage64.data() ) );
+    for ( uint32_t i = 0; i < 4; ++i )
+    {
+      release_assert( results.value.isAvailable( i ) == ( i % 2 == 1 ) );
+      release_assert( !results.value.isAvailable( i ) || ( results.value[i] == 100 * i ) );
+    }
+
+    // 32 bit storage drops e64, and without availability the results are tightly packed; the unavailable query 6 is not written
+    std::vector<uint32_t>                          storage32( 3 );
+    vk::ResultValue<vk::QueryResultView<uint32_t>> packed = device.getQueryPoolResults<uint32_t>( queryPool, 5, 3, storage32, vk::QueryResultFlagBits::e64 );
+    release_assert( ( lastCall.flags == 0 ) && ( lastCall.stride == 4 ) );
+    release_assert( !packed.value.hasAvailability() );
+    release_assert( ( packed.value[0] == 500 ) && ( packed.value[1] == 0 ) && ( packed.value[2] == 700 ) );
+
+    device.destroyQueryPool( queryPool );
+    device.destroy();
+    instance.destroy();
+  }
+
+  // vk::raii::
+  {
+    fixture::NullDevice nullDevice;
+    vk::raii::QueryPool queryPool( nullDevice.device, vk::QueryPoolCreateInfo( {}, vk::QueryType::ePipelineStatistics, 8 ) );
+    writeQueries( *queryPool, 8 );
+
+    // a structure of several values per query, followed by its availability
+    std::vector<uint64_t>                                    storage( 3 * 2 );
+    vk::ResultValue<vk::QueryResultView<PipelineStatistics>> statistics =
+      queryPool.getResults<PipelineStatistics>( 1, 2, storage, vk::QueryResultFlagBits::eWithAvailability );
+    release_assert( statistics.result == vk::Result::eNotReady );
+    release_assert( ( lastCall.stride == 24 ) && ( statistics.value.stride() == 24 ) );
+    release_assert( ( statistics.value[0].inputAssemblyVertices == 100 ) && ( statistics.value[0].vertexShaderInvocations == 101 ) );
+    release_assert( statistics.value.isAvailable( 0 ) && !statistics.value.isAvailable( 1 ) );
+
+    // the status word of video queries is signed, and sign-extended on reading
+    fixture::queries()[std::make_pair( *queryPool, 2 )].available = true;
+    fixture::queries()[std::make_pair( *queryPool, 2 )].status    = VK_QUERY_RESULT_STATUS_ERROR_KHR;
+    std::array<uint32_t, 4>                        statusStorage;
+    vk::ResultValue<vk::QueryResultView<uint32_t>> status = queryPool.getResults<uint32_t>( 2, 2, statusStorage, vk::QueryResultFlagBits::eWithStatusKHR );
+    release_assert( ( lastCall.flags == VK_QUERY_RESULT_WITH_STATUS_BIT_KHR ) && ( lastCall.stride == 8 ) );
+    release_assert( ( status.value[0] == 200 ) && ( status.value[1] == 300 ) );
+    release_assert( status.value.status( 0 ) == vk::QueryResultStatusKHR::eError );
+    release_assert( status.value.status( 1 ) == vk::QueryResultStatusKHR::eComplete );
+  }
+
+  return 0;
+}
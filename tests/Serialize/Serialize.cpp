@@ -0,0 +1,213 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Tests : Serialize
+//                   Runtime test on round-tripping structures through vk::serialize and vk::deserialize
+
+#include "../test_macros.hpp"
+
+#include <cstring>
+#include <vulkan/vulkan_serialize.hpp>
+
+// the handles are just stored and restored, they don't need to be valid
+template <typename Handle>
+Handle makeHandle( uint8_t value )
+{
+  typename Handle::CType handle;
+  memset( &handle, value, sizeof( handle ) );
+  return Handle( handle );
+}
+
+bool equalStrings( char const * lhs, char const * rhs )
+{
+  return ( lhs == rhs ) || ( lhs && rhs && ( strcmp( lhs, rhs ) == 0 ) );
+}
+
+template <typename T>
+bool equalArrays( T const * lhs, T const * rhs, size_t count )
+{
+  return ( lhs == rhs ) || ( lhs && rhs && ( memcmp( lhs, rhs, count * sizeof( T ) ) == 0 ) );
+}
+
+void checkShaderStage( vk::PipelineShaderStageCreateInfo const & stage, vk::PipelineShaderStageCreateInfo const & original )
+{
+  release_assert( stage.sType == vk::StructureType::ePipelineShaderStageCreateInfo );
+  release_assert( ( stage.stage == original.stage ) && ( stage.module == original.module ) && equalStrings( stage.pName, original.pName ) );
+  release_assert( !stage.pSpecializationInfo == !original.pSpecializationInfo );
+  if ( original.pSpecializationInfo )
+  {
+    vk::SpecializationInfo const & specializationInfo = *stage.pSpecializationInfo;
+    release_assert( specializationInfo.pMapEntries != original.pSpecializationInfo->pMapEntries );
+    release_assert( specializationInfo.mapEntryCount == original.pSpecializationInfo->mapEntryCount );
+    for ( uint32_t i = 0; i < specializationInfo.mapEntryCount; ++i )
+    {
+      release_assert( specializationInfo.pMapEntries[i] == original.pSpecializationInfo->pMapEntries[i] );
+    }
+    release_assert( specializationInfo.dataSize == original.pSpecializationInfo->dataSize );
+    release_assert( memcmp( specializationInfo.pData, original.pSpecializationInfo->pData, specializationInfo.dataSize ) == 0 );
+  }
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  // a graphics pipeline, with shader stages and specialization constants, some pipeline states, and a pNext chain
+  std::array<vk::SpecializationMapEntry, 2> mapEntries = { { vk::SpecializationMapEntry( 0, 0, sizeof( float ) ),
+                                                             vk::SpecializationMapEntry( 1, sizeof( float ), sizeof( uint32_t ) ) } };
+  std::array<uint32_t, 2>                   constants  = { { 0x3F800000, 7 } };
+  vk::SpecializationInfo                    specialization( mapEntries, vk::ArrayProxyNoTemporaries<const uint32_t>( constants ) );
+
+  std::array<vk::PipelineShaderStageCreateInfo, 2> stages = {
+    { vk::PipelineShaderStageCreateInfo( {}, vk::ShaderStageFlagBits::eVertex, makeHandle<vk::ShaderModule>( 1 ), "main", &specialization ),
+      vk::PipelineShaderStageCreateInfo( {}, vk::ShaderStageFlagBits::eFragment, makeHandle<vk::ShaderModule>( 2 ), "fragmentMain" ) }
+  };
+
+  vk::VertexInputBindingDescription                  binding( 0, 32 );
+  std::array<vk::VertexInputAttributeDescription, 2> attributes = { { vk::VertexInputAttributeDescription( 0, 0, vk::Format::eR32G32B32Sfloat, 0 ),
+                                                                      vk::VertexInputAttributeDescription( 1, 0, vk::Format::eR32G32Sfloat, 24 ) } };
+  vk::PipelineVertexInputStateCreateInfo             vertexInputState( {}, binding, attributes );
+  vk::PipelineInputAssemblyStateCreateInfo           inputAssemblyState( {}, vk::PrimitiveTopology::eTriangleList );
+  vk::PipelineViewportStateCreateInfo                viewportState( {}, 1, nullptr, 1, nullptr );
+  vk::PipelineRasterizationStateCreateInfo           rasterizationState(
+    {}, false, false, vk::PolygonMode::eFill, vk::CullModeFlagBits::eBack, vk::FrontFace::eClockwise, false, 0.0f, 0.0f, 0.0f, 1.0f );
+  vk::SampleMask                         sampleMask = 0x5;
+  vk::PipelineMultisampleStateCreateInfo multisampleState( {}, vk::SampleCountFlagBits::e4, false, 0.0f, &sampleMask );
+  vk::PipelineColorBlendAttachmentState  colorBlendAttachment( false,
+                                                              vk::BlendFactor::eZero,
+                                                              vk::BlendFactor::eZero,
+                                                              vk::BlendOp::eAdd,
+                                                              vk::BlendFactor::eZero,
+                                                              vk::BlendFactor::eZero,
+                                                              vk::BlendOp::eAdd,
+                                                              vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG );
+  vk::PipelineColorBlendStateCreateInfo  colorBlendState( {}, false, vk::LogicOp::eNoOp, colorBlendAttachment, { { 0.25f, 0.5f, 0.75f, 1.0f } } );
+  std::array<vk::DynamicState, 2>        dynamicStates = { { vk::DynamicState::eViewport, vk::DynamicState::eScissor } };
+  vk::PipelineDynamicStateCreateInfo     dynamicState( {}, dynamicStates );
+
+  std::array<vk::Format, 2>              colorFormats = { { vk::Format::eB8G8R8A8Unorm, vk::Format::eR16G16B16A16Sfloat } };
+  vk::PipelineRenderingCreateInfo        renderingCreateInfo( 0, colorFormats, vk::Format::eD32Sfloat );
+  vk::PipelineCreationFeedback           creationFeedback;
+  vk::PipelineCreationFeedbackCreateInfo creationFeedbackCreateInfo( &creationFeedback );
+  renderingCreateInfo.pNext = &creationFeedbackCreateInfo;
+
+  vk::GraphicsPipelineCreateInfo graphicsPipelineCreateInfo( {},
+                                                              stages,
+                                                              &vertexInputState,
+                                                              &inputAssemblyState,
+                                                              nullptr,
+                                                              &viewportState,
+                                                              &rasterizationState,
+                                                              &multisampleState,
+                                                              nullptr,
+                                                              &colorBlendState,
+                                                              &dynamicState,
+                                                              makeHandle<vk::PipelineLayout>( 3 ),
+                                                              nullptr,
+                                                              0,
+                                                              nullptr,
+                                                              -1,
+                                                              &renderingCreateInfo );
+
+  std::vector<uint8_t> data = vk::serialize( graphicsPipelineCreateInfo );
+
+  vk::DeserializedStructure<vk::GraphicsPipelineCreateInfo> deserialized = vk::deserialize<vk::GraphicsPipelineCreateInfo>( data );
+  release_assert( deserialized );
+  vk::GraphicsPipelineCreateInfo const & info = *deserialized;
+  release_assert( ( info.layout == graphicsPipelineCreateInfo.layout ) && ( info.basePipelineIndex == -1 ) );
+
+  release_assert( ( info.stageCount == 2 ) && ( info.pStages != stages.data() ) );
+  checkShaderStage( info.pStages[0], stages[0] );
+  checkShaderStage( info.pStages[1], stages[1] );
+
+  release_assert( info.pVertexInputState && ( info.pVertexInputState->vertexBindingDescriptionCount == 1 ) &&
+                  ( info.pVertexInputState->pVertexBindingDescriptions[0] == binding ) );
+  release_assert( equalArrays( info.pVertexInputState->pVertexAttributeDescriptions, attributes.data(), attributes.size() ) );
+  release_assert( info.pInputAssemblyState && ( *info.pInputAssemblyState == inputAssemblyState ) );
+  release_assert( !info.pTessellationState && !info.pDepthStencilState );
+  release_assert( info.pViewportState && ( info.pViewportState->viewportCount == 1 ) && !info.pViewportState->pViewports );
+  release_assert( info.pRasterizationState && ( *info.pRasterizationState == rasterizationState ) );
+  release_assert( info.pMultisampleState && info.pMultisampleState->pSampleMask && ( *info.pMultisampleState->pSampleMask == sampleMask ) );
+  release_assert( info.pColorBlendState && ( info.pColorBlendState->attachmentCount == 1 ) &&
+                  ( info.pColorBlendState->pAttachments[0] == colorBlendAttachment ) );
+  release_assert( info.pColorBlendState->blendConstants == colorBlendState.blendConstants );
+  release_assert( info.pDynamicState && equalArrays( info.pDynamicState->pDynamicStates, dynamicStates.data(), dynamicStates.size() ) );
+
+  // the pNext chain is rebuilt element by element
+  vk::PipelineRenderingCreateInfo const * rendering = static_cast<vk::PipelineRenderingCreateInfo const *>( info.pNext );
+  release_assert( rendering && ( rendering->sType == vk::StructureType::ePipelineRenderingCreateInfo ) );
+  release_assert( ( rendering->colorAttachmentFormatCount == 2 ) &&
+                  equalArrays( rendering->pColorAttachmentFormats, colorFormats.data(), colorFormats.size() ) );
+  release_assert( rendering->depthAttachmentFormat == vk::Format::eD32Sfloat );
+  vk::PipelineCreationFeedbackCreateInfo const * feedback = static_cast<vk::PipelineCreationFeedbackCreateInfo const *>( rendering->pNext );
+  release_assert( feedback && ( feedback->sType == vk::StructureType::ePipelineCreationFeedbackCreateInfo ) && !feedback->pNext );
+  release_assert( feedback->pPipelineCreationFeedback && ( feedback->pPipelineCreationFeedback != &creationFeedback ) );
+
+  // serializing the deserialized structure gives the very same data
+  release_assert( vk::serialize( info ) == data );
+
+  // strings and string arrays, with the handles replaced after deserialization
+  vk::ApplicationInfo         applicationInfo( "Serialize", 1, nullptr, 0, vk::ApiVersion13 );
+  std::array<char const *, 2> extensions = { { "VK_KHR_surface", "VK_EXT_debug_utils" } };
+  vk::InstanceCreateInfo      instanceCreateInfo( {}, &applicationInfo, {}, extensions );
+  vk::DeserializedStructure<vk::InstanceCreateInfo> instanceInfo = vk::deserialize<vk::InstanceCreateInfo>( vk::serialize( instanceCreateInfo ) );
+  release_assert( instanceInfo && instanceInfo->pApplicationInfo && equalStrings( instanceInfo->pApplicationInfo->pApplicationName, "Serialize" ) );
+  release_assert( !instanceInfo->pApplicationInfo->pEngineName && ( instanceInfo->pApplicationInfo->apiVersion == vk::ApiVersion13 ) );
+  release_assert( ( instanceInfo->enabledLayerCount == 0 ) && !instanceInfo->ppEnabledLayerNames && ( instanceInfo->enabledExtensionCount == 2 ) );
+  release_assert( equalStrings( instanceInfo->ppEnabledExtensionNames[0], extensions[0] ) &&
+                  equalStrings( instanceInfo->ppEnabledExtensionNames[1], extensions[1] ) );
+
+  // unions without pointers, like ClearValue, are stored as they are
+  std::array<vk::ClearValue, 2> clearValues = { { vk::ClearColorValue( 0.25f, 0.5f, 0.75f, 1.0f ), vk::ClearDepthStencilValue( 1.0f, 7 ) } };
+  vk::RenderPassBeginInfo       renderPassBeginInfo(
+    makeHandle<vk::RenderPass>( 5 ), makeHandle<vk::Framebuffer>( 6 ), vk::Rect2D( vk::Offset2D( 8, 16 ), vk::Extent2D( 640, 480 ) ), clearValues );
+  vk::DeserializedStructure<vk::RenderPassBeginInfo> beginInfo = vk::deserialize<vk::RenderPassBeginInfo>( vk::serialize( renderPassBeginInfo ) );
+  release_assert( beginInfo && ( beginInfo->renderPass == renderPassBeginInfo.renderPass ) && ( beginInfo->framebuffer == renderPassBeginInfo.framebuffer ) );
+  release_assert( beginInfo->renderArea == renderPassBeginInfo.renderArea );
+  release_assert( ( beginInfo->clearValueCount == 2 ) && ( beginInfo->pClearValues != clearValues.data() ) &&
+                  equalArrays( beginInfo->pClearValues, clearValues.data(), clearValues.size() ) );
+  release_assert( ( beginInfo->pClearValues[0].color.float32[2] == 0.75f ) && ( beginInfo->pClearValues[1].depthStencil.stencil == 7 ) );
+
+  deserialized.get().layout = makeHandle<vk::PipelineLayout>( 4 );
+  release_assert( deserialized->layout == makeHandle<vk::PipelineLayout>( 4 ) );
+
+  // truncated data, data of some other structure, and an unknown structure in the pNext chain are rejected
+  for ( size_t size = 0; size < data.size(); ++size )
+  {
+    bool rejected = false;
+    try
+    {
+      vk::DeserializedStructure<vk::GraphicsPipelineCreateInfo> truncated =
+        vk::deserialize<vk::GraphicsPipelineCreateInfo>( vk::ArrayProxy<const uint8_t>( static_cast<uint32_t>( size ), data.data() ) );
+    }
+    catch ( vk::LogicError const & )
+    {
+      rejected = true;
+    }
+    release_assert( rejected );
+  }
+
+  bool rejected = false;
+  try
+  {
+    vk::DeserializedStructure<vk::InstanceCreateInfo> wrongType = vk::deserialize<vk::InstanceCreateInfo>( data );
+  }
+  catch ( vk::LogicError const & )
+  {
+    rejected = true;
+  }
+  release_assert( rejected );
+
+  VkBaseInStructure unknownStructure = { VK_STRUCTURE_TYPE_MAX_ENUM, nullptr };
+  creationFeedbackCreateInfo.pNext   = &unknownStructure;
+  rejected                           = false;
+  try
+  {
+    std::vector<uint8_t> unknownChain = vk::serialize( graphicsPipelineCreateInfo );
+  }
+  catch ( vk::LogicError const & )
+  {
+    rejected = true;
+  }
+  release_assert( rejected );
+
+  return 0;
+}
@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Tests : ShaderCompiler
+//                   Runtime test on the caching of vk::su::ShaderCompiler, compiling some of the samples' shaders into a cache file, which is
+//                   then corrupted in various ways
+
+#include "../../samples/utils/shaders.hpp"
+#include "../test_macros.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+static std::string const cacheFileName = "ShaderCompiler.spvcache";
+
+// the layout of the cache file: a header of { uint32_t magic, uint32_t version, uint64_t entryCount }, followed by entryCount entries of
+// { uint64_t key, uint64_t offset, uint64_t size }, followed by the SPIR-V blobs
+static size_t const headerSize = 16;
+static size_t const entrySize  = 24;
+
+static std::vector<char> readCacheFile()
+{
+  std::ifstream stream( cacheFileName, std::ios_base::in | std::ios_base::binary );
+  return std::vector<char>( std::istreambuf_iterator<char>( stream ), std::istreambuf_iterator<char>() );
+}
+
+static void writeCacheFile( std::vector<char> const & data )
+{
+  std::ofstream stream( cacheFileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+  stream.write( data.data(), static_cast<std::streamsize>( data.size() ) );
+  release_assert( !!stream );
+}
+
+static uint64_t getValue( std::vector<char> const & data, size_t offset )
+{
+  uint64_t value;
+  memcpy( &value, data.data() + offset, sizeof( value ) );
+  return value;
+}
+
+static void setValue( std::vector<char> & data, size_t offset, uint64_t value )
+{
+  memcpy( data.data() + offset, &value, sizeof( value ) );
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  std::remove( cacheFileName.c_str() );
+
+  std::vector<unsigned int> vertexSPV, fragmentSPV;
+  {
+    // without a cache file, every shader is a miss
+    vk::su::ShaderCompiler shaderCompiler( cacheFileName );
+    vertexSPV = shaderCompiler.compile( vk::ShaderStageFlagBits::eVertex, vertexShaderText_PC_C );
+    release_assert( !vertexSPV.empty() && ( vertexSPV[0] == 0x07230203 ) );  // the SPIR-V magic number
+    release_assert( ( shaderCompiler.cacheHits() == 0 ) && ( shaderCompiler.cacheMisses() == 1 ) );
+
+    // shaders compiled before are hit in memory, and a batch compiles each missing shader just once
+    std::vector<std::vector<unsigned int>> spvShaders = shaderCompiler.compile( { { vk::ShaderStageFlagBits::eVertex, vertexShaderText_PC_C },
+                                                                                  { vk::ShaderStageFlagBits::eFragment, fragmentShaderText_C_C },
+                                                                                  { vk::ShaderStageFlagBits::eFragment, fragmentShaderText_C_C } } );
+    release_assert( ( spvShaders.size() == 3 ) && ( spvShaders[0] == vertexSPV ) && ( spvShaders[1] == spvShaders[2] ) );
+    release_assert( ( shaderCompiler.cacheHits() == 1 ) && ( shaderCompiler.cacheMisses() == 2 ) );
+    fragmentSPV = spvShaders[1];
+
+    release_assert( shaderCompiler.flush() );
+  }
+  release_assert( getValue( readCacheFile(), 8 ) == 2 );
+
+  {
+    // another ShaderCompiler hits the shaders in the cache file
+    vk::su::ShaderCompiler shaderCompiler( cacheFileName );
+    release_assert( shaderCompiler.compile( vk::ShaderStageFlagBits::eFragment, fragmentShaderText_C_C ) == fragmentSPV );
+    release_assert( shaderCompiler.compile( vk::ShaderStageFlagBits::eVertex, vertexShaderText_PC_C ) == vertexSPV );
+    release_assert( ( shaderCompiler.cacheHits() == 2 ) && ( shaderCompiler.cacheMisses() == 0 ) );
+
+    // a shader that doesn't compile throws, and is not cached; the source of a vertex shader doesn't make a fragment shader
+    bool thrown = false;
+    try
+    {
+      shaderCompiler.compile( vk::ShaderStageFlagBits::eFragment, vertexShaderText_PC_C );
+    }
+    catch ( std::runtime_error const & )
+    {
+      thrown = true;
+    }
+    release_assert( thrown && ( shaderCompiler.cacheMisses() == 0 ) );
+  }
+
+  // a corrupt index invalidates the whole cache file: each shader is a miss then, and the file is rewritten on destruction
+  std::vector<char> const validData = readCacheFile();
+  for ( int corruption = 0; corruption < 5; ++corruption )
+  {
+    std::vector<char> data = validData;
+    switch ( corruption )
+    {
+      case 0: setValue( data, 8, ( data.size() - headerSize ) / entrySize + 1 ); break;       // more entries than fit into the file
+      case 1: setValue( data, headerSize + entrySize + 8, data.size() ); break;               // a blob starting beyond the file
+      case 2: setValue( data, headerSize + 16, data.size() ); break;                          // a blob ending beyond the file
+      case 3: setValue( data, headerSize + entrySize, getValue( data, headerSize ) ); break;  // keys not sorted
+      case 4: data.resize( headerSize - 1 ); break;                                           // a truncated header
+    }
+    writeCacheFile( data );
+
+    vk::su::ShaderCompiler shaderCompiler( cacheFileName );
+    release_assert( shaderCompiler.compile( vk::ShaderStageFlagBits::eVertex, vertexShaderText_PC_C ) == vertexSPV );
+    release_assert( shaderCompiler.compile( vk::ShaderStageFlagBits::eFragment, fragmentShaderText_C_C ) == fragmentSPV );
+    release_assert( ( shaderCompiler.cacheHits() == 0 ) && ( shaderCompiler.cacheMisses() == 2 ) );
+    release_assert( shaderCompiler.flush() && ( readCacheFile() == validData ) );
+  }
+
+  std::remove( cacheFileName.c_str() );
+  return 0;
+}
@@ -170,6 +170,19 @@ int main()
 
     dci2.unlink<vk::DevicePrivateDataCreateInfoEXT, 1>();
     dci2.relink<vk::DevicePrivateDataCreateInfoEXT, 1>();
+    release_assert( &dpdci == &std::get<2>( dci0 ) );
+
+    // the chain validation, on the recursive C++11 helpers as well as on the C++17 fold expressions
+    static_assert( vk::StructureChainValidation<2, vk::DeviceCreateInfo, vk::DevicePrivateDataCreateInfoEXT, vk::DevicePrivateDataCreateInfoEXT>::valid,
+                   "duplicates are allowed" );
+    static_assert( !vk::StructureChainValidation<2,
+                                                 vk::PhysicalDeviceFeatures2,
+                                                 vk::PhysicalDeviceVariablePointerFeatures,
+                                                 vk::PhysicalDeviceVariablePointerFeatures>::valid,
+                   "duplicates are not allowed" );
+    static_assert( !vk::StructureChainValidation<1, vk::PhysicalDeviceFeatures2, vk::DevicePrivateDataCreateInfoEXT>::valid, "does not extend the head" );
+    static_assert( vk::IsPartOfStructureChain<vk::ValidationFlagsEXT, vk::InstanceCreateInfo, vk::ValidationFlagsEXT>::valid, "part of the chain" );
+    static_assert( !vk::IsPartOfStructureChain<vk::ValidationFeaturesEXT, vk::InstanceCreateInfo, vk::ValidationFlagsEXT>::valid, "not part of the chain" );
 
     vk::StructureChain<vk::InstanceCreateInfo,
                        vk::DebugReportCallbackCreateInfoEXT,
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Tests : SubmitBatcher
+//                   Runtime test on the merging of submissions by vk::raii::su::SubmitBatcher, running on the null driver with a
+//                   recording vkQueueSubmit2
+
+#if !defined( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC )
+#  define VULKAN_HPP_DISPATCH_LOADER_DYNAMIC 1
+#endif
+
+#include "../../RAII_Samples/utils/submitBatcher.hpp"
+#include "../null_driver_fixture.hpp"
+
+#include <vector>
+
+namespace fake
+{
+  struct Batch
+  {
+    std::vector<VkSemaphore>     waits;
+    std::vector<VkCommandBuffer> commandBuffers;
+    std::vector<VkSemaphore>     signals;
+  };
+
+  std::vector<Batch> batches;
+
+  VKAPI_ATTR VkResult VKAPI_CALL queueSubmit2( VkQueue, uint32_t submitCount, VkSubmitInfo2 const * pSubmits, VkFence )
+  {
+    batches.clear();
+    for ( uint32_t i = 0; i < submitCount; ++i )
+    {
+      Batch batch;
+      for ( uint32_t j = 0; j < pSubmits[i].waitSemaphoreInfoCount; ++j )
+      {
+        batch.waits.push_back( pSubmits[i].pWaitSemaphoreInfos[j].semaphore );
+      }
+      for ( uint32_t j = 0; j < pSubmits[i].commandBufferInfoCount; ++j )
+      {
+        batch.commandBuffers.push_back( pSubmits[i].pCommandBufferInfos[j].commandBuffer );
+      }
+      for ( uint32_t j = 0; j < pSubmits[i].signalSemaphoreInfoCount; ++j )
+      {
+        batch.signals.push_back( pSubmits[i].pSignalSemaphoreInfos[j].semaphore );
+      }
+      batches.push_back( batch );
+    }
+    return VK_SUCCESS;
+  }
+}  // namespace fake
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  fixture::addOverride( "vkQueueSubmit2", &fake::queueSubmit2 );
+
+  fixture::NullDevice nullDevice;
+
+  VkCommandBuffer             commandBuffers[4] = { vk::detail::NullDriver::nextHandle<VkCommandBuffer>(),
+                                                    vk::detail::NullDriver::nextHandle<VkCommandBuffer>(),
+                                                    vk::detail::NullDriver::nextHandle<VkCommandBuffer>(),
+                                                    vk::detail::NullDriver::nextHandle<VkCommandBuffer>() };
+  VkSemaphore                 semaphore0        = vk::detail::NullDriver::nextHandle<VkSemaphore>();
+  VkSemaphore                 semaphore1        = vk::detail::NullDriver::nextHandle<VkSemaphore>();
+  vk::SemaphoreSubmitInfo     wait0( semaphore0, 1, vk::PipelineStageFlagBits2::eAllCommands );
+  vk::SemaphoreSubmitInfo     wait1( semaphore1, 1, vk::PipelineStageFlagBits2::eAllCommands );
+  vk::raii::su::SubmitBatcher batcher( nullDevice.queue, 2 );
+
+  // submissions without any semaphores end up in one batch, even across threads
+  batcher.enqueue( 0, commandBuffers[0] );
+  batcher.enqueue( 1, commandBuffers[1] );
+  batcher.enqueue( 0, commandBuffers[2] );
+  release_assert( batcher.flush() == 1 );
+  release_assert( ( fake::batches.size() == 1 ) && ( fake::batches[0].commandBuffers.size() == 3 ) );
+  release_assert( ( fake::batches[0].commandBuffers[0] == commandBuffers[0] ) && ( fake::batches[0].commandBuffers[1] == commandBuffers[1] ) &&
+                  ( fake::batches[0].commandBuffers[2] == commandBuffers[2] ) );
+
+  // a submission with waits can't be merged into a batch that already has command buffers
+  batcher.enqueue( 0, commandBuffers[0] );
+  batcher.enqueue( 0, vk::CommandBufferSubmitInfo( commandBuffers[1] ), wait0 );
+  release_assert( batcher.flush() == 2 );
+  release_assert( fake::batches[0].waits.empty() && ( fake::batches[1].waits.size() == 1 ) && ( fake::batches[1].commandBuffers[0] == commandBuffers[1] ) );
+
+  // a submission without waits can't be merged into a batch that has waits, or it would wait for them as well
+  batcher.enqueue( 0, vk::CommandBufferSubmitInfo( commandBuffers[0] ), wait0 );
+  batcher.enqueue( 1, commandBuffers[1] );
+  release_assert( batcher.flush() == 2 );
+  release_assert( ( fake::batches[0].waits.size() == 1 ) && ( fake::batches[0].waits[0] == semaphore0 ) );
+  release_assert( fake::batches[1].waits.empty() && ( fake::batches[1].commandBuffers.size() == 1 ) &&
+                  ( fake::batches[1].commandBuffers[0] == commandBuffers[1] ) );
+
+  // neither can a submission with different waits
+  batcher.enqueue( 0, vk::CommandBufferSubmitInfo( commandBuffers[0] ), wait0 );
+  batcher.enqueue( 1, vk::CommandBufferSubmitInfo( commandBuffers[1] ), wait1 );
+  release_assert( batcher.flush() == 2 );
+  release_assert( ( fake::batches[0].waits.size() == 1 ) && ( fake::batches[0].waits[0] == semaphore0 ) );
+  release_assert( ( fake::batches[1].waits.size() == 1 ) && ( fake::batches[1].waits[0] == semaphore1 ) );
+
+  // but identical waits are merged, and waited on just once
+  batcher.enqueue( 0, vk::CommandBufferSubmitInfo( commandBuffers[0] ), wait0 );
+  batcher.enqueue( 1, vk::CommandBufferSubmitInfo( commandBuffers[1] ), wait0 );
+  release_assert( batcher.flush() == 1 );
+  release_assert( ( fake::batches[0].waits.size() == 1 ) && ( fake::batches[0].commandBuffers.size() == 2 ) );
+
+  // a submission with waits and no command buffers just starts the batch
+  batcher.enqueue( 0, nullptr, wait0 );
+  batcher.enqueue( 0, commandBuffers[1] );
+  release_assert( batcher.flush() == 2 );
+  release_assert( fake::batches[0].commandBuffers.empty() && fake::batches[1].waits.empty() );
+
+  // anything following a signal starts a new batch
+  vk::SemaphoreSubmitInfo signal1( semaphore1, 2, vk::PipelineStageFlagBits2::eAllCommands );
+  batcher.enqueue( 0, vk::CommandBufferSubmitInfo( commandBuffers[0] ), nullptr, signal1 );
+  batcher.enqueue( 0, commandBuffers[1] );
+  batcher.enqueue( 1, vk::CommandBufferSubmitInfo( commandBuffers[2] ), nullptr, signal1 );
+  batcher.enqueue( 1, commandBuffers[3] );
+  release_assert( batcher.flush() == 3 );
+  release_assert( ( fake::batches[0].signals.size() == 1 ) && ( fake::batches[1].commandBuffers.size() == 2 ) && ( fake::batches[1].signals.size() == 1 ) );
+  release_assert( fake::batches[2].signals.empty() && ( fake::batches[2].commandBuffers[0] == commandBuffers[3] ) );
+
+  return 0;
+}
@@ -0,0 +1,284 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+// VulkanHpp Tests : UploadEngine
+//                   Runtime test on the staging ring of vk::su::UploadEngine, running on the null driver with a fake queue that executes the
+//                   recorded copies out of the mapped ring when their fence is waited for
+
+#include "../../samples/utils/uploadEngine.hpp"
+#include "../null_driver_fixture.hpp"
+
+#include <deque>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+namespace fake
+{
+  struct Copy
+  {
+    VkBuffer     dstBuffer;
+    VkImage      dstImage;
+    VkDeviceSize srcOffset;
+    VkDeviceSize dstOffset;
+    VkDeviceSize size;
+  };
+
+  struct Submission
+  {
+    VkFence           fence;
+    std::vector<Copy> copies;
+  };
+
+  std::map<VkCommandBuffer, std::vector<Copy>> recordedCopies;
+  std::deque<Submission>                       submissions;  // submitted, but not yet executed
+  std::map<VkBuffer, std::vector<uint8_t>>     buffers;      // the contents of the destination buffers and images
+  std::map<VkImage, std::vector<uint8_t>>      images;
+  std::set<VkFence>                            signaledFences;
+  uint32_t                                     waitCount       = 0;
+  uint32_t                                     aliveFenceCount = 0;
+  bool                                         deviceLost      = false;
+
+  uint8_t const * ring()
+  {
+    return static_cast<uint8_t const *>( vk::detail::NullDriver::mappedMemory() );
+  }
+
+  std::vector<uint8_t> & destination( Copy const & copy )
+  {
+    std::vector<uint8_t> & data = copy.dstBuffer ? buffers[copy.dstBuffer] : images[copy.dstImage];
+    if ( data.size() < copy.dstOffset + copy.size )
+    {
+      data.resize( static_cast<size_t>( copy.dstOffset + copy.size ) );
+    }
+    return data;
+  }
+
+  // lets the "device" execute the oldest submission
+  void executeOldest()
+  {
+    for ( auto const & copy : submissions.front().copies )
+    {
+      memcpy( destination( copy ).data() + copy.dstOffset, ring() + copy.srcOffset, static_cast<size_t>( copy.size ) );
+    }
+    signaledFences.insert( submissions.front().fence );
+    submissions.pop_front();
+  }
+
+  void executeAll()
+  {
+    while ( !submissions.empty() )
+    {
+      executeOldest();
+    }
+  }
+
+  // buffers need to be placed into host visible memory, for the staging ring
+  VKAPI_ATTR void VKAPI_CALL getBufferMemoryRequirements( VkDevice, VkBuffer, VkMemoryRequirements * pMemoryRequirements )
+  {
+    *pMemoryRequirements = { 1 << 20, 256, 0x3 };
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL beginCommandBuffer( VkCommandBuffer commandBuffer, VkCommandBufferBeginInfo const * )
+  {
+    recordedCopies[commandBuffer].clear();
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL
+    cmdCopyBuffer( VkCommandBuffer commandBuffer, VkBuffer, VkBuffer dstBuffer, uint32_t regionCount, VkBufferCopy const * pRegions )
+  {
+    for ( uint32_t i = 0; i < regionCount; ++i )
+    {
+      recordedCopies[commandBuffer].push_back( { dstBuffer, VK_NULL_HANDLE, pRegions[i].srcOffset, pRegions[i].dstOffset, pRegions[i].size } );
+    }
+  }
+
+  // the texels are tightly packed, with 4 bytes each
+  VKAPI_ATTR void VKAPI_CALL cmdCopyBufferToImage(
+    VkCommandBuffer commandBuffer, VkBuffer, VkImage dstImage, VkImageLayout, uint32_t regionCount, VkBufferImageCopy const * pRegions )
+  {
+    for ( uint32_t i = 0; i < regionCount; ++i )
+    {
+      VkDeviceSize size = VkDeviceSize( pRegions[i].imageExtent.width ) * pRegions[i].imageExtent.height * 4;
+      recordedCopies[commandBuffer].push_back( { VK_NULL_HANDLE, dstImage, pRegions[i].bufferOffset, 0, size } );
+    }
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL queueSubmit( VkQueue, uint32_t submitCount, VkSubmitInfo const * pSubmits, VkFence fence )
+  {
+    Submission submission = { fence, {} };
+    for ( uint32_t i = 0; i < submitCount; ++i )
+    {
+      for ( uint32_t j = 0; j < pSubmits[i].commandBufferCount; ++j )
+      {
+        std::vector<Copy> const & copies = recordedCopies[pSubmits[i].pCommandBuffers[j]];
+        submission.copies.insert( submission.copies.end(), copies.begin(), copies.end() );
+      }
+    }
+    submissions.push_back( submission );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL createFence( VkDevice, VkFenceCreateInfo const *, VkAllocationCallbacks const *, VkFence * pFence )
+  {
+    *pFence = vk::detail::NullDriver::nextHandle<VkFence>();
+    ++aliveFenceCount;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL destroyFence( VkDevice, VkFence fence, VkAllocationCallbacks const * )
+  {
+    release_assert( fence && aliveFenceCount );
+    --aliveFenceCount;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL resetFences( VkDevice, uint32_t count, VkFence const * pFences )
+  {
+    for ( uint32_t i = 0; i < count; ++i )
+    {
+      signaledFences.erase( pFences[i] );
+    }
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL getFenceStatus( VkDevice, VkFence fence )
+  {
+    return ( signaledFences.find( fence ) != signaledFences.end() ) ? VK_SUCCESS : VK_NOT_READY;
+  }
+
+  // waiting for a fence executes all the submissions up to the one signaling it
+  VKAPI_ATTR VkResult VKAPI_CALL waitForFences( VkDevice, uint32_t count, VkFence const * pFences, VkBool32, uint64_t )
+  {
+    ++waitCount;
+    if ( deviceLost )
+    {
+      return VK_ERROR_DEVICE_LOST;
+    }
+    release_assert( count == 1 );
+    while ( signaledFences.find( pFences[0] ) == signaledFences.end() )
+    {
+      executeOldest();
+    }
+    return VK_SUCCESS;
+  }
+
+  void install()
+  {
+    fixture::addOverride( "vkGetPhysicalDeviceMemoryProperties", &fixture::getPhysicalDeviceMemoryProperties );
+    fixture::addOverride( "vkGetBufferMemoryRequirements", &getBufferMemoryRequirements );
+    fixture::addOverride( "vkBeginCommandBuffer", &beginCommandBuffer );
+    fixture::addOverride( "vkCmdCopyBuffer", &cmdCopyBuffer );
+    fixture::addOverride( "vkCmdCopyBufferToImage", &cmdCopyBufferToImage );
+    fixture::addOverride( "vkQueueSubmit", &queueSubmit );
+    fixture::addOverride( "vkCreateFence", &createFence );
+    fixture::addOverride( "vkDestroyFence", &destroyFence );
+    fixture::addOverride( "vkResetFences", &resetFences );
+    fixture::addOverride( "vkGetFenceStatus", &getFenceStatus );
+    fixture::addOverride( "vkWaitForFences", &waitForFences );
+  }
+}  // namespace fake
+
+std::vector<uint8_t> makeData( size_t size, uint8_t seed )
+{
+  std::vector<uint8_t> data( size );
+  for ( size_t i = 0; i < size; ++i )
+  {
+    data[i] = static_cast<uint8_t>( seed + i * 7 );
+  }
+  return data;
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  fake::install();
+
+  fixture::NullDevice nullDevice;
+  vk::detail::defaultDispatchLoaderDynamic.init( &vk::detail::NullDriver::getInstanceProcAddr );
+  vk::detail::defaultDispatchLoaderDynamic.init( *nullDevice.instance );
+  vk::detail::defaultDispatchLoaderDynamic.init( *nullDevice.device );
+
+  vk::Buffer bufferA( vk::detail::NullDriver::nextHandle<VkBuffer>() );
+  vk::Buffer bufferB( vk::detail::NullDriver::nextHandle<VkBuffer>() );
+  vk::Buffer bufferC( vk::detail::NullDriver::nextHandle<VkBuffer>() );
+  vk::Image  image( vk::detail::NullDriver::nextHandle<VkImage>() );
+
+  std::vector<uint8_t> const dataA = makeData( 300, 1 );
+  std::vector<uint8_t> const dataB = makeData( 600, 2 );
+  std::vector<uint8_t> const dataC = makeData( 200, 3 );
+
+  {
+    // a ring of 1024 bytes, with the copy offsets aligned to 4 bytes
+    vk::su::UploadEngine uploadEngine( *nullDevice.physicalDevices[0], *nullDevice.device, 0, *nullDevice.queue, 1024 );
+
+    // nothing is submitted before a flush
+    uploadEngine.uploadBuffer( bufferA, 0, dataA.data(), dataA.size() );
+    release_assert( fake::submissions.empty() );
+    uint64_t batchA = uploadEngine.flush();
+    release_assert( ( fake::submissions.size() == 1 ) && ( fake::submissions[0].copies.size() == 1 ) && !uploadEngine.isComplete( batchA ) );
+
+    // an upload larger than half the ring is split into chunks, into ring offsets 300 and 812
+    uploadEngine.uploadBuffer( bufferB, 100, dataB.data(), dataB.size() );
+    uint64_t batchB = uploadEngine.flush();
+    release_assert( fake::submissions.size() == 2 );
+    std::vector<fake::Copy> const & copiesB = fake::submissions[1].copies;
+    release_assert( ( copiesB.size() == 2 ) && ( copiesB[0].srcOffset == 300 ) && ( copiesB[0].dstOffset == 100 ) && ( copiesB[0].size == 512 ) );
+    release_assert( ( copiesB[1].srcOffset == 812 ) && ( copiesB[1].dstOffset == 612 ) && ( copiesB[1].size == 88 ) );
+
+    // the next upload doesn't fit in front of the end of the ring, and wraps around to its beginning; the batch of bufferA still occupies
+    // that space, so it's waited for, but the batch of bufferB is not
+    release_assert( fake::waitCount == 0 );
+    uploadEngine.uploadBuffer( bufferC, 0, dataC.data(), dataC.size() );
+    release_assert( ( fake::waitCount == 1 ) && ( fake::submissions.size() == 1 ) );
+    release_assert( uploadEngine.isComplete( batchA ) && !uploadEngine.isComplete( batchB ) );
+    release_assert( fake::buffers[bufferA] == dataA );
+    uint64_t batchC = uploadEngine.flush();
+    release_assert( fake::submissions[1].copies[0].srcOffset == 0 );
+
+    // batches completed by the device on their own are reclaimed without waiting, and their fences are reused
+    fake::executeAll();
+    release_assert( uploadEngine.isComplete( batchC ) && ( fake::waitCount == 1 ) );
+    release_assert( std::vector<uint8_t>( fake::buffers[bufferB].begin() + 100, fake::buffers[bufferB].end() ) == dataB );
+    release_assert( fake::buffers[bufferC] == dataC );
+    uint32_t fenceCount = fake::aliveFenceCount;
+    uploadEngine.uploadBuffer( bufferA, 0, dataC.data(), dataC.size() );
+    release_assert( ( uploadEngine.flush() == batchC + 1 ) && ( fake::aliveFenceCount == fenceCount ) );
+
+    // an image of 8 x 8 texels, right behind the previous upload
+    std::vector<uint8_t> const texels = makeData( 8 * 8 * 4, 4 );
+    uploadEngine.uploadImage( image, vk::Format::eR8G8B8A8Unorm, vk::Extent2D( 8, 8 ), texels.data(), texels.size() );
+    uploadEngine.waitIdle();
+    release_assert( fake::submissions.empty() && ( fake::images[image] == texels ) );
+
+    // an image larger than the ring can't ever be uploaded, and nothing is left pending
+    std::vector<uint8_t> const largeTexels = makeData( 32 * 32 * 4, 5 );
+    bool                       caught      = false;
+    try
+    {
+      uploadEngine.uploadImage( image, vk::Format::eR8G8B8A8Unorm, vk::Extent2D( 32, 32 ), largeTexels.data(), largeTexels.size() );
+    }
+    catch ( std::runtime_error const & )
+    {
+      caught = true;
+    }
+    release_assert( caught && ( uploadEngine.flush() == batchC + 2 ) && fake::submissions.empty() );
+
+    // an image just as large as the ring fits
+    std::vector<uint8_t> const ringTexels = makeData( 16 * 16 * 4, 6 );
+    uploadEngine.uploadImage( image, vk::Format::eR8G8B8A8Unorm, vk::Extent2D( 16, 16 ), ringTexels.data(), ringTexels.size() );
+    uploadEngine.waitIdle();
+    release_assert( fake::images[image] == ringTexels );
+  }
+  release_assert( fake::aliveFenceCount == 0 );
+
+  {
+    // losing the device while uploads are pending doesn't keep the UploadEngine from being destroyed
+    vk::su::UploadEngine uploadEngine( *nullDevice.physicalDevices[0], *nullDevice.device, 0, *nullDevice.queue, 1024 );
+    uploadEngine.uploadBuffer( bufferA, 0, dataA.data(), dataA.size() );
+    fake::deviceLost = true;
+  }
+  release_assert( fake::aliveFenceCount == 0 );
+
+  return 0;
+}
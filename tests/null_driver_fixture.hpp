@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: 2026 NVIDIA CORPORATION
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// The setup shared by the tests and benchmarks running on vk::detail::NullDriver: a device with one queue and a command buffer, and
+// the fakes needed by more than one of them. Each test adds its own fakes by addOverride(), before constructing the NullDevice.
+
+#if !defined( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC )
+#  define VULKAN_HPP_DISPATCH_LOADER_DYNAMIC 1
+#endif
+
+#include "test_macros.hpp"
+
+#include <cstring>
+#include <map>
+#include <utility>
+#include <vector>
+#include <vulkan/vulkan_null_driver.hpp>
+#include <vulkan/vulkan_raii.hpp>
+
+namespace fixture
+{
+  template <typename Function>
+  void addOverride( char const * name, Function * function )
+  {
+    vk::detail::NullDriver::configuration().overrides.emplace_back( name, reinterpret_cast<PFN_vkVoidFunction>( function ) );
+  }
+
+  // the instance, physical device, device, and queue of family 0 on the null driver, plus a primary command buffer to record into
+  struct NullDevice
+  {
+    NullDevice()
+      : context( &vk::detail::NullDriver::getInstanceProcAddr )
+      , instance( context, vk::InstanceCreateInfo() )
+      , physicalDevices( instance )
+      , device( createDevice( physicalDevices[0] ) )
+      , queue( device, 0, 0 )
+      , commandPool( device, vk::CommandPoolCreateInfo( {}, 0 ) )
+      , commandBuffer(
+          std::move( vk::raii::CommandBuffers( device, vk::CommandBufferAllocateInfo( *commandPool, vk::CommandBufferLevel::ePrimary, 1 ) ).front() ) )
+    {
+    }
+
+    static vk::raii::Device createDevice( vk::raii::PhysicalDevice const & physicalDevice )
+    {
+      float                     queuePriority = 0.0f;
+      vk::DeviceQueueCreateInfo deviceQueueCreateInfo( {}, 0, 1, &queuePriority );
+      return vk::raii::Device( physicalDevice, vk::DeviceCreateInfo( {}, deviceQueueCreateInfo ) );
+    }
+
+    vk::raii::Context         context;
+    vk::raii::Instance        instance;
+    vk::raii::PhysicalDevices physicalDevices;
+    vk::raii::Device          device;
+    vk::raii::Queue           queue;
+    vk::raii::CommandPool     commandPool;
+    vk::raii::CommandBuffer   commandBuffer;
+  };
+
+  // one device local heap of 8 GiB, and one host visible heap of 256 MiB
+  inline VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceMemoryProperties( VkPhysicalDevice, VkPhysicalDeviceMemoryProperties * pMemoryProperties )
+  {
+    memset( pMemoryProperties, 0, sizeof( VkPhysicalDeviceMemoryProperties ) );
+    pMemoryProperties->memoryTypeCount = 2;
+    pMemoryProperties->memoryTypes[0]  = { VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0 };
+    pMemoryProperties->memoryTypes[1]  = { VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 1 };
+    pMemoryProperties->memoryHeapCount = 2;
+    pMemoryProperties->memoryHeaps[0]  = { 8ull * 1024 * 1024 * 1024, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT };
+    pMemoryProperties->memoryHeaps[1]  = { 256ull * 1024 * 1024, 0 };
+  }
+
+  // the results of the queries of all query pools, to be written by the fakes of the commands writing queries; a query not listed is
+  // unavailable
+  struct Query
+  {
+    std::vector<uint64_t>  values;
+    bool                   available = false;
+    VkQueryResultStatusKHR status    = VK_QUERY_RESULT_STATUS_COMPLETE_KHR;  // reported with VK_QUERY_RESULT_WITH_STATUS_BIT_KHR
+  };
+
+  inline std::map<std::pair<VkQueryPool, uint32_t>, Query> & queries()
+  {
+    static std::map<std::pair<VkQueryPool, uint32_t>, Query> queries;
+    return queries;
+  }
+
+  inline void resetQueries( VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount )
+  {
+    for ( uint32_t i = firstQuery; i < firstQuery + queryCount; ++i )
+    {
+      queries().erase( std::make_pair( queryPool, i ) );
+    }
+  }
+
+  inline VKAPI_ATTR void VKAPI_CALL resetQueryPool( VkDevice, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount )
+  {
+    resetQueries( queryPool, firstQuery, queryCount );
+  }
+
+  struct QueryPoolResultsCall
+  {
+    size_t             dataSize = 0;
+    VkDeviceSize       stride   = 0;
+    VkQueryResultFlags flags    = 0;
+  };
+
+  inline QueryPoolResultsCall & lastQueryPoolResultsCall()
+  {
+    static QueryPoolResultsCall queryPoolResultsCall;
+    return queryPoolResultsCall;
+  }
+
+  template <typename WordType>
+  VkResult writeQueryResults( VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, void * pData, VkDeviceSize stride, VkQueryResultFlags flags )
+  {
+    bool     withAvailability = ( flags & ( VK_QUERY_RESULT_WITH_AVAILABILITY_BIT | VK_QUERY_RESULT_WITH_STATUS_BIT_KHR ) ) != 0;
+    size_t   valueCount       = static_cast<size_t>( stride ) / sizeof( WordType ) - ( withAvailability ? 1 : 0 );
+    VkResult result           = VK_SUCCESS;
+    for ( uint32_t i = 0; i < queryCount; ++i )
+    {
+      auto       it        = queries().find( std::make_pair( queryPool, firstQuery + i ) );
+      bool       available = ( it != queries().end() ) && it->second.available;
+      WordType * pWords    = reinterpret_cast<WordType *>( static_cast<uint8_t *>( pData ) + i * stride );
+      if ( available )
+      {
+        for ( size_t j = 0; j < valueCount; ++j )
+        {
+          pWords[j] = static_cast<WordType>( ( j < it->second.values.size() ) ? it->second.values[j] : 0 );
+        }
+      }
+      else
+      {
+        // without VK_QUERY_RESULT_PARTIAL_BIT, the values of an unavailable query are not written
+        result = VK_NOT_READY;
+      }
+      if ( flags & VK_QUERY_RESULT_WITH_STATUS_BIT_KHR )
+      {
+        pWords[valueCount] = static_cast<WordType>( available ? it->second.status : VK_QUERY_RESULT_STATUS_NOT_READY_KHR );
+      }
+      else if ( withAvailability )
+      {
+        pWords[valueCount] = available ? 1 : 0;
+      }
+    }
+    return result;
+  }
+
+  inline VKAPI_ATTR VkResult VKAPI_CALL getQueryPoolResults(
+    VkDevice, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void * pData, VkDeviceSize stride, VkQueryResultFlags flags )
+  {
+    release_assert( queryCount * stride <= dataSize );
+    lastQueryPoolResultsCall().dataSize = dataSize;
+    lastQueryPoolResultsCall().stride   = stride;
+    lastQueryPoolResultsCall().flags    = flags;
+    return ( flags & VK_QUERY_RESULT_64_BIT ) ? writeQueryResults<uint64_t>( queryPool, firstQuery, queryCount, pData, stride, flags )
+                                              : writeQueryResults<uint32_t>( queryPool, firstQuery, queryCount, pData, stride, flags );
+  }
+}  // namespace fixture
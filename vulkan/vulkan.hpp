@@ -34,6 +34,14 @@
 #  if defined( VULKAN_HPP_SUPPORT_SPAN )
 #    include <span>
 #  endif
+#  if defined( VULKAN_HPP_ENABLE_INSTRUMENTING_DISPATCHER )
+#    include <atomic>
+#    include <chrono>
+#    include <vector>
+#    if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#      include <intrin.h>  // __rdtsc
+#    endif
+#  endif
 #endif
 
 VULKAN_HPP_STATIC_ASSERT( VK_HEADER_VERSION == 360, "Wrong VK_HEADER_VERSION!" );
@@ -47,6 +55,13 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 #if !defined( VULKAN_HPP_DEFAULT_DISPATCHER_HANDLED ) && VULKAN_HPP_DISPATCH_LOADER_DYNAMIC == 1
     extern VULKAN_HPP_STORAGE_API DispatchLoaderDynamic defaultDispatchLoaderDynamic;
 #endif
+
+#if defined( VULKAN_HPP_ENABLE_INSTRUMENTING_DISPATCHER )
+    template <typename Inner>
+    class InstrumentingDispatcher;
+
+    extern VULKAN_HPP_STORAGE_API InstrumentingDispatcher<DispatchLoaderDynamic> defaultInstrumentingDispatcher;
+#endif
   }  // namespace detail
 }  // namespace VULKAN_HPP_NAMESPACE
 
@@ -87,6 +102,18 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
     VULKAN_HPP_CONSTEXPR ArrayWrapper1D( std::array<T, N> const & data ) VULKAN_HPP_NOEXCEPT : std::array<T, N>( data ) {}
 
+    // allows brace initialization like a plain array, including within designated initializers; char arrays are initialized by strings instead
+    template <typename B = T, typename std::enable_if<!std::is_same<B, char>::value, int>::type = 0>
+    VULKAN_HPP_CONSTEXPR_14 ArrayWrapper1D( std::initializer_list<T> data ) VULKAN_HPP_NOEXCEPT : std::array<T, N>()
+    {
+      VULKAN_HPP_ASSERT( data.size() <= N );
+      size_t i = 0;
+      for ( auto it = data.begin(); ( it != data.end() ) && ( i < N ); ++it, ++i )
+      {
+        ( *this )[i] = *it;
+      }
+    }
+
     template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
     VULKAN_HPP_CONSTEXPR_14 ArrayWrapper1D( std::string const & data ) VULKAN_HPP_NOEXCEPT
     {
@@ -295,6 +322,17 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       : std::array<ArrayWrapper1D<T, M>, N>( *reinterpret_cast<std::array<ArrayWrapper1D<T, M>, N> const *>( &data ) )
     {
     }
+
+    // allows brace initialization like a plain two-dimensional array, including within designated initializers
+    VULKAN_HPP_CONSTEXPR_14 ArrayWrapper2D( std::initializer_list<ArrayWrapper1D<T, M>> data ) VULKAN_HPP_NOEXCEPT : std::array<ArrayWrapper1D<T, M>, N>()
+    {
+      VULKAN_HPP_ASSERT( data.size() <= N );
+      size_t i = 0;
+      for ( auto it = data.begin(); ( it != data.end() ) && ( i < N ); ++it, ++i )
+      {
+        ( *this )[i] = *it;
+      }
+    }
   };
 
 #if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
@@ -618,6 +656,70 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     };
   };
 
+#  if 17 <= VULKAN_HPP_CPP_VERSION
+  // With C++17, the StructureChain helpers are built on fold expressions and constexpr index tables, instead of recursing over std::tuple_element.
+  // That keeps the number of template instantiations linear in the chain length, and shares them between all the get<T>() of a chain.
+  namespace detail
+  {
+    // the index of the Which-th occurrence of T in ChainElements, or sizeof...( ChainElements ) if there is no such element
+    template <typename T, size_t Which, typename... ChainElements>
+    constexpr size_t structureChainElementIndex()
+    {
+      constexpr bool isSame[] = { std::is_same_v<T, ChainElements>... };
+      size_t         count    = 0;
+      for ( size_t i = 0; i < sizeof...( ChainElements ); ++i )
+      {
+        if ( isSame[i] && ( count++ == Which ) )
+        {
+          return i;
+        }
+      }
+      return sizeof...( ChainElements );
+    }
+
+    // checks the first Index elements following Head: they need to extend Head, and they must not occur more than once, unless allowed
+    template <size_t Index, typename Head, typename... Tail>
+    constexpr bool isValidStructureChain()
+    {
+      if constexpr ( sizeof...( Tail ) == 0 )
+      {
+        return true;
+      }
+      else
+      {
+        constexpr bool   extendsHead[]    = { bool( StructExtends<Tail, Head>::value )... };
+        constexpr bool   allowDuplicate[] = { Tail::allowDuplicate... };
+        constexpr size_t firstIndex[]     = { structureChainElementIndex<Tail, 0, Head, Tail...>()... };
+        for ( size_t i = 0; i < Index; ++i )
+        {
+          if ( !extendsHead[i] || ( !allowDuplicate[i] && ( firstIndex[i] != i + 1 ) ) )
+          {
+            return false;
+          }
+        }
+        return true;
+      }
+    }
+  }  // namespace detail
+
+  template <typename Type, typename... ChainElements>
+  struct IsPartOfStructureChain
+  {
+    static bool const valid = ( std::is_same_v<Type, ChainElements> || ... );
+  };
+
+  template <size_t Index, typename T, typename... ChainElements>
+  struct StructureChainContains
+  {
+    static bool const value = detail::structureChainElementIndex<T, 0, ChainElements...>() <= Index;
+  };
+
+  template <size_t Index, typename... ChainElements>
+  struct StructureChainValidation
+  {
+    static bool const valid = detail::isValidStructureChain<Index, ChainElements...>();
+  };
+#  else
   template <typename Type, class...>
   struct IsPartOfStructureChain
   {
@@ -657,6 +759,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
   {
     static bool const valid = true;
   };
+#  endif
 
   template <typename... ChainElements>
   class StructureChain : public std::tuple<ChainElements...>
@@ -823,6 +926,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     }
 
   private:
+#  if 17 <= VULKAN_HPP_CPP_VERSION
+    template <int Index, typename T, int Which, typename, class... Types>
+    struct ChainElementIndex : std::integral_constant<int, Index + static_cast<int>( detail::structureChainElementIndex<T, Which, Types...>() )>
+    {
+      VULKAN_HPP_STATIC_ASSERT( detail::structureChainElementIndex<T, Which, Types...>() < sizeof...( Types ),
+                                "Can't get Structure that's not part of this StructureChain!" );
+    };
+#  else
     template <int Index, typename T, int Which, typename, class First, class... Types>
     struct ChainElementIndex : ChainElementIndex<Index + 1, T, Which, void, Types...>
     {
@@ -845,6 +956,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       : std::integral_constant<int, Index>
     {
     };
+#  endif
 
     VULKAN_HPP_NODISCARD bool isLinked( VkBaseInStructure const * pNext ) const VULKAN_HPP_NOEXCEPT
     {
@@ -8965,7 +9077,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
   namespace detail
   {
-    [[noreturn]] VULKAN_HPP_INLINE void throwResultException( Result result, char const * message )
+    [[noreturn]] VULKAN_HPP_NOINLINE_COLD void throwResultException( Result result, char const * message )
     {
       switch ( result )
       {
@@ -9106,6 +9218,80 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 #endif
   };
 
+#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
+  // A typed view onto the results of vkGetQueryPoolResults, as written into caller-provided storage: each query gives a DataType,
+  // followed by its availability or status word if eWithAvailability or eWithStatusKHR is set; the words are 64 bit wide if e64 is set.
+  template <typename DataType>
+  class QueryResultView : protected StridedArrayProxy<DataType>
+  {
+  public:
+    QueryResultView( uint32_t count, DataType const * ptr, QueryResultFlags flags ) VULKAN_HPP_NOEXCEPT
+      : StridedArrayProxy<DataType>( count, ptr, queryStride( flags ) )
+      , m_wordSize( wordSize( flags ) )
+      , m_hasAvailability( hasAvailability( flags ) )
+    {
+      VULKAN_HPP_ASSERT( sizeof( DataType ) % m_wordSize == 0 );
+    }
+
+    // the distance between the results of two consecutive queries, as to be passed to vkGetQueryPoolResults
+    static VULKAN_HPP_CONSTEXPR uint32_t queryStride( QueryResultFlags flags ) VULKAN_HPP_NOEXCEPT
+    {
+      return static_cast<uint32_t>( sizeof( DataType ) ) + ( hasAvailability( flags ) ? wordSize( flags ) : 0 );
+    }
+
+    using StridedArrayProxy<DataType>::empty;
+    using StridedArrayProxy<DataType>::size;
+    using StridedArrayProxy<DataType>::data;
+    using StridedArrayProxy<DataType>::stride;
+
+    DataType const & operator[]( uint32_t index ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( index < size() );
+      return *reinterpret_cast<DataType const *>( reinterpret_cast<uint8_t const *>( data() ) + index * stride() );
+    }
+
+    bool hasAvailability() const VULKAN_HPP_NOEXCEPT
+    {
+      return m_hasAvailability;
+    }
+
+    // with eWithAvailability, whether the result of the query at index is available
+    bool isAvailable( uint32_t index ) const VULKAN_HPP_NOEXCEPT
+    {
+      return word( index ) != 0;
+    }
+
+    // with eWithStatusKHR, the status of the query at index
+    QueryResultStatusKHR status( uint32_t index ) const VULKAN_HPP_NOEXCEPT
+    {
+      return static_cast<QueryResultStatusKHR>( word( index ) );
+    }
+
+  private:
+    static VULKAN_HPP_CONSTEXPR uint32_t wordSize( QueryResultFlags flags ) VULKAN_HPP_NOEXCEPT
+    {
+      return ( flags & QueryResultFlagBits::e64 ) ? 8 : 4;
+    }
+
+    static VULKAN_HPP_CONSTEXPR bool hasAvailability( QueryResultFlags flags ) VULKAN_HPP_NOEXCEPT
+    {
+      return !!( flags & ( QueryResultFlagBits::eWithAvailability | QueryResultFlagBits::eWithStatusKHR ) );
+    }
+
+    // the availability or status word following the result of the query at index, sign-extended
+    int64_t word( uint32_t index ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( m_hasAvailability && ( index < size() ) );
+      uint8_t const * pWord = reinterpret_cast<uint8_t const *>( data() ) + index * stride() + sizeof( DataType );
+      return ( m_wordSize == 8 ) ? *reinterpret_cast<int64_t const *>( pWord ) : *reinterpret_cast<int32_t const *>( pWord );
+    }
+
+  private:
+    uint32_t m_wordSize;
+    bool     m_hasAvailability;
+  };
+#endif
+
   namespace detail
   {
     template <typename T>
@@ -9172,6 +9358,52 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
   namespace detail
   {
+    // the success codes of a command are template arguments, such that checking a result needs no loop: the codes in [0, 64) (eSuccess up to
+    // eIncomplete) are folded into a constant mask and checked by a single bit test, the few larger ones of extensions (like eSuboptimalKHR
+    // or eOperationDeferredKHR) are compared one by one; the throwing path is kept out of line in throwResultException
+    template <Result... SuccessCodes>
+    struct SuccessCodeMask;
+
+    template <>
+    struct SuccessCodeMask<>
+    {
+      static const uint64_t value = 0;
+    };
+
+    template <Result SuccessCode, Result... SuccessCodes>
+    struct SuccessCodeMask<SuccessCode, SuccessCodes...>
+    {
+      static const uint64_t value = ( ( static_cast<uint32_t>( SuccessCode ) < 64 ) ? ( uint64_t( 1 ) << ( static_cast<uint32_t>( SuccessCode ) & 63 ) ) : 0 ) |
+                                    SuccessCodeMask<SuccessCodes...>::value;
+    };
+
+    template <Result SuccessCode>
+    VULKAN_HPP_CONSTEXPR bool isLargeSuccessCode( Result result ) VULKAN_HPP_NOEXCEPT
+    {
+      return ( 64 <= static_cast<uint32_t>( SuccessCode ) ) && ( result == SuccessCode );
+    }
+
+    template <Result SuccessCode, Result NextSuccessCode, Result... SuccessCodes>
+    VULKAN_HPP_CONSTEXPR bool isLargeSuccessCode( Result result ) VULKAN_HPP_NOEXCEPT
+    {
+      return isLargeSuccessCode<SuccessCode>( result ) || isLargeSuccessCode<NextSuccessCode, SuccessCodes...>( result );
+    }
+
+    template <Result SuccessCode>
+    VULKAN_HPP_CONSTEXPR bool isSuccessCode( Result result ) VULKAN_HPP_NOEXCEPT
+    {
+      return result == SuccessCode;
+    }
+
+    template <Result SuccessCode, Result NextSuccessCode, Result... SuccessCodes>
+    VULKAN_HPP_CONSTEXPR bool isSuccessCode( Result result ) VULKAN_HPP_NOEXCEPT
+    {
+      // the bit test is done branch-free, with the range check masking its result
+      return ( ( ( SuccessCodeMask<SuccessCode, NextSuccessCode, SuccessCodes...>::value >> ( static_cast<uint32_t>( result ) & 63 ) ) &
+               static_cast<uint64_t>( static_cast<uint32_t>( result ) < 64 ) ) != 0 ) ||
+             isLargeSuccessCode<SuccessCode, NextSuccessCode, SuccessCodes...>( result );
+    }
+
     VULKAN_HPP_INLINE void resultCheck( Result result, char const * message )
     {
 #ifdef VULKAN_HPP_NO_EXCEPTIONS
@@ -9186,15 +9418,15 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 #endif
     }
 
-    VULKAN_HPP_INLINE void resultCheck( Result result, char const * message, std::initializer_list<Result> successCodes )
+    template <Result SuccessCode, Result... SuccessCodes>
+    VULKAN_HPP_INLINE void resultCheck( Result result, char const * message )
     {
 #ifdef VULKAN_HPP_NO_EXCEPTIONS
       ignore( result );  // just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
       ignore( message );
-      ignore( successCodes );  // just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
-      VULKAN_HPP_ASSERT_ON_RESULT( std::find( successCodes.begin(), successCodes.end(), result ) != successCodes.end() );
+      VULKAN_HPP_ASSERT_ON_RESULT( ( isSuccessCode<SuccessCode, SuccessCodes...>( result ) ) );
 #else
-      if ( std::find( successCodes.begin(), successCodes.end(), result ) == successCodes.end() )
+      if ( !isSuccessCode<SuccessCode, SuccessCodes...>( result ) )
       {
         throwResultException( result, message );
       }
@@ -9202,9 +9434,20 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     }
 
     template <typename HandleType, typename AllocatorType, typename Dispatch>
+    VULKAN_HPP_NOINLINE_COLD void destroyPipelines( VkDevice                                       device,
+                                                    std::vector<HandleType, AllocatorType> const & pipelines,
+                                                    AllocationCallbacks const *                    pAllocator,
+                                                    Dispatch const &                               d )
+    {
+      for ( HandleType pipeline : pipelines )
+      {
+        d.vkDestroyPipeline( device, static_cast<VkPipeline>( pipeline ), reinterpret_cast<VkAllocationCallbacks const *>( pAllocator ) );
+      }
+    }
+
+    template <Result SuccessCode, Result... SuccessCodes, typename HandleType, typename AllocatorType, typename Dispatch>
     VULKAN_HPP_INLINE void resultCheck( Result                                         result,
                                         char const *                                   message,
-                                        std::initializer_list<Result>                  successCodes,
                                         VkDevice                                       device,
                                         std::vector<HandleType, AllocatorType> const & pipelines,
                                         AllocationCallbacks const *                    pAllocator,
@@ -9213,19 +9456,15 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 #ifdef VULKAN_HPP_NO_EXCEPTIONS
       ignore( result );  // just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
       ignore( message );
-      ignore( successCodes );  // just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
       ignore( device );
       ignore( pipelines );
       ignore( pAllocator );
       ignore( d );
-      VULKAN_HPP_ASSERT_ON_RESULT( std::find( successCodes.begin(), successCodes.end(), result ) != successCodes.end() );
+      VULKAN_HPP_ASSERT_ON_RESULT( ( isSuccessCode<SuccessCode, SuccessCodes...>( result ) ) );
 #else
-      if ( std::find( successCodes.begin(), successCodes.end(), result ) == successCodes.end() )
+      if ( !isSuccessCode<SuccessCode, SuccessCodes...>( result ) )
       {
-        for ( HandleType pipeline : pipelines )
-        {
-          d.vkDestroyPipeline( device, static_cast<VkPipeline>( pipeline ), reinterpret_cast<VkAllocationCallbacks const *>( pAllocator ) );
-        }
+        destroyPipelines( device, pipelines, pAllocator, d );
         throwResultException( result, message );
       }
 #endif
@@ -27710,6 +27949,3881 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         init( instance, device, dl );
       }
     };
+
+#if defined( VULKAN_HPP_ENABLE_INSTRUMENTING_DISPATCHER )
+    //===============================
+    //=== InstrumentingDispatcher ===
+    //===============================
+
+    VULKAN_HPP_CONSTEXPR_INLINE uint32_t instrumentedCommandCount            = 842;
+    VULKAN_HPP_CONSTEXPR_INLINE uint32_t instrumentationHistogramBucketCount = 32;
+
+    inline char const * const * instrumentedCommandNames() VULKAN_HPP_NOEXCEPT
+    {
+      static char const * const names[instrumentedCommandCount] = {
+        "vkCreateInstance",
+        "vkDestroyInstance",
+        "vkEnumeratePhysicalDevices",
+        "vkGetPhysicalDeviceFeatures",
+        "vkGetPhysicalDeviceFormatProperties",
+        "vkGetPhysicalDeviceImageFormatProperties",
+        "vkGetPhysicalDeviceProperties",
+        "vkGetPhysicalDeviceQueueFamilyProperties",
+        "vkGetPhysicalDeviceMemoryProperties",
+        "vkGetInstanceProcAddr",
+        "vkGetDeviceProcAddr",
+        "vkCreateDevice",
+        "vkDestroyDevice",
+        "vkEnumerateInstanceExtensionProperties",
+        "vkEnumerateDeviceExtensionProperties",
+        "vkEnumerateInstanceLayerProperties",
+        "vkEnumerateDeviceLayerProperties",
+        "vkGetDeviceQueue",
+        "vkQueueSubmit",
+        "vkQueueWaitIdle",
+        "vkDeviceWaitIdle",
+        "vkAllocateMemory",
+        "vkFreeMemory",
+        "vkMapMemory",
+        "vkUnmapMemory",
+        "vkFlushMappedMemoryRanges",
+        "vkInvalidateMappedMemoryRanges",
+        "vkGetDeviceMemoryCommitment",
+        "vkBindBufferMemory",
+        "vkBindImageMemory",
+        "vkGetBufferMemoryRequirements",
+        "vkGetImageMemoryRequirements",
+        "vkGetImageSparseMemoryRequirements",
+        "vkGetPhysicalDeviceSparseImageFormatProperties",
+        "vkQueueBindSparse",
+        "vkCreateFence",
+        "vkDestroyFence",
+        "vkResetFences",
+        "vkGetFenceStatus",
+        "vkWaitForFences",
+        "vkCreateSemaphore",
+        "vkDestroySemaphore",
+        "vkCreateQueryPool",
+        "vkDestroyQueryPool",
+        "vkGetQueryPoolResults",
+        "vkCreateBuffer",
+        "vkDestroyBuffer",
+        "vkCreateImage",
+        "vkDestroyImage",
+        "vkGetImageSubresourceLayout",
+        "vkCreateImageView",
+        "vkDestroyImageView",
+        "vkCreateCommandPool",
+        "vkDestroyCommandPool",
+        "vkResetCommandPool",
+        "vkAllocateCommandBuffers",
+        "vkFreeCommandBuffers",
+        "vkBeginCommandBuffer",
+        "vkEndCommandBuffer",
+        "vkResetCommandBuffer",
+        "vkCmdCopyBuffer",
+        "vkCmdCopyImage",
+        "vkCmdCopyBufferToImage",
+        "vkCmdCopyImageToBuffer",
+        "vkCmdUpdateBuffer",
+        "vkCmdFillBuffer",
+        "vkCmdPipelineBarrier",
+        "vkCmdBeginQuery",
+        "vkCmdEndQuery",
+        "vkCmdResetQueryPool",
+        "vkCmdWriteTimestamp",
+        "vkCmdCopyQueryPoolResults",
+        "vkCmdExecuteCommands",
+        "vkCreateEvent",
+        "vkDestroyEvent",
+        "vkGetEventStatus",
+        "vkSetEvent",
+        "vkResetEvent",
+        "vkCreateBufferView",
+        "vkDestroyBufferView",
+        "vkCreateShaderModule",
+        "vkDestroyShaderModule",
+        "vkCreatePipelineCache",
+        "vkDestroyPipelineCache",
+        "vkGetPipelineCacheData",
+        "vkMergePipelineCaches",
+        "vkCreateComputePipelines",
+        "vkDestroyPipeline",
+        "vkCreatePipelineLayout",
+        "vkDestroyPipelineLayout",
+        "vkCreateSampler",
+        "vkDestroySampler",
+        "vkCreateDescriptorSetLayout",
+        "vkDestroyDescriptorSetLayout",
+        "vkCreateDescriptorPool",
+        "vkDestroyDescriptorPool",
+        "vkResetDescriptorPool",
+        "vkAllocateDescriptorSets",
+        "vkFreeDescriptorSets",
+        "vkUpdateDescriptorSets",
+        "vkCmdBindPipeline",
+        "vkCmdBindDescriptorSets",
+        "vkCmdClearColorImage",
+        "vkCmdDispatch",
+        "vkCmdDispatchIndirect",
+        "vkCmdSetEvent",
+        "vkCmdResetEvent",
+        "vkCmdWaitEvents",
+        "vkCmdPushConstants",
+        "vkCreateGraphicsPipelines",
+        "vkCreateFramebuffer",
+        "vkDestroyFramebuffer",
+        "vkCreateRenderPass",
+        "vkDestroyRenderPass",
+        "vkGetRenderAreaGranularity",
+        "vkCmdSetViewport",
+        "vkCmdSetScissor",
+        "vkCmdSetLineWidth",
+        "vkCmdSetDepthBias",
+        "vkCmdSetBlendConstants",
+        "vkCmdSetDepthBounds",
+        "vkCmdSetStencilCompareMask",
+        "vkCmdSetStencilWriteMask",
+        "vkCmdSetStencilReference",
+        "vkCmdBindIndexBuffer",
+        "vkCmdBindVertexBuffers",
+        "vkCmdDraw",
+        "vkCmdDrawIndexed",
+        "vkCmdDrawIndirect",
+        "vkCmdDrawIndexedIndirect",
+        "vkCmdBlitImage",
+        "vkCmdClearDepthStencilImage",
+        "vkCmdClearAttachments",
+        "vkCmdResolveImage",
+        "vkCmdBeginRenderPass",
+        "vkCmdNextSubpass",
+        "vkCmdEndRenderPass",
+        "vkEnumerateInstanceVersion",
+        "vkBindBufferMemory2",
+        "vkBindImageMemory2",
+        "vkGetDeviceGroupPeerMemoryFeatures",
+        "vkCmdSetDeviceMask",
+        "vkEnumeratePhysicalDeviceGroups",
+        "vkGetImageMemoryRequirements2",
+        "vkGetBufferMemoryRequirements2",
+        "vkGetImageSparseMemoryRequirements2",
+        "vkGetPhysicalDeviceFeatures2",
+        "vkGetPhysicalDeviceProperties2",
+        "vkGetPhysicalDeviceFormatProperties2",
+        "vkGetPhysicalDeviceImageFormatProperties2",
+        "vkGetPhysicalDeviceQueueFamilyProperties2",
+        "vkGetPhysicalDeviceMemoryProperties2",
+        "vkGetPhysicalDeviceSparseImageFormatProperties2",
+        "vkTrimCommandPool",
+        "vkGetDeviceQueue2",
+        "vkGetPhysicalDeviceExternalBufferProperties",
+        "vkGetPhysicalDeviceExternalFenceProperties",
+        "vkGetPhysicalDeviceExternalSemaphoreProperties",
+        "vkCmdDispatchBase",
+        "vkCreateDescriptorUpdateTemplate",
+        "vkDestroyDescriptorUpdateTemplate",
+        "vkUpdateDescriptorSetWithTemplate",
+        "vkGetDescriptorSetLayoutSupport",
+        "vkCreateSamplerYcbcrConversion",
+        "vkDestroySamplerYcbcrConversion",
+        "vkResetQueryPool",
+        "vkGetSemaphoreCounterValue",
+        "vkWaitSemaphores",
+        "vkSignalSemaphore",
+        "vkGetBufferDeviceAddress",
+        "vkGetBufferOpaqueCaptureAddress",
+        "vkGetDeviceMemoryOpaqueCaptureAddress",
+        "vkCmdDrawIndirectCount",
+        "vkCmdDrawIndexedIndirectCount",
+        "vkCreateRenderPass2",
+        "vkCmdBeginRenderPass2",
+        "vkCmdNextSubpass2",
+        "vkCmdEndRenderPass2",
+        "vkGetPhysicalDeviceToolProperties",
+        "vkCreatePrivateDataSlot",
+        "vkDestroyPrivateDataSlot",
+        "vkSetPrivateData",
+        "vkGetPrivateData",
+        "vkCmdPipelineBarrier2",
+        "vkCmdWriteTimestamp2",
+        "vkQueueSubmit2",
+        "vkCmdCopyBuffer2",
+        "vkCmdCopyImage2",
+        "vkCmdCopyBufferToImage2",
+        "vkCmdCopyImageToBuffer2",
+        "vkGetDeviceBufferMemoryRequirements",
+        "vkGetDeviceImageMemoryRequirements",
+        "vkGetDeviceImageSparseMemoryRequirements",
+        "vkCmdSetEvent2",
+        "vkCmdResetEvent2",
+        "vkCmdWaitEvents2",
+        "vkCmdBlitImage2",
+        "vkCmdResolveImage2",
+        "vkCmdBeginRendering",
+        "vkCmdEndRendering",
+        "vkCmdSetCullMode",
+        "vkCmdSetFrontFace",
+        "vkCmdSetPrimitiveTopology",
+        "vkCmdSetViewportWithCount",
+        "vkCmdSetScissorWithCount",
+        "vkCmdBindVertexBuffers2",
+        "vkCmdSetDepthTestEnable",
+        "vkCmdSetDepthWriteEnable",
+        "vkCmdSetDepthCompareOp",
+        "vkCmdSetDepthBoundsTestEnable",
+        "vkCmdSetStencilTestEnable",
+        "vkCmdSetStencilOp",
+        "vkCmdSetRasterizerDiscardEnable",
+        "vkCmdSetDepthBiasEnable",
+        "vkCmdSetPrimitiveRestartEnable",
+        "vkMapMemory2",
+        "vkUnmapMemory2",
+        "vkGetDeviceImageSubresourceLayout",
+        "vkGetImageSubresourceLayout2",
+        "vkCopyMemoryToImage",
+        "vkCopyImageToMemory",
+        "vkCopyImageToImage",
+        "vkTransitionImageLayout",
+        "vkCmdPushDescriptorSet",
+        "vkCmdPushDescriptorSetWithTemplate",
+        "vkCmdBindDescriptorSets2",
+        "vkCmdPushConstants2",
+        "vkCmdPushDescriptorSet2",
+        "vkCmdPushDescriptorSetWithTemplate2",
+        "vkCmdSetLineStipple",
+        "vkCmdBindIndexBuffer2",
+        "vkGetRenderingAreaGranularity",
+        "vkCmdSetRenderingAttachmentLocations",
+        "vkCmdSetRenderingInputAttachmentIndices",
+        "vkDestroySurfaceKHR",
+        "vkGetPhysicalDeviceSurfaceSupportKHR",
+        "vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+        "vkGetPhysicalDeviceSurfaceFormatsKHR",
+        "vkGetPhysicalDeviceSurfacePresentModesKHR",
+        "vkCreateSwapchainKHR",
+        "vkDestroySwapchainKHR",
+        "vkGetSwapchainImagesKHR",
+        "vkAcquireNextImageKHR",
+        "vkQueuePresentKHR",
+        "vkGetDeviceGroupPresentCapabilitiesKHR",
+        "vkGetDeviceGroupSurfacePresentModesKHR",
+        "vkGetPhysicalDevicePresentRectanglesKHR",
+        "vkAcquireNextImage2KHR",
+        "vkGetPhysicalDeviceDisplayPropertiesKHR",
+        "vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+        "vkGetDisplayPlaneSupportedDisplaysKHR",
+        "vkGetDisplayModePropertiesKHR",
+        "vkCreateDisplayModeKHR",
+        "vkGetDisplayPlaneCapabilitiesKHR",
+        "vkCreateDisplayPlaneSurfaceKHR",
+        "vkCreateSharedSwapchainsKHR",
+        "vkCreateXlibSurfaceKHR",
+        "vkGetPhysicalDeviceXlibPresentationSupportKHR",
+        "vkCreateXcbSurfaceKHR",
+        "vkGetPhysicalDeviceXcbPresentationSupportKHR",
+        "vkCreateWaylandSurfaceKHR",
+        "vkGetPhysicalDeviceWaylandPresentationSupportKHR",
+        "vkCreateAndroidSurfaceKHR",
+        "vkCreateWin32SurfaceKHR",
+        "vkGetPhysicalDeviceWin32PresentationSupportKHR",
+        "vkCreateDebugReportCallbackEXT",
+        "vkDestroyDebugReportCallbackEXT",
+        "vkDebugReportMessageEXT",
+        "vkDebugMarkerSetObjectTagEXT",
+        "vkDebugMarkerSetObjectNameEXT",
+        "vkCmdDebugMarkerBeginEXT",
+        "vkCmdDebugMarkerEndEXT",
+        "vkCmdDebugMarkerInsertEXT",
+        "vkGetPhysicalDeviceVideoCapabilitiesKHR",
+        "vkGetPhysicalDeviceVideoFormatPropertiesKHR",
+        "vkCreateVideoSessionKHR",
+        "vkDestroyVideoSessionKHR",
+        "vkGetVideoSessionMemoryRequirementsKHR",
+        "vkBindVideoSessionMemoryKHR",
+        "vkCreateVideoSessionParametersKHR",
+        "vkUpdateVideoSessionParametersKHR",
+        "vkDestroyVideoSessionParametersKHR",
+        "vkCmdBeginVideoCodingKHR",
+        "vkCmdEndVideoCodingKHR",
+        "vkCmdControlVideoCodingKHR",
+        "vkCmdDecodeVideoKHR",
+        "vkCmdBindTransformFeedbackBuffersEXT",
+        "vkCmdBeginTransformFeedbackEXT",
+        "vkCmdEndTransformFeedbackEXT",
+        "vkCmdBeginQueryIndexedEXT",
+        "vkCmdEndQueryIndexedEXT",
+        "vkCmdDrawIndirectByteCountEXT",
+        "vkCreateCuModuleNVX",
+        "vkCreateCuFunctionNVX",
+        "vkDestroyCuModuleNVX",
+        "vkDestroyCuFunctionNVX",
+        "vkCmdCuLaunchKernelNVX",
+        "vkGetImageViewHandleNVX",
+        "vkGetImageViewHandle64NVX",
+        "vkGetImageViewAddressNVX",
+        "vkGetDeviceCombinedImageSamplerIndexNVX",
+        "vkCmdDrawIndirectCountAMD",
+        "vkCmdDrawIndexedIndirectCountAMD",
+        "vkGetShaderInfoAMD",
+        "vkCmdBeginRenderingKHR",
+        "vkCmdEndRenderingKHR",
+        "vkCreateStreamDescriptorSurfaceGGP",
+        "vkGetPhysicalDeviceExternalImageFormatPropertiesNV",
+        "vkGetMemoryWin32HandleNV",
+        "vkGetPhysicalDeviceFeatures2KHR",
+        "vkGetPhysicalDeviceProperties2KHR",
+        "vkGetPhysicalDeviceFormatProperties2KHR",
+        "vkGetPhysicalDeviceImageFormatProperties2KHR",
+        "vkGetPhysicalDeviceQueueFamilyProperties2KHR",
+        "vkGetPhysicalDeviceMemoryProperties2KHR",
+        "vkGetPhysicalDeviceSparseImageFormatProperties2KHR",
+        "vkGetDeviceGroupPeerMemoryFeaturesKHR",
+        "vkCmdSetDeviceMaskKHR",
+        "vkCmdDispatchBaseKHR",
+        "vkCreateViSurfaceNN",
+        "vkTrimCommandPoolKHR",
+        "vkEnumeratePhysicalDeviceGroupsKHR",
+        "vkGetPhysicalDeviceExternalBufferPropertiesKHR",
+        "vkGetMemoryWin32HandleKHR",
+        "vkGetMemoryWin32HandlePropertiesKHR",
+        "vkGetMemoryFdKHR",
+        "vkGetMemoryFdPropertiesKHR",
+        "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR",
+        "vkImportSemaphoreWin32HandleKHR",
+        "vkGetSemaphoreWin32HandleKHR",
+        "vkImportSemaphoreFdKHR",
+        "vkGetSemaphoreFdKHR",
+        "vkCmdPushDescriptorSetKHR",
+        "vkCmdPushDescriptorSetWithTemplateKHR",
+        "vkCmdBeginConditionalRenderingEXT",
+        "vkCmdEndConditionalRenderingEXT",
+        "vkCreateDescriptorUpdateTemplateKHR",
+        "vkDestroyDescriptorUpdateTemplateKHR",
+        "vkUpdateDescriptorSetWithTemplateKHR",
+        "vkCmdSetViewportWScalingNV",
+        "vkReleaseDisplayEXT",
+        "vkAcquireXlibDisplayEXT",
+        "vkGetRandROutputDisplayEXT",
+        "vkGetPhysicalDeviceSurfaceCapabilities2EXT",
+        "vkDisplayPowerControlEXT",
+        "vkRegisterDeviceEventEXT",
+        "vkRegisterDisplayEventEXT",
+        "vkGetSwapchainCounterEXT",
+        "vkGetRefreshCycleDurationGOOGLE",
+        "vkGetPastPresentationTimingGOOGLE",
+        "vkCmdSetDiscardRectangleEXT",
+        "vkCmdSetDiscardRectangleEnableEXT",
+        "vkCmdSetDiscardRectangleModeEXT",
+        "vkSetHdrMetadataEXT",
+        "vkCreateRenderPass2KHR",
+        "vkCmdBeginRenderPass2KHR",
+        "vkCmdNextSubpass2KHR",
+        "vkCmdEndRenderPass2KHR",
+        "vkGetSwapchainStatusKHR",
+        "vkGetPhysicalDeviceExternalFencePropertiesKHR",
+        "vkImportFenceWin32HandleKHR",
+        "vkGetFenceWin32HandleKHR",
+        "vkImportFenceFdKHR",
+        "vkGetFenceFdKHR",
+        "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR",
+        "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR",
+        "vkAcquireProfilingLockKHR",
+        "vkReleaseProfilingLockKHR",
+        "vkGetPhysicalDeviceSurfaceCapabilities2KHR",
+        "vkGetPhysicalDeviceSurfaceFormats2KHR",
+        "vkGetPhysicalDeviceDisplayProperties2KHR",
+        "vkGetPhysicalDeviceDisplayPlaneProperties2KHR",
+        "vkGetDisplayModeProperties2KHR",
+        "vkGetDisplayPlaneCapabilities2KHR",
+        "vkCreateIOSSurfaceMVK",
+        "vkCreateMacOSSurfaceMVK",
+        "vkSetDebugUtilsObjectNameEXT",
+        "vkSetDebugUtilsObjectTagEXT",
+        "vkQueueBeginDebugUtilsLabelEXT",
+        "vkQueueEndDebugUtilsLabelEXT",
+        "vkQueueInsertDebugUtilsLabelEXT",
+        "vkCmdBeginDebugUtilsLabelEXT",
+        "vkCmdEndDebugUtilsLabelEXT",
+        "vkCmdInsertDebugUtilsLabelEXT",
+        "vkCreateDebugUtilsMessengerEXT",
+        "vkDestroyDebugUtilsMessengerEXT",
+        "vkSubmitDebugUtilsMessageEXT",
+        "vkGetAndroidHardwareBufferPropertiesANDROID",
+        "vkGetMemoryAndroidHardwareBufferANDROID",
+        "vkCreateGpaSessionAMD",
+        "vkDestroyGpaSessionAMD",
+        "vkSetGpaDeviceClockModeAMD",
+        "vkGetGpaDeviceClockInfoAMD",
+        "vkCmdBeginGpaSessionAMD",
+        "vkCmdEndGpaSessionAMD",
+        "vkCmdBeginGpaSampleAMD",
+        "vkCmdEndGpaSampleAMD",
+        "vkGetGpaSessionStatusAMD",
+        "vkGetGpaSessionResultsAMD",
+        "vkResetGpaSessionAMD",
+        "vkCmdCopyGpaSessionResultsAMD",
+        "vkCreateExecutionGraphPipelinesAMDX",
+        "vkGetExecutionGraphPipelineScratchSizeAMDX",
+        "vkGetExecutionGraphPipelineNodeIndexAMDX",
+        "vkCmdInitializeGraphScratchMemoryAMDX",
+        "vkCmdDispatchGraphAMDX",
+        "vkCmdDispatchGraphIndirectAMDX",
+        "vkCmdDispatchGraphIndirectCountAMDX",
+        "vkWriteSamplerDescriptorsEXT",
+        "vkWriteResourceDescriptorsEXT",
+        "vkCmdBindSamplerHeapEXT",
+        "vkCmdBindResourceHeapEXT",
+        "vkCmdPushDataEXT",
+        "vkGetImageOpaqueCaptureDataEXT",
+        "vkGetPhysicalDeviceDescriptorSizeEXT",
+        "vkRegisterCustomBorderColorEXT",
+        "vkUnregisterCustomBorderColorEXT",
+        "vkGetTensorOpaqueCaptureDataARM",
+        "vkCmdSetSampleLocationsEXT",
+        "vkGetPhysicalDeviceMultisamplePropertiesEXT",
+        "vkGetImageMemoryRequirements2KHR",
+        "vkGetBufferMemoryRequirements2KHR",
+        "vkGetImageSparseMemoryRequirements2KHR",
+        "vkCreateAccelerationStructureKHR",
+        "vkDestroyAccelerationStructureKHR",
+        "vkCmdBuildAccelerationStructuresKHR",
+        "vkCmdBuildAccelerationStructuresIndirectKHR",
+        "vkBuildAccelerationStructuresKHR",
+        "vkCopyAccelerationStructureKHR",
+        "vkCopyAccelerationStructureToMemoryKHR",
+        "vkCopyMemoryToAccelerationStructureKHR",
+        "vkWriteAccelerationStructuresPropertiesKHR",
+        "vkCmdCopyAccelerationStructureKHR",
+        "vkCmdCopyAccelerationStructureToMemoryKHR",
+        "vkCmdCopyMemoryToAccelerationStructureKHR",
+        "vkGetAccelerationStructureDeviceAddressKHR",
+        "vkCmdWriteAccelerationStructuresPropertiesKHR",
+        "vkGetDeviceAccelerationStructureCompatibilityKHR",
+        "vkGetAccelerationStructureBuildSizesKHR",
+        "vkCmdTraceRaysKHR",
+        "vkCreateRayTracingPipelinesKHR",
+        "vkGetRayTracingShaderGroupHandlesKHR",
+        "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR",
+        "vkCmdTraceRaysIndirectKHR",
+        "vkGetRayTracingShaderGroupStackSizeKHR",
+        "vkCmdSetRayTracingPipelineStackSizeKHR",
+        "vkCreateSamplerYcbcrConversionKHR",
+        "vkDestroySamplerYcbcrConversionKHR",
+        "vkBindBufferMemory2KHR",
+        "vkBindImageMemory2KHR",
+        "vkGetImageDrmFormatModifierPropertiesEXT",
+        "vkCreateValidationCacheEXT",
+        "vkDestroyValidationCacheEXT",
+        "vkMergeValidationCachesEXT",
+        "vkGetValidationCacheDataEXT",
+        "vkCmdBindShadingRateImageNV",
+        "vkCmdSetViewportShadingRatePaletteNV",
+        "vkCmdSetCoarseSampleOrderNV",
+        "vkCreateAccelerationStructureNV",
+        "vkDestroyAccelerationStructureNV",
+        "vkGetAccelerationStructureMemoryRequirementsNV",
+        "vkBindAccelerationStructureMemoryNV",
+        "vkCmdBuildAccelerationStructureNV",
+        "vkCmdCopyAccelerationStructureNV",
+        "vkCmdTraceRaysNV",
+        "vkCreateRayTracingPipelinesNV",
+        "vkGetRayTracingShaderGroupHandlesNV",
+        "vkGetAccelerationStructureHandleNV",
+        "vkCmdWriteAccelerationStructuresPropertiesNV",
+        "vkCompileDeferredNV",
+        "vkGetDescriptorSetLayoutSupportKHR",
+        "vkCmdDrawIndirectCountKHR",
+        "vkCmdDrawIndexedIndirectCountKHR",
+        "vkGetMemoryHostPointerPropertiesEXT",
+        "vkCmdWriteBufferMarkerAMD",
+        "vkCmdWriteBufferMarker2AMD",
+        "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT",
+        "vkGetCalibratedTimestampsEXT",
+        "vkCmdDrawMeshTasksNV",
+        "vkCmdDrawMeshTasksIndirectNV",
+        "vkCmdDrawMeshTasksIndirectCountNV",
+        "vkCmdSetExclusiveScissorEnableNV",
+        "vkCmdSetExclusiveScissorNV",
+        "vkCmdSetCheckpointNV",
+        "vkGetQueueCheckpointDataNV",
+        "vkGetQueueCheckpointData2NV",
+        "vkGetSemaphoreCounterValueKHR",
+        "vkWaitSemaphoresKHR",
+        "vkSignalSemaphoreKHR",
+        "vkSetSwapchainPresentTimingQueueSizeEXT",
+        "vkGetSwapchainTimingPropertiesEXT",
+        "vkGetSwapchainTimeDomainPropertiesEXT",
+        "vkGetPastPresentationTimingEXT",
+        "vkInitializePerformanceApiINTEL",
+        "vkUninitializePerformanceApiINTEL",
+        "vkCmdSetPerformanceMarkerINTEL",
+        "vkCmdSetPerformanceStreamMarkerINTEL",
+        "vkCmdSetPerformanceOverrideINTEL",
+        "vkAcquirePerformanceConfigurationINTEL",
+        "vkReleasePerformanceConfigurationINTEL",
+        "vkQueueSetPerformanceConfigurationINTEL",
+        "vkGetPerformanceParameterINTEL",
+        "vkSetLocalDimmingAMD",
+        "vkCreateImagePipeSurfaceFUCHSIA",
+        "vkCreateMetalSurfaceEXT",
+        "vkGetPhysicalDeviceFragmentShadingRatesKHR",
+        "vkCmdSetFragmentShadingRateKHR",
+        "vkCmdSetRenderingAttachmentLocationsKHR",
+        "vkCmdSetRenderingInputAttachmentIndicesKHR",
+        "vkGetBufferDeviceAddressEXT",
+        "vkGetPhysicalDeviceToolPropertiesEXT",
+        "vkWaitForPresentKHR",
+        "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV",
+        "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV",
+        "vkGetPhysicalDeviceSurfacePresentModes2EXT",
+        "vkAcquireFullScreenExclusiveModeEXT",
+        "vkReleaseFullScreenExclusiveModeEXT",
+        "vkGetDeviceGroupSurfacePresentModes2EXT",
+        "vkCreateHeadlessSurfaceEXT",
+        "vkGetBufferDeviceAddressKHR",
+        "vkGetBufferOpaqueCaptureAddressKHR",
+        "vkGetDeviceMemoryOpaqueCaptureAddressKHR",
+        "vkCmdSetLineStippleEXT",
+        "vkResetQueryPoolEXT",
+        "vkCmdSetCullModeEXT",
+        "vkCmdSetFrontFaceEXT",
+        "vkCmdSetPrimitiveTopologyEXT",
+        "vkCmdSetViewportWithCountEXT",
+        "vkCmdSetScissorWithCountEXT",
+        "vkCmdBindVertexBuffers2EXT",
+        "vkCmdSetDepthTestEnableEXT",
+        "vkCmdSetDepthWriteEnableEXT",
+        "vkCmdSetDepthCompareOpEXT",
+        "vkCmdSetDepthBoundsTestEnableEXT",
+        "vkCmdSetStencilTestEnableEXT",
+        "vkCmdSetStencilOpEXT",
+        "vkCreateDeferredOperationKHR",
+        "vkDestroyDeferredOperationKHR",
+        "vkGetDeferredOperationMaxConcurrencyKHR",
+        "vkGetDeferredOperationResultKHR",
+        "vkDeferredOperationJoinKHR",
+        "vkGetPipelineExecutablePropertiesKHR",
+        "vkGetPipelineExecutableStatisticsKHR",
+        "vkGetPipelineExecutableInternalRepresentationsKHR",
+        "vkCopyMemoryToImageEXT",
+        "vkCopyImageToMemoryEXT",
+        "vkCopyImageToImageEXT",
+        "vkTransitionImageLayoutEXT",
+        "vkGetImageSubresourceLayout2EXT",
+        "vkMapMemory2KHR",
+        "vkUnmapMemory2KHR",
+        "vkReleaseSwapchainImagesEXT",
+        "vkGetGeneratedCommandsMemoryRequirementsNV",
+        "vkCmdPreprocessGeneratedCommandsNV",
+        "vkCmdExecuteGeneratedCommandsNV",
+        "vkCmdBindPipelineShaderGroupNV",
+        "vkCreateIndirectCommandsLayoutNV",
+        "vkDestroyIndirectCommandsLayoutNV",
+        "vkCmdSetDepthBias2EXT",
+        "vkAcquireDrmDisplayEXT",
+        "vkGetDrmDisplayEXT",
+        "vkCreatePrivateDataSlotEXT",
+        "vkDestroyPrivateDataSlotEXT",
+        "vkSetPrivateDataEXT",
+        "vkGetPrivateDataEXT",
+        "vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR",
+        "vkGetEncodedVideoSessionParametersKHR",
+        "vkCmdEncodeVideoKHR",
+        "vkQueueSetPerfHintQCOM",
+        "vkCreateCudaModuleNV",
+        "vkGetCudaModuleCacheNV",
+        "vkCreateCudaFunctionNV",
+        "vkDestroyCudaModuleNV",
+        "vkDestroyCudaFunctionNV",
+        "vkCmdCudaLaunchKernelNV",
+        "vkCmdDispatchTileQCOM",
+        "vkCmdBeginPerTileExecutionQCOM",
+        "vkCmdEndPerTileExecutionQCOM",
+        "vkSetLatencySleepModeLegacyNV",
+        "vkLatencySleepLegacyNV",
+        "vkSetLatencyMarkerLegacyNV",
+        "vkGetLatencyTimingsLegacyNV",
+        "vkQueueNotifyOutOfBandLegacyNV",
+        "vkGetSleepStatusLegacyNV",
+        "vkShutdownLatencyDeviceLegacyNV",
+        "vkExportMetalObjectsEXT",
+        "vkCmdSetEvent2KHR",
+        "vkCmdResetEvent2KHR",
+        "vkCmdWaitEvents2KHR",
+        "vkCmdPipelineBarrier2KHR",
+        "vkCmdWriteTimestamp2KHR",
+        "vkQueueSubmit2KHR",
+        "vkGetDescriptorSetLayoutSizeEXT",
+        "vkGetDescriptorSetLayoutBindingOffsetEXT",
+        "vkGetDescriptorEXT",
+        "vkCmdBindDescriptorBuffersEXT",
+        "vkCmdSetDescriptorBufferOffsetsEXT",
+        "vkCmdBindDescriptorBufferEmbeddedSamplersEXT",
+        "vkGetBufferOpaqueCaptureDescriptorDataEXT",
+        "vkGetImageOpaqueCaptureDescriptorDataEXT",
+        "vkGetImageViewOpaqueCaptureDescriptorDataEXT",
+        "vkGetSamplerOpaqueCaptureDescriptorDataEXT",
+        "vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT",
+        "vkCmdBindIndexBuffer3KHR",
+        "vkCmdBindVertexBuffers3KHR",
+        "vkCmdDrawIndirect2KHR",
+        "vkCmdDrawIndexedIndirect2KHR",
+        "vkCmdDispatchIndirect2KHR",
+        "vkCmdCopyMemoryKHR",
+        "vkCmdCopyMemoryToImageKHR",
+        "vkCmdCopyImageToMemoryKHR",
+        "vkCmdUpdateMemoryKHR",
+        "vkCmdFillMemoryKHR",
+        "vkCmdCopyQueryPoolResultsToMemoryKHR",
+        "vkCmdDrawIndirectCount2KHR",
+        "vkCmdDrawIndexedIndirectCount2KHR",
+        "vkCmdBeginConditionalRendering2EXT",
+        "vkCmdBindTransformFeedbackBuffers2EXT",
+        "vkCmdBeginTransformFeedback2EXT",
+        "vkCmdEndTransformFeedback2EXT",
+        "vkCmdDrawIndirectByteCount2EXT",
+        "vkCmdDrawMeshTasksIndirect2EXT",
+        "vkCmdDrawMeshTasksIndirectCount2EXT",
+        "vkCmdWriteMarkerToMemoryAMD",
+        "vkCreateAccelerationStructure2KHR",
+        "vkCmdSetFragmentShadingRateEnumNV",
+        "vkCmdDrawMeshTasksEXT",
+        "vkCmdDrawMeshTasksIndirectEXT",
+        "vkCmdDrawMeshTasksIndirectCountEXT",
+        "vkCmdCopyBuffer2KHR",
+        "vkCmdCopyImage2KHR",
+        "vkCmdCopyBufferToImage2KHR",
+        "vkCmdCopyImageToBuffer2KHR",
+        "vkCmdBlitImage2KHR",
+        "vkCmdResolveImage2KHR",
+        "vkGetDeviceFaultInfoEXT",
+        "vkAcquireWinrtDisplayNV",
+        "vkGetWinrtDisplayNV",
+        "vkCreateDirectFBSurfaceEXT",
+        "vkGetPhysicalDeviceDirectFBPresentationSupportEXT",
+        "vkCmdSetVertexInputEXT",
+        "vkGetMemoryZirconHandleFUCHSIA",
+        "vkGetMemoryZirconHandlePropertiesFUCHSIA",
+        "vkImportSemaphoreZirconHandleFUCHSIA",
+        "vkGetSemaphoreZirconHandleFUCHSIA",
+        "vkCreateBufferCollectionFUCHSIA",
+        "vkSetBufferCollectionImageConstraintsFUCHSIA",
+        "vkSetBufferCollectionBufferConstraintsFUCHSIA",
+        "vkDestroyBufferCollectionFUCHSIA",
+        "vkGetBufferCollectionPropertiesFUCHSIA",
+        "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI",
+        "vkCmdSubpassShadingHUAWEI",
+        "vkCmdBindInvocationMaskHUAWEI",
+        "vkGetMemoryRemoteAddressNV",
+        "vkGetPipelinePropertiesEXT",
+        "vkCmdSetPatchControlPointsEXT",
+        "vkCmdSetRasterizerDiscardEnableEXT",
+        "vkCmdSetDepthBiasEnableEXT",
+        "vkCmdSetLogicOpEXT",
+        "vkCmdSetPrimitiveRestartEnableEXT",
+        "vkCreateScreenSurfaceQNX",
+        "vkGetPhysicalDeviceScreenPresentationSupportQNX",
+        "vkCmdSetColorWriteEnableEXT",
+        "vkCmdTraceRaysIndirect2KHR",
+        "vkCmdDrawMultiEXT",
+        "vkCmdDrawMultiIndexedEXT",
+        "vkCreateMicromapEXT",
+        "vkDestroyMicromapEXT",
+        "vkCmdBuildMicromapsEXT",
+        "vkBuildMicromapsEXT",
+        "vkCopyMicromapEXT",
+        "vkCopyMicromapToMemoryEXT",
+        "vkCopyMemoryToMicromapEXT",
+        "vkWriteMicromapsPropertiesEXT",
+        "vkCmdCopyMicromapEXT",
+        "vkCmdCopyMicromapToMemoryEXT",
+        "vkCmdCopyMemoryToMicromapEXT",
+        "vkCmdWriteMicromapsPropertiesEXT",
+        "vkGetDeviceMicromapCompatibilityEXT",
+        "vkGetMicromapBuildSizesEXT",
+        "vkCmdDrawClusterHUAWEI",
+        "vkCmdDrawClusterIndirectHUAWEI",
+        "vkSetDeviceMemoryPriorityEXT",
+        "vkGetDeviceBufferMemoryRequirementsKHR",
+        "vkGetDeviceImageMemoryRequirementsKHR",
+        "vkGetDeviceImageSparseMemoryRequirementsKHR",
+        "vkCmdSetDispatchParametersARM",
+        "vkGetDescriptorSetLayoutHostMappingInfoVALVE",
+        "vkGetDescriptorSetHostMappingVALVE",
+        "vkCmdCopyMemoryIndirectNV",
+        "vkCmdCopyMemoryToImageIndirectNV",
+        "vkCmdDecompressMemoryNV",
+        "vkCmdDecompressMemoryIndirectCountNV",
+        "vkGetPipelineIndirectMemoryRequirementsNV",
+        "vkCmdUpdatePipelineIndirectBufferNV",
+        "vkGetPipelineIndirectDeviceAddressNV",
+        "vkGetNativeBufferPropertiesOHOS",
+        "vkGetMemoryNativeBufferOHOS",
+        "vkCmdSetDepthClampEnableEXT",
+        "vkCmdSetPolygonModeEXT",
+        "vkCmdSetRasterizationSamplesEXT",
+        "vkCmdSetSampleMaskEXT",
+        "vkCmdSetAlphaToCoverageEnableEXT",
+        "vkCmdSetAlphaToOneEnableEXT",
+        "vkCmdSetLogicOpEnableEXT",
+        "vkCmdSetColorBlendEnableEXT",
+        "vkCmdSetColorBlendEquationEXT",
+        "vkCmdSetColorWriteMaskEXT",
+        "vkCmdSetTessellationDomainOriginEXT",
+        "vkCmdSetRasterizationStreamEXT",
+        "vkCmdSetConservativeRasterizationModeEXT",
+        "vkCmdSetExtraPrimitiveOverestimationSizeEXT",
+        "vkCmdSetDepthClipEnableEXT",
+        "vkCmdSetSampleLocationsEnableEXT",
+        "vkCmdSetColorBlendAdvancedEXT",
+        "vkCmdSetProvokingVertexModeEXT",
+        "vkCmdSetLineRasterizationModeEXT",
+        "vkCmdSetLineStippleEnableEXT",
+        "vkCmdSetDepthClipNegativeOneToOneEXT",
+        "vkCmdSetViewportWScalingEnableNV",
+        "vkCmdSetViewportSwizzleNV",
+        "vkCmdSetCoverageToColorEnableNV",
+        "vkCmdSetCoverageToColorLocationNV",
+        "vkCmdSetCoverageModulationModeNV",
+        "vkCmdSetCoverageModulationTableEnableNV",
+        "vkCmdSetCoverageModulationTableNV",
+        "vkCmdSetShadingRateImageEnableNV",
+        "vkCmdSetRepresentativeFragmentTestEnableNV",
+        "vkCmdSetCoverageReductionModeNV",
+        "vkCreateTensorARM",
+        "vkDestroyTensorARM",
+        "vkCreateTensorViewARM",
+        "vkDestroyTensorViewARM",
+        "vkGetTensorMemoryRequirementsARM",
+        "vkBindTensorMemoryARM",
+        "vkGetDeviceTensorMemoryRequirementsARM",
+        "vkCmdCopyTensorARM",
+        "vkGetPhysicalDeviceExternalTensorPropertiesARM",
+        "vkGetTensorOpaqueCaptureDescriptorDataARM",
+        "vkGetTensorViewOpaqueCaptureDescriptorDataARM",
+        "vkGetShaderModuleIdentifierEXT",
+        "vkGetShaderModuleCreateInfoIdentifierEXT",
+        "vkGetPhysicalDeviceOpticalFlowImageFormatsNV",
+        "vkCreateOpticalFlowSessionNV",
+        "vkDestroyOpticalFlowSessionNV",
+        "vkBindOpticalFlowSessionImageNV",
+        "vkCmdOpticalFlowExecuteNV",
+        "vkCmdBindIndexBuffer2KHR",
+        "vkGetRenderingAreaGranularityKHR",
+        "vkGetDeviceImageSubresourceLayoutKHR",
+        "vkGetImageSubresourceLayout2KHR",
+        "vkAntiLagUpdateAMD",
+        "vkWaitForPresent2KHR",
+        "vkCreateShadersEXT",
+        "vkDestroyShaderEXT",
+        "vkGetShaderBinaryDataEXT",
+        "vkCmdBindShadersEXT",
+        "vkCmdSetDepthClampRangeEXT",
+        "vkCreatePipelineBinariesKHR",
+        "vkDestroyPipelineBinaryKHR",
+        "vkGetPipelineKeyKHR",
+        "vkGetPipelineBinaryDataKHR",
+        "vkReleaseCapturedPipelineDataKHR",
+        "vkGetFramebufferTilePropertiesQCOM",
+        "vkGetDynamicRenderingTilePropertiesQCOM",
+        "vkReleaseSwapchainImagesKHR",
+        "vkGetPhysicalDeviceCooperativeVectorPropertiesNV",
+        "vkConvertCooperativeVectorMatrixNV",
+        "vkCmdConvertCooperativeVectorMatrixNV",
+        "vkSetLatencySleepModeNV",
+        "vkLatencySleepNV",
+        "vkSetLatencyMarkerNV",
+        "vkGetLatencyTimingsNV",
+        "vkQueueNotifyOutOfBandNV",
+        "vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR",
+        "vkCreateDataGraphPipelinesARM",
+        "vkCreateDataGraphPipelineSessionARM",
+        "vkGetDataGraphPipelineSessionBindPointRequirementsARM",
+        "vkGetDataGraphPipelineSessionMemoryRequirementsARM",
+        "vkBindDataGraphPipelineSessionMemoryARM",
+        "vkDestroyDataGraphPipelineSessionARM",
+        "vkCmdDispatchDataGraphARM",
+        "vkGetDataGraphPipelineAvailablePropertiesARM",
+        "vkGetDataGraphPipelinePropertiesARM",
+        "vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM",
+        "vkGetPhysicalDeviceQueueFamilyDataGraphProcessingEnginePropertiesARM",
+        "vkGetPhysicalDeviceQueueFamilyDataGraphEngineOperationPropertiesARM",
+        "vkCmdSetAttachmentFeedbackLoopEnableEXT",
+        "vkGetScreenBufferPropertiesQNX",
+        "vkCmdSetLineStippleKHR",
+        "vkGetPhysicalDeviceCalibrateableTimeDomainsKHR",
+        "vkGetCalibratedTimestampsKHR",
+        "vkCmdBindDescriptorSets2KHR",
+        "vkCmdPushConstants2KHR",
+        "vkCmdPushDescriptorSet2KHR",
+        "vkCmdPushDescriptorSetWithTemplate2KHR",
+        "vkCmdSetDescriptorBufferOffsets2EXT",
+        "vkCmdBindDescriptorBufferEmbeddedSamplers2EXT",
+        "vkCmdBindTileMemoryQCOM",
+        "vkCmdCopyMemoryIndirectKHR",
+        "vkCmdCopyMemoryToImageIndirectKHR",
+        "vkCmdDecompressMemoryEXT",
+        "vkCmdDecompressMemoryIndirectCountEXT",
+        "vkCreateExternalComputeQueueNV",
+        "vkDestroyExternalComputeQueueNV",
+        "vkGetExternalComputeQueueDataNV",
+        "vkGetClusterAccelerationStructureBuildSizesNV",
+        "vkCmdBuildClusterAccelerationStructureIndirectNV",
+        "vkGetPartitionedAccelerationStructuresBuildSizesNV",
+        "vkCmdBuildPartitionedAccelerationStructuresNV",
+        "vkGetGeneratedCommandsMemoryRequirementsEXT",
+        "vkCmdPreprocessGeneratedCommandsEXT",
+        "vkCmdExecuteGeneratedCommandsEXT",
+        "vkCreateIndirectCommandsLayoutEXT",
+        "vkDestroyIndirectCommandsLayoutEXT",
+        "vkCreateIndirectExecutionSetEXT",
+        "vkDestroyIndirectExecutionSetEXT",
+        "vkUpdateIndirectExecutionSetPipelineEXT",
+        "vkUpdateIndirectExecutionSetShaderEXT",
+        "vkGetDeviceFaultReportsKHR",
+        "vkGetDeviceFaultDebugInfoKHR",
+        "vkCreateSurfaceOHOS",
+        "vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV",
+        "vkGetMemoryMetalHandleEXT",
+        "vkGetMemoryMetalHandlePropertiesEXT",
+        "vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM",
+        "vkEnumeratePhysicalDeviceShaderInstrumentationMetricsARM",
+        "vkCreateShaderInstrumentationARM",
+        "vkDestroyShaderInstrumentationARM",
+        "vkCmdBeginShaderInstrumentationARM",
+        "vkCmdEndShaderInstrumentationARM",
+        "vkGetShaderInstrumentationValuesARM",
+        "vkClearShaderInstrumentationMetricsARM",
+        "vkCmdEndRendering2EXT",
+        "vkCmdBeginCustomResolveEXT",
+        "vkCmdEndRendering2KHR",
+        "vkGetPhysicalDeviceQueueFamilyDataGraphOpticalFlowImageFormatsARM",
+        "vkCmdSetComputeOccupancyPriorityNV",
+        "vkGetPhysicalDeviceCooperativeMatrixProperties2EXT",
+        "vkCreateUbmSurfaceSEC",
+        "vkGetPhysicalDeviceUbmPresentationSupportSEC",
+        "vkCmdSetPrimitiveRestartIndexEXT",
+      };
+      return names;
+    }
+
+    // the counters of one thread; they are written only by that thread, so relaxed loads and stores suffice, and a snapshot can read them
+    // concurrently
+    struct InstrumentationCounters
+    {
+      std::atomic<uint64_t>     counts[instrumentedCommandCount];
+      std::atomic<uint64_t>     ticks[instrumentedCommandCount];
+      std::atomic<uint64_t>     histograms[instrumentedCommandCount][instrumentationHistogramBucketCount];
+      std::atomic<bool>         inUse;
+      InstrumentationCounters * next;
+    };
+
+    inline std::atomic<InstrumentationCounters *> & instrumentationCountersList() VULKAN_HPP_NOEXCEPT
+    {
+      static std::atomic<InstrumentationCounters *> list( nullptr );
+      return list;
+    }
+
+    inline std::atomic<bool> & instrumentationTimingEnabled() VULKAN_HPP_NOEXCEPT
+    {
+      static std::atomic<bool> timingEnabled( false );
+      return timingEnabled;
+    }
+
+    // the counters are never freed: when a thread exits, its counters are handed over to the next thread that starts calling commands,
+    // such that no counts get lost
+    inline InstrumentationCounters * acquireInstrumentationCounters()
+    {
+      std::atomic<InstrumentationCounters *> & list = instrumentationCountersList();
+      for ( InstrumentationCounters * counters = list.load( std::memory_order_acquire ); counters; counters = counters->next )
+      {
+        bool inUse = false;
+        if ( counters->inUse.compare_exchange_strong( inUse, true, std::memory_order_acquire ) )
+        {
+          return counters;
+        }
+      }
+
+      InstrumentationCounters * counters = new InstrumentationCounters();
+      for ( uint32_t i = 0; i < instrumentedCommandCount; ++i )
+      {
+        counters->counts[i].store( 0, std::memory_order_relaxed );
+        counters->ticks[i].store( 0, std::memory_order_relaxed );
+        for ( uint32_t j = 0; j < instrumentationHistogramBucketCount; ++j )
+        {
+          counters->histograms[i][j].store( 0, std::memory_order_relaxed );
+        }
+      }
+      counters->inUse.store( true, std::memory_order_relaxed );
+      counters->next = list.load( std::memory_order_relaxed );
+      while ( !list.compare_exchange_weak( counters->next, counters, std::memory_order_release, std::memory_order_relaxed ) )
+        ;
+      return counters;
+    }
+
+    struct InstrumentationThreadSlot
+    {
+      ~InstrumentationThreadSlot()
+      {
+        if ( counters )
+        {
+          counters->inUse.store( false, std::memory_order_release );
+        }
+      }
+
+      InstrumentationCounters * counters = nullptr;
+    };
+
+    inline InstrumentationCounters & threadInstrumentationCounters()
+    {
+      static thread_local InstrumentationThreadSlot slot;
+      if ( !slot.counters )
+      {
+        slot.counters = acquireInstrumentationCounters();
+      }
+      return *slot.counters;
+    }
+
+    // a cheap, monotonic tick counter: the time-stamp counter on x86, std::chrono::steady_clock otherwise
+    inline uint64_t instrumentationTicks() VULKAN_HPP_NOEXCEPT
+    {
+#  if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+      return __rdtsc();
+#  elif ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+      return __builtin_ia32_rdtsc();
+#  else
+      return static_cast<uint64_t>( std::chrono::steady_clock::now().time_since_epoch().count() );
+#  endif
+    }
+
+    inline void incrementInstrumentationCounter( std::atomic<uint64_t> & counter, uint64_t value ) VULKAN_HPP_NOEXCEPT
+    {
+      // no read-modify-write needed, as only the owning thread writes
+      counter.store( counter.load( std::memory_order_relaxed ) + value, std::memory_order_relaxed );
+    }
+
+    class InstrumentationScope
+    {
+    public:
+      explicit InstrumentationScope( uint32_t commandIndex )
+        : m_counters( threadInstrumentationCounters() )
+        , m_commandIndex( commandIndex )
+        , m_start( instrumentationTimingEnabled().load( std::memory_order_relaxed ) ? instrumentationTicks() : 0 )
+      {
+        incrementInstrumentationCounter( m_counters.counts[commandIndex], 1 );
+      }
+
+      ~InstrumentationScope()
+      {
+        if ( m_start )
+        {
+          uint64_t ticks = instrumentationTicks() - m_start;
+          incrementInstrumentationCounter( m_counters.ticks[m_commandIndex], ticks );
+
+          // bucket i holds the durations in [2^i, 2^(i+1)) ticks, bucket 0 also the ones below 1 tick
+          uint32_t bucket = 0;
+          for ( uint32_t shift = 32; 0 < shift; shift /= 2 )
+          {
+            if ( ticks >> shift )
+            {
+              ticks >>= shift;
+              bucket += shift;
+            }
+          }
+          incrementInstrumentationCounter( m_counters.histograms[m_commandIndex][( std::min )( bucket, instrumentationHistogramBucketCount - 1 )], 1 );
+        }
+      }
+
+      InstrumentationScope( InstrumentationScope const & )             = delete;
+      InstrumentationScope & operator=( InstrumentationScope const & ) = delete;
+
+    private:
+      InstrumentationCounters & m_counters;
+      uint32_t                  m_commandIndex;
+      uint64_t                  m_start;
+    };
+
+    // a callable stand-in for a PFN_vk* member, counting (and optionally timing) each call before forwarding it
+    template <typename PFN>
+    class InstrumentedCommand;
+
+    template <typename ReturnType, typename... Args>
+    class InstrumentedCommand<ReturnType( VKAPI_PTR * )( Args... )>
+    {
+    public:
+      using PFNType = ReturnType( VKAPI_PTR * )( Args... );
+
+      void bind( PFNType pfn, uint32_t commandIndex ) VULKAN_HPP_NOEXCEPT
+      {
+        m_pfn          = pfn;
+        m_commandIndex = commandIndex;
+      }
+
+      ReturnType operator()( Args... args ) const
+      {
+        InstrumentationScope scope( m_commandIndex );
+        return m_pfn( args... );
+      }
+
+      explicit operator bool() const VULKAN_HPP_NOEXCEPT
+      {
+        return m_pfn != nullptr;
+      }
+
+      PFNType get() const VULKAN_HPP_NOEXCEPT
+      {
+        return m_pfn;
+      }
+
+    private:
+      PFNType  m_pfn          = nullptr;
+      uint32_t m_commandIndex = 0;
+    };
+
+    // keeps the layout of an InstrumentingDispatcher independent of the platform defines, like the placeholders in DispatchLoaderDynamic
+    struct InstrumentedCommandPlaceholder
+    {
+      void *   pfn          = nullptr;
+      uint32_t commandIndex = 0;
+    };
+
+    struct InstrumentedCommandStatistics
+    {
+      char const *                                              name;
+      uint64_t                                                  count;
+      uint64_t                                                  ticks;      // sum of the measured durations
+      std::array<uint64_t, instrumentationHistogramBucketCount> histogram;  // see InstrumentationScope for the bucket ranges
+    };
+
+    // Access to the counts and durations recorded by all InstrumentingDispatchers, summed up over all threads.
+    class Instrumentation
+    {
+    public:
+      // timing is off by default, leaving just the counting on each call
+      static void enableTiming( bool enable ) VULKAN_HPP_NOEXCEPT
+      {
+        instrumentationTimingEnabled().store( enable, std::memory_order_relaxed );
+      }
+
+      static bool timingEnabled() VULKAN_HPP_NOEXCEPT
+      {
+        return instrumentationTimingEnabled().load( std::memory_order_relaxed );
+      }
+
+      // calibrates the tick counter against std::chrono::steady_clock once, which takes about 10 milliseconds
+      static double ticksPerNanosecond()
+      {
+        static double const ticksPerNanosecond = []()
+        {
+          std::chrono::steady_clock::time_point startTime  = std::chrono::steady_clock::now();
+          uint64_t                              startTicks = instrumentationTicks();
+          std::chrono::steady_clock::time_point endTime;
+          do
+          {
+            endTime = std::chrono::steady_clock::now();
+          } while ( endTime - startTime < std::chrono::milliseconds( 10 ) );
+          uint64_t endTicks = instrumentationTicks();
+          return static_cast<double>( endTicks - startTicks ) /
+                 static_cast<double>( std::chrono::duration_cast<std::chrono::nanoseconds>( endTime - startTime ).count() );
+        }();
+        return ticksPerNanosecond;
+      }
+
+      static std::vector<InstrumentedCommandStatistics> snapshot( bool includeUncalledCommands = false )
+      {
+        std::vector<InstrumentedCommandStatistics> statistics( instrumentedCommandCount );
+        for ( uint32_t i = 0; i < instrumentedCommandCount; ++i )
+        {
+          statistics[i].name  = instrumentedCommandNames()[i];
+          statistics[i].count = 0;
+          statistics[i].ticks = 0;
+          statistics[i].histogram.fill( 0 );
+        }
+        for ( InstrumentationCounters * counters = instrumentationCountersList().load( std::memory_order_acquire ); counters; counters = counters->next )
+        {
+          for ( uint32_t i = 0; i < instrumentedCommandCount; ++i )
+          {
+            statistics[i].count += counters->counts[i].load( std::memory_order_relaxed );
+            statistics[i].ticks += counters->ticks[i].load( std::memory_order_relaxed );
+            for ( uint32_t j = 0; j < instrumentationHistogramBucketCount; ++j )
+            {
+              statistics[i].histogram[j] += counters->histograms[i][j].load( std::memory_order_relaxed );
+            }
+          }
+        }
+        if ( !includeUncalledCommands )
+        {
+          statistics.erase( std::remove_if( statistics.begin(),
+                                            statistics.end(),
+                                            []( InstrumentedCommandStatistics const & commandStatistics ) { return commandStatistics.count == 0; } ),
+                            statistics.end() );
+        }
+        return statistics;
+      }
+
+      // calls recorded concurrently to a reset might survive it
+      static void reset() VULKAN_HPP_NOEXCEPT
+      {
+        for ( InstrumentationCounters * counters = instrumentationCountersList().load( std::memory_order_acquire ); counters; counters = counters->next )
+        {
+          for ( uint32_t i = 0; i < instrumentedCommandCount; ++i )
+          {
+            counters->counts[i].store( 0, std::memory_order_relaxed );
+            counters->ticks[i].store( 0, std::memory_order_relaxed );
+            for ( uint32_t j = 0; j < instrumentationHistogramBucketCount; ++j )
+            {
+              counters->histograms[i][j].store( 0, std::memory_order_relaxed );
+            }
+          }
+        }
+      }
+
+      // one line per command: name,count,ticks,nanoseconds,bucket0,...,bucket31
+      static std::string toCSV( std::vector<InstrumentedCommandStatistics> const & statistics )
+      {
+        double      nanosecondsPerTick = 1.0 / ticksPerNanosecond();
+        std::string csv                = "command,count,ticks,nanoseconds";
+        for ( uint32_t j = 0; j < instrumentationHistogramBucketCount; ++j )
+        {
+          csv += ",bucket" + std::to_string( j );
+        }
+        csv += "\n";
+        for ( auto const & commandStatistics : statistics )
+        {
+          csv += std::string( commandStatistics.name ) + "," + std::to_string( commandStatistics.count ) + "," + std::to_string( commandStatistics.ticks ) + "," +
+                 std::to_string( commandStatistics.ticks * nanosecondsPerTick );
+          for ( auto bucket : commandStatistics.histogram )
+          {
+            csv += "," + std::to_string( bucket );
+          }
+          csv += "\n";
+        }
+        return csv;
+      }
+
+      static std::string toJSON( std::vector<InstrumentedCommandStatistics> const & statistics )
+      {
+        std::string json = "{\n  \"ticksPerNanosecond\": " + std::to_string( ticksPerNanosecond() ) + ",\n  \"commands\": [";
+        for ( size_t i = 0; i < statistics.size(); ++i )
+        {
+          json += std::string( i ? "," : "" ) + "\n    { \"name\": \"" + statistics[i].name + "\", \"count\": " + std::to_string( statistics[i].count ) +
+                  ", \"ticks\": " + std::to_string( statistics[i].ticks ) + ", \"histogram\": [";
+          for ( uint32_t j = 0; j < instrumentationHistogramBucketCount; ++j )
+          {
+            json += ( j ? ", " : "" ) + std::to_string( statistics[i].histogram[j] );
+          }
+          json += "] }";
+        }
+        json += "\n  ]\n}\n";
+        return json;
+      }
+    };
+
+    // A dispatcher with the same members as the Inner one (typically a DispatchLoaderDynamic), but each of them wrapped into an
+    // InstrumentedCommand. It owns the Inner dispatcher and forwards init() to it.
+    template <typename Inner>
+    class InstrumentingDispatcher : public DispatchLoaderBase
+    {
+    public:
+      //=== VK_VERSION_1_0 ===
+      InstrumentedCommand<PFN_vkCreateInstance>                               vkCreateInstance;
+      InstrumentedCommand<PFN_vkDestroyInstance>                              vkDestroyInstance;
+      InstrumentedCommand<PFN_vkEnumeratePhysicalDevices>                     vkEnumeratePhysicalDevices;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceFeatures>                    vkGetPhysicalDeviceFeatures;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceFormatProperties>            vkGetPhysicalDeviceFormatProperties;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceImageFormatProperties>       vkGetPhysicalDeviceImageFormatProperties;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceProperties>                  vkGetPhysicalDeviceProperties;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceQueueFamilyProperties>       vkGetPhysicalDeviceQueueFamilyProperties;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceMemoryProperties>            vkGetPhysicalDeviceMemoryProperties;
+      InstrumentedCommand<PFN_vkGetInstanceProcAddr>                          vkGetInstanceProcAddr;
+      InstrumentedCommand<PFN_vkGetDeviceProcAddr>                            vkGetDeviceProcAddr;
+      InstrumentedCommand<PFN_vkCreateDevice>                                 vkCreateDevice;
+      InstrumentedCommand<PFN_vkDestroyDevice>                                vkDestroyDevice;
+      InstrumentedCommand<PFN_vkEnumerateInstanceExtensionProperties>         vkEnumerateInstanceExtensionProperties;
+      InstrumentedCommand<PFN_vkEnumerateDeviceExtensionProperties>           vkEnumerateDeviceExtensionProperties;
+      InstrumentedCommand<PFN_vkEnumerateInstanceLayerProperties>             vkEnumerateInstanceLayerProperties;
+      InstrumentedCommand<PFN_vkEnumerateDeviceLayerProperties>               vkEnumerateDeviceLayerProperties;
+      InstrumentedCommand<PFN_vkGetDeviceQueue>                               vkGetDeviceQueue;
+      InstrumentedCommand<PFN_vkQueueSubmit>                                  vkQueueSubmit;
+      InstrumentedCommand<PFN_vkQueueWaitIdle>                                vkQueueWaitIdle;
+      InstrumentedCommand<PFN_vkDeviceWaitIdle>                               vkDeviceWaitIdle;
+      InstrumentedCommand<PFN_vkAllocateMemory>                               vkAllocateMemory;
+      InstrumentedCommand<PFN_vkFreeMemory>                                   vkFreeMemory;
+      InstrumentedCommand<PFN_vkMapMemory>                                    vkMapMemory;
+      InstrumentedCommand<PFN_vkUnmapMemory>                                  vkUnmapMemory;
+      InstrumentedCommand<PFN_vkFlushMappedMemoryRanges>                      vkFlushMappedMemoryRanges;
+      InstrumentedCommand<PFN_vkInvalidateMappedMemoryRanges>                 vkInvalidateMappedMemoryRanges;
+      InstrumentedCommand<PFN_vkGetDeviceMemoryCommitment>                    vkGetDeviceMemoryCommitment;
+      InstrumentedCommand<PFN_vkBindBufferMemory>                             vkBindBufferMemory;
+      InstrumentedCommand<PFN_vkBindImageMemory>                              vkBindImageMemory;
+      InstrumentedCommand<PFN_vkGetBufferMemoryRequirements>                  vkGetBufferMemoryRequirements;
+      InstrumentedCommand<PFN_vkGetImageMemoryRequirements>                   vkGetImageMemoryRequirements;
+      InstrumentedCommand<PFN_vkGetImageSparseMemoryRequirements>             vkGetImageSparseMemoryRequirements;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceSparseImageFormatProperties> vkGetPhysicalDeviceSparseImageFormatProperties;
+      InstrumentedCommand<PFN_vkQueueBindSparse>                              vkQueueBindSparse;
+      InstrumentedCommand<PFN_vkCreateFence>                                  vkCreateFence;
+      InstrumentedCommand<PFN_vkDestroyFence>                                 vkDestroyFence;
+      InstrumentedCommand<PFN_vkResetFences>                                  vkResetFences;
+      InstrumentedCommand<PFN_vkGetFenceStatus>                               vkGetFenceStatus;
+      InstrumentedCommand<PFN_vkWaitForFences>                                vkWaitForFences;
+      InstrumentedCommand<PFN_vkCreateSemaphore>                              vkCreateSemaphore;
+      InstrumentedCommand<PFN_vkDestroySemaphore>                             vkDestroySemaphore;
+      InstrumentedCommand<PFN_vkCreateQueryPool>                              vkCreateQueryPool;
+      InstrumentedCommand<PFN_vkDestroyQueryPool>                             vkDestroyQueryPool;
+      InstrumentedCommand<PFN_vkGetQueryPoolResults>                          vkGetQueryPoolResults;
+      InstrumentedCommand<PFN_vkCreateBuffer>                                 vkCreateBuffer;
+      InstrumentedCommand<PFN_vkDestroyBuffer>                                vkDestroyBuffer;
+      InstrumentedCommand<PFN_vkCreateImage>                                  vkCreateImage;
+      InstrumentedCommand<PFN_vkDestroyImage>                                 vkDestroyImage;
+      InstrumentedCommand<PFN_vkGetImageSubresourceLayout>                    vkGetImageSubresourceLayout;
+      InstrumentedCommand<PFN_vkCreateImageView>                              vkCreateImageView;
+      InstrumentedCommand<PFN_vkDestroyImageView>                             vkDestroyImageView;
+      InstrumentedCommand<PFN_vkCreateCommandPool>                            vkCreateCommandPool;
+      InstrumentedCommand<PFN_vkDestroyCommandPool>                           vkDestroyCommandPool;
+      InstrumentedCommand<PFN_vkResetCommandPool>                             vkResetCommandPool;
+      InstrumentedCommand<PFN_vkAllocateCommandBuffers>                       vkAllocateCommandBuffers;
+      InstrumentedCommand<PFN_vkFreeCommandBuffers>                           vkFreeCommandBuffers;
+      InstrumentedCommand<PFN_vkBeginCommandBuffer>                           vkBeginCommandBuffer;
+      InstrumentedCommand<PFN_vkEndCommandBuffer>                             vkEndCommandBuffer;
+      InstrumentedCommand<PFN_vkResetCommandBuffer>                           vkResetCommandBuffer;
+      InstrumentedCommand<PFN_vkCmdCopyBuffer>                                vkCmdCopyBuffer;
+      InstrumentedCommand<PFN_vkCmdCopyImage>                                 vkCmdCopyImage;
+      InstrumentedCommand<PFN_vkCmdCopyBufferToImage>                         vkCmdCopyBufferToImage;
+      InstrumentedCommand<PFN_vkCmdCopyImageToBuffer>                         vkCmdCopyImageToBuffer;
+      InstrumentedCommand<PFN_vkCmdUpdateBuffer>                              vkCmdUpdateBuffer;
+      InstrumentedCommand<PFN_vkCmdFillBuffer>                                vkCmdFillBuffer;
+      InstrumentedCommand<PFN_vkCmdPipelineBarrier>                           vkCmdPipelineBarrier;
+      InstrumentedCommand<PFN_vkCmdBeginQuery>                                vkCmdBeginQuery;
+      InstrumentedCommand<PFN_vkCmdEndQuery>                                  vkCmdEndQuery;
+      InstrumentedCommand<PFN_vkCmdResetQueryPool>                            vkCmdResetQueryPool;
+      InstrumentedCommand<PFN_vkCmdWriteTimestamp>                            vkCmdWriteTimestamp;
+      InstrumentedCommand<PFN_vkCmdCopyQueryPoolResults>                      vkCmdCopyQueryPoolResults;
+      InstrumentedCommand<PFN_vkCmdExecuteCommands>                           vkCmdExecuteCommands;
+      InstrumentedCommand<PFN_vkCreateEvent>                                  vkCreateEvent;
+      InstrumentedCommand<PFN_vkDestroyEvent>                                 vkDestroyEvent;
+      InstrumentedCommand<PFN_vkGetEventStatus>                               vkGetEventStatus;
+      InstrumentedCommand<PFN_vkSetEvent>                                     vkSetEvent;
+      InstrumentedCommand<PFN_vkResetEvent>                                   vkResetEvent;
+      InstrumentedCommand<PFN_vkCreateBufferView>                             vkCreateBufferView;
+      InstrumentedCommand<PFN_vkDestroyBufferView>                            vkDestroyBufferView;
+      InstrumentedCommand<PFN_vkCreateShaderModule>                           vkCreateShaderModule;
+      InstrumentedCommand<PFN_vkDestroyShaderModule>                          vkDestroyShaderModule;
+      InstrumentedCommand<PFN_vkCreatePipelineCache>                          vkCreatePipelineCache;
+      InstrumentedCommand<PFN_vkDestroyPipelineCache>                         vkDestroyPipelineCache;
+      InstrumentedCommand<PFN_vkGetPipelineCacheData>                         vkGetPipelineCacheData;
+      InstrumentedCommand<PFN_vkMergePipelineCaches>                          vkMergePipelineCaches;
+      InstrumentedCommand<PFN_vkCreateComputePipelines>                       vkCreateComputePipelines;
+      InstrumentedCommand<PFN_vkDestroyPipeline>                              vkDestroyPipeline;
+      InstrumentedCommand<PFN_vkCreatePipelineLayout>                         vkCreatePipelineLayout;
+      InstrumentedCommand<PFN_vkDestroyPipelineLayout>                        vkDestroyPipelineLayout;
+      InstrumentedCommand<PFN_vkCreateSampler>                                vkCreateSampler;
+      InstrumentedCommand<PFN_vkDestroySampler>                               vkDestroySampler;
+      InstrumentedCommand<PFN_vkCreateDescriptorSetLayout>                    vkCreateDescriptorSetLayout;
+      InstrumentedCommand<PFN_vkDestroyDescriptorSetLayout>                   vkDestroyDescriptorSetLayout;
+      InstrumentedCommand<PFN_vkCreateDescriptorPool>                         vkCreateDescriptorPool;
+      InstrumentedCommand<PFN_vkDestroyDescriptorPool>                        vkDestroyDescriptorPool;
+      InstrumentedCommand<PFN_vkResetDescriptorPool>                          vkResetDescriptorPool;
+      InstrumentedCommand<PFN_vkAllocateDescriptorSets>                       vkAllocateDescriptorSets;
+      InstrumentedCommand<PFN_vkFreeDescriptorSets>                           vkFreeDescriptorSets;
+      InstrumentedCommand<PFN_vkUpdateDescriptorSets>                         vkUpdateDescriptorSets;
+      InstrumentedCommand<PFN_vkCmdBindPipeline>                              vkCmdBindPipeline;
+      InstrumentedCommand<PFN_vkCmdBindDescriptorSets>                        vkCmdBindDescriptorSets;
+      InstrumentedCommand<PFN_vkCmdClearColorImage>                           vkCmdClearColorImage;
+      InstrumentedCommand<PFN_vkCmdDispatch>                                  vkCmdDispatch;
+      InstrumentedCommand<PFN_vkCmdDispatchIndirect>                          vkCmdDispatchIndirect;
+      InstrumentedCommand<PFN_vkCmdSetEvent>                                  vkCmdSetEvent;
+      InstrumentedCommand<PFN_vkCmdResetEvent>                                vkCmdResetEvent;
+      InstrumentedCommand<PFN_vkCmdWaitEvents>                                vkCmdWaitEvents;
+      InstrumentedCommand<PFN_vkCmdPushConstants>                             vkCmdPushConstants;
+      InstrumentedCommand<PFN_vkCreateGraphicsPipelines>                      vkCreateGraphicsPipelines;
+      InstrumentedCommand<PFN_vkCreateFramebuffer>                            vkCreateFramebuffer;
+      InstrumentedCommand<PFN_vkDestroyFramebuffer>                           vkDestroyFramebuffer;
+      InstrumentedCommand<PFN_vkCreateRenderPass>                             vkCreateRenderPass;
+      InstrumentedCommand<PFN_vkDestroyRenderPass>                            vkDestroyRenderPass;
+      InstrumentedCommand<PFN_vkGetRenderAreaGranularity>                     vkGetRenderAreaGranularity;
+      InstrumentedCommand<PFN_vkCmdSetViewport>                               vkCmdSetViewport;
+      InstrumentedCommand<PFN_vkCmdSetScissor>                                vkCmdSetScissor;
+      InstrumentedCommand<PFN_vkCmdSetLineWidth>                              vkCmdSetLineWidth;
+      InstrumentedCommand<PFN_vkCmdSetDepthBias>                              vkCmdSetDepthBias;
+      InstrumentedCommand<PFN_vkCmdSetBlendConstants>                         vkCmdSetBlendConstants;
+      InstrumentedCommand<PFN_vkCmdSetDepthBounds>                            vkCmdSetDepthBounds;
+      InstrumentedCommand<PFN_vkCmdSetStencilCompareMask>                     vkCmdSetStencilCompareMask;
+      InstrumentedCommand<PFN_vkCmdSetStencilWriteMask>                       vkCmdSetStencilWriteMask;
+      InstrumentedCommand<PFN_vkCmdSetStencilReference>                       vkCmdSetStencilReference;
+      InstrumentedCommand<PFN_vkCmdBindIndexBuffer>                           vkCmdBindIndexBuffer;
+      InstrumentedCommand<PFN_vkCmdBindVertexBuffers>                         vkCmdBindVertexBuffers;
+      InstrumentedCommand<PFN_vkCmdDraw>                                      vkCmdDraw;
+      InstrumentedCommand<PFN_vkCmdDrawIndexed>                               vkCmdDrawIndexed;
+      InstrumentedCommand<PFN_vkCmdDrawIndirect>                              vkCmdDrawIndirect;
+      InstrumentedCommand<PFN_vkCmdDrawIndexedIndirect>                       vkCmdDrawIndexedIndirect;
+      InstrumentedCommand<PFN_vkCmdBlitImage>                                 vkCmdBlitImage;
+      InstrumentedCommand<PFN_vkCmdClearDepthStencilImage>                    vkCmdClearDepthStencilImage;
+      InstrumentedCommand<PFN_vkCmdClearAttachments>                          vkCmdClearAttachments;
+      InstrumentedCommand<PFN_vkCmdResolveImage>                              vkCmdResolveImage;
+      InstrumentedCommand<PFN_vkCmdBeginRenderPass>                           vkCmdBeginRenderPass;
+      InstrumentedCommand<PFN_vkCmdNextSubpass>                               vkCmdNextSubpass;
+      InstrumentedCommand<PFN_vkCmdEndRenderPass>                             vkCmdEndRenderPass;
+
+      //=== VK_VERSION_1_1 ===
+      InstrumentedCommand<PFN_vkEnumerateInstanceVersion>                      vkEnumerateInstanceVersion;
+      InstrumentedCommand<PFN_vkBindBufferMemory2>                             vkBindBufferMemory2;
+      InstrumentedCommand<PFN_vkBindImageMemory2>                              vkBindImageMemory2;
+      InstrumentedCommand<PFN_vkGetDeviceGroupPeerMemoryFeatures>              vkGetDeviceGroupPeerMemoryFeatures;
+      InstrumentedCommand<PFN_vkCmdSetDeviceMask>                              vkCmdSetDeviceMask;
+      InstrumentedCommand<PFN_vkEnumeratePhysicalDeviceGroups>                 vkEnumeratePhysicalDeviceGroups;
+      InstrumentedCommand<PFN_vkGetImageMemoryRequirements2>                   vkGetImageMemoryRequirements2;
+      InstrumentedCommand<PFN_vkGetBufferMemoryRequirements2>                  vkGetBufferMemoryRequirements2;
+      InstrumentedCommand<PFN_vkGetImageSparseMemoryRequirements2>             vkGetImageSparseMemoryRequirements2;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceFeatures2>                    vkGetPhysicalDeviceFeatures2;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceProperties2>                  vkGetPhysicalDeviceProperties2;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceFormatProperties2>            vkGetPhysicalDeviceFormatProperties2;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceImageFormatProperties2>       vkGetPhysicalDeviceImageFormatProperties2;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceQueueFamilyProperties2>       vkGetPhysicalDeviceQueueFamilyProperties2;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceMemoryProperties2>            vkGetPhysicalDeviceMemoryProperties2;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceSparseImageFormatProperties2> vkGetPhysicalDeviceSparseImageFormatProperties2;
+      InstrumentedCommand<PFN_vkTrimCommandPool>                               vkTrimCommandPool;
+      InstrumentedCommand<PFN_vkGetDeviceQueue2>                               vkGetDeviceQueue2;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceExternalBufferProperties>     vkGetPhysicalDeviceExternalBufferProperties;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceExternalFenceProperties>      vkGetPhysicalDeviceExternalFenceProperties;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceExternalSemaphoreProperties>  vkGetPhysicalDeviceExternalSemaphoreProperties;
+      InstrumentedCommand<PFN_vkCmdDispatchBase>                               vkCmdDispatchBase;
+      InstrumentedCommand<PFN_vkCreateDescriptorUpdateTemplate>                vkCreateDescriptorUpdateTemplate;
+      InstrumentedCommand<PFN_vkDestroyDescriptorUpdateTemplate>               vkDestroyDescriptorUpdateTemplate;
+      InstrumentedCommand<PFN_vkUpdateDescriptorSetWithTemplate>               vkUpdateDescriptorSetWithTemplate;
+      InstrumentedCommand<PFN_vkGetDescriptorSetLayoutSupport>                 vkGetDescriptorSetLayoutSupport;
+      InstrumentedCommand<PFN_vkCreateSamplerYcbcrConversion>                  vkCreateSamplerYcbcrConversion;
+      InstrumentedCommand<PFN_vkDestroySamplerYcbcrConversion>                 vkDestroySamplerYcbcrConversion;
+
+      //=== VK_VERSION_1_2 ===
+      InstrumentedCommand<PFN_vkResetQueryPool>                      vkResetQueryPool;
+      InstrumentedCommand<PFN_vkGetSemaphoreCounterValue>            vkGetSemaphoreCounterValue;
+      InstrumentedCommand<PFN_vkWaitSemaphores>                      vkWaitSemaphores;
+      InstrumentedCommand<PFN_vkSignalSemaphore>                     vkSignalSemaphore;
+      InstrumentedCommand<PFN_vkGetBufferDeviceAddress>              vkGetBufferDeviceAddress;
+      InstrumentedCommand<PFN_vkGetBufferOpaqueCaptureAddress>       vkGetBufferOpaqueCaptureAddress;
+      InstrumentedCommand<PFN_vkGetDeviceMemoryOpaqueCaptureAddress> vkGetDeviceMemoryOpaqueCaptureAddress;
+      InstrumentedCommand<PFN_vkCmdDrawIndirectCount>                vkCmdDrawIndirectCount;
+      InstrumentedCommand<PFN_vkCmdDrawIndexedIndirectCount>         vkCmdDrawIndexedIndirectCount;
+      InstrumentedCommand<PFN_vkCreateRenderPass2>                   vkCreateRenderPass2;
+      InstrumentedCommand<PFN_vkCmdBeginRenderPass2>                 vkCmdBeginRenderPass2;
+      InstrumentedCommand<PFN_vkCmdNextSubpass2>                     vkCmdNextSubpass2;
+      InstrumentedCommand<PFN_vkCmdEndRenderPass2>                   vkCmdEndRenderPass2;
+
+      //=== VK_VERSION_1_3 ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceToolProperties>        vkGetPhysicalDeviceToolProperties;
+      InstrumentedCommand<PFN_vkCreatePrivateDataSlot>                  vkCreatePrivateDataSlot;
+      InstrumentedCommand<PFN_vkDestroyPrivateDataSlot>                 vkDestroyPrivateDataSlot;
+      InstrumentedCommand<PFN_vkSetPrivateData>                         vkSetPrivateData;
+      InstrumentedCommand<PFN_vkGetPrivateData>                         vkGetPrivateData;
+      InstrumentedCommand<PFN_vkCmdPipelineBarrier2>                    vkCmdPipelineBarrier2;
+      InstrumentedCommand<PFN_vkCmdWriteTimestamp2>                     vkCmdWriteTimestamp2;
+      InstrumentedCommand<PFN_vkQueueSubmit2>                           vkQueueSubmit2;
+      InstrumentedCommand<PFN_vkCmdCopyBuffer2>                         vkCmdCopyBuffer2;
+      InstrumentedCommand<PFN_vkCmdCopyImage2>                          vkCmdCopyImage2;
+      InstrumentedCommand<PFN_vkCmdCopyBufferToImage2>                  vkCmdCopyBufferToImage2;
+      InstrumentedCommand<PFN_vkCmdCopyImageToBuffer2>                  vkCmdCopyImageToBuffer2;
+      InstrumentedCommand<PFN_vkGetDeviceBufferMemoryRequirements>      vkGetDeviceBufferMemoryRequirements;
+      InstrumentedCommand<PFN_vkGetDeviceImageMemoryRequirements>       vkGetDeviceImageMemoryRequirements;
+      InstrumentedCommand<PFN_vkGetDeviceImageSparseMemoryRequirements> vkGetDeviceImageSparseMemoryRequirements;
+      InstrumentedCommand<PFN_vkCmdSetEvent2>                           vkCmdSetEvent2;
+      InstrumentedCommand<PFN_vkCmdResetEvent2>                         vkCmdResetEvent2;
+      InstrumentedCommand<PFN_vkCmdWaitEvents2>                         vkCmdWaitEvents2;
+      InstrumentedCommand<PFN_vkCmdBlitImage2>                          vkCmdBlitImage2;
+      InstrumentedCommand<PFN_vkCmdResolveImage2>                       vkCmdResolveImage2;
+      InstrumentedCommand<PFN_vkCmdBeginRendering>                      vkCmdBeginRendering;
+      InstrumentedCommand<PFN_vkCmdEndRendering>                        vkCmdEndRendering;
+      InstrumentedCommand<PFN_vkCmdSetCullMode>                         vkCmdSetCullMode;
+      InstrumentedCommand<PFN_vkCmdSetFrontFace>                        vkCmdSetFrontFace;
+      InstrumentedCommand<PFN_vkCmdSetPrimitiveTopology>                vkCmdSetPrimitiveTopology;
+      InstrumentedCommand<PFN_vkCmdSetViewportWithCount>                vkCmdSetViewportWithCount;
+      InstrumentedCommand<PFN_vkCmdSetScissorWithCount>                 vkCmdSetScissorWithCount;
+      InstrumentedCommand<PFN_vkCmdBindVertexBuffers2>                  vkCmdBindVertexBuffers2;
+      InstrumentedCommand<PFN_vkCmdSetDepthTestEnable>                  vkCmdSetDepthTestEnable;
+      InstrumentedCommand<PFN_vkCmdSetDepthWriteEnable>                 vkCmdSetDepthWriteEnable;
+      InstrumentedCommand<PFN_vkCmdSetDepthCompareOp>                   vkCmdSetDepthCompareOp;
+      InstrumentedCommand<PFN_vkCmdSetDepthBoundsTestEnable>            vkCmdSetDepthBoundsTestEnable;
+      InstrumentedCommand<PFN_vkCmdSetStencilTestEnable>                vkCmdSetStencilTestEnable;
+      InstrumentedCommand<PFN_vkCmdSetStencilOp>                        vkCmdSetStencilOp;
+      InstrumentedCommand<PFN_vkCmdSetRasterizerDiscardEnable>          vkCmdSetRasterizerDiscardEnable;
+      InstrumentedCommand<PFN_vkCmdSetDepthBiasEnable>                  vkCmdSetDepthBiasEnable;
+      InstrumentedCommand<PFN_vkCmdSetPrimitiveRestartEnable>           vkCmdSetPrimitiveRestartEnable;
+
+      //=== VK_VERSION_1_4 ===
+      InstrumentedCommand<PFN_vkMapMemory2>                            vkMapMemory2;
+      InstrumentedCommand<PFN_vkUnmapMemory2>                          vkUnmapMemory2;
+      InstrumentedCommand<PFN_vkGetDeviceImageSubresourceLayout>       vkGetDeviceImageSubresourceLayout;
+      InstrumentedCommand<PFN_vkGetImageSubresourceLayout2>            vkGetImageSubresourceLayout2;
+      InstrumentedCommand<PFN_vkCopyMemoryToImage>                     vkCopyMemoryToImage;
+      InstrumentedCommand<PFN_vkCopyImageToMemory>                     vkCopyImageToMemory;
+      InstrumentedCommand<PFN_vkCopyImageToImage>                      vkCopyImageToImage;
+      InstrumentedCommand<PFN_vkTransitionImageLayout>                 vkTransitionImageLayout;
+      InstrumentedCommand<PFN_vkCmdPushDescriptorSet>                  vkCmdPushDescriptorSet;
+      InstrumentedCommand<PFN_vkCmdPushDescriptorSetWithTemplate>      vkCmdPushDescriptorSetWithTemplate;
+      InstrumentedCommand<PFN_vkCmdBindDescriptorSets2>                vkCmdBindDescriptorSets2;
+      InstrumentedCommand<PFN_vkCmdPushConstants2>                     vkCmdPushConstants2;
+      InstrumentedCommand<PFN_vkCmdPushDescriptorSet2>                 vkCmdPushDescriptorSet2;
+      InstrumentedCommand<PFN_vkCmdPushDescriptorSetWithTemplate2>     vkCmdPushDescriptorSetWithTemplate2;
+      InstrumentedCommand<PFN_vkCmdSetLineStipple>                     vkCmdSetLineStipple;
+      InstrumentedCommand<PFN_vkCmdBindIndexBuffer2>                   vkCmdBindIndexBuffer2;
+      InstrumentedCommand<PFN_vkGetRenderingAreaGranularity>           vkGetRenderingAreaGranularity;
+      InstrumentedCommand<PFN_vkCmdSetRenderingAttachmentLocations>    vkCmdSetRenderingAttachmentLocations;
+      InstrumentedCommand<PFN_vkCmdSetRenderingInputAttachmentIndices> vkCmdSetRenderingInputAttachmentIndices;
+
+      //=== VK_KHR_surface ===
+      InstrumentedCommand<PFN_vkDestroySurfaceKHR>                       vkDestroySurfaceKHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceSurfaceSupportKHR>      vkGetPhysicalDeviceSurfaceSupportKHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR> vkGetPhysicalDeviceSurfaceCapabilitiesKHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceSurfaceFormatsKHR>      vkGetPhysicalDeviceSurfaceFormatsKHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceSurfacePresentModesKHR> vkGetPhysicalDeviceSurfacePresentModesKHR;
+
+      //=== VK_KHR_swapchain ===
+      InstrumentedCommand<PFN_vkCreateSwapchainKHR>                    vkCreateSwapchainKHR;
+      InstrumentedCommand<PFN_vkDestroySwapchainKHR>                   vkDestroySwapchainKHR;
+      InstrumentedCommand<PFN_vkGetSwapchainImagesKHR>                 vkGetSwapchainImagesKHR;
+      InstrumentedCommand<PFN_vkAcquireNextImageKHR>                   vkAcquireNextImageKHR;
+      InstrumentedCommand<PFN_vkQueuePresentKHR>                       vkQueuePresentKHR;
+      InstrumentedCommand<PFN_vkGetDeviceGroupPresentCapabilitiesKHR>  vkGetDeviceGroupPresentCapabilitiesKHR;
+      InstrumentedCommand<PFN_vkGetDeviceGroupSurfacePresentModesKHR>  vkGetDeviceGroupSurfacePresentModesKHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDevicePresentRectanglesKHR> vkGetPhysicalDevicePresentRectanglesKHR;
+      InstrumentedCommand<PFN_vkAcquireNextImage2KHR>                  vkAcquireNextImage2KHR;
+
+      //=== VK_KHR_display ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceDisplayPropertiesKHR>      vkGetPhysicalDeviceDisplayPropertiesKHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR> vkGetPhysicalDeviceDisplayPlanePropertiesKHR;
+      InstrumentedCommand<PFN_vkGetDisplayPlaneSupportedDisplaysKHR>        vkGetDisplayPlaneSupportedDisplaysKHR;
+      InstrumentedCommand<PFN_vkGetDisplayModePropertiesKHR>                vkGetDisplayModePropertiesKHR;
+      InstrumentedCommand<PFN_vkCreateDisplayModeKHR>                       vkCreateDisplayModeKHR;
+      InstrumentedCommand<PFN_vkGetDisplayPlaneCapabilitiesKHR>             vkGetDisplayPlaneCapabilitiesKHR;
+      InstrumentedCommand<PFN_vkCreateDisplayPlaneSurfaceKHR>               vkCreateDisplayPlaneSurfaceKHR;
+
+      //=== VK_KHR_display_swapchain ===
+      InstrumentedCommand<PFN_vkCreateSharedSwapchainsKHR> vkCreateSharedSwapchainsKHR;
+
+#  if defined( VK_USE_PLATFORM_XLIB_KHR )
+      //=== VK_KHR_xlib_surface ===
+      InstrumentedCommand<PFN_vkCreateXlibSurfaceKHR>                        vkCreateXlibSurfaceKHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR> vkGetPhysicalDeviceXlibPresentationSupportKHR;
+#  else
+      InstrumentedCommandPlaceholder vkCreateXlibSurfaceKHR_placeholder;
+      InstrumentedCommandPlaceholder vkGetPhysicalDeviceXlibPresentationSupportKHR_placeholder;
+#  endif /*VK_USE_PLATFORM_XLIB_KHR*/
+
+#  if defined( VK_USE_PLATFORM_XCB_KHR )
+      //=== VK_KHR_xcb_surface ===
+      InstrumentedCommand<PFN_vkCreateXcbSurfaceKHR>                        vkCreateXcbSurfaceKHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR> vkGetPhysicalDeviceXcbPresentationSupportKHR;
+#  else
+      InstrumentedCommandPlaceholder vkCreateXcbSurfaceKHR_placeholder;
+      InstrumentedCommandPlaceholder vkGetPhysicalDeviceXcbPresentationSupportKHR_placeholder;
+#  endif /*VK_USE_PLATFORM_XCB_KHR*/
+
+#  if defined( VK_USE_PLATFORM_WAYLAND_KHR )
+      //=== VK_KHR_wayland_surface ===
+      InstrumentedCommand<PFN_vkCreateWaylandSurfaceKHR>                        vkCreateWaylandSurfaceKHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR> vkGetPhysicalDeviceWaylandPresentationSupportKHR;
+#  else
+      InstrumentedCommandPlaceholder vkCreateWaylandSurfaceKHR_placeholder;
+      InstrumentedCommandPlaceholder vkGetPhysicalDeviceWaylandPresentationSupportKHR_placeholder;
+#  endif /*VK_USE_PLATFORM_WAYLAND_KHR*/
+
+#  if defined( VK_USE_PLATFORM_ANDROID_KHR )
+      //=== VK_KHR_android_surface ===
+      InstrumentedCommand<PFN_vkCreateAndroidSurfaceKHR> vkCreateAndroidSurfaceKHR;
+#  else
+      InstrumentedCommandPlaceholder vkCreateAndroidSurfaceKHR_placeholder;
+#  endif /*VK_USE_PLATFORM_ANDROID_KHR*/
+
+#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+      //=== VK_KHR_win32_surface ===
+      InstrumentedCommand<PFN_vkCreateWin32SurfaceKHR>                        vkCreateWin32SurfaceKHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR> vkGetPhysicalDeviceWin32PresentationSupportKHR;
+#  else
+      InstrumentedCommandPlaceholder vkCreateWin32SurfaceKHR_placeholder;
+      InstrumentedCommandPlaceholder vkGetPhysicalDeviceWin32PresentationSupportKHR_placeholder;
+#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+      //=== VK_EXT_debug_report ===
+      InstrumentedCommand<PFN_vkCreateDebugReportCallbackEXT>  vkCreateDebugReportCallbackEXT;
+      InstrumentedCommand<PFN_vkDestroyDebugReportCallbackEXT> vkDestroyDebugReportCallbackEXT;
+      InstrumentedCommand<PFN_vkDebugReportMessageEXT>         vkDebugReportMessageEXT;
+
+      //=== VK_EXT_debug_marker ===
+      InstrumentedCommand<PFN_vkDebugMarkerSetObjectTagEXT>  vkDebugMarkerSetObjectTagEXT;
+      InstrumentedCommand<PFN_vkDebugMarkerSetObjectNameEXT> vkDebugMarkerSetObjectNameEXT;
+      InstrumentedCommand<PFN_vkCmdDebugMarkerBeginEXT>      vkCmdDebugMarkerBeginEXT;
+      InstrumentedCommand<PFN_vkCmdDebugMarkerEndEXT>        vkCmdDebugMarkerEndEXT;
+      InstrumentedCommand<PFN_vkCmdDebugMarkerInsertEXT>     vkCmdDebugMarkerInsertEXT;
+
+      //=== VK_KHR_video_queue ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceVideoCapabilitiesKHR>     vkGetPhysicalDeviceVideoCapabilitiesKHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceVideoFormatPropertiesKHR> vkGetPhysicalDeviceVideoFormatPropertiesKHR;
+      InstrumentedCommand<PFN_vkCreateVideoSessionKHR>                     vkCreateVideoSessionKHR;
+      InstrumentedCommand<PFN_vkDestroyVideoSessionKHR>                    vkDestroyVideoSessionKHR;
+      InstrumentedCommand<PFN_vkGetVideoSessionMemoryRequirementsKHR>      vkGetVideoSessionMemoryRequirementsKHR;
+      InstrumentedCommand<PFN_vkBindVideoSessionMemoryKHR>                 vkBindVideoSessionMemoryKHR;
+      InstrumentedCommand<PFN_vkCreateVideoSessionParametersKHR>           vkCreateVideoSessionParametersKHR;
+      InstrumentedCommand<PFN_vkUpdateVideoSessionParametersKHR>           vkUpdateVideoSessionParametersKHR;
+      InstrumentedCommand<PFN_vkDestroyVideoSessionParametersKHR>          vkDestroyVideoSessionParametersKHR;
+      InstrumentedCommand<PFN_vkCmdBeginVideoCodingKHR>                    vkCmdBeginVideoCodingKHR;
+      InstrumentedCommand<PFN_vkCmdEndVideoCodingKHR>                      vkCmdEndVideoCodingKHR;
+      InstrumentedCommand<PFN_vkCmdControlVideoCodingKHR>                  vkCmdControlVideoCodingKHR;
+
+      //=== VK_KHR_video_decode_queue ===
+      InstrumentedCommand<PFN_vkCmdDecodeVideoKHR> vkCmdDecodeVideoKHR;
+
+      //=== VK_EXT_transform_feedback ===
+      InstrumentedCommand<PFN_vkCmdBindTransformFeedbackBuffersEXT> vkCmdBindTransformFeedbackBuffersEXT;
+      InstrumentedCommand<PFN_vkCmdBeginTransformFeedbackEXT>       vkCmdBeginTransformFeedbackEXT;
+      InstrumentedCommand<PFN_vkCmdEndTransformFeedbackEXT>         vkCmdEndTransformFeedbackEXT;
+      InstrumentedCommand<PFN_vkCmdBeginQueryIndexedEXT>            vkCmdBeginQueryIndexedEXT;
+      InstrumentedCommand<PFN_vkCmdEndQueryIndexedEXT>              vkCmdEndQueryIndexedEXT;
+      InstrumentedCommand<PFN_vkCmdDrawIndirectByteCountEXT>        vkCmdDrawIndirectByteCountEXT;
+
+      //=== VK_NVX_binary_import ===
+      InstrumentedCommand<PFN_vkCreateCuModuleNVX>    vkCreateCuModuleNVX;
+      InstrumentedCommand<PFN_vkCreateCuFunctionNVX>  vkCreateCuFunctionNVX;
+      InstrumentedCommand<PFN_vkDestroyCuModuleNVX>   vkDestroyCuModuleNVX;
+      InstrumentedCommand<PFN_vkDestroyCuFunctionNVX> vkDestroyCuFunctionNVX;
+      InstrumentedCommand<PFN_vkCmdCuLaunchKernelNVX> vkCmdCuLaunchKernelNVX;
+
+      //=== VK_NVX_image_view_handle ===
+      InstrumentedCommand<PFN_vkGetImageViewHandleNVX>                 vkGetImageViewHandleNVX;
+      InstrumentedCommand<PFN_vkGetImageViewHandle64NVX>               vkGetImageViewHandle64NVX;
+      InstrumentedCommand<PFN_vkGetImageViewAddressNVX>                vkGetImageViewAddressNVX;
+      InstrumentedCommand<PFN_vkGetDeviceCombinedImageSamplerIndexNVX> vkGetDeviceCombinedImageSamplerIndexNVX;
+
+      //=== VK_AMD_draw_indirect_count ===
+      InstrumentedCommand<PFN_vkCmdDrawIndirectCountAMD>        vkCmdDrawIndirectCountAMD;
+      InstrumentedCommand<PFN_vkCmdDrawIndexedIndirectCountAMD> vkCmdDrawIndexedIndirectCountAMD;
+
+      //=== VK_AMD_shader_info ===
+      InstrumentedCommand<PFN_vkGetShaderInfoAMD> vkGetShaderInfoAMD;
+
+      //=== VK_KHR_dynamic_rendering ===
+      InstrumentedCommand<PFN_vkCmdBeginRenderingKHR> vkCmdBeginRenderingKHR;
+      InstrumentedCommand<PFN_vkCmdEndRenderingKHR>   vkCmdEndRenderingKHR;
+
+#  if defined( VK_USE_PLATFORM_GGP )
+      //=== VK_GGP_stream_descriptor_surface ===
+      InstrumentedCommand<PFN_vkCreateStreamDescriptorSurfaceGGP> vkCreateStreamDescriptorSurfaceGGP;
+#  else
+      InstrumentedCommandPlaceholder vkCreateStreamDescriptorSurfaceGGP_placeholder;
+#  endif /*VK_USE_PLATFORM_GGP*/
+
+      //=== VK_NV_external_memory_capabilities ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceExternalImageFormatPropertiesNV> vkGetPhysicalDeviceExternalImageFormatPropertiesNV;
+
+#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+      //=== VK_NV_external_memory_win32 ===
+      InstrumentedCommand<PFN_vkGetMemoryWin32HandleNV> vkGetMemoryWin32HandleNV;
+#  else
+      InstrumentedCommandPlaceholder vkGetMemoryWin32HandleNV_placeholder;
+#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+      //=== VK_KHR_get_physical_device_properties2 ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceFeatures2KHR>                    vkGetPhysicalDeviceFeatures2KHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceProperties2KHR>                  vkGetPhysicalDeviceProperties2KHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceFormatProperties2KHR>            vkGetPhysicalDeviceFormatProperties2KHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceImageFormatProperties2KHR>       vkGetPhysicalDeviceImageFormatProperties2KHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceQueueFamilyProperties2KHR>       vkGetPhysicalDeviceQueueFamilyProperties2KHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceMemoryProperties2KHR>            vkGetPhysicalDeviceMemoryProperties2KHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceSparseImageFormatProperties2KHR> vkGetPhysicalDeviceSparseImageFormatProperties2KHR;
+
+      //=== VK_KHR_device_group ===
+      InstrumentedCommand<PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR> vkGetDeviceGroupPeerMemoryFeaturesKHR;
+      InstrumentedCommand<PFN_vkCmdSetDeviceMaskKHR>                 vkCmdSetDeviceMaskKHR;
+      InstrumentedCommand<PFN_vkCmdDispatchBaseKHR>                  vkCmdDispatchBaseKHR;
+
+#  if defined( VK_USE_PLATFORM_VI_NN )
+      //=== VK_NN_vi_surface ===
+      InstrumentedCommand<PFN_vkCreateViSurfaceNN> vkCreateViSurfaceNN;
+#  else
+      InstrumentedCommandPlaceholder vkCreateViSurfaceNN_placeholder;
+#  endif /*VK_USE_PLATFORM_VI_NN*/
+
+      //=== VK_KHR_maintenance1 ===
+      InstrumentedCommand<PFN_vkTrimCommandPoolKHR> vkTrimCommandPoolKHR;
+
+      //=== VK_KHR_device_group_creation ===
+      InstrumentedCommand<PFN_vkEnumeratePhysicalDeviceGroupsKHR> vkEnumeratePhysicalDeviceGroupsKHR;
+
+      //=== VK_KHR_external_memory_capabilities ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceExternalBufferPropertiesKHR> vkGetPhysicalDeviceExternalBufferPropertiesKHR;
+
+#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+      //=== VK_KHR_external_memory_win32 ===
+      InstrumentedCommand<PFN_vkGetMemoryWin32HandleKHR>           vkGetMemoryWin32HandleKHR;
+      InstrumentedCommand<PFN_vkGetMemoryWin32HandlePropertiesKHR> vkGetMemoryWin32HandlePropertiesKHR;
+#  else
+      InstrumentedCommandPlaceholder vkGetMemoryWin32HandleKHR_placeholder;
+      InstrumentedCommandPlaceholder vkGetMemoryWin32HandlePropertiesKHR_placeholder;
+#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+      //=== VK_KHR_external_memory_fd ===
+      InstrumentedCommand<PFN_vkGetMemoryFdKHR>           vkGetMemoryFdKHR;
+      InstrumentedCommand<PFN_vkGetMemoryFdPropertiesKHR> vkGetMemoryFdPropertiesKHR;
+
+      //=== VK_KHR_external_semaphore_capabilities ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR> vkGetPhysicalDeviceExternalSemaphorePropertiesKHR;
+
+#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+      //=== VK_KHR_external_semaphore_win32 ===
+      InstrumentedCommand<PFN_vkImportSemaphoreWin32HandleKHR> vkImportSemaphoreWin32HandleKHR;
+      InstrumentedCommand<PFN_vkGetSemaphoreWin32HandleKHR>    vkGetSemaphoreWin32HandleKHR;
+#  else
+      InstrumentedCommandPlaceholder vkImportSemaphoreWin32HandleKHR_placeholder;
+      InstrumentedCommandPlaceholder vkGetSemaphoreWin32HandleKHR_placeholder;
+#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+      //=== VK_KHR_external_semaphore_fd ===
+      InstrumentedCommand<PFN_vkImportSemaphoreFdKHR> vkImportSemaphoreFdKHR;
+      InstrumentedCommand<PFN_vkGetSemaphoreFdKHR>    vkGetSemaphoreFdKHR;
+
+      //=== VK_KHR_push_descriptor ===
+      InstrumentedCommand<PFN_vkCmdPushDescriptorSetKHR>             vkCmdPushDescriptorSetKHR;
+      InstrumentedCommand<PFN_vkCmdPushDescriptorSetWithTemplateKHR> vkCmdPushDescriptorSetWithTemplateKHR;
+
+      //=== VK_EXT_conditional_rendering ===
+      InstrumentedCommand<PFN_vkCmdBeginConditionalRenderingEXT> vkCmdBeginConditionalRenderingEXT;
+      InstrumentedCommand<PFN_vkCmdEndConditionalRenderingEXT>   vkCmdEndConditionalRenderingEXT;
+
+      //=== VK_KHR_descriptor_update_template ===
+      InstrumentedCommand<PFN_vkCreateDescriptorUpdateTemplateKHR>  vkCreateDescriptorUpdateTemplateKHR;
+      InstrumentedCommand<PFN_vkDestroyDescriptorUpdateTemplateKHR> vkDestroyDescriptorUpdateTemplateKHR;
+      InstrumentedCommand<PFN_vkUpdateDescriptorSetWithTemplateKHR> vkUpdateDescriptorSetWithTemplateKHR;
+
+      //=== VK_NV_clip_space_w_scaling ===
+      InstrumentedCommand<PFN_vkCmdSetViewportWScalingNV> vkCmdSetViewportWScalingNV;
+
+      //=== VK_EXT_direct_mode_display ===
+      InstrumentedCommand<PFN_vkReleaseDisplayEXT> vkReleaseDisplayEXT;
+
+#  if defined( VK_USE_PLATFORM_XLIB_XRANDR_EXT )
+      //=== VK_EXT_acquire_xlib_display ===
+      InstrumentedCommand<PFN_vkAcquireXlibDisplayEXT>    vkAcquireXlibDisplayEXT;
+      InstrumentedCommand<PFN_vkGetRandROutputDisplayEXT> vkGetRandROutputDisplayEXT;
+#  else
+      InstrumentedCommandPlaceholder vkAcquireXlibDisplayEXT_placeholder;
+      InstrumentedCommandPlaceholder vkGetRandROutputDisplayEXT_placeholder;
+#  endif /*VK_USE_PLATFORM_XLIB_XRANDR_EXT*/
+
+      //=== VK_EXT_display_surface_counter ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceSurfaceCapabilities2EXT> vkGetPhysicalDeviceSurfaceCapabilities2EXT;
+
+      //=== VK_EXT_display_control ===
+      InstrumentedCommand<PFN_vkDisplayPowerControlEXT>  vkDisplayPowerControlEXT;
+      InstrumentedCommand<PFN_vkRegisterDeviceEventEXT>  vkRegisterDeviceEventEXT;
+      InstrumentedCommand<PFN_vkRegisterDisplayEventEXT> vkRegisterDisplayEventEXT;
+      InstrumentedCommand<PFN_vkGetSwapchainCounterEXT>  vkGetSwapchainCounterEXT;
+
+      //=== VK_GOOGLE_display_timing ===
+      InstrumentedCommand<PFN_vkGetRefreshCycleDurationGOOGLE>   vkGetRefreshCycleDurationGOOGLE;
+      InstrumentedCommand<PFN_vkGetPastPresentationTimingGOOGLE> vkGetPastPresentationTimingGOOGLE;
+
+      //=== VK_EXT_discard_rectangles ===
+      InstrumentedCommand<PFN_vkCmdSetDiscardRectangleEXT>       vkCmdSetDiscardRectangleEXT;
+      InstrumentedCommand<PFN_vkCmdSetDiscardRectangleEnableEXT> vkCmdSetDiscardRectangleEnableEXT;
+      InstrumentedCommand<PFN_vkCmdSetDiscardRectangleModeEXT>   vkCmdSetDiscardRectangleModeEXT;
+
+      //=== VK_EXT_hdr_metadata ===
+      InstrumentedCommand<PFN_vkSetHdrMetadataEXT> vkSetHdrMetadataEXT;
+
+      //=== VK_KHR_create_renderpass2 ===
+      InstrumentedCommand<PFN_vkCreateRenderPass2KHR>   vkCreateRenderPass2KHR;
+      InstrumentedCommand<PFN_vkCmdBeginRenderPass2KHR> vkCmdBeginRenderPass2KHR;
+      InstrumentedCommand<PFN_vkCmdNextSubpass2KHR>     vkCmdNextSubpass2KHR;
+      InstrumentedCommand<PFN_vkCmdEndRenderPass2KHR>   vkCmdEndRenderPass2KHR;
+
+      //=== VK_KHR_shared_presentable_image ===
+      InstrumentedCommand<PFN_vkGetSwapchainStatusKHR> vkGetSwapchainStatusKHR;
+
+      //=== VK_KHR_external_fence_capabilities ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceExternalFencePropertiesKHR> vkGetPhysicalDeviceExternalFencePropertiesKHR;
+
+#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+      //=== VK_KHR_external_fence_win32 ===
+      InstrumentedCommand<PFN_vkImportFenceWin32HandleKHR> vkImportFenceWin32HandleKHR;
+      InstrumentedCommand<PFN_vkGetFenceWin32HandleKHR>    vkGetFenceWin32HandleKHR;
+#  else
+      InstrumentedCommandPlaceholder vkImportFenceWin32HandleKHR_placeholder;
+      InstrumentedCommandPlaceholder vkGetFenceWin32HandleKHR_placeholder;
+#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+      //=== VK_KHR_external_fence_fd ===
+      InstrumentedCommand<PFN_vkImportFenceFdKHR> vkImportFenceFdKHR;
+      InstrumentedCommand<PFN_vkGetFenceFdKHR>    vkGetFenceFdKHR;
+
+      //=== VK_KHR_performance_query ===
+      InstrumentedCommand<PFN_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR> vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR>         vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR;
+      InstrumentedCommand<PFN_vkAcquireProfilingLockKHR>                                       vkAcquireProfilingLockKHR;
+      InstrumentedCommand<PFN_vkReleaseProfilingLockKHR>                                       vkReleaseProfilingLockKHR;
+
+      //=== VK_KHR_get_surface_capabilities2 ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceSurfaceCapabilities2KHR> vkGetPhysicalDeviceSurfaceCapabilities2KHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceSurfaceFormats2KHR>      vkGetPhysicalDeviceSurfaceFormats2KHR;
+
+      //=== VK_KHR_get_display_properties2 ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceDisplayProperties2KHR>      vkGetPhysicalDeviceDisplayProperties2KHR;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceDisplayPlaneProperties2KHR> vkGetPhysicalDeviceDisplayPlaneProperties2KHR;
+      InstrumentedCommand<PFN_vkGetDisplayModeProperties2KHR>                vkGetDisplayModeProperties2KHR;
+      InstrumentedCommand<PFN_vkGetDisplayPlaneCapabilities2KHR>             vkGetDisplayPlaneCapabilities2KHR;
+
+#  if defined( VK_USE_PLATFORM_IOS_MVK )
+      //=== VK_MVK_ios_surface ===
+      InstrumentedCommand<PFN_vkCreateIOSSurfaceMVK> vkCreateIOSSurfaceMVK;
+#  else
+      InstrumentedCommandPlaceholder vkCreateIOSSurfaceMVK_placeholder;
+#  endif /*VK_USE_PLATFORM_IOS_MVK*/
+
+#  if defined( VK_USE_PLATFORM_MACOS_MVK )
+      //=== VK_MVK_macos_surface ===
+      InstrumentedCommand<PFN_vkCreateMacOSSurfaceMVK> vkCreateMacOSSurfaceMVK;
+#  else
+      InstrumentedCommandPlaceholder vkCreateMacOSSurfaceMVK_placeholder;
+#  endif /*VK_USE_PLATFORM_MACOS_MVK*/
+
+      //=== VK_EXT_debug_utils ===
+      InstrumentedCommand<PFN_vkSetDebugUtilsObjectNameEXT>    vkSetDebugUtilsObjectNameEXT;
+      InstrumentedCommand<PFN_vkSetDebugUtilsObjectTagEXT>     vkSetDebugUtilsObjectTagEXT;
+      InstrumentedCommand<PFN_vkQueueBeginDebugUtilsLabelEXT>  vkQueueBeginDebugUtilsLabelEXT;
+      InstrumentedCommand<PFN_vkQueueEndDebugUtilsLabelEXT>    vkQueueEndDebugUtilsLabelEXT;
+      InstrumentedCommand<PFN_vkQueueInsertDebugUtilsLabelEXT> vkQueueInsertDebugUtilsLabelEXT;
+      InstrumentedCommand<PFN_vkCmdBeginDebugUtilsLabelEXT>    vkCmdBeginDebugUtilsLabelEXT;
+      InstrumentedCommand<PFN_vkCmdEndDebugUtilsLabelEXT>      vkCmdEndDebugUtilsLabelEXT;
+      InstrumentedCommand<PFN_vkCmdInsertDebugUtilsLabelEXT>   vkCmdInsertDebugUtilsLabelEXT;
+      InstrumentedCommand<PFN_vkCreateDebugUtilsMessengerEXT>  vkCreateDebugUtilsMessengerEXT;
+      InstrumentedCommand<PFN_vkDestroyDebugUtilsMessengerEXT> vkDestroyDebugUtilsMessengerEXT;
+      InstrumentedCommand<PFN_vkSubmitDebugUtilsMessageEXT>    vkSubmitDebugUtilsMessageEXT;
+
+#  if defined( VK_USE_PLATFORM_ANDROID_KHR )
+      //=== VK_ANDROID_external_memory_android_hardware_buffer ===
+      InstrumentedCommand<PFN_vkGetAndroidHardwareBufferPropertiesANDROID> vkGetAndroidHardwareBufferPropertiesANDROID;
+      InstrumentedCommand<PFN_vkGetMemoryAndroidHardwareBufferANDROID>     vkGetMemoryAndroidHardwareBufferANDROID;
+#  else
+      InstrumentedCommandPlaceholder vkGetAndroidHardwareBufferPropertiesANDROID_placeholder;
+      InstrumentedCommandPlaceholder vkGetMemoryAndroidHardwareBufferANDROID_placeholder;
+#  endif /*VK_USE_PLATFORM_ANDROID_KHR*/
+
+      //=== VK_AMD_gpa_interface ===
+      InstrumentedCommand<PFN_vkCreateGpaSessionAMD>         vkCreateGpaSessionAMD;
+      InstrumentedCommand<PFN_vkDestroyGpaSessionAMD>        vkDestroyGpaSessionAMD;
+      InstrumentedCommand<PFN_vkSetGpaDeviceClockModeAMD>    vkSetGpaDeviceClockModeAMD;
+      InstrumentedCommand<PFN_vkGetGpaDeviceClockInfoAMD>    vkGetGpaDeviceClockInfoAMD;
+      InstrumentedCommand<PFN_vkCmdBeginGpaSessionAMD>       vkCmdBeginGpaSessionAMD;
+      InstrumentedCommand<PFN_vkCmdEndGpaSessionAMD>         vkCmdEndGpaSessionAMD;
+      InstrumentedCommand<PFN_vkCmdBeginGpaSampleAMD>        vkCmdBeginGpaSampleAMD;
+      InstrumentedCommand<PFN_vkCmdEndGpaSampleAMD>          vkCmdEndGpaSampleAMD;
+      InstrumentedCommand<PFN_vkGetGpaSessionStatusAMD>      vkGetGpaSessionStatusAMD;
+      InstrumentedCommand<PFN_vkGetGpaSessionResultsAMD>     vkGetGpaSessionResultsAMD;
+      InstrumentedCommand<PFN_vkResetGpaSessionAMD>          vkResetGpaSessionAMD;
+      InstrumentedCommand<PFN_vkCmdCopyGpaSessionResultsAMD> vkCmdCopyGpaSessionResultsAMD;
+
+#  if defined( VK_ENABLE_BETA_EXTENSIONS )
+      //=== VK_AMDX_shader_enqueue ===
+      InstrumentedCommand<PFN_vkCreateExecutionGraphPipelinesAMDX>        vkCreateExecutionGraphPipelinesAMDX;
+      InstrumentedCommand<PFN_vkGetExecutionGraphPipelineScratchSizeAMDX> vkGetExecutionGraphPipelineScratchSizeAMDX;
+      InstrumentedCommand<PFN_vkGetExecutionGraphPipelineNodeIndexAMDX>   vkGetExecutionGraphPipelineNodeIndexAMDX;
+      InstrumentedCommand<PFN_vkCmdInitializeGraphScratchMemoryAMDX>      vkCmdInitializeGraphScratchMemoryAMDX;
+      InstrumentedCommand<PFN_vkCmdDispatchGraphAMDX>                     vkCmdDispatchGraphAMDX;
+      InstrumentedCommand<PFN_vkCmdDispatchGraphIndirectAMDX>             vkCmdDispatchGraphIndirectAMDX;
+      InstrumentedCommand<PFN_vkCmdDispatchGraphIndirectCountAMDX>        vkCmdDispatchGraphIndirectCountAMDX;
+#  else
+      InstrumentedCommandPlaceholder vkCreateExecutionGraphPipelinesAMDX_placeholder;
+      InstrumentedCommandPlaceholder vkGetExecutionGraphPipelineScratchSizeAMDX_placeholder;
+      InstrumentedCommandPlaceholder vkGetExecutionGraphPipelineNodeIndexAMDX_placeholder;
+      InstrumentedCommandPlaceholder vkCmdInitializeGraphScratchMemoryAMDX_placeholder;
+      InstrumentedCommandPlaceholder vkCmdDispatchGraphAMDX_placeholder;
+      InstrumentedCommandPlaceholder vkCmdDispatchGraphIndirectAMDX_placeholder;
+      InstrumentedCommandPlaceholder vkCmdDispatchGraphIndirectCountAMDX_placeholder;
+#  endif /*VK_ENABLE_BETA_EXTENSIONS*/
+
+      //=== VK_EXT_descriptor_heap ===
+      InstrumentedCommand<PFN_vkWriteSamplerDescriptorsEXT>         vkWriteSamplerDescriptorsEXT;
+      InstrumentedCommand<PFN_vkWriteResourceDescriptorsEXT>        vkWriteResourceDescriptorsEXT;
+      InstrumentedCommand<PFN_vkCmdBindSamplerHeapEXT>              vkCmdBindSamplerHeapEXT;
+      InstrumentedCommand<PFN_vkCmdBindResourceHeapEXT>             vkCmdBindResourceHeapEXT;
+      InstrumentedCommand<PFN_vkCmdPushDataEXT>                     vkCmdPushDataEXT;
+      InstrumentedCommand<PFN_vkGetImageOpaqueCaptureDataEXT>       vkGetImageOpaqueCaptureDataEXT;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceDescriptorSizeEXT> vkGetPhysicalDeviceDescriptorSizeEXT;
+      InstrumentedCommand<PFN_vkRegisterCustomBorderColorEXT>       vkRegisterCustomBorderColorEXT;
+      InstrumentedCommand<PFN_vkUnregisterCustomBorderColorEXT>     vkUnregisterCustomBorderColorEXT;
+      InstrumentedCommand<PFN_vkGetTensorOpaqueCaptureDataARM>      vkGetTensorOpaqueCaptureDataARM;
+
+      //=== VK_EXT_sample_locations ===
+      InstrumentedCommand<PFN_vkCmdSetSampleLocationsEXT>                  vkCmdSetSampleLocationsEXT;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceMultisamplePropertiesEXT> vkGetPhysicalDeviceMultisamplePropertiesEXT;
+
+      //=== VK_KHR_get_memory_requirements2 ===
+      InstrumentedCommand<PFN_vkGetImageMemoryRequirements2KHR>       vkGetImageMemoryRequirements2KHR;
+      InstrumentedCommand<PFN_vkGetBufferMemoryRequirements2KHR>      vkGetBufferMemoryRequirements2KHR;
+      InstrumentedCommand<PFN_vkGetImageSparseMemoryRequirements2KHR> vkGetImageSparseMemoryRequirements2KHR;
+
+      //=== VK_KHR_acceleration_structure ===
+      InstrumentedCommand<PFN_vkCreateAccelerationStructureKHR>                 vkCreateAccelerationStructureKHR;
+      InstrumentedCommand<PFN_vkDestroyAccelerationStructureKHR>                vkDestroyAccelerationStructureKHR;
+      InstrumentedCommand<PFN_vkCmdBuildAccelerationStructuresKHR>              vkCmdBuildAccelerationStructuresKHR;
+      InstrumentedCommand<PFN_vkCmdBuildAccelerationStructuresIndirectKHR>      vkCmdBuildAccelerationStructuresIndirectKHR;
+      InstrumentedCommand<PFN_vkBuildAccelerationStructuresKHR>                 vkBuildAccelerationStructuresKHR;
+      InstrumentedCommand<PFN_vkCopyAccelerationStructureKHR>                   vkCopyAccelerationStructureKHR;
+      InstrumentedCommand<PFN_vkCopyAccelerationStructureToMemoryKHR>           vkCopyAccelerationStructureToMemoryKHR;
+      InstrumentedCommand<PFN_vkCopyMemoryToAccelerationStructureKHR>           vkCopyMemoryToAccelerationStructureKHR;
+      InstrumentedCommand<PFN_vkWriteAccelerationStructuresPropertiesKHR>       vkWriteAccelerationStructuresPropertiesKHR;
+      InstrumentedCommand<PFN_vkCmdCopyAccelerationStructureKHR>                vkCmdCopyAccelerationStructureKHR;
+      InstrumentedCommand<PFN_vkCmdCopyAccelerationStructureToMemoryKHR>        vkCmdCopyAccelerationStructureToMemoryKHR;
+      InstrumentedCommand<PFN_vkCmdCopyMemoryToAccelerationStructureKHR>        vkCmdCopyMemoryToAccelerationStructureKHR;
+      InstrumentedCommand<PFN_vkGetAccelerationStructureDeviceAddressKHR>       vkGetAccelerationStructureDeviceAddressKHR;
+      InstrumentedCommand<PFN_vkCmdWriteAccelerationStructuresPropertiesKHR>    vkCmdWriteAccelerationStructuresPropertiesKHR;
+      InstrumentedCommand<PFN_vkGetDeviceAccelerationStructureCompatibilityKHR> vkGetDeviceAccelerationStructureCompatibilityKHR;
+      InstrumentedCommand<PFN_vkGetAccelerationStructureBuildSizesKHR>          vkGetAccelerationStructureBuildSizesKHR;
+
+      //=== VK_KHR_ray_tracing_pipeline ===
+      InstrumentedCommand<PFN_vkCmdTraceRaysKHR>                                 vkCmdTraceRaysKHR;
+      InstrumentedCommand<PFN_vkCreateRayTracingPipelinesKHR>                    vkCreateRayTracingPipelinesKHR;
+      InstrumentedCommand<PFN_vkGetRayTracingShaderGroupHandlesKHR>              vkGetRayTracingShaderGroupHandlesKHR;
+      InstrumentedCommand<PFN_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR> vkGetRayTracingCaptureReplayShaderGroupHandlesKHR;
+      InstrumentedCommand<PFN_vkCmdTraceRaysIndirectKHR>                         vkCmdTraceRaysIndirectKHR;
+      InstrumentedCommand<PFN_vkGetRayTracingShaderGroupStackSizeKHR>            vkGetRayTracingShaderGroupStackSizeKHR;
+      InstrumentedCommand<PFN_vkCmdSetRayTracingPipelineStackSizeKHR>            vkCmdSetRayTracingPipelineStackSizeKHR;
+
+      //=== VK_KHR_sampler_ycbcr_conversion ===
+      InstrumentedCommand<PFN_vkCreateSamplerYcbcrConversionKHR>  vkCreateSamplerYcbcrConversionKHR;
+      InstrumentedCommand<PFN_vkDestroySamplerYcbcrConversionKHR> vkDestroySamplerYcbcrConversionKHR;
+
+      //=== VK_KHR_bind_memory2 ===
+      InstrumentedCommand<PFN_vkBindBufferMemory2KHR> vkBindBufferMemory2KHR;
+      InstrumentedCommand<PFN_vkBindImageMemory2KHR>  vkBindImageMemory2KHR;
+
+      //=== VK_EXT_image_drm_format_modifier ===
+      InstrumentedCommand<PFN_vkGetImageDrmFormatModifierPropertiesEXT> vkGetImageDrmFormatModifierPropertiesEXT;
+
+      //=== VK_EXT_validation_cache ===
+      InstrumentedCommand<PFN_vkCreateValidationCacheEXT>  vkCreateValidationCacheEXT;
+      InstrumentedCommand<PFN_vkDestroyValidationCacheEXT> vkDestroyValidationCacheEXT;
+      InstrumentedCommand<PFN_vkMergeValidationCachesEXT>  vkMergeValidationCachesEXT;
+      InstrumentedCommand<PFN_vkGetValidationCacheDataEXT> vkGetValidationCacheDataEXT;
+
+      //=== VK_NV_shading_rate_image ===
+      InstrumentedCommand<PFN_vkCmdBindShadingRateImageNV>          vkCmdBindShadingRateImageNV;
+      InstrumentedCommand<PFN_vkCmdSetViewportShadingRatePaletteNV> vkCmdSetViewportShadingRatePaletteNV;
+      InstrumentedCommand<PFN_vkCmdSetCoarseSampleOrderNV>          vkCmdSetCoarseSampleOrderNV;
+
+      //=== VK_NV_ray_tracing ===
+      InstrumentedCommand<PFN_vkCreateAccelerationStructureNV>                vkCreateAccelerationStructureNV;
+      InstrumentedCommand<PFN_vkDestroyAccelerationStructureNV>               vkDestroyAccelerationStructureNV;
+      InstrumentedCommand<PFN_vkGetAccelerationStructureMemoryRequirementsNV> vkGetAccelerationStructureMemoryRequirementsNV;
+      InstrumentedCommand<PFN_vkBindAccelerationStructureMemoryNV>            vkBindAccelerationStructureMemoryNV;
+      InstrumentedCommand<PFN_vkCmdBuildAccelerationStructureNV>              vkCmdBuildAccelerationStructureNV;
+      InstrumentedCommand<PFN_vkCmdCopyAccelerationStructureNV>               vkCmdCopyAccelerationStructureNV;
+      InstrumentedCommand<PFN_vkCmdTraceRaysNV>                               vkCmdTraceRaysNV;
+      InstrumentedCommand<PFN_vkCreateRayTracingPipelinesNV>                  vkCreateRayTracingPipelinesNV;
+      InstrumentedCommand<PFN_vkGetRayTracingShaderGroupHandlesNV>            vkGetRayTracingShaderGroupHandlesNV;
+      InstrumentedCommand<PFN_vkGetAccelerationStructureHandleNV>             vkGetAccelerationStructureHandleNV;
+      InstrumentedCommand<PFN_vkCmdWriteAccelerationStructuresPropertiesNV>   vkCmdWriteAccelerationStructuresPropertiesNV;
+      InstrumentedCommand<PFN_vkCompileDeferredNV>                            vkCompileDeferredNV;
+
+      //=== VK_KHR_maintenance3 ===
+      InstrumentedCommand<PFN_vkGetDescriptorSetLayoutSupportKHR> vkGetDescriptorSetLayoutSupportKHR;
+
+      //=== VK_KHR_draw_indirect_count ===
+      InstrumentedCommand<PFN_vkCmdDrawIndirectCountKHR>        vkCmdDrawIndirectCountKHR;
+      InstrumentedCommand<PFN_vkCmdDrawIndexedIndirectCountKHR> vkCmdDrawIndexedIndirectCountKHR;
+
+      //=== VK_EXT_external_memory_host ===
+      InstrumentedCommand<PFN_vkGetMemoryHostPointerPropertiesEXT> vkGetMemoryHostPointerPropertiesEXT;
+
+      //=== VK_AMD_buffer_marker ===
+      InstrumentedCommand<PFN_vkCmdWriteBufferMarkerAMD>  vkCmdWriteBufferMarkerAMD;
+      InstrumentedCommand<PFN_vkCmdWriteBufferMarker2AMD> vkCmdWriteBufferMarker2AMD;
+
+      //=== VK_EXT_calibrated_timestamps ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT> vkGetPhysicalDeviceCalibrateableTimeDomainsEXT;
+      InstrumentedCommand<PFN_vkGetCalibratedTimestampsEXT>                   vkGetCalibratedTimestampsEXT;
+
+      //=== VK_NV_mesh_shader ===
+      InstrumentedCommand<PFN_vkCmdDrawMeshTasksNV>              vkCmdDrawMeshTasksNV;
+      InstrumentedCommand<PFN_vkCmdDrawMeshTasksIndirectNV>      vkCmdDrawMeshTasksIndirectNV;
+      InstrumentedCommand<PFN_vkCmdDrawMeshTasksIndirectCountNV> vkCmdDrawMeshTasksIndirectCountNV;
+
+      //=== VK_NV_scissor_exclusive ===
+      InstrumentedCommand<PFN_vkCmdSetExclusiveScissorEnableNV> vkCmdSetExclusiveScissorEnableNV;
+      InstrumentedCommand<PFN_vkCmdSetExclusiveScissorNV>       vkCmdSetExclusiveScissorNV;
+
+      //=== VK_NV_device_diagnostic_checkpoints ===
+      InstrumentedCommand<PFN_vkCmdSetCheckpointNV>        vkCmdSetCheckpointNV;
+      InstrumentedCommand<PFN_vkGetQueueCheckpointDataNV>  vkGetQueueCheckpointDataNV;
+      InstrumentedCommand<PFN_vkGetQueueCheckpointData2NV> vkGetQueueCheckpointData2NV;
+
+      //=== VK_KHR_timeline_semaphore ===
+      InstrumentedCommand<PFN_vkGetSemaphoreCounterValueKHR> vkGetSemaphoreCounterValueKHR;
+      InstrumentedCommand<PFN_vkWaitSemaphoresKHR>           vkWaitSemaphoresKHR;
+      InstrumentedCommand<PFN_vkSignalSemaphoreKHR>          vkSignalSemaphoreKHR;
+
+      //=== VK_EXT_present_timing ===
+      InstrumentedCommand<PFN_vkSetSwapchainPresentTimingQueueSizeEXT> vkSetSwapchainPresentTimingQueueSizeEXT;
+      InstrumentedCommand<PFN_vkGetSwapchainTimingPropertiesEXT>       vkGetSwapchainTimingPropertiesEXT;
+      InstrumentedCommand<PFN_vkGetSwapchainTimeDomainPropertiesEXT>   vkGetSwapchainTimeDomainPropertiesEXT;
+      InstrumentedCommand<PFN_vkGetPastPresentationTimingEXT>          vkGetPastPresentationTimingEXT;
+
+      //=== VK_INTEL_performance_query ===
+      InstrumentedCommand<PFN_vkInitializePerformanceApiINTEL>         vkInitializePerformanceApiINTEL;
+      InstrumentedCommand<PFN_vkUninitializePerformanceApiINTEL>       vkUninitializePerformanceApiINTEL;
+      InstrumentedCommand<PFN_vkCmdSetPerformanceMarkerINTEL>          vkCmdSetPerformanceMarkerINTEL;
+      InstrumentedCommand<PFN_vkCmdSetPerformanceStreamMarkerINTEL>    vkCmdSetPerformanceStreamMarkerINTEL;
+      InstrumentedCommand<PFN_vkCmdSetPerformanceOverrideINTEL>        vkCmdSetPerformanceOverrideINTEL;
+      InstrumentedCommand<PFN_vkAcquirePerformanceConfigurationINTEL>  vkAcquirePerformanceConfigurationINTEL;
+      InstrumentedCommand<PFN_vkReleasePerformanceConfigurationINTEL>  vkReleasePerformanceConfigurationINTEL;
+      InstrumentedCommand<PFN_vkQueueSetPerformanceConfigurationINTEL> vkQueueSetPerformanceConfigurationINTEL;
+      InstrumentedCommand<PFN_vkGetPerformanceParameterINTEL>          vkGetPerformanceParameterINTEL;
+
+      //=== VK_AMD_display_native_hdr ===
+      InstrumentedCommand<PFN_vkSetLocalDimmingAMD> vkSetLocalDimmingAMD;
+
+#  if defined( VK_USE_PLATFORM_FUCHSIA )
+      //=== VK_FUCHSIA_imagepipe_surface ===
+      InstrumentedCommand<PFN_vkCreateImagePipeSurfaceFUCHSIA> vkCreateImagePipeSurfaceFUCHSIA;
+#  else
+      InstrumentedCommandPlaceholder vkCreateImagePipeSurfaceFUCHSIA_placeholder;
+#  endif /*VK_USE_PLATFORM_FUCHSIA*/
+
+#  if defined( VK_USE_PLATFORM_METAL_EXT )
+      //=== VK_EXT_metal_surface ===
+      InstrumentedCommand<PFN_vkCreateMetalSurfaceEXT> vkCreateMetalSurfaceEXT;
+#  else
+      InstrumentedCommandPlaceholder vkCreateMetalSurfaceEXT_placeholder;
+#  endif /*VK_USE_PLATFORM_METAL_EXT*/
+
+      //=== VK_KHR_fragment_shading_rate ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceFragmentShadingRatesKHR> vkGetPhysicalDeviceFragmentShadingRatesKHR;
+      InstrumentedCommand<PFN_vkCmdSetFragmentShadingRateKHR>             vkCmdSetFragmentShadingRateKHR;
+
+      //=== VK_KHR_dynamic_rendering_local_read ===
+      InstrumentedCommand<PFN_vkCmdSetRenderingAttachmentLocationsKHR>    vkCmdSetRenderingAttachmentLocationsKHR;
+      InstrumentedCommand<PFN_vkCmdSetRenderingInputAttachmentIndicesKHR> vkCmdSetRenderingInputAttachmentIndicesKHR;
+
+      //=== VK_EXT_buffer_device_address ===
+      InstrumentedCommand<PFN_vkGetBufferDeviceAddressEXT> vkGetBufferDeviceAddressEXT;
+
+      //=== VK_EXT_tooling_info ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceToolPropertiesEXT> vkGetPhysicalDeviceToolPropertiesEXT;
+
+      //=== VK_KHR_present_wait ===
+      InstrumentedCommand<PFN_vkWaitForPresentKHR> vkWaitForPresentKHR;
+
+      //=== VK_NV_cooperative_matrix ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV> vkGetPhysicalDeviceCooperativeMatrixPropertiesNV;
+
+      //=== VK_NV_coverage_reduction_mode ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV> vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV;
+
+#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+      //=== VK_EXT_full_screen_exclusive ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceSurfacePresentModes2EXT> vkGetPhysicalDeviceSurfacePresentModes2EXT;
+      InstrumentedCommand<PFN_vkAcquireFullScreenExclusiveModeEXT>        vkAcquireFullScreenExclusiveModeEXT;
+      InstrumentedCommand<PFN_vkReleaseFullScreenExclusiveModeEXT>        vkReleaseFullScreenExclusiveModeEXT;
+      InstrumentedCommand<PFN_vkGetDeviceGroupSurfacePresentModes2EXT>    vkGetDeviceGroupSurfacePresentModes2EXT;
+#  else
+      InstrumentedCommandPlaceholder vkGetPhysicalDeviceSurfacePresentModes2EXT_placeholder;
+      InstrumentedCommandPlaceholder vkAcquireFullScreenExclusiveModeEXT_placeholder;
+      InstrumentedCommandPlaceholder vkReleaseFullScreenExclusiveModeEXT_placeholder;
+      InstrumentedCommandPlaceholder vkGetDeviceGroupSurfacePresentModes2EXT_placeholder;
+#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+      //=== VK_EXT_headless_surface ===
+      InstrumentedCommand<PFN_vkCreateHeadlessSurfaceEXT> vkCreateHeadlessSurfaceEXT;
+
+      //=== VK_KHR_buffer_device_address ===
+      InstrumentedCommand<PFN_vkGetBufferDeviceAddressKHR>              vkGetBufferDeviceAddressKHR;
+      InstrumentedCommand<PFN_vkGetBufferOpaqueCaptureAddressKHR>       vkGetBufferOpaqueCaptureAddressKHR;
+      InstrumentedCommand<PFN_vkGetDeviceMemoryOpaqueCaptureAddressKHR> vkGetDeviceMemoryOpaqueCaptureAddressKHR;
+
+      //=== VK_EXT_line_rasterization ===
+      InstrumentedCommand<PFN_vkCmdSetLineStippleEXT> vkCmdSetLineStippleEXT;
+
+      //=== VK_EXT_host_query_reset ===
+      InstrumentedCommand<PFN_vkResetQueryPoolEXT> vkResetQueryPoolEXT;
+
+      //=== VK_EXT_extended_dynamic_state ===
+      InstrumentedCommand<PFN_vkCmdSetCullModeEXT>              vkCmdSetCullModeEXT;
+      InstrumentedCommand<PFN_vkCmdSetFrontFaceEXT>             vkCmdSetFrontFaceEXT;
+      InstrumentedCommand<PFN_vkCmdSetPrimitiveTopologyEXT>     vkCmdSetPrimitiveTopologyEXT;
+      InstrumentedCommand<PFN_vkCmdSetViewportWithCountEXT>     vkCmdSetViewportWithCountEXT;
+      InstrumentedCommand<PFN_vkCmdSetScissorWithCountEXT>      vkCmdSetScissorWithCountEXT;
+      InstrumentedCommand<PFN_vkCmdBindVertexBuffers2EXT>       vkCmdBindVertexBuffers2EXT;
+      InstrumentedCommand<PFN_vkCmdSetDepthTestEnableEXT>       vkCmdSetDepthTestEnableEXT;
+      InstrumentedCommand<PFN_vkCmdSetDepthWriteEnableEXT>      vkCmdSetDepthWriteEnableEXT;
+      InstrumentedCommand<PFN_vkCmdSetDepthCompareOpEXT>        vkCmdSetDepthCompareOpEXT;
+      InstrumentedCommand<PFN_vkCmdSetDepthBoundsTestEnableEXT> vkCmdSetDepthBoundsTestEnableEXT;
+      InstrumentedCommand<PFN_vkCmdSetStencilTestEnableEXT>     vkCmdSetStencilTestEnableEXT;
+      InstrumentedCommand<PFN_vkCmdSetStencilOpEXT>             vkCmdSetStencilOpEXT;
+
+      //=== VK_KHR_deferred_host_operations ===
+      InstrumentedCommand<PFN_vkCreateDeferredOperationKHR>            vkCreateDeferredOperationKHR;
+      InstrumentedCommand<PFN_vkDestroyDeferredOperationKHR>           vkDestroyDeferredOperationKHR;
+      InstrumentedCommand<PFN_vkGetDeferredOperationMaxConcurrencyKHR> vkGetDeferredOperationMaxConcurrencyKHR;
+      InstrumentedCommand<PFN_vkGetDeferredOperationResultKHR>         vkGetDeferredOperationResultKHR;
+      InstrumentedCommand<PFN_vkDeferredOperationJoinKHR>              vkDeferredOperationJoinKHR;
+
+      //=== VK_KHR_pipeline_executable_properties ===
+      InstrumentedCommand<PFN_vkGetPipelineExecutablePropertiesKHR>              vkGetPipelineExecutablePropertiesKHR;
+      InstrumentedCommand<PFN_vkGetPipelineExecutableStatisticsKHR>              vkGetPipelineExecutableStatisticsKHR;
+      InstrumentedCommand<PFN_vkGetPipelineExecutableInternalRepresentationsKHR> vkGetPipelineExecutableInternalRepresentationsKHR;
+
+      //=== VK_EXT_host_image_copy ===
+      InstrumentedCommand<PFN_vkCopyMemoryToImageEXT>          vkCopyMemoryToImageEXT;
+      InstrumentedCommand<PFN_vkCopyImageToMemoryEXT>          vkCopyImageToMemoryEXT;
+      InstrumentedCommand<PFN_vkCopyImageToImageEXT>           vkCopyImageToImageEXT;
+      InstrumentedCommand<PFN_vkTransitionImageLayoutEXT>      vkTransitionImageLayoutEXT;
+      InstrumentedCommand<PFN_vkGetImageSubresourceLayout2EXT> vkGetImageSubresourceLayout2EXT;
+
+      //=== VK_KHR_map_memory2 ===
+      InstrumentedCommand<PFN_vkMapMemory2KHR>   vkMapMemory2KHR;
+      InstrumentedCommand<PFN_vkUnmapMemory2KHR> vkUnmapMemory2KHR;
+
+      //=== VK_EXT_swapchain_maintenance1 ===
+      InstrumentedCommand<PFN_vkReleaseSwapchainImagesEXT> vkReleaseSwapchainImagesEXT;
+
+      //=== VK_NV_device_generated_commands ===
+      InstrumentedCommand<PFN_vkGetGeneratedCommandsMemoryRequirementsNV> vkGetGeneratedCommandsMemoryRequirementsNV;
+      InstrumentedCommand<PFN_vkCmdPreprocessGeneratedCommandsNV>         vkCmdPreprocessGeneratedCommandsNV;
+      InstrumentedCommand<PFN_vkCmdExecuteGeneratedCommandsNV>            vkCmdExecuteGeneratedCommandsNV;
+      InstrumentedCommand<PFN_vkCmdBindPipelineShaderGroupNV>             vkCmdBindPipelineShaderGroupNV;
+      InstrumentedCommand<PFN_vkCreateIndirectCommandsLayoutNV>           vkCreateIndirectCommandsLayoutNV;
+      InstrumentedCommand<PFN_vkDestroyIndirectCommandsLayoutNV>          vkDestroyIndirectCommandsLayoutNV;
+
+      //=== VK_EXT_depth_bias_control ===
+      InstrumentedCommand<PFN_vkCmdSetDepthBias2EXT> vkCmdSetDepthBias2EXT;
+
+      //=== VK_EXT_acquire_drm_display ===
+      InstrumentedCommand<PFN_vkAcquireDrmDisplayEXT> vkAcquireDrmDisplayEXT;
+      InstrumentedCommand<PFN_vkGetDrmDisplayEXT>     vkGetDrmDisplayEXT;
+
+      //=== VK_EXT_private_data ===
+      InstrumentedCommand<PFN_vkCreatePrivateDataSlotEXT>  vkCreatePrivateDataSlotEXT;
+      InstrumentedCommand<PFN_vkDestroyPrivateDataSlotEXT> vkDestroyPrivateDataSlotEXT;
+      InstrumentedCommand<PFN_vkSetPrivateDataEXT>         vkSetPrivateDataEXT;
+      InstrumentedCommand<PFN_vkGetPrivateDataEXT>         vkGetPrivateDataEXT;
+
+      //=== VK_KHR_video_encode_queue ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR> vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR;
+      InstrumentedCommand<PFN_vkGetEncodedVideoSessionParametersKHR>                   vkGetEncodedVideoSessionParametersKHR;
+      InstrumentedCommand<PFN_vkCmdEncodeVideoKHR>                                     vkCmdEncodeVideoKHR;
+
+      //=== VK_QCOM_queue_perf_hint ===
+      InstrumentedCommand<PFN_vkQueueSetPerfHintQCOM> vkQueueSetPerfHintQCOM;
+
+#  if defined( VK_ENABLE_BETA_EXTENSIONS )
+      //=== VK_NV_cuda_kernel_launch ===
+      InstrumentedCommand<PFN_vkCreateCudaModuleNV>    vkCreateCudaModuleNV;
+      InstrumentedCommand<PFN_vkGetCudaModuleCacheNV>  vkGetCudaModuleCacheNV;
+      InstrumentedCommand<PFN_vkCreateCudaFunctionNV>  vkCreateCudaFunctionNV;
+      InstrumentedCommand<PFN_vkDestroyCudaModuleNV>   vkDestroyCudaModuleNV;
+      InstrumentedCommand<PFN_vkDestroyCudaFunctionNV> vkDestroyCudaFunctionNV;
+      InstrumentedCommand<PFN_vkCmdCudaLaunchKernelNV> vkCmdCudaLaunchKernelNV;
+#  else
+      InstrumentedCommandPlaceholder vkCreateCudaModuleNV_placeholder;
+      InstrumentedCommandPlaceholder vkGetCudaModuleCacheNV_placeholder;
+      InstrumentedCommandPlaceholder vkCreateCudaFunctionNV_placeholder;
+      InstrumentedCommandPlaceholder vkDestroyCudaModuleNV_placeholder;
+      InstrumentedCommandPlaceholder vkDestroyCudaFunctionNV_placeholder;
+      InstrumentedCommandPlaceholder vkCmdCudaLaunchKernelNV_placeholder;
+#  endif /*VK_ENABLE_BETA_EXTENSIONS*/
+
+      //=== VK_QCOM_tile_shading ===
+      InstrumentedCommand<PFN_vkCmdDispatchTileQCOM>          vkCmdDispatchTileQCOM;
+      InstrumentedCommand<PFN_vkCmdBeginPerTileExecutionQCOM> vkCmdBeginPerTileExecutionQCOM;
+      InstrumentedCommand<PFN_vkCmdEndPerTileExecutionQCOM>   vkCmdEndPerTileExecutionQCOM;
+
+      //=== VK_NV_low_latency ===
+      InstrumentedCommand<PFN_vkSetLatencySleepModeLegacyNV>   vkSetLatencySleepModeLegacyNV;
+      InstrumentedCommand<PFN_vkLatencySleepLegacyNV>          vkLatencySleepLegacyNV;
+      InstrumentedCommand<PFN_vkSetLatencyMarkerLegacyNV>      vkSetLatencyMarkerLegacyNV;
+      InstrumentedCommand<PFN_vkGetLatencyTimingsLegacyNV>     vkGetLatencyTimingsLegacyNV;
+      InstrumentedCommand<PFN_vkQueueNotifyOutOfBandLegacyNV>  vkQueueNotifyOutOfBandLegacyNV;
+      InstrumentedCommand<PFN_vkGetSleepStatusLegacyNV>        vkGetSleepStatusLegacyNV;
+      InstrumentedCommand<PFN_vkShutdownLatencyDeviceLegacyNV> vkShutdownLatencyDeviceLegacyNV;
+
+#  if defined( VK_USE_PLATFORM_METAL_EXT )
+      //=== VK_EXT_metal_objects ===
+      InstrumentedCommand<PFN_vkExportMetalObjectsEXT> vkExportMetalObjectsEXT;
+#  else
+      InstrumentedCommandPlaceholder vkExportMetalObjectsEXT_placeholder;
+#  endif /*VK_USE_PLATFORM_METAL_EXT*/
+
+      //=== VK_KHR_synchronization2 ===
+      InstrumentedCommand<PFN_vkCmdSetEvent2KHR>        vkCmdSetEvent2KHR;
+      InstrumentedCommand<PFN_vkCmdResetEvent2KHR>      vkCmdResetEvent2KHR;
+      InstrumentedCommand<PFN_vkCmdWaitEvents2KHR>      vkCmdWaitEvents2KHR;
+      InstrumentedCommand<PFN_vkCmdPipelineBarrier2KHR> vkCmdPipelineBarrier2KHR;
+      InstrumentedCommand<PFN_vkCmdWriteTimestamp2KHR>  vkCmdWriteTimestamp2KHR;
+      InstrumentedCommand<PFN_vkQueueSubmit2KHR>        vkQueueSubmit2KHR;
+
+      //=== VK_EXT_descriptor_buffer ===
+      InstrumentedCommand<PFN_vkGetDescriptorSetLayoutSizeEXT>                          vkGetDescriptorSetLayoutSizeEXT;
+      InstrumentedCommand<PFN_vkGetDescriptorSetLayoutBindingOffsetEXT>                 vkGetDescriptorSetLayoutBindingOffsetEXT;
+      InstrumentedCommand<PFN_vkGetDescriptorEXT>                                       vkGetDescriptorEXT;
+      InstrumentedCommand<PFN_vkCmdBindDescriptorBuffersEXT>                            vkCmdBindDescriptorBuffersEXT;
+      InstrumentedCommand<PFN_vkCmdSetDescriptorBufferOffsetsEXT>                       vkCmdSetDescriptorBufferOffsetsEXT;
+      InstrumentedCommand<PFN_vkCmdBindDescriptorBufferEmbeddedSamplersEXT>             vkCmdBindDescriptorBufferEmbeddedSamplersEXT;
+      InstrumentedCommand<PFN_vkGetBufferOpaqueCaptureDescriptorDataEXT>                vkGetBufferOpaqueCaptureDescriptorDataEXT;
+      InstrumentedCommand<PFN_vkGetImageOpaqueCaptureDescriptorDataEXT>                 vkGetImageOpaqueCaptureDescriptorDataEXT;
+      InstrumentedCommand<PFN_vkGetImageViewOpaqueCaptureDescriptorDataEXT>             vkGetImageViewOpaqueCaptureDescriptorDataEXT;
+      InstrumentedCommand<PFN_vkGetSamplerOpaqueCaptureDescriptorDataEXT>               vkGetSamplerOpaqueCaptureDescriptorDataEXT;
+      InstrumentedCommand<PFN_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT> vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT;
+
+      //=== VK_KHR_device_address_commands ===
+      InstrumentedCommand<PFN_vkCmdBindIndexBuffer3KHR>              vkCmdBindIndexBuffer3KHR;
+      InstrumentedCommand<PFN_vkCmdBindVertexBuffers3KHR>            vkCmdBindVertexBuffers3KHR;
+      InstrumentedCommand<PFN_vkCmdDrawIndirect2KHR>                 vkCmdDrawIndirect2KHR;
+      InstrumentedCommand<PFN_vkCmdDrawIndexedIndirect2KHR>          vkCmdDrawIndexedIndirect2KHR;
+      InstrumentedCommand<PFN_vkCmdDispatchIndirect2KHR>             vkCmdDispatchIndirect2KHR;
+      InstrumentedCommand<PFN_vkCmdCopyMemoryKHR>                    vkCmdCopyMemoryKHR;
+      InstrumentedCommand<PFN_vkCmdCopyMemoryToImageKHR>             vkCmdCopyMemoryToImageKHR;
+      InstrumentedCommand<PFN_vkCmdCopyImageToMemoryKHR>             vkCmdCopyImageToMemoryKHR;
+      InstrumentedCommand<PFN_vkCmdUpdateMemoryKHR>                  vkCmdUpdateMemoryKHR;
+      InstrumentedCommand<PFN_vkCmdFillMemoryKHR>                    vkCmdFillMemoryKHR;
+      InstrumentedCommand<PFN_vkCmdCopyQueryPoolResultsToMemoryKHR>  vkCmdCopyQueryPoolResultsToMemoryKHR;
+      InstrumentedCommand<PFN_vkCmdDrawIndirectCount2KHR>            vkCmdDrawIndirectCount2KHR;
+      InstrumentedCommand<PFN_vkCmdDrawIndexedIndirectCount2KHR>     vkCmdDrawIndexedIndirectCount2KHR;
+      InstrumentedCommand<PFN_vkCmdBeginConditionalRendering2EXT>    vkCmdBeginConditionalRendering2EXT;
+      InstrumentedCommand<PFN_vkCmdBindTransformFeedbackBuffers2EXT> vkCmdBindTransformFeedbackBuffers2EXT;
+      InstrumentedCommand<PFN_vkCmdBeginTransformFeedback2EXT>       vkCmdBeginTransformFeedback2EXT;
+      InstrumentedCommand<PFN_vkCmdEndTransformFeedback2EXT>         vkCmdEndTransformFeedback2EXT;
+      InstrumentedCommand<PFN_vkCmdDrawIndirectByteCount2EXT>        vkCmdDrawIndirectByteCount2EXT;
+      InstrumentedCommand<PFN_vkCmdDrawMeshTasksIndirect2EXT>        vkCmdDrawMeshTasksIndirect2EXT;
+      InstrumentedCommand<PFN_vkCmdDrawMeshTasksIndirectCount2EXT>   vkCmdDrawMeshTasksIndirectCount2EXT;
+      InstrumentedCommand<PFN_vkCmdWriteMarkerToMemoryAMD>           vkCmdWriteMarkerToMemoryAMD;
+      InstrumentedCommand<PFN_vkCreateAccelerationStructure2KHR>     vkCreateAccelerationStructure2KHR;
+
+      //=== VK_NV_fragment_shading_rate_enums ===
+      InstrumentedCommand<PFN_vkCmdSetFragmentShadingRateEnumNV> vkCmdSetFragmentShadingRateEnumNV;
+
+      //=== VK_EXT_mesh_shader ===
+      InstrumentedCommand<PFN_vkCmdDrawMeshTasksEXT>              vkCmdDrawMeshTasksEXT;
+      InstrumentedCommand<PFN_vkCmdDrawMeshTasksIndirectEXT>      vkCmdDrawMeshTasksIndirectEXT;
+      InstrumentedCommand<PFN_vkCmdDrawMeshTasksIndirectCountEXT> vkCmdDrawMeshTasksIndirectCountEXT;
+
+      //=== VK_KHR_copy_commands2 ===
+      InstrumentedCommand<PFN_vkCmdCopyBuffer2KHR>        vkCmdCopyBuffer2KHR;
+      InstrumentedCommand<PFN_vkCmdCopyImage2KHR>         vkCmdCopyImage2KHR;
+      InstrumentedCommand<PFN_vkCmdCopyBufferToImage2KHR> vkCmdCopyBufferToImage2KHR;
+      InstrumentedCommand<PFN_vkCmdCopyImageToBuffer2KHR> vkCmdCopyImageToBuffer2KHR;
+      InstrumentedCommand<PFN_vkCmdBlitImage2KHR>         vkCmdBlitImage2KHR;
+      InstrumentedCommand<PFN_vkCmdResolveImage2KHR>      vkCmdResolveImage2KHR;
+
+      //=== VK_EXT_device_fault ===
+      InstrumentedCommand<PFN_vkGetDeviceFaultInfoEXT> vkGetDeviceFaultInfoEXT;
+
+#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+      //=== VK_NV_acquire_winrt_display ===
+      InstrumentedCommand<PFN_vkAcquireWinrtDisplayNV> vkAcquireWinrtDisplayNV;
+      InstrumentedCommand<PFN_vkGetWinrtDisplayNV>     vkGetWinrtDisplayNV;
+#  else
+      InstrumentedCommandPlaceholder vkAcquireWinrtDisplayNV_placeholder;
+      InstrumentedCommandPlaceholder vkGetWinrtDisplayNV_placeholder;
+#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+#  if defined( VK_USE_PLATFORM_DIRECTFB_EXT )
+      //=== VK_EXT_directfb_surface ===
+      InstrumentedCommand<PFN_vkCreateDirectFBSurfaceEXT>                        vkCreateDirectFBSurfaceEXT;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceDirectFBPresentationSupportEXT> vkGetPhysicalDeviceDirectFBPresentationSupportEXT;
+#  else
+      InstrumentedCommandPlaceholder vkCreateDirectFBSurfaceEXT_placeholder;
+      InstrumentedCommandPlaceholder vkGetPhysicalDeviceDirectFBPresentationSupportEXT_placeholder;
+#  endif /*VK_USE_PLATFORM_DIRECTFB_EXT*/
+
+      //=== VK_EXT_vertex_input_dynamic_state ===
+      InstrumentedCommand<PFN_vkCmdSetVertexInputEXT> vkCmdSetVertexInputEXT;
+
+#  if defined( VK_USE_PLATFORM_FUCHSIA )
+      //=== VK_FUCHSIA_external_memory ===
+      InstrumentedCommand<PFN_vkGetMemoryZirconHandleFUCHSIA>           vkGetMemoryZirconHandleFUCHSIA;
+      InstrumentedCommand<PFN_vkGetMemoryZirconHandlePropertiesFUCHSIA> vkGetMemoryZirconHandlePropertiesFUCHSIA;
+#  else
+      InstrumentedCommandPlaceholder vkGetMemoryZirconHandleFUCHSIA_placeholder;
+      InstrumentedCommandPlaceholder vkGetMemoryZirconHandlePropertiesFUCHSIA_placeholder;
+#  endif /*VK_USE_PLATFORM_FUCHSIA*/
+
+#  if defined( VK_USE_PLATFORM_FUCHSIA )
+      //=== VK_FUCHSIA_external_semaphore ===
+      InstrumentedCommand<PFN_vkImportSemaphoreZirconHandleFUCHSIA> vkImportSemaphoreZirconHandleFUCHSIA;
+      InstrumentedCommand<PFN_vkGetSemaphoreZirconHandleFUCHSIA>    vkGetSemaphoreZirconHandleFUCHSIA;
+#  else
+      InstrumentedCommandPlaceholder vkImportSemaphoreZirconHandleFUCHSIA_placeholder;
+      InstrumentedCommandPlaceholder vkGetSemaphoreZirconHandleFUCHSIA_placeholder;
+#  endif /*VK_USE_PLATFORM_FUCHSIA*/
+
+#  if defined( VK_USE_PLATFORM_FUCHSIA )
+      //=== VK_FUCHSIA_buffer_collection ===
+      InstrumentedCommand<PFN_vkCreateBufferCollectionFUCHSIA>               vkCreateBufferCollectionFUCHSIA;
+      InstrumentedCommand<PFN_vkSetBufferCollectionImageConstraintsFUCHSIA>  vkSetBufferCollectionImageConstraintsFUCHSIA;
+      InstrumentedCommand<PFN_vkSetBufferCollectionBufferConstraintsFUCHSIA> vkSetBufferCollectionBufferConstraintsFUCHSIA;
+      InstrumentedCommand<PFN_vkDestroyBufferCollectionFUCHSIA>              vkDestroyBufferCollectionFUCHSIA;
+      InstrumentedCommand<PFN_vkGetBufferCollectionPropertiesFUCHSIA>        vkGetBufferCollectionPropertiesFUCHSIA;
+#  else
+      InstrumentedCommandPlaceholder vkCreateBufferCollectionFUCHSIA_placeholder;
+      InstrumentedCommandPlaceholder vkSetBufferCollectionImageConstraintsFUCHSIA_placeholder;
+      InstrumentedCommandPlaceholder vkSetBufferCollectionBufferConstraintsFUCHSIA_placeholder;
+      InstrumentedCommandPlaceholder vkDestroyBufferCollectionFUCHSIA_placeholder;
+      InstrumentedCommandPlaceholder vkGetBufferCollectionPropertiesFUCHSIA_placeholder;
+#  endif /*VK_USE_PLATFORM_FUCHSIA*/
+
+      //=== VK_HUAWEI_subpass_shading ===
+      InstrumentedCommand<PFN_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI> vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI;
+      InstrumentedCommand<PFN_vkCmdSubpassShadingHUAWEI>                       vkCmdSubpassShadingHUAWEI;
+
+      //=== VK_HUAWEI_invocation_mask ===
+      InstrumentedCommand<PFN_vkCmdBindInvocationMaskHUAWEI> vkCmdBindInvocationMaskHUAWEI;
+
+      //=== VK_NV_external_memory_rdma ===
+      InstrumentedCommand<PFN_vkGetMemoryRemoteAddressNV> vkGetMemoryRemoteAddressNV;
+
+      //=== VK_EXT_pipeline_properties ===
+      InstrumentedCommand<PFN_vkGetPipelinePropertiesEXT> vkGetPipelinePropertiesEXT;
+
+      //=== VK_EXT_extended_dynamic_state2 ===
+      InstrumentedCommand<PFN_vkCmdSetPatchControlPointsEXT>      vkCmdSetPatchControlPointsEXT;
+      InstrumentedCommand<PFN_vkCmdSetRasterizerDiscardEnableEXT> vkCmdSetRasterizerDiscardEnableEXT;
+      InstrumentedCommand<PFN_vkCmdSetDepthBiasEnableEXT>         vkCmdSetDepthBiasEnableEXT;
+      InstrumentedCommand<PFN_vkCmdSetLogicOpEXT>                 vkCmdSetLogicOpEXT;
+      InstrumentedCommand<PFN_vkCmdSetPrimitiveRestartEnableEXT>  vkCmdSetPrimitiveRestartEnableEXT;
+
+#  if defined( VK_USE_PLATFORM_SCREEN_QNX )
+      //=== VK_QNX_screen_surface ===
+      InstrumentedCommand<PFN_vkCreateScreenSurfaceQNX>                        vkCreateScreenSurfaceQNX;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceScreenPresentationSupportQNX> vkGetPhysicalDeviceScreenPresentationSupportQNX;
+#  else
+      InstrumentedCommandPlaceholder vkCreateScreenSurfaceQNX_placeholder;
+      InstrumentedCommandPlaceholder vkGetPhysicalDeviceScreenPresentationSupportQNX_placeholder;
+#  endif /*VK_USE_PLATFORM_SCREEN_QNX*/
+
+      //=== VK_EXT_color_write_enable ===
+      InstrumentedCommand<PFN_vkCmdSetColorWriteEnableEXT> vkCmdSetColorWriteEnableEXT;
+
+      //=== VK_KHR_ray_tracing_maintenance1 ===
+      InstrumentedCommand<PFN_vkCmdTraceRaysIndirect2KHR> vkCmdTraceRaysIndirect2KHR;
+
+      //=== VK_EXT_multi_draw ===
+      InstrumentedCommand<PFN_vkCmdDrawMultiEXT>        vkCmdDrawMultiEXT;
+      InstrumentedCommand<PFN_vkCmdDrawMultiIndexedEXT> vkCmdDrawMultiIndexedEXT;
+
+      //=== VK_EXT_opacity_micromap ===
+      InstrumentedCommand<PFN_vkCreateMicromapEXT>                 vkCreateMicromapEXT;
+      InstrumentedCommand<PFN_vkDestroyMicromapEXT>                vkDestroyMicromapEXT;
+      InstrumentedCommand<PFN_vkCmdBuildMicromapsEXT>              vkCmdBuildMicromapsEXT;
+      InstrumentedCommand<PFN_vkBuildMicromapsEXT>                 vkBuildMicromapsEXT;
+      InstrumentedCommand<PFN_vkCopyMicromapEXT>                   vkCopyMicromapEXT;
+      InstrumentedCommand<PFN_vkCopyMicromapToMemoryEXT>           vkCopyMicromapToMemoryEXT;
+      InstrumentedCommand<PFN_vkCopyMemoryToMicromapEXT>           vkCopyMemoryToMicromapEXT;
+      InstrumentedCommand<PFN_vkWriteMicromapsPropertiesEXT>       vkWriteMicromapsPropertiesEXT;
+      InstrumentedCommand<PFN_vkCmdCopyMicromapEXT>                vkCmdCopyMicromapEXT;
+      InstrumentedCommand<PFN_vkCmdCopyMicromapToMemoryEXT>        vkCmdCopyMicromapToMemoryEXT;
+      InstrumentedCommand<PFN_vkCmdCopyMemoryToMicromapEXT>        vkCmdCopyMemoryToMicromapEXT;
+      InstrumentedCommand<PFN_vkCmdWriteMicromapsPropertiesEXT>    vkCmdWriteMicromapsPropertiesEXT;
+      InstrumentedCommand<PFN_vkGetDeviceMicromapCompatibilityEXT> vkGetDeviceMicromapCompatibilityEXT;
+      InstrumentedCommand<PFN_vkGetMicromapBuildSizesEXT>          vkGetMicromapBuildSizesEXT;
+
+      //=== VK_HUAWEI_cluster_culling_shader ===
+      InstrumentedCommand<PFN_vkCmdDrawClusterHUAWEI>         vkCmdDrawClusterHUAWEI;
+      InstrumentedCommand<PFN_vkCmdDrawClusterIndirectHUAWEI> vkCmdDrawClusterIndirectHUAWEI;
+
+      //=== VK_EXT_pageable_device_local_memory ===
+      InstrumentedCommand<PFN_vkSetDeviceMemoryPriorityEXT> vkSetDeviceMemoryPriorityEXT;
+
+      //=== VK_KHR_maintenance4 ===
+      InstrumentedCommand<PFN_vkGetDeviceBufferMemoryRequirementsKHR>      vkGetDeviceBufferMemoryRequirementsKHR;
+      InstrumentedCommand<PFN_vkGetDeviceImageMemoryRequirementsKHR>       vkGetDeviceImageMemoryRequirementsKHR;
+      InstrumentedCommand<PFN_vkGetDeviceImageSparseMemoryRequirementsKHR> vkGetDeviceImageSparseMemoryRequirementsKHR;
+
+      //=== VK_ARM_scheduling_controls ===
+      InstrumentedCommand<PFN_vkCmdSetDispatchParametersARM> vkCmdSetDispatchParametersARM;
+
+      //=== VK_VALVE_descriptor_set_host_mapping ===
+      InstrumentedCommand<PFN_vkGetDescriptorSetLayoutHostMappingInfoVALVE> vkGetDescriptorSetLayoutHostMappingInfoVALVE;
+      InstrumentedCommand<PFN_vkGetDescriptorSetHostMappingVALVE>           vkGetDescriptorSetHostMappingVALVE;
+
+      //=== VK_NV_copy_memory_indirect ===
+      InstrumentedCommand<PFN_vkCmdCopyMemoryIndirectNV>        vkCmdCopyMemoryIndirectNV;
+      InstrumentedCommand<PFN_vkCmdCopyMemoryToImageIndirectNV> vkCmdCopyMemoryToImageIndirectNV;
+
+      //=== VK_NV_memory_decompression ===
+      InstrumentedCommand<PFN_vkCmdDecompressMemoryNV>              vkCmdDecompressMemoryNV;
+      InstrumentedCommand<PFN_vkCmdDecompressMemoryIndirectCountNV> vkCmdDecompressMemoryIndirectCountNV;
+
+      //=== VK_NV_device_generated_commands_compute ===
+      InstrumentedCommand<PFN_vkGetPipelineIndirectMemoryRequirementsNV> vkGetPipelineIndirectMemoryRequirementsNV;
+      InstrumentedCommand<PFN_vkCmdUpdatePipelineIndirectBufferNV>       vkCmdUpdatePipelineIndirectBufferNV;
+      InstrumentedCommand<PFN_vkGetPipelineIndirectDeviceAddressNV>      vkGetPipelineIndirectDeviceAddressNV;
+
+#  if defined( VK_USE_PLATFORM_OHOS )
+      //=== VK_OHOS_external_memory ===
+      InstrumentedCommand<PFN_vkGetNativeBufferPropertiesOHOS> vkGetNativeBufferPropertiesOHOS;
+      InstrumentedCommand<PFN_vkGetMemoryNativeBufferOHOS>     vkGetMemoryNativeBufferOHOS;
+#  else
+      InstrumentedCommandPlaceholder vkGetNativeBufferPropertiesOHOS_placeholder;
+      InstrumentedCommandPlaceholder vkGetMemoryNativeBufferOHOS_placeholder;
+#  endif /*VK_USE_PLATFORM_OHOS*/
+
+      //=== VK_EXT_extended_dynamic_state3 ===
+      InstrumentedCommand<PFN_vkCmdSetDepthClampEnableEXT>                 vkCmdSetDepthClampEnableEXT;
+      InstrumentedCommand<PFN_vkCmdSetPolygonModeEXT>                      vkCmdSetPolygonModeEXT;
+      InstrumentedCommand<PFN_vkCmdSetRasterizationSamplesEXT>             vkCmdSetRasterizationSamplesEXT;
+      InstrumentedCommand<PFN_vkCmdSetSampleMaskEXT>                       vkCmdSetSampleMaskEXT;
+      InstrumentedCommand<PFN_vkCmdSetAlphaToCoverageEnableEXT>            vkCmdSetAlphaToCoverageEnableEXT;
+      InstrumentedCommand<PFN_vkCmdSetAlphaToOneEnableEXT>                 vkCmdSetAlphaToOneEnableEXT;
+      InstrumentedCommand<PFN_vkCmdSetLogicOpEnableEXT>                    vkCmdSetLogicOpEnableEXT;
+      InstrumentedCommand<PFN_vkCmdSetColorBlendEnableEXT>                 vkCmdSetColorBlendEnableEXT;
+      InstrumentedCommand<PFN_vkCmdSetColorBlendEquationEXT>               vkCmdSetColorBlendEquationEXT;
+      InstrumentedCommand<PFN_vkCmdSetColorWriteMaskEXT>                   vkCmdSetColorWriteMaskEXT;
+      InstrumentedCommand<PFN_vkCmdSetTessellationDomainOriginEXT>         vkCmdSetTessellationDomainOriginEXT;
+      InstrumentedCommand<PFN_vkCmdSetRasterizationStreamEXT>              vkCmdSetRasterizationStreamEXT;
+      InstrumentedCommand<PFN_vkCmdSetConservativeRasterizationModeEXT>    vkCmdSetConservativeRasterizationModeEXT;
+      InstrumentedCommand<PFN_vkCmdSetExtraPrimitiveOverestimationSizeEXT> vkCmdSetExtraPrimitiveOverestimationSizeEXT;
+      InstrumentedCommand<PFN_vkCmdSetDepthClipEnableEXT>                  vkCmdSetDepthClipEnableEXT;
+      InstrumentedCommand<PFN_vkCmdSetSampleLocationsEnableEXT>            vkCmdSetSampleLocationsEnableEXT;
+      InstrumentedCommand<PFN_vkCmdSetColorBlendAdvancedEXT>               vkCmdSetColorBlendAdvancedEXT;
+      InstrumentedCommand<PFN_vkCmdSetProvokingVertexModeEXT>              vkCmdSetProvokingVertexModeEXT;
+      InstrumentedCommand<PFN_vkCmdSetLineRasterizationModeEXT>            vkCmdSetLineRasterizationModeEXT;
+      InstrumentedCommand<PFN_vkCmdSetLineStippleEnableEXT>                vkCmdSetLineStippleEnableEXT;
+      InstrumentedCommand<PFN_vkCmdSetDepthClipNegativeOneToOneEXT>        vkCmdSetDepthClipNegativeOneToOneEXT;
+      InstrumentedCommand<PFN_vkCmdSetViewportWScalingEnableNV>            vkCmdSetViewportWScalingEnableNV;
+      InstrumentedCommand<PFN_vkCmdSetViewportSwizzleNV>                   vkCmdSetViewportSwizzleNV;
+      InstrumentedCommand<PFN_vkCmdSetCoverageToColorEnableNV>             vkCmdSetCoverageToColorEnableNV;
+      InstrumentedCommand<PFN_vkCmdSetCoverageToColorLocationNV>           vkCmdSetCoverageToColorLocationNV;
+      InstrumentedCommand<PFN_vkCmdSetCoverageModulationModeNV>            vkCmdSetCoverageModulationModeNV;
+      InstrumentedCommand<PFN_vkCmdSetCoverageModulationTableEnableNV>     vkCmdSetCoverageModulationTableEnableNV;
+      InstrumentedCommand<PFN_vkCmdSetCoverageModulationTableNV>           vkCmdSetCoverageModulationTableNV;
+      InstrumentedCommand<PFN_vkCmdSetShadingRateImageEnableNV>            vkCmdSetShadingRateImageEnableNV;
+      InstrumentedCommand<PFN_vkCmdSetRepresentativeFragmentTestEnableNV>  vkCmdSetRepresentativeFragmentTestEnableNV;
+      InstrumentedCommand<PFN_vkCmdSetCoverageReductionModeNV>             vkCmdSetCoverageReductionModeNV;
+
+      //=== VK_ARM_tensors ===
+      InstrumentedCommand<PFN_vkCreateTensorARM>                              vkCreateTensorARM;
+      InstrumentedCommand<PFN_vkDestroyTensorARM>                             vkDestroyTensorARM;
+      InstrumentedCommand<PFN_vkCreateTensorViewARM>                          vkCreateTensorViewARM;
+      InstrumentedCommand<PFN_vkDestroyTensorViewARM>                         vkDestroyTensorViewARM;
+      InstrumentedCommand<PFN_vkGetTensorMemoryRequirementsARM>               vkGetTensorMemoryRequirementsARM;
+      InstrumentedCommand<PFN_vkBindTensorMemoryARM>                          vkBindTensorMemoryARM;
+      InstrumentedCommand<PFN_vkGetDeviceTensorMemoryRequirementsARM>         vkGetDeviceTensorMemoryRequirementsARM;
+      InstrumentedCommand<PFN_vkCmdCopyTensorARM>                             vkCmdCopyTensorARM;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceExternalTensorPropertiesARM> vkGetPhysicalDeviceExternalTensorPropertiesARM;
+      InstrumentedCommand<PFN_vkGetTensorOpaqueCaptureDescriptorDataARM>      vkGetTensorOpaqueCaptureDescriptorDataARM;
+      InstrumentedCommand<PFN_vkGetTensorViewOpaqueCaptureDescriptorDataARM>  vkGetTensorViewOpaqueCaptureDescriptorDataARM;
+
+      //=== VK_EXT_shader_module_identifier ===
+      InstrumentedCommand<PFN_vkGetShaderModuleIdentifierEXT>           vkGetShaderModuleIdentifierEXT;
+      InstrumentedCommand<PFN_vkGetShaderModuleCreateInfoIdentifierEXT> vkGetShaderModuleCreateInfoIdentifierEXT;
+
+      //=== VK_NV_optical_flow ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceOpticalFlowImageFormatsNV> vkGetPhysicalDeviceOpticalFlowImageFormatsNV;
+      InstrumentedCommand<PFN_vkCreateOpticalFlowSessionNV>                 vkCreateOpticalFlowSessionNV;
+      InstrumentedCommand<PFN_vkDestroyOpticalFlowSessionNV>                vkDestroyOpticalFlowSessionNV;
+      InstrumentedCommand<PFN_vkBindOpticalFlowSessionImageNV>              vkBindOpticalFlowSessionImageNV;
+      InstrumentedCommand<PFN_vkCmdOpticalFlowExecuteNV>                    vkCmdOpticalFlowExecuteNV;
+
+      //=== VK_KHR_maintenance5 ===
+      InstrumentedCommand<PFN_vkCmdBindIndexBuffer2KHR>             vkCmdBindIndexBuffer2KHR;
+      InstrumentedCommand<PFN_vkGetRenderingAreaGranularityKHR>     vkGetRenderingAreaGranularityKHR;
+      InstrumentedCommand<PFN_vkGetDeviceImageSubresourceLayoutKHR> vkGetDeviceImageSubresourceLayoutKHR;
+      InstrumentedCommand<PFN_vkGetImageSubresourceLayout2KHR>      vkGetImageSubresourceLayout2KHR;
+
+      //=== VK_AMD_anti_lag ===
+      InstrumentedCommand<PFN_vkAntiLagUpdateAMD> vkAntiLagUpdateAMD;
+
+      //=== VK_KHR_present_wait2 ===
+      InstrumentedCommand<PFN_vkWaitForPresent2KHR> vkWaitForPresent2KHR;
+
+      //=== VK_EXT_shader_object ===
+      InstrumentedCommand<PFN_vkCreateShadersEXT>         vkCreateShadersEXT;
+      InstrumentedCommand<PFN_vkDestroyShaderEXT>         vkDestroyShaderEXT;
+      InstrumentedCommand<PFN_vkGetShaderBinaryDataEXT>   vkGetShaderBinaryDataEXT;
+      InstrumentedCommand<PFN_vkCmdBindShadersEXT>        vkCmdBindShadersEXT;
+      InstrumentedCommand<PFN_vkCmdSetDepthClampRangeEXT> vkCmdSetDepthClampRangeEXT;
+
+      //=== VK_KHR_pipeline_binary ===
+      InstrumentedCommand<PFN_vkCreatePipelineBinariesKHR>      vkCreatePipelineBinariesKHR;
+      InstrumentedCommand<PFN_vkDestroyPipelineBinaryKHR>       vkDestroyPipelineBinaryKHR;
+      InstrumentedCommand<PFN_vkGetPipelineKeyKHR>              vkGetPipelineKeyKHR;
+      InstrumentedCommand<PFN_vkGetPipelineBinaryDataKHR>       vkGetPipelineBinaryDataKHR;
+      InstrumentedCommand<PFN_vkReleaseCapturedPipelineDataKHR> vkReleaseCapturedPipelineDataKHR;
+
+      //=== VK_QCOM_tile_properties ===
+      InstrumentedCommand<PFN_vkGetFramebufferTilePropertiesQCOM>      vkGetFramebufferTilePropertiesQCOM;
+      InstrumentedCommand<PFN_vkGetDynamicRenderingTilePropertiesQCOM> vkGetDynamicRenderingTilePropertiesQCOM;
+
+      //=== VK_KHR_swapchain_maintenance1 ===
+      InstrumentedCommand<PFN_vkReleaseSwapchainImagesKHR> vkReleaseSwapchainImagesKHR;
+
+      //=== VK_NV_cooperative_vector ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceCooperativeVectorPropertiesNV> vkGetPhysicalDeviceCooperativeVectorPropertiesNV;
+      InstrumentedCommand<PFN_vkConvertCooperativeVectorMatrixNV>               vkConvertCooperativeVectorMatrixNV;
+      InstrumentedCommand<PFN_vkCmdConvertCooperativeVectorMatrixNV>            vkCmdConvertCooperativeVectorMatrixNV;
+
+      //=== VK_NV_low_latency2 ===
+      InstrumentedCommand<PFN_vkSetLatencySleepModeNV>  vkSetLatencySleepModeNV;
+      InstrumentedCommand<PFN_vkLatencySleepNV>         vkLatencySleepNV;
+      InstrumentedCommand<PFN_vkSetLatencyMarkerNV>     vkSetLatencyMarkerNV;
+      InstrumentedCommand<PFN_vkGetLatencyTimingsNV>    vkGetLatencyTimingsNV;
+      InstrumentedCommand<PFN_vkQueueNotifyOutOfBandNV> vkQueueNotifyOutOfBandNV;
+
+      //=== VK_KHR_cooperative_matrix ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR> vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR;
+
+      //=== VK_ARM_data_graph ===
+      InstrumentedCommand<PFN_vkCreateDataGraphPipelinesARM>                                        vkCreateDataGraphPipelinesARM;
+      InstrumentedCommand<PFN_vkCreateDataGraphPipelineSessionARM>                                  vkCreateDataGraphPipelineSessionARM;
+      InstrumentedCommand<PFN_vkGetDataGraphPipelineSessionBindPointRequirementsARM>                vkGetDataGraphPipelineSessionBindPointRequirementsARM;
+      InstrumentedCommand<PFN_vkGetDataGraphPipelineSessionMemoryRequirementsARM>                   vkGetDataGraphPipelineSessionMemoryRequirementsARM;
+      InstrumentedCommand<PFN_vkBindDataGraphPipelineSessionMemoryARM>                              vkBindDataGraphPipelineSessionMemoryARM;
+      InstrumentedCommand<PFN_vkDestroyDataGraphPipelineSessionARM>                                 vkDestroyDataGraphPipelineSessionARM;
+      InstrumentedCommand<PFN_vkCmdDispatchDataGraphARM>                                            vkCmdDispatchDataGraphARM;
+      InstrumentedCommand<PFN_vkGetDataGraphPipelineAvailablePropertiesARM>                         vkGetDataGraphPipelineAvailablePropertiesARM;
+      InstrumentedCommand<PFN_vkGetDataGraphPipelinePropertiesARM>                                  vkGetDataGraphPipelinePropertiesARM;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM>                 vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceQueueFamilyDataGraphProcessingEnginePropertiesARM> vkGetPhysicalDeviceQueueFamilyDataGraphProcessingEnginePropertiesARM;
+
+      //=== VK_ARM_data_graph_instruction_set_tosa ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceQueueFamilyDataGraphEngineOperationPropertiesARM> vkGetPhysicalDeviceQueueFamilyDataGraphEngineOperationPropertiesARM;
+
+      //=== VK_EXT_attachment_feedback_loop_dynamic_state ===
+      InstrumentedCommand<PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT> vkCmdSetAttachmentFeedbackLoopEnableEXT;
+
+#  if defined( VK_USE_PLATFORM_SCREEN_QNX )
+      //=== VK_QNX_external_memory_screen_buffer ===
+      InstrumentedCommand<PFN_vkGetScreenBufferPropertiesQNX> vkGetScreenBufferPropertiesQNX;
+#  else
+      InstrumentedCommandPlaceholder vkGetScreenBufferPropertiesQNX_placeholder;
+#  endif /*VK_USE_PLATFORM_SCREEN_QNX*/
+
+      //=== VK_KHR_line_rasterization ===
+      InstrumentedCommand<PFN_vkCmdSetLineStippleKHR> vkCmdSetLineStippleKHR;
+
+      //=== VK_KHR_calibrated_timestamps ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsKHR> vkGetPhysicalDeviceCalibrateableTimeDomainsKHR;
+      InstrumentedCommand<PFN_vkGetCalibratedTimestampsKHR>                   vkGetCalibratedTimestampsKHR;
+
+      //=== VK_KHR_maintenance6 ===
+      InstrumentedCommand<PFN_vkCmdBindDescriptorSets2KHR>                   vkCmdBindDescriptorSets2KHR;
+      InstrumentedCommand<PFN_vkCmdPushConstants2KHR>                        vkCmdPushConstants2KHR;
+      InstrumentedCommand<PFN_vkCmdPushDescriptorSet2KHR>                    vkCmdPushDescriptorSet2KHR;
+      InstrumentedCommand<PFN_vkCmdPushDescriptorSetWithTemplate2KHR>        vkCmdPushDescriptorSetWithTemplate2KHR;
+      InstrumentedCommand<PFN_vkCmdSetDescriptorBufferOffsets2EXT>           vkCmdSetDescriptorBufferOffsets2EXT;
+      InstrumentedCommand<PFN_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT> vkCmdBindDescriptorBufferEmbeddedSamplers2EXT;
+
+      //=== VK_QCOM_tile_memory_heap ===
+      InstrumentedCommand<PFN_vkCmdBindTileMemoryQCOM> vkCmdBindTileMemoryQCOM;
+
+      //=== VK_KHR_copy_memory_indirect ===
+      InstrumentedCommand<PFN_vkCmdCopyMemoryIndirectKHR>        vkCmdCopyMemoryIndirectKHR;
+      InstrumentedCommand<PFN_vkCmdCopyMemoryToImageIndirectKHR> vkCmdCopyMemoryToImageIndirectKHR;
+
+      //=== VK_EXT_memory_decompression ===
+      InstrumentedCommand<PFN_vkCmdDecompressMemoryEXT>              vkCmdDecompressMemoryEXT;
+      InstrumentedCommand<PFN_vkCmdDecompressMemoryIndirectCountEXT> vkCmdDecompressMemoryIndirectCountEXT;
+
+      //=== VK_NV_external_compute_queue ===
+      InstrumentedCommand<PFN_vkCreateExternalComputeQueueNV>  vkCreateExternalComputeQueueNV;
+      InstrumentedCommand<PFN_vkDestroyExternalComputeQueueNV> vkDestroyExternalComputeQueueNV;
+      InstrumentedCommand<PFN_vkGetExternalComputeQueueDataNV> vkGetExternalComputeQueueDataNV;
+
+      //=== VK_NV_cluster_acceleration_structure ===
+      InstrumentedCommand<PFN_vkGetClusterAccelerationStructureBuildSizesNV>    vkGetClusterAccelerationStructureBuildSizesNV;
+      InstrumentedCommand<PFN_vkCmdBuildClusterAccelerationStructureIndirectNV> vkCmdBuildClusterAccelerationStructureIndirectNV;
+
+      //=== VK_NV_partitioned_acceleration_structure ===
+      InstrumentedCommand<PFN_vkGetPartitionedAccelerationStructuresBuildSizesNV> vkGetPartitionedAccelerationStructuresBuildSizesNV;
+      InstrumentedCommand<PFN_vkCmdBuildPartitionedAccelerationStructuresNV>      vkCmdBuildPartitionedAccelerationStructuresNV;
+
+      //=== VK_EXT_device_generated_commands ===
+      InstrumentedCommand<PFN_vkGetGeneratedCommandsMemoryRequirementsEXT> vkGetGeneratedCommandsMemoryRequirementsEXT;
+      InstrumentedCommand<PFN_vkCmdPreprocessGeneratedCommandsEXT>         vkCmdPreprocessGeneratedCommandsEXT;
+      InstrumentedCommand<PFN_vkCmdExecuteGeneratedCommandsEXT>            vkCmdExecuteGeneratedCommandsEXT;
+      InstrumentedCommand<PFN_vkCreateIndirectCommandsLayoutEXT>           vkCreateIndirectCommandsLayoutEXT;
+      InstrumentedCommand<PFN_vkDestroyIndirectCommandsLayoutEXT>          vkDestroyIndirectCommandsLayoutEXT;
+      InstrumentedCommand<PFN_vkCreateIndirectExecutionSetEXT>             vkCreateIndirectExecutionSetEXT;
+      InstrumentedCommand<PFN_vkDestroyIndirectExecutionSetEXT>            vkDestroyIndirectExecutionSetEXT;
+      InstrumentedCommand<PFN_vkUpdateIndirectExecutionSetPipelineEXT>     vkUpdateIndirectExecutionSetPipelineEXT;
+      InstrumentedCommand<PFN_vkUpdateIndirectExecutionSetShaderEXT>       vkUpdateIndirectExecutionSetShaderEXT;
+
+      //=== VK_KHR_device_fault ===
+      InstrumentedCommand<PFN_vkGetDeviceFaultReportsKHR>   vkGetDeviceFaultReportsKHR;
+      InstrumentedCommand<PFN_vkGetDeviceFaultDebugInfoKHR> vkGetDeviceFaultDebugInfoKHR;
+
+#  if defined( VK_USE_PLATFORM_OHOS )
+      //=== VK_OHOS_surface ===
+      InstrumentedCommand<PFN_vkCreateSurfaceOHOS> vkCreateSurfaceOHOS;
+#  else
+      InstrumentedCommandPlaceholder vkCreateSurfaceOHOS_placeholder;
+#  endif /*VK_USE_PLATFORM_OHOS*/
+
+      //=== VK_NV_cooperative_matrix2 ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV> vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV;
+
+#  if defined( VK_USE_PLATFORM_METAL_EXT )
+      //=== VK_EXT_external_memory_metal ===
+      InstrumentedCommand<PFN_vkGetMemoryMetalHandleEXT>           vkGetMemoryMetalHandleEXT;
+      InstrumentedCommand<PFN_vkGetMemoryMetalHandlePropertiesEXT> vkGetMemoryMetalHandlePropertiesEXT;
+#  else
+      InstrumentedCommandPlaceholder vkGetMemoryMetalHandleEXT_placeholder;
+      InstrumentedCommandPlaceholder vkGetMemoryMetalHandlePropertiesEXT_placeholder;
+#  endif /*VK_USE_PLATFORM_METAL_EXT*/
+
+      //=== VK_ARM_performance_counters_by_region ===
+      InstrumentedCommand<PFN_vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM> vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM;
+
+      //=== VK_ARM_shader_instrumentation ===
+      InstrumentedCommand<PFN_vkEnumeratePhysicalDeviceShaderInstrumentationMetricsARM> vkEnumeratePhysicalDeviceShaderInstrumentationMetricsARM;
+      InstrumentedCommand<PFN_vkCreateShaderInstrumentationARM>                         vkCreateShaderInstrumentationARM;
+      InstrumentedCommand<PFN_vkDestroyShaderInstrumentationARM>                        vkDestroyShaderInstrumentationARM;
+      InstrumentedCommand<PFN_vkCmdBeginShaderInstrumentationARM>                       vkCmdBeginShaderInstrumentationARM;
+      InstrumentedCommand<PFN_vkCmdEndShaderInstrumentationARM>                         vkCmdEndShaderInstrumentationARM;
+      InstrumentedCommand<PFN_vkGetShaderInstrumentationValuesARM>                      vkGetShaderInstrumentationValuesARM;
+      InstrumentedCommand<PFN_vkClearShaderInstrumentationMetricsARM>                   vkClearShaderInstrumentationMetricsARM;
+
+      //=== VK_EXT_fragment_density_map_offset ===
+      InstrumentedCommand<PFN_vkCmdEndRendering2EXT> vkCmdEndRendering2EXT;
+
+      //=== VK_EXT_custom_resolve ===
+      InstrumentedCommand<PFN_vkCmdBeginCustomResolveEXT> vkCmdBeginCustomResolveEXT;
+
+      //=== VK_KHR_maintenance10 ===
+      InstrumentedCommand<PFN_vkCmdEndRendering2KHR> vkCmdEndRendering2KHR;
+
+      //=== VK_ARM_data_graph_optical_flow ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceQueueFamilyDataGraphOpticalFlowImageFormatsARM> vkGetPhysicalDeviceQueueFamilyDataGraphOpticalFlowImageFormatsARM;
+
+      //=== VK_NV_compute_occupancy_priority ===
+      InstrumentedCommand<PFN_vkCmdSetComputeOccupancyPriorityNV> vkCmdSetComputeOccupancyPriorityNV;
+
+      //=== VK_EXT_cooperative_matrix_maintenance1 ===
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceCooperativeMatrixProperties2EXT> vkGetPhysicalDeviceCooperativeMatrixProperties2EXT;
+
+#  if defined( VK_USE_PLATFORM_UBM_SEC )
+      //=== VK_SEC_ubm_surface ===
+      InstrumentedCommand<PFN_vkCreateUbmSurfaceSEC>                        vkCreateUbmSurfaceSEC;
+      InstrumentedCommand<PFN_vkGetPhysicalDeviceUbmPresentationSupportSEC> vkGetPhysicalDeviceUbmPresentationSupportSEC;
+#  else
+      InstrumentedCommandPlaceholder vkCreateUbmSurfaceSEC_placeholder;
+      InstrumentedCommandPlaceholder vkGetPhysicalDeviceUbmPresentationSupportSEC_placeholder;
+#  endif /*VK_USE_PLATFORM_UBM_SEC*/
+
+      //=== VK_EXT_primitive_restart_index ===
+      InstrumentedCommand<PFN_vkCmdSetPrimitiveRestartIndexEXT> vkCmdSetPrimitiveRestartIndexEXT;
+
+    public:
+      InstrumentingDispatcher() VULKAN_HPP_NOEXCEPT = default;
+
+      explicit InstrumentingDispatcher( Inner const & inner ) : m_inner( inner )
+      {
+        bind();
+      }
+
+      template <typename... Args>
+      void init( Args &&... args )
+      {
+        m_inner.init( std::forward<Args>( args )... );
+        bind();
+      }
+
+      Inner const & getInner() const VULKAN_HPP_NOEXCEPT
+      {
+        return m_inner;
+      }
+
+      // to be called after the Inner dispatcher has been modified directly
+      void bind() VULKAN_HPP_NOEXCEPT
+      {
+        //=== VK_VERSION_1_0 ===
+        vkCreateInstance.bind( m_inner.vkCreateInstance, 0 );
+        vkDestroyInstance.bind( m_inner.vkDestroyInstance, 1 );
+        vkEnumeratePhysicalDevices.bind( m_inner.vkEnumeratePhysicalDevices, 2 );
+        vkGetPhysicalDeviceFeatures.bind( m_inner.vkGetPhysicalDeviceFeatures, 3 );
+        vkGetPhysicalDeviceFormatProperties.bind( m_inner.vkGetPhysicalDeviceFormatProperties, 4 );
+        vkGetPhysicalDeviceImageFormatProperties.bind( m_inner.vkGetPhysicalDeviceImageFormatProperties, 5 );
+        vkGetPhysicalDeviceProperties.bind( m_inner.vkGetPhysicalDeviceProperties, 6 );
+        vkGetPhysicalDeviceQueueFamilyProperties.bind( m_inner.vkGetPhysicalDeviceQueueFamilyProperties, 7 );
+        vkGetPhysicalDeviceMemoryProperties.bind( m_inner.vkGetPhysicalDeviceMemoryProperties, 8 );
+        vkGetInstanceProcAddr.bind( m_inner.vkGetInstanceProcAddr, 9 );
+        vkGetDeviceProcAddr.bind( m_inner.vkGetDeviceProcAddr, 10 );
+        vkCreateDevice.bind( m_inner.vkCreateDevice, 11 );
+        vkDestroyDevice.bind( m_inner.vkDestroyDevice, 12 );
+        vkEnumerateInstanceExtensionProperties.bind( m_inner.vkEnumerateInstanceExtensionProperties, 13 );
+        vkEnumerateDeviceExtensionProperties.bind( m_inner.vkEnumerateDeviceExtensionProperties, 14 );
+        vkEnumerateInstanceLayerProperties.bind( m_inner.vkEnumerateInstanceLayerProperties, 15 );
+        vkEnumerateDeviceLayerProperties.bind( m_inner.vkEnumerateDeviceLayerProperties, 16 );
+        vkGetDeviceQueue.bind( m_inner.vkGetDeviceQueue, 17 );
+        vkQueueSubmit.bind( m_inner.vkQueueSubmit, 18 );
+        vkQueueWaitIdle.bind( m_inner.vkQueueWaitIdle, 19 );
+        vkDeviceWaitIdle.bind( m_inner.vkDeviceWaitIdle, 20 );
+        vkAllocateMemory.bind( m_inner.vkAllocateMemory, 21 );
+        vkFreeMemory.bind( m_inner.vkFreeMemory, 22 );
+        vkMapMemory.bind( m_inner.vkMapMemory, 23 );
+        vkUnmapMemory.bind( m_inner.vkUnmapMemory, 24 );
+        vkFlushMappedMemoryRanges.bind( m_inner.vkFlushMappedMemoryRanges, 25 );
+        vkInvalidateMappedMemoryRanges.bind( m_inner.vkInvalidateMappedMemoryRanges, 26 );
+        vkGetDeviceMemoryCommitment.bind( m_inner.vkGetDeviceMemoryCommitment, 27 );
+        vkBindBufferMemory.bind( m_inner.vkBindBufferMemory, 28 );
+        vkBindImageMemory.bind( m_inner.vkBindImageMemory, 29 );
+        vkGetBufferMemoryRequirements.bind( m_inner.vkGetBufferMemoryRequirements, 30 );
+        vkGetImageMemoryRequirements.bind( m_inner.vkGetImageMemoryRequirements, 31 );
+        vkGetImageSparseMemoryRequirements.bind( m_inner.vkGetImageSparseMemoryRequirements, 32 );
+        vkGetPhysicalDeviceSparseImageFormatProperties.bind( m_inner.vkGetPhysicalDeviceSparseImageFormatProperties, 33 );
+        vkQueueBindSparse.bind( m_inner.vkQueueBindSparse, 34 );
+        vkCreateFence.bind( m_inner.vkCreateFence, 35 );
+        vkDestroyFence.bind( m_inner.vkDestroyFence, 36 );
+        vkResetFences.bind( m_inner.vkResetFences, 37 );
+        vkGetFenceStatus.bind( m_inner.vkGetFenceStatus, 38 );
+        vkWaitForFences.bind( m_inner.vkWaitForFences, 39 );
+        vkCreateSemaphore.bind( m_inner.vkCreateSemaphore, 40 );
+        vkDestroySemaphore.bind( m_inner.vkDestroySemaphore, 41 );
+        vkCreateQueryPool.bind( m_inner.vkCreateQueryPool, 42 );
+        vkDestroyQueryPool.bind( m_inner.vkDestroyQueryPool, 43 );
+        vkGetQueryPoolResults.bind( m_inner.vkGetQueryPoolResults, 44 );
+        vkCreateBuffer.bind( m_inner.vkCreateBuffer, 45 );
+        vkDestroyBuffer.bind( m_inner.vkDestroyBuffer, 46 );
+        vkCreateImage.bind( m_inner.vkCreateImage, 47 );
+        vkDestroyImage.bind( m_inner.vkDestroyImage, 48 );
+        vkGetImageSubresourceLayout.bind( m_inner.vkGetImageSubresourceLayout, 49 );
+        vkCreateImageView.bind( m_inner.vkCreateImageView, 50 );
+        vkDestroyImageView.bind( m_inner.vkDestroyImageView, 51 );
+        vkCreateCommandPool.bind( m_inner.vkCreateCommandPool, 52 );
+        vkDestroyCommandPool.bind( m_inner.vkDestroyCommandPool, 53 );
+        vkResetCommandPool.bind( m_inner.vkResetCommandPool, 54 );
+        vkAllocateCommandBuffers.bind( m_inner.vkAllocateCommandBuffers, 55 );
+        vkFreeCommandBuffers.bind( m_inner.vkFreeCommandBuffers, 56 );
+        vkBeginCommandBuffer.bind( m_inner.vkBeginCommandBuffer, 57 );
+        vkEndCommandBuffer.bind( m_inner.vkEndCommandBuffer, 58 );
+        vkResetCommandBuffer.bind( m_inner.vkResetCommandBuffer, 59 );
+        vkCmdCopyBuffer.bind( m_inner.vkCmdCopyBuffer, 60 );
+        vkCmdCopyImage.bind( m_inner.vkCmdCopyImage, 61 );
+        vkCmdCopyBufferToImage.bind( m_inner.vkCmdCopyBufferToImage, 62 );
+        vkCmdCopyImageToBuffer.bind( m_inner.vkCmdCopyImageToBuffer, 63 );
+        vkCmdUpdateBuffer.bind( m_inner.vkCmdUpdateBuffer, 64 );
+        vkCmdFillBuffer.bind( m_inner.vkCmdFillBuffer, 65 );
+        vkCmdPipelineBarrier.bind( m_inner.vkCmdPipelineBarrier, 66 );
+        vkCmdBeginQuery.bind( m_inner.vkCmdBeginQuery, 67 );
+        vkCmdEndQuery.bind( m_inner.vkCmdEndQuery, 68 );
+        vkCmdResetQueryPool.bind( m_inner.vkCmdResetQueryPool, 69 );
+        vkCmdWriteTimestamp.bind( m_inner.vkCmdWriteTimestamp, 70 );
+        vkCmdCopyQueryPoolResults.bind( m_inner.vkCmdCopyQueryPoolResults, 71 );
+        vkCmdExecuteCommands.bind( m_inner.vkCmdExecuteCommands, 72 );
+        vkCreateEvent.bind( m_inner.vkCreateEvent, 73 );
+        vkDestroyEvent.bind( m_inner.vkDestroyEvent, 74 );
+        vkGetEventStatus.bind( m_inner.vkGetEventStatus, 75 );
+        vkSetEvent.bind( m_inner.vkSetEvent, 76 );
+        vkResetEvent.bind( m_inner.vkResetEvent, 77 );
+        vkCreateBufferView.bind( m_inner.vkCreateBufferView, 78 );
+        vkDestroyBufferView.bind( m_inner.vkDestroyBufferView, 79 );
+        vkCreateShaderModule.bind( m_inner.vkCreateShaderModule, 80 );
+        vkDestroyShaderModule.bind( m_inner.vkDestroyShaderModule, 81 );
+        vkCreatePipelineCache.bind( m_inner.vkCreatePipelineCache, 82 );
+        vkDestroyPipelineCache.bind( m_inner.vkDestroyPipelineCache, 83 );
+        vkGetPipelineCacheData.bind( m_inner.vkGetPipelineCacheData, 84 );
+        vkMergePipelineCaches.bind( m_inner.vkMergePipelineCaches, 85 );
+        vkCreateComputePipelines.bind( m_inner.vkCreateComputePipelines, 86 );
+        vkDestroyPipeline.bind( m_inner.vkDestroyPipeline, 87 );
+        vkCreatePipelineLayout.bind( m_inner.vkCreatePipelineLayout, 88 );
+        vkDestroyPipelineLayout.bind( m_inner.vkDestroyPipelineLayout, 89 );
+        vkCreateSampler.bind( m_inner.vkCreateSampler, 90 );
+        vkDestroySampler.bind( m_inner.vkDestroySampler, 91 );
+        vkCreateDescriptorSetLayout.bind( m_inner.vkCreateDescriptorSetLayout, 92 );
+        vkDestroyDescriptorSetLayout.bind( m_inner.vkDestroyDescriptorSetLayout, 93 );
+        vkCreateDescriptorPool.bind( m_inner.vkCreateDescriptorPool, 94 );
+        vkDestroyDescriptorPool.bind( m_inner.vkDestroyDescriptorPool, 95 );
+        vkResetDescriptorPool.bind( m_inner.vkResetDescriptorPool, 96 );
+        vkAllocateDescriptorSets.bind( m_inner.vkAllocateDescriptorSets, 97 );
+        vkFreeDescriptorSets.bind( m_inner.vkFreeDescriptorSets, 98 );
+        vkUpdateDescriptorSets.bind( m_inner.vkUpdateDescriptorSets, 99 );
+        vkCmdBindPipeline.bind( m_inner.vkCmdBindPipeline, 100 );
+        vkCmdBindDescriptorSets.bind( m_inner.vkCmdBindDescriptorSets, 101 );
+        vkCmdClearColorImage.bind( m_inner.vkCmdClearColorImage, 102 );
+        vkCmdDispatch.bind( m_inner.vkCmdDispatch, 103 );
+        vkCmdDispatchIndirect.bind( m_inner.vkCmdDispatchIndirect, 104 );
+        vkCmdSetEvent.bind( m_inner.vkCmdSetEvent, 105 );
+        vkCmdResetEvent.bind( m_inner.vkCmdResetEvent, 106 );
+        vkCmdWaitEvents.bind( m_inner.vkCmdWaitEvents, 107 );
+        vkCmdPushConstants.bind( m_inner.vkCmdPushConstants, 108 );
+        vkCreateGraphicsPipelines.bind( m_inner.vkCreateGraphicsPipelines, 109 );
+        vkCreateFramebuffer.bind( m_inner.vkCreateFramebuffer, 110 );
+        vkDestroyFramebuffer.bind( m_inner.vkDestroyFramebuffer, 111 );
+        vkCreateRenderPass.bind( m_inner.vkCreateRenderPass, 112 );
+        vkDestroyRenderPass.bind( m_inner.vkDestroyRenderPass, 113 );
+        vkGetRenderAreaGranularity.bind( m_inner.vkGetRenderAreaGranularity, 114 );
+        vkCmdSetViewport.bind( m_inner.vkCmdSetViewport, 115 );
+        vkCmdSetScissor.bind( m_inner.vkCmdSetScissor, 116 );
+        vkCmdSetLineWidth.bind( m_inner.vkCmdSetLineWidth, 117 );
+        vkCmdSetDepthBias.bind( m_inner.vkCmdSetDepthBias, 118 );
+        vkCmdSetBlendConstants.bind( m_inner.vkCmdSetBlendConstants, 119 );
+        vkCmdSetDepthBounds.bind( m_inner.vkCmdSetDepthBounds, 120 );
+        vkCmdSetStencilCompareMask.bind( m_inner.vkCmdSetStencilCompareMask, 121 );
+        vkCmdSetStencilWriteMask.bind( m_inner.vkCmdSetStencilWriteMask, 122 );
+        vkCmdSetStencilReference.bind( m_inner.vkCmdSetStencilReference, 123 );
+        vkCmdBindIndexBuffer.bind( m_inner.vkCmdBindIndexBuffer, 124 );
+        vkCmdBindVertexBuffers.bind( m_inner.vkCmdBindVertexBuffers, 125 );
+        vkCmdDraw.bind( m_inner.vkCmdDraw, 126 );
+        vkCmdDrawIndexed.bind( m_inner.vkCmdDrawIndexed, 127 );
+        vkCmdDrawIndirect.bind( m_inner.vkCmdDrawIndirect, 128 );
+        vkCmdDrawIndexedIndirect.bind( m_inner.vkCmdDrawIndexedIndirect, 129 );
+        vkCmdBlitImage.bind( m_inner.vkCmdBlitImage, 130 );
+        vkCmdClearDepthStencilImage.bind( m_inner.vkCmdClearDepthStencilImage, 131 );
+        vkCmdClearAttachments.bind( m_inner.vkCmdClearAttachments, 132 );
+        vkCmdResolveImage.bind( m_inner.vkCmdResolveImage, 133 );
+        vkCmdBeginRenderPass.bind( m_inner.vkCmdBeginRenderPass, 134 );
+        vkCmdNextSubpass.bind( m_inner.vkCmdNextSubpass, 135 );
+        vkCmdEndRenderPass.bind( m_inner.vkCmdEndRenderPass, 136 );
+
+        //=== VK_VERSION_1_1 ===
+        vkEnumerateInstanceVersion.bind( m_inner.vkEnumerateInstanceVersion, 137 );
+        vkBindBufferMemory2.bind( m_inner.vkBindBufferMemory2, 138 );
+        vkBindImageMemory2.bind( m_inner.vkBindImageMemory2, 139 );
+        vkGetDeviceGroupPeerMemoryFeatures.bind( m_inner.vkGetDeviceGroupPeerMemoryFeatures, 140 );
+        vkCmdSetDeviceMask.bind( m_inner.vkCmdSetDeviceMask, 141 );
+        vkEnumeratePhysicalDeviceGroups.bind( m_inner.vkEnumeratePhysicalDeviceGroups, 142 );
+        vkGetImageMemoryRequirements2.bind( m_inner.vkGetImageMemoryRequirements2, 143 );
+        vkGetBufferMemoryRequirements2.bind( m_inner.vkGetBufferMemoryRequirements2, 144 );
+        vkGetImageSparseMemoryRequirements2.bind( m_inner.vkGetImageSparseMemoryRequirements2, 145 );
+        vkGetPhysicalDeviceFeatures2.bind( m_inner.vkGetPhysicalDeviceFeatures2, 146 );
+        vkGetPhysicalDeviceProperties2.bind( m_inner.vkGetPhysicalDeviceProperties2, 147 );
+        vkGetPhysicalDeviceFormatProperties2.bind( m_inner.vkGetPhysicalDeviceFormatProperties2, 148 );
+        vkGetPhysicalDeviceImageFormatProperties2.bind( m_inner.vkGetPhysicalDeviceImageFormatProperties2, 149 );
+        vkGetPhysicalDeviceQueueFamilyProperties2.bind( m_inner.vkGetPhysicalDeviceQueueFamilyProperties2, 150 );
+        vkGetPhysicalDeviceMemoryProperties2.bind( m_inner.vkGetPhysicalDeviceMemoryProperties2, 151 );
+        vkGetPhysicalDeviceSparseImageFormatProperties2.bind( m_inner.vkGetPhysicalDeviceSparseImageFormatProperties2, 152 );
+        vkTrimCommandPool.bind( m_inner.vkTrimCommandPool, 153 );
+        vkGetDeviceQueue2.bind( m_inner.vkGetDeviceQueue2, 154 );
+        vkGetPhysicalDeviceExternalBufferProperties.bind( m_inner.vkGetPhysicalDeviceExternalBufferProperties, 155 );
+        vkGetPhysicalDeviceExternalFenceProperties.bind( m_inner.vkGetPhysicalDeviceExternalFenceProperties, 156 );
+        vkGetPhysicalDeviceExternalSemaphoreProperties.bind( m_inner.vkGetPhysicalDeviceExternalSemaphoreProperties, 157 );
+        vkCmdDispatchBase.bind( m_inner.vkCmdDispatchBase, 158 );
+        vkCreateDescriptorUpdateTemplate.bind( m_inner.vkCreateDescriptorUpdateTemplate, 159 );
+        vkDestroyDescriptorUpdateTemplate.bind( m_inner.vkDestroyDescriptorUpdateTemplate, 160 );
+        vkUpdateDescriptorSetWithTemplate.bind( m_inner.vkUpdateDescriptorSetWithTemplate, 161 );
+        vkGetDescriptorSetLayoutSupport.bind( m_inner.vkGetDescriptorSetLayoutSupport, 162 );
+        vkCreateSamplerYcbcrConversion.bind( m_inner.vkCreateSamplerYcbcrConversion, 163 );
+        vkDestroySamplerYcbcrConversion.bind( m_inner.vkDestroySamplerYcbcrConversion, 164 );
+
+        //=== VK_VERSION_1_2 ===
+        vkResetQueryPool.bind( m_inner.vkResetQueryPool, 165 );
+        vkGetSemaphoreCounterValue.bind( m_inner.vkGetSemaphoreCounterValue, 166 );
+        vkWaitSemaphores.bind( m_inner.vkWaitSemaphores, 167 );
+        vkSignalSemaphore.bind( m_inner.vkSignalSemaphore, 168 );
+        vkGetBufferDeviceAddress.bind( m_inner.vkGetBufferDeviceAddress, 169 );
+        vkGetBufferOpaqueCaptureAddress.bind( m_inner.vkGetBufferOpaqueCaptureAddress, 170 );
+        vkGetDeviceMemoryOpaqueCaptureAddress.bind( m_inner.vkGetDeviceMemoryOpaqueCaptureAddress, 171 );
+        vkCmdDrawIndirectCount.bind( m_inner.vkCmdDrawIndirectCount, 172 );
+        vkCmdDrawIndexedIndirectCount.bind( m_inner.vkCmdDrawIndexedIndirectCount, 173 );
+        vkCreateRenderPass2.bind( m_inner.vkCreateRenderPass2, 174 );
+        vkCmdBeginRenderPass2.bind( m_inner.vkCmdBeginRenderPass2, 175 );
+        vkCmdNextSubpass2.bind( m_inner.vkCmdNextSubpass2, 176 );
+        vkCmdEndRenderPass2.bind( m_inner.vkCmdEndRenderPass2, 177 );
+
+        //=== VK_VERSION_1_3 ===
+        vkGetPhysicalDeviceToolProperties.bind( m_inner.vkGetPhysicalDeviceToolProperties, 178 );
+        vkCreatePrivateDataSlot.bind( m_inner.vkCreatePrivateDataSlot, 179 );
+        vkDestroyPrivateDataSlot.bind( m_inner.vkDestroyPrivateDataSlot, 180 );
+        vkSetPrivateData.bind( m_inner.vkSetPrivateData, 181 );
+        vkGetPrivateData.bind( m_inner.vkGetPrivateData, 182 );
+        vkCmdPipelineBarrier2.bind( m_inner.vkCmdPipelineBarrier2, 183 );
+        vkCmdWriteTimestamp2.bind( m_inner.vkCmdWriteTimestamp2, 184 );
+        vkQueueSubmit2.bind( m_inner.vkQueueSubmit2, 185 );
+        vkCmdCopyBuffer2.bind( m_inner.vkCmdCopyBuffer2, 186 );
+        vkCmdCopyImage2.bind( m_inner.vkCmdCopyImage2, 187 );
+        vkCmdCopyBufferToImage2.bind( m_inner.vkCmdCopyBufferToImage2, 188 );
+        vkCmdCopyImageToBuffer2.bind( m_inner.vkCmdCopyImageToBuffer2, 189 );
+        vkGetDeviceBufferMemoryRequirements.bind( m_inner.vkGetDeviceBufferMemoryRequirements, 190 );
+        vkGetDeviceImageMemoryRequirements.bind( m_inner.vkGetDeviceImageMemoryRequirements, 191 );
+        vkGetDeviceImageSparseMemoryRequirements.bind( m_inner.vkGetDeviceImageSparseMemoryRequirements, 192 );
+        vkCmdSetEvent2.bind( m_inner.vkCmdSetEvent2, 193 );
+        vkCmdResetEvent2.bind( m_inner.vkCmdResetEvent2, 194 );
+        vkCmdWaitEvents2.bind( m_inner.vkCmdWaitEvents2, 195 );
+        vkCmdBlitImage2.bind( m_inner.vkCmdBlitImage2, 196 );
+        vkCmdResolveImage2.bind( m_inner.vkCmdResolveImage2, 197 );
+        vkCmdBeginRendering.bind( m_inner.vkCmdBeginRendering, 198 );
+        vkCmdEndRendering.bind( m_inner.vkCmdEndRendering, 199 );
+        vkCmdSetCullMode.bind( m_inner.vkCmdSetCullMode, 200 );
+        vkCmdSetFrontFace.bind( m_inner.vkCmdSetFrontFace, 201 );
+        vkCmdSetPrimitiveTopology.bind( m_inner.vkCmdSetPrimitiveTopology, 202 );
+        vkCmdSetViewportWithCount.bind( m_inner.vkCmdSetViewportWithCount, 203 );
+        vkCmdSetScissorWithCount.bind( m_inner.vkCmdSetScissorWithCount, 204 );
+        vkCmdBindVertexBuffers2.bind( m_inner.vkCmdBindVertexBuffers2, 205 );
+        vkCmdSetDepthTestEnable.bind( m_inner.vkCmdSetDepthTestEnable, 206 );
+        vkCmdSetDepthWriteEnable.bind( m_inner.vkCmdSetDepthWriteEnable, 207 );
+        vkCmdSetDepthCompareOp.bind( m_inner.vkCmdSetDepthCompareOp, 208 );
+        vkCmdSetDepthBoundsTestEnable.bind( m_inner.vkCmdSetDepthBoundsTestEnable, 209 );
+        vkCmdSetStencilTestEnable.bind( m_inner.vkCmdSetStencilTestEnable, 210 );
+        vkCmdSetStencilOp.bind( m_inner.vkCmdSetStencilOp, 211 );
+        vkCmdSetRasterizerDiscardEnable.bind( m_inner.vkCmdSetRasterizerDiscardEnable, 212 );
+        vkCmdSetDepthBiasEnable.bind( m_inner.vkCmdSetDepthBiasEnable, 213 );
+        vkCmdSetPrimitiveRestartEnable.bind( m_inner.vkCmdSetPrimitiveRestartEnable, 214 );
+
+        //=== VK_VERSION_1_4 ===
+        vkMapMemory2.bind( m_inner.vkMapMemory2, 215 );
+        vkUnmapMemory2.bind( m_inner.vkUnmapMemory2, 216 );
+        vkGetDeviceImageSubresourceLayout.bind( m_inner.vkGetDeviceImageSubresourceLayout, 217 );
+        vkGetImageSubresourceLayout2.bind( m_inner.vkGetImageSubresourceLayout2, 218 );
+        vkCopyMemoryToImage.bind( m_inner.vkCopyMemoryToImage, 219 );
+        vkCopyImageToMemory.bind( m_inner.vkCopyImageToMemory, 220 );
+        vkCopyImageToImage.bind( m_inner.vkCopyImageToImage, 221 );
+        vkTransitionImageLayout.bind( m_inner.vkTransitionImageLayout, 222 );
+        vkCmdPushDescriptorSet.bind( m_inner.vkCmdPushDescriptorSet, 223 );
+        vkCmdPushDescriptorSetWithTemplate.bind( m_inner.vkCmdPushDescriptorSetWithTemplate, 224 );
+        vkCmdBindDescriptorSets2.bind( m_inner.vkCmdBindDescriptorSets2, 225 );
+        vkCmdPushConstants2.bind( m_inner.vkCmdPushConstants2, 226 );
+        vkCmdPushDescriptorSet2.bind( m_inner.vkCmdPushDescriptorSet2, 227 );
+        vkCmdPushDescriptorSetWithTemplate2.bind( m_inner.vkCmdPushDescriptorSetWithTemplate2, 228 );
+        vkCmdSetLineStipple.bind( m_inner.vkCmdSetLineStipple, 229 );
+        vkCmdBindIndexBuffer2.bind( m_inner.vkCmdBindIndexBuffer2, 230 );
+        vkGetRenderingAreaGranularity.bind( m_inner.vkGetRenderingAreaGranularity, 231 );
+        vkCmdSetRenderingAttachmentLocations.bind( m_inner.vkCmdSetRenderingAttachmentLocations, 232 );
+        vkCmdSetRenderingInputAttachmentIndices.bind( m_inner.vkCmdSetRenderingInputAttachmentIndices, 233 );
+
+        //=== VK_KHR_surface ===
+        vkDestroySurfaceKHR.bind( m_inner.vkDestroySurfaceKHR, 234 );
+        vkGetPhysicalDeviceSurfaceSupportKHR.bind( m_inner.vkGetPhysicalDeviceSurfaceSupportKHR, 235 );
+        vkGetPhysicalDeviceSurfaceCapabilitiesKHR.bind( m_inner.vkGetPhysicalDeviceSurfaceCapabilitiesKHR, 236 );
+        vkGetPhysicalDeviceSurfaceFormatsKHR.bind( m_inner.vkGetPhysicalDeviceSurfaceFormatsKHR, 237 );
+        vkGetPhysicalDeviceSurfacePresentModesKHR.bind( m_inner.vkGetPhysicalDeviceSurfacePresentModesKHR, 238 );
+
+        //=== VK_KHR_swapchain ===
+        vkCreateSwapchainKHR.bind( m_inner.vkCreateSwapchainKHR, 239 );
+        vkDestroySwapchainKHR.bind( m_inner.vkDestroySwapchainKHR, 240 );
+        vkGetSwapchainImagesKHR.bind( m_inner.vkGetSwapchainImagesKHR, 241 );
+        vkAcquireNextImageKHR.bind( m_inner.vkAcquireNextImageKHR, 242 );
+        vkQueuePresentKHR.bind( m_inner.vkQueuePresentKHR, 243 );
+        vkGetDeviceGroupPresentCapabilitiesKHR.bind( m_inner.vkGetDeviceGroupPresentCapabilitiesKHR, 244 );
+        vkGetDeviceGroupSurfacePresentModesKHR.bind( m_inner.vkGetDeviceGroupSurfacePresentModesKHR, 245 );
+        vkGetPhysicalDevicePresentRectanglesKHR.bind( m_inner.vkGetPhysicalDevicePresentRectanglesKHR, 246 );
+        vkAcquireNextImage2KHR.bind( m_inner.vkAcquireNextImage2KHR, 247 );
+
+        //=== VK_KHR_display ===
+        vkGetPhysicalDeviceDisplayPropertiesKHR.bind( m_inner.vkGetPhysicalDeviceDisplayPropertiesKHR, 248 );
+        vkGetPhysicalDeviceDisplayPlanePropertiesKHR.bind( m_inner.vkGetPhysicalDeviceDisplayPlanePropertiesKHR, 249 );
+        vkGetDisplayPlaneSupportedDisplaysKHR.bind( m_inner.vkGetDisplayPlaneSupportedDisplaysKHR, 250 );
+        vkGetDisplayModePropertiesKHR.bind( m_inner.vkGetDisplayModePropertiesKHR, 251 );
+        vkCreateDisplayModeKHR.bind( m_inner.vkCreateDisplayModeKHR, 252 );
+        vkGetDisplayPlaneCapabilitiesKHR.bind( m_inner.vkGetDisplayPlaneCapabilitiesKHR, 253 );
+        vkCreateDisplayPlaneSurfaceKHR.bind( m_inner.vkCreateDisplayPlaneSurfaceKHR, 254 );
+
+        //=== VK_KHR_display_swapchain ===
+        vkCreateSharedSwapchainsKHR.bind( m_inner.vkCreateSharedSwapchainsKHR, 255 );
+
+#  if defined( VK_USE_PLATFORM_XLIB_KHR )
+        //=== VK_KHR_xlib_surface ===
+        vkCreateXlibSurfaceKHR.bind( m_inner.vkCreateXlibSurfaceKHR, 256 );
+        vkGetPhysicalDeviceXlibPresentationSupportKHR.bind( m_inner.vkGetPhysicalDeviceXlibPresentationSupportKHR, 257 );
+#  endif /*VK_USE_PLATFORM_XLIB_KHR*/
+
+#  if defined( VK_USE_PLATFORM_XCB_KHR )
+        //=== VK_KHR_xcb_surface ===
+        vkCreateXcbSurfaceKHR.bind( m_inner.vkCreateXcbSurfaceKHR, 258 );
+        vkGetPhysicalDeviceXcbPresentationSupportKHR.bind( m_inner.vkGetPhysicalDeviceXcbPresentationSupportKHR, 259 );
+#  endif /*VK_USE_PLATFORM_XCB_KHR*/
+
+#  if defined( VK_USE_PLATFORM_WAYLAND_KHR )
+        //=== VK_KHR_wayland_surface ===
+        vkCreateWaylandSurfaceKHR.bind( m_inner.vkCreateWaylandSurfaceKHR, 260 );
+        vkGetPhysicalDeviceWaylandPresentationSupportKHR.bind( m_inner.vkGetPhysicalDeviceWaylandPresentationSupportKHR, 261 );
+#  endif /*VK_USE_PLATFORM_WAYLAND_KHR*/
+
+#  if defined( VK_USE_PLATFORM_ANDROID_KHR )
+        //=== VK_KHR_android_surface ===
+        vkCreateAndroidSurfaceKHR.bind( m_inner.vkCreateAndroidSurfaceKHR, 262 );
+#  endif /*VK_USE_PLATFORM_ANDROID_KHR*/
+
+#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+        //=== VK_KHR_win32_surface ===
+        vkCreateWin32SurfaceKHR.bind( m_inner.vkCreateWin32SurfaceKHR, 263 );
+        vkGetPhysicalDeviceWin32PresentationSupportKHR.bind( m_inner.vkGetPhysicalDeviceWin32PresentationSupportKHR, 264 );
+#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+        //=== VK_EXT_debug_report ===
+        vkCreateDebugReportCallbackEXT.bind( m_inner.vkCreateDebugReportCallbackEXT, 265 );
+        vkDestroyDebugReportCallbackEXT.bind( m_inner.vkDestroyDebugReportCallbackEXT, 266 );
+        vkDebugReportMessageEXT.bind( m_inner.vkDebugReportMessageEXT, 267 );
+
+        //=== VK_EXT_debug_marker ===
+        vkDebugMarkerSetObjectTagEXT.bind( m_inner.vkDebugMarkerSetObjectTagEXT, 268 );
+        vkDebugMarkerSetObjectNameEXT.bind( m_inner.vkDebugMarkerSetObjectNameEXT, 269 );
+        vkCmdDebugMarkerBeginEXT.bind( m_inner.vkCmdDebugMarkerBeginEXT, 270 );
+        vkCmdDebugMarkerEndEXT.bind( m_inner.vkCmdDebugMarkerEndEXT, 271 );
+        vkCmdDebugMarkerInsertEXT.bind( m_inner.vkCmdDebugMarkerInsertEXT, 272 );
+
+        //=== VK_KHR_video_queue ===
+        vkGetPhysicalDeviceVideoCapabilitiesKHR.bind( m_inner.vkGetPhysicalDeviceVideoCapabilitiesKHR, 273 );
+        vkGetPhysicalDeviceVideoFormatPropertiesKHR.bind( m_inner.vkGetPhysicalDeviceVideoFormatPropertiesKHR, 274 );
+        vkCreateVideoSessionKHR.bind( m_inner.vkCreateVideoSessionKHR, 275 );
+        vkDestroyVideoSessionKHR.bind( m_inner.vkDestroyVideoSessionKHR, 276 );
+        vkGetVideoSessionMemoryRequirementsKHR.bind( m_inner.vkGetVideoSessionMemoryRequirementsKHR, 277 );
+        vkBindVideoSessionMemoryKHR.bind( m_inner.vkBindVideoSessionMemoryKHR, 278 );
+        vkCreateVideoSessionParametersKHR.bind( m_inner.vkCreateVideoSessionParametersKHR, 279 );
+        vkUpdateVideoSessionParametersKHR.bind( m_inner.vkUpdateVideoSessionParametersKHR, 280 );
+        vkDestroyVideoSessionParametersKHR.bind( m_inner.vkDestroyVideoSessionParametersKHR, 281 );
+        vkCmdBeginVideoCodingKHR.bind( m_inner.vkCmdBeginVideoCodingKHR, 282 );
+        vkCmdEndVideoCodingKHR.bind( m_inner.vkCmdEndVideoCodingKHR, 283 );
+        vkCmdControlVideoCodingKHR.bind( m_inner.vkCmdControlVideoCodingKHR, 284 );
+
+        //=== VK_KHR_video_decode_queue ===
+        vkCmdDecodeVideoKHR.bind( m_inner.vkCmdDecodeVideoKHR, 285 );
+
+        //=== VK_EXT_transform_feedback ===
+        vkCmdBindTransformFeedbackBuffersEXT.bind( m_inner.vkCmdBindTransformFeedbackBuffersEXT, 286 );
+        vkCmdBeginTransformFeedbackEXT.bind( m_inner.vkCmdBeginTransformFeedbackEXT, 287 );
+        vkCmdEndTransformFeedbackEXT.bind( m_inner.vkCmdEndTransformFeedbackEXT, 288 );
+        vkCmdBeginQueryIndexedEXT.bind( m_inner.vkCmdBeginQueryIndexedEXT, 289 );
+        vkCmdEndQueryIndexedEXT.bind( m_inner.vkCmdEndQueryIndexedEXT, 290 );
+        vkCmdDrawIndirectByteCountEXT.bind( m_inner.vkCmdDrawIndirectByteCountEXT, 291 );
+
+        //=== VK_NVX_binary_import ===
+        vkCreateCuModuleNVX.bind( m_inner.vkCreateCuModuleNVX, 292 );
+        vkCreateCuFunctionNVX.bind( m_inner.vkCreateCuFunctionNVX, 293 );
+        vkDestroyCuModuleNVX.bind( m_inner.vkDestroyCuModuleNVX, 294 );
+        vkDestroyCuFunctionNVX.bind( m_inner.vkDestroyCuFunctionNVX, 295 );
+        vkCmdCuLaunchKernelNVX.bind( m_inner.vkCmdCuLaunchKernelNVX, 296 );
+
+        //=== VK_NVX_image_view_handle ===
+        vkGetImageViewHandleNVX.bind( m_inner.vkGetImageViewHandleNVX, 297 );
+        vkGetImageViewHandle64NVX.bind( m_inner.vkGetImageViewHandle64NVX, 298 );
+        vkGetImageViewAddressNVX.bind( m_inner.vkGetImageViewAddressNVX, 299 );
+        vkGetDeviceCombinedImageSamplerIndexNVX.bind( m_inner.vkGetDeviceCombinedImageSamplerIndexNVX, 300 );
+
+        //=== VK_AMD_draw_indirect_count ===
+        vkCmdDrawIndirectCountAMD.bind( m_inner.vkCmdDrawIndirectCountAMD, 301 );
+        vkCmdDrawIndexedIndirectCountAMD.bind( m_inner.vkCmdDrawIndexedIndirectCountAMD, 302 );
+
+        //=== VK_AMD_shader_info ===
+        vkGetShaderInfoAMD.bind( m_inner.vkGetShaderInfoAMD, 303 );
+
+        //=== VK_KHR_dynamic_rendering ===
+        vkCmdBeginRenderingKHR.bind( m_inner.vkCmdBeginRenderingKHR, 304 );
+        vkCmdEndRenderingKHR.bind( m_inner.vkCmdEndRenderingKHR, 305 );
+
+#  if defined( VK_USE_PLATFORM_GGP )
+        //=== VK_GGP_stream_descriptor_surface ===
+        vkCreateStreamDescriptorSurfaceGGP.bind( m_inner.vkCreateStreamDescriptorSurfaceGGP, 306 );
+#  endif /*VK_USE_PLATFORM_GGP*/
+
+        //=== VK_NV_external_memory_capabilities ===
+        vkGetPhysicalDeviceExternalImageFormatPropertiesNV.bind( m_inner.vkGetPhysicalDeviceExternalImageFormatPropertiesNV, 307 );
+
+#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+        //=== VK_NV_external_memory_win32 ===
+        vkGetMemoryWin32HandleNV.bind( m_inner.vkGetMemoryWin32HandleNV, 308 );
+#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+        //=== VK_KHR_get_physical_device_properties2 ===
+        vkGetPhysicalDeviceFeatures2KHR.bind( m_inner.vkGetPhysicalDeviceFeatures2KHR, 309 );
+        vkGetPhysicalDeviceProperties2KHR.bind( m_inner.vkGetPhysicalDeviceProperties2KHR, 310 );
+        vkGetPhysicalDeviceFormatProperties2KHR.bind( m_inner.vkGetPhysicalDeviceFormatProperties2KHR, 311 );
+        vkGetPhysicalDeviceImageFormatProperties2KHR.bind( m_inner.vkGetPhysicalDeviceImageFormatProperties2KHR, 312 );
+        vkGetPhysicalDeviceQueueFamilyProperties2KHR.bind( m_inner.vkGetPhysicalDeviceQueueFamilyProperties2KHR, 313 );
+        vkGetPhysicalDeviceMemoryProperties2KHR.bind( m_inner.vkGetPhysicalDeviceMemoryProperties2KHR, 314 );
+        vkGetPhysicalDeviceSparseImageFormatProperties2KHR.bind( m_inner.vkGetPhysicalDeviceSparseImageFormatProperties2KHR, 315 );
+
+        //=== VK_KHR_device_group ===
+        vkGetDeviceGroupPeerMemoryFeaturesKHR.bind( m_inner.vkGetDeviceGroupPeerMemoryFeaturesKHR, 316 );
+        vkCmdSetDeviceMaskKHR.bind( m_inner.vkCmdSetDeviceMaskKHR, 317 );
+        vkCmdDispatchBaseKHR.bind( m_inner.vkCmdDispatchBaseKHR, 318 );
+
+#  if defined( VK_USE_PLATFORM_VI_NN )
+        //=== VK_NN_vi_surface ===
+        vkCreateViSurfaceNN.bind( m_inner.vkCreateViSurfaceNN, 319 );
+#  endif /*VK_USE_PLATFORM_VI_NN*/
+
+        //=== VK_KHR_maintenance1 ===
+        vkTrimCommandPoolKHR.bind( m_inner.vkTrimCommandPoolKHR, 320 );
+
+        //=== VK_KHR_device_group_creation ===
+        vkEnumeratePhysicalDeviceGroupsKHR.bind( m_inner.vkEnumeratePhysicalDeviceGroupsKHR, 321 );
+
+        //=== VK_KHR_external_memory_capabilities ===
+        vkGetPhysicalDeviceExternalBufferPropertiesKHR.bind( m_inner.vkGetPhysicalDeviceExternalBufferPropertiesKHR, 322 );
+
+#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+        //=== VK_KHR_external_memory_win32 ===
+        vkGetMemoryWin32HandleKHR.bind( m_inner.vkGetMemoryWin32HandleKHR, 323 );
+        vkGetMemoryWin32HandlePropertiesKHR.bind( m_inner.vkGetMemoryWin32HandlePropertiesKHR, 324 );
+#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+        //=== VK_KHR_external_memory_fd ===
+        vkGetMemoryFdKHR.bind( m_inner.vkGetMemoryFdKHR, 325 );
+        vkGetMemoryFdPropertiesKHR.bind( m_inner.vkGetMemoryFdPropertiesKHR, 326 );
+
+        //=== VK_KHR_external_semaphore_capabilities ===
+        vkGetPhysicalDeviceExternalSemaphorePropertiesKHR.bind( m_inner.vkGetPhysicalDeviceExternalSemaphorePropertiesKHR, 327 );
+
+#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+        //=== VK_KHR_external_semaphore_win32 ===
+        vkImportSemaphoreWin32HandleKHR.bind( m_inner.vkImportSemaphoreWin32HandleKHR, 328 );
+        vkGetSemaphoreWin32HandleKHR.bind( m_inner.vkGetSemaphoreWin32HandleKHR, 329 );
+#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+        //=== VK_KHR_external_semaphore_fd ===
+        vkImportSemaphoreFdKHR.bind( m_inner.vkImportSemaphoreFdKHR, 330 );
+        vkGetSemaphoreFdKHR.bind( m_inner.vkGetSemaphoreFdKHR, 331 );
+
+        //=== VK_KHR_push_descriptor ===
+        vkCmdPushDescriptorSetKHR.bind( m_inner.vkCmdPushDescriptorSetKHR, 332 );
+        vkCmdPushDescriptorSetWithTemplateKHR.bind( m_inner.vkCmdPushDescriptorSetWithTemplateKHR, 333 );
+
+        //=== VK_EXT_conditional_rendering ===
+        vkCmdBeginConditionalRenderingEXT.bind( m_inner.vkCmdBeginConditionalRenderingEXT, 334 );
+        vkCmdEndConditionalRenderingEXT.bind( m_inner.vkCmdEndConditionalRenderingEXT, 335 );
+
+        //=== VK_KHR_descriptor_update_template ===
+        vkCreateDescriptorUpdateTemplateKHR.bind( m_inner.vkCreateDescriptorUpdateTemplateKHR, 336 );
+        vkDestroyDescriptorUpdateTemplateKHR.bind( m_inner.vkDestroyDescriptorUpdateTemplateKHR, 337 );
+        vkUpdateDescriptorSetWithTemplateKHR.bind( m_inner.vkUpdateDescriptorSetWithTemplateKHR, 338 );
+
+        //=== VK_NV_clip_space_w_scaling ===
+        vkCmdSetViewportWScalingNV.bind( m_inner.vkCmdSetViewportWScalingNV, 339 );
+
+        //=== VK_EXT_direct_mode_display ===
+        vkReleaseDisplayEXT.bind( m_inner.vkReleaseDisplayEXT, 340 );
+
+#  if defined( VK_USE_PLATFORM_XLIB_XRANDR_EXT )
+        //=== VK_EXT_acquire_xlib_display ===
+        vkAcquireXlibDisplayEXT.bind( m_inner.vkAcquireXlibDisplayEXT, 341 );
+        vkGetRandROutputDisplayEXT.bind( m_inner.vkGetRandROutputDisplayEXT, 342 );
+#  endif /*VK_USE_PLATFORM_XLIB_XRANDR_EXT*/
+
+        //=== VK_EXT_display_surface_counter ===
+        vkGetPhysicalDeviceSurfaceCapabilities2EXT.bind( m_inner.vkGetPhysicalDeviceSurfaceCapabilities2EXT, 343 );
+
+        //=== VK_EXT_display_control ===
+        vkDisplayPowerControlEXT.bind( m_inner.vkDisplayPowerControlEXT, 344 );
+        vkRegisterDeviceEventEXT.bind( m_inner.vkRegisterDeviceEventEXT, 345 );
+        vkRegisterDisplayEventEXT.bind( m_inner.vkRegisterDisplayEventEXT, 346 );
+        vkGetSwapchainCounterEXT.bind( m_inner.vkGetSwapchainCounterEXT, 347 );
+
+        //=== VK_GOOGLE_display_timing ===
+        vkGetRefreshCycleDurationGOOGLE.bind( m_inner.vkGetRefreshCycleDurationGOOGLE, 348 );
+        vkGetPastPresentationTimingGOOGLE.bind( m_inner.vkGetPastPresentationTimingGOOGLE, 349 );
+
+        //=== VK_EXT_discard_rectangles ===
+        vkCmdSetDiscardRectangleEXT.bind( m_inner.vkCmdSetDiscardRectangleEXT, 350 );
+        vkCmdSetDiscardRectangleEnableEXT.bind( m_inner.vkCmdSetDiscardRectangleEnableEXT, 351 );
+        vkCmdSetDiscardRectangleModeEXT.bind( m_inner.vkCmdSetDiscardRectangleModeEXT, 352 );
+
+        //=== VK_EXT_hdr_metadata ===
+        vkSetHdrMetadataEXT.bind( m_inner.vkSetHdrMetadataEXT, 353 );
+
+        //=== VK_KHR_create_renderpass2 ===
+        vkCreateRenderPass2KHR.bind( m_inner.vkCreateRenderPass2KHR, 354 );
+        vkCmdBeginRenderPass2KHR.bind( m_inner.vkCmdBeginRenderPass2KHR, 355 );
+        vkCmdNextSubpass2KHR.bind( m_inner.vkCmdNextSubpass2KHR, 356 );
+        vkCmdEndRenderPass2KHR.bind( m_inner.vkCmdEndRenderPass2KHR, 357 );
+
+        //=== VK_KHR_shared_presentable_image ===
+        vkGetSwapchainStatusKHR.bind( m_inner.vkGetSwapchainStatusKHR, 358 );
+
+        //=== VK_KHR_external_fence_capabilities ===
+        vkGetPhysicalDeviceExternalFencePropertiesKHR.bind( m_inner.vkGetPhysicalDeviceExternalFencePropertiesKHR, 359 );
+
+#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+        //=== VK_KHR_external_fence_win32 ===
+        vkImportFenceWin32HandleKHR.bind( m_inner.vkImportFenceWin32HandleKHR, 360 );
+        vkGetFenceWin32HandleKHR.bind( m_inner.vkGetFenceWin32HandleKHR, 361 );
+#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+        //=== VK_KHR_external_fence_fd ===
+        vkImportFenceFdKHR.bind( m_inner.vkImportFenceFdKHR, 362 );
+        vkGetFenceFdKHR.bind( m_inner.vkGetFenceFdKHR, 363 );
+
+        //=== VK_KHR_performance_query ===
+        vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR.bind( m_inner.vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR, 364 );
+        vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR.bind( m_inner.vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR, 365 );
+        vkAcquireProfilingLockKHR.bind( m_inner.vkAcquireProfilingLockKHR, 366 );
+        vkReleaseProfilingLockKHR.bind( m_inner.vkReleaseProfilingLockKHR, 367 );
+
+        //=== VK_KHR_get_surface_capabilities2 ===
+        vkGetPhysicalDeviceSurfaceCapabilities2KHR.bind( m_inner.vkGetPhysicalDeviceSurfaceCapabilities2KHR, 368 );
+        vkGetPhysicalDeviceSurfaceFormats2KHR.bind( m_inner.vkGetPhysicalDeviceSurfaceFormats2KHR, 369 );
+
+        //=== VK_KHR_get_display_properties2 ===
+        vkGetPhysicalDeviceDisplayProperties2KHR.bind( m_inner.vkGetPhysicalDeviceDisplayProperties2KHR, 370 );
+        vkGetPhysicalDeviceDisplayPlaneProperties2KHR.bind( m_inner.vkGetPhysicalDeviceDisplayPlaneProperties2KHR, 371 );
+        vkGetDisplayModeProperties2KHR.bind( m_inner.vkGetDisplayModeProperties2KHR, 372 );
+        vkGetDisplayPlaneCapabilities2KHR.bind( m_inner.vkGetDisplayPlaneCapabilities2KHR, 373 );
+
+#  if defined( VK_USE_PLATFORM_IOS_MVK )
+        //=== VK_MVK_ios_surface ===
+        vkCreateIOSSurfaceMVK.bind( m_inner.vkCreateIOSSurfaceMVK, 374 );
+#  endif /*VK_USE_PLATFORM_IOS_MVK*/
+
+#  if defined( VK_USE_PLATFORM_MACOS_MVK )
+        //=== VK_MVK_macos_surface ===
+        vkCreateMacOSSurfaceMVK.bind( m_inner.vkCreateMacOSSurfaceMVK, 375 );
+#  endif /*VK_USE_PLATFORM_MACOS_MVK*/
+
+        //=== VK_EXT_debug_utils ===
+        vkSetDebugUtilsObjectNameEXT.bind( m_inner.vkSetDebugUtilsObjectNameEXT, 376 );
+        vkSetDebugUtilsObjectTagEXT.bind( m_inner.vkSetDebugUtilsObjectTagEXT, 377 );
+        vkQueueBeginDebugUtilsLabelEXT.bind( m_inner.vkQueueBeginDebugUtilsLabelEXT, 378 );
+        vkQueueEndDebugUtilsLabelEXT.bind( m_inner.vkQueueEndDebugUtilsLabelEXT, 379 );
+        vkQueueInsertDebugUtilsLabelEXT.bind( m_inner.vkQueueInsertDebugUtilsLabelEXT, 380 );
+        vkCmdBeginDebugUtilsLabelEXT.bind( m_inner.vkCmdBeginDebugUtilsLabelEXT, 381 );
+        vkCmdEndDebugUtilsLabelEXT.bind( m_inner.vkCmdEndDebugUtilsLabelEXT, 382 );
+        vkCmdInsertDebugUtilsLabelEXT.bind( m_inner.vkCmdInsertDebugUtilsLabelEXT, 383 );
+        vkCreateDebugUtilsMessengerEXT.bind( m_inner.vkCreateDebugUtilsMessengerEXT, 384 );
+        vkDestroyDebugUtilsMessengerEXT.bind( m_inner.vkDestroyDebugUtilsMessengerEXT, 385 );
+        vkSubmitDebugUtilsMessageEXT.bind( m_inner.vkSubmitDebugUtilsMessageEXT, 386 );
+
+#  if defined( VK_USE_PLATFORM_ANDROID_KHR )
+        //=== VK_ANDROID_external_memory_android_hardware_buffer ===
+        vkGetAndroidHardwareBufferPropertiesANDROID.bind( m_inner.vkGetAndroidHardwareBufferPropertiesANDROID, 387 );
+        vkGetMemoryAndroidHardwareBufferANDROID.bind( m_inner.vkGetMemoryAndroidHardwareBufferANDROID, 388 );
+#  endif /*VK_USE_PLATFORM_ANDROID_KHR*/
+
+        //=== VK_AMD_gpa_interface ===
+        vkCreateGpaSessionAMD.bind( m_inner.vkCreateGpaSessionAMD, 389 );
+        vkDestroyGpaSessionAMD.bind( m_inner.vkDestroyGpaSessionAMD, 390 );
+        vkSetGpaDeviceClockModeAMD.bind( m_inner.vkSetGpaDeviceClockModeAMD, 391 );
+        vkGetGpaDeviceClockInfoAMD.bind( m_inner.vkGetGpaDeviceClockInfoAMD, 392 );
+        vkCmdBeginGpaSessionAMD.bind( m_inner.vkCmdBeginGpaSessionAMD, 393 );
+        vkCmdEndGpaSessionAMD.bind( m_inner.vkCmdEndGpaSessionAMD, 394 );
+        vkCmdBeginGpaSampleAMD.bind( m_inner.vkCmdBeginGpaSampleAMD, 395 );
+        vkCmdEndGpaSampleAMD.bind( m_inner.vkCmdEndGpaSampleAMD, 396 );
+        vkGetGpaSessionStatusAMD.bind( m_inner.vkGetGpaSessionStatusAMD, 397 );
+        vkGetGpaSessionResultsAMD.bind( m_inner.vkGetGpaSessionResultsAMD, 398 );
+        vkResetGpaSessionAMD.bind( m_inner.vkResetGpaSessionAMD, 399 );
+        vkCmdCopyGpaSessionResultsAMD.bind( m_inner.vkCmdCopyGpaSessionResultsAMD, 400 );
+
+#  if defined( VK_ENABLE_BETA_EXTENSIONS )
+        //=== VK_AMDX_shader_enqueue ===
+        vkCreateExecutionGraphPipelinesAMDX.bind( m_inner.vkCreateExecutionGraphPipelinesAMDX, 401 );
+        vkGetExecutionGraphPipelineScratchSizeAMDX.bind( m_inner.vkGetExecutionGraphPipelineScratchSizeAMDX, 402 );
+        vkGetExecutionGraphPipelineNodeIndexAMDX.bind( m_inner.vkGetExecutionGraphPipelineNodeIndexAMDX, 403 );
+        vkCmdInitializeGraphScratchMemoryAMDX.bind( m_inner.vkCmdInitializeGraphScratchMemoryAMDX, 404 );
+        vkCmdDispatchGraphAMDX.bind( m_inner.vkCmdDispatchGraphAMDX, 405 );
+        vkCmdDispatchGraphIndirectAMDX.bind( m_inner.vkCmdDispatchGraphIndirectAMDX, 406 );
+        vkCmdDispatchGraphIndirectCountAMDX.bind( m_inner.vkCmdDispatchGraphIndirectCountAMDX, 407 );
+#  endif /*VK_ENABLE_BETA_EXTENSIONS*/
+
+        //=== VK_EXT_descriptor_heap ===
+        vkWriteSamplerDescriptorsEXT.bind( m_inner.vkWriteSamplerDescriptorsEXT, 408 );
+        vkWriteResourceDescriptorsEXT.bind( m_inner.vkWriteResourceDescriptorsEXT, 409 );
+        vkCmdBindSamplerHeapEXT.bind( m_inner.vkCmdBindSamplerHeapEXT, 410 );
+        vkCmdBindResourceHeapEXT.bind( m_inner.vkCmdBindResourceHeapEXT, 411 );
+        vkCmdPushDataEXT.bind( m_inner.vkCmdPushDataEXT, 412 );
+        vkGetImageOpaqueCaptureDataEXT.bind( m_inner.vkGetImageOpaqueCaptureDataEXT, 413 );
+        vkGetPhysicalDeviceDescriptorSizeEXT.bind( m_inner.vkGetPhysicalDeviceDescriptorSizeEXT, 414 );
+        vkRegisterCustomBorderColorEXT.bind( m_inner.vkRegisterCustomBorderColorEXT, 415 );
+        vkUnregisterCustomBorderColorEXT.bind( m_inner.vkUnregisterCustomBorderColorEXT, 416 );
+        vkGetTensorOpaqueCaptureDataARM.bind( m_inner.vkGetTensorOpaqueCaptureDataARM, 417 );
+
+        //=== VK_EXT_sample_locations ===
+        vkCmdSetSampleLocationsEXT.bind( m_inner.vkCmdSetSampleLocationsEXT, 418 );
+        vkGetPhysicalDeviceMultisamplePropertiesEXT.bind( m_inner.vkGetPhysicalDeviceMultisamplePropertiesEXT, 419 );
+
+        //=== VK_KHR_get_memory_requirements2 ===
+        vkGetImageMemoryRequirements2KHR.bind( m_inner.vkGetImageMemoryRequirements2KHR, 420 );
+        vkGetBufferMemoryRequirements2KHR.bind( m_inner.vkGetBufferMemoryRequirements2KHR, 421 );
+        vkGetImageSparseMemoryRequirements2KHR.bind( m_inner.vkGetImageSparseMemoryRequirements2KHR, 422 );
+
+        //=== VK_KHR_acceleration_structure ===
+        vkCreateAccelerationStructureKHR.bind( m_inner.vkCreateAccelerationStructureKHR, 423 );
+        vkDestroyAccelerationStructureKHR.bind( m_inner.vkDestroyAccelerationStructureKHR, 424 );
+        vkCmdBuildAccelerationStructuresKHR.bind( m_inner.vkCmdBuildAccelerationStructuresKHR, 425 );
+        vkCmdBuildAccelerationStructuresIndirectKHR.bind( m_inner.vkCmdBuildAccelerationStructuresIndirectKHR, 426 );
+        vkBuildAccelerationStructuresKHR.bind( m_inner.vkBuildAccelerationStructuresKHR, 427 );
+        vkCopyAccelerationStructureKHR.bind( m_inner.vkCopyAccelerationStructureKHR, 428 );
+        vkCopyAccelerationStructureToMemoryKHR.bind( m_inner.vkCopyAccelerationStructureToMemoryKHR, 429 );
+        vkCopyMemoryToAccelerationStructureKHR.bind( m_inner.vkCopyMemoryToAccelerationStructureKHR, 430 );
+        vkWriteAccelerationStructuresPropertiesKHR.bind( m_inner.vkWriteAccelerationStructuresPropertiesKHR, 431 );
+        vkCmdCopyAccelerationStructureKHR.bind( m_inner.vkCmdCopyAccelerationStructureKHR, 432 );
+        vkCmdCopyAccelerationStructureToMemoryKHR.bind( m_inner.vkCmdCopyAccelerationStructureToMemoryKHR, 433 );
+        vkCmdCopyMemoryToAccelerationStructureKHR.bind( m_inner.vkCmdCopyMemoryToAccelerationStructureKHR, 434 );
+        vkGetAccelerationStructureDeviceAddressKHR.bind( m_inner.vkGetAccelerationStructureDeviceAddressKHR, 435 );
+        vkCmdWriteAccelerationStructuresPropertiesKHR.bind( m_inner.vkCmdWriteAccelerationStructuresPropertiesKHR, 436 );
+        vkGetDeviceAccelerationStructureCompatibilityKHR.bind( m_inner.vkGetDeviceAccelerationStructureCompatibilityKHR, 437 );
+        vkGetAccelerationStructureBuildSizesKHR.bind( m_inner.vkGetAccelerationStructureBuildSizesKHR, 438 );
+
+        //=== VK_KHR_ray_tracing_pipeline ===
+        vkCmdTraceRaysKHR.bind( m_inner.vkCmdTraceRaysKHR, 439 );
+        vkCreateRayTracingPipelinesKHR.bind( m_inner.vkCreateRayTracingPipelinesKHR, 440 );
+        vkGetRayTracingShaderGroupHandlesKHR.bind( m_inner.vkGetRayTracingShaderGroupHandlesKHR, 441 );
+        vkGetRayTracingCaptureReplayShaderGroupHandlesKHR.bind( m_inner.vkGetRayTracingCaptureReplayShaderGroupHandlesKHR, 442 );
+        vkCmdTraceRaysIndirectKHR.bind( m_inner.vkCmdTraceRaysIndirectKHR, 443 );
+        vkGetRayTracingShaderGroupStackSizeKHR.bind( m_inner.vkGetRayTracingShaderGroupStackSizeKHR, 444 );
+        vkCmdSetRayTracingPipelineStackSizeKHR.bind( m_inner.vkCmdSetRayTracingPipelineStackSizeKHR, 445 );
+
+        //=== VK_KHR_sampler_ycbcr_conversion ===
+        vkCreateSamplerYcbcrConversionKHR.bind( m_inner.vkCreateSamplerYcbcrConversionKHR, 446 );
+        vkDestroySamplerYcbcrConversionKHR.bind( m_inner.vkDestroySamplerYcbcrConversionKHR, 447 );
+
+        //=== VK_KHR_bind_memory2 ===
+        vkBindBufferMemory2KHR.bind( m_inner.vkBindBufferMemory2KHR, 448 );
+        vkBindImageMemory2KHR.bind( m_inner.vkBindImageMemory2KHR, 449 );
+
+        //=== VK_EXT_image_drm_format_modifier ===
+        vkGetImageDrmFormatModifierPropertiesEXT.bind( m_inner.vkGetImageDrmFormatModifierPropertiesEXT, 450 );
+
+        //=== VK_EXT_validation_cache ===
+        vkCreateValidationCacheEXT.bind( m_inner.vkCreateValidationCacheEXT, 451 );
+        vkDestroyValidationCacheEXT.bind( m_inner.vkDestroyValidationCacheEXT, 452 );
+        vkMergeValidationCachesEXT.bind( m_inner.vkMergeValidationCachesEXT, 453 );
+        vkGetValidationCacheDataEXT.bind( m_inner.vkGetValidationCacheDataEXT, 454 );
+
+        //=== VK_NV_shading_rate_image ===
+        vkCmdBindShadingRateImageNV.bind( m_inner.vkCmdBindShadingRateImageNV, 455 );
+        vkCmdSetViewportShadingRatePaletteNV.bind( m_inner.vkCmdSetViewportShadingRatePaletteNV, 456 );
+        vkCmdSetCoarseSampleOrderNV.bind( m_inner.vkCmdSetCoarseSampleOrderNV, 457 );
+
+        //=== VK_NV_ray_tracing ===
+        vkCreateAccelerationStructureNV.bind( m_inner.vkCreateAccelerationStructureNV, 458 );
+        vkDestroyAccelerationStructureNV.bind( m_inner.vkDestroyAccelerationStructureNV, 459 );
+        vkGetAccelerationStructureMemoryRequirementsNV.bind( m_inner.vkGetAccelerationStructureMemoryRequirementsNV, 460 );
+        vkBindAccelerationStructureMemoryNV.bind( m_inner.vkBindAccelerationStructureMemoryNV, 461 );
+        vkCmdBuildAccelerationStructureNV.bind( m_inner.vkCmdBuildAccelerationStructureNV, 462 );
+        vkCmdCopyAccelerationStructureNV.bind( m_inner.vkCmdCopyAccelerationStructureNV, 463 );
+        vkCmdTraceRaysNV.bind( m_inner.vkCmdTraceRaysNV, 464 );
+        vkCreateRayTracingPipelinesNV.bind( m_inner.vkCreateRayTracingPipelinesNV, 465 );
+        vkGetRayTracingShaderGroupHandlesNV.bind( m_inner.vkGetRayTracingShaderGroupHandlesNV, 466 );
+        vkGetAccelerationStructureHandleNV.bind( m_inner.vkGetAccelerationStructureHandleNV, 467 );
+        vkCmdWriteAccelerationStructuresPropertiesNV.bind( m_inner.vkCmdWriteAccelerationStructuresPropertiesNV, 468 );
+        vkCompileDeferredNV.bind( m_inner.vkCompileDeferredNV, 469 );
+
+        //=== VK_KHR_maintenance3 ===
+        vkGetDescriptorSetLayoutSupportKHR.bind( m_inner.vkGetDescriptorSetLayoutSupportKHR, 470 );
+
+        //=== VK_KHR_draw_indirect_count ===
+        vkCmdDrawIndirectCountKHR.bind( m_inner.vkCmdDrawIndirectCountKHR, 471 );
+        vkCmdDrawIndexedIndirectCountKHR.bind( m_inner.vkCmdDrawIndexedIndirectCountKHR, 472 );
+
+        //=== VK_EXT_external_memory_host ===
+        vkGetMemoryHostPointerPropertiesEXT.bind( m_inner.vkGetMemoryHostPointerPropertiesEXT, 473 );
+
+        //=== VK_AMD_buffer_marker ===
+        vkCmdWriteBufferMarkerAMD.bind( m_inner.vkCmdWriteBufferMarkerAMD, 474 );
+        vkCmdWriteBufferMarker2AMD.bind( m_inner.vkCmdWriteBufferMarker2AMD, 475 );
+
+        //=== VK_EXT_calibrated_timestamps ===
+        vkGetPhysicalDeviceCalibrateableTimeDomainsEXT.bind( m_inner.vkGetPhysicalDeviceCalibrateableTimeDomainsEXT, 476 );
+        vkGetCalibratedTimestampsEXT.bind( m_inner.vkGetCalibratedTimestampsEXT, 477 );
+
+        //=== VK_NV_mesh_shader ===
+        vkCmdDrawMeshTasksNV.bind( m_inner.vkCmdDrawMeshTasksNV, 478 );
+        vkCmdDrawMeshTasksIndirectNV.bind( m_inner.vkCmdDrawMeshTasksIndirectNV, 479 );
+        vkCmdDrawMeshTasksIndirectCountNV.bind( m_inner.vkCmdDrawMeshTasksIndirectCountNV, 480 );
+
+        //=== VK_NV_scissor_exclusive ===
+        vkCmdSetExclusiveScissorEnableNV.bind( m_inner.vkCmdSetExclusiveScissorEnableNV, 481 );
+        vkCmdSetExclusiveScissorNV.bind( m_inner.vkCmdSetExclusiveScissorNV, 482 );
+
+        //=== VK_NV_device_diagnostic_checkpoints ===
+        vkCmdSetCheckpointNV.bind( m_inner.vkCmdSetCheckpointNV, 483 );
+        vkGetQueueCheckpointDataNV.bind( m_inner.vkGetQueueCheckpointDataNV, 484 );
+        vkGetQueueCheckpointData2NV.bind( m_inner.vkGetQueueCheckpointData2NV, 485 );
+
+        //=== VK_KHR_timeline_semaphore ===
+        vkGetSemaphoreCounterValueKHR.bind( m_inner.vkGetSemaphoreCounterValueKHR, 486 );
+        vkWaitSemaphoresKHR.bind( m_inner.vkWaitSemaphoresKHR, 487 );
+        vkSignalSemaphoreKHR.bind( m_inner.vkSignalSemaphoreKHR, 488 );
+
+        //=== VK_EXT_present_timing ===
+        vkSetSwapchainPresentTimingQueueSizeEXT.bind( m_inner.vkSetSwapchainPresentTimingQueueSizeEXT, 489 );
+        vkGetSwapchainTimingPropertiesEXT.bind( m_inner.vkGetSwapchainTimingPropertiesEXT, 490 );
+        vkGetSwapchainTimeDomainPropertiesEXT.bind( m_inner.vkGetSwapchainTimeDomainPropertiesEXT, 491 );
+        vkGetPastPresentationTimingEXT.bind( m_inner.vkGetPastPresentationTimingEXT, 492 );
+
+        //=== VK_INTEL_performance_query ===
+        vkInitializePerformanceApiINTEL.bind( m_inner.vkInitializePerformanceApiINTEL, 493 );
+        vkUninitializePerformanceApiINTEL.bind( m_inner.vkUninitializePerformanceApiINTEL, 494 );
+        vkCmdSetPerformanceMarkerINTEL.bind( m_inner.vkCmdSetPerformanceMarkerINTEL, 495 );
+        vkCmdSetPerformanceStreamMarkerINTEL.bind( m_inner.vkCmdSetPerformanceStreamMarkerINTEL, 496 );
+        vkCmdSetPerformanceOverrideINTEL.bind( m_inner.vkCmdSetPerformanceOverrideINTEL, 497 );
+        vkAcquirePerformanceConfigurationINTEL.bind( m_inner.vkAcquirePerformanceConfigurationINTEL, 498 );
+        vkReleasePerformanceConfigurationINTEL.bind( m_inner.vkReleasePerformanceConfigurationINTEL, 499 );
+        vkQueueSetPerformanceConfigurationINTEL.bind( m_inner.vkQueueSetPerformanceConfigurationINTEL, 500 );
+        vkGetPerformanceParameterINTEL.bind( m_inner.vkGetPerformanceParameterINTEL, 501 );
+
+        //=== VK_AMD_display_native_hdr ===
+        vkSetLocalDimmingAMD.bind( m_inner.vkSetLocalDimmingAMD, 502 );
+
+#  if defined( VK_USE_PLATFORM_FUCHSIA )
+        //=== VK_FUCHSIA_imagepipe_surface ===
+        vkCreateImagePipeSurfaceFUCHSIA.bind( m_inner.vkCreateImagePipeSurfaceFUCHSIA, 503 );
+#  endif /*VK_USE_PLATFORM_FUCHSIA*/
+
+#  if defined( VK_USE_PLATFORM_METAL_EXT )
+        //=== VK_EXT_metal_surface ===
+        vkCreateMetalSurfaceEXT.bind( m_inner.vkCreateMetalSurfaceEXT, 504 );
+#  endif /*VK_USE_PLATFORM_METAL_EXT*/
+
+        //=== VK_KHR_fragment_shading_rate ===
+        vkGetPhysicalDeviceFragmentShadingRatesKHR.bind( m_inner.vkGetPhysicalDeviceFragmentShadingRatesKHR, 505 );
+        vkCmdSetFragmentShadingRateKHR.bind( m_inner.vkCmdSetFragmentShadingRateKHR, 506 );
+
+        //=== VK_KHR_dynamic_rendering_local_read ===
+        vkCmdSetRenderingAttachmentLocationsKHR.bind( m_inner.vkCmdSetRenderingAttachmentLocationsKHR, 507 );
+        vkCmdSetRenderingInputAttachmentIndicesKHR.bind( m_inner.vkCmdSetRenderingInputAttachmentIndicesKHR, 508 );
+
+        //=== VK_EXT_buffer_device_address ===
+        vkGetBufferDeviceAddressEXT.bind( m_inner.vkGetBufferDeviceAddressEXT, 509 );
+
+        //=== VK_EXT_tooling_info ===
+        vkGetPhysicalDeviceToolPropertiesEXT.bind( m_inner.vkGetPhysicalDeviceToolPropertiesEXT, 510 );
+
+        //=== VK_KHR_present_wait ===
+        vkWaitForPresentKHR.bind( m_inner.vkWaitForPresentKHR, 511 );
+
+        //=== VK_NV_cooperative_matrix ===
+        vkGetPhysicalDeviceCooperativeMatrixPropertiesNV.bind( m_inner.vkGetPhysicalDeviceCooperativeMatrixPropertiesNV, 512 );
+
+        //=== VK_NV_coverage_reduction_mode ===
+        vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV.bind( m_inner.vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV, 513 );
+
+#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+        //=== VK_EXT_full_screen_exclusive ===
+        vkGetPhysicalDeviceSurfacePresentModes2EXT.bind( m_inner.vkGetPhysicalDeviceSurfacePresentModes2EXT, 514 );
+        vkAcquireFullScreenExclusiveModeEXT.bind( m_inner.vkAcquireFullScreenExclusiveModeEXT, 515 );
+        vkReleaseFullScreenExclusiveModeEXT.bind( m_inner.vkReleaseFullScreenExclusiveModeEXT, 516 );
+        vkGetDeviceGroupSurfacePresentModes2EXT.bind( m_inner.vkGetDeviceGroupSurfacePresentModes2EXT, 517 );
+#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+        //=== VK_EXT_headless_surface ===
+        vkCreateHeadlessSurfaceEXT.bind( m_inner.vkCreateHeadlessSurfaceEXT, 518 );
+
+        //=== VK_KHR_buffer_device_address ===
+        vkGetBufferDeviceAddressKHR.bind( m_inner.vkGetBufferDeviceAddressKHR, 519 );
+        vkGetBufferOpaqueCaptureAddressKHR.bind( m_inner.vkGetBufferOpaqueCaptureAddressKHR, 520 );
+        vkGetDeviceMemoryOpaqueCaptureAddressKHR.bind( m_inner.vkGetDeviceMemoryOpaqueCaptureAddressKHR, 521 );
+
+        //=== VK_EXT_line_rasterization ===
+        vkCmdSetLineStippleEXT.bind( m_inner.vkCmdSetLineStippleEXT, 522 );
+
+        //=== VK_EXT_host_query_reset ===
+        vkResetQueryPoolEXT.bind( m_inner.vkResetQueryPoolEXT, 523 );
+
+        //=== VK_EXT_extended_dynamic_state ===
+        vkCmdSetCullModeEXT.bind( m_inner.vkCmdSetCullModeEXT, 524 );
+        vkCmdSetFrontFaceEXT.bind( m_inner.vkCmdSetFrontFaceEXT, 525 );
+        vkCmdSetPrimitiveTopologyEXT.bind( m_inner.vkCmdSetPrimitiveTopologyEXT, 526 );
+        vkCmdSetViewportWithCountEXT.bind( m_inner.vkCmdSetViewportWithCountEXT, 527 );
+        vkCmdSetScissorWithCountEXT.bind( m_inner.vkCmdSetScissorWithCountEXT, 528 );
+        vkCmdBindVertexBuffers2EXT.bind( m_inner.vkCmdBindVertexBuffers2EXT, 529 );
+        vkCmdSetDepthTestEnableEXT.bind( m_inner.vkCmdSetDepthTestEnableEXT, 530 );
+        vkCmdSetDepthWriteEnableEXT.bind( m_inner.vkCmdSetDepthWriteEnableEXT, 531 );
+        vkCmdSetDepthCompareOpEXT.bind( m_inner.vkCmdSetDepthCompareOpEXT, 532 );
+        vkCmdSetDepthBoundsTestEnableEXT.bind( m_inner.vkCmdSetDepthBoundsTestEnableEXT, 533 );
+        vkCmdSetStencilTestEnableEXT.bind( m_inner.vkCmdSetStencilTestEnableEXT, 534 );
+        vkCmdSetStencilOpEXT.bind( m_inner.vkCmdSetStencilOpEXT, 535 );
+
+        //=== VK_KHR_deferred_host_operations ===
+        vkCreateDeferredOperationKHR.bind( m_inner.vkCreateDeferredOperationKHR, 536 );
+        vkDestroyDeferredOperationKHR.bind( m_inner.vkDestroyDeferredOperationKHR, 537 );
+        vkGetDeferredOperationMaxConcurrencyKHR.bind( m_inner.vkGetDeferredOperationMaxConcurrencyKHR, 538 );
+        vkGetDeferredOperationResultKHR.bind( m_inner.vkGetDeferredOperationResultKHR, 539 );
+        vkDeferredOperationJoinKHR.bind( m_inner.vkDeferredOperationJoinKHR, 540 );
+
+        //=== VK_KHR_pipeline_executable_properties ===
+        vkGetPipelineExecutablePropertiesKHR.bind( m_inner.vkGetPipelineExecutablePropertiesKHR, 541 );
+        vkGetPipelineExecutableStatisticsKHR.bind( m_inner.vkGetPipelineExecutableStatisticsKHR, 542 );
+        vkGetPipelineExecutableInternalRepresentationsKHR.bind( m_inner.vkGetPipelineExecutableInternalRepresentationsKHR, 543 );
+
+        //=== VK_EXT_host_image_copy ===
+        vkCopyMemoryToImageEXT.bind( m_inner.vkCopyMemoryToImageEXT, 544 );
+        vkCopyImageToMemoryEXT.bind( m_inner.vkCopyImageToMemoryEXT, 545 );
+        vkCopyImageToImageEXT.bind( m_inner.vkCopyImageToImageEXT, 546 );
+        vkTransitionImageLayoutEXT.bind( m_inner.vkTransitionImageLayoutEXT, 547 );
+        vkGetImageSubresourceLayout2EXT.bind( m_inner.vkGetImageSubresourceLayout2EXT, 548 );
+
+        //=== VK_KHR_map_memory2 ===
+        vkMapMemory2KHR.bind( m_inner.vkMapMemory2KHR, 549 );
+        vkUnmapMemory2KHR.bind( m_inner.vkUnmapMemory2KHR, 550 );
+
+        //=== VK_EXT_swapchain_maintenance1 ===
+        vkReleaseSwapchainImagesEXT.bind( m_inner.vkReleaseSwapchainImagesEXT, 551 );
+
+        //=== VK_NV_device_generated_commands ===
+        vkGetGeneratedCommandsMemoryRequirementsNV.bind( m_inner.vkGetGeneratedCommandsMemoryRequirementsNV, 552 );
+        vkCmdPreprocessGeneratedCommandsNV.bind( m_inner.vkCmdPreprocessGeneratedCommandsNV, 553 );
+        vkCmdExecuteGeneratedCommandsNV.bind( m_inner.vkCmdExecuteGeneratedCommandsNV, 554 );
+        vkCmdBindPipelineShaderGroupNV.bind( m_inner.vkCmdBindPipelineShaderGroupNV, 555 );
+        vkCreateIndirectCommandsLayoutNV.bind( m_inner.vkCreateIndirectCommandsLayoutNV, 556 );
+        vkDestroyIndirectCommandsLayoutNV.bind( m_inner.vkDestroyIndirectCommandsLayoutNV, 557 );
+
+        //=== VK_EXT_depth_bias_control ===
+        vkCmdSetDepthBias2EXT.bind( m_inner.vkCmdSetDepthBias2EXT, 558 );
+
+        //=== VK_EXT_acquire_drm_display ===
+        vkAcquireDrmDisplayEXT.bind( m_inner.vkAcquireDrmDisplayEXT, 559 );
+        vkGetDrmDisplayEXT.bind( m_inner.vkGetDrmDisplayEXT, 560 );
+
+        //=== VK_EXT_private_data ===
+        vkCreatePrivateDataSlotEXT.bind( m_inner.vkCreatePrivateDataSlotEXT, 561 );
+        vkDestroyPrivateDataSlotEXT.bind( m_inner.vkDestroyPrivateDataSlotEXT, 562 );
+        vkSetPrivateDataEXT.bind( m_inner.vkSetPrivateDataEXT, 563 );
+        vkGetPrivateDataEXT.bind( m_inner.vkGetPrivateDataEXT, 564 );
+
+        //=== VK_KHR_video_encode_queue ===
+        vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR.bind( m_inner.vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR, 565 );
+        vkGetEncodedVideoSessionParametersKHR.bind( m_inner.vkGetEncodedVideoSessionParametersKHR, 566 );
+        vkCmdEncodeVideoKHR.bind( m_inner.vkCmdEncodeVideoKHR, 567 );
+
+        //=== VK_QCOM_queue_perf_hint ===
+        vkQueueSetPerfHintQCOM.bind( m_inner.vkQueueSetPerfHintQCOM, 568 );
+
+#  if defined( VK_ENABLE_BETA_EXTENSIONS )
+        //=== VK_NV_cuda_kernel_launch ===
+        vkCreateCudaModuleNV.bind( m_inner.vkCreateCudaModuleNV, 569 );
+        vkGetCudaModuleCacheNV.bind( m_inner.vkGetCudaModuleCacheNV, 570 );
+        vkCreateCudaFunctionNV.bind( m_inner.vkCreateCudaFunctionNV, 571 );
+        vkDestroyCudaModuleNV.bind( m_inner.vkDestroyCudaModuleNV, 572 );
+        vkDestroyCudaFunctionNV.bind( m_inner.vkDestroyCudaFunctionNV, 573 );
+        vkCmdCudaLaunchKernelNV.bind( m_inner.vkCmdCudaLaunchKernelNV, 574 );
+#  endif /*VK_ENABLE_BETA_EXTENSIONS*/
+
+        //=== VK_QCOM_tile_shading ===
+        vkCmdDispatchTileQCOM.bind( m_inner.vkCmdDispatchTileQCOM, 575 );
+        vkCmdBeginPerTileExecutionQCOM.bind( m_inner.vkCmdBeginPerTileExecutionQCOM, 576 );
+        vkCmdEndPerTileExecutionQCOM.bind( m_inner.vkCmdEndPerTileExecutionQCOM, 577 );
+
+        //=== VK_NV_low_latency ===
+        vkSetLatencySleepModeLegacyNV.bind( m_inner.vkSetLatencySleepModeLegacyNV, 578 );
+        vkLatencySleepLegacyNV.bind( m_inner.vkLatencySleepLegacyNV, 579 );
+        vkSetLatencyMarkerLegacyNV.bind( m_inner.vkSetLatencyMarkerLegacyNV, 580 );
+        vkGetLatencyTimingsLegacyNV.bind( m_inner.vkGetLatencyTimingsLegacyNV, 581 );
+        vkQueueNotifyOutOfBandLegacyNV.bind( m_inner.vkQueueNotifyOutOfBandLegacyNV, 582 );
+        vkGetSleepStatusLegacyNV.bind( m_inner.vkGetSleepStatusLegacyNV, 583 );
+        vkShutdownLatencyDeviceLegacyNV.bind( m_inner.vkShutdownLatencyDeviceLegacyNV, 584 );
+
+#  if defined( VK_USE_PLATFORM_METAL_EXT )
+        //=== VK_EXT_metal_objects ===
+        vkExportMetalObjectsEXT.bind( m_inner.vkExportMetalObjectsEXT, 585 );
+#  endif /*VK_USE_PLATFORM_METAL_EXT*/
+
+        //=== VK_KHR_synchronization2 ===
+        vkCmdSetEvent2KHR.bind( m_inner.vkCmdSetEvent2KHR, 586 );
+        vkCmdResetEvent2KHR.bind( m_inner.vkCmdResetEvent2KHR, 587 );
+        vkCmdWaitEvents2KHR.bind( m_inner.vkCmdWaitEvents2KHR, 588 );
+        vkCmdPipelineBarrier2KHR.bind( m_inner.vkCmdPipelineBarrier2KHR, 589 );
+        vkCmdWriteTimestamp2KHR.bind( m_inner.vkCmdWriteTimestamp2KHR, 590 );
+        vkQueueSubmit2KHR.bind( m_inner.vkQueueSubmit2KHR, 591 );
+
+        //=== VK_EXT_descriptor_buffer ===
+        vkGetDescriptorSetLayoutSizeEXT.bind( m_inner.vkGetDescriptorSetLayoutSizeEXT, 592 );
+        vkGetDescriptorSetLayoutBindingOffsetEXT.bind( m_inner.vkGetDescriptorSetLayoutBindingOffsetEXT, 593 );
+        vkGetDescriptorEXT.bind( m_inner.vkGetDescriptorEXT, 594 );
+        vkCmdBindDescriptorBuffersEXT.bind( m_inner.vkCmdBindDescriptorBuffersEXT, 595 );
+        vkCmdSetDescriptorBufferOffsetsEXT.bind( m_inner.vkCmdSetDescriptorBufferOffsetsEXT, 596 );
+        vkCmdBindDescriptorBufferEmbeddedSamplersEXT.bind( m_inner.vkCmdBindDescriptorBufferEmbeddedSamplersEXT, 597 );
+        vkGetBufferOpaqueCaptureDescriptorDataEXT.bind( m_inner.vkGetBufferOpaqueCaptureDescriptorDataEXT, 598 );
+        vkGetImageOpaqueCaptureDescriptorDataEXT.bind( m_inner.vkGetImageOpaqueCaptureDescriptorDataEXT, 599 );
+        vkGetImageViewOpaqueCaptureDescriptorDataEXT.bind( m_inner.vkGetImageViewOpaqueCaptureDescriptorDataEXT, 600 );
+        vkGetSamplerOpaqueCaptureDescriptorDataEXT.bind( m_inner.vkGetSamplerOpaqueCaptureDescriptorDataEXT, 601 );
+        vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT.bind( m_inner.vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT, 602 );
+
+        //=== VK_KHR_device_address_commands ===
+        vkCmdBindIndexBuffer3KHR.bind( m_inner.vkCmdBindIndexBuffer3KHR, 603 );
+        vkCmdBindVertexBuffers3KHR.bind( m_inner.vkCmdBindVertexBuffers3KHR, 604 );
+        vkCmdDrawIndirect2KHR.bind( m_inner.vkCmdDrawIndirect2KHR, 605 );
+        vkCmdDrawIndexedIndirect2KHR.bind( m_inner.vkCmdDrawIndexedIndirect2KHR, 606 );
+        vkCmdDispatchIndirect2KHR.bind( m_inner.vkCmdDispatchIndirect2KHR, 607 );
+        vkCmdCopyMemoryKHR.bind( m_inner.vkCmdCopyMemoryKHR, 608 );
+        vkCmdCopyMemoryToImageKHR.bind( m_inner.vkCmdCopyMemoryToImageKHR, 609 );
+        vkCmdCopyImageToMemoryKHR.bind( m_inner.vkCmdCopyImageToMemoryKHR, 610 );
+        vkCmdUpdateMemoryKHR.bind( m_inner.vkCmdUpdateMemoryKHR, 611 );
+        vkCmdFillMemoryKHR.bind( m_inner.vkCmdFillMemoryKHR, 612 );
+        vkCmdCopyQueryPoolResultsToMemoryKHR.bind( m_inner.vkCmdCopyQueryPoolResultsToMemoryKHR, 613 );
+        vkCmdDrawIndirectCount2KHR.bind( m_inner.vkCmdDrawIndirectCount2KHR, 614 );
+        vkCmdDrawIndexedIndirectCount2KHR.bind( m_inner.vkCmdDrawIndexedIndirectCount2KHR, 615 );
+        vkCmdBeginConditionalRendering2EXT.bind( m_inner.vkCmdBeginConditionalRendering2EXT, 616 );
+        vkCmdBindTransformFeedbackBuffers2EXT.bind( m_inner.vkCmdBindTransformFeedbackBuffers2EXT, 617 );
+        vkCmdBeginTransformFeedback2EXT.bind( m_inner.vkCmdBeginTransformFeedback2EXT, 618 );
+        vkCmdEndTransformFeedback2EXT.bind( m_inner.vkCmdEndTransformFeedback2EXT, 619 );
+        vkCmdDrawIndirectByteCount2EXT.bind( m_inner.vkCmdDrawIndirectByteCount2EXT, 620 );
+        vkCmdDrawMeshTasksIndirect2EXT.bind( m_inner.vkCmdDrawMeshTasksIndirect2EXT, 621 );
+        vkCmdDrawMeshTasksIndirectCount2EXT.bind( m_inner.vkCmdDrawMeshTasksIndirectCount2EXT, 622 );
+        vkCmdWriteMarkerToMemoryAMD.bind( m_inner.vkCmdWriteMarkerToMemoryAMD, 623 );
+        vkCreateAccelerationStructure2KHR.bind( m_inner.vkCreateAccelerationStructure2KHR, 624 );
+
+        //=== VK_NV_fragment_shading_rate_enums ===
+        vkCmdSetFragmentShadingRateEnumNV.bind( m_inner.vkCmdSetFragmentShadingRateEnumNV, 625 );
+
+        //=== VK_EXT_mesh_shader ===
+        vkCmdDrawMeshTasksEXT.bind( m_inner.vkCmdDrawMeshTasksEXT, 626 );
+        vkCmdDrawMeshTasksIndirectEXT.bind( m_inner.vkCmdDrawMeshTasksIndirectEXT, 627 );
+        vkCmdDrawMeshTasksIndirectCountEXT.bind( m_inner.vkCmdDrawMeshTasksIndirectCountEXT, 628 );
+
+        //=== VK_KHR_copy_commands2 ===
+        vkCmdCopyBuffer2KHR.bind( m_inner.vkCmdCopyBuffer2KHR, 629 );
+        vkCmdCopyImage2KHR.bind( m_inner.vkCmdCopyImage2KHR, 630 );
+        vkCmdCopyBufferToImage2KHR.bind( m_inner.vkCmdCopyBufferToImage2KHR, 631 );
+        vkCmdCopyImageToBuffer2KHR.bind( m_inner.vkCmdCopyImageToBuffer2KHR, 632 );
+        vkCmdBlitImage2KHR.bind( m_inner.vkCmdBlitImage2KHR, 633 );
+        vkCmdResolveImage2KHR.bind( m_inner.vkCmdResolveImage2KHR, 634 );
+
+        //=== VK_EXT_device_fault ===
+        vkGetDeviceFaultInfoEXT.bind( m_inner.vkGetDeviceFaultInfoEXT, 635 );
+
+#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+        //=== VK_NV_acquire_winrt_display ===
+        vkAcquireWinrtDisplayNV.bind( m_inner.vkAcquireWinrtDisplayNV, 636 );
+        vkGetWinrtDisplayNV.bind( m_inner.vkGetWinrtDisplayNV, 637 );
+#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+#  if defined( VK_USE_PLATFORM_DIRECTFB_EXT )
+        //=== VK_EXT_directfb_surface ===
+        vkCreateDirectFBSurfaceEXT.bind( m_inner.vkCreateDirectFBSurfaceEXT, 638 );
+        vkGetPhysicalDeviceDirectFBPresentationSupportEXT.bind( m_inner.vkGetPhysicalDeviceDirectFBPresentationSupportEXT, 639 );
+#  endif /*VK_USE_PLATFORM_DIRECTFB_EXT*/
+
+        //=== VK_EXT_vertex_input_dynamic_state ===
+        vkCmdSetVertexInputEXT.bind( m_inner.vkCmdSetVertexInputEXT, 640 );
+
+#  if defined( VK_USE_PLATFORM_FUCHSIA )
+        //=== VK_FUCHSIA_external_memory ===
+        vkGetMemoryZirconHandleFUCHSIA.bind( m_inner.vkGetMemoryZirconHandleFUCHSIA, 641 );
+        vkGetMemoryZirconHandlePropertiesFUCHSIA.bind( m_inner.vkGetMemoryZirconHandlePropertiesFUCHSIA, 642 );
+#  endif /*VK_USE_PLATFORM_FUCHSIA*/
+
+#  if defined( VK_USE_PLATFORM_FUCHSIA )
+        //=== VK_FUCHSIA_external_semaphore ===
+        vkImportSemaphoreZirconHandleFUCHSIA.bind( m_inner.vkImportSemaphoreZirconHandleFUCHSIA, 643 );
+        vkGetSemaphoreZirconHandleFUCHSIA.bind( m_inner.vkGetSemaphoreZirconHandleFUCHSIA, 644 );
+#  endif /*VK_USE_PLATFORM_FUCHSIA*/
+
+#  if defined( VK_USE_PLATFORM_FUCHSIA )
+        //=== VK_FUCHSIA_buffer_collection ===
+        vkCreateBufferCollectionFUCHSIA.bind( m_inner.vkCreateBufferCollectionFUCHSIA, 645 );
+        vkSetBufferCollectionImageConstraintsFUCHSIA.bind( m_inner.vkSetBufferCollectionImageConstraintsFUCHSIA, 646 );
+        vkSetBufferCollectionBufferConstraintsFUCHSIA.bind( m_inner.vkSetBufferCollectionBufferConstraintsFUCHSIA, 647 );
+        vkDestroyBufferCollectionFUCHSIA.bind( m_inner.vkDestroyBufferCollectionFUCHSIA, 648 );
+        vkGetBufferCollectionPropertiesFUCHSIA.bind( m_inner.vkGetBufferCollectionPropertiesFUCHSIA, 649 );
+#  endif /*VK_USE_PLATFORM_FUCHSIA*/
+
+        //=== VK_HUAWEI_subpass_shading ===
+        vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI.bind( m_inner.vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI, 650 );
+        vkCmdSubpassShadingHUAWEI.bind( m_inner.vkCmdSubpassShadingHUAWEI, 651 );
+
+        //=== VK_HUAWEI_invocation_mask ===
+        vkCmdBindInvocationMaskHUAWEI.bind( m_inner.vkCmdBindInvocationMaskHUAWEI, 652 );
+
+        //=== VK_NV_external_memory_rdma ===
+        vkGetMemoryRemoteAddressNV.bind( m_inner.vkGetMemoryRemoteAddressNV, 653 );
+
+        //=== VK_EXT_pipeline_properties ===
+        vkGetPipelinePropertiesEXT.bind( m_inner.vkGetPipelinePropertiesEXT, 654 );
+
+        //=== VK_EXT_extended_dynamic_state2 ===
+        vkCmdSetPatchControlPointsEXT.bind( m_inner.vkCmdSetPatchControlPointsEXT, 655 );
+        vkCmdSetRasterizerDiscardEnableEXT.bind( m_inner.vkCmdSetRasterizerDiscardEnableEXT, 656 );
+        vkCmdSetDepthBiasEnableEXT.bind( m_inner.vkCmdSetDepthBiasEnableEXT, 657 );
+        vkCmdSetLogicOpEXT.bind( m_inner.vkCmdSetLogicOpEXT, 658 );
+        vkCmdSetPrimitiveRestartEnableEXT.bind( m_inner.vkCmdSetPrimitiveRestartEnableEXT, 659 );
+
+#  if defined( VK_USE_PLATFORM_SCREEN_QNX )
+        //=== VK_QNX_screen_surface ===
+        vkCreateScreenSurfaceQNX.bind( m_inner.vkCreateScreenSurfaceQNX, 660 );
+        vkGetPhysicalDeviceScreenPresentationSupportQNX.bind( m_inner.vkGetPhysicalDeviceScreenPresentationSupportQNX, 661 );
+#  endif /*VK_USE_PLATFORM_SCREEN_QNX*/
+
+        //=== VK_EXT_color_write_enable ===
+        vkCmdSetColorWriteEnableEXT.bind( m_inner.vkCmdSetColorWriteEnableEXT, 662 );
+
+        //=== VK_KHR_ray_tracing_maintenance1 ===
+        vkCmdTraceRaysIndirect2KHR.bind( m_inner.vkCmdTraceRaysIndirect2KHR, 663 );
+
+        //=== VK_EXT_multi_draw ===
+        vkCmdDrawMultiEXT.bind( m_inner.vkCmdDrawMultiEXT, 664 );
+        vkCmdDrawMultiIndexedEXT.bind( m_inner.vkCmdDrawMultiIndexedEXT, 665 );
+
+        //=== VK_EXT_opacity_micromap ===
+        vkCreateMicromapEXT.bind( m_inner.vkCreateMicromapEXT, 666 );
+        vkDestroyMicromapEXT.bind( m_inner.vkDestroyMicromapEXT, 667 );
+        vkCmdBuildMicromapsEXT.bind( m_inner.vkCmdBuildMicromapsEXT, 668 );
+        vkBuildMicromapsEXT.bind( m_inner.vkBuildMicromapsEXT, 669 );
+        vkCopyMicromapEXT.bind( m_inner.vkCopyMicromapEXT, 670 );
+        vkCopyMicromapToMemoryEXT.bind( m_inner.vkCopyMicromapToMemoryEXT, 671 );
+        vkCopyMemoryToMicromapEXT.bind( m_inner.vkCopyMemoryToMicromapEXT, 672 );
+        vkWriteMicromapsPropertiesEXT.bind( m_inner.vkWriteMicromapsPropertiesEXT, 673 );
+        vkCmdCopyMicromapEXT.bind( m_inner.vkCmdCopyMicromapEXT, 674 );
+        vkCmdCopyMicromapToMemoryEXT.bind( m_inner.vkCmdCopyMicromapToMemoryEXT, 675 );
+        vkCmdCopyMemoryToMicromapEXT.bind( m_inner.vkCmdCopyMemoryToMicromapEXT, 676 );
+        vkCmdWriteMicromapsPropertiesEXT.bind( m_inner.vkCmdWriteMicromapsPropertiesEXT, 677 );
+        vkGetDeviceMicromapCompatibilityEXT.bind( m_inner.vkGetDeviceMicromapCompatibilityEXT, 678 );
+        vkGetMicromapBuildSizesEXT.bind( m_inner.vkGetMicromapBuildSizesEXT, 679 );
+
+        //=== VK_HUAWEI_cluster_culling_shader ===
+        vkCmdDrawClusterHUAWEI.bind( m_inner.vkCmdDrawClusterHUAWEI, 680 );
+        vkCmdDrawClusterIndirectHUAWEI.bind( m_inner.vkCmdDrawClusterIndirectHUAWEI, 681 );
+
+        //=== VK_EXT_pageable_device_local_memory ===
+        vkSetDeviceMemoryPriorityEXT.bind( m_inner.vkSetDeviceMemoryPriorityEXT, 682 );
+
+        //=== VK_KHR_maintenance4 ===
+        vkGetDeviceBufferMemoryRequirementsKHR.bind( m_inner.vkGetDeviceBufferMemoryRequirementsKHR, 683 );
+        vkGetDeviceImageMemoryRequirementsKHR.bind( m_inner.vkGetDeviceImageMemoryRequirementsKHR, 684 );
+        vkGetDeviceImageSparseMemoryRequirementsKHR.bind( m_inner.vkGetDeviceImageSparseMemoryRequirementsKHR, 685 );
+
+        //=== VK_ARM_scheduling_controls ===
+        vkCmdSetDispatchParametersARM.bind( m_inner.vkCmdSetDispatchParametersARM, 686 );
+
+        //=== VK_VALVE_descriptor_set_host_mapping ===
+        vkGetDescriptorSetLayoutHostMappingInfoVALVE.bind( m_inner.vkGetDescriptorSetLayoutHostMappingInfoVALVE, 687 );
+        vkGetDescriptorSetHostMappingVALVE.bind( m_inner.vkGetDescriptorSetHostMappingVALVE, 688 );
+
+        //=== VK_NV_copy_memory_indirect ===
+        vkCmdCopyMemoryIndirectNV.bind( m_inner.vkCmdCopyMemoryIndirectNV, 689 );
+        vkCmdCopyMemoryToImageIndirectNV.bind( m_inner.vkCmdCopyMemoryToImageIndirectNV, 690 );
+
+        //=== VK_NV_memory_decompression ===
+        vkCmdDecompressMemoryNV.bind( m_inner.vkCmdDecompressMemoryNV, 691 );
+        vkCmdDecompressMemoryIndirectCountNV.bind( m_inner.vkCmdDecompressMemoryIndirectCountNV, 692 );
+
+        //=== VK_NV_device_generated_commands_compute ===
+        vkGetPipelineIndirectMemoryRequirementsNV.bind( m_inner.vkGetPipelineIndirectMemoryRequirementsNV, 693 );
+        vkCmdUpdatePipelineIndirectBufferNV.bind( m_inner.vkCmdUpdatePipelineIndirectBufferNV, 694 );
+        vkGetPipelineIndirectDeviceAddressNV.bind( m_inner.vkGetPipelineIndirectDeviceAddressNV, 695 );
+
+#  if defined( VK_USE_PLATFORM_OHOS )
+        //=== VK_OHOS_external_memory ===
+        vkGetNativeBufferPropertiesOHOS.bind( m_inner.vkGetNativeBufferPropertiesOHOS, 696 );
+        vkGetMemoryNativeBufferOHOS.bind( m_inner.vkGetMemoryNativeBufferOHOS, 697 );
+#  endif /*VK_USE_PLATFORM_OHOS*/
+
+        //=== VK_EXT_extended_dynamic_state3 ===
+        vkCmdSetDepthClampEnableEXT.bind( m_inner.vkCmdSetDepthClampEnableEXT, 698 );
+        vkCmdSetPolygonModeEXT.bind( m_inner.vkCmdSetPolygonModeEXT, 699 );
+        vkCmdSetRasterizationSamplesEXT.bind( m_inner.vkCmdSetRasterizationSamplesEXT, 700 );
+        vkCmdSetSampleMaskEXT.bind( m_inner.vkCmdSetSampleMaskEXT, 701 );
+        vkCmdSetAlphaToCoverageEnableEXT.bind( m_inner.vkCmdSetAlphaToCoverageEnableEXT, 702 );
+        vkCmdSetAlphaToOneEnableEXT.bind( m_inner.vkCmdSetAlphaToOneEnableEXT, 703 );
+        vkCmdSetLogicOpEnableEXT.bind( m_inner.vkCmdSetLogicOpEnableEXT, 704 );
+        vkCmdSetColorBlendEnableEXT.bind( m_inner.vkCmdSetColorBlendEnableEXT, 705 );
+        vkCmdSetColorBlendEquationEXT.bind( m_inner.vkCmdSetColorBlendEquationEXT, 706 );
+        vkCmdSetColorWriteMaskEXT.bind( m_inner.vkCmdSetColorWriteMaskEXT, 707 );
+        vkCmdSetTessellationDomainOriginEXT.bind( m_inner.vkCmdSetTessellationDomainOriginEXT, 708 );
+        vkCmdSetRasterizationStreamEXT.bind( m_inner.vkCmdSetRasterizationStreamEXT, 709 );
+        vkCmdSetConservativeRasterizationModeEXT.bind( m_inner.vkCmdSetConservativeRasterizationModeEXT, 710 );
+        vkCmdSetExtraPrimitiveOverestimationSizeEXT.bind( m_inner.vkCmdSetExtraPrimitiveOverestimationSizeEXT, 711 );
+        vkCmdSetDepthClipEnableEXT.bind( m_inner.vkCmdSetDepthClipEnableEXT, 712 );
+        vkCmdSetSampleLocationsEnableEXT.bind( m_inner.vkCmdSetSampleLocationsEnableEXT, 713 );
+        vkCmdSetColorBlendAdvancedEXT.bind( m_inner.vkCmdSetColorBlendAdvancedEXT, 714 );
+        vkCmdSetProvokingVertexModeEXT.bind( m_inner.vkCmdSetProvokingVertexModeEXT, 715 );
+        vkCmdSetLineRasterizationModeEXT.bind( m_inner.vkCmdSetLineRasterizationModeEXT, 716 );
+        vkCmdSetLineStippleEnableEXT.bind( m_inner.vkCmdSetLineStippleEnableEXT, 717 );
+        vkCmdSetDepthClipNegativeOneToOneEXT.bind( m_inner.vkCmdSetDepthClipNegativeOneToOneEXT, 718 );
+        vkCmdSetViewportWScalingEnableNV.bind( m_inner.vkCmdSetViewportWScalingEnableNV, 719 );
+        vkCmdSetViewportSwizzleNV.bind( m_inner.vkCmdSetViewportSwizzleNV, 720 );
+        vkCmdSetCoverageToColorEnableNV.bind( m_inner.vkCmdSetCoverageToColorEnableNV, 721 );
+        vkCmdSetCoverageToColorLocationNV.bind( m_inner.vkCmdSetCoverageToColorLocationNV, 722 );
+        vkCmdSetCoverageModulationModeNV.bind( m_inner.vkCmdSetCoverageModulationModeNV, 723 );
+        vkCmdSetCoverageModulationTableEnableNV.bind( m_inner.vkCmdSetCoverageModulationTableEnableNV, 724 );
+        vkCmdSetCoverageModulationTableNV.bind( m_inner.vkCmdSetCoverageModulationTableNV, 725 );
+        vkCmdSetShadingRateImageEnableNV.bind( m_inner.vkCmdSetShadingRateImageEnableNV, 726 );
+        vkCmdSetRepresentativeFragmentTestEnableNV.bind( m_inner.vkCmdSetRepresentativeFragmentTestEnableNV, 727 );
+        vkCmdSetCoverageReductionModeNV.bind( m_inner.vkCmdSetCoverageReductionModeNV, 728 );
+
+        //=== VK_ARM_tensors ===
+        vkCreateTensorARM.bind( m_inner.vkCreateTensorARM, 729 );
+        vkDestroyTensorARM.bind( m_inner.vkDestroyTensorARM, 730 );
+        vkCreateTensorViewARM.bind( m_inner.vkCreateTensorViewARM, 731 );
+        vkDestroyTensorViewARM.bind( m_inner.vkDestroyTensorViewARM, 732 );
+        vkGetTensorMemoryRequirementsARM.bind( m_inner.vkGetTensorMemoryRequirementsARM, 733 );
+        vkBindTensorMemoryARM.bind( m_inner.vkBindTensorMemoryARM, 734 );
+        vkGetDeviceTensorMemoryRequirementsARM.bind( m_inner.vkGetDeviceTensorMemoryRequirementsARM, 735 );
+        vkCmdCopyTensorARM.bind( m_inner.vkCmdCopyTensorARM, 736 );
+        vkGetPhysicalDeviceExternalTensorPropertiesARM.bind( m_inner.vkGetPhysicalDeviceExternalTensorPropertiesARM, 737 );
+        vkGetTensorOpaqueCaptureDescriptorDataARM.bind( m_inner.vkGetTensorOpaqueCaptureDescriptorDataARM, 738 );
+        vkGetTensorViewOpaqueCaptureDescriptorDataARM.bind( m_inner.vkGetTensorViewOpaqueCaptureDescriptorDataARM, 739 );
+
+        //=== VK_EXT_shader_module_identifier ===
+        vkGetShaderModuleIdentifierEXT.bind( m_inner.vkGetShaderModuleIdentifierEXT, 740 );
+        vkGetShaderModuleCreateInfoIdentifierEXT.bind( m_inner.vkGetShaderModuleCreateInfoIdentifierEXT, 741 );
+
+        //=== VK_NV_optical_flow ===
+        vkGetPhysicalDeviceOpticalFlowImageFormatsNV.bind( m_inner.vkGetPhysicalDeviceOpticalFlowImageFormatsNV, 742 );
+        vkCreateOpticalFlowSessionNV.bind( m_inner.vkCreateOpticalFlowSessionNV, 743 );
+        vkDestroyOpticalFlowSessionNV.bind( m_inner.vkDestroyOpticalFlowSessionNV, 744 );
+        vkBindOpticalFlowSessionImageNV.bind( m_inner.vkBindOpticalFlowSessionImageNV, 745 );
+        vkCmdOpticalFlowExecuteNV.bind( m_inner.vkCmdOpticalFlowExecuteNV, 746 );
+
+        //=== VK_KHR_maintenance5 ===
+        vkCmdBindIndexBuffer2KHR.bind( m_inner.vkCmdBindIndexBuffer2KHR, 747 );
+        vkGetRenderingAreaGranularityKHR.bind( m_inner.vkGetRenderingAreaGranularityKHR, 748 );
+        vkGetDeviceImageSubresourceLayoutKHR.bind( m_inner.vkGetDeviceImageSubresourceLayoutKHR, 749 );
+        vkGetImageSubresourceLayout2KHR.bind( m_inner.vkGetImageSubresourceLayout2KHR, 750 );
+
+        //=== VK_AMD_anti_lag ===
+        vkAntiLagUpdateAMD.bind( m_inner.vkAntiLagUpdateAMD, 751 );
+
+        //=== VK_KHR_present_wait2 ===
+        vkWaitForPresent2KHR.bind( m_inner.vkWaitForPresent2KHR, 752 );
+
+        //=== VK_EXT_shader_object ===
+        vkCreateShadersEXT.bind( m_inner.vkCreateShadersEXT, 753 );
+        vkDestroyShaderEXT.bind( m_inner.vkDestroyShaderEXT, 754 );
+        vkGetShaderBinaryDataEXT.bind( m_inner.vkGetShaderBinaryDataEXT, 755 );
+        vkCmdBindShadersEXT.bind( m_inner.vkCmdBindShadersEXT, 756 );
+        vkCmdSetDepthClampRangeEXT.bind( m_inner.vkCmdSetDepthClampRangeEXT, 757 );
+
+        //=== VK_KHR_pipeline_binary ===
+        vkCreatePipelineBinariesKHR.bind( m_inner.vkCreatePipelineBinariesKHR, 758 );
+        vkDestroyPipelineBinaryKHR.bind( m_inner.vkDestroyPipelineBinaryKHR, 759 );
+        vkGetPipelineKeyKHR.bind( m_inner.vkGetPipelineKeyKHR, 760 );
+        vkGetPipelineBinaryDataKHR.bind( m_inner.vkGetPipelineBinaryDataKHR, 761 );
+        vkReleaseCapturedPipelineDataKHR.bind( m_inner.vkReleaseCapturedPipelineDataKHR, 762 );
+
+        //=== VK_QCOM_tile_properties ===
+        vkGetFramebufferTilePropertiesQCOM.bind( m_inner.vkGetFramebufferTilePropertiesQCOM, 763 );
+        vkGetDynamicRenderingTilePropertiesQCOM.bind( m_inner.vkGetDynamicRenderingTilePropertiesQCOM, 764 );
+
+        //=== VK_KHR_swapchain_maintenance1 ===
+        vkReleaseSwapchainImagesKHR.bind( m_inner.vkReleaseSwapchainImagesKHR, 765 );
+
+        //=== VK_NV_cooperative_vector ===
+        vkGetPhysicalDeviceCooperativeVectorPropertiesNV.bind( m_inner.vkGetPhysicalDeviceCooperativeVectorPropertiesNV, 766 );
+        vkConvertCooperativeVectorMatrixNV.bind( m_inner.vkConvertCooperativeVectorMatrixNV, 767 );
+        vkCmdConvertCooperativeVectorMatrixNV.bind( m_inner.vkCmdConvertCooperativeVectorMatrixNV, 768 );
+
+        //=== VK_NV_low_latency2 ===
+        vkSetLatencySleepModeNV.bind( m_inner.vkSetLatencySleepModeNV, 769 );
+        vkLatencySleepNV.bind( m_inner.vkLatencySleepNV, 770 );
+        vkSetLatencyMarkerNV.bind( m_inner.vkSetLatencyMarkerNV, 771 );
+        vkGetLatencyTimingsNV.bind( m_inner.vkGetLatencyTimingsNV, 772 );
+        vkQueueNotifyOutOfBandNV.bind( m_inner.vkQueueNotifyOutOfBandNV, 773 );
+
+        //=== VK_KHR_cooperative_matrix ===
+        vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR.bind( m_inner.vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR, 774 );
+
+        //=== VK_ARM_data_graph ===
+        vkCreateDataGraphPipelinesARM.bind( m_inner.vkCreateDataGraphPipelinesARM, 775 );
+        vkCreateDataGraphPipelineSessionARM.bind( m_inner.vkCreateDataGraphPipelineSessionARM, 776 );
+        vkGetDataGraphPipelineSessionBindPointRequirementsARM.bind( m_inner.vkGetDataGraphPipelineSessionBindPointRequirementsARM, 777 );
+        vkGetDataGraphPipelineSessionMemoryRequirementsARM.bind( m_inner.vkGetDataGraphPipelineSessionMemoryRequirementsARM, 778 );
+        vkBindDataGraphPipelineSessionMemoryARM.bind( m_inner.vkBindDataGraphPipelineSessionMemoryARM, 779 );
+        vkDestroyDataGraphPipelineSessionARM.bind( m_inner.vkDestroyDataGraphPipelineSessionARM, 780 );
+        vkCmdDispatchDataGraphARM.bind( m_inner.vkCmdDispatchDataGraphARM, 781 );
+        vkGetDataGraphPipelineAvailablePropertiesARM.bind( m_inner.vkGetDataGraphPipelineAvailablePropertiesARM, 782 );
+        vkGetDataGraphPipelinePropertiesARM.bind( m_inner.vkGetDataGraphPipelinePropertiesARM, 783 );
+        vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM.bind( m_inner.vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM, 784 );
+        vkGetPhysicalDeviceQueueFamilyDataGraphProcessingEnginePropertiesARM.bind( m_inner.vkGetPhysicalDeviceQueueFamilyDataGraphProcessingEnginePropertiesARM, 785 );
+
+        //=== VK_ARM_data_graph_instruction_set_tosa ===
+        vkGetPhysicalDeviceQueueFamilyDataGraphEngineOperationPropertiesARM.bind( m_inner.vkGetPhysicalDeviceQueueFamilyDataGraphEngineOperationPropertiesARM, 786 );
+
+        //=== VK_EXT_attachment_feedback_loop_dynamic_state ===
+        vkCmdSetAttachmentFeedbackLoopEnableEXT.bind( m_inner.vkCmdSetAttachmentFeedbackLoopEnableEXT, 787 );
+
+#  if defined( VK_USE_PLATFORM_SCREEN_QNX )
+        //=== VK_QNX_external_memory_screen_buffer ===
+        vkGetScreenBufferPropertiesQNX.bind( m_inner.vkGetScreenBufferPropertiesQNX, 788 );
+#  endif /*VK_USE_PLATFORM_SCREEN_QNX*/
+
+        //=== VK_KHR_line_rasterization ===
+        vkCmdSetLineStippleKHR.bind( m_inner.vkCmdSetLineStippleKHR, 789 );
+
+        //=== VK_KHR_calibrated_timestamps ===
+        vkGetPhysicalDeviceCalibrateableTimeDomainsKHR.bind( m_inner.vkGetPhysicalDeviceCalibrateableTimeDomainsKHR, 790 );
+        vkGetCalibratedTimestampsKHR.bind( m_inner.vkGetCalibratedTimestampsKHR, 791 );
+
+        //=== VK_KHR_maintenance6 ===
+        vkCmdBindDescriptorSets2KHR.bind( m_inner.vkCmdBindDescriptorSets2KHR, 792 );
+        vkCmdPushConstants2KHR.bind( m_inner.vkCmdPushConstants2KHR, 793 );
+        vkCmdPushDescriptorSet2KHR.bind( m_inner.vkCmdPushDescriptorSet2KHR, 794 );
+        vkCmdPushDescriptorSetWithTemplate2KHR.bind( m_inner.vkCmdPushDescriptorSetWithTemplate2KHR, 795 );
+        vkCmdSetDescriptorBufferOffsets2EXT.bind( m_inner.vkCmdSetDescriptorBufferOffsets2EXT, 796 );
+        vkCmdBindDescriptorBufferEmbeddedSamplers2EXT.bind( m_inner.vkCmdBindDescriptorBufferEmbeddedSamplers2EXT, 797 );
+
+        //=== VK_QCOM_tile_memory_heap ===
+        vkCmdBindTileMemoryQCOM.bind( m_inner.vkCmdBindTileMemoryQCOM, 798 );
+
+        //=== VK_KHR_copy_memory_indirect ===
+        vkCmdCopyMemoryIndirectKHR.bind( m_inner.vkCmdCopyMemoryIndirectKHR, 799 );
+        vkCmdCopyMemoryToImageIndirectKHR.bind( m_inner.vkCmdCopyMemoryToImageIndirectKHR, 800 );
+
+        //=== VK_EXT_memory_decompression ===
+        vkCmdDecompressMemoryEXT.bind( m_inner.vkCmdDecompressMemoryEXT, 801 );
+        vkCmdDecompressMemoryIndirectCountEXT.bind( m_inner.vkCmdDecompressMemoryIndirectCountEXT, 802 );
+
+        //=== VK_NV_external_compute_queue ===
+        vkCreateExternalComputeQueueNV.bind( m_inner.vkCreateExternalComputeQueueNV, 803 );
+        vkDestroyExternalComputeQueueNV.bind( m_inner.vkDestroyExternalComputeQueueNV, 804 );
+        vkGetExternalComputeQueueDataNV.bind( m_inner.vkGetExternalComputeQueueDataNV, 805 );
+
+        //=== VK_NV_cluster_acceleration_structure ===
+        vkGetClusterAccelerationStructureBuildSizesNV.bind( m_inner.vkGetClusterAccelerationStructureBuildSizesNV, 806 );
+        vkCmdBuildClusterAccelerationStructureIndirectNV.bind( m_inner.vkCmdBuildClusterAccelerationStructureIndirectNV, 807 );
+
+        //=== VK_NV_partitioned_acceleration_structure ===
+        vkGetPartitionedAccelerationStructuresBuildSizesNV.bind( m_inner.vkGetPartitionedAccelerationStructuresBuildSizesNV, 808 );
+        vkCmdBuildPartitionedAccelerationStructuresNV.bind( m_inner.vkCmdBuildPartitionedAccelerationStructuresNV, 809 );
+
+        //=== VK_EXT_device_generated_commands ===
+        vkGetGeneratedCommandsMemoryRequirementsEXT.bind( m_inner.vkGetGeneratedCommandsMemoryRequirementsEXT, 810 );
+        vkCmdPreprocessGeneratedCommandsEXT.bind( m_inner.vkCmdPreprocessGeneratedCommandsEXT, 811 );
+        vkCmdExecuteGeneratedCommandsEXT.bind( m_inner.vkCmdExecuteGeneratedCommandsEXT, 812 );
+        vkCreateIndirectCommandsLayoutEXT.bind( m_inner.vkCreateIndirectCommandsLayoutEXT, 813 );
+        vkDestroyIndirectCommandsLayoutEXT.bind( m_inner.vkDestroyIndirectCommandsLayoutEXT, 814 );
+        vkCreateIndirectExecutionSetEXT.bind( m_inner.vkCreateIndirectExecutionSetEXT, 815 );
+        vkDestroyIndirectExecutionSetEXT.bind( m_inner.vkDestroyIndirectExecutionSetEXT, 816 );
+        vkUpdateIndirectExecutionSetPipelineEXT.bind( m_inner.vkUpdateIndirectExecutionSetPipelineEXT, 817 );
+        vkUpdateIndirectExecutionSetShaderEXT.bind( m_inner.vkUpdateIndirectExecutionSetShaderEXT, 818 );
+
+        //=== VK_KHR_device_fault ===
+        vkGetDeviceFaultReportsKHR.bind( m_inner.vkGetDeviceFaultReportsKHR, 819 );
+        vkGetDeviceFaultDebugInfoKHR.bind( m_inner.vkGetDeviceFaultDebugInfoKHR, 820 );
+
+#  if defined( VK_USE_PLATFORM_OHOS )
+        //=== VK_OHOS_surface ===
+        vkCreateSurfaceOHOS.bind( m_inner.vkCreateSurfaceOHOS, 821 );
+#  endif /*VK_USE_PLATFORM_OHOS*/
+
+        //=== VK_NV_cooperative_matrix2 ===
+        vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV.bind( m_inner.vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV, 822 );
+
+#  if defined( VK_USE_PLATFORM_METAL_EXT )
+        //=== VK_EXT_external_memory_metal ===
+        vkGetMemoryMetalHandleEXT.bind( m_inner.vkGetMemoryMetalHandleEXT, 823 );
+        vkGetMemoryMetalHandlePropertiesEXT.bind( m_inner.vkGetMemoryMetalHandlePropertiesEXT, 824 );
+#  endif /*VK_USE_PLATFORM_METAL_EXT*/
+
+        //=== VK_ARM_performance_counters_by_region ===
+        vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM.bind( m_inner.vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM, 825 );
+
+        //=== VK_ARM_shader_instrumentation ===
+        vkEnumeratePhysicalDeviceShaderInstrumentationMetricsARM.bind( m_inner.vkEnumeratePhysicalDeviceShaderInstrumentationMetricsARM, 826 );
+        vkCreateShaderInstrumentationARM.bind( m_inner.vkCreateShaderInstrumentationARM, 827 );
+        vkDestroyShaderInstrumentationARM.bind( m_inner.vkDestroyShaderInstrumentationARM, 828 );
+        vkCmdBeginShaderInstrumentationARM.bind( m_inner.vkCmdBeginShaderInstrumentationARM, 829 );
+        vkCmdEndShaderInstrumentationARM.bind( m_inner.vkCmdEndShaderInstrumentationARM, 830 );
+        vkGetShaderInstrumentationValuesARM.bind( m_inner.vkGetShaderInstrumentationValuesARM, 831 );
+        vkClearShaderInstrumentationMetricsARM.bind( m_inner.vkClearShaderInstrumentationMetricsARM, 832 );
+
+        //=== VK_EXT_fragment_density_map_offset ===
+        vkCmdEndRendering2EXT.bind( m_inner.vkCmdEndRendering2EXT, 833 );
+
+        //=== VK_EXT_custom_resolve ===
+        vkCmdBeginCustomResolveEXT.bind( m_inner.vkCmdBeginCustomResolveEXT, 834 );
+
+        //=== VK_KHR_maintenance10 ===
+        vkCmdEndRendering2KHR.bind( m_inner.vkCmdEndRendering2KHR, 835 );
+
+        //=== VK_ARM_data_graph_optical_flow ===
+        vkGetPhysicalDeviceQueueFamilyDataGraphOpticalFlowImageFormatsARM.bind( m_inner.vkGetPhysicalDeviceQueueFamilyDataGraphOpticalFlowImageFormatsARM, 836 );
+
+        //=== VK_NV_compute_occupancy_priority ===
+        vkCmdSetComputeOccupancyPriorityNV.bind( m_inner.vkCmdSetComputeOccupancyPriorityNV, 837 );
+
+        //=== VK_EXT_cooperative_matrix_maintenance1 ===
+        vkGetPhysicalDeviceCooperativeMatrixProperties2EXT.bind( m_inner.vkGetPhysicalDeviceCooperativeMatrixProperties2EXT, 838 );
+
+#  if defined( VK_USE_PLATFORM_UBM_SEC )
+        //=== VK_SEC_ubm_surface ===
+        vkCreateUbmSurfaceSEC.bind( m_inner.vkCreateUbmSurfaceSEC, 839 );
+        vkGetPhysicalDeviceUbmPresentationSupportSEC.bind( m_inner.vkGetPhysicalDeviceUbmPresentationSupportSEC, 840 );
+#  endif /*VK_USE_PLATFORM_UBM_SEC*/
+
+        //=== VK_EXT_primitive_restart_index ===
+        vkCmdSetPrimitiveRestartIndexEXT.bind( m_inner.vkCmdSetPrimitiveRestartIndexEXT, 841 );
+      }
+
+    private:
+      Inner m_inner;
+    };
+#endif
 #if defined( VULKAN_HPP_CXX_MODULE ) && !defined( VULKAN_HPP_DEFAULT_DISPATCHER_HANDLED ) && VULKAN_HPP_DISPATCH_LOADER_DYNAMIC == 1
     VULKAN_HPP_STORAGE_API DispatchLoaderDynamic defaultDispatchLoaderDynamic;
 #endif
@@ -8,6 +8,9 @@
 #define VULKAN_EXTENSION_INSPECTION_HPP
 
 #if !defined( VULKAN_HPP_CXX_MODULE )
+#  include <algorithm>
+#  include <array>
+#  include <cstring>
 #  include <map>
 #  include <set>
 #  include <string>
@@ -23,6 +26,587 @@
 
 VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 {
+  //===========================
+  //=== Extension ids, sets ===
+  //===========================
+
+  // dense ids of the extensions; eUnknown is the id of any unknown extension and the number of known extensions
+  enum class ExtensionId : uint16_t
+  {
+    eKHRSurface,
+    eKHRSwapchain,
+    eKHRDisplay,
+    eKHRDisplaySwapchain,
+    eKHRXlibSurface,
+    eKHRXcbSurface,
+    eKHRWaylandSurface,
+    eKHRAndroidSurface,
+    eKHRWin32Surface,
+    eEXTDebugReport,
+    eNVGlslShader,
+    eEXTDepthRangeUnrestricted,
+    eKHRSamplerMirrorClampToEdge,
+    eIMGFilterCubic,
+    eAMDRasterizationOrder,
+    eAMDShaderTrinaryMinmax,
+    eAMDShaderExplicitVertexParameter,
+    eEXTDebugMarker,
+    eKHRVideoQueue,
+    eKHRVideoDecodeQueue,
+    eAMDGcnShader,
+    eNVDedicatedAllocation,
+    eEXTTransformFeedback,
+    eNVXBinaryImport,
+    eNVXImageViewHandle,
+    eAMDDrawIndirectCount,
+    eAMDNegativeViewportHeight,
+    eAMDGpuShaderHalfFloat,
+    eAMDShaderBallot,
+    eKHRVideoEncodeH264,
+    eKHRVideoEncodeH265,
+    eKHRVideoDecodeH264,
+    eAMDTextureGatherBiasLod,
+    eAMDShaderInfo,
+    eKHRDynamicRendering,
+    eAMDShaderImageLoadStoreLod,
+    eGGPStreamDescriptorSurface,
+    eNVCornerSampledImage,
+    eKHRMultiview,
+    eIMGFormatPvrtc,
+    eNVExternalMemoryCapabilities,
+    eNVExternalMemory,
+    eNVExternalMemoryWin32,
+    eNVWin32KeyedMutex,
+    eKHRGetPhysicalDeviceProperties2,
+    eKHRDeviceGroup,
+    eEXTValidationFlags,
+    eNNViSurface,
+    eKHRShaderDrawParameters,
+    eEXTShaderSubgroupBallot,
+    eEXTShaderSubgroupVote,
+    eEXTTextureCompressionAstcHdr,
+    eEXTAstcDecodeMode,
+    eEXTPipelineRobustness,
+    eKHRMaintenance1,
+    eKHRDeviceGroupCreation,
+    eKHRExternalMemoryCapabilities,
+    eKHRExternalMemory,
+    eKHRExternalMemoryWin32,
+    eKHRExternalMemoryFd,
+    eKHRWin32KeyedMutex,
+    eKHRExternalSemaphoreCapabilities,
+    eKHRExternalSemaphore,
+    eKHRExternalSemaphoreWin32,
+    eKHRExternalSemaphoreFd,
+    eKHRPushDescriptor,
+    eEXTConditionalRendering,
+    eKHRShaderFloat16Int8,
+    eKHR16BitStorage,
+    eKHRIncrementalPresent,
+    eKHRDescriptorUpdateTemplate,
+    eNVClipSpaceWScaling,
+    eEXTDirectModeDisplay,
+    eEXTAcquireXlibDisplay,
+    eEXTDisplaySurfaceCounter,
+    eEXTDisplayControl,
+    eGOOGLEDisplayTiming,
+    eNVSampleMaskOverrideCoverage,
+    eNVGeometryShaderPassthrough,
+    eNVViewportArray2,
+    eNVXMultiviewPerViewAttributes,
+    eNVViewportSwizzle,
+    eEXTDiscardRectangles,
+    eEXTConservativeRasterization,
+    eEXTDepthClipEnable,
+    eEXTSwapchainColorspace,
+    eEXTHdrMetadata,
+    eKHRImagelessFramebuffer,
+    eKHRCreateRenderpass2,
+    eIMGRelaxedLineRasterization,
+    eKHRSharedPresentableImage,
+    eKHRExternalFenceCapabilities,
+    eKHRExternalFence,
+    eKHRExternalFenceWin32,
+    eKHRExternalFenceFd,
+    eKHRPerformanceQuery,
+    eKHRMaintenance2,
+    eKHRGetSurfaceCapabilities2,
+    eKHRVariablePointers,
+    eKHRGetDisplayProperties2,
+    eMVKIosSurface,
+    eMVKMacosSurface,
+    eEXTExternalMemoryDmaBuf,
+    eEXTQueueFamilyForeign,
+    eKHRDedicatedAllocation,
+    eEXTDebugUtils,
+    eANDROIDExternalMemoryAndroidHardwareBuffer,
+    eEXTSamplerFilterMinmax,
+    eKHRStorageBufferStorageClass,
+    eAMDGpuShaderInt16,
+    eAMDGpaInterface,
+    eAMDXShaderEnqueue,
+    eEXTDescriptorHeap,
+    eAMDMixedAttachmentSamples,
+    eAMDShaderFragmentMask,
+    eEXTInlineUniformBlock,
+    eEXTShaderStencilExport,
+    eKHRShaderBfloat16,
+    eEXTSampleLocations,
+    eKHRRelaxedBlockLayout,
+    eKHRGetMemoryRequirements2,
+    eKHRImageFormatList,
+    eEXTBlendOperationAdvanced,
+    eNVFragmentCoverageToColor,
+    eKHRAccelerationStructure,
+    eKHRRayTracingPipeline,
+    eKHRRayQuery,
+    eNVFramebufferMixedSamples,
+    eNVFillRectangle,
+    eNVShaderSmBuiltins,
+    eEXTPostDepthCoverage,
+    eKHRSamplerYcbcrConversion,
+    eKHRBindMemory2,
+    eEXTImageDrmFormatModifier,
+    eEXTValidationCache,
+    eEXTDescriptorIndexing,
+    eEXTShaderViewportIndexLayer,
+    eKHRPortabilitySubset,
+    eNVShadingRateImage,
+    eNVRayTracing,
+    eNVRepresentativeFragmentTest,
+    eKHRMaintenance3,
+    eKHRDrawIndirectCount,
+    eEXTFilterCubic,
+    eQCOMRenderPassShaderResolve,
+    eQCOMCooperativeMatrixConversion,
+    eQCOMElapsedTimerQuery,
+    eEXTGlobalPriority,
+    eKHRShaderSubgroupExtendedTypes,
+    eKHR8BitStorage,
+    eEXTExternalMemoryHost,
+    eAMDBufferMarker,
+    eKHRShaderAtomicInt64,
+    eKHRShaderClock,
+    eAMDPipelineCompilerControl,
+    eEXTCalibratedTimestamps,
+    eAMDShaderCoreProperties,
+    eKHRVideoDecodeH265,
+    eKHRGlobalPriority,
+    eAMDMemoryOverallocationBehavior,
+    eEXTVertexAttributeDivisor,
+    eGGPFrameToken,
+    eEXTPipelineCreationFeedback,
+    eKHRDriverProperties,
+    eKHRShaderFloatControls,
+    eNVShaderSubgroupPartitioned,
+    eKHRDepthStencilResolve,
+    eKHRSwapchainMutableFormat,
+    eNVComputeShaderDerivatives,
+    eNVMeshShader,
+    eNVFragmentShaderBarycentric,
+    eNVShaderImageFootprint,
+    eNVScissorExclusive,
+    eNVDeviceDiagnosticCheckpoints,
+    eKHRTimelineSemaphore,
+    eEXTPresentTiming,
+    eINTELShaderIntegerFunctions2,
+    eINTELPerformanceQuery,
+    eKHRVulkanMemoryModel,
+    eEXTPciBusInfo,
+    eAMDDisplayNativeHdr,
+    eFUCHSIAImagepipeSurface,
+    eKHRShaderTerminateInvocation,
+    eEXTMetalSurface,
+    eEXTFragmentDensityMap,
+    eEXTScalarBlockLayout,
+    eGOOGLEHlslFunctionality1,
+    eGOOGLEDecorateString,
+    eEXTSubgroupSizeControl,
+    eKHRFragmentShadingRate,
+    eAMDShaderCoreProperties2,
+    eAMDDeviceCoherentMemory,
+    eKHRShaderConstantData,
+    eKHRDynamicRenderingLocalRead,
+    eKHRShaderAbort,
+    eEXTShaderImageAtomicInt64,
+    eKHRShaderQuadControl,
+    eKHRSpirv14,
+    eEXTMemoryBudget,
+    eEXTMemoryPriority,
+    eKHRSurfaceProtectedCapabilities,
+    eNVDedicatedAllocationImageAliasing,
+    eKHRSeparateDepthStencilLayouts,
+    eEXTBufferDeviceAddress,
+    eEXTToolingInfo,
+    eEXTSeparateStencilUsage,
+    eEXTValidationFeatures,
+    eKHRPresentWait,
+    eNVCooperativeMatrix,
+    eNVCoverageReductionMode,
+    eEXTFragmentShaderInterlock,
+    eEXTYcbcrImageArrays,
+    eKHRUniformBufferStandardLayout,
+    eEXTProvokingVertex,
+    eEXTFullScreenExclusive,
+    eEXTHeadlessSurface,
+    eKHRBufferDeviceAddress,
+    eEXTLineRasterization,
+    eEXTShaderAtomicFloat,
+    eEXTHostQueryReset,
+    eEXTIndexTypeUint8,
+    eEXTExtendedDynamicState,
+    eKHRDeferredHostOperations,
+    eKHRPipelineExecutableProperties,
+    eEXTHostImageCopy,
+    eKHRMapMemory2,
+    eEXTMapMemoryPlaced,
+    eEXTShaderAtomicFloat2,
+    eEXTSurfaceMaintenance1,
+    eEXTSwapchainMaintenance1,
+    eEXTShaderDemoteToHelperInvocation,
+    eNVDeviceGeneratedCommands,
+    eNVInheritedViewportScissor,
+    eKHRShaderIntegerDotProduct,
+    eEXTTexelBufferAlignment,
+    eQCOMRenderPassTransform,
+    eEXTDepthBiasControl,
+    eEXTDeviceMemoryReport,
+    eEXTAcquireDrmDisplay,
+    eEXTRobustness2,
+    eEXTCustomBorderColor,
+    eEXTTextureCompressionAstc3D,
+    eGOOGLEUserType,
+    eKHRPipelineLibrary,
+    eNVPresentBarrier,
+    eKHRShaderNonSemanticInfo,
+    eKHRPresentId,
+    eEXTPrivateData,
+    eEXTPipelineCreationCacheControl,
+    eKHRVideoEncodeQueue,
+    eNVDeviceDiagnosticsConfig,
+    eQCOMRenderPassStoreOps,
+    eQCOMQueuePerfHint,
+    eQCOMImageProcessing3,
+    eQCOMShaderMultipleWaitQueues,
+    eEXTShaderSplitBarrier,
+    eNVCudaKernelLaunch,
+    eQCOMTileShading,
+    eNVLowLatency,
+    eEXTMetalObjects,
+    eKHRSynchronization2,
+    eEXTDescriptorBuffer,
+    eKHRDeviceAddressCommands,
+    eEXTGraphicsPipelineLibrary,
+    eAMDShaderEarlyAndLateFragmentTests,
+    eKHRFragmentShaderBarycentric,
+    eKHRShaderSubgroupUniformControlFlow,
+    eKHRZeroInitializeWorkgroupMemory,
+    eNVFragmentShadingRateEnums,
+    eNVRayTracingMotionBlur,
+    eEXTMeshShader,
+    eEXTYcbcr2Plane444Formats,
+    eEXTFragmentDensityMap2,
+    eQCOMRotatedCopyCommands,
+    eEXTImageRobustness,
+    eKHRWorkgroupMemoryExplicitLayout,
+    eKHRCopyCommands2,
+    eEXTImageCompressionControl,
+    eEXTAttachmentFeedbackLoopLayout,
+    eEXT4444Formats,
+    eEXTDeviceFault,
+    eARMRasterizationOrderAttachmentAccess,
+    eEXTRgba10X6Formats,
+    eNVAcquireWinrtDisplay,
+    eEXTDirectfbSurface,
+    eVALVEMutableDescriptorType,
+    eEXTVertexInputDynamicState,
+    eEXTPhysicalDeviceDrm,
+    eEXTDeviceAddressBindingReport,
+    eEXTDepthClipControl,
+    eEXTPrimitiveTopologyListRestart,
+    eKHRFormatFeatureFlags2,
+    eEXTPresentModeFifoLatestReady,
+    eFUCHSIAExternalMemory,
+    eFUCHSIAExternalSemaphore,
+    eFUCHSIABufferCollection,
+    eHUAWEISubpassShading,
+    eHUAWEIInvocationMask,
+    eNVExternalMemoryRdma,
+    eEXTPipelineProperties,
+    eEXTFrameBoundary,
+    eEXTMultisampledRenderToSingleSampled,
+    eEXTExtendedDynamicState2,
+    eQNXScreenSurface,
+    eEXTColorWriteEnable,
+    eEXTPrimitivesGeneratedQuery,
+    eKHRRayTracingMaintenance1,
+    eKHRShaderUntypedPointers,
+    eEXTGlobalPriorityQuery,
+    eVALVEVideoEncodeRgbConversion,
+    eEXTImageViewMinLod,
+    eEXTMultiDraw,
+    eEXTImage2DViewOf3D,
+    eKHRPortabilityEnumeration,
+    eEXTShaderTileImage,
+    eEXTOpacityMicromap,
+    eNVDisplacementMicromap,
+    eEXTLoadStoreOpNone,
+    eHUAWEIClusterCullingShader,
+    eEXTBorderColorSwizzle,
+    eEXTPageableDeviceLocalMemory,
+    eKHRMaintenance4,
+    eARMShaderCoreProperties,
+    eKHRShaderSubgroupRotate,
+    eARMSchedulingControls,
+    eEXTImageSlicedViewOf3D,
+    eVALVEDescriptorSetHostMapping,
+    eEXTDepthClampZeroOne,
+    eEXTNonSeamlessCubeMap,
+    eARMRenderPassStriped,
+    eQCOMFragmentDensityMapOffset,
+    eNVCopyMemoryIndirect,
+    eNVMemoryDecompression,
+    eNVDeviceGeneratedCommandsCompute,
+    eNVRayTracingLinearSweptSpheres,
+    eNVLinearColorAttachment,
+    eGOOGLESurfacelessQuery,
+    eKHRShaderMaximalReconvergence,
+    eEXTImageCompressionControlSwapchain,
+    eQCOMImageProcessing,
+    eEXTNestedCommandBuffer,
+    eOHOSExternalMemory,
+    eEXTExternalMemoryAcquireUnmodified,
+    eEXTExtendedDynamicState3,
+    eEXTSubpassMergeFeedback,
+    eLUNARGDirectDriverLoading,
+    eARMTensors,
+    eEXTShaderModuleIdentifier,
+    eEXTRasterizationOrderAttachmentAccess,
+    eNVOpticalFlow,
+    eEXTLegacyDithering,
+    eEXTPipelineProtectedAccess,
+    eANDROIDExternalFormatResolve,
+    eKHRMaintenance5,
+    eAMDAntiLag,
+    eAMDXDenseGeometryFormat,
+    eKHRPresentId2,
+    eKHRPresentWait2,
+    eKHRRayTracingPositionFetch,
+    eEXTShaderObject,
+    eKHRPipelineBinary,
+    eQCOMTileProperties,
+    eSECAmigoProfiling,
+    eKHRSurfaceMaintenance1,
+    eKHRSwapchainMaintenance1,
+    eQCOMMultiviewPerViewViewports,
+    eNVRayTracingInvocationReorder,
+    eNVCooperativeVector,
+    eNVExtendedSparseAddressSpace,
+    eEXTMutableDescriptorType,
+    eEXTLegacyVertexAttributes,
+    eEXTLayerSettings,
+    eARMShaderCoreBuiltins,
+    eEXTPipelineLibraryGroupHandles,
+    eEXTDynamicRenderingUnusedAttachments,
+    eKHRInternallySynchronizedQueues,
+    eNVLowLatency2,
+    eKHRCooperativeMatrix,
+    eARMDataGraph,
+    eARMDataGraphInstructionSetTosa,
+    eQCOMMultiviewPerViewRenderAreas,
+    eKHRComputeShaderDerivatives,
+    eKHRVideoDecodeAv1,
+    eKHRVideoEncodeAv1,
+    eKHRVideoDecodeVp9,
+    eKHRVideoMaintenance1,
+    eNVPerStageDescriptorSet,
+    eQCOMImageProcessing2,
+    eQCOMFilterCubicWeights,
+    eQCOMYcbcrDegamma,
+    eQCOMFilterCubicClamp,
+    eEXTAttachmentFeedbackLoopDynamicState,
+    eKHRVertexAttributeDivisor,
+    eKHRLoadStoreOpNone,
+    eKHRUnifiedImageLayouts,
+    eKHRShaderFloatControls2,
+    eQNXExternalMemoryScreenBuffer,
+    eMSFTLayeredDriver,
+    eKHRIndexTypeUint8,
+    eKHRLineRasterization,
+    eKHRCalibratedTimestamps,
+    eKHRShaderExpectAssume,
+    eKHRMaintenance6,
+    eNVDescriptorPoolOverallocation,
+    eQCOMTileMemoryHeap,
+    eKHRCopyMemoryIndirect,
+    eEXTMemoryDecompression,
+    eNVDisplayStereo,
+    eKHRVideoEncodeIntraRefresh,
+    eKHRVideoEncodeQuantizationMap,
+    eNVRawAccessChains,
+    eNVExternalComputeQueue,
+    eKHRShaderRelaxedExtendedInstruction,
+    eNVCommandBufferInheritance,
+    eKHRMaintenance7,
+    eNVShaderAtomicFloat16Vector,
+    eEXTShaderReplicatedComposites,
+    eARMTensorControls,
+    eEXTShaderFloat8,
+    eNVRayTracingValidation,
+    eNVClusterAccelerationStructure,
+    eNVPartitionedAccelerationStructure,
+    eEXTDeviceGeneratedCommands,
+    eKHRDeviceFault,
+    eKHRMaintenance8,
+    eMESAImageAlignmentControl,
+    eKHRShaderFma,
+    eNVPushConstantBank,
+    eEXTRayTracingInvocationReorder,
+    eEXTDepthClampControl,
+    eKHRMaintenance9,
+    eKHRVideoMaintenance2,
+    eOHOSSurface,
+    eHUAWEIHdrVivid,
+    eNVCooperativeMatrix2,
+    eARMPipelineOpacityMicromap,
+    eKHRVideoEncodeFeedback2,
+    eIMGFilterLinear2D,
+    eEXTExternalMemoryMetal,
+    eKHRDepthClampZeroOne,
+    eARMPerformanceCountersByRegion,
+    eARMShaderInstrumentation,
+    eEXTVertexAttributeRobustness,
+    eARMFormatPack,
+    eVALVEFragmentDensityMapLayered,
+    eKHRRobustness2,
+    eNVPresentMetering,
+    eEXTMultisampledRenderToSwapchain,
+    eEXTFragmentDensityMapOffset,
+    eEXTZeroInitializeDeviceMemory,
+    eKHRPresentModeFifoLatestReady,
+    eKHROpacityMicromap,
+    eEXTShader64BitIndexing,
+    eEXTCustomResolve,
+    eQCOMDataGraphModel,
+    eKHRMaintenance10,
+    eARMDataGraphOpticalFlow,
+    eEXTShaderLongVector,
+    eSECPipelineCacheIncrementalMode,
+    eEXTShaderUniformBufferUnsizedArray,
+    eNVComputeOccupancyPriority,
+    eKHRMaintenance11,
+    eEXTCooperativeMatrixMaintenance1,
+    eEXTShaderSubgroupPartitioned,
+    eSECUbmSurface,
+    eKHRExtendedFlags,
+    eEXTShaderOcpMicroscalingTypes,
+    eVALVEShaderMixedFloatDotProduct,
+    eSECThrottleHint,
+    eARMDataGraphNeuralAcceleratorStatistics,
+    eEXTPrimitiveRestartIndex,
+    eEXTImageTilingControl,
+    eNVCooperativeMatrixDecodeVector,
+    eUnknown
+  };
+
+  // a bitset of extensions, indexed by their ExtensionId
+  class ExtensionSet
+  {
+  public:
+    VULKAN_HPP_CONSTEXPR_14 ExtensionSet() VULKAN_HPP_NOEXCEPT = default;
+
+#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
+    ExtensionSet( ArrayProxy<ExtensionProperties const> const & extensionProperties ) VULKAN_HPP_NOEXCEPT;
+#endif
+
+    VULKAN_HPP_CONSTEXPR_14 ExtensionSet & set( ExtensionId extension ) VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( extension < ExtensionId::eUnknown );
+      m_bits[static_cast<size_t>( extension ) / 64] |= uint64_t( 1 ) << ( static_cast<size_t>( extension ) % 64 );
+      return *this;
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 ExtensionSet & reset( ExtensionId extension ) VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( extension < ExtensionId::eUnknown );
+      m_bits[static_cast<size_t>( extension ) / 64] &= ~( uint64_t( 1 ) << ( static_cast<size_t>( extension ) % 64 ) );
+      return *this;
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 bool test( ExtensionId extension ) const VULKAN_HPP_NOEXCEPT
+    {
+      return ( extension < ExtensionId::eUnknown ) &&
+             ( m_bits[static_cast<size_t>( extension ) / 64] & ( uint64_t( 1 ) << ( static_cast<size_t>( extension ) % 64 ) ) );
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 size_t count() const VULKAN_HPP_NOEXCEPT
+    {
+      size_t count = 0;
+      for ( uint64_t bits : m_bits )
+      {
+        for ( ; bits; bits &= bits - 1 )
+        {
+          ++count;
+        }
+      }
+      return count;
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 bool isSubsetOf( ExtensionSet const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      for ( size_t i = 0; i < wordCount; ++i )
+      {
+        if ( m_bits[i] & ~rhs.m_bits[i] )
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 ExtensionSet & operator|=( ExtensionSet const & rhs ) VULKAN_HPP_NOEXCEPT
+    {
+      for ( size_t i = 0; i < wordCount; ++i )
+      {
+        m_bits[i] |= rhs.m_bits[i];
+      }
+      return *this;
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 bool operator==( ExtensionSet const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return isSubsetOf( rhs ) && rhs.isSubsetOf( *this );
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 bool operator!=( ExtensionSet const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return !operator==( rhs );
+    }
+
+    // calls f( ExtensionId ) for each extension in this set, in ascending order
+    template <typename Function>
+    void forEach( Function f ) const
+    {
+      for ( size_t i = 0; i < wordCount; ++i )
+      {
+        for ( uint64_t bits = m_bits[i]; bits; bits &= bits - 1 )
+        {
+          size_t bit = 0;
+          while ( !( bits & ( uint64_t( 1 ) << bit ) ) )
+          {
+            ++bit;
+          }
+          f( static_cast<ExtensionId>( i * 64 + bit ) );
+        }
+      }
+    }
+
+  private:
+    static VULKAN_HPP_CONST_OR_CONSTEXPR size_t wordCount = ( static_cast<size_t>( ExtensionId::eUnknown ) + 63 ) / 64;
+
+    uint64_t m_bits[wordCount] = {};
+  };
+
   //======================================
   //=== Extension inspection functions ===
   //======================================
@@ -43,6 +627,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
   VULKAN_HPP_CONSTEXPR_20 bool        isObsoletedExtension( std::string const & extension );
   VULKAN_HPP_CONSTEXPR_20 bool        isPromotedExtension( std::string const & extension );
 
+  ExtensionId  getExtensionId( char const * extension ) VULKAN_HPP_NOEXCEPT;
+  char const * getExtensionName( ExtensionId extension ) VULKAN_HPP_NOEXCEPT;
+  uint32_t     getExtensionPromotedToApiVersion( ExtensionId extension ) VULKAN_HPP_NOEXCEPT;
+  bool         resolveExtensionDependencies( ExtensionSet const & requested,
+                                             uint32_t             apiVersion,
+                                             ExtensionSet const & available,
+                                             ExtensionSet &       enabled ) VULKAN_HPP_NOEXCEPT;
+
   //=====================================================
   //=== Extension inspection function implementations ===
   //=====================================================
@@ -4433,6 +5025,1951 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
            ( extension == "VK_KHR_line_rasterization" ) || ( extension == "VK_KHR_shader_expect_assume" ) || ( extension == "VK_KHR_maintenance6" ) ||
            ( extension == "VK_EXT_vertex_attribute_robustness" );
   }
+
+  namespace detail
+  {
+    struct ExtensionDependency
+    {
+      ExtensionId extension;
+      uint32_t    apiVersion;   // the dependency holds from this api version on, up to the next larger apiVersion listed for the same extension
+      uint32_t    alternative;  // all dependencies of an alternative need to be enabled, any one of the alternatives is sufficient
+      ExtensionId dependency;   // ExtensionId::eUnknown for an alternative without any dependency
+    };
+
+    // sorted by extension, then grouped by apiVersion and by alternative
+    VULKAN_HPP_INLINE std::pair<ExtensionDependency const *, ExtensionDependency const *> getExtensionDependencies( ExtensionId extension )
+    {
+      static ExtensionDependency const dependencies[] = {
+        { ExtensionId::eKHRSwapchain, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eKHRDisplay, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eKHRDisplaySwapchain, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDisplay },
+        { ExtensionId::eKHRDisplaySwapchain, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eKHRXlibSurface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eKHRXcbSurface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eKHRWaylandSurface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eKHRAndroidSurface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eKHRWin32Surface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eEXTDebugMarker, VK_API_VERSION_1_0, 0, ExtensionId::eEXTDebugReport },
+        { ExtensionId::eKHRVideoQueue, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eKHRVideoQueue, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRVideoDecodeQueue, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eKHRVideoDecodeQueue, VK_API_VERSION_1_0, 0, ExtensionId::eKHRVideoQueue },
+        { ExtensionId::eKHRVideoDecodeQueue, VK_API_VERSION_1_3, 0, ExtensionId::eKHRVideoQueue },
+        { ExtensionId::eEXTTransformFeedback, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTTransformFeedback, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRVideoEncodeH264, VK_API_VERSION_1_0, 0, ExtensionId::eKHRVideoEncodeQueue },
+        { ExtensionId::eKHRVideoEncodeH265, VK_API_VERSION_1_0, 0, ExtensionId::eKHRVideoEncodeQueue },
+        { ExtensionId::eKHRVideoDecodeH264, VK_API_VERSION_1_0, 0, ExtensionId::eKHRVideoDecodeQueue },
+        { ExtensionId::eAMDTextureGatherBiasLod, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eAMDTextureGatherBiasLod, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRDynamicRendering, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDepthStencilResolve },
+        { ExtensionId::eKHRDynamicRendering, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRDynamicRendering, VK_API_VERSION_1_1, 0, ExtensionId::eKHRDepthStencilResolve },
+        { ExtensionId::eKHRDynamicRendering, VK_API_VERSION_1_2, 0, ExtensionId::eUnknown },
+        { ExtensionId::eGGPStreamDescriptorSurface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eNVCornerSampledImage, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVCornerSampledImage, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRMultiview, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRMultiview, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVExternalMemory, VK_API_VERSION_1_0, 0, ExtensionId::eNVExternalMemoryCapabilities },
+        { ExtensionId::eNVExternalMemoryWin32, VK_API_VERSION_1_0, 0, ExtensionId::eNVExternalMemory },
+        { ExtensionId::eNVWin32KeyedMutex, VK_API_VERSION_1_0, 0, ExtensionId::eNVExternalMemoryWin32 },
+        { ExtensionId::eKHRDeviceGroup, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDeviceGroupCreation },
+        { ExtensionId::eNNViSurface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eEXTTextureCompressionAstcHdr, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTTextureCompressionAstcHdr, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTAstcDecodeMode, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTAstcDecodeMode, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTPipelineRobustness, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTPipelineRobustness, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRExternalMemoryCapabilities, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRExternalMemoryCapabilities, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRExternalMemory, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalMemoryCapabilities },
+        { ExtensionId::eKHRExternalMemory, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRExternalMemoryWin32, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalMemory },
+        { ExtensionId::eKHRExternalMemoryWin32, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRExternalMemoryFd, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalMemory },
+        { ExtensionId::eKHRExternalMemoryFd, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRWin32KeyedMutex, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalMemoryWin32 },
+        { ExtensionId::eKHRExternalSemaphoreCapabilities, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRExternalSemaphoreCapabilities, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRExternalSemaphore, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalSemaphoreCapabilities },
+        { ExtensionId::eKHRExternalSemaphoreWin32, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalSemaphore },
+        { ExtensionId::eKHRExternalSemaphoreFd, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalSemaphore },
+        { ExtensionId::eKHRExternalSemaphoreFd, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRPushDescriptor, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRPushDescriptor, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTConditionalRendering, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTConditionalRendering, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRShaderFloat16Int8, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRShaderFloat16Int8, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHR16BitStorage, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHR16BitStorage, VK_API_VERSION_1_0, 0, ExtensionId::eKHRStorageBufferStorageClass },
+        { ExtensionId::eKHR16BitStorage, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRIncrementalPresent, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eEXTDirectModeDisplay, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDisplay },
+        { ExtensionId::eEXTAcquireXlibDisplay, VK_API_VERSION_1_0, 0, ExtensionId::eEXTDirectModeDisplay },
+        { ExtensionId::eEXTDisplaySurfaceCounter, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDisplay },
+        { ExtensionId::eEXTDisplayControl, VK_API_VERSION_1_0, 0, ExtensionId::eEXTDisplaySurfaceCounter },
+        { ExtensionId::eEXTDisplayControl, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eGOOGLEDisplayTiming, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eNVXMultiviewPerViewAttributes, VK_API_VERSION_1_0, 0, ExtensionId::eKHRMultiview },
+        { ExtensionId::eNVXMultiviewPerViewAttributes, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTDiscardRectangles, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTDiscardRectangles, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTConservativeRasterization, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTConservativeRasterization, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTDepthClipEnable, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTDepthClipEnable, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTSwapchainColorspace, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eEXTHdrMetadata, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eKHRImagelessFramebuffer, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRImagelessFramebuffer, VK_API_VERSION_1_0, 0, ExtensionId::eKHRImageFormatList },
+        { ExtensionId::eKHRImagelessFramebuffer, VK_API_VERSION_1_0, 0, ExtensionId::eKHRMaintenance2 },
+        { ExtensionId::eKHRImagelessFramebuffer, VK_API_VERSION_1_1, 0, ExtensionId::eKHRImageFormatList },
+        { ExtensionId::eKHRImagelessFramebuffer, VK_API_VERSION_1_2, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRCreateRenderpass2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRMaintenance2 },
+        { ExtensionId::eKHRCreateRenderpass2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRMultiview },
+        { ExtensionId::eKHRCreateRenderpass2, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eIMGRelaxedLineRasterization, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eIMGRelaxedLineRasterization, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRSharedPresentableImage, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRSharedPresentableImage, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetSurfaceCapabilities2 },
+        { ExtensionId::eKHRSharedPresentableImage, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eKHRSharedPresentableImage, VK_API_VERSION_1_1, 0, ExtensionId::eKHRGetSurfaceCapabilities2 },
+        { ExtensionId::eKHRSharedPresentableImage, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eKHRExternalFenceCapabilities, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRExternalFenceCapabilities, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRExternalFence, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalFenceCapabilities },
+        { ExtensionId::eKHRExternalFenceWin32, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalFence },
+        { ExtensionId::eKHRExternalFenceFd, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalFence },
+        { ExtensionId::eKHRExternalFenceFd, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRPerformanceQuery, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRPerformanceQuery, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRGetSurfaceCapabilities2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eKHRVariablePointers, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRVariablePointers, VK_API_VERSION_1_0, 0, ExtensionId::eKHRStorageBufferStorageClass },
+        { ExtensionId::eKHRVariablePointers, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRGetDisplayProperties2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDisplay },
+        { ExtensionId::eMVKIosSurface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eMVKMacosSurface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eEXTExternalMemoryDmaBuf, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalMemoryFd },
+        { ExtensionId::eEXTQueueFamilyForeign, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalMemory },
+        { ExtensionId::eEXTQueueFamilyForeign, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRDedicatedAllocation, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetMemoryRequirements2 },
+        { ExtensionId::eKHRDedicatedAllocation, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eANDROIDExternalMemoryAndroidHardwareBuffer, VK_API_VERSION_1_0, 0, ExtensionId::eEXTQueueFamilyForeign },
+        { ExtensionId::eANDROIDExternalMemoryAndroidHardwareBuffer, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDedicatedAllocation },
+        { ExtensionId::eANDROIDExternalMemoryAndroidHardwareBuffer, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalMemory },
+        { ExtensionId::eANDROIDExternalMemoryAndroidHardwareBuffer, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSamplerYcbcrConversion },
+        { ExtensionId::eANDROIDExternalMemoryAndroidHardwareBuffer, VK_API_VERSION_1_1, 0, ExtensionId::eEXTQueueFamilyForeign },
+        { ExtensionId::eEXTSamplerFilterMinmax, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTSamplerFilterMinmax, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eAMDGpaInterface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eAMDGpaInterface, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eAMDXShaderEnqueue, VK_API_VERSION_1_0, 0, ExtensionId::eEXTExtendedDynamicState },
+        { ExtensionId::eAMDXShaderEnqueue, VK_API_VERSION_1_0, 0, ExtensionId::eKHRMaintenance5 },
+        { ExtensionId::eAMDXShaderEnqueue, VK_API_VERSION_1_0, 0, ExtensionId::eKHRPipelineLibrary },
+        { ExtensionId::eAMDXShaderEnqueue, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSpirv14 },
+        { ExtensionId::eAMDXShaderEnqueue, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eAMDXShaderEnqueue, VK_API_VERSION_1_3, 0, ExtensionId::eKHRMaintenance5 },
+        { ExtensionId::eAMDXShaderEnqueue, VK_API_VERSION_1_3, 0, ExtensionId::eKHRPipelineLibrary },
+        { ExtensionId::eEXTDescriptorHeap, VK_API_VERSION_1_0, 0, ExtensionId::eKHRBufferDeviceAddress },
+        { ExtensionId::eEXTDescriptorHeap, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExtendedFlags },
+        { ExtensionId::eEXTDescriptorHeap, VK_API_VERSION_1_0, 1, ExtensionId::eKHRBufferDeviceAddress },
+        { ExtensionId::eEXTDescriptorHeap, VK_API_VERSION_1_0, 1, ExtensionId::eKHRMaintenance5 },
+        { ExtensionId::eEXTDescriptorHeap, VK_API_VERSION_1_2, 0, ExtensionId::eKHRExtendedFlags },
+        { ExtensionId::eEXTDescriptorHeap, VK_API_VERSION_1_2, 1, ExtensionId::eKHRMaintenance5 },
+        { ExtensionId::eEXTDescriptorHeap, VK_API_VERSION_1_4, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTInlineUniformBlock, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTInlineUniformBlock, VK_API_VERSION_1_0, 0, ExtensionId::eKHRMaintenance1 },
+        { ExtensionId::eEXTInlineUniformBlock, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRShaderBfloat16, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRShaderBfloat16, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTSampleLocations, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTSampleLocations, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTBlendOperationAdvanced, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTBlendOperationAdvanced, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRAccelerationStructure, VK_API_VERSION_1_1, 0, ExtensionId::eEXTDescriptorIndexing },
+        { ExtensionId::eKHRAccelerationStructure, VK_API_VERSION_1_1, 0, ExtensionId::eKHRBufferDeviceAddress },
+        { ExtensionId::eKHRAccelerationStructure, VK_API_VERSION_1_1, 0, ExtensionId::eKHRDeferredHostOperations },
+        { ExtensionId::eKHRAccelerationStructure, VK_API_VERSION_1_2, 0, ExtensionId::eKHRDeferredHostOperations },
+        { ExtensionId::eKHRRayTracingPipeline, VK_API_VERSION_1_0, 0, ExtensionId::eKHRAccelerationStructure },
+        { ExtensionId::eKHRRayTracingPipeline, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSpirv14 },
+        { ExtensionId::eKHRRayTracingPipeline, VK_API_VERSION_1_2, 0, ExtensionId::eKHRAccelerationStructure },
+        { ExtensionId::eKHRRayQuery, VK_API_VERSION_1_0, 0, ExtensionId::eKHRAccelerationStructure },
+        { ExtensionId::eKHRRayQuery, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSpirv14 },
+        { ExtensionId::eKHRRayQuery, VK_API_VERSION_1_2, 0, ExtensionId::eKHRAccelerationStructure },
+        { ExtensionId::eNVShaderSmBuiltins, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRSamplerYcbcrConversion, VK_API_VERSION_1_0, 0, ExtensionId::eKHRBindMemory2 },
+        { ExtensionId::eKHRSamplerYcbcrConversion, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetMemoryRequirements2 },
+        { ExtensionId::eKHRSamplerYcbcrConversion, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRSamplerYcbcrConversion, VK_API_VERSION_1_0, 0, ExtensionId::eKHRMaintenance1 },
+        { ExtensionId::eKHRSamplerYcbcrConversion, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTImageDrmFormatModifier, VK_API_VERSION_1_0, 0, ExtensionId::eKHRBindMemory2 },
+        { ExtensionId::eEXTImageDrmFormatModifier, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTImageDrmFormatModifier, VK_API_VERSION_1_0, 0, ExtensionId::eKHRImageFormatList },
+        { ExtensionId::eEXTImageDrmFormatModifier, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSamplerYcbcrConversion },
+        { ExtensionId::eEXTImageDrmFormatModifier, VK_API_VERSION_1_1, 0, ExtensionId::eKHRImageFormatList },
+        { ExtensionId::eEXTImageDrmFormatModifier, VK_API_VERSION_1_2, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTDescriptorIndexing, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTDescriptorIndexing, VK_API_VERSION_1_0, 0, ExtensionId::eKHRMaintenance3 },
+        { ExtensionId::eEXTDescriptorIndexing, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRPortabilitySubset, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRPortabilitySubset, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVShadingRateImage, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVShadingRateImage, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVRayTracing, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetMemoryRequirements2 },
+        { ExtensionId::eNVRayTracing, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVRayTracing, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVRepresentativeFragmentTest, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVRepresentativeFragmentTest, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRMaintenance3, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRMaintenance3, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eQCOMCooperativeMatrixConversion, VK_API_VERSION_1_0, 0, ExtensionId::eKHRCooperativeMatrix },
+        { ExtensionId::eQCOMElapsedTimerQuery, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eQCOMElapsedTimerQuery, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRShaderSubgroupExtendedTypes, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHR8BitStorage, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHR8BitStorage, VK_API_VERSION_1_0, 0, ExtensionId::eKHRStorageBufferStorageClass },
+        { ExtensionId::eKHR8BitStorage, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTExternalMemoryHost, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalMemory },
+        { ExtensionId::eEXTExternalMemoryHost, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRShaderAtomicInt64, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRShaderAtomicInt64, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRShaderClock, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRShaderClock, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTCalibratedTimestamps, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTCalibratedTimestamps, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eAMDShaderCoreProperties, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eAMDShaderCoreProperties, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRVideoDecodeH265, VK_API_VERSION_1_0, 0, ExtensionId::eKHRVideoDecodeQueue },
+        { ExtensionId::eKHRGlobalPriority, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRGlobalPriority, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTVertexAttributeDivisor, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTVertexAttributeDivisor, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eGGPFrameToken, VK_API_VERSION_1_0, 0, ExtensionId::eGGPStreamDescriptorSurface },
+        { ExtensionId::eGGPFrameToken, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eKHRDriverProperties, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRDriverProperties, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRShaderFloatControls, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRShaderFloatControls, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVShaderSubgroupPartitioned, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRDepthStencilResolve, VK_API_VERSION_1_0, 0, ExtensionId::eKHRCreateRenderpass2 },
+        { ExtensionId::eKHRDepthStencilResolve, VK_API_VERSION_1_2, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRSwapchainMutableFormat, VK_API_VERSION_1_0, 0, ExtensionId::eKHRImageFormatList },
+        { ExtensionId::eKHRSwapchainMutableFormat, VK_API_VERSION_1_0, 0, ExtensionId::eKHRMaintenance2 },
+        { ExtensionId::eKHRSwapchainMutableFormat, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eKHRSwapchainMutableFormat, VK_API_VERSION_1_1, 0, ExtensionId::eKHRImageFormatList },
+        { ExtensionId::eKHRSwapchainMutableFormat, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eKHRSwapchainMutableFormat, VK_API_VERSION_1_2, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eNVComputeShaderDerivatives, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVComputeShaderDerivatives, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVMeshShader, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVMeshShader, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVFragmentShaderBarycentric, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVFragmentShaderBarycentric, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVShaderImageFootprint, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVShaderImageFootprint, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVScissorExclusive, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVScissorExclusive, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVDeviceDiagnosticCheckpoints, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVDeviceDiagnosticCheckpoints, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRTimelineSemaphore, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRTimelineSemaphore, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTPresentTiming, VK_API_VERSION_1_0, 0, ExtensionId::eKHRCalibratedTimestamps },
+        { ExtensionId::eEXTPresentTiming, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetSurfaceCapabilities2 },
+        { ExtensionId::eEXTPresentTiming, VK_API_VERSION_1_0, 0, ExtensionId::eKHRPresentId2 },
+        { ExtensionId::eEXTPresentTiming, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eINTELShaderIntegerFunctions2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eINTELShaderIntegerFunctions2, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRVulkanMemoryModel, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRVulkanMemoryModel, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTPciBusInfo, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTPciBusInfo, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eAMDDisplayNativeHdr, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eAMDDisplayNativeHdr, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetSurfaceCapabilities2 },
+        { ExtensionId::eAMDDisplayNativeHdr, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eAMDDisplayNativeHdr, VK_API_VERSION_1_1, 0, ExtensionId::eKHRGetSurfaceCapabilities2 },
+        { ExtensionId::eAMDDisplayNativeHdr, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eFUCHSIAImagepipeSurface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eKHRShaderTerminateInvocation, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRShaderTerminateInvocation, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTMetalSurface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eEXTFragmentDensityMap, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTFragmentDensityMap, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTScalarBlockLayout, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTScalarBlockLayout, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTSubgroupSizeControl, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRFragmentShadingRate, VK_API_VERSION_1_0, 0, ExtensionId::eKHRCreateRenderpass2 },
+        { ExtensionId::eKHRFragmentShadingRate, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRFragmentShadingRate, VK_API_VERSION_1_1, 0, ExtensionId::eKHRCreateRenderpass2 },
+        { ExtensionId::eKHRFragmentShadingRate, VK_API_VERSION_1_2, 0, ExtensionId::eUnknown },
+        { ExtensionId::eAMDShaderCoreProperties2, VK_API_VERSION_1_0, 0, ExtensionId::eAMDShaderCoreProperties },
+        { ExtensionId::eAMDDeviceCoherentMemory, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eAMDDeviceCoherentMemory, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRShaderConstantData, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRShaderConstantData, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRDynamicRenderingLocalRead, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDynamicRendering },
+        { ExtensionId::eKHRDynamicRenderingLocalRead, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRShaderAbort, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDeviceFault },
+        { ExtensionId::eKHRShaderAbort, VK_API_VERSION_1_0, 0, ExtensionId::eKHRShaderConstantData },
+        { ExtensionId::eEXTShaderImageAtomicInt64, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTShaderImageAtomicInt64, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRShaderQuadControl, VK_API_VERSION_1_1, 0, ExtensionId::eKHRShaderMaximalReconvergence },
+        { ExtensionId::eKHRShaderQuadControl, VK_API_VERSION_1_1, 0, ExtensionId::eKHRVulkanMemoryModel },
+        { ExtensionId::eKHRShaderQuadControl, VK_API_VERSION_1_2, 0, ExtensionId::eKHRShaderMaximalReconvergence },
+        { ExtensionId::eKHRSpirv14, VK_API_VERSION_1_1, 0, ExtensionId::eKHRShaderFloatControls },
+        { ExtensionId::eEXTMemoryBudget, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTMemoryBudget, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTMemoryPriority, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTMemoryPriority, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRSurfaceProtectedCapabilities, VK_API_VERSION_1_1, 0, ExtensionId::eKHRGetSurfaceCapabilities2 },
+        { ExtensionId::eNVDedicatedAllocationImageAliasing, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDedicatedAllocation },
+        { ExtensionId::eNVDedicatedAllocationImageAliasing, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVDedicatedAllocationImageAliasing, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRSeparateDepthStencilLayouts, VK_API_VERSION_1_0, 0, ExtensionId::eKHRCreateRenderpass2 },
+        { ExtensionId::eKHRSeparateDepthStencilLayouts, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRSeparateDepthStencilLayouts, VK_API_VERSION_1_1, 0, ExtensionId::eKHRCreateRenderpass2 },
+        { ExtensionId::eKHRSeparateDepthStencilLayouts, VK_API_VERSION_1_2, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTBufferDeviceAddress, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTBufferDeviceAddress, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRPresentWait, VK_API_VERSION_1_0, 0, ExtensionId::eKHRPresentId },
+        { ExtensionId::eKHRPresentWait, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eNVCooperativeMatrix, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVCooperativeMatrix, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVCoverageReductionMode, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVCoverageReductionMode, VK_API_VERSION_1_0, 0, ExtensionId::eNVFramebufferMixedSamples },
+        { ExtensionId::eNVCoverageReductionMode, VK_API_VERSION_1_1, 0, ExtensionId::eNVFramebufferMixedSamples },
+        { ExtensionId::eEXTFragmentShaderInterlock, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTFragmentShaderInterlock, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTYcbcrImageArrays, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSamplerYcbcrConversion },
+        { ExtensionId::eEXTYcbcrImageArrays, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRUniformBufferStandardLayout, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRUniformBufferStandardLayout, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTProvokingVertex, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTProvokingVertex, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTFullScreenExclusive, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTFullScreenExclusive, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetSurfaceCapabilities2 },
+        { ExtensionId::eEXTFullScreenExclusive, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eEXTFullScreenExclusive, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eEXTFullScreenExclusive, VK_API_VERSION_1_1, 0, ExtensionId::eKHRGetSurfaceCapabilities2 },
+        { ExtensionId::eEXTFullScreenExclusive, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eEXTFullScreenExclusive, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eEXTHeadlessSurface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eKHRBufferDeviceAddress, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDeviceGroup },
+        { ExtensionId::eKHRBufferDeviceAddress, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRBufferDeviceAddress, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTLineRasterization, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTLineRasterization, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTShaderAtomicFloat, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTShaderAtomicFloat, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTHostQueryReset, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTHostQueryReset, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTIndexTypeUint8, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTIndexTypeUint8, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTExtendedDynamicState, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTExtendedDynamicState, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRPipelineExecutableProperties, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRPipelineExecutableProperties, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTHostImageCopy, VK_API_VERSION_1_0, 0, ExtensionId::eKHRCopyCommands2 },
+        { ExtensionId::eEXTHostImageCopy, VK_API_VERSION_1_0, 0, ExtensionId::eKHRFormatFeatureFlags2 },
+        { ExtensionId::eEXTHostImageCopy, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTHostImageCopy, VK_API_VERSION_1_1, 0, ExtensionId::eKHRCopyCommands2 },
+        { ExtensionId::eEXTHostImageCopy, VK_API_VERSION_1_1, 0, ExtensionId::eKHRFormatFeatureFlags2 },
+        { ExtensionId::eEXTHostImageCopy, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTMapMemoryPlaced, VK_API_VERSION_1_0, 0, ExtensionId::eKHRMapMemory2 },
+        { ExtensionId::eEXTMapMemoryPlaced, VK_API_VERSION_1_4, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTShaderAtomicFloat2, VK_API_VERSION_1_0, 0, ExtensionId::eEXTShaderAtomicFloat },
+        { ExtensionId::eEXTSurfaceMaintenance1, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetSurfaceCapabilities2 },
+        { ExtensionId::eEXTSurfaceMaintenance1, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eEXTSwapchainMaintenance1, VK_API_VERSION_1_0, 0, ExtensionId::eEXTSurfaceMaintenance1 },
+        { ExtensionId::eEXTSwapchainMaintenance1, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTSwapchainMaintenance1, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eEXTSwapchainMaintenance1, VK_API_VERSION_1_1, 0, ExtensionId::eEXTSurfaceMaintenance1 },
+        { ExtensionId::eEXTSwapchainMaintenance1, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eEXTShaderDemoteToHelperInvocation, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTShaderDemoteToHelperInvocation, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVDeviceGeneratedCommands, VK_API_VERSION_1_1, 0, ExtensionId::eKHRBufferDeviceAddress },
+        { ExtensionId::eNVDeviceGeneratedCommands, VK_API_VERSION_1_2, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVInheritedViewportScissor, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVInheritedViewportScissor, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRShaderIntegerDotProduct, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRShaderIntegerDotProduct, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTTexelBufferAlignment, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTTexelBufferAlignment, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTDepthBiasControl, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTDepthBiasControl, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTDeviceMemoryReport, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTDeviceMemoryReport, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTAcquireDrmDisplay, VK_API_VERSION_1_0, 0, ExtensionId::eEXTDirectModeDisplay },
+        { ExtensionId::eEXTRobustness2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTRobustness2, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTCustomBorderColor, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTCustomBorderColor, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTTextureCompressionAstc3D, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTTextureCompressionAstc3D, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVPresentBarrier, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVPresentBarrier, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetSurfaceCapabilities2 },
+        { ExtensionId::eNVPresentBarrier, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eNVPresentBarrier, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eNVPresentBarrier, VK_API_VERSION_1_1, 0, ExtensionId::eKHRGetSurfaceCapabilities2 },
+        { ExtensionId::eNVPresentBarrier, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eNVPresentBarrier, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eKHRPresentId, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRPresentId, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eKHRPresentId, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eEXTPrivateData, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTPrivateData, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTPipelineCreationCacheControl, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTPipelineCreationCacheControl, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRVideoEncodeQueue, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eKHRVideoEncodeQueue, VK_API_VERSION_1_0, 0, ExtensionId::eKHRVideoQueue },
+        { ExtensionId::eKHRVideoEncodeQueue, VK_API_VERSION_1_3, 0, ExtensionId::eKHRVideoQueue },
+        { ExtensionId::eNVDeviceDiagnosticsConfig, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVDeviceDiagnosticsConfig, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eQCOMQueuePerfHint, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eQCOMQueuePerfHint, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eQCOMImageProcessing3, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eQCOMImageProcessing3, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eQCOMShaderMultipleWaitQueues, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eQCOMShaderMultipleWaitQueues, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTShaderSplitBarrier, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTShaderSplitBarrier, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVCudaKernelLaunch, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVCudaKernelLaunch, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eQCOMTileShading, VK_API_VERSION_1_0, 0, ExtensionId::eQCOMTileProperties },
+        { ExtensionId::eKHRSynchronization2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRSynchronization2, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTDescriptorBuffer, VK_API_VERSION_1_0, 0, ExtensionId::eEXTDescriptorIndexing },
+        { ExtensionId::eEXTDescriptorBuffer, VK_API_VERSION_1_0, 0, ExtensionId::eKHRBufferDeviceAddress },
+        { ExtensionId::eEXTDescriptorBuffer, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTDescriptorBuffer, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eEXTDescriptorBuffer, VK_API_VERSION_1_1, 0, ExtensionId::eEXTDescriptorIndexing },
+        { ExtensionId::eEXTDescriptorBuffer, VK_API_VERSION_1_1, 0, ExtensionId::eKHRBufferDeviceAddress },
+        { ExtensionId::eEXTDescriptorBuffer, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eEXTDescriptorBuffer, VK_API_VERSION_1_2, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eEXTDescriptorBuffer, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRDeviceAddressCommands, VK_API_VERSION_1_0, 0, ExtensionId::eEXTExtendedDynamicState },
+        { ExtensionId::eKHRDeviceAddressCommands, VK_API_VERSION_1_0, 0, ExtensionId::eKHRBufferDeviceAddress },
+        { ExtensionId::eKHRDeviceAddressCommands, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRDeviceAddressCommands, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eKHRDeviceAddressCommands, VK_API_VERSION_1_1, 0, ExtensionId::eEXTExtendedDynamicState },
+        { ExtensionId::eKHRDeviceAddressCommands, VK_API_VERSION_1_1, 0, ExtensionId::eKHRBufferDeviceAddress },
+        { ExtensionId::eKHRDeviceAddressCommands, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eKHRDeviceAddressCommands, VK_API_VERSION_1_2, 0, ExtensionId::eEXTExtendedDynamicState },
+        { ExtensionId::eKHRDeviceAddressCommands, VK_API_VERSION_1_2, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eKHRDeviceAddressCommands, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTGraphicsPipelineLibrary, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTGraphicsPipelineLibrary, VK_API_VERSION_1_0, 0, ExtensionId::eKHRPipelineLibrary },
+        { ExtensionId::eEXTGraphicsPipelineLibrary, VK_API_VERSION_1_1, 0, ExtensionId::eKHRPipelineLibrary },
+        { ExtensionId::eAMDShaderEarlyAndLateFragmentTests, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eAMDShaderEarlyAndLateFragmentTests, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRFragmentShaderBarycentric, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRFragmentShaderBarycentric, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRShaderSubgroupUniformControlFlow, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRZeroInitializeWorkgroupMemory, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRZeroInitializeWorkgroupMemory, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVFragmentShadingRateEnums, VK_API_VERSION_1_0, 0, ExtensionId::eKHRFragmentShadingRate },
+        { ExtensionId::eNVRayTracingMotionBlur, VK_API_VERSION_1_0, 0, ExtensionId::eKHRRayTracingPipeline },
+        { ExtensionId::eEXTMeshShader, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSpirv14 },
+        { ExtensionId::eEXTMeshShader, VK_API_VERSION_1_2, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTYcbcr2Plane444Formats, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSamplerYcbcrConversion },
+        { ExtensionId::eEXTYcbcr2Plane444Formats, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTFragmentDensityMap2, VK_API_VERSION_1_0, 0, ExtensionId::eEXTFragmentDensityMap },
+        { ExtensionId::eQCOMRotatedCopyCommands, VK_API_VERSION_1_0, 0, ExtensionId::eKHRCopyCommands2 },
+        { ExtensionId::eQCOMRotatedCopyCommands, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTImageRobustness, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTImageRobustness, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRWorkgroupMemoryExplicitLayout, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRWorkgroupMemoryExplicitLayout, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRCopyCommands2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRCopyCommands2, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTImageCompressionControl, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTImageCompressionControl, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTAttachmentFeedbackLoopLayout, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTAttachmentFeedbackLoopLayout, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXT4444Formats, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXT4444Formats, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTDeviceFault, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTDeviceFault, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eARMRasterizationOrderAttachmentAccess, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eARMRasterizationOrderAttachmentAccess, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTRgba10X6Formats, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSamplerYcbcrConversion },
+        { ExtensionId::eEXTRgba10X6Formats, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVAcquireWinrtDisplay, VK_API_VERSION_1_0, 0, ExtensionId::eEXTDirectModeDisplay },
+        { ExtensionId::eEXTDirectfbSurface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eVALVEMutableDescriptorType, VK_API_VERSION_1_0, 0, ExtensionId::eKHRMaintenance3 },
+        { ExtensionId::eEXTVertexInputDynamicState, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTVertexInputDynamicState, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTPhysicalDeviceDrm, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTPhysicalDeviceDrm, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTDeviceAddressBindingReport, VK_API_VERSION_1_0, 0, ExtensionId::eEXTDebugUtils },
+        { ExtensionId::eEXTDeviceAddressBindingReport, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTDeviceAddressBindingReport, VK_API_VERSION_1_1, 0, ExtensionId::eEXTDebugUtils },
+        { ExtensionId::eEXTDepthClipControl, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTDepthClipControl, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTPrimitiveTopologyListRestart, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTPrimitiveTopologyListRestart, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRFormatFeatureFlags2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRFormatFeatureFlags2, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTPresentModeFifoLatestReady, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eFUCHSIAExternalMemory, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalMemory },
+        { ExtensionId::eFUCHSIAExternalMemory, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalMemoryCapabilities },
+        { ExtensionId::eFUCHSIAExternalMemory, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eFUCHSIAExternalSemaphore, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalSemaphore },
+        { ExtensionId::eFUCHSIAExternalSemaphore, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalSemaphoreCapabilities },
+        { ExtensionId::eFUCHSIABufferCollection, VK_API_VERSION_1_0, 0, ExtensionId::eFUCHSIAExternalMemory },
+        { ExtensionId::eFUCHSIABufferCollection, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSamplerYcbcrConversion },
+        { ExtensionId::eFUCHSIABufferCollection, VK_API_VERSION_1_1, 0, ExtensionId::eFUCHSIAExternalMemory },
+        { ExtensionId::eHUAWEISubpassShading, VK_API_VERSION_1_0, 0, ExtensionId::eKHRCreateRenderpass2 },
+        { ExtensionId::eHUAWEISubpassShading, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eHUAWEISubpassShading, VK_API_VERSION_1_2, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eHUAWEISubpassShading, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eHUAWEIInvocationMask, VK_API_VERSION_1_0, 0, ExtensionId::eKHRRayTracingPipeline },
+        { ExtensionId::eHUAWEIInvocationMask, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eHUAWEIInvocationMask, VK_API_VERSION_1_3, 0, ExtensionId::eKHRRayTracingPipeline },
+        { ExtensionId::eNVExternalMemoryRdma, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalMemory },
+        { ExtensionId::eNVExternalMemoryRdma, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTPipelineProperties, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTPipelineProperties, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTFrameBoundary, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTFrameBoundary, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTMultisampledRenderToSingleSampled, VK_API_VERSION_1_0, 0, ExtensionId::eKHRCreateRenderpass2 },
+        { ExtensionId::eEXTMultisampledRenderToSingleSampled, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDepthStencilResolve },
+        { ExtensionId::eEXTMultisampledRenderToSingleSampled, VK_API_VERSION_1_2, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTExtendedDynamicState2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTExtendedDynamicState2, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eQNXScreenSurface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eEXTColorWriteEnable, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTColorWriteEnable, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTPrimitivesGeneratedQuery, VK_API_VERSION_1_0, 0, ExtensionId::eEXTTransformFeedback },
+        { ExtensionId::eKHRRayTracingMaintenance1, VK_API_VERSION_1_0, 0, ExtensionId::eKHRAccelerationStructure },
+        { ExtensionId::eKHRShaderUntypedPointers, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTGlobalPriorityQuery, VK_API_VERSION_1_0, 0, ExtensionId::eEXTGlobalPriority },
+        { ExtensionId::eEXTGlobalPriorityQuery, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTGlobalPriorityQuery, VK_API_VERSION_1_1, 0, ExtensionId::eEXTGlobalPriority },
+        { ExtensionId::eVALVEVideoEncodeRgbConversion, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSamplerYcbcrConversion },
+        { ExtensionId::eVALVEVideoEncodeRgbConversion, VK_API_VERSION_1_0, 0, ExtensionId::eKHRVideoEncodeQueue },
+        { ExtensionId::eVALVEVideoEncodeRgbConversion, VK_API_VERSION_1_1, 0, ExtensionId::eKHRVideoEncodeQueue },
+        { ExtensionId::eEXTImageViewMinLod, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTImageViewMinLod, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTMultiDraw, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTMultiDraw, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTImage2DViewOf3D, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTImage2DViewOf3D, VK_API_VERSION_1_0, 0, ExtensionId::eKHRMaintenance1 },
+        { ExtensionId::eEXTImage2DViewOf3D, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTShaderTileImage, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTOpacityMicromap, VK_API_VERSION_1_0, 0, ExtensionId::eKHRAccelerationStructure },
+        { ExtensionId::eEXTOpacityMicromap, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eEXTOpacityMicromap, VK_API_VERSION_1_3, 0, ExtensionId::eKHRAccelerationStructure },
+        { ExtensionId::eNVDisplacementMicromap, VK_API_VERSION_1_0, 0, ExtensionId::eEXTOpacityMicromap },
+        { ExtensionId::eHUAWEIClusterCullingShader, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eHUAWEIClusterCullingShader, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTBorderColorSwizzle, VK_API_VERSION_1_0, 0, ExtensionId::eEXTCustomBorderColor },
+        { ExtensionId::eEXTPageableDeviceLocalMemory, VK_API_VERSION_1_0, 0, ExtensionId::eEXTMemoryPriority },
+        { ExtensionId::eKHRMaintenance4, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eARMShaderCoreProperties, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRShaderSubgroupRotate, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRShaderSubgroupRotate, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eARMSchedulingControls, VK_API_VERSION_1_0, 0, ExtensionId::eARMShaderCoreBuiltins },
+        { ExtensionId::eEXTImageSlicedViewOf3D, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTImageSlicedViewOf3D, VK_API_VERSION_1_0, 0, ExtensionId::eKHRMaintenance1 },
+        { ExtensionId::eEXTImageSlicedViewOf3D, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eVALVEDescriptorSetHostMapping, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eVALVEDescriptorSetHostMapping, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTDepthClampZeroOne, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTDepthClampZeroOne, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTNonSeamlessCubeMap, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTNonSeamlessCubeMap, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eARMRenderPassStriped, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eARMRenderPassStriped, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eARMRenderPassStriped, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eARMRenderPassStriped, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eQCOMFragmentDensityMapOffset, VK_API_VERSION_1_0, 0, ExtensionId::eEXTFragmentDensityMap },
+        { ExtensionId::eQCOMFragmentDensityMapOffset, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eQCOMFragmentDensityMapOffset, VK_API_VERSION_1_1, 0, ExtensionId::eEXTFragmentDensityMap },
+        { ExtensionId::eNVCopyMemoryIndirect, VK_API_VERSION_1_0, 0, ExtensionId::eKHRBufferDeviceAddress },
+        { ExtensionId::eNVCopyMemoryIndirect, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVCopyMemoryIndirect, VK_API_VERSION_1_1, 0, ExtensionId::eKHRBufferDeviceAddress },
+        { ExtensionId::eNVCopyMemoryIndirect, VK_API_VERSION_1_2, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVMemoryDecompression, VK_API_VERSION_1_0, 0, ExtensionId::eKHRBufferDeviceAddress },
+        { ExtensionId::eNVMemoryDecompression, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVMemoryDecompression, VK_API_VERSION_1_1, 0, ExtensionId::eKHRBufferDeviceAddress },
+        { ExtensionId::eNVMemoryDecompression, VK_API_VERSION_1_2, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVDeviceGeneratedCommandsCompute, VK_API_VERSION_1_0, 0, ExtensionId::eNVDeviceGeneratedCommands },
+        { ExtensionId::eNVRayTracingLinearSweptSpheres, VK_API_VERSION_1_0, 0, ExtensionId::eKHRRayTracingPipeline },
+        { ExtensionId::eNVLinearColorAttachment, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVLinearColorAttachment, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eGOOGLESurfacelessQuery, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eKHRShaderMaximalReconvergence, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTImageCompressionControlSwapchain, VK_API_VERSION_1_0, 0, ExtensionId::eEXTImageCompressionControl },
+        { ExtensionId::eQCOMImageProcessing, VK_API_VERSION_1_0, 0, ExtensionId::eKHRFormatFeatureFlags2 },
+        { ExtensionId::eQCOMImageProcessing, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTNestedCommandBuffer, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTNestedCommandBuffer, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eOHOSExternalMemory, VK_API_VERSION_1_0, 0, ExtensionId::eEXTQueueFamilyForeign },
+        { ExtensionId::eOHOSExternalMemory, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDedicatedAllocation },
+        { ExtensionId::eOHOSExternalMemory, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalMemory },
+        { ExtensionId::eOHOSExternalMemory, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSamplerYcbcrConversion },
+        { ExtensionId::eOHOSExternalMemory, VK_API_VERSION_1_1, 0, ExtensionId::eEXTQueueFamilyForeign },
+        { ExtensionId::eEXTExternalMemoryAcquireUnmodified, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalMemory },
+        { ExtensionId::eEXTExternalMemoryAcquireUnmodified, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTExtendedDynamicState3, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTExtendedDynamicState3, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTSubpassMergeFeedback, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTSubpassMergeFeedback, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eARMTensors, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTShaderModuleIdentifier, VK_API_VERSION_1_0, 0, ExtensionId::eEXTPipelineCreationCacheControl },
+        { ExtensionId::eEXTShaderModuleIdentifier, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTShaderModuleIdentifier, VK_API_VERSION_1_1, 0, ExtensionId::eEXTPipelineCreationCacheControl },
+        { ExtensionId::eEXTShaderModuleIdentifier, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTRasterizationOrderAttachmentAccess, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTRasterizationOrderAttachmentAccess, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVOpticalFlow, VK_API_VERSION_1_0, 0, ExtensionId::eKHRFormatFeatureFlags2 },
+        { ExtensionId::eNVOpticalFlow, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVOpticalFlow, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eNVOpticalFlow, VK_API_VERSION_1_1, 0, ExtensionId::eKHRFormatFeatureFlags2 },
+        { ExtensionId::eNVOpticalFlow, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSynchronization2 },
+        { ExtensionId::eNVOpticalFlow, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTLegacyDithering, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTLegacyDithering, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTPipelineProtectedAccess, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTPipelineProtectedAccess, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eANDROIDExternalFormatResolve, VK_API_VERSION_1_0, 0, ExtensionId::eANDROIDExternalMemoryAndroidHardwareBuffer },
+        { ExtensionId::eKHRMaintenance5, VK_API_VERSION_1_1, 0, ExtensionId::eKHRDynamicRendering },
+        { ExtensionId::eKHRMaintenance5, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eAMDAntiLag, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eAMDAntiLag, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eAMDXDenseGeometryFormat, VK_API_VERSION_1_0, 0, ExtensionId::eKHRAccelerationStructure },
+        { ExtensionId::eAMDXDenseGeometryFormat, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExtendedFlags },
+        { ExtensionId::eAMDXDenseGeometryFormat, VK_API_VERSION_1_0, 1, ExtensionId::eKHRAccelerationStructure },
+        { ExtensionId::eAMDXDenseGeometryFormat, VK_API_VERSION_1_0, 1, ExtensionId::eKHRMaintenance5 },
+        { ExtensionId::eAMDXDenseGeometryFormat, VK_API_VERSION_1_4, 0, ExtensionId::eKHRAccelerationStructure },
+        { ExtensionId::eKHRPresentId2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetSurfaceCapabilities2 },
+        { ExtensionId::eKHRPresentId2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eKHRPresentId2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eKHRPresentWait2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetSurfaceCapabilities2 },
+        { ExtensionId::eKHRPresentWait2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRPresentId2 },
+        { ExtensionId::eKHRPresentWait2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eKHRPresentWait2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eKHRRayTracingPositionFetch, VK_API_VERSION_1_0, 0, ExtensionId::eKHRAccelerationStructure },
+        { ExtensionId::eEXTShaderObject, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDynamicRendering },
+        { ExtensionId::eEXTShaderObject, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTShaderObject, VK_API_VERSION_1_1, 0, ExtensionId::eKHRDynamicRendering },
+        { ExtensionId::eEXTShaderObject, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRPipelineBinary, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExtendedFlags },
+        { ExtensionId::eKHRPipelineBinary, VK_API_VERSION_1_0, 1, ExtensionId::eKHRMaintenance5 },
+        { ExtensionId::eKHRPipelineBinary, VK_API_VERSION_1_4, 0, ExtensionId::eUnknown },
+        { ExtensionId::eQCOMTileProperties, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eQCOMTileProperties, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eSECAmigoProfiling, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eSECAmigoProfiling, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRSurfaceMaintenance1, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetSurfaceCapabilities2 },
+        { ExtensionId::eKHRSurfaceMaintenance1, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eKHRSwapchainMaintenance1, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRSwapchainMaintenance1, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurfaceMaintenance1 },
+        { ExtensionId::eKHRSwapchainMaintenance1, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eKHRSwapchainMaintenance1, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSurfaceMaintenance1 },
+        { ExtensionId::eKHRSwapchainMaintenance1, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eQCOMMultiviewPerViewViewports, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eQCOMMultiviewPerViewViewports, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVRayTracingInvocationReorder, VK_API_VERSION_1_0, 0, ExtensionId::eKHRRayTracingPipeline },
+        { ExtensionId::eNVCooperativeVector, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVCooperativeVector, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVExtendedSparseAddressSpace, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVExtendedSparseAddressSpace, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTMutableDescriptorType, VK_API_VERSION_1_0, 0, ExtensionId::eKHRMaintenance3 },
+        { ExtensionId::eEXTMutableDescriptorType, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTLegacyVertexAttributes, VK_API_VERSION_1_0, 0, ExtensionId::eEXTVertexInputDynamicState },
+        { ExtensionId::eARMShaderCoreBuiltins, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eARMShaderCoreBuiltins, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTPipelineLibraryGroupHandles, VK_API_VERSION_1_0, 0, ExtensionId::eKHRPipelineLibrary },
+        { ExtensionId::eEXTPipelineLibraryGroupHandles, VK_API_VERSION_1_0, 0, ExtensionId::eKHRRayTracingPipeline },
+        { ExtensionId::eEXTDynamicRenderingUnusedAttachments, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDynamicRendering },
+        { ExtensionId::eEXTDynamicRenderingUnusedAttachments, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTDynamicRenderingUnusedAttachments, VK_API_VERSION_1_1, 0, ExtensionId::eKHRDynamicRendering },
+        { ExtensionId::eEXTDynamicRenderingUnusedAttachments, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRInternallySynchronizedQueues, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVLowLatency2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRPresentId },
+        { ExtensionId::eNVLowLatency2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRTimelineSemaphore },
+        { ExtensionId::eNVLowLatency2, VK_API_VERSION_1_0, 1, ExtensionId::eKHRPresentId2 },
+        { ExtensionId::eNVLowLatency2, VK_API_VERSION_1_0, 1, ExtensionId::eKHRTimelineSemaphore },
+        { ExtensionId::eNVLowLatency2, VK_API_VERSION_1_2, 0, ExtensionId::eKHRPresentId },
+        { ExtensionId::eNVLowLatency2, VK_API_VERSION_1_2, 1, ExtensionId::eKHRPresentId2 },
+        { ExtensionId::eKHRCooperativeMatrix, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRCooperativeMatrix, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eARMDataGraph, VK_API_VERSION_1_3, 0, ExtensionId::eKHRDeferredHostOperations },
+        { ExtensionId::eARMDataGraph, VK_API_VERSION_1_3, 0, ExtensionId::eKHRExtendedFlags },
+        { ExtensionId::eARMDataGraph, VK_API_VERSION_1_3, 1, ExtensionId::eKHRDeferredHostOperations },
+        { ExtensionId::eARMDataGraph, VK_API_VERSION_1_3, 1, ExtensionId::eKHRMaintenance5 },
+        { ExtensionId::eARMDataGraphInstructionSetTosa, VK_API_VERSION_1_0, 0, ExtensionId::eARMDataGraph },
+        { ExtensionId::eQCOMMultiviewPerViewRenderAreas, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eQCOMMultiviewPerViewRenderAreas, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRComputeShaderDerivatives, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRComputeShaderDerivatives, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRVideoDecodeAv1, VK_API_VERSION_1_0, 0, ExtensionId::eKHRVideoDecodeQueue },
+        { ExtensionId::eKHRVideoEncodeAv1, VK_API_VERSION_1_0, 0, ExtensionId::eKHRVideoEncodeQueue },
+        { ExtensionId::eKHRVideoDecodeVp9, VK_API_VERSION_1_0, 0, ExtensionId::eKHRVideoDecodeQueue },
+        { ExtensionId::eKHRVideoMaintenance1, VK_API_VERSION_1_0, 0, ExtensionId::eKHRVideoQueue },
+        { ExtensionId::eNVPerStageDescriptorSet, VK_API_VERSION_1_0, 0, ExtensionId::eKHRMaintenance6 },
+        { ExtensionId::eNVPerStageDescriptorSet, VK_API_VERSION_1_4, 0, ExtensionId::eUnknown },
+        { ExtensionId::eQCOMImageProcessing2, VK_API_VERSION_1_0, 0, ExtensionId::eQCOMImageProcessing },
+        { ExtensionId::eQCOMFilterCubicWeights, VK_API_VERSION_1_0, 0, ExtensionId::eEXTFilterCubic },
+        { ExtensionId::eQCOMYcbcrDegamma, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eQCOMYcbcrDegamma, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eQCOMFilterCubicClamp, VK_API_VERSION_1_0, 0, ExtensionId::eEXTFilterCubic },
+        { ExtensionId::eQCOMFilterCubicClamp, VK_API_VERSION_1_0, 0, ExtensionId::eEXTSamplerFilterMinmax },
+        { ExtensionId::eQCOMFilterCubicClamp, VK_API_VERSION_1_2, 0, ExtensionId::eEXTFilterCubic },
+        { ExtensionId::eEXTAttachmentFeedbackLoopDynamicState, VK_API_VERSION_1_0, 0, ExtensionId::eEXTAttachmentFeedbackLoopLayout },
+        { ExtensionId::eEXTAttachmentFeedbackLoopDynamicState, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTAttachmentFeedbackLoopDynamicState, VK_API_VERSION_1_1, 0, ExtensionId::eEXTAttachmentFeedbackLoopLayout },
+        { ExtensionId::eKHRVertexAttributeDivisor, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRVertexAttributeDivisor, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRUnifiedImageLayouts, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRUnifiedImageLayouts, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRShaderFloatControls2, VK_API_VERSION_1_1, 0, ExtensionId::eKHRShaderFloatControls },
+        { ExtensionId::eQNXExternalMemoryScreenBuffer, VK_API_VERSION_1_0, 0, ExtensionId::eEXTQueueFamilyForeign },
+        { ExtensionId::eQNXExternalMemoryScreenBuffer, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDedicatedAllocation },
+        { ExtensionId::eQNXExternalMemoryScreenBuffer, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalMemory },
+        { ExtensionId::eQNXExternalMemoryScreenBuffer, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSamplerYcbcrConversion },
+        { ExtensionId::eQNXExternalMemoryScreenBuffer, VK_API_VERSION_1_1, 0, ExtensionId::eEXTQueueFamilyForeign },
+        { ExtensionId::eMSFTLayeredDriver, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eMSFTLayeredDriver, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRIndexTypeUint8, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRIndexTypeUint8, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRLineRasterization, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRLineRasterization, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRCalibratedTimestamps, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRCalibratedTimestamps, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRShaderExpectAssume, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRShaderExpectAssume, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRMaintenance6, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVDescriptorPoolOverallocation, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eQCOMTileMemoryHeap, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetMemoryRequirements2 },
+        { ExtensionId::eQCOMTileMemoryHeap, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eQCOMTileMemoryHeap, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRCopyMemoryIndirect, VK_API_VERSION_1_0, 0, ExtensionId::eKHRBufferDeviceAddress },
+        { ExtensionId::eKHRCopyMemoryIndirect, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRCopyMemoryIndirect, VK_API_VERSION_1_2, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTMemoryDecompression, VK_API_VERSION_1_0, 0, ExtensionId::eKHRBufferDeviceAddress },
+        { ExtensionId::eEXTMemoryDecompression, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVDisplayStereo, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDisplay },
+        { ExtensionId::eNVDisplayStereo, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetDisplayProperties2 },
+        { ExtensionId::eKHRVideoEncodeIntraRefresh, VK_API_VERSION_1_0, 0, ExtensionId::eKHRVideoEncodeQueue },
+        { ExtensionId::eKHRVideoEncodeQuantizationMap, VK_API_VERSION_1_0, 0, ExtensionId::eKHRFormatFeatureFlags2 },
+        { ExtensionId::eKHRVideoEncodeQuantizationMap, VK_API_VERSION_1_0, 0, ExtensionId::eKHRVideoEncodeQueue },
+        { ExtensionId::eKHRVideoEncodeQuantizationMap, VK_API_VERSION_1_3, 0, ExtensionId::eKHRVideoEncodeQueue },
+        { ExtensionId::eNVRawAccessChains, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVRawAccessChains, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRShaderRelaxedExtendedInstruction, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRShaderRelaxedExtendedInstruction, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVCommandBufferInheritance, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVCommandBufferInheritance, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRMaintenance7, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVShaderAtomicFloat16Vector, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVShaderAtomicFloat16Vector, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTShaderReplicatedComposites, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTShaderReplicatedComposites, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eARMTensorControls, VK_API_VERSION_1_0, 0, ExtensionId::eARMTensors },
+        { ExtensionId::eEXTShaderFloat8, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTShaderFloat8, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVRayTracingValidation, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVRayTracingValidation, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVClusterAccelerationStructure, VK_API_VERSION_1_0, 0, ExtensionId::eKHRAccelerationStructure },
+        { ExtensionId::eNVPartitionedAccelerationStructure, VK_API_VERSION_1_0, 0, ExtensionId::eKHRAccelerationStructure },
+        { ExtensionId::eEXTDeviceGeneratedCommands, VK_API_VERSION_1_0, 0, ExtensionId::eKHRBufferDeviceAddress },
+        { ExtensionId::eEXTDeviceGeneratedCommands, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExtendedFlags },
+        { ExtensionId::eEXTDeviceGeneratedCommands, VK_API_VERSION_1_0, 1, ExtensionId::eKHRBufferDeviceAddress },
+        { ExtensionId::eEXTDeviceGeneratedCommands, VK_API_VERSION_1_0, 1, ExtensionId::eKHRMaintenance5 },
+        { ExtensionId::eEXTDeviceGeneratedCommands, VK_API_VERSION_1_2, 0, ExtensionId::eKHRExtendedFlags },
+        { ExtensionId::eEXTDeviceGeneratedCommands, VK_API_VERSION_1_2, 1, ExtensionId::eKHRMaintenance5 },
+        { ExtensionId::eEXTDeviceGeneratedCommands, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRDeviceFault, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRDeviceFault, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRMaintenance8, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eMESAImageAlignmentControl, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eMESAImageAlignmentControl, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRShaderFma, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRShaderFma, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTRayTracingInvocationReorder, VK_API_VERSION_1_0, 0, ExtensionId::eKHRRayTracingPipeline },
+        { ExtensionId::eEXTDepthClampControl, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTDepthClampControl, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRMaintenance9, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRMaintenance9, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRVideoMaintenance2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRVideoQueue },
+        { ExtensionId::eOHOSSurface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eHUAWEIHdrVivid, VK_API_VERSION_1_0, 0, ExtensionId::eEXTHdrMetadata },
+        { ExtensionId::eHUAWEIHdrVivid, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eHUAWEIHdrVivid, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eHUAWEIHdrVivid, VK_API_VERSION_1_1, 0, ExtensionId::eEXTHdrMetadata },
+        { ExtensionId::eHUAWEIHdrVivid, VK_API_VERSION_1_1, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eNVCooperativeMatrix2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRCooperativeMatrix },
+        { ExtensionId::eARMPipelineOpacityMicromap, VK_API_VERSION_1_0, 0, ExtensionId::eEXTOpacityMicromap },
+        { ExtensionId::eKHRVideoEncodeFeedback2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRVideoEncodeQueue },
+        { ExtensionId::eIMGFilterLinear2D, VK_API_VERSION_1_0, 0, ExtensionId::eKHRFormatFeatureFlags2 },
+        { ExtensionId::eIMGFilterLinear2D, VK_API_VERSION_1_3, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTExternalMemoryMetal, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExternalMemory },
+        { ExtensionId::eEXTExternalMemoryMetal, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRDepthClampZeroOne, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRDepthClampZeroOne, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eARMPerformanceCountersByRegion, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eARMPerformanceCountersByRegion, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eARMShaderInstrumentation, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eARMShaderInstrumentation, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTVertexAttributeRobustness, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTVertexAttributeRobustness, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eARMFormatPack, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eARMFormatPack, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eVALVEFragmentDensityMapLayered, VK_API_VERSION_1_0, 0, ExtensionId::eEXTFragmentDensityMap },
+        { ExtensionId::eVALVEFragmentDensityMapLayered, VK_API_VERSION_1_0, 0, ExtensionId::eKHRExtendedFlags },
+        { ExtensionId::eVALVEFragmentDensityMapLayered, VK_API_VERSION_1_0, 1, ExtensionId::eEXTFragmentDensityMap },
+        { ExtensionId::eVALVEFragmentDensityMapLayered, VK_API_VERSION_1_0, 1, ExtensionId::eKHRMaintenance5 },
+        { ExtensionId::eVALVEFragmentDensityMapLayered, VK_API_VERSION_1_4, 0, ExtensionId::eEXTFragmentDensityMap },
+        { ExtensionId::eKHRRobustness2, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRRobustness2, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVPresentMetering, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVPresentMetering, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTMultisampledRenderToSwapchain, VK_API_VERSION_1_0, 0, ExtensionId::eEXTMultisampledRenderToSingleSampled },
+        { ExtensionId::eEXTMultisampledRenderToSwapchain, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eEXTFragmentDensityMapOffset, VK_API_VERSION_1_0, 0, ExtensionId::eEXTFragmentDensityMap },
+        { ExtensionId::eEXTFragmentDensityMapOffset, VK_API_VERSION_1_0, 0, ExtensionId::eKHRCreateRenderpass2 },
+        { ExtensionId::eEXTFragmentDensityMapOffset, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDynamicRendering },
+        { ExtensionId::eEXTFragmentDensityMapOffset, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTFragmentDensityMapOffset, VK_API_VERSION_1_1, 0, ExtensionId::eEXTFragmentDensityMap },
+        { ExtensionId::eEXTFragmentDensityMapOffset, VK_API_VERSION_1_1, 0, ExtensionId::eKHRCreateRenderpass2 },
+        { ExtensionId::eEXTFragmentDensityMapOffset, VK_API_VERSION_1_1, 0, ExtensionId::eKHRDynamicRendering },
+        { ExtensionId::eEXTFragmentDensityMapOffset, VK_API_VERSION_1_2, 0, ExtensionId::eEXTFragmentDensityMap },
+        { ExtensionId::eEXTFragmentDensityMapOffset, VK_API_VERSION_1_2, 0, ExtensionId::eKHRDynamicRendering },
+        { ExtensionId::eEXTFragmentDensityMapOffset, VK_API_VERSION_1_3, 0, ExtensionId::eEXTFragmentDensityMap },
+        { ExtensionId::eEXTZeroInitializeDeviceMemory, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTZeroInitializeDeviceMemory, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRPresentModeFifoLatestReady, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSwapchain },
+        { ExtensionId::eKHROpacityMicromap, VK_API_VERSION_1_0, 0, ExtensionId::eKHRAccelerationStructure },
+        { ExtensionId::eKHROpacityMicromap, VK_API_VERSION_1_0, 0, ExtensionId::eKHRDeviceAddressCommands },
+        { ExtensionId::eEXTShader64BitIndexing, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTShader64BitIndexing, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTCustomResolve, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTCustomResolve, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eQCOMDataGraphModel, VK_API_VERSION_1_0, 0, ExtensionId::eARMDataGraph },
+        { ExtensionId::eKHRMaintenance10, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRMaintenance10, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eARMDataGraphOpticalFlow, VK_API_VERSION_1_0, 0, ExtensionId::eARMDataGraph },
+        { ExtensionId::eEXTShaderLongVector, VK_API_VERSION_1_2, 0, ExtensionId::eUnknown },
+        { ExtensionId::eSECPipelineCacheIncrementalMode, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eSECPipelineCacheIncrementalMode, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTShaderUniformBufferUnsizedArray, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTShaderUniformBufferUnsizedArray, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVComputeOccupancyPriority, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eNVComputeOccupancyPriority, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eKHRMaintenance11, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRMaintenance11, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTCooperativeMatrixMaintenance1, VK_API_VERSION_1_0, 0, ExtensionId::eKHRCooperativeMatrix },
+        { ExtensionId::eEXTShaderSubgroupPartitioned, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTShaderSubgroupPartitioned, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eSECUbmSurface, VK_API_VERSION_1_0, 0, ExtensionId::eKHRSurface },
+        { ExtensionId::eKHRExtendedFlags, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eKHRExtendedFlags, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTShaderOcpMicroscalingTypes, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTShaderOcpMicroscalingTypes, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eVALVEShaderMixedFloatDotProduct, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eVALVEShaderMixedFloatDotProduct, VK_API_VERSION_1_0, 0, ExtensionId::eKHRShaderFloat16Int8 },
+        { ExtensionId::eVALVEShaderMixedFloatDotProduct, VK_API_VERSION_1_1, 0, ExtensionId::eKHRShaderFloat16Int8 },
+        { ExtensionId::eVALVEShaderMixedFloatDotProduct, VK_API_VERSION_1_2, 0, ExtensionId::eUnknown },
+        { ExtensionId::eARMDataGraphNeuralAcceleratorStatistics, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eARMDataGraphNeuralAcceleratorStatistics, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTPrimitiveRestartIndex, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTPrimitiveRestartIndex, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eEXTImageTilingControl, VK_API_VERSION_1_0, 0, ExtensionId::eKHRGetPhysicalDeviceProperties2 },
+        { ExtensionId::eEXTImageTilingControl, VK_API_VERSION_1_1, 0, ExtensionId::eUnknown },
+        { ExtensionId::eNVCooperativeMatrixDecodeVector, VK_API_VERSION_1_0, 0, ExtensionId::eNVCooperativeMatrix2 },
+        { ExtensionId::eUnknown, 0, 0, ExtensionId::eUnknown }
+      };
+      return std::equal_range( std::begin( dependencies ),
+                               std::prev( std::end( dependencies ) ),
+                               ExtensionDependency{ extension, 0, 0, ExtensionId::eUnknown },
+                               []( ExtensionDependency const & lhs, ExtensionDependency const & rhs ) { return lhs.extension < rhs.extension; } );
+    }
+
+    // not VULKAN_HPP_INLINE, as it's recursive
+    inline bool resolveExtension( ExtensionId extension, uint32_t apiVersion, ExtensionSet const & available, ExtensionSet & enabled )
+    {
+      uint32_t promotedToApiVersion = getExtensionPromotedToApiVersion( extension );
+      if ( enabled.test( extension ) || ( ( promotedToApiVersion != 0 ) && ( promotedToApiVersion <= apiVersion ) ) )
+      {
+        // already enabled, or part of the core api
+        return true;
+      }
+      if ( !available.test( extension ) )
+      {
+        return false;
+      }
+      enabled.set( extension );
+
+      auto dependencies = getExtensionDependencies( extension );
+      if ( dependencies.first == dependencies.second )
+      {
+        return true;
+      }
+
+      // the dependencies are listed for the largest api version not exceeding apiVersion
+      ExtensionDependency const * versionBegin = nullptr;
+      for ( auto dependency = dependencies.first; dependency != dependencies.second; ++dependency )
+      {
+        if ( ( dependency->apiVersion <= apiVersion ) && ( !versionBegin || ( versionBegin->apiVersion < dependency->apiVersion ) ) )
+        {
+          versionBegin = dependency;
+        }
+      }
+      if ( !versionBegin )
+      {
+        // the extension is not supported on this api version
+        return false;
+      }
+      ExtensionDependency const * versionEnd = versionBegin;
+      while ( ( versionEnd != dependencies.second ) && ( versionEnd->apiVersion == versionBegin->apiVersion ) )
+      {
+        ++versionEnd;
+      }
+
+      // of all the alternatives that can be resolved, choose the one adding the fewest extensions
+      ExtensionSet resolved;
+      size_t       resolvedCount = 0;
+      bool         isResolved    = false;
+      for ( auto alternativeBegin = versionBegin; alternativeBegin != versionEnd; )
+      {
+        ExtensionSet trial   = enabled;
+        bool         success = true;
+        auto         it      = alternativeBegin;
+        for ( ; ( it != versionEnd ) && ( it->alternative == alternativeBegin->alternative ); ++it )
+        {
+          success = success && ( ( it->dependency == ExtensionId::eUnknown ) || resolveExtension( it->dependency, apiVersion, available, trial ) );
+        }
+        if ( success && ( !isResolved || ( trial.count() < resolvedCount ) ) )
+        {
+          resolved      = trial;
+          resolvedCount = trial.count();
+          isResolved    = true;
+        }
+        alternativeBegin = it;
+      }
+      if ( isResolved )
+      {
+        enabled = resolved;
+      }
+      return isResolved;
+    }
+  }  // namespace detail
+
+#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
+  VULKAN_HPP_INLINE ExtensionSet::ExtensionSet( ArrayProxy<ExtensionProperties const> const & extensionProperties ) VULKAN_HPP_NOEXCEPT
+  {
+    for ( auto const & properties : extensionProperties )
+    {
+      ExtensionId extension = getExtensionId( properties.extensionName );
+      if ( extension != ExtensionId::eUnknown )
+      {
+        set( extension );
+      }
+    }
+  }
+#endif
+
+  VULKAN_HPP_INLINE ExtensionId getExtensionId( char const * extension ) VULKAN_HPP_NOEXCEPT
+  {
+    static std::array<ExtensionId, static_cast<size_t>( ExtensionId::eUnknown )> const sortedIds = []()
+    {
+      std::array<ExtensionId, static_cast<size_t>( ExtensionId::eUnknown )> ids;
+      for ( size_t i = 0; i < ids.size(); ++i )
+      {
+        ids[i] = static_cast<ExtensionId>( i );
+      }
+      std::sort( ids.begin(), ids.end(), []( ExtensionId lhs, ExtensionId rhs ) { return strcmp( getExtensionName( lhs ), getExtensionName( rhs ) ) < 0; } );
+      return ids;
+    }();
+    auto it = std::lower_bound(
+      sortedIds.begin(), sortedIds.end(), extension, []( ExtensionId id, char const * name ) { return strcmp( getExtensionName( id ), name ) < 0; } );
+    return ( ( it != sortedIds.end() ) && ( strcmp( getExtensionName( *it ), extension ) == 0 ) ) ? *it : ExtensionId::eUnknown;
+  }
+
+  VULKAN_HPP_INLINE char const * getExtensionName( ExtensionId extension ) VULKAN_HPP_NOEXCEPT
+  {
+    static char const * const names[] = { "VK_KHR_surface",
+                                          "VK_KHR_swapchain",
+                                          "VK_KHR_display",
+                                          "VK_KHR_display_swapchain",
+                                          "VK_KHR_xlib_surface",
+                                          "VK_KHR_xcb_surface",
+                                          "VK_KHR_wayland_surface",
+                                          "VK_KHR_android_surface",
+                                          "VK_KHR_win32_surface",
+                                          "VK_EXT_debug_report",
+                                          "VK_NV_glsl_shader",
+                                          "VK_EXT_depth_range_unrestricted",
+                                          "VK_KHR_sampler_mirror_clamp_to_edge",
+                                          "VK_IMG_filter_cubic",
+                                          "VK_AMD_rasterization_order",
+                                          "VK_AMD_shader_trinary_minmax",
+                                          "VK_AMD_shader_explicit_vertex_parameter",
+                                          "VK_EXT_debug_marker",
+                                          "VK_KHR_video_queue",
+                                          "VK_KHR_video_decode_queue",
+                                          "VK_AMD_gcn_shader",
+                                          "VK_NV_dedicated_allocation",
+                                          "VK_EXT_transform_feedback",
+                                          "VK_NVX_binary_import",
+                                          "VK_NVX_image_view_handle",
+                                          "VK_AMD_draw_indirect_count",
+                                          "VK_AMD_negative_viewport_height",
+                                          "VK_AMD_gpu_shader_half_float",
+                                          "VK_AMD_shader_ballot",
+                                          "VK_KHR_video_encode_h264",
+                                          "VK_KHR_video_encode_h265",
+                                          "VK_KHR_video_decode_h264",
+                                          "VK_AMD_texture_gather_bias_lod",
+                                          "VK_AMD_shader_info",
+                                          "VK_KHR_dynamic_rendering",
+                                          "VK_AMD_shader_image_load_store_lod",
+                                          "VK_GGP_stream_descriptor_surface",
+                                          "VK_NV_corner_sampled_image",
+                                          "VK_KHR_multiview",
+                                          "VK_IMG_format_pvrtc",
+                                          "VK_NV_external_memory_capabilities",
+                                          "VK_NV_external_memory",
+                                          "VK_NV_external_memory_win32",
+                                          "VK_NV_win32_keyed_mutex",
+                                          "VK_KHR_get_physical_device_properties2",
+                                          "VK_KHR_device_group",
+                                          "VK_EXT_validation_flags",
+                                          "VK_NN_vi_surface",
+                                          "VK_KHR_shader_draw_parameters",
+                                          "VK_EXT_shader_subgroup_ballot",
+                                          "VK_EXT_shader_subgroup_vote",
+                                          "VK_EXT_texture_compression_astc_hdr",
+                                          "VK_EXT_astc_decode_mode",
+                                          "VK_EXT_pipeline_robustness",
+                                          "VK_KHR_maintenance1",
+                                          "VK_KHR_device_group_creation",
+                                          "VK_KHR_external_memory_capabilities",
+                                          "VK_KHR_external_memory",
+                                          "VK_KHR_external_memory_win32",
+                                          "VK_KHR_external_memory_fd",
+                                          "VK_KHR_win32_keyed_mutex",
+                                          "VK_KHR_external_semaphore_capabilities",
+                                          "VK_KHR_external_semaphore",
+                                          "VK_KHR_external_semaphore_win32",
+                                          "VK_KHR_external_semaphore_fd",
+                                          "VK_KHR_push_descriptor",
+                                          "VK_EXT_conditional_rendering",
+                                          "VK_KHR_shader_float16_int8",
+                                          "VK_KHR_16bit_storage",
+                                          "VK_KHR_incremental_present",
+                                          "VK_KHR_descriptor_update_template",
+                                          "VK_NV_clip_space_w_scaling",
+                                          "VK_EXT_direct_mode_display",
+                                          "VK_EXT_acquire_xlib_display",
+                                          "VK_EXT_display_surface_counter",
+                                          "VK_EXT_display_control",
+                                          "VK_GOOGLE_display_timing",
+                                          "VK_NV_sample_mask_override_coverage",
+                                          "VK_NV_geometry_shader_passthrough",
+                                          "VK_NV_viewport_array2",
+                                          "VK_NVX_multiview_per_view_attributes",
+                                          "VK_NV_viewport_swizzle",
+                                          "VK_EXT_discard_rectangles",
+                                          "VK_EXT_conservative_rasterization",
+                                          "VK_EXT_depth_clip_enable",
+                                          "VK_EXT_swapchain_colorspace",
+                                          "VK_EXT_hdr_metadata",
+                                          "VK_KHR_imageless_framebuffer",
+                                          "VK_KHR_create_renderpass2",
+                                          "VK_IMG_relaxed_line_rasterization",
+                                          "VK_KHR_shared_presentable_image",
+                                          "VK_KHR_external_fence_capabilities",
+                                          "VK_KHR_external_fence",
+                                          "VK_KHR_external_fence_win32",
+                                          "VK_KHR_external_fence_fd",
+                                          "VK_KHR_performance_query",
+                                          "VK_KHR_maintenance2",
+                                          "VK_KHR_get_surface_capabilities2",
+                                          "VK_KHR_variable_pointers",
+                                          "VK_KHR_get_display_properties2",
+                                          "VK_MVK_ios_surface",
+                                          "VK_MVK_macos_surface",
+                                          "VK_EXT_external_memory_dma_buf",
+                                          "VK_EXT_queue_family_foreign",
+                                          "VK_KHR_dedicated_allocation",
+                                          "VK_EXT_debug_utils",
+                                          "VK_ANDROID_external_memory_android_hardware_buffer",
+                                          "VK_EXT_sampler_filter_minmax",
+                                          "VK_KHR_storage_buffer_storage_class",
+                                          "VK_AMD_gpu_shader_int16",
+                                          "VK_AMD_gpa_interface",
+                                          "VK_AMDX_shader_enqueue",
+                                          "VK_EXT_descriptor_heap",
+                                          "VK_AMD_mixed_attachment_samples",
+                                          "VK_AMD_shader_fragment_mask",
+                                          "VK_EXT_inline_uniform_block",
+                                          "VK_EXT_shader_stencil_export",
+                                          "VK_KHR_shader_bfloat16",
+                                          "VK_EXT_sample_locations",
+                                          "VK_KHR_relaxed_block_layout",
+                                          "VK_KHR_get_memory_requirements2",
+                                          "VK_KHR_image_format_list",
+                                          "VK_EXT_blend_operation_advanced",
+                                          "VK_NV_fragment_coverage_to_color",
+                                          "VK_KHR_acceleration_structure",
+                                          "VK_KHR_ray_tracing_pipeline",
+                                          "VK_KHR_ray_query",
+                                          "VK_NV_framebuffer_mixed_samples",
+                                          "VK_NV_fill_rectangle",
+                                          "VK_NV_shader_sm_builtins",
+                                          "VK_EXT_post_depth_coverage",
+                                          "VK_KHR_sampler_ycbcr_conversion",
+                                          "VK_KHR_bind_memory2",
+                                          "VK_EXT_image_drm_format_modifier",
+                                          "VK_EXT_validation_cache",
+                                          "VK_EXT_descriptor_indexing",
+                                          "VK_EXT_shader_viewport_index_layer",
+                                          "VK_KHR_portability_subset",
+                                          "VK_NV_shading_rate_image",
+                                          "VK_NV_ray_tracing",
+                                          "VK_NV_representative_fragment_test",
+                                          "VK_KHR_maintenance3",
+                                          "VK_KHR_draw_indirect_count",
+                                          "VK_EXT_filter_cubic",
+                                          "VK_QCOM_render_pass_shader_resolve",
+                                          "VK_QCOM_cooperative_matrix_conversion",
+                                          "VK_QCOM_elapsed_timer_query",
+                                          "VK_EXT_global_priority",
+                                          "VK_KHR_shader_subgroup_extended_types",
+                                          "VK_KHR_8bit_storage",
+                                          "VK_EXT_external_memory_host",
+                                          "VK_AMD_buffer_marker",
+                                          "VK_KHR_shader_atomic_int64",
+                                          "VK_KHR_shader_clock",
+                                          "VK_AMD_pipeline_compiler_control",
+                                          "VK_EXT_calibrated_timestamps",
+                                          "VK_AMD_shader_core_properties",
+                                          "VK_KHR_video_decode_h265",
+                                          "VK_KHR_global_priority",
+                                          "VK_AMD_memory_overallocation_behavior",
+                                          "VK_EXT_vertex_attribute_divisor",
+                                          "VK_GGP_frame_token",
+                                          "VK_EXT_pipeline_creation_feedback",
+                                          "VK_KHR_driver_properties",
+                                          "VK_KHR_shader_float_controls",
+                                          "VK_NV_shader_subgroup_partitioned",
+                                          "VK_KHR_depth_stencil_resolve",
+                                          "VK_KHR_swapchain_mutable_format",
+                                          "VK_NV_compute_shader_derivatives",
+                                          "VK_NV_mesh_shader",
+                                          "VK_NV_fragment_shader_barycentric",
+                                          "VK_NV_shader_image_footprint",
+                                          "VK_NV_scissor_exclusive",
+                                          "VK_NV_device_diagnostic_checkpoints",
+                                          "VK_KHR_timeline_semaphore",
+                                          "VK_EXT_present_timing",
+                                          "VK_INTEL_shader_integer_functions2",
+                                          "VK_INTEL_performance_query",
+                                          "VK_KHR_vulkan_memory_model",
+                                          "VK_EXT_pci_bus_info",
+                                          "VK_AMD_display_native_hdr",
+                                          "VK_FUCHSIA_imagepipe_surface",
+                                          "VK_KHR_shader_terminate_invocation",
+                                          "VK_EXT_metal_surface",
+                                          "VK_EXT_fragment_density_map",
+                                          "VK_EXT_scalar_block_layout",
+                                          "VK_GOOGLE_hlsl_functionality1",
+                                          "VK_GOOGLE_decorate_string",
+                                          "VK_EXT_subgroup_size_control",
+                                          "VK_KHR_fragment_shading_rate",
+                                          "VK_AMD_shader_core_properties2",
+                                          "VK_AMD_device_coherent_memory",
+                                          "VK_KHR_shader_constant_data",
+                                          "VK_KHR_dynamic_rendering_local_read",
+                                          "VK_KHR_shader_abort",
+                                          "VK_EXT_shader_image_atomic_int64",
+                                          "VK_KHR_shader_quad_control",
+                                          "VK_KHR_spirv_1_4",
+                                          "VK_EXT_memory_budget",
+                                          "VK_EXT_memory_priority",
+                                          "VK_KHR_surface_protected_capabilities",
+                                          "VK_NV_dedicated_allocation_image_aliasing",
+                                          "VK_KHR_separate_depth_stencil_layouts",
+                                          "VK_EXT_buffer_device_address",
+                                          "VK_EXT_tooling_info",
+                                          "VK_EXT_separate_stencil_usage",
+                                          "VK_EXT_validation_features",
+                                          "VK_KHR_present_wait",
+                                          "VK_NV_cooperative_matrix",
+                                          "VK_NV_coverage_reduction_mode",
+                                          "VK_EXT_fragment_shader_interlock",
+                                          "VK_EXT_ycbcr_image_arrays",
+                                          "VK_KHR_uniform_buffer_standard_layout",
+                                          "VK_EXT_provoking_vertex",
+                                          "VK_EXT_full_screen_exclusive",
+                                          "VK_EXT_headless_surface",
+                                          "VK_KHR_buffer_device_address",
+                                          "VK_EXT_line_rasterization",
+                                          "VK_EXT_shader_atomic_float",
+                                          "VK_EXT_host_query_reset",
+                                          "VK_EXT_index_type_uint8",
+                                          "VK_EXT_extended_dynamic_state",
+                                          "VK_KHR_deferred_host_operations",
+                                          "VK_KHR_pipeline_executable_properties",
+                                          "VK_EXT_host_image_copy",
+                                          "VK_KHR_map_memory2",
+                                          "VK_EXT_map_memory_placed",
+                                          "VK_EXT_shader_atomic_float2",
+                                          "VK_EXT_surface_maintenance1",
+                                          "VK_EXT_swapchain_maintenance1",
+                                          "VK_EXT_shader_demote_to_helper_invocation",
+                                          "VK_NV_device_generated_commands",
+                                          "VK_NV_inherited_viewport_scissor",
+                                          "VK_KHR_shader_integer_dot_product",
+                                          "VK_EXT_texel_buffer_alignment",
+                                          "VK_QCOM_render_pass_transform",
+                                          "VK_EXT_depth_bias_control",
+                                          "VK_EXT_device_memory_report",
+                                          "VK_EXT_acquire_drm_display",
+                                          "VK_EXT_robustness2",
+                                          "VK_EXT_custom_border_color",
+                                          "VK_EXT_texture_compression_astc_3d",
+                                          "VK_GOOGLE_user_type",
+                                          "VK_KHR_pipeline_library",
+                                          "VK_NV_present_barrier",
+                                          "VK_KHR_shader_non_semantic_info",
+                                          "VK_KHR_present_id",
+                                          "VK_EXT_private_data",
+                                          "VK_EXT_pipeline_creation_cache_control",
+                                          "VK_KHR_video_encode_queue",
+                                          "VK_NV_device_diagnostics_config",
+                                          "VK_QCOM_render_pass_store_ops",
+                                          "VK_QCOM_queue_perf_hint",
+                                          "VK_QCOM_image_processing3",
+                                          "VK_QCOM_shader_multiple_wait_queues",
+                                          "VK_EXT_shader_split_barrier",
+                                          "VK_NV_cuda_kernel_launch",
+                                          "VK_QCOM_tile_shading",
+                                          "VK_NV_low_latency",
+                                          "VK_EXT_metal_objects",
+                                          "VK_KHR_synchronization2",
+                                          "VK_EXT_descriptor_buffer",
+                                          "VK_KHR_device_address_commands",
+                                          "VK_EXT_graphics_pipeline_library",
+                                          "VK_AMD_shader_early_and_late_fragment_tests",
+                                          "VK_KHR_fragment_shader_barycentric",
+                                          "VK_KHR_shader_subgroup_uniform_control_flow",
+                                          "VK_KHR_zero_initialize_workgroup_memory",
+                                          "VK_NV_fragment_shading_rate_enums",
+                                          "VK_NV_ray_tracing_motion_blur",
+                                          "VK_EXT_mesh_shader",
+                                          "VK_EXT_ycbcr_2plane_444_formats",
+                                          "VK_EXT_fragment_density_map2",
+                                          "VK_QCOM_rotated_copy_commands",
+                                          "VK_EXT_image_robustness",
+                                          "VK_KHR_workgroup_memory_explicit_layout",
+                                          "VK_KHR_copy_commands2",
+                                          "VK_EXT_image_compression_control",
+                                          "VK_EXT_attachment_feedback_loop_layout",
+                                          "VK_EXT_4444_formats",
+                                          "VK_EXT_device_fault",
+                                          "VK_ARM_rasterization_order_attachment_access",
+                                          "VK_EXT_rgba10x6_formats",
+                                          "VK_NV_acquire_winrt_display",
+                                          "VK_EXT_directfb_surface",
+                                          "VK_VALVE_mutable_descriptor_type",
+                                          "VK_EXT_vertex_input_dynamic_state",
+                                          "VK_EXT_physical_device_drm",
+                                          "VK_EXT_device_address_binding_report",
+                                          "VK_EXT_depth_clip_control",
+                                          "VK_EXT_primitive_topology_list_restart",
+                                          "VK_KHR_format_feature_flags2",
+                                          "VK_EXT_present_mode_fifo_latest_ready",
+                                          "VK_FUCHSIA_external_memory",
+                                          "VK_FUCHSIA_external_semaphore",
+                                          "VK_FUCHSIA_buffer_collection",
+                                          "VK_HUAWEI_subpass_shading",
+                                          "VK_HUAWEI_invocation_mask",
+                                          "VK_NV_external_memory_rdma",
+                                          "VK_EXT_pipeline_properties",
+                                          "VK_EXT_frame_boundary",
+                                          "VK_EXT_multisampled_render_to_single_sampled",
+                                          "VK_EXT_extended_dynamic_state2",
+                                          "VK_QNX_screen_surface",
+                                          "VK_EXT_color_write_enable",
+                                          "VK_EXT_primitives_generated_query",
+                                          "VK_KHR_ray_tracing_maintenance1",
+                                          "VK_KHR_shader_untyped_pointers",
+                                          "VK_EXT_global_priority_query",
+                                          "VK_VALVE_video_encode_rgb_conversion",
+                                          "VK_EXT_image_view_min_lod",
+                                          "VK_EXT_multi_draw",
+                                          "VK_EXT_image_2d_view_of_3d",
+                                          "VK_KHR_portability_enumeration",
+                                          "VK_EXT_shader_tile_image",
+                                          "VK_EXT_opacity_micromap",
+                                          "VK_NV_displacement_micromap",
+                                          "VK_EXT_load_store_op_none",
+                                          "VK_HUAWEI_cluster_culling_shader",
+                                          "VK_EXT_border_color_swizzle",
+                                          "VK_EXT_pageable_device_local_memory",
+                                          "VK_KHR_maintenance4",
+                                          "VK_ARM_shader_core_properties",
+                                          "VK_KHR_shader_subgroup_rotate",
+                                          "VK_ARM_scheduling_controls",
+                                          "VK_EXT_image_sliced_view_of_3d",
+                                          "VK_VALVE_descriptor_set_host_mapping",
+                                          "VK_EXT_depth_clamp_zero_one",
+                                          "VK_EXT_non_seamless_cube_map",
+                                          "VK_ARM_render_pass_striped",
+                                          "VK_QCOM_fragment_density_map_offset",
+                                          "VK_NV_copy_memory_indirect",
+                                          "VK_NV_memory_decompression",
+                                          "VK_NV_device_generated_commands_compute",
+                                          "VK_NV_ray_tracing_linear_swept_spheres",
+                                          "VK_NV_linear_color_attachment",
+                                          "VK_GOOGLE_surfaceless_query",
+                                          "VK_KHR_shader_maximal_reconvergence",
+                                          "VK_EXT_image_compression_control_swapchain",
+                                          "VK_QCOM_image_processing",
+                                          "VK_EXT_nested_command_buffer",
+                                          "VK_OHOS_external_memory",
+                                          "VK_EXT_external_memory_acquire_unmodified",
+                                          "VK_EXT_extended_dynamic_state3",
+                                          "VK_EXT_subpass_merge_feedback",
+                                          "VK_LUNARG_direct_driver_loading",
+                                          "VK_ARM_tensors",
+                                          "VK_EXT_shader_module_identifier",
+                                          "VK_EXT_rasterization_order_attachment_access",
+                                          "VK_NV_optical_flow",
+                                          "VK_EXT_legacy_dithering",
+                                          "VK_EXT_pipeline_protected_access",
+                                          "VK_ANDROID_external_format_resolve",
+                                          "VK_KHR_maintenance5",
+                                          "VK_AMD_anti_lag",
+                                          "VK_AMDX_dense_geometry_format",
+                                          "VK_KHR_present_id2",
+                                          "VK_KHR_present_wait2",
+                                          "VK_KHR_ray_tracing_position_fetch",
+                                          "VK_EXT_shader_object",
+                                          "VK_KHR_pipeline_binary",
+                                          "VK_QCOM_tile_properties",
+                                          "VK_SEC_amigo_profiling",
+                                          "VK_KHR_surface_maintenance1",
+                                          "VK_KHR_swapchain_maintenance1",
+                                          "VK_QCOM_multiview_per_view_viewports",
+                                          "VK_NV_ray_tracing_invocation_reorder",
+                                          "VK_NV_cooperative_vector",
+                                          "VK_NV_extended_sparse_address_space",
+                                          "VK_EXT_mutable_descriptor_type",
+                                          "VK_EXT_legacy_vertex_attributes",
+                                          "VK_EXT_layer_settings",
+                                          "VK_ARM_shader_core_builtins",
+                                          "VK_EXT_pipeline_library_group_handles",
+                                          "VK_EXT_dynamic_rendering_unused_attachments",
+                                          "VK_KHR_internally_synchronized_queues",
+                                          "VK_NV_low_latency2",
+                                          "VK_KHR_cooperative_matrix",
+                                          "VK_ARM_data_graph",
+                                          "VK_ARM_data_graph_instruction_set_tosa",
+                                          "VK_QCOM_multiview_per_view_render_areas",
+                                          "VK_KHR_compute_shader_derivatives",
+                                          "VK_KHR_video_decode_av1",
+                                          "VK_KHR_video_encode_av1",
+                                          "VK_KHR_video_decode_vp9",
+                                          "VK_KHR_video_maintenance1",
+                                          "VK_NV_per_stage_descriptor_set",
+                                          "VK_QCOM_image_processing2",
+                                          "VK_QCOM_filter_cubic_weights",
+                                          "VK_QCOM_ycbcr_degamma",
+                                          "VK_QCOM_filter_cubic_clamp",
+                                          "VK_EXT_attachment_feedback_loop_dynamic_state",
+                                          "VK_KHR_vertex_attribute_divisor",
+                                          "VK_KHR_load_store_op_none",
+                                          "VK_KHR_unified_image_layouts",
+                                          "VK_KHR_shader_float_controls2",
+                                          "VK_QNX_external_memory_screen_buffer",
+                                          "VK_MSFT_layered_driver",
+                                          "VK_KHR_index_type_uint8",
+                                          "VK_KHR_line_rasterization",
+                                          "VK_KHR_calibrated_timestamps",
+                                          "VK_KHR_shader_expect_assume",
+                                          "VK_KHR_maintenance6",
+                                          "VK_NV_descriptor_pool_overallocation",
+                                          "VK_QCOM_tile_memory_heap",
+                                          "VK_KHR_copy_memory_indirect",
+                                          "VK_EXT_memory_decompression",
+                                          "VK_NV_display_stereo",
+                                          "VK_KHR_video_encode_intra_refresh",
+                                          "VK_KHR_video_encode_quantization_map",
+                                          "VK_NV_raw_access_chains",
+                                          "VK_NV_external_compute_queue",
+                                          "VK_KHR_shader_relaxed_extended_instruction",
+                                          "VK_NV_command_buffer_inheritance",
+                                          "VK_KHR_maintenance7",
+                                          "VK_NV_shader_atomic_float16_vector",
+                                          "VK_EXT_shader_replicated_composites",
+                                          "VK_ARM_tensor_controls",
+                                          "VK_EXT_shader_float8",
+                                          "VK_NV_ray_tracing_validation",
+                                          "VK_NV_cluster_acceleration_structure",
+                                          "VK_NV_partitioned_acceleration_structure",
+                                          "VK_EXT_device_generated_commands",
+                                          "VK_KHR_device_fault",
+                                          "VK_KHR_maintenance8",
+                                          "VK_MESA_image_alignment_control",
+                                          "VK_KHR_shader_fma",
+                                          "VK_NV_push_constant_bank",
+                                          "VK_EXT_ray_tracing_invocation_reorder",
+                                          "VK_EXT_depth_clamp_control",
+                                          "VK_KHR_maintenance9",
+                                          "VK_KHR_video_maintenance2",
+                                          "VK_OHOS_surface",
+                                          "VK_HUAWEI_hdr_vivid",
+                                          "VK_NV_cooperative_matrix2",
+                                          "VK_ARM_pipeline_opacity_micromap",
+                                          "VK_KHR_video_encode_feedback2",
+                                          "VK_IMG_filter_linear_2d",
+                                          "VK_EXT_external_memory_metal",
+                                          "VK_KHR_depth_clamp_zero_one",
+                                          "VK_ARM_performance_counters_by_region",
+                                          "VK_ARM_shader_instrumentation",
+                                          "VK_EXT_vertex_attribute_robustness",
+                                          "VK_ARM_format_pack",
+                                          "VK_VALVE_fragment_density_map_layered",
+                                          "VK_KHR_robustness2",
+                                          "VK_NV_present_metering",
+                                          "VK_EXT_multisampled_render_to_swapchain",
+                                          "VK_EXT_fragment_density_map_offset",
+                                          "VK_EXT_zero_initialize_device_memory",
+                                          "VK_KHR_present_mode_fifo_latest_ready",
+                                          "VK_KHR_opacity_micromap",
+                                          "VK_EXT_shader_64bit_indexing",
+                                          "VK_EXT_custom_resolve",
+                                          "VK_QCOM_data_graph_model",
+                                          "VK_KHR_maintenance10",
+                                          "VK_ARM_data_graph_optical_flow",
+                                          "VK_EXT_shader_long_vector",
+                                          "VK_SEC_pipeline_cache_incremental_mode",
+                                          "VK_EXT_shader_uniform_buffer_unsized_array",
+                                          "VK_NV_compute_occupancy_priority",
+                                          "VK_KHR_maintenance11",
+                                          "VK_EXT_cooperative_matrix_maintenance1",
+                                          "VK_EXT_shader_subgroup_partitioned",
+                                          "VK_SEC_ubm_surface",
+                                          "VK_KHR_extended_flags",
+                                          "VK_EXT_shader_ocp_microscaling_types",
+                                          "VK_VALVE_shader_mixed_float_dot_product",
+                                          "VK_SEC_throttle_hint",
+                                          "VK_ARM_data_graph_neural_accelerator_statistics",
+                                          "VK_EXT_primitive_restart_index",
+                                          "VK_EXT_image_tiling_control",
+                                          "VK_NV_cooperative_matrix_decode_vector",
+                                          "" };
+    VULKAN_HPP_ASSERT( extension <= ExtensionId::eUnknown );
+    return names[static_cast<size_t>( extension )];
+  }
+
+  // the core api version an extension has been promoted to, or 0 if it has not been promoted to core
+  VULKAN_HPP_INLINE uint32_t getExtensionPromotedToApiVersion( ExtensionId extension ) VULKAN_HPP_NOEXCEPT
+  {
+    static uint32_t const apiVersions[] = { 0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_1,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_1,
+                                            VK_API_VERSION_1_1,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_1,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            VK_API_VERSION_1_4,
+                                            VK_API_VERSION_1_1,
+                                            VK_API_VERSION_1_1,
+                                            VK_API_VERSION_1_1,
+                                            VK_API_VERSION_1_1,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_1,
+                                            VK_API_VERSION_1_1,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_4,
+                                            0,
+                                            VK_API_VERSION_1_2,
+                                            VK_API_VERSION_1_1,
+                                            0,
+                                            VK_API_VERSION_1_1,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_2,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_1,
+                                            VK_API_VERSION_1_1,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_1,
+                                            0,
+                                            VK_API_VERSION_1_1,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_1,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_2,
+                                            VK_API_VERSION_1_1,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_1,
+                                            VK_API_VERSION_1_1,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_1,
+                                            VK_API_VERSION_1_1,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_2,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_1,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_2,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_4,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            VK_API_VERSION_1_2,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_4,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_2,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_4,
+                                            VK_API_VERSION_1_4,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_3,
+                                            0,
+                                            VK_API_VERSION_1_4,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_4,
+                                            0,
+                                            VK_API_VERSION_1_4,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_4,
+                                            VK_API_VERSION_1_4,
+                                            0,
+                                            VK_API_VERSION_1_4,
+                                            0,
+                                            0,
+                                            VK_API_VERSION_1_4,
+                                            VK_API_VERSION_1_4,
+                                            0,
+                                            VK_API_VERSION_1_4,
+                                            VK_API_VERSION_1_4,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0 };
+    VULKAN_HPP_ASSERT( extension <= ExtensionId::eUnknown );
+    return apiVersions[static_cast<size_t>( extension )];
+  }
+
+  // determines the set of extensions to enable, for using the requested extensions on the given api version with the available extensions;
+  // extensions promoted to a core version not exceeding apiVersion are never enabled, but considered to be always available
+  // returns false, with an empty set of enabled extensions, if any of the requested extensions can't be resolved
+  VULKAN_HPP_INLINE bool resolveExtensionDependencies( ExtensionSet const & requested,
+                                                       uint32_t             apiVersion,
+                                                       ExtensionSet const & available,
+                                                       ExtensionSet &       enabled ) VULKAN_HPP_NOEXCEPT
+  {
+    // ignore the patch version
+    apiVersion |= 0xFFF;
+
+    ExtensionSet resolved;
+    bool         success = true;
+    requested.forEach( [&]( ExtensionId extension ) { success = success && detail::resolveExtension( extension, apiVersion, available, resolved ); } );
+    enabled = success ? resolved : ExtensionSet();
+    return success;
+  }
 }  // namespace VULKAN_HPP_NAMESPACE
 
 #endif
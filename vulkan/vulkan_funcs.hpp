@@ -1705,7 +1705,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 #  endif
 
     Result result = static_cast<Result>( d.vkGetFenceStatus( static_cast<VkDevice>( m_device ), static_cast<VkFence>( fence ) ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getFenceStatus", { Result::eSuccess, Result::eNotReady } );
+    detail::resultCheck<Result::eSuccess, Result::eNotReady>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getFenceStatus" );
 
     return static_cast<Result>( result );
   }
@@ -1734,7 +1734,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
     Result result = static_cast<Result>( d.vkWaitForFences(
       static_cast<VkDevice>( m_device ), fences.size(), reinterpret_cast<VkFence const *>( fences.data() ), static_cast<VkBool32>( waitAll ), timeout ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::waitForFences", { Result::eSuccess, Result::eTimeout } );
+    detail::resultCheck<Result::eSuccess, Result::eTimeout>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::waitForFences" );
 
     return static_cast<Result>( result );
   }
@@ -1999,7 +1999,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                                     reinterpret_cast<void *>( data.data() ),
                                                                                                     static_cast<VkDeviceSize>( stride ),
                                                                                                     static_cast<VkQueryResultFlags>( flags ) ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getQueryPoolResults", { Result::eSuccess, Result::eNotReady } );
+    detail::resultCheck<Result::eSuccess, Result::eNotReady>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getQueryPoolResults" );
 
     return { result, data };
   }
@@ -2023,10 +2023,74 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                     reinterpret_cast<void *>( &data ),
                                                                     static_cast<VkDeviceSize>( stride ),
                                                                     static_cast<VkQueryResultFlags>( flags ) ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getQueryPoolResult", { Result::eSuccess, Result::eNotReady } );
+    detail::resultCheck<Result::eSuccess, Result::eNotReady>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getQueryPoolResult" );
 
     return { result, data };
   }
+
+  // wrapper function for command vkGetQueryPoolResults, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueryPoolResults.html
+  template <typename DataType, typename Dispatch, typename std::enable_if<IS_DISPATCHED( vkGetQueryPoolResults ), bool>::type>
+  VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE ResultValue<QueryResultView<DataType>>
+    Device::getQueryPoolResults( QueryPool                                 queryPool,
+                                 uint32_t                                  firstQuery,
+                                 uint32_t                                  queryCount,
+                                 ArrayProxyNoTemporaries<uint32_t> const & data,
+                                 QueryResultFlags                          flags,
+                                 Dispatch const &                          d ) const
+  {
+    VULKAN_HPP_ASSERT( d.getVkHeaderVersion() == VK_HEADER_VERSION );
+#  if ( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC == 1 )
+    VULKAN_HPP_ASSERT( d.vkGetQueryPoolResults && "Function <vkGetQueryPoolResults> requires <VK_VERSION_1_0>" );
+#  endif
+
+    // e64 follows from the storage, the stride from DataType and the availability or status word
+    flags &= ~QueryResultFlagBits::e64;
+    uint32_t stride = QueryResultView<DataType>::queryStride( flags );
+    VULKAN_HPP_ASSERT( queryCount * stride <= data.size() * sizeof( uint32_t ) );
+    Result result = static_cast<Result>( d.vkGetQueryPoolResults( static_cast<VkDevice>( m_device ),
+                                                                  static_cast<VkQueryPool>( queryPool ),
+                                                                  firstQuery,
+                                                                  queryCount,
+                                                                  data.size() * sizeof( uint32_t ),
+                                                                  reinterpret_cast<void *>( data.data() ),
+                                                                  static_cast<VkDeviceSize>( stride ),
+                                                                  static_cast<VkQueryResultFlags>( flags ) ) );
+    detail::resultCheck<Result::eSuccess, Result::eNotReady>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getQueryPoolResults" );
+
+    return { result, QueryResultView<DataType>( queryCount, reinterpret_cast<DataType const *>( data.data() ), flags ) };
+  }
+
+  // wrapper function for command vkGetQueryPoolResults, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueryPoolResults.html
+  template <typename DataType, typename Dispatch, typename std::enable_if<IS_DISPATCHED( vkGetQueryPoolResults ), bool>::type>
+  VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE ResultValue<QueryResultView<DataType>>
+    Device::getQueryPoolResults( QueryPool                                 queryPool,
+                                 uint32_t                                  firstQuery,
+                                 uint32_t                                  queryCount,
+                                 ArrayProxyNoTemporaries<uint64_t> const & data,
+                                 QueryResultFlags                          flags,
+                                 Dispatch const &                          d ) const
+  {
+    VULKAN_HPP_ASSERT( d.getVkHeaderVersion() == VK_HEADER_VERSION );
+#  if ( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC == 1 )
+    VULKAN_HPP_ASSERT( d.vkGetQueryPoolResults && "Function <vkGetQueryPoolResults> requires <VK_VERSION_1_0>" );
+#  endif
+
+    // e64 follows from the storage, the stride from DataType and the availability or status word
+    flags |= QueryResultFlagBits::e64;
+    uint32_t stride = QueryResultView<DataType>::queryStride( flags );
+    VULKAN_HPP_ASSERT( queryCount * stride <= data.size() * sizeof( uint64_t ) );
+    Result result = static_cast<Result>( d.vkGetQueryPoolResults( static_cast<VkDevice>( m_device ),
+                                                                  static_cast<VkQueryPool>( queryPool ),
+                                                                  firstQuery,
+                                                                  queryCount,
+                                                                  data.size() * sizeof( uint64_t ),
+                                                                  reinterpret_cast<void *>( data.data() ),
+                                                                  static_cast<VkDeviceSize>( stride ),
+                                                                  static_cast<VkQueryResultFlags>( flags ) ) );
+    detail::resultCheck<Result::eSuccess, Result::eNotReady>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getQueryPoolResults" );
+
+    return { result, QueryResultView<DataType>( queryCount, reinterpret_cast<DataType const *>( data.data() ), flags ) };
+  }
 #endif /* VULKAN_HPP_DISABLE_ENHANCED_MODE */
 
   // wrapper function for command vkCreateBuffer, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateBuffer.html
@@ -3207,7 +3271,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 #  endif
 
     Result result = static_cast<Result>( d.vkGetEventStatus( static_cast<VkDevice>( m_device ), static_cast<VkEvent>( event ) ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getEventStatus", { Result::eEventSet, Result::eEventReset } );
+    detail::resultCheck<Result::eEventSet, Result::eEventReset>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getEventStatus" );
 
     return static_cast<Result>( result );
   }
@@ -3744,13 +3808,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                      reinterpret_cast<VkComputePipelineCreateInfo const *>( createInfos.data() ),
                                                                      reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                      reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createComputePipelines",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createComputePipelines", m_device, pipelines, allocator.get(), d );
 
     return { result, pipelines };
   }
@@ -3779,13 +3838,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                      reinterpret_cast<VkComputePipelineCreateInfo const *>( createInfos.data() ),
                                                                      reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                      reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createComputePipelines",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createComputePipelines", m_device, pipelines, allocator.get(), d );
 
     return { result, pipelines };
   }
@@ -3807,7 +3861,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                        reinterpret_cast<VkComputePipelineCreateInfo const *>( &createInfo ),
                                                                        reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                        reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createComputePipeline", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createComputePipeline" );
 
     return { result, pipeline };
   }
@@ -3836,13 +3890,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                     reinterpret_cast<VkComputePipelineCreateInfo const *>( createInfos.data() ),
                                                                                     reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                                     reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createComputePipelinesUnique",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createComputePipelinesUnique", m_device, pipelines, allocator.get(), d );
     std::vector<UniqueHandle<Pipeline, Dispatch>, PipelineAllocator> uniquePipelines;
     uniquePipelines.reserve( createInfos.size() );
     detail::ObjectDestroy<Device, Dispatch> deleter( *this, allocator, d );
@@ -3877,13 +3926,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                     reinterpret_cast<VkComputePipelineCreateInfo const *>( createInfos.data() ),
                                                                                     reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                                     reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createComputePipelinesUnique",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createComputePipelinesUnique", m_device, pipelines, allocator.get(), d );
     std::vector<UniqueHandle<Pipeline, Dispatch>, PipelineAllocator> uniquePipelines( pipelineAllocator );
     uniquePipelines.reserve( createInfos.size() );
     detail::ObjectDestroy<Device, Dispatch> deleter( *this, allocator, d );
@@ -3911,8 +3955,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                        reinterpret_cast<VkComputePipelineCreateInfo const *>( &createInfo ),
                                                                        reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                        reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createComputePipelineUnique", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createComputePipelineUnique" );
 
     return ResultValue<UniqueHandle<Pipeline, Dispatch>>(
       result, UniqueHandle<Pipeline, Dispatch>( pipeline, detail::ObjectDestroy<Device, Dispatch>( *this, allocator, d ) ) );
@@ -4911,13 +4954,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                       reinterpret_cast<VkGraphicsPipelineCreateInfo const *>( createInfos.data() ),
                                                                       reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                       reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createGraphicsPipelines",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createGraphicsPipelines", m_device, pipelines, allocator.get(), d );
 
     return { result, pipelines };
   }
@@ -4946,13 +4984,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                       reinterpret_cast<VkGraphicsPipelineCreateInfo const *>( createInfos.data() ),
                                                                       reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                       reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createGraphicsPipelines",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createGraphicsPipelines", m_device, pipelines, allocator.get(), d );
 
     return { result, pipelines };
   }
@@ -4974,7 +5007,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                         reinterpret_cast<VkGraphicsPipelineCreateInfo const *>( &createInfo ),
                                                                         reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                         reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createGraphicsPipeline", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createGraphicsPipeline" );
 
     return { result, pipeline };
   }
@@ -5003,13 +5036,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                       reinterpret_cast<VkGraphicsPipelineCreateInfo const *>( createInfos.data() ),
                                                                       reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                       reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createGraphicsPipelinesUnique",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createGraphicsPipelinesUnique", m_device, pipelines, allocator.get(), d );
     std::vector<UniqueHandle<Pipeline, Dispatch>, PipelineAllocator> uniquePipelines;
     uniquePipelines.reserve( createInfos.size() );
     detail::ObjectDestroy<Device, Dispatch> deleter( *this, allocator, d );
@@ -5044,13 +5072,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                       reinterpret_cast<VkGraphicsPipelineCreateInfo const *>( createInfos.data() ),
                                                                       reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                       reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createGraphicsPipelinesUnique",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createGraphicsPipelinesUnique", m_device, pipelines, allocator.get(), d );
     std::vector<UniqueHandle<Pipeline, Dispatch>, PipelineAllocator> uniquePipelines( pipelineAllocator );
     uniquePipelines.reserve( createInfos.size() );
     detail::ObjectDestroy<Device, Dispatch> deleter( *this, allocator, d );
@@ -5078,8 +5101,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                         reinterpret_cast<VkGraphicsPipelineCreateInfo const *>( &createInfo ),
                                                                         reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                         reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createGraphicsPipelineUnique", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createGraphicsPipelineUnique" );
 
     return ResultValue<UniqueHandle<Pipeline, Dispatch>>(
       result, UniqueHandle<Pipeline, Dispatch>( pipeline, detail::ObjectDestroy<Device, Dispatch>( *this, allocator, d ) ) );
@@ -7217,7 +7239,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
     Result result =
       static_cast<Result>( d.vkWaitSemaphores( static_cast<VkDevice>( m_device ), reinterpret_cast<VkSemaphoreWaitInfo const *>( &waitInfo ), timeout ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::waitSemaphores", { Result::eSuccess, Result::eTimeout } );
+    detail::resultCheck<Result::eSuccess, Result::eTimeout>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::waitSemaphores" );
 
     return static_cast<Result>( result );
   }
@@ -9575,12 +9597,11 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                     &imageIndex ) );
 
 #  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::acquireNextImageKHR",
-                         { Result::eSuccess, Result::eTimeout, Result::eNotReady, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eTimeout, Result::eNotReady, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::acquireNextImageKHR" );
 #  else
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::acquireNextImageKHR", { Result::eSuccess, Result::eTimeout, Result::eNotReady, Result::eSuboptimalKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eTimeout, Result::eNotReady, Result::eSuboptimalKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::acquireNextImageKHR" );
 #  endif
 
     return { result, imageIndex };
@@ -9608,9 +9629,9 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     Result result = static_cast<Result>( d.vkQueuePresentKHR( static_cast<VkQueue>( m_queue ), reinterpret_cast<VkPresentInfoKHR const *>( &presentInfo ) ) );
 
 #  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Queue::presentKHR", { Result::eSuccess, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR>( result, VULKAN_HPP_NAMESPACE_STRING "::Queue::presentKHR" );
 #  else
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Queue::presentKHR", { Result::eSuccess, Result::eSuboptimalKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eSuboptimalKHR>( result, VULKAN_HPP_NAMESPACE_STRING "::Queue::presentKHR" );
 #  endif
 
     return static_cast<Result>( result );
@@ -9798,12 +9819,11 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       d.vkAcquireNextImage2KHR( static_cast<VkDevice>( m_device ), reinterpret_cast<VkAcquireNextImageInfoKHR const *>( &acquireInfo ), &imageIndex ) );
 
 #  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::acquireNextImage2KHR",
-                         { Result::eSuccess, Result::eTimeout, Result::eNotReady, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eTimeout, Result::eNotReady, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::acquireNextImage2KHR" );
 #  else
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::acquireNextImage2KHR", { Result::eSuccess, Result::eTimeout, Result::eNotReady, Result::eSuboptimalKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eTimeout, Result::eNotReady, Result::eSuboptimalKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::acquireNextImage2KHR" );
 #  endif
 
     return { result, imageIndex };
@@ -14518,7 +14538,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       static_cast<VkDevice>( m_device ), static_cast<VkSwapchainKHR>( swapchain ), static_cast<VkSurfaceCounterFlagBitsEXT>( counter ), &counterValue ) );
 
 #  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getSwapchainCounterEXT", { Result::eSuccess, Result::eErrorOutOfDateKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eErrorOutOfDateKHR>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getSwapchainCounterEXT" );
 #  else
     detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getSwapchainCounterEXT" );
 #  endif
@@ -14619,8 +14639,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     } while ( result == Result::eIncomplete );
 
 #  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::getPastPresentationTimingGOOGLE", { Result::eSuccess, Result::eIncomplete, Result::eErrorOutOfDateKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eIncomplete, Result::eErrorOutOfDateKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::getPastPresentationTimingGOOGLE" );
 #  else
     detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getPastPresentationTimingGOOGLE" );
 #  endif
@@ -14676,8 +14696,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     } while ( result == Result::eIncomplete );
 
 #  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::getPastPresentationTimingGOOGLE", { Result::eSuccess, Result::eIncomplete, Result::eErrorOutOfDateKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eIncomplete, Result::eErrorOutOfDateKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::getPastPresentationTimingGOOGLE" );
 #  else
     detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getPastPresentationTimingGOOGLE" );
 #  endif
@@ -14945,10 +14965,10 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     Result result = static_cast<Result>( d.vkGetSwapchainStatusKHR( static_cast<VkDevice>( m_device ), static_cast<VkSwapchainKHR>( swapchain ) ) );
 
 #  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::getSwapchainStatusKHR", { Result::eSuccess, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::getSwapchainStatusKHR" );
 #  else
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getSwapchainStatusKHR", { Result::eSuccess, Result::eSuboptimalKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eSuboptimalKHR>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getSwapchainStatusKHR" );
 #  endif
 
     return static_cast<Result>( result );
@@ -17026,13 +17046,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                   reinterpret_cast<VkExecutionGraphPipelineCreateInfoAMDX const *>( createInfos.data() ),
                                                                   reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                   reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createExecutionGraphPipelinesAMDX",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createExecutionGraphPipelinesAMDX", m_device, pipelines, allocator.get(), d );
 
     return { result, pipelines };
   }
@@ -17063,13 +17078,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                   reinterpret_cast<VkExecutionGraphPipelineCreateInfoAMDX const *>( createInfos.data() ),
                                                                   reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                   reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createExecutionGraphPipelinesAMDX",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createExecutionGraphPipelinesAMDX", m_device, pipelines, allocator.get(), d );
 
     return { result, pipelines };
   }
@@ -17093,8 +17103,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                 reinterpret_cast<VkExecutionGraphPipelineCreateInfoAMDX const *>( &createInfo ),
                                                                                 reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                                 reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createExecutionGraphPipelineAMDX", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createExecutionGraphPipelineAMDX" );
 
     return { result, pipeline };
   }
@@ -17125,13 +17135,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                   reinterpret_cast<VkExecutionGraphPipelineCreateInfoAMDX const *>( createInfos.data() ),
                                                                   reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                   reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createExecutionGraphPipelinesAMDXUnique",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createExecutionGraphPipelinesAMDXUnique", m_device, pipelines, allocator.get(), d );
     std::vector<UniqueHandle<Pipeline, Dispatch>, PipelineAllocator> uniquePipelines;
     uniquePipelines.reserve( createInfos.size() );
     detail::ObjectDestroy<Device, Dispatch> deleter( *this, allocator, d );
@@ -17168,13 +17173,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                   reinterpret_cast<VkExecutionGraphPipelineCreateInfoAMDX const *>( createInfos.data() ),
                                                                   reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                   reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createExecutionGraphPipelinesAMDXUnique",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createExecutionGraphPipelinesAMDXUnique", m_device, pipelines, allocator.get(), d );
     std::vector<UniqueHandle<Pipeline, Dispatch>, PipelineAllocator> uniquePipelines( pipelineAllocator );
     uniquePipelines.reserve( createInfos.size() );
     detail::ObjectDestroy<Device, Dispatch> deleter( *this, allocator, d );
@@ -17204,8 +17204,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                 reinterpret_cast<VkExecutionGraphPipelineCreateInfoAMDX const *>( &createInfo ),
                                                                                 reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                                 reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createExecutionGraphPipelineAMDXUnique", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createExecutionGraphPipelineAMDXUnique" );
 
     return ResultValue<UniqueHandle<Pipeline, Dispatch>>(
       result, UniqueHandle<Pipeline, Dispatch>( pipeline, detail::ObjectDestroy<Device, Dispatch>( *this, allocator, d ) ) );
@@ -18145,9 +18145,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                           infos.size(),
                                           reinterpret_cast<VkAccelerationStructureBuildGeometryInfoKHR const *>( infos.data() ),
                                           reinterpret_cast<VkAccelerationStructureBuildRangeInfoKHR const * const *>( pBuildRangeInfos.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::buildAccelerationStructuresKHR",
-                         { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::buildAccelerationStructuresKHR" );
 
     return static_cast<Result>( result );
   }
@@ -18180,9 +18179,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     Result result = static_cast<Result>( d.vkCopyAccelerationStructureKHR( static_cast<VkDevice>( m_device ),
                                                                            static_cast<VkDeferredOperationKHR>( deferredOperation ),
                                                                            reinterpret_cast<VkCopyAccelerationStructureInfoKHR const *>( &info ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::copyAccelerationStructureKHR",
-                         { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::copyAccelerationStructureKHR" );
 
     return static_cast<Result>( result );
   }
@@ -18217,9 +18215,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       static_cast<Result>( d.vkCopyAccelerationStructureToMemoryKHR( static_cast<VkDevice>( m_device ),
                                                                      static_cast<VkDeferredOperationKHR>( deferredOperation ),
                                                                      reinterpret_cast<VkCopyAccelerationStructureToMemoryInfoKHR const *>( &info ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::copyAccelerationStructureToMemoryKHR",
-                         { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::copyAccelerationStructureToMemoryKHR" );
 
     return static_cast<Result>( result );
   }
@@ -18254,9 +18251,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       static_cast<Result>( d.vkCopyMemoryToAccelerationStructureKHR( static_cast<VkDevice>( m_device ),
                                                                      static_cast<VkDeferredOperationKHR>( deferredOperation ),
                                                                      reinterpret_cast<VkCopyMemoryToAccelerationStructureInfoKHR const *>( &info ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::copyMemoryToAccelerationStructureKHR",
-                         { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::copyMemoryToAccelerationStructureKHR" );
 
     return static_cast<Result>( result );
   }
@@ -18691,13 +18687,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                            reinterpret_cast<VkRayTracingPipelineCreateInfoKHR const *>( createInfos.data() ),
                                                                            reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                            reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelinesKHR",
-                         { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelinesKHR", m_device, pipelines, allocator.get(), d );
 
     return { result, pipelines };
   }
@@ -18729,13 +18720,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                            reinterpret_cast<VkRayTracingPipelineCreateInfoKHR const *>( createInfos.data() ),
                                                                            reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                            reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelinesKHR",
-                         { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelinesKHR", m_device, pipelines, allocator.get(), d );
 
     return { result, pipelines };
   }
@@ -18762,9 +18748,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                              reinterpret_cast<VkRayTracingPipelineCreateInfoKHR const *>( &createInfo ),
                                                                              reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                              reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelineKHR",
-                         { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT } );
+    detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelineKHR" );
 
     return { result, pipeline };
   }
@@ -18796,13 +18781,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                            reinterpret_cast<VkRayTracingPipelineCreateInfoKHR const *>( createInfos.data() ),
                                                                            reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                            reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelinesKHRUnique",
-                         { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelinesKHRUnique", m_device, pipelines, allocator.get(), d );
     std::vector<UniqueHandle<Pipeline, Dispatch>, PipelineAllocator> uniquePipelines;
     uniquePipelines.reserve( createInfos.size() );
     detail::ObjectDestroy<Device, Dispatch> deleter( *this, allocator, d );
@@ -18840,13 +18820,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                            reinterpret_cast<VkRayTracingPipelineCreateInfoKHR const *>( createInfos.data() ),
                                                                            reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                            reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelinesKHRUnique",
-                         { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelinesKHRUnique", m_device, pipelines, allocator.get(), d );
     std::vector<UniqueHandle<Pipeline, Dispatch>, PipelineAllocator> uniquePipelines( pipelineAllocator );
     uniquePipelines.reserve( createInfos.size() );
     detail::ObjectDestroy<Device, Dispatch> deleter( *this, allocator, d );
@@ -18880,9 +18855,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                              reinterpret_cast<VkRayTracingPipelineCreateInfoKHR const *>( &createInfo ),
                                                                              reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                              reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelineKHRUnique",
-                         { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT } );
+    detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelineKHRUnique" );
 
     return ResultValue<UniqueHandle<Pipeline, Dispatch>>(
       result, UniqueHandle<Pipeline, Dispatch>( pipeline, detail::ObjectDestroy<Device, Dispatch>( *this, allocator, d ) ) );
@@ -19938,13 +19912,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                           reinterpret_cast<VkRayTracingPipelineCreateInfoNV const *>( createInfos.data() ),
                                                                           reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                           reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelinesNV",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelinesNV", m_device, pipelines, allocator.get(), d );
 
     return { result, pipelines };
   }
@@ -19974,13 +19943,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                           reinterpret_cast<VkRayTracingPipelineCreateInfoNV const *>( createInfos.data() ),
                                                                           reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                           reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelinesNV",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelinesNV", m_device, pipelines, allocator.get(), d );
 
     return { result, pipelines };
   }
@@ -20003,8 +19967,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                             reinterpret_cast<VkRayTracingPipelineCreateInfoNV const *>( &createInfo ),
                                                                             reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                             reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelineNV", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelineNV" );
 
     return { result, pipeline };
   }
@@ -20034,13 +19997,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                           reinterpret_cast<VkRayTracingPipelineCreateInfoNV const *>( createInfos.data() ),
                                                                           reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                           reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelinesNVUnique",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelinesNVUnique", m_device, pipelines, allocator.get(), d );
     std::vector<UniqueHandle<Pipeline, Dispatch>, PipelineAllocator> uniquePipelines;
     uniquePipelines.reserve( createInfos.size() );
     detail::ObjectDestroy<Device, Dispatch> deleter( *this, allocator, d );
@@ -20076,13 +20034,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                           reinterpret_cast<VkRayTracingPipelineCreateInfoNV const *>( createInfos.data() ),
                                                                           reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                           reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelinesNVUnique",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelinesNVUnique", m_device, pipelines, allocator.get(), d );
     std::vector<UniqueHandle<Pipeline, Dispatch>, PipelineAllocator> uniquePipelines( pipelineAllocator );
     uniquePipelines.reserve( createInfos.size() );
     detail::ObjectDestroy<Device, Dispatch> deleter( *this, allocator, d );
@@ -20111,8 +20064,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                             reinterpret_cast<VkRayTracingPipelineCreateInfoNV const *>( &createInfo ),
                                                                             reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                             reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelineNVUnique", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createRayTracingPipelineNVUnique" );
 
     return ResultValue<UniqueHandle<Pipeline, Dispatch>>(
       result, UniqueHandle<Pipeline, Dispatch>( pipeline, detail::ObjectDestroy<Device, Dispatch>( *this, allocator, d ) ) );
@@ -20962,7 +20915,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
     Result result =
       static_cast<Result>( d.vkWaitSemaphoresKHR( static_cast<VkDevice>( m_device ), reinterpret_cast<VkSemaphoreWaitInfo const *>( &waitInfo ), timeout ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::waitSemaphoresKHR", { Result::eSuccess, Result::eTimeout } );
+    detail::resultCheck<Result::eSuccess, Result::eTimeout>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::waitSemaphoresKHR" );
 
     return static_cast<Result>( result );
   }
@@ -21022,7 +20975,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
     Result result =
       static_cast<Result>( d.vkSetSwapchainPresentTimingQueueSizeEXT( static_cast<VkDevice>( m_device ), static_cast<VkSwapchainKHR>( swapchain ), size ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::setSwapchainPresentTimingQueueSizeEXT", { Result::eSuccess, Result::eNotReady } );
+    detail::resultCheck<Result::eSuccess, Result::eNotReady>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::setSwapchainPresentTimingQueueSizeEXT" );
 
     return static_cast<Result>( result );
   }
@@ -21061,7 +21014,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                               static_cast<VkSwapchainKHR>( swapchain ),
                                                                               reinterpret_cast<VkSwapchainTimingPropertiesEXT *>( &swapchainTimingProperties ),
                                                                               &swapchainTimingPropertiesCounter ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getSwapchainTimingPropertiesEXT", { Result::eSuccess, Result::eNotReady } );
+    detail::resultCheck<Result::eSuccess, Result::eNotReady>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getSwapchainTimingPropertiesEXT" );
 
     return { result, data_ };
   }
@@ -21890,11 +21843,10 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       static_cast<Result>( d.vkWaitForPresentKHR( static_cast<VkDevice>( m_device ), static_cast<VkSwapchainKHR>( swapchain ), presentId, timeout ) );
 
 #  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::waitForPresentKHR",
-                         { Result::eSuccess, Result::eTimeout, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eTimeout, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::waitForPresentKHR" );
 #  else
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::waitForPresentKHR", { Result::eSuccess, Result::eTimeout, Result::eSuboptimalKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eTimeout, Result::eSuboptimalKHR>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::waitForPresentKHR" );
 #  endif
 
     return static_cast<Result>( result );
@@ -22798,7 +22750,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
     Result result =
       static_cast<Result>( d.vkGetDeferredOperationResultKHR( static_cast<VkDevice>( m_device ), static_cast<VkDeferredOperationKHR>( operation ) ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getDeferredOperationResultKHR", { Result::eSuccess, Result::eNotReady } );
+    detail::resultCheck<Result::eSuccess, Result::eNotReady>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getDeferredOperationResultKHR" );
 
     return static_cast<Result>( result );
   }
@@ -22823,8 +22775,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 #  endif
 
     Result result = static_cast<Result>( d.vkDeferredOperationJoinKHR( static_cast<VkDevice>( m_device ), static_cast<VkDeferredOperationKHR>( operation ) ) );
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::deferredOperationJoinKHR", { Result::eSuccess, Result::eThreadDoneKHR, Result::eThreadIdleKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eThreadDoneKHR, Result::eThreadIdleKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::deferredOperationJoinKHR" );
 
     return static_cast<Result>( result );
   }
@@ -27162,9 +27114,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                 static_cast<VkDeferredOperationKHR>( deferredOperation ),
                                                                 infos.size(),
                                                                 reinterpret_cast<VkMicromapBuildInfoEXT const *>( infos.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::buildMicromapsEXT",
-                         { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::buildMicromapsEXT" );
 
     return static_cast<Result>( result );
   }
@@ -27193,8 +27144,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
     Result result = static_cast<Result>( d.vkCopyMicromapEXT(
       static_cast<VkDevice>( m_device ), static_cast<VkDeferredOperationKHR>( deferredOperation ), reinterpret_cast<VkCopyMicromapInfoEXT const *>( &info ) ) );
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::copyMicromapEXT", { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::copyMicromapEXT" );
 
     return static_cast<Result>( result );
   }
@@ -27225,9 +27176,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     Result result = static_cast<Result>( d.vkCopyMicromapToMemoryEXT( static_cast<VkDevice>( m_device ),
                                                                       static_cast<VkDeferredOperationKHR>( deferredOperation ),
                                                                       reinterpret_cast<VkCopyMicromapToMemoryInfoEXT const *>( &info ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::copyMicromapToMemoryEXT",
-                         { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::copyMicromapToMemoryEXT" );
 
     return static_cast<Result>( result );
   }
@@ -27258,9 +27208,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     Result result = static_cast<Result>( d.vkCopyMemoryToMicromapEXT( static_cast<VkDevice>( m_device ),
                                                                       static_cast<VkDeferredOperationKHR>( deferredOperation ),
                                                                       reinterpret_cast<VkCopyMemoryToMicromapInfoEXT const *>( &info ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::copyMemoryToMicromapEXT",
-                         { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::copyMemoryToMicromapEXT" );
 
     return static_cast<Result>( result );
   }
@@ -29616,11 +29565,10 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       static_cast<VkDevice>( m_device ), static_cast<VkSwapchainKHR>( swapchain ), reinterpret_cast<VkPresentWait2InfoKHR const *>( &presentWait2Info ) ) );
 
 #  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::waitForPresent2KHR",
-                         { Result::eSuccess, Result::eTimeout, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eTimeout, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::waitForPresent2KHR" );
 #  else
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::waitForPresent2KHR", { Result::eSuccess, Result::eTimeout, Result::eSuboptimalKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eTimeout, Result::eSuboptimalKHR>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::waitForPresent2KHR" );
 #  endif
 
     return static_cast<Result>( result );
@@ -29663,7 +29611,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                reinterpret_cast<VkShaderCreateInfoEXT const *>( createInfos.data() ),
                                                                reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                reinterpret_cast<VkShaderEXT *>( shaders.data() ) ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createShadersEXT", { Result::eSuccess, Result::eIncompatibleShaderBinaryEXT } );
+    detail::resultCheck<Result::eSuccess, Result::eIncompatibleShaderBinaryEXT>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createShadersEXT" );
 
     return { result, shaders };
   }
@@ -29690,7 +29638,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                reinterpret_cast<VkShaderCreateInfoEXT const *>( createInfos.data() ),
                                                                reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                reinterpret_cast<VkShaderEXT *>( shaders.data() ) ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createShadersEXT", { Result::eSuccess, Result::eIncompatibleShaderBinaryEXT } );
+    detail::resultCheck<Result::eSuccess, Result::eIncompatibleShaderBinaryEXT>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createShadersEXT" );
 
     return { result, shaders };
   }
@@ -29711,7 +29659,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                   reinterpret_cast<VkShaderCreateInfoEXT const *>( &createInfo ),
                                                                   reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                   reinterpret_cast<VkShaderEXT *>( &shader ) ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createShaderEXT", { Result::eSuccess, Result::eIncompatibleShaderBinaryEXT } );
+    detail::resultCheck<Result::eSuccess, Result::eIncompatibleShaderBinaryEXT>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createShaderEXT" );
 
     return { result, shader };
   }
@@ -29736,7 +29684,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                reinterpret_cast<VkShaderCreateInfoEXT const *>( createInfos.data() ),
                                                                                reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                                reinterpret_cast<VkShaderEXT *>( shaders.data() ) ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createShadersEXTUnique", { Result::eSuccess, Result::eIncompatibleShaderBinaryEXT } );
+    detail::resultCheck<Result::eSuccess, Result::eIncompatibleShaderBinaryEXT>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createShadersEXTUnique" );
     std::vector<UniqueHandle<ShaderEXT, Dispatch>, ShaderEXTAllocator> uniqueShaders;
     uniqueShaders.reserve( createInfos.size() );
     detail::ObjectDestroy<Device, Dispatch> deleter( *this, allocator, d );
@@ -29769,7 +29717,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                reinterpret_cast<VkShaderCreateInfoEXT const *>( createInfos.data() ),
                                                                                reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                                reinterpret_cast<VkShaderEXT *>( shaders.data() ) ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createShadersEXTUnique", { Result::eSuccess, Result::eIncompatibleShaderBinaryEXT } );
+    detail::resultCheck<Result::eSuccess, Result::eIncompatibleShaderBinaryEXT>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createShadersEXTUnique" );
     std::vector<UniqueHandle<ShaderEXT, Dispatch>, ShaderEXTAllocator> uniqueShaders( shaderEXTAllocator );
     uniqueShaders.reserve( createInfos.size() );
     detail::ObjectDestroy<Device, Dispatch> deleter( *this, allocator, d );
@@ -29796,7 +29744,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                   reinterpret_cast<VkShaderCreateInfoEXT const *>( &createInfo ),
                                                                   reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                   reinterpret_cast<VkShaderEXT *>( &shader ) ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createShaderEXTUnique", { Result::eSuccess, Result::eIncompatibleShaderBinaryEXT } );
+    detail::resultCheck<Result::eSuccess, Result::eIncompatibleShaderBinaryEXT>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createShaderEXTUnique" );
 
     return ResultValue<UniqueHandle<ShaderEXT, Dispatch>>(
       result, UniqueHandle<ShaderEXT, Dispatch>( shader, detail::ObjectDestroy<Device, Dispatch>( *this, allocator, d ) ) );
@@ -30063,8 +30011,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       }
     }
 
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createPipelineBinariesKHR", { Result::eSuccess, Result::eIncomplete, Result::ePipelineBinaryMissingKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eIncomplete, Result::ePipelineBinaryMissingKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createPipelineBinariesKHR" );
 
     return { result, pipelineBinaries };
   }
@@ -30117,8 +30065,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       }
     }
 
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createPipelineBinariesKHR", { Result::eSuccess, Result::eIncomplete, Result::ePipelineBinaryMissingKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eIncomplete, Result::ePipelineBinaryMissingKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createPipelineBinariesKHR" );
 
     return { result, pipelineBinaries };
   }
@@ -30170,9 +30118,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       }
     }
 
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createPipelineBinariesKHRUnique",
-                         { Result::eSuccess, Result::eIncomplete, Result::ePipelineBinaryMissingKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eIncomplete, Result::ePipelineBinaryMissingKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createPipelineBinariesKHRUnique" );
     std::vector<UniqueHandle<PipelineBinaryKHR, Dispatch>, PipelineBinaryKHRAllocator> uniquePipelineBinaries;
     uniquePipelineBinaries.reserve( pipelineBinaries.size() );
     detail::ObjectDestroy<Device, Dispatch> deleter( *this, allocator, d );
@@ -30231,9 +30178,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       }
     }
 
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createPipelineBinariesKHRUnique",
-                         { Result::eSuccess, Result::eIncomplete, Result::ePipelineBinaryMissingKHR } );
+    detail::resultCheck<Result::eSuccess, Result::eIncomplete, Result::ePipelineBinaryMissingKHR>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createPipelineBinariesKHRUnique" );
     std::vector<UniqueHandle<PipelineBinaryKHR, Dispatch>, PipelineBinaryKHRAllocator> uniquePipelineBinaries( pipelineBinaryKHRAllocator );
     uniquePipelineBinaries.reserve( pipelineBinaries.size() );
     detail::ObjectDestroy<Device, Dispatch> deleter( *this, allocator, d );
@@ -30737,7 +30683,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
     Result result = static_cast<Result>(
       d.vkConvertCooperativeVectorMatrixNV( static_cast<VkDevice>( m_device ), reinterpret_cast<VkConvertCooperativeVectorMatrixInfoNV const *>( &info ) ) );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::convertCooperativeVectorMatrixNV", { Result::eSuccess, Result::eIncomplete } );
+    detail::resultCheck<Result::eSuccess, Result::eIncomplete>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::convertCooperativeVectorMatrixNV" );
 
     return static_cast<Result>( result );
   }
@@ -31033,13 +30979,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                           reinterpret_cast<VkDataGraphPipelineCreateInfoARM const *>( createInfos.data() ),
                                                                           reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                           reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createDataGraphPipelinesARM",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createDataGraphPipelinesARM", m_device, pipelines, allocator.get(), d );
 
     return { result, pipelines };
   }
@@ -31071,13 +31012,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                           reinterpret_cast<VkDataGraphPipelineCreateInfoARM const *>( createInfos.data() ),
                                                                           reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                           reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createDataGraphPipelinesARM",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createDataGraphPipelinesARM", m_device, pipelines, allocator.get(), d );
 
     return { result, pipelines };
   }
@@ -31104,8 +31040,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                             reinterpret_cast<VkDataGraphPipelineCreateInfoARM const *>( &createInfo ),
                                                                             reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                             reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createDataGraphPipelineARM", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::createDataGraphPipelineARM" );
 
     return { result, pipeline };
   }
@@ -31137,13 +31072,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                           reinterpret_cast<VkDataGraphPipelineCreateInfoARM const *>( createInfos.data() ),
                                                                           reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                           reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createDataGraphPipelinesARMUnique",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createDataGraphPipelinesARMUnique", m_device, pipelines, allocator.get(), d );
     std::vector<UniqueHandle<Pipeline, Dispatch>, PipelineAllocator> uniquePipelines;
     uniquePipelines.reserve( createInfos.size() );
     detail::ObjectDestroy<Device, Dispatch> deleter( *this, allocator, d );
@@ -31181,13 +31111,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                           reinterpret_cast<VkDataGraphPipelineCreateInfoARM const *>( createInfos.data() ),
                                                                           reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                           reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-    detail::resultCheck( result,
-                         VULKAN_HPP_NAMESPACE_STRING "::Device::createDataGraphPipelinesARMUnique",
-                         { Result::eSuccess, Result::ePipelineCompileRequiredEXT },
-                         m_device,
-                         pipelines,
-                         allocator.get(),
-                         d );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createDataGraphPipelinesARMUnique", m_device, pipelines, allocator.get(), d );
     std::vector<UniqueHandle<Pipeline, Dispatch>, PipelineAllocator> uniquePipelines( pipelineAllocator );
     uniquePipelines.reserve( createInfos.size() );
     detail::ObjectDestroy<Device, Dispatch> deleter( *this, allocator, d );
@@ -31221,8 +31146,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                             reinterpret_cast<VkDataGraphPipelineCreateInfoARM const *>( &createInfo ),
                                                                             reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                             reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-    detail::resultCheck(
-      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createDataGraphPipelineARMUnique", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+    detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+      result, VULKAN_HPP_NAMESPACE_STRING "::Device::createDataGraphPipelineARMUnique" );
 
     return ResultValue<UniqueHandle<Pipeline, Dispatch>>(
       result, UniqueHandle<Pipeline, Dispatch>( pipeline, detail::ObjectDestroy<Device, Dispatch>( *this, allocator, d ) ) );
@@ -33212,7 +33137,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ), timeout, &faultCounts, reinterpret_cast<VkDeviceFaultInfoKHR *>( faultInfo.data() ) ) );
       }
     } while ( result == Result::eIncomplete );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getFaultReportsKHR", { Result::eSuccess, Result::eIncomplete, Result::eTimeout } );
+    detail::resultCheck<Result::eSuccess, Result::eIncomplete, Result::eTimeout>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getFaultReportsKHR" );
     VULKAN_HPP_ASSERT( faultCounts <= faultInfo.size() );
     if ( faultCounts < faultInfo.size() )
     {
@@ -33247,7 +33172,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ), timeout, &faultCounts, reinterpret_cast<VkDeviceFaultInfoKHR *>( faultInfo.data() ) ) );
       }
     } while ( result == Result::eIncomplete );
-    detail::resultCheck( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getFaultReportsKHR", { Result::eSuccess, Result::eIncomplete, Result::eTimeout } );
+    detail::resultCheck<Result::eSuccess, Result::eIncomplete, Result::eTimeout>( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getFaultReportsKHR" );
     VULKAN_HPP_ASSERT( faultCounts <= faultInfo.size() );
     if ( faultCounts < faultInfo.size() )
     {
@@ -12667,6 +12667,28 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                    DeviceSize             stride,
                                                                    QueryResultFlags flags VULKAN_HPP_DEFAULT_ASSIGNMENT( {} ),
                                                                    Dispatch const & d     VULKAN_HPP_DEFAULT_DISPATCHER_ASSIGNMENT ) const;
+    // wrapper function for command vkGetQueryPoolResults, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueryPoolResults.html
+    template <typename DataType,
+              typename Dispatch                                                           = VULKAN_HPP_DEFAULT_DISPATCHER_TYPE,
+              typename std::enable_if<IS_DISPATCHED( vkGetQueryPoolResults ), bool>::type = true>
+    VULKAN_HPP_NODISCARD ResultValue<QueryResultView<DataType>>
+                         getQueryPoolResults( QueryPool                                 queryPool,
+                                              uint32_t                                  firstQuery,
+                                              uint32_t                                  queryCount,
+                                              ArrayProxyNoTemporaries<uint32_t> const & data,
+                                              QueryResultFlags flags                    VULKAN_HPP_DEFAULT_ASSIGNMENT( {} ),
+                                              Dispatch const & d                        VULKAN_HPP_DEFAULT_DISPATCHER_ASSIGNMENT ) const;
+    // wrapper function for command vkGetQueryPoolResults, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueryPoolResults.html
+    template <typename DataType,
+              typename Dispatch                                                           = VULKAN_HPP_DEFAULT_DISPATCHER_TYPE,
+              typename std::enable_if<IS_DISPATCHED( vkGetQueryPoolResults ), bool>::type = true>
+    VULKAN_HPP_NODISCARD ResultValue<QueryResultView<DataType>>
+                         getQueryPoolResults( QueryPool                                 queryPool,
+                                              uint32_t                                  firstQuery,
+                                              uint32_t                                  queryCount,
+                                              ArrayProxyNoTemporaries<uint64_t> const & data,
+                                              QueryResultFlags flags                    VULKAN_HPP_DEFAULT_ASSIGNMENT( {} ),
+                                              Dispatch const & d                        VULKAN_HPP_DEFAULT_DISPATCHER_ASSIGNMENT ) const;
 #endif /* VULKAN_HPP_DISABLE_ENHANCED_MODE */
 
     // wrapper function for command vkCreateBuffer, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateBuffer.html
@@ -179,6 +179,17 @@ VULKAN_HPP_COMPILE_WARNING( "This is a non-conforming implementation of C++ name
 #  endif
 #endif
 
+// for the rarely taken paths, like throwing an exception on an error result, keeping them out of the inlined wrapper functions
+#if !defined( VULKAN_HPP_NOINLINE_COLD )
+#  if defined( __clang__ ) || defined( __GNUC__ )
+#    define VULKAN_HPP_NOINLINE_COLD __attribute__( ( noinline, cold ) ) inline
+#  elif defined( _MSC_VER )
+#    define VULKAN_HPP_NOINLINE_COLD __declspec( noinline ) inline
+#  else
+#    define VULKAN_HPP_NOINLINE_COLD inline
+#  endif
+#endif
+
 #if ( VULKAN_HPP_TYPESAFE_CONVERSION == 1 )
 #  define VULKAN_HPP_TYPESAFE_EXPLICIT
 #else
@@ -332,6 +343,17 @@ VULKAN_HPP_COMPILE_WARNING( "This is a non-conforming implementation of C++ name
 #  define VULKAN_HPP_DEFAULT_DISPATCHER_HANDLED
 #endif
 
+#if defined( VULKAN_HPP_ENABLE_INSTRUMENTING_DISPATCHER )
+#  define VULKAN_HPP_DEFAULT_INSTRUMENTING_DISPATCHER_STORAGE                                                 \
+    namespace VULKAN_HPP_NAMESPACE                                                                            \
+    {                                                                                                         \
+      namespace detail                                                                                        \
+      {                                                                                                       \
+        VULKAN_HPP_STORAGE_API InstrumentingDispatcher<DispatchLoaderDynamic> defaultInstrumentingDispatcher; \
+      }                                                                                                       \
+    }
+#endif
+
 #if defined( VULKAN_HPP_NO_DEFAULT_DISPATCHER )
 #  define VULKAN_HPP_DEFAULT_ASSIGNMENT( assignment )
 #else
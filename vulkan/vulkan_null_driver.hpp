@@ -0,0 +1,4026 @@
+// Copyright 2015-2026 The Khronos Group Inc.
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+//
+
+// This header is generated from the Khronos Vulkan XML API Registry.
+
+#ifndef VULKAN_NULL_DRIVER_HPP
+#define VULKAN_NULL_DRIVER_HPP
+
+#include <vulkan/vulkan.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+// A driver implementing every command as a deterministic no-op, for running code using vulkan.hpp without any Vulkan loader or device:
+//  - commands returning a VkResult return VK_SUCCESS (or VK_INCOMPLETE, see below), all other commands return zero
+//  - each created, allocated, or otherwise returned handle is a new, unique value
+//  - two-call enumerations report NullDriverConfiguration::enumerationCount elements
+//  - returned structures are zeroed, except for sType and pNext, and so is each structure in their pNext chains
+//  - returned scalars are zeroed, and mapping memory returns NullDriverConfiguration::mappedMemory
+namespace VULKAN_HPP_NAMESPACE
+{
+  namespace detail
+  {
+    //==================
+    //=== NullDriver ===
+    //==================
+
+    // to be set up before any command is called
+    struct NullDriverConfiguration
+    {
+      uint32_t apiVersion       = VK_HEADER_VERSION_COMPLETE;  // returned by vkEnumerateInstanceVersion
+      uint32_t enumerationCount = 1;                           // number of elements returned by each two-call enumeration
+      void *   mappedMemory     = nullptr;                     // returned by vkMapMemory and friends; a static block of 1 MiB if nullptr
+
+      // commands to use instead of the null ones, looked up by name
+      std::vector<std::pair<std::string, PFN_vkVoidFunction>> overrides;
+    };
+
+    class NullDriver
+    {
+    public:
+      static NullDriverConfiguration & configuration() VULKAN_HPP_NOEXCEPT
+      {
+        static NullDriverConfiguration nullDriverConfiguration;
+        return nullDriverConfiguration;
+      }
+
+      static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getInstanceProcAddr( VkInstance, char const * pName )
+      {
+        return getProcAddr( pName );
+      }
+
+      static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getDeviceProcAddr( VkDevice, char const * pName )
+      {
+        return getProcAddr( pName );
+      }
+
+      template <typename HandleType>
+      static HandleType nextHandle() VULKAN_HPP_NOEXCEPT
+      {
+        static std::atomic<uint64_t> handleCounter( 0 );
+        return makeHandle<HandleType>( handleCounter.fetch_add( 1, std::memory_order_relaxed ) + 1, std::is_pointer<HandleType>() );
+      }
+
+      static void * mappedMemory() VULKAN_HPP_NOEXCEPT
+      {
+        static uint64_t memoryBlock[( 1 << 20 ) / sizeof( uint64_t )];
+        return configuration().mappedMemory ? configuration().mappedMemory : memoryBlock;
+      }
+
+    private:
+      template <typename HandleType>
+      static HandleType makeHandle( uint64_t value, std::true_type /*isPointer*/ ) VULKAN_HPP_NOEXCEPT
+      {
+        return reinterpret_cast<HandleType>( static_cast<uintptr_t>( value ) );
+      }
+
+      template <typename HandleType>
+      static HandleType makeHandle( uint64_t value, std::false_type /*isPointer*/ ) VULKAN_HPP_NOEXCEPT
+      {
+        return static_cast<HandleType>( value );
+      }
+
+      static VKAPI_ATTR VkResult VKAPI_CALL enumerateInstanceVersion( uint32_t * pApiVersion )
+      {
+        *pApiVersion = configuration().apiVersion;
+        return VK_SUCCESS;
+      }
+
+      static PFN_vkVoidFunction getProcAddr( char const * pName );
+    };
+
+    // the size of the structure identified by structureType, or 0 for an unknown one
+    inline size_t nullDriverStructureSize( VkStructureType structureType ) VULKAN_HPP_NOEXCEPT
+    {
+      switch ( structureType )
+      {
+        //=== VK_VERSION_1_0 ===
+        case VK_STRUCTURE_TYPE_APPLICATION_INFO                         : return sizeof( VkApplicationInfo );
+        case VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO                     : return sizeof( VkInstanceCreateInfo );
+        case VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO                 : return sizeof( VkDeviceQueueCreateInfo );
+        case VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO                       : return sizeof( VkDeviceCreateInfo );
+        case VK_STRUCTURE_TYPE_SUBMIT_INFO                              : return sizeof( VkSubmitInfo );
+        case VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE                      : return sizeof( VkMappedMemoryRange );
+        case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO                     : return sizeof( VkMemoryAllocateInfo );
+        case VK_STRUCTURE_TYPE_BIND_SPARSE_INFO                         : return sizeof( VkBindSparseInfo );
+        case VK_STRUCTURE_TYPE_FENCE_CREATE_INFO                        : return sizeof( VkFenceCreateInfo );
+        case VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO                    : return sizeof( VkSemaphoreCreateInfo );
+        case VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO                   : return sizeof( VkQueryPoolCreateInfo );
+        case VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO                       : return sizeof( VkBufferCreateInfo );
+        case VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO                        : return sizeof( VkImageCreateInfo );
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO                   : return sizeof( VkImageViewCreateInfo );
+        case VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO                 : return sizeof( VkCommandPoolCreateInfo );
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO             : return sizeof( VkCommandBufferAllocateInfo );
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO          : return sizeof( VkCommandBufferInheritanceInfo );
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO                : return sizeof( VkCommandBufferBeginInfo );
+        case VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER                    : return sizeof( VkBufferMemoryBarrier );
+        case VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER                     : return sizeof( VkImageMemoryBarrier );
+        case VK_STRUCTURE_TYPE_MEMORY_BARRIER                           : return sizeof( VkMemoryBarrier );
+        case VK_STRUCTURE_TYPE_EVENT_CREATE_INFO                        : return sizeof( VkEventCreateInfo );
+        case VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO                  : return sizeof( VkBufferViewCreateInfo );
+        case VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO                : return sizeof( VkShaderModuleCreateInfo );
+        case VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO               : return sizeof( VkPipelineCacheCreateInfo );
+        case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO        : return sizeof( VkPipelineShaderStageCreateInfo );
+        case VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO             : return sizeof( VkComputePipelineCreateInfo );
+        case VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO              : return sizeof( VkPipelineLayoutCreateInfo );
+        case VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO                      : return sizeof( VkSamplerCreateInfo );
+        case VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET                      : return sizeof( VkCopyDescriptorSet );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO              : return sizeof( VkDescriptorPoolCreateInfo );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO             : return sizeof( VkDescriptorSetAllocateInfo );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO        : return sizeof( VkDescriptorSetLayoutCreateInfo );
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET                     : return sizeof( VkWriteDescriptorSet );
+        case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO   : return sizeof( VkPipelineColorBlendStateCreateInfo );
+        case VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO : return sizeof( VkPipelineDepthStencilStateCreateInfo );
+        case VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO       : return sizeof( VkPipelineDynamicStateCreateInfo );
+        case VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO: return sizeof( VkPipelineInputAssemblyStateCreateInfo );
+        case VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO   : return sizeof( VkPipelineMultisampleStateCreateInfo );
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO : return sizeof( VkPipelineRasterizationStateCreateInfo );
+        case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO  : return sizeof( VkPipelineTessellationStateCreateInfo );
+        case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO  : return sizeof( VkPipelineVertexInputStateCreateInfo );
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO      : return sizeof( VkPipelineViewportStateCreateInfo );
+        case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO            : return sizeof( VkGraphicsPipelineCreateInfo );
+        case VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO                  : return sizeof( VkFramebufferCreateInfo );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO                  : return sizeof( VkRenderPassCreateInfo );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO                   : return sizeof( VkRenderPassBeginInfo );
+
+        //=== VK_VERSION_1_1 ===
+        case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO                              : return sizeof( VkBindBufferMemoryInfo );
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO                               : return sizeof( VkBindImageMemoryInfo );
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS                        : return sizeof( VkMemoryDedicatedRequirements );
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO                       : return sizeof( VkMemoryDedicatedAllocateInfo );
+        case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO                           : return sizeof( VkMemoryAllocateFlagsInfo );
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO               : return sizeof( VkDeviceGroupCommandBufferBeginInfo );
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO                             : return sizeof( VkDeviceGroupSubmitInfo );
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO                        : return sizeof( VkDeviceGroupBindSparseInfo );
+        case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO                 : return sizeof( VkBindBufferMemoryDeviceGroupInfo );
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO                  : return sizeof( VkBindImageMemoryDeviceGroupInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES                     : return sizeof( VkPhysicalDeviceGroupProperties );
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO                      : return sizeof( VkDeviceGroupDeviceCreateInfo );
+        case VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2                    : return sizeof( VkBufferMemoryRequirementsInfo2 );
+        case VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2                     : return sizeof( VkImageMemoryRequirementsInfo2 );
+        case VK_STRUCTURE_TYPE_IMAGE_SPARSE_MEMORY_REQUIREMENTS_INFO_2              : return sizeof( VkImageSparseMemoryRequirementsInfo2 );
+        case VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2                                : return sizeof( VkMemoryRequirements2 );
+        case VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2                   : return sizeof( VkSparseImageMemoryRequirements2 );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2                           : return sizeof( VkPhysicalDeviceFeatures2 );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2                         : return sizeof( VkPhysicalDeviceProperties2 );
+        case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2                                  : return sizeof( VkFormatProperties2 );
+        case VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2                            : return sizeof( VkImageFormatProperties2 );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2                  : return sizeof( VkPhysicalDeviceImageFormatInfo2 );
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2                            : return sizeof( VkQueueFamilyProperties2 );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2                  : return sizeof( VkPhysicalDeviceMemoryProperties2 );
+        case VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2                     : return sizeof( VkSparseImageFormatProperties2 );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SPARSE_IMAGE_FORMAT_INFO_2           : return sizeof( VkPhysicalDeviceSparseImageFormatInfo2 );
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO                         : return sizeof( VkImageViewUsageCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES            : return sizeof( VkPhysicalDeviceProtectedMemoryFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES          : return sizeof( VkPhysicalDeviceProtectedMemoryProperties );
+        case VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2                                  : return sizeof( VkDeviceQueueInfo2 );
+        case VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO                                : return sizeof( VkProtectedSubmitInfo );
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO                         : return sizeof( VkBindImagePlaneMemoryInfo );
+        case VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO                 : return sizeof( VkImagePlaneMemoryRequirementsInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO           : return sizeof( VkPhysicalDeviceExternalImageFormatInfo );
+        case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES                     : return sizeof( VkExternalImageFormatProperties );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO                 : return sizeof( VkPhysicalDeviceExternalBufferInfo );
+        case VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES                           : return sizeof( VkExternalBufferProperties );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES                        : return sizeof( VkPhysicalDeviceIDProperties );
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO                    : return sizeof( VkExternalMemoryImageCreateInfo );
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO                   : return sizeof( VkExternalMemoryBufferCreateInfo );
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO                          : return sizeof( VkExportMemoryAllocateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO                  : return sizeof( VkPhysicalDeviceExternalFenceInfo );
+        case VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES                            : return sizeof( VkExternalFenceProperties );
+        case VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO                             : return sizeof( VkExportFenceCreateInfo );
+        case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO                         : return sizeof( VkExportSemaphoreCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO              : return sizeof( VkPhysicalDeviceExternalSemaphoreInfo );
+        case VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES                        : return sizeof( VkExternalSemaphoreProperties );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES                  : return sizeof( VkPhysicalDeviceSubgroupProperties );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES               : return sizeof( VkPhysicalDevice16BitStorageFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES           : return sizeof( VkPhysicalDeviceVariablePointersFeatures );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO               : return sizeof( VkDescriptorUpdateTemplateCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES             : return sizeof( VkPhysicalDeviceMaintenance3Properties );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT                        : return sizeof( VkDescriptorSetLayoutSupport );
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO                 : return sizeof( VkSamplerYcbcrConversionCreateInfo );
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO                        : return sizeof( VkSamplerYcbcrConversionInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES    : return sizeof( VkPhysicalDeviceSamplerYcbcrConversionFeatures );
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES     : return sizeof( VkSamplerYcbcrConversionImageFormatProperties );
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO                  : return sizeof( VkDeviceGroupRenderPassBeginInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES            : return sizeof( VkPhysicalDevicePointClippingProperties );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO      : return sizeof( VkRenderPassInputAttachmentAspectCreateInfo );
+        case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO: return sizeof( VkPipelineTessellationDomainOriginStateCreateInfo );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO                    : return sizeof( VkRenderPassMultiviewCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES                   : return sizeof( VkPhysicalDeviceMultiviewFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES                 : return sizeof( VkPhysicalDeviceMultiviewProperties );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES      : return sizeof( VkPhysicalDeviceShaderDrawParametersFeatures );
+
+        //=== VK_VERSION_1_2 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES                      : return sizeof( VkPhysicalDeviceDriverProperties );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES                    : return sizeof( VkPhysicalDeviceVulkan11Features );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES                  : return sizeof( VkPhysicalDeviceVulkan11Properties );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES                    : return sizeof( VkPhysicalDeviceVulkan12Features );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES                  : return sizeof( VkPhysicalDeviceVulkan12Properties );
+        case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO                          : return sizeof( VkImageFormatListCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES           : return sizeof( VkPhysicalDeviceVulkanMemoryModelFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES              : return sizeof( VkPhysicalDeviceHostQueryResetFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES            : return sizeof( VkPhysicalDeviceTimelineSemaphoreFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES          : return sizeof( VkPhysicalDeviceTimelineSemaphoreProperties );
+        case VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO                             : return sizeof( VkSemaphoreTypeCreateInfo );
+        case VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO                         : return sizeof( VkTimelineSemaphoreSubmitInfo );
+        case VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO                                    : return sizeof( VkSemaphoreWaitInfo );
+        case VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO                                  : return sizeof( VkSemaphoreSignalInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES         : return sizeof( VkPhysicalDeviceBufferDeviceAddressFeatures );
+        case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO                             : return sizeof( VkBufferDeviceAddressInfo );
+        case VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO              : return sizeof( VkBufferOpaqueCaptureAddressCreateInfo );
+        case VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO            : return sizeof( VkMemoryOpaqueCaptureAddressAllocateInfo );
+        case VK_STRUCTURE_TYPE_DEVICE_MEMORY_OPAQUE_CAPTURE_ADDRESS_INFO              : return sizeof( VkDeviceMemoryOpaqueCaptureAddressInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES                  : return sizeof( VkPhysicalDevice8BitStorageFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES           : return sizeof( VkPhysicalDeviceShaderAtomicInt64Features );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES           : return sizeof( VkPhysicalDeviceShaderFloat16Int8Features );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES              : return sizeof( VkPhysicalDeviceFloatControlsProperties );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO        : return sizeof( VkDescriptorSetLayoutBindingFlagsCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES           : return sizeof( VkPhysicalDeviceDescriptorIndexingFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES         : return sizeof( VkPhysicalDeviceDescriptorIndexingProperties );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO : return sizeof( VkDescriptorSetVariableDescriptorCountAllocateInfo );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT: return sizeof( VkDescriptorSetVariableDescriptorCountLayoutSupport );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES           : return sizeof( VkPhysicalDeviceScalarBlockLayoutFeatures );
+        case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO                     : return sizeof( VkSamplerReductionModeCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES       : return sizeof( VkPhysicalDeviceSamplerFilterMinmaxProperties );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES: return sizeof( VkPhysicalDeviceUniformBufferStandardLayoutFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES: return sizeof( VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures );
+        case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2                               : return sizeof( VkAttachmentDescription2 );
+        case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2                                 : return sizeof( VkAttachmentReference2 );
+        case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2                                  : return sizeof( VkSubpassDescription2 );
+        case VK_STRUCTURE_TYPE_SUBPASS_DEPENDENCY_2                                   : return sizeof( VkSubpassDependency2 );
+        case VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO                                     : return sizeof( VkSubpassBeginInfo );
+        case VK_STRUCTURE_TYPE_SUBPASS_END_INFO                                       : return sizeof( VkSubpassEndInfo );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2                              : return sizeof( VkRenderPassCreateInfo2 );
+        case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE              : return sizeof( VkSubpassDescriptionDepthStencilResolve );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES       : return sizeof( VkPhysicalDeviceDepthStencilResolveProperties );
+        case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO                        : return sizeof( VkImageStencilUsageCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES         : return sizeof( VkPhysicalDeviceImagelessFramebufferFeatures );
+        case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO                      : return sizeof( VkFramebufferAttachmentImageInfo );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO                      : return sizeof( VkRenderPassAttachmentBeginInfo );
+        case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO                    : return sizeof( VkFramebufferAttachmentsCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES: return sizeof( VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures );
+        case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT                    : return sizeof( VkAttachmentReferenceStencilLayout );
+        case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT                  : return sizeof( VkAttachmentDescriptionStencilLayout );
+
+        //=== VK_VERSION_1_3 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES                        : return sizeof( VkPhysicalDeviceVulkan13Features );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROPERTIES                      : return sizeof( VkPhysicalDeviceVulkan13Properties );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES                            : return sizeof( VkPhysicalDeviceToolProperties );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES                      : return sizeof( VkPhysicalDevicePrivateDataFeatures );
+        case VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO                            : return sizeof( VkDevicePrivateDataCreateInfo );
+        case VK_STRUCTURE_TYPE_PRIVATE_DATA_SLOT_CREATE_INFO                              : return sizeof( VkPrivateDataSlotCreateInfo );
+        case VK_STRUCTURE_TYPE_MEMORY_BARRIER_2                                           : return sizeof( VkMemoryBarrier2 );
+        case VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2                                    : return sizeof( VkBufferMemoryBarrier2 );
+        case VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2                                     : return sizeof( VkImageMemoryBarrier2 );
+        case VK_STRUCTURE_TYPE_DEPENDENCY_INFO                                            : return sizeof( VkDependencyInfo );
+        case VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO                                      : return sizeof( VkSemaphoreSubmitInfo );
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO                                 : return sizeof( VkCommandBufferSubmitInfo );
+        case VK_STRUCTURE_TYPE_SUBMIT_INFO_2                                              : return sizeof( VkSubmitInfo2 );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES                 : return sizeof( VkPhysicalDeviceSynchronization2Features );
+        case VK_STRUCTURE_TYPE_BUFFER_COPY_2                                              : return sizeof( VkBufferCopy2 );
+        case VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2                                         : return sizeof( VkCopyBufferInfo2 );
+        case VK_STRUCTURE_TYPE_IMAGE_COPY_2                                               : return sizeof( VkImageCopy2 );
+        case VK_STRUCTURE_TYPE_COPY_IMAGE_INFO_2                                          : return sizeof( VkCopyImageInfo2 );
+        case VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2                                        : return sizeof( VkBufferImageCopy2 );
+        case VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2                                : return sizeof( VkCopyBufferToImageInfo2 );
+        case VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2                                : return sizeof( VkCopyImageToBufferInfo2 );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES      : return sizeof( VkPhysicalDeviceTextureCompressionASTCHDRFeatures );
+        case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3                                        : return sizeof( VkFormatProperties3 );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES                     : return sizeof( VkPhysicalDeviceMaintenance4Features );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES                   : return sizeof( VkPhysicalDeviceMaintenance4Properties );
+        case VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS                          : return sizeof( VkDeviceBufferMemoryRequirements );
+        case VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS                           : return sizeof( VkDeviceImageMemoryRequirements );
+        case VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO                     : return sizeof( VkPipelineCreationFeedbackCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES       : return sizeof( VkPhysicalDeviceShaderTerminateInvocationFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES:
+          return sizeof( VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES:
+          return sizeof( VkPhysicalDevicePipelineCreationCacheControlFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES:
+          return sizeof( VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES                  : return sizeof( VkPhysicalDeviceImageRobustnessFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES             : return sizeof( VkPhysicalDeviceSubgroupSizeControlFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES           : return sizeof( VkPhysicalDeviceSubgroupSizeControlProperties );
+        case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO:
+          return sizeof( VkPipelineShaderStageRequiredSubgroupSizeCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES              : return sizeof( VkPhysicalDeviceInlineUniformBlockFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES            : return sizeof( VkPhysicalDeviceInlineUniformBlockProperties );
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK                  : return sizeof( VkWriteDescriptorSetInlineUniformBlock );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO           : return sizeof( VkDescriptorPoolInlineUniformBlockCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES        : return sizeof( VkPhysicalDeviceShaderIntegerDotProductFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES      : return sizeof( VkPhysicalDeviceShaderIntegerDotProductProperties );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES          : return sizeof( VkPhysicalDeviceTexelBufferAlignmentProperties );
+        case VK_STRUCTURE_TYPE_IMAGE_BLIT_2                                               : return sizeof( VkImageBlit2 );
+        case VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2                                          : return sizeof( VkBlitImageInfo2 );
+        case VK_STRUCTURE_TYPE_IMAGE_RESOLVE_2                                            : return sizeof( VkImageResolve2 );
+        case VK_STRUCTURE_TYPE_RESOLVE_IMAGE_INFO_2                                       : return sizeof( VkResolveImageInfo2 );
+        case VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO                                  : return sizeof( VkRenderingAttachmentInfo );
+        case VK_STRUCTURE_TYPE_RENDERING_INFO                                             : return sizeof( VkRenderingInfo );
+        case VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO                             : return sizeof( VkPipelineRenderingCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES                 : return sizeof( VkPhysicalDeviceDynamicRenderingFeatures );
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO                  : return sizeof( VkCommandBufferInheritanceRenderingInfo );
+
+        //=== VK_VERSION_1_4 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_4_FEATURES                  : return sizeof( VkPhysicalDeviceVulkan14Features );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_4_PROPERTIES                : return sizeof( VkPhysicalDeviceVulkan14Properties );
+        case VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO             : return sizeof( VkDeviceQueueGlobalPriorityCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GLOBAL_PRIORITY_QUERY_FEATURES       : return sizeof( VkPhysicalDeviceGlobalPriorityQueryFeatures );
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PROPERTIES              : return sizeof( VkQueueFamilyGlobalPriorityProperties );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INDEX_TYPE_UINT8_FEATURES            : return sizeof( VkPhysicalDeviceIndexTypeUint8Features );
+        case VK_STRUCTURE_TYPE_MEMORY_MAP_INFO                                      : return sizeof( VkMemoryMapInfo );
+        case VK_STRUCTURE_TYPE_MEMORY_UNMAP_INFO                                    : return sizeof( VkMemoryUnmapInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_5_FEATURES               : return sizeof( VkPhysicalDeviceMaintenance5Features );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_5_PROPERTIES             : return sizeof( VkPhysicalDeviceMaintenance5Properties );
+        case VK_STRUCTURE_TYPE_SUBRESOURCE_LAYOUT_2                                 : return sizeof( VkSubresourceLayout2 );
+        case VK_STRUCTURE_TYPE_IMAGE_SUBRESOURCE_2                                  : return sizeof( VkImageSubresource2 );
+        case VK_STRUCTURE_TYPE_DEVICE_IMAGE_SUBRESOURCE_INFO                        : return sizeof( VkDeviceImageSubresourceInfo );
+        case VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO                     : return sizeof( VkBufferUsageFlags2CreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_6_FEATURES               : return sizeof( VkPhysicalDeviceMaintenance6Features );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_6_PROPERTIES             : return sizeof( VkPhysicalDeviceMaintenance6Properties );
+        case VK_STRUCTURE_TYPE_BIND_MEMORY_STATUS                                   : return sizeof( VkBindMemoryStatus );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_FEATURES             : return sizeof( VkPhysicalDeviceHostImageCopyFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_PROPERTIES           : return sizeof( VkPhysicalDeviceHostImageCopyProperties );
+        case VK_STRUCTURE_TYPE_MEMORY_TO_IMAGE_COPY                                 : return sizeof( VkMemoryToImageCopy );
+        case VK_STRUCTURE_TYPE_IMAGE_TO_MEMORY_COPY                                 : return sizeof( VkImageToMemoryCopy );
+        case VK_STRUCTURE_TYPE_COPY_MEMORY_TO_IMAGE_INFO                            : return sizeof( VkCopyMemoryToImageInfo );
+        case VK_STRUCTURE_TYPE_COPY_IMAGE_TO_MEMORY_INFO                            : return sizeof( VkCopyImageToMemoryInfo );
+        case VK_STRUCTURE_TYPE_COPY_IMAGE_TO_IMAGE_INFO                             : return sizeof( VkCopyImageToImageInfo );
+        case VK_STRUCTURE_TYPE_HOST_IMAGE_LAYOUT_TRANSITION_INFO                    : return sizeof( VkHostImageLayoutTransitionInfo );
+        case VK_STRUCTURE_TYPE_SUBRESOURCE_HOST_MEMCPY_SIZE                         : return sizeof( VkSubresourceHostMemcpySize );
+        case VK_STRUCTURE_TYPE_HOST_IMAGE_COPY_DEVICE_PERFORMANCE_QUERY             : return sizeof( VkHostImageCopyDevicePerformanceQuery );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_ROTATE_FEATURES      : return sizeof( VkPhysicalDeviceShaderSubgroupRotateFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT_CONTROLS_2_FEATURES     : return sizeof( VkPhysicalDeviceShaderFloatControls2Features );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_EXPECT_ASSUME_FEATURES        : return sizeof( VkPhysicalDeviceShaderExpectAssumeFeatures );
+        case VK_STRUCTURE_TYPE_PIPELINE_CREATE_FLAGS_2_CREATE_INFO                  : return sizeof( VkPipelineCreateFlags2CreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES           : return sizeof( VkPhysicalDevicePushDescriptorProperties );
+        case VK_STRUCTURE_TYPE_BIND_DESCRIPTOR_SETS_INFO                            : return sizeof( VkBindDescriptorSetsInfo );
+        case VK_STRUCTURE_TYPE_PUSH_CONSTANTS_INFO                                  : return sizeof( VkPushConstantsInfo );
+        case VK_STRUCTURE_TYPE_PUSH_DESCRIPTOR_SET_INFO                             : return sizeof( VkPushDescriptorSetInfo );
+        case VK_STRUCTURE_TYPE_PUSH_DESCRIPTOR_SET_WITH_TEMPLATE_INFO               : return sizeof( VkPushDescriptorSetWithTemplateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_PROTECTED_ACCESS_FEATURES   : return sizeof( VkPhysicalDevicePipelineProtectedAccessFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_ROBUSTNESS_FEATURES         : return sizeof( VkPhysicalDevicePipelineRobustnessFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_ROBUSTNESS_PROPERTIES       : return sizeof( VkPhysicalDevicePipelineRobustnessProperties );
+        case VK_STRUCTURE_TYPE_PIPELINE_ROBUSTNESS_CREATE_INFO                      : return sizeof( VkPipelineRobustnessCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_FEATURES          : return sizeof( VkPhysicalDeviceLineRasterizationFeatures );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_PROPERTIES        : return sizeof( VkPhysicalDeviceLineRasterizationProperties );
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO        : return sizeof( VkPipelineRasterizationLineStateCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES  : return sizeof( VkPhysicalDeviceVertexAttributeDivisorProperties );
+        case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO      : return sizeof( VkPipelineVertexInputDivisorStateCreateInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_FEATURES    : return sizeof( VkPhysicalDeviceVertexAttributeDivisorFeatures );
+        case VK_STRUCTURE_TYPE_RENDERING_AREA_INFO                                  : return sizeof( VkRenderingAreaInfo );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_LOCAL_READ_FEATURES: return sizeof( VkPhysicalDeviceDynamicRenderingLocalReadFeatures );
+        case VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_LOCATION_INFO                   : return sizeof( VkRenderingAttachmentLocationInfo );
+        case VK_STRUCTURE_TYPE_RENDERING_INPUT_ATTACHMENT_INDEX_INFO                : return sizeof( VkRenderingInputAttachmentIndexInfo );
+
+        //=== VK_KHR_swapchain ===
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR             : return sizeof( VkSwapchainCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_PRESENT_INFO_KHR                      : return sizeof( VkPresentInfoKHR );
+        case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR       : return sizeof( VkImageSwapchainCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR  : return sizeof( VkBindImageMemorySwapchainInfoKHR );
+        case VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR           : return sizeof( VkAcquireNextImageInfoKHR );
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHR : return sizeof( VkDeviceGroupPresentCapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR         : return sizeof( VkDeviceGroupPresentInfoKHR );
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR: return sizeof( VkDeviceGroupSwapchainCreateInfoKHR );
+
+        //=== VK_KHR_display ===
+        case VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR   : return sizeof( VkDisplayModeCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR: return sizeof( VkDisplaySurfaceCreateInfoKHR );
+
+        //=== VK_KHR_display_swapchain ===
+        case VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR: return sizeof( VkDisplayPresentInfoKHR );
+
+#if defined( VK_USE_PLATFORM_XLIB_KHR )
+        //=== VK_KHR_xlib_surface ===
+        case VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR: return sizeof( VkXlibSurfaceCreateInfoKHR );
+#endif /*VK_USE_PLATFORM_XLIB_KHR*/
+
+#if defined( VK_USE_PLATFORM_XCB_KHR )
+        //=== VK_KHR_xcb_surface ===
+        case VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR: return sizeof( VkXcbSurfaceCreateInfoKHR );
+#endif /*VK_USE_PLATFORM_XCB_KHR*/
+
+#if defined( VK_USE_PLATFORM_WAYLAND_KHR )
+        //=== VK_KHR_wayland_surface ===
+        case VK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR: return sizeof( VkWaylandSurfaceCreateInfoKHR );
+#endif /*VK_USE_PLATFORM_WAYLAND_KHR*/
+
+#if defined( VK_USE_PLATFORM_ANDROID_KHR )
+        //=== VK_KHR_android_surface ===
+        case VK_STRUCTURE_TYPE_ANDROID_SURFACE_CREATE_INFO_KHR: return sizeof( VkAndroidSurfaceCreateInfoKHR );
+#endif /*VK_USE_PLATFORM_ANDROID_KHR*/
+
+#if defined( VK_USE_PLATFORM_WIN32_KHR )
+        //=== VK_KHR_win32_surface ===
+        case VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR: return sizeof( VkWin32SurfaceCreateInfoKHR );
+#endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+        //=== VK_EXT_debug_report ===
+        case VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT: return sizeof( VkDebugReportCallbackCreateInfoEXT );
+
+        //=== VK_AMD_rasterization_order ===
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD: return sizeof( VkPipelineRasterizationStateRasterizationOrderAMD );
+
+        //=== VK_EXT_debug_marker ===
+        case VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_NAME_INFO_EXT: return sizeof( VkDebugMarkerObjectNameInfoEXT );
+        case VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_TAG_INFO_EXT : return sizeof( VkDebugMarkerObjectTagInfoEXT );
+        case VK_STRUCTURE_TYPE_DEBUG_MARKER_MARKER_INFO_EXT     : return sizeof( VkDebugMarkerMarkerInfoEXT );
+
+        //=== VK_KHR_video_queue ===
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_QUERY_RESULT_STATUS_PROPERTIES_KHR: return sizeof( VkQueueFamilyQueryResultStatusPropertiesKHR );
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_VIDEO_PROPERTIES_KHR              : return sizeof( VkQueueFamilyVideoPropertiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_PROFILE_INFO_KHR                         : return sizeof( VkVideoProfileInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_PROFILE_LIST_INFO_KHR                    : return sizeof( VkVideoProfileListInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_CAPABILITIES_KHR                         : return sizeof( VkVideoCapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_FORMAT_INFO_KHR          : return sizeof( VkPhysicalDeviceVideoFormatInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_FORMAT_PROPERTIES_KHR                    : return sizeof( VkVideoFormatPropertiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_PICTURE_RESOURCE_INFO_KHR                : return sizeof( VkVideoPictureResourceInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_REFERENCE_SLOT_INFO_KHR                  : return sizeof( VkVideoReferenceSlotInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_SESSION_MEMORY_REQUIREMENTS_KHR          : return sizeof( VkVideoSessionMemoryRequirementsKHR );
+        case VK_STRUCTURE_TYPE_BIND_VIDEO_SESSION_MEMORY_INFO_KHR             : return sizeof( VkBindVideoSessionMemoryInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_SESSION_CREATE_INFO_KHR                  : return sizeof( VkVideoSessionCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_SESSION_PARAMETERS_CREATE_INFO_KHR       : return sizeof( VkVideoSessionParametersCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_SESSION_PARAMETERS_UPDATE_INFO_KHR       : return sizeof( VkVideoSessionParametersUpdateInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_BEGIN_CODING_INFO_KHR                    : return sizeof( VkVideoBeginCodingInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_END_CODING_INFO_KHR                      : return sizeof( VkVideoEndCodingInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_CODING_CONTROL_INFO_KHR                  : return sizeof( VkVideoCodingControlInfoKHR );
+
+        //=== VK_KHR_video_decode_queue ===
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_CAPABILITIES_KHR: return sizeof( VkVideoDecodeCapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_USAGE_INFO_KHR  : return sizeof( VkVideoDecodeUsageInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_INFO_KHR        : return sizeof( VkVideoDecodeInfoKHR );
+
+        //=== VK_NV_dedicated_allocation ===
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV   : return sizeof( VkDedicatedAllocationImageCreateInfoNV );
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV  : return sizeof( VkDedicatedAllocationBufferCreateInfoNV );
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV: return sizeof( VkDedicatedAllocationMemoryAllocateInfoNV );
+
+        //=== VK_EXT_transform_feedback ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_FEATURES_EXT    : return sizeof( VkPhysicalDeviceTransformFeedbackFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT  : return sizeof( VkPhysicalDeviceTransformFeedbackPropertiesEXT );
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT: return sizeof( VkPipelineRasterizationStateStreamCreateInfoEXT );
+
+        //=== VK_NVX_binary_import ===
+        case VK_STRUCTURE_TYPE_CU_MODULE_CREATE_INFO_NVX               : return sizeof( VkCuModuleCreateInfoNVX );
+        case VK_STRUCTURE_TYPE_CU_MODULE_TEXTURING_MODE_CREATE_INFO_NVX: return sizeof( VkCuModuleTexturingModeCreateInfoNVX );
+        case VK_STRUCTURE_TYPE_CU_FUNCTION_CREATE_INFO_NVX             : return sizeof( VkCuFunctionCreateInfoNVX );
+        case VK_STRUCTURE_TYPE_CU_LAUNCH_INFO_NVX                      : return sizeof( VkCuLaunchInfoNVX );
+
+        //=== VK_NVX_image_view_handle ===
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_HANDLE_INFO_NVX       : return sizeof( VkImageViewHandleInfoNVX );
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_ADDRESS_PROPERTIES_NVX: return sizeof( VkImageViewAddressPropertiesNVX );
+
+        //=== VK_KHR_video_encode_h264 ===
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_CAPABILITIES_KHR                    : return sizeof( VkVideoEncodeH264CapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_QUALITY_LEVEL_PROPERTIES_KHR        : return sizeof( VkVideoEncodeH264QualityLevelPropertiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_CREATE_INFO_KHR             : return sizeof( VkVideoEncodeH264SessionCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_CREATE_INFO_KHR  : return sizeof( VkVideoEncodeH264SessionParametersCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_ADD_INFO_KHR     : return sizeof( VkVideoEncodeH264SessionParametersAddInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_GET_INFO_KHR     : return sizeof( VkVideoEncodeH264SessionParametersGetInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_FEEDBACK_INFO_KHR: return sizeof( VkVideoEncodeH264SessionParametersFeedbackInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PICTURE_INFO_KHR                    : return sizeof( VkVideoEncodeH264PictureInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_DPB_SLOT_INFO_KHR                   : return sizeof( VkVideoEncodeH264DpbSlotInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_NALU_SLICE_INFO_KHR                 : return sizeof( VkVideoEncodeH264NaluSliceInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PROFILE_INFO_KHR                    : return sizeof( VkVideoEncodeH264ProfileInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_RATE_CONTROL_INFO_KHR               : return sizeof( VkVideoEncodeH264RateControlInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_RATE_CONTROL_LAYER_INFO_KHR         : return sizeof( VkVideoEncodeH264RateControlLayerInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_GOP_REMAINING_FRAME_INFO_KHR        : return sizeof( VkVideoEncodeH264GopRemainingFrameInfoKHR );
+
+        //=== VK_KHR_video_encode_h265 ===
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_CAPABILITIES_KHR                    : return sizeof( VkVideoEncodeH265CapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_CREATE_INFO_KHR             : return sizeof( VkVideoEncodeH265SessionCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_QUALITY_LEVEL_PROPERTIES_KHR        : return sizeof( VkVideoEncodeH265QualityLevelPropertiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_CREATE_INFO_KHR  : return sizeof( VkVideoEncodeH265SessionParametersCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_ADD_INFO_KHR     : return sizeof( VkVideoEncodeH265SessionParametersAddInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_GET_INFO_KHR     : return sizeof( VkVideoEncodeH265SessionParametersGetInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_FEEDBACK_INFO_KHR: return sizeof( VkVideoEncodeH265SessionParametersFeedbackInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PICTURE_INFO_KHR                    : return sizeof( VkVideoEncodeH265PictureInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_DPB_SLOT_INFO_KHR                   : return sizeof( VkVideoEncodeH265DpbSlotInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_NALU_SLICE_SEGMENT_INFO_KHR         : return sizeof( VkVideoEncodeH265NaluSliceSegmentInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PROFILE_INFO_KHR                    : return sizeof( VkVideoEncodeH265ProfileInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_RATE_CONTROL_INFO_KHR               : return sizeof( VkVideoEncodeH265RateControlInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_RATE_CONTROL_LAYER_INFO_KHR         : return sizeof( VkVideoEncodeH265RateControlLayerInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_GOP_REMAINING_FRAME_INFO_KHR        : return sizeof( VkVideoEncodeH265GopRemainingFrameInfoKHR );
+
+        //=== VK_KHR_video_decode_h264 ===
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PROFILE_INFO_KHR                  : return sizeof( VkVideoDecodeH264ProfileInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_CAPABILITIES_KHR                  : return sizeof( VkVideoDecodeH264CapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_CREATE_INFO_KHR: return sizeof( VkVideoDecodeH264SessionParametersCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_ADD_INFO_KHR   : return sizeof( VkVideoDecodeH264SessionParametersAddInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PICTURE_INFO_KHR                  : return sizeof( VkVideoDecodeH264PictureInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_DPB_SLOT_INFO_KHR                 : return sizeof( VkVideoDecodeH264DpbSlotInfoKHR );
+
+        //=== VK_AMD_texture_gather_bias_lod ===
+        case VK_STRUCTURE_TYPE_TEXTURE_LOD_GATHER_FORMAT_PROPERTIES_AMD: return sizeof( VkTextureLODGatherFormatPropertiesAMD );
+
+#if defined( VK_USE_PLATFORM_GGP )
+        //=== VK_GGP_stream_descriptor_surface ===
+        case VK_STRUCTURE_TYPE_STREAM_DESCRIPTOR_SURFACE_CREATE_INFO_GGP: return sizeof( VkStreamDescriptorSurfaceCreateInfoGGP );
+#endif /*VK_USE_PLATFORM_GGP*/
+
+        //=== VK_NV_corner_sampled_image ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CORNER_SAMPLED_IMAGE_FEATURES_NV: return sizeof( VkPhysicalDeviceCornerSampledImageFeaturesNV );
+
+        //=== VK_NV_external_memory ===
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV: return sizeof( VkExternalMemoryImageCreateInfoNV );
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV      : return sizeof( VkExportMemoryAllocateInfoNV );
+
+#if defined( VK_USE_PLATFORM_WIN32_KHR )
+        //=== VK_NV_external_memory_win32 ===
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_NV: return sizeof( VkImportMemoryWin32HandleInfoNV );
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_NV: return sizeof( VkExportMemoryWin32HandleInfoNV );
+#endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+#if defined( VK_USE_PLATFORM_WIN32_KHR )
+        //=== VK_NV_win32_keyed_mutex ===
+        case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV: return sizeof( VkWin32KeyedMutexAcquireReleaseInfoNV );
+#endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+        //=== VK_EXT_validation_flags ===
+        case VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT: return sizeof( VkValidationFlagsEXT );
+
+#if defined( VK_USE_PLATFORM_VI_NN )
+        //=== VK_NN_vi_surface ===
+        case VK_STRUCTURE_TYPE_VI_SURFACE_CREATE_INFO_NN: return sizeof( VkViSurfaceCreateInfoNN );
+#endif /*VK_USE_PLATFORM_VI_NN*/
+
+        //=== VK_EXT_astc_decode_mode ===
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT         : return sizeof( VkImageViewASTCDecodeModeEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ASTC_DECODE_FEATURES_EXT: return sizeof( VkPhysicalDeviceASTCDecodeFeaturesEXT );
+
+#if defined( VK_USE_PLATFORM_WIN32_KHR )
+        //=== VK_KHR_external_memory_win32 ===
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR: return sizeof( VkImportMemoryWin32HandleInfoKHR );
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR: return sizeof( VkExportMemoryWin32HandleInfoKHR );
+        case VK_STRUCTURE_TYPE_MEMORY_WIN32_HANDLE_PROPERTIES_KHR : return sizeof( VkMemoryWin32HandlePropertiesKHR );
+        case VK_STRUCTURE_TYPE_MEMORY_GET_WIN32_HANDLE_INFO_KHR   : return sizeof( VkMemoryGetWin32HandleInfoKHR );
+#endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+        //=== VK_KHR_external_memory_fd ===
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR: return sizeof( VkImportMemoryFdInfoKHR );
+        case VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR : return sizeof( VkMemoryFdPropertiesKHR );
+        case VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR   : return sizeof( VkMemoryGetFdInfoKHR );
+
+#if defined( VK_USE_PLATFORM_WIN32_KHR )
+        //=== VK_KHR_win32_keyed_mutex ===
+        case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR: return sizeof( VkWin32KeyedMutexAcquireReleaseInfoKHR );
+#endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+#if defined( VK_USE_PLATFORM_WIN32_KHR )
+        //=== VK_KHR_external_semaphore_win32 ===
+        case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR: return sizeof( VkImportSemaphoreWin32HandleInfoKHR );
+        case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR: return sizeof( VkExportSemaphoreWin32HandleInfoKHR );
+        case VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR           : return sizeof( VkD3D12FenceSubmitInfoKHR );
+        case VK_STRUCTURE_TYPE_SEMAPHORE_GET_WIN32_HANDLE_INFO_KHR   : return sizeof( VkSemaphoreGetWin32HandleInfoKHR );
+#endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+        //=== VK_KHR_external_semaphore_fd ===
+        case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHR: return sizeof( VkImportSemaphoreFdInfoKHR );
+        case VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR   : return sizeof( VkSemaphoreGetFdInfoKHR );
+
+        //=== VK_EXT_conditional_rendering ===
+        case VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT                     : return sizeof( VkConditionalRenderingBeginInfoEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT       : return sizeof( VkPhysicalDeviceConditionalRenderingFeaturesEXT );
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT:
+          return sizeof( VkCommandBufferInheritanceConditionalRenderingInfoEXT );
+
+        //=== VK_KHR_incremental_present ===
+        case VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR: return sizeof( VkPresentRegionsKHR );
+
+        //=== VK_NV_clip_space_w_scaling ===
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV: return sizeof( VkPipelineViewportWScalingStateCreateInfoNV );
+
+        //=== VK_EXT_display_surface_counter ===
+        case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_EXT: return sizeof( VkSurfaceCapabilities2EXT );
+
+        //=== VK_EXT_display_control ===
+        case VK_STRUCTURE_TYPE_DISPLAY_POWER_INFO_EXT           : return sizeof( VkDisplayPowerInfoEXT );
+        case VK_STRUCTURE_TYPE_DEVICE_EVENT_INFO_EXT            : return sizeof( VkDeviceEventInfoEXT );
+        case VK_STRUCTURE_TYPE_DISPLAY_EVENT_INFO_EXT           : return sizeof( VkDisplayEventInfoEXT );
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT: return sizeof( VkSwapchainCounterCreateInfoEXT );
+
+        //=== VK_GOOGLE_display_timing ===
+        case VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE: return sizeof( VkPresentTimesInfoGOOGLE );
+
+        //=== VK_NVX_multiview_per_view_attributes ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_ATTRIBUTES_PROPERTIES_NVX:
+          return sizeof( VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX );
+        case VK_STRUCTURE_TYPE_MULTIVIEW_PER_VIEW_ATTRIBUTES_INFO_NVX                      : return sizeof( VkMultiviewPerViewAttributesInfoNVX );
+
+        //=== VK_NV_viewport_swizzle ===
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV: return sizeof( VkPipelineViewportSwizzleStateCreateInfoNV );
+
+        //=== VK_EXT_discard_rectangles ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceDiscardRectanglePropertiesEXT );
+        case VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT: return sizeof( VkPipelineDiscardRectangleStateCreateInfoEXT );
+
+        //=== VK_EXT_conservative_rasterization ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT:
+          return sizeof( VkPhysicalDeviceConservativeRasterizationPropertiesEXT );
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT:
+          return sizeof( VkPipelineRasterizationConservativeStateCreateInfoEXT );
+
+        //=== VK_EXT_depth_clip_enable ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_ENABLE_FEATURES_EXT         : return sizeof( VkPhysicalDeviceDepthClipEnableFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT: return sizeof( VkPipelineRasterizationDepthClipStateCreateInfoEXT );
+
+        //=== VK_EXT_hdr_metadata ===
+        case VK_STRUCTURE_TYPE_HDR_METADATA_EXT: return sizeof( VkHdrMetadataEXT );
+
+        //=== VK_IMG_relaxed_line_rasterization ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RELAXED_LINE_RASTERIZATION_FEATURES_IMG: return sizeof( VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG );
+
+        //=== VK_KHR_shared_presentable_image ===
+        case VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR: return sizeof( VkSharedPresentSurfaceCapabilitiesKHR );
+
+#if defined( VK_USE_PLATFORM_WIN32_KHR )
+        //=== VK_KHR_external_fence_win32 ===
+        case VK_STRUCTURE_TYPE_IMPORT_FENCE_WIN32_HANDLE_INFO_KHR: return sizeof( VkImportFenceWin32HandleInfoKHR );
+        case VK_STRUCTURE_TYPE_EXPORT_FENCE_WIN32_HANDLE_INFO_KHR: return sizeof( VkExportFenceWin32HandleInfoKHR );
+        case VK_STRUCTURE_TYPE_FENCE_GET_WIN32_HANDLE_INFO_KHR   : return sizeof( VkFenceGetWin32HandleInfoKHR );
+#endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+        //=== VK_KHR_external_fence_fd ===
+        case VK_STRUCTURE_TYPE_IMPORT_FENCE_FD_INFO_KHR: return sizeof( VkImportFenceFdInfoKHR );
+        case VK_STRUCTURE_TYPE_FENCE_GET_FD_INFO_KHR   : return sizeof( VkFenceGetFdInfoKHR );
+
+        //=== VK_KHR_performance_query ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_FEATURES_KHR  : return sizeof( VkPhysicalDevicePerformanceQueryFeaturesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_PROPERTIES_KHR: return sizeof( VkPhysicalDevicePerformanceQueryPropertiesKHR );
+        case VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_KHR                         : return sizeof( VkPerformanceCounterKHR );
+        case VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_DESCRIPTION_KHR             : return sizeof( VkPerformanceCounterDescriptionKHR );
+        case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_CREATE_INFO_KHR          : return sizeof( VkQueryPoolPerformanceCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_ACQUIRE_PROFILING_LOCK_INFO_KHR                 : return sizeof( VkAcquireProfilingLockInfoKHR );
+        case VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR               : return sizeof( VkPerformanceQuerySubmitInfoKHR );
+
+        //=== VK_KHR_get_surface_capabilities2 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR: return sizeof( VkPhysicalDeviceSurfaceInfo2KHR );
+        case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_KHR        : return sizeof( VkSurfaceCapabilities2KHR );
+        case VK_STRUCTURE_TYPE_SURFACE_FORMAT_2_KHR              : return sizeof( VkSurfaceFormat2KHR );
+
+        //=== VK_KHR_get_display_properties2 ===
+        case VK_STRUCTURE_TYPE_DISPLAY_PROPERTIES_2_KHR        : return sizeof( VkDisplayProperties2KHR );
+        case VK_STRUCTURE_TYPE_DISPLAY_PLANE_PROPERTIES_2_KHR  : return sizeof( VkDisplayPlaneProperties2KHR );
+        case VK_STRUCTURE_TYPE_DISPLAY_MODE_PROPERTIES_2_KHR   : return sizeof( VkDisplayModeProperties2KHR );
+        case VK_STRUCTURE_TYPE_DISPLAY_PLANE_INFO_2_KHR        : return sizeof( VkDisplayPlaneInfo2KHR );
+        case VK_STRUCTURE_TYPE_DISPLAY_PLANE_CAPABILITIES_2_KHR: return sizeof( VkDisplayPlaneCapabilities2KHR );
+
+#if defined( VK_USE_PLATFORM_IOS_MVK )
+        //=== VK_MVK_ios_surface ===
+        case VK_STRUCTURE_TYPE_IOS_SURFACE_CREATE_INFO_MVK: return sizeof( VkIOSSurfaceCreateInfoMVK );
+#endif /*VK_USE_PLATFORM_IOS_MVK*/
+
+#if defined( VK_USE_PLATFORM_MACOS_MVK )
+        //=== VK_MVK_macos_surface ===
+        case VK_STRUCTURE_TYPE_MACOS_SURFACE_CREATE_INFO_MVK: return sizeof( VkMacOSSurfaceCreateInfoMVK );
+#endif /*VK_USE_PLATFORM_MACOS_MVK*/
+
+        //=== VK_EXT_debug_utils ===
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT                  : return sizeof( VkDebugUtilsLabelEXT );
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT: return sizeof( VkDebugUtilsMessengerCallbackDataEXT );
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT  : return sizeof( VkDebugUtilsMessengerCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT       : return sizeof( VkDebugUtilsObjectNameInfoEXT );
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_TAG_INFO_EXT        : return sizeof( VkDebugUtilsObjectTagInfoEXT );
+
+#if defined( VK_USE_PLATFORM_ANDROID_KHR )
+        //=== VK_ANDROID_external_memory_android_hardware_buffer ===
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_USAGE_ANDROID              : return sizeof( VkAndroidHardwareBufferUsageANDROID );
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_PROPERTIES_ANDROID         : return sizeof( VkAndroidHardwareBufferPropertiesANDROID );
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID  : return sizeof( VkAndroidHardwareBufferFormatPropertiesANDROID );
+        case VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID        : return sizeof( VkImportAndroidHardwareBufferInfoANDROID );
+        case VK_STRUCTURE_TYPE_MEMORY_GET_ANDROID_HARDWARE_BUFFER_INFO_ANDROID    : return sizeof( VkMemoryGetAndroidHardwareBufferInfoANDROID );
+        case VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID                            : return sizeof( VkExternalFormatANDROID );
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_2_ANDROID: return sizeof( VkAndroidHardwareBufferFormatProperties2ANDROID );
+#endif /*VK_USE_PLATFORM_ANDROID_KHR*/
+
+        //=== VK_AMD_gpa_interface ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GPA_FEATURES_AMD    : return sizeof( VkPhysicalDeviceGpaFeaturesAMD );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GPA_PROPERTIES_AMD  : return sizeof( VkPhysicalDeviceGpaPropertiesAMD );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GPA_PROPERTIES_2_AMD: return sizeof( VkPhysicalDeviceGpaProperties2AMD );
+        case VK_STRUCTURE_TYPE_GPA_SAMPLE_BEGIN_INFO_AMD           : return sizeof( VkGpaSampleBeginInfoAMD );
+        case VK_STRUCTURE_TYPE_GPA_DEVICE_CLOCK_MODE_INFO_AMD      : return sizeof( VkGpaDeviceClockModeInfoAMD );
+        case VK_STRUCTURE_TYPE_GPA_DEVICE_GET_CLOCK_INFO_AMD       : return sizeof( VkGpaDeviceGetClockInfoAMD );
+        case VK_STRUCTURE_TYPE_GPA_SESSION_CREATE_INFO_AMD         : return sizeof( VkGpaSessionCreateInfoAMD );
+
+#if defined( VK_ENABLE_BETA_EXTENSIONS )
+        //=== VK_AMDX_shader_enqueue ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ENQUEUE_FEATURES_AMDX  : return sizeof( VkPhysicalDeviceShaderEnqueueFeaturesAMDX );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ENQUEUE_PROPERTIES_AMDX: return sizeof( VkPhysicalDeviceShaderEnqueuePropertiesAMDX );
+        case VK_STRUCTURE_TYPE_EXECUTION_GRAPH_PIPELINE_SCRATCH_SIZE_AMDX    : return sizeof( VkExecutionGraphPipelineScratchSizeAMDX );
+        case VK_STRUCTURE_TYPE_EXECUTION_GRAPH_PIPELINE_CREATE_INFO_AMDX     : return sizeof( VkExecutionGraphPipelineCreateInfoAMDX );
+        case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_NODE_CREATE_INFO_AMDX   : return sizeof( VkPipelineShaderStageNodeCreateInfoAMDX );
+#endif /*VK_ENABLE_BETA_EXTENSIONS*/
+
+        //=== VK_EXT_descriptor_heap ===
+        case VK_STRUCTURE_TYPE_TEXEL_BUFFER_DESCRIPTOR_INFO_EXT                     : return sizeof( VkTexelBufferDescriptorInfoEXT );
+        case VK_STRUCTURE_TYPE_IMAGE_DESCRIPTOR_INFO_EXT                            : return sizeof( VkImageDescriptorInfoEXT );
+        case VK_STRUCTURE_TYPE_RESOURCE_DESCRIPTOR_INFO_EXT                         : return sizeof( VkResourceDescriptorInfoEXT );
+        case VK_STRUCTURE_TYPE_BIND_HEAP_INFO_EXT                                   : return sizeof( VkBindHeapInfoEXT );
+        case VK_STRUCTURE_TYPE_PUSH_DATA_INFO_EXT                                   : return sizeof( VkPushDataInfoEXT );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_AND_BINDING_MAPPING_EXT               : return sizeof( VkDescriptorSetAndBindingMappingEXT );
+        case VK_STRUCTURE_TYPE_SHADER_DESCRIPTOR_SET_AND_BINDING_MAPPING_INFO_EXT   : return sizeof( VkShaderDescriptorSetAndBindingMappingInfoEXT );
+        case VK_STRUCTURE_TYPE_OPAQUE_CAPTURE_DATA_CREATE_INFO_EXT                  : return sizeof( VkOpaqueCaptureDataCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_HEAP_FEATURES_EXT         : return sizeof( VkPhysicalDeviceDescriptorHeapFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_HEAP_PROPERTIES_EXT       : return sizeof( VkPhysicalDeviceDescriptorHeapPropertiesEXT );
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_DESCRIPTOR_HEAP_INFO_EXT  : return sizeof( VkCommandBufferInheritanceDescriptorHeapInfoEXT );
+        case VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_INDEX_CREATE_INFO_EXT    : return sizeof( VkSamplerCustomBorderColorIndexCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_PUSH_DATA_TOKEN_NV          : return sizeof( VkIndirectCommandsLayoutPushDataTokenNV );
+        case VK_STRUCTURE_TYPE_SUBSAMPLED_IMAGE_FORMAT_PROPERTIES_EXT               : return sizeof( VkSubsampledImageFormatPropertiesEXT );
+        case VK_STRUCTURE_TYPE_TENSOR_VIEW_CREATE_INFO_ARM                          : return sizeof( VkTensorViewCreateInfoARM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_HEAP_TENSOR_PROPERTIES_ARM: return sizeof( VkPhysicalDeviceDescriptorHeapTensorPropertiesARM );
+
+        //=== VK_AMD_mixed_attachment_samples ===
+        case VK_STRUCTURE_TYPE_ATTACHMENT_SAMPLE_COUNT_INFO_AMD: return sizeof( VkAttachmentSampleCountInfoAMD );
+
+        //=== VK_KHR_shader_bfloat16 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_BFLOAT16_FEATURES_KHR: return sizeof( VkPhysicalDeviceShaderBfloat16FeaturesKHR );
+
+        //=== VK_EXT_sample_locations ===
+        case VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT                      : return sizeof( VkSampleLocationsInfoEXT );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT    : return sizeof( VkRenderPassSampleLocationsBeginInfoEXT );
+        case VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT: return sizeof( VkPipelineSampleLocationsStateCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceSampleLocationsPropertiesEXT );
+        case VK_STRUCTURE_TYPE_MULTISAMPLE_PROPERTIES_EXT                     : return sizeof( VkMultisamplePropertiesEXT );
+
+        //=== VK_EXT_blend_operation_advanced ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_FEATURES_EXT  : return sizeof( VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT );
+        case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT    : return sizeof( VkPipelineColorBlendAdvancedStateCreateInfoEXT );
+
+        //=== VK_NV_fragment_coverage_to_color ===
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV: return sizeof( VkPipelineCoverageToColorStateCreateInfoNV );
+
+        //=== VK_KHR_acceleration_structure ===
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR   : return sizeof( VkAccelerationStructureGeometryTrianglesDataKHR );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR       : return sizeof( VkAccelerationStructureBuildGeometryInfoKHR );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_AABBS_DATA_KHR       : return sizeof( VkAccelerationStructureGeometryAabbsDataKHR );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR   : return sizeof( VkAccelerationStructureGeometryInstancesDataKHR );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR                  : return sizeof( VkAccelerationStructureGeometryKHR );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR               : return sizeof( VkAccelerationStructureCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR      : return sizeof( VkWriteDescriptorSetAccelerationStructureKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR  : return sizeof( VkPhysicalDeviceAccelerationStructureFeaturesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR: return sizeof( VkPhysicalDeviceAccelerationStructurePropertiesKHR );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR       : return sizeof( VkAccelerationStructureDeviceAddressInfoKHR );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_VERSION_INFO_KHR              : return sizeof( VkAccelerationStructureVersionInfoKHR );
+        case VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_TO_MEMORY_INFO_KHR       : return sizeof( VkCopyAccelerationStructureToMemoryInfoKHR );
+        case VK_STRUCTURE_TYPE_COPY_MEMORY_TO_ACCELERATION_STRUCTURE_INFO_KHR       : return sizeof( VkCopyMemoryToAccelerationStructureInfoKHR );
+        case VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR                 : return sizeof( VkCopyAccelerationStructureInfoKHR );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR          : return sizeof( VkAccelerationStructureBuildSizesInfoKHR );
+
+        //=== VK_KHR_ray_tracing_pipeline ===
+        case VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_KHR           : return sizeof( VkRayTracingShaderGroupCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_KHR               : return sizeof( VkRayTracingPipelineCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_FEATURES_KHR  : return sizeof( VkPhysicalDeviceRayTracingPipelineFeaturesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR: return sizeof( VkPhysicalDeviceRayTracingPipelinePropertiesKHR );
+        case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_INTERFACE_CREATE_INFO_KHR     : return sizeof( VkRayTracingPipelineInterfaceCreateInfoKHR );
+
+        //=== VK_KHR_ray_query ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR: return sizeof( VkPhysicalDeviceRayQueryFeaturesKHR );
+
+        //=== VK_NV_framebuffer_mixed_samples ===
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV: return sizeof( VkPipelineCoverageModulationStateCreateInfoNV );
+
+        //=== VK_NV_shader_sm_builtins ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_PROPERTIES_NV: return sizeof( VkPhysicalDeviceShaderSMBuiltinsPropertiesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_FEATURES_NV  : return sizeof( VkPhysicalDeviceShaderSMBuiltinsFeaturesNV );
+
+        //=== VK_EXT_image_drm_format_modifier ===
+        case VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT           : return sizeof( VkDrmFormatModifierPropertiesListEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT: return sizeof( VkPhysicalDeviceImageDrmFormatModifierInfoEXT );
+        case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT    : return sizeof( VkImageDrmFormatModifierListCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT: return sizeof( VkImageDrmFormatModifierExplicitCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_PROPERTIES_EXT          : return sizeof( VkImageDrmFormatModifierPropertiesEXT );
+        case VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_2_EXT         : return sizeof( VkDrmFormatModifierPropertiesList2EXT );
+
+        //=== VK_EXT_validation_cache ===
+        case VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT              : return sizeof( VkValidationCacheCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT: return sizeof( VkShaderModuleValidationCacheCreateInfoEXT );
+
+#if defined( VK_ENABLE_BETA_EXTENSIONS )
+        //=== VK_KHR_portability_subset ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR  : return sizeof( VkPhysicalDevicePortabilitySubsetFeaturesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR: return sizeof( VkPhysicalDevicePortabilitySubsetPropertiesKHR );
+#endif /*VK_ENABLE_BETA_EXTENSIONS*/
+
+        //=== VK_NV_shading_rate_image ===
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SHADING_RATE_IMAGE_STATE_CREATE_INFO_NV : return sizeof( VkPipelineViewportShadingRateImageStateCreateInfoNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_FEATURES_NV            : return sizeof( VkPhysicalDeviceShadingRateImageFeaturesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_PROPERTIES_NV          : return sizeof( VkPhysicalDeviceShadingRateImagePropertiesNV );
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_COARSE_SAMPLE_ORDER_STATE_CREATE_INFO_NV:
+          return sizeof( VkPipelineViewportCoarseSampleOrderStateCreateInfoNV );
+
+        //=== VK_NV_ray_tracing ===
+        case VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_NV           : return sizeof( VkRayTracingShaderGroupCreateInfoNV );
+        case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_NV               : return sizeof( VkRayTracingPipelineCreateInfoNV );
+        case VK_STRUCTURE_TYPE_GEOMETRY_TRIANGLES_NV                             : return sizeof( VkGeometryTrianglesNV );
+        case VK_STRUCTURE_TYPE_GEOMETRY_AABB_NV                                  : return sizeof( VkGeometryAABBNV );
+        case VK_STRUCTURE_TYPE_GEOMETRY_NV                                       : return sizeof( VkGeometryNV );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_INFO_NV                    : return sizeof( VkAccelerationStructureInfoNV );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_NV             : return sizeof( VkAccelerationStructureCreateInfoNV );
+        case VK_STRUCTURE_TYPE_BIND_ACCELERATION_STRUCTURE_MEMORY_INFO_NV        : return sizeof( VkBindAccelerationStructureMemoryInfoNV );
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV    : return sizeof( VkWriteDescriptorSetAccelerationStructureNV );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MEMORY_REQUIREMENTS_INFO_NV: return sizeof( VkAccelerationStructureMemoryRequirementsInfoNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PROPERTIES_NV         : return sizeof( VkPhysicalDeviceRayTracingPropertiesNV );
+
+        //=== VK_NV_representative_fragment_test ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_REPRESENTATIVE_FRAGMENT_TEST_FEATURES_NV:
+          return sizeof( VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV );
+        case VK_STRUCTURE_TYPE_PIPELINE_REPRESENTATIVE_FRAGMENT_TEST_STATE_CREATE_INFO_NV:
+          return sizeof( VkPipelineRepresentativeFragmentTestStateCreateInfoNV );
+
+        //=== VK_EXT_filter_cubic ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT   : return sizeof( VkPhysicalDeviceImageViewImageFormatInfoEXT );
+        case VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT: return sizeof( VkFilterCubicImageViewImageFormatPropertiesEXT );
+
+        //=== VK_QCOM_cooperative_matrix_conversion ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_CONVERSION_FEATURES_QCOM:
+          return sizeof( VkPhysicalDeviceCooperativeMatrixConversionFeaturesQCOM );
+
+        //=== VK_QCOM_elapsed_timer_query ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ELAPSED_TIMER_QUERY_FEATURES_QCOM: return sizeof( VkPhysicalDeviceElapsedTimerQueryFeaturesQCOM );
+
+        //=== VK_EXT_external_memory_host ===
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT                : return sizeof( VkImportMemoryHostPointerInfoEXT );
+        case VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT                 : return sizeof( VkMemoryHostPointerPropertiesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceExternalMemoryHostPropertiesEXT );
+
+        //=== VK_KHR_shader_clock ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CLOCK_FEATURES_KHR: return sizeof( VkPhysicalDeviceShaderClockFeaturesKHR );
+
+        //=== VK_AMD_pipeline_compiler_control ===
+        case VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREATE_INFO_AMD: return sizeof( VkPipelineCompilerControlCreateInfoAMD );
+
+        //=== VK_AMD_shader_core_properties ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_AMD: return sizeof( VkPhysicalDeviceShaderCorePropertiesAMD );
+
+        //=== VK_KHR_video_decode_h265 ===
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PROFILE_INFO_KHR                  : return sizeof( VkVideoDecodeH265ProfileInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_CAPABILITIES_KHR                  : return sizeof( VkVideoDecodeH265CapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_CREATE_INFO_KHR: return sizeof( VkVideoDecodeH265SessionParametersCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_ADD_INFO_KHR   : return sizeof( VkVideoDecodeH265SessionParametersAddInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PICTURE_INFO_KHR                  : return sizeof( VkVideoDecodeH265PictureInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_DPB_SLOT_INFO_KHR                 : return sizeof( VkVideoDecodeH265DpbSlotInfoKHR );
+
+        //=== VK_AMD_memory_overallocation_behavior ===
+        case VK_STRUCTURE_TYPE_DEVICE_MEMORY_OVERALLOCATION_CREATE_INFO_AMD: return sizeof( VkDeviceMemoryOverallocationCreateInfoAMD );
+
+        //=== VK_EXT_vertex_attribute_divisor ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT );
+
+#if defined( VK_USE_PLATFORM_GGP )
+        //=== VK_GGP_frame_token ===
+        case VK_STRUCTURE_TYPE_PRESENT_FRAME_TOKEN_GGP: return sizeof( VkPresentFrameTokenGGP );
+#endif /*VK_USE_PLATFORM_GGP*/
+
+        //=== VK_NV_mesh_shader ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV  : return sizeof( VkPhysicalDeviceMeshShaderFeaturesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_NV: return sizeof( VkPhysicalDeviceMeshShaderPropertiesNV );
+
+        //=== VK_NV_shader_image_footprint ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_FOOTPRINT_FEATURES_NV: return sizeof( VkPhysicalDeviceShaderImageFootprintFeaturesNV );
+
+        //=== VK_NV_scissor_exclusive ===
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_EXCLUSIVE_SCISSOR_STATE_CREATE_INFO_NV: return sizeof( VkPipelineViewportExclusiveScissorStateCreateInfoNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXCLUSIVE_SCISSOR_FEATURES_NV           : return sizeof( VkPhysicalDeviceExclusiveScissorFeaturesNV );
+
+        //=== VK_NV_device_diagnostic_checkpoints ===
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV  : return sizeof( VkQueueFamilyCheckpointPropertiesNV );
+        case VK_STRUCTURE_TYPE_CHECKPOINT_DATA_NV                     : return sizeof( VkCheckpointDataNV );
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_2_NV: return sizeof( VkQueueFamilyCheckpointProperties2NV );
+        case VK_STRUCTURE_TYPE_CHECKPOINT_DATA_2_NV                   : return sizeof( VkCheckpointData2NV );
+
+        //=== VK_EXT_present_timing ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_TIMING_FEATURES_EXT: return sizeof( VkPhysicalDevicePresentTimingFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PRESENT_TIMING_SURFACE_CAPABILITIES_EXT    : return sizeof( VkPresentTimingSurfaceCapabilitiesEXT );
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_CALIBRATED_TIMESTAMP_INFO_EXT    : return sizeof( VkSwapchainCalibratedTimestampInfoEXT );
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_TIMING_PROPERTIES_EXT            : return sizeof( VkSwapchainTimingPropertiesEXT );
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_TIME_DOMAIN_PROPERTIES_EXT       : return sizeof( VkSwapchainTimeDomainPropertiesEXT );
+        case VK_STRUCTURE_TYPE_PAST_PRESENTATION_TIMING_INFO_EXT          : return sizeof( VkPastPresentationTimingInfoEXT );
+        case VK_STRUCTURE_TYPE_PAST_PRESENTATION_TIMING_PROPERTIES_EXT    : return sizeof( VkPastPresentationTimingPropertiesEXT );
+        case VK_STRUCTURE_TYPE_PAST_PRESENTATION_TIMING_EXT               : return sizeof( VkPastPresentationTimingEXT );
+        case VK_STRUCTURE_TYPE_PRESENT_TIMINGS_INFO_EXT                   : return sizeof( VkPresentTimingsInfoEXT );
+        case VK_STRUCTURE_TYPE_PRESENT_TIMING_INFO_EXT                    : return sizeof( VkPresentTimingInfoEXT );
+
+        //=== VK_INTEL_shader_integer_functions2 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_FUNCTIONS_2_FEATURES_INTEL: return sizeof( VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL );
+
+        //=== VK_INTEL_performance_query ===
+        case VK_STRUCTURE_TYPE_INITIALIZE_PERFORMANCE_API_INFO_INTEL         : return sizeof( VkInitializePerformanceApiInfoINTEL );
+        case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_QUERY_CREATE_INFO_INTEL: return sizeof( VkQueryPoolPerformanceQueryCreateInfoINTEL );
+        case VK_STRUCTURE_TYPE_PERFORMANCE_MARKER_INFO_INTEL                 : return sizeof( VkPerformanceMarkerInfoINTEL );
+        case VK_STRUCTURE_TYPE_PERFORMANCE_STREAM_MARKER_INFO_INTEL          : return sizeof( VkPerformanceStreamMarkerInfoINTEL );
+        case VK_STRUCTURE_TYPE_PERFORMANCE_OVERRIDE_INFO_INTEL               : return sizeof( VkPerformanceOverrideInfoINTEL );
+        case VK_STRUCTURE_TYPE_PERFORMANCE_CONFIGURATION_ACQUIRE_INFO_INTEL  : return sizeof( VkPerformanceConfigurationAcquireInfoINTEL );
+
+        //=== VK_EXT_pci_bus_info ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT: return sizeof( VkPhysicalDevicePCIBusInfoPropertiesEXT );
+
+        //=== VK_AMD_display_native_hdr ===
+        case VK_STRUCTURE_TYPE_DISPLAY_NATIVE_HDR_SURFACE_CAPABILITIES_AMD : return sizeof( VkDisplayNativeHdrSurfaceCapabilitiesAMD );
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_DISPLAY_NATIVE_HDR_CREATE_INFO_AMD: return sizeof( VkSwapchainDisplayNativeHdrCreateInfoAMD );
+
+#if defined( VK_USE_PLATFORM_FUCHSIA )
+        //=== VK_FUCHSIA_imagepipe_surface ===
+        case VK_STRUCTURE_TYPE_IMAGEPIPE_SURFACE_CREATE_INFO_FUCHSIA: return sizeof( VkImagePipeSurfaceCreateInfoFUCHSIA );
+#endif /*VK_USE_PLATFORM_FUCHSIA*/
+
+#if defined( VK_USE_PLATFORM_METAL_EXT )
+        //=== VK_EXT_metal_surface ===
+        case VK_STRUCTURE_TYPE_METAL_SURFACE_CREATE_INFO_EXT: return sizeof( VkMetalSurfaceCreateInfoEXT );
+#endif /*VK_USE_PLATFORM_METAL_EXT*/
+
+        //=== VK_EXT_fragment_density_map ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_FEATURES_EXT  : return sizeof( VkPhysicalDeviceFragmentDensityMapFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceFragmentDensityMapPropertiesEXT );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT   : return sizeof( VkRenderPassFragmentDensityMapCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_DENSITY_MAP_ATTACHMENT_INFO_EXT : return sizeof( VkRenderingFragmentDensityMapAttachmentInfoEXT );
+
+        //=== VK_KHR_fragment_shading_rate ===
+        case VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR           : return sizeof( VkFragmentShadingRateAttachmentInfoKHR );
+        case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR: return sizeof( VkPipelineFragmentShadingRateStateCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR  : return sizeof( VkPhysicalDeviceFragmentShadingRateFeaturesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR: return sizeof( VkPhysicalDeviceFragmentShadingRatePropertiesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_KHR           : return sizeof( VkPhysicalDeviceFragmentShadingRateKHR );
+        case VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR : return sizeof( VkRenderingFragmentShadingRateAttachmentInfoKHR );
+
+        //=== VK_AMD_shader_core_properties2 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_2_AMD: return sizeof( VkPhysicalDeviceShaderCoreProperties2AMD );
+
+        //=== VK_AMD_device_coherent_memory ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COHERENT_MEMORY_FEATURES_AMD: return sizeof( VkPhysicalDeviceCoherentMemoryFeaturesAMD );
+
+        //=== VK_KHR_shader_constant_data ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CONSTANT_DATA_FEATURES_KHR: return sizeof( VkPhysicalDeviceShaderConstantDataFeaturesKHR );
+
+        //=== VK_KHR_shader_abort ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ABORT_FEATURES_KHR  : return sizeof( VkPhysicalDeviceShaderAbortFeaturesKHR );
+        case VK_STRUCTURE_TYPE_DEVICE_FAULT_SHADER_ABORT_MESSAGE_INFO_KHR : return sizeof( VkDeviceFaultShaderAbortMessageInfoKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ABORT_PROPERTIES_KHR: return sizeof( VkPhysicalDeviceShaderAbortPropertiesKHR );
+
+        //=== VK_EXT_shader_image_atomic_int64 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_ATOMIC_INT64_FEATURES_EXT: return sizeof( VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT );
+
+        //=== VK_KHR_shader_quad_control ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_QUAD_CONTROL_FEATURES_KHR: return sizeof( VkPhysicalDeviceShaderQuadControlFeaturesKHR );
+
+        //=== VK_EXT_memory_budget ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceMemoryBudgetPropertiesEXT );
+
+        //=== VK_EXT_memory_priority ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT: return sizeof( VkPhysicalDeviceMemoryPriorityFeaturesEXT );
+        case VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT           : return sizeof( VkMemoryPriorityAllocateInfoEXT );
+
+        //=== VK_KHR_surface_protected_capabilities ===
+        case VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR: return sizeof( VkSurfaceProtectedCapabilitiesKHR );
+
+        //=== VK_NV_dedicated_allocation_image_aliasing ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEDICATED_ALLOCATION_IMAGE_ALIASING_FEATURES_NV:
+          return sizeof( VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV );
+
+        //=== VK_EXT_buffer_device_address ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_EXT: return sizeof( VkPhysicalDeviceBufferDeviceAddressFeaturesEXT );
+        case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_CREATE_INFO_EXT             : return sizeof( VkBufferDeviceAddressCreateInfoEXT );
+
+        //=== VK_EXT_validation_features ===
+        case VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT: return sizeof( VkValidationFeaturesEXT );
+
+        //=== VK_KHR_present_wait ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR: return sizeof( VkPhysicalDevicePresentWaitFeaturesKHR );
+
+        //=== VK_NV_cooperative_matrix ===
+        case VK_STRUCTURE_TYPE_COOPERATIVE_MATRIX_PROPERTIES_NV                : return sizeof( VkCooperativeMatrixPropertiesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_FEATURES_NV  : return sizeof( VkPhysicalDeviceCooperativeMatrixFeaturesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_PROPERTIES_NV: return sizeof( VkPhysicalDeviceCooperativeMatrixPropertiesNV );
+
+        //=== VK_NV_coverage_reduction_mode ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COVERAGE_REDUCTION_MODE_FEATURES_NV: return sizeof( VkPhysicalDeviceCoverageReductionModeFeaturesNV );
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_REDUCTION_STATE_CREATE_INFO_NV   : return sizeof( VkPipelineCoverageReductionStateCreateInfoNV );
+        case VK_STRUCTURE_TYPE_FRAMEBUFFER_MIXED_SAMPLES_COMBINATION_NV           : return sizeof( VkFramebufferMixedSamplesCombinationNV );
+
+        //=== VK_EXT_fragment_shader_interlock ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_INTERLOCK_FEATURES_EXT: return sizeof( VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT );
+
+        //=== VK_EXT_ycbcr_image_arrays ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_IMAGE_ARRAYS_FEATURES_EXT: return sizeof( VkPhysicalDeviceYcbcrImageArraysFeaturesEXT );
+
+        //=== VK_EXT_provoking_vertex ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_FEATURES_EXT                : return sizeof( VkPhysicalDeviceProvokingVertexFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_PROPERTIES_EXT              : return sizeof( VkPhysicalDeviceProvokingVertexPropertiesEXT );
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT:
+          return sizeof( VkPipelineRasterizationProvokingVertexStateCreateInfoEXT );
+
+#if defined( VK_USE_PLATFORM_WIN32_KHR )
+        //=== VK_EXT_full_screen_exclusive ===
+        case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_INFO_EXT        : return sizeof( VkSurfaceFullScreenExclusiveInfoEXT );
+        case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_FULL_SCREEN_EXCLUSIVE_EXT: return sizeof( VkSurfaceCapabilitiesFullScreenExclusiveEXT );
+        case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT  : return sizeof( VkSurfaceFullScreenExclusiveWin32InfoEXT );
+#endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+        //=== VK_EXT_headless_surface ===
+        case VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT: return sizeof( VkHeadlessSurfaceCreateInfoEXT );
+
+        //=== VK_EXT_shader_atomic_float ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_FEATURES_EXT: return sizeof( VkPhysicalDeviceShaderAtomicFloatFeaturesEXT );
+
+        //=== VK_EXT_extended_dynamic_state ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT: return sizeof( VkPhysicalDeviceExtendedDynamicStateFeaturesEXT );
+
+        //=== VK_KHR_pipeline_executable_properties ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_EXECUTABLE_PROPERTIES_FEATURES_KHR:
+          return sizeof( VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR );
+        case VK_STRUCTURE_TYPE_PIPELINE_INFO_KHR                                          : return sizeof( VkPipelineInfoKHR );
+        case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_PROPERTIES_KHR                         : return sizeof( VkPipelineExecutablePropertiesKHR );
+        case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INFO_KHR                               : return sizeof( VkPipelineExecutableInfoKHR );
+        case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_STATISTIC_KHR                          : return sizeof( VkPipelineExecutableStatisticKHR );
+        case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INTERNAL_REPRESENTATION_KHR            : return sizeof( VkPipelineExecutableInternalRepresentationKHR );
+
+        //=== VK_EXT_map_memory_placed ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAP_MEMORY_PLACED_FEATURES_EXT  : return sizeof( VkPhysicalDeviceMapMemoryPlacedFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAP_MEMORY_PLACED_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceMapMemoryPlacedPropertiesEXT );
+        case VK_STRUCTURE_TYPE_MEMORY_MAP_PLACED_INFO_EXT                      : return sizeof( VkMemoryMapPlacedInfoEXT );
+
+        //=== VK_EXT_shader_atomic_float2 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_2_FEATURES_EXT: return sizeof( VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT );
+
+        //=== VK_NV_device_generated_commands ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_PROPERTIES_NV: return sizeof( VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_NV  : return sizeof( VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV );
+        case VK_STRUCTURE_TYPE_GRAPHICS_SHADER_GROUP_CREATE_INFO_NV                   : return sizeof( VkGraphicsShaderGroupCreateInfoNV );
+        case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_SHADER_GROUPS_CREATE_INFO_NV         : return sizeof( VkGraphicsPipelineShaderGroupsCreateInfoNV );
+        case VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_TOKEN_NV                      : return sizeof( VkIndirectCommandsLayoutTokenNV );
+        case VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_CREATE_INFO_NV                : return sizeof( VkIndirectCommandsLayoutCreateInfoNV );
+        case VK_STRUCTURE_TYPE_GENERATED_COMMANDS_INFO_NV                             : return sizeof( VkGeneratedCommandsInfoNV );
+        case VK_STRUCTURE_TYPE_GENERATED_COMMANDS_MEMORY_REQUIREMENTS_INFO_NV         : return sizeof( VkGeneratedCommandsMemoryRequirementsInfoNV );
+
+        //=== VK_NV_inherited_viewport_scissor ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INHERITED_VIEWPORT_SCISSOR_FEATURES_NV: return sizeof( VkPhysicalDeviceInheritedViewportScissorFeaturesNV );
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_VIEWPORT_SCISSOR_INFO_NV   : return sizeof( VkCommandBufferInheritanceViewportScissorInfoNV );
+
+        //=== VK_EXT_texel_buffer_alignment ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_FEATURES_EXT: return sizeof( VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT );
+
+        //=== VK_QCOM_render_pass_transform ===
+        case VK_STRUCTURE_TYPE_RENDER_PASS_TRANSFORM_BEGIN_INFO_QCOM                     : return sizeof( VkRenderPassTransformBeginInfoQCOM );
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDER_PASS_TRANSFORM_INFO_QCOM:
+          return sizeof( VkCommandBufferInheritanceRenderPassTransformInfoQCOM );
+
+        //=== VK_EXT_depth_bias_control ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_BIAS_CONTROL_FEATURES_EXT: return sizeof( VkPhysicalDeviceDepthBiasControlFeaturesEXT );
+        case VK_STRUCTURE_TYPE_DEPTH_BIAS_INFO_EXT                            : return sizeof( VkDepthBiasInfoEXT );
+        case VK_STRUCTURE_TYPE_DEPTH_BIAS_REPRESENTATION_INFO_EXT             : return sizeof( VkDepthBiasRepresentationInfoEXT );
+
+        //=== VK_EXT_device_memory_report ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_MEMORY_REPORT_FEATURES_EXT: return sizeof( VkPhysicalDeviceDeviceMemoryReportFeaturesEXT );
+        case VK_STRUCTURE_TYPE_DEVICE_DEVICE_MEMORY_REPORT_CREATE_INFO_EXT      : return sizeof( VkDeviceDeviceMemoryReportCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_DEVICE_MEMORY_REPORT_CALLBACK_DATA_EXT           : return sizeof( VkDeviceMemoryReportCallbackDataEXT );
+
+        //=== VK_EXT_custom_border_color ===
+        case VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT       : return sizeof( VkSamplerCustomBorderColorCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceCustomBorderColorPropertiesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_FEATURES_EXT  : return sizeof( VkPhysicalDeviceCustomBorderColorFeaturesEXT );
+
+        //=== VK_EXT_texture_compression_astc_3d ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_3D_FEATURES_EXT: return sizeof( VkPhysicalDeviceTextureCompressionASTC3DFeaturesEXT );
+
+        //=== VK_KHR_pipeline_library ===
+        case VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR: return sizeof( VkPipelineLibraryCreateInfoKHR );
+
+        //=== VK_NV_present_barrier ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_BARRIER_FEATURES_NV: return sizeof( VkPhysicalDevicePresentBarrierFeaturesNV );
+        case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_PRESENT_BARRIER_NV    : return sizeof( VkSurfaceCapabilitiesPresentBarrierNV );
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_BARRIER_CREATE_INFO_NV   : return sizeof( VkSwapchainPresentBarrierCreateInfoNV );
+
+        //=== VK_KHR_present_id ===
+        case VK_STRUCTURE_TYPE_PRESENT_ID_KHR                         : return sizeof( VkPresentIdKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR: return sizeof( VkPhysicalDevicePresentIdFeaturesKHR );
+
+        //=== VK_KHR_video_encode_queue ===
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_INFO_KHR                              : return sizeof( VkVideoEncodeInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR                      : return sizeof( VkVideoEncodeCapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_QUERY_POOL_VIDEO_ENCODE_FEEDBACK_CREATE_INFO_KHR   : return sizeof( VkQueryPoolVideoEncodeFeedbackCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_USAGE_INFO_KHR                        : return sizeof( VkVideoEncodeUsageInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_INFO_KHR                 : return sizeof( VkVideoEncodeRateControlInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_LAYER_INFO_KHR           : return sizeof( VkVideoEncodeRateControlLayerInfoKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_ENCODE_QUALITY_LEVEL_INFO_KHR: return sizeof( VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_QUALITY_LEVEL_PROPERTIES_KHR          : return sizeof( VkVideoEncodeQualityLevelPropertiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_QUALITY_LEVEL_INFO_KHR                : return sizeof( VkVideoEncodeQualityLevelInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_SESSION_PARAMETERS_GET_INFO_KHR       : return sizeof( VkVideoEncodeSessionParametersGetInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_SESSION_PARAMETERS_FEEDBACK_INFO_KHR  : return sizeof( VkVideoEncodeSessionParametersFeedbackInfoKHR );
+
+        //=== VK_NV_device_diagnostics_config ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DIAGNOSTICS_CONFIG_FEATURES_NV: return sizeof( VkPhysicalDeviceDiagnosticsConfigFeaturesNV );
+        case VK_STRUCTURE_TYPE_DEVICE_DIAGNOSTICS_CONFIG_CREATE_INFO_NV      : return sizeof( VkDeviceDiagnosticsConfigCreateInfoNV );
+
+        //=== VK_QCOM_queue_perf_hint ===
+        case VK_STRUCTURE_TYPE_PERF_HINT_INFO_QCOM                            : return sizeof( VkPerfHintInfoQCOM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_QUEUE_PERF_HINT_FEATURES_QCOM  : return sizeof( VkPhysicalDeviceQueuePerfHintFeaturesQCOM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_QUEUE_PERF_HINT_PROPERTIES_QCOM: return sizeof( VkPhysicalDeviceQueuePerfHintPropertiesQCOM );
+
+        //=== VK_QCOM_image_processing3 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_PROCESSING_3_FEATURES_QCOM: return sizeof( VkPhysicalDeviceImageProcessing3FeaturesQCOM );
+
+        //=== VK_QCOM_shader_multiple_wait_queues ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MULTIPLE_WAIT_QUEUES_FEATURES_QCOM:
+          return sizeof( VkPhysicalDeviceShaderMultipleWaitQueuesFeaturesQCOM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MULTIPLE_WAIT_QUEUES_PROPERTIES_QCOM:
+          return sizeof( VkPhysicalDeviceShaderMultipleWaitQueuesPropertiesQCOM );
+
+        //=== VK_EXT_shader_split_barrier ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SPLIT_BARRIER_FEATURES_EXT  : return sizeof( VkPhysicalDeviceShaderSplitBarrierFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SPLIT_BARRIER_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceShaderSplitBarrierPropertiesEXT );
+
+#if defined( VK_ENABLE_BETA_EXTENSIONS )
+        //=== VK_NV_cuda_kernel_launch ===
+        case VK_STRUCTURE_TYPE_CUDA_MODULE_CREATE_INFO_NV                      : return sizeof( VkCudaModuleCreateInfoNV );
+        case VK_STRUCTURE_TYPE_CUDA_FUNCTION_CREATE_INFO_NV                    : return sizeof( VkCudaFunctionCreateInfoNV );
+        case VK_STRUCTURE_TYPE_CUDA_LAUNCH_INFO_NV                             : return sizeof( VkCudaLaunchInfoNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUDA_KERNEL_LAUNCH_FEATURES_NV  : return sizeof( VkPhysicalDeviceCudaKernelLaunchFeaturesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUDA_KERNEL_LAUNCH_PROPERTIES_NV: return sizeof( VkPhysicalDeviceCudaKernelLaunchPropertiesNV );
+#endif /*VK_ENABLE_BETA_EXTENSIONS*/
+
+        //=== VK_QCOM_tile_shading ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TILE_SHADING_FEATURES_QCOM  : return sizeof( VkPhysicalDeviceTileShadingFeaturesQCOM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TILE_SHADING_PROPERTIES_QCOM: return sizeof( VkPhysicalDeviceTileShadingPropertiesQCOM );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_TILE_SHADING_CREATE_INFO_QCOM   : return sizeof( VkRenderPassTileShadingCreateInfoQCOM );
+        case VK_STRUCTURE_TYPE_PER_TILE_BEGIN_INFO_QCOM                    : return sizeof( VkPerTileBeginInfoQCOM );
+        case VK_STRUCTURE_TYPE_PER_TILE_END_INFO_QCOM                      : return sizeof( VkPerTileEndInfoQCOM );
+        case VK_STRUCTURE_TYPE_DISPATCH_TILE_INFO_QCOM                     : return sizeof( VkDispatchTileInfoQCOM );
+
+        //=== VK_NV_low_latency ===
+        case VK_STRUCTURE_TYPE_QUERY_LOW_LATENCY_SUPPORT_NV: return sizeof( VkQueryLowLatencySupportNV );
+
+#if defined( VK_USE_PLATFORM_METAL_EXT )
+        //=== VK_EXT_metal_objects ===
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_OBJECT_CREATE_INFO_EXT: return sizeof( VkExportMetalObjectCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_OBJECTS_INFO_EXT      : return sizeof( VkExportMetalObjectsInfoEXT );
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_DEVICE_INFO_EXT       : return sizeof( VkExportMetalDeviceInfoEXT );
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_COMMAND_QUEUE_INFO_EXT: return sizeof( VkExportMetalCommandQueueInfoEXT );
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_BUFFER_INFO_EXT       : return sizeof( VkExportMetalBufferInfoEXT );
+        case VK_STRUCTURE_TYPE_IMPORT_METAL_BUFFER_INFO_EXT       : return sizeof( VkImportMetalBufferInfoEXT );
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_TEXTURE_INFO_EXT      : return sizeof( VkExportMetalTextureInfoEXT );
+        case VK_STRUCTURE_TYPE_IMPORT_METAL_TEXTURE_INFO_EXT      : return sizeof( VkImportMetalTextureInfoEXT );
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_IO_SURFACE_INFO_EXT   : return sizeof( VkExportMetalIOSurfaceInfoEXT );
+        case VK_STRUCTURE_TYPE_IMPORT_METAL_IO_SURFACE_INFO_EXT   : return sizeof( VkImportMetalIOSurfaceInfoEXT );
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_SHARED_EVENT_INFO_EXT : return sizeof( VkExportMetalSharedEventInfoEXT );
+        case VK_STRUCTURE_TYPE_IMPORT_METAL_SHARED_EVENT_INFO_EXT : return sizeof( VkImportMetalSharedEventInfoEXT );
+#endif /*VK_USE_PLATFORM_METAL_EXT*/
+
+        //=== VK_EXT_descriptor_buffer ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT            : return sizeof( VkPhysicalDeviceDescriptorBufferPropertiesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT              : return sizeof( VkPhysicalDeviceDescriptorBufferFeaturesEXT );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT                                 : return sizeof( VkDescriptorAddressInfoEXT );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT                          : return sizeof( VkDescriptorBufferBindingInfoEXT );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_PUSH_DESCRIPTOR_BUFFER_HANDLE_EXT:
+          return sizeof( VkDescriptorBufferBindingPushDescriptorBufferHandleEXT );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT                                     : return sizeof( VkDescriptorGetInfoEXT );
+        case VK_STRUCTURE_TYPE_BUFFER_CAPTURE_DESCRIPTOR_DATA_INFO_EXT                     : return sizeof( VkBufferCaptureDescriptorDataInfoEXT );
+        case VK_STRUCTURE_TYPE_IMAGE_CAPTURE_DESCRIPTOR_DATA_INFO_EXT                      : return sizeof( VkImageCaptureDescriptorDataInfoEXT );
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_CAPTURE_DESCRIPTOR_DATA_INFO_EXT                 : return sizeof( VkImageViewCaptureDescriptorDataInfoEXT );
+        case VK_STRUCTURE_TYPE_SAMPLER_CAPTURE_DESCRIPTOR_DATA_INFO_EXT                    : return sizeof( VkSamplerCaptureDescriptorDataInfoEXT );
+        case VK_STRUCTURE_TYPE_OPAQUE_CAPTURE_DESCRIPTOR_DATA_CREATE_INFO_EXT              : return sizeof( VkOpaqueCaptureDescriptorDataCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CAPTURE_DESCRIPTOR_DATA_INFO_EXT:
+          return sizeof( VkAccelerationStructureCaptureDescriptorDataInfoEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_DENSITY_MAP_PROPERTIES_EXT:
+          return sizeof( VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT );
+
+        //=== VK_KHR_device_address_commands ===
+        case VK_STRUCTURE_TYPE_DEVICE_MEMORY_COPY_KHR                              : return sizeof( VkDeviceMemoryCopyKHR );
+        case VK_STRUCTURE_TYPE_COPY_DEVICE_MEMORY_INFO_KHR                         : return sizeof( VkCopyDeviceMemoryInfoKHR );
+        case VK_STRUCTURE_TYPE_DEVICE_MEMORY_IMAGE_COPY_KHR                        : return sizeof( VkDeviceMemoryImageCopyKHR );
+        case VK_STRUCTURE_TYPE_COPY_DEVICE_MEMORY_IMAGE_INFO_KHR                   : return sizeof( VkCopyDeviceMemoryImageInfoKHR );
+        case VK_STRUCTURE_TYPE_MEMORY_RANGE_BARRIERS_INFO_KHR                      : return sizeof( VkMemoryRangeBarriersInfoKHR );
+        case VK_STRUCTURE_TYPE_MEMORY_RANGE_BARRIER_KHR                            : return sizeof( VkMemoryRangeBarrierKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_ADDRESS_COMMANDS_FEATURES_KHR: return sizeof( VkPhysicalDeviceDeviceAddressCommandsFeaturesKHR );
+        case VK_STRUCTURE_TYPE_BIND_INDEX_BUFFER_3_INFO_KHR                        : return sizeof( VkBindIndexBuffer3InfoKHR );
+        case VK_STRUCTURE_TYPE_BIND_VERTEX_BUFFER_3_INFO_KHR                       : return sizeof( VkBindVertexBuffer3InfoKHR );
+        case VK_STRUCTURE_TYPE_DRAW_INDIRECT_2_INFO_KHR                            : return sizeof( VkDrawIndirect2InfoKHR );
+        case VK_STRUCTURE_TYPE_DRAW_INDIRECT_COUNT_2_INFO_KHR                      : return sizeof( VkDrawIndirectCount2InfoKHR );
+        case VK_STRUCTURE_TYPE_DISPATCH_INDIRECT_2_INFO_KHR                        : return sizeof( VkDispatchIndirect2InfoKHR );
+        case VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_2_EXT              : return sizeof( VkConditionalRenderingBeginInfo2EXT );
+        case VK_STRUCTURE_TYPE_BIND_TRANSFORM_FEEDBACK_BUFFER_2_INFO_EXT           : return sizeof( VkBindTransformFeedbackBuffer2InfoEXT );
+        case VK_STRUCTURE_TYPE_MEMORY_MARKER_INFO_AMD                              : return sizeof( VkMemoryMarkerInfoAMD );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_2_KHR            : return sizeof( VkAccelerationStructureCreateInfo2KHR );
+
+        //=== VK_EXT_graphics_pipeline_library ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT  : return sizeof( VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT );
+        case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT               : return sizeof( VkGraphicsPipelineLibraryCreateInfoEXT );
+
+        //=== VK_AMD_shader_early_and_late_fragment_tests ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_EARLY_AND_LATE_FRAGMENT_TESTS_FEATURES_AMD:
+          return sizeof( VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD );
+
+        //=== VK_KHR_fragment_shader_barycentric ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_FEATURES_KHR:
+          return sizeof( VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_PROPERTIES_KHR:
+          return sizeof( VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR );
+
+        //=== VK_KHR_shader_subgroup_uniform_control_flow ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_FEATURES_KHR:
+          return sizeof( VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR );
+
+        //=== VK_NV_fragment_shading_rate_enums ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_FEATURES_NV  : return sizeof( VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_PROPERTIES_NV: return sizeof( VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV );
+        case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_ENUM_STATE_CREATE_INFO_NV : return sizeof( VkPipelineFragmentShadingRateEnumStateCreateInfoNV );
+
+        //=== VK_NV_ray_tracing_motion_blur ===
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_MOTION_TRIANGLES_DATA_NV: return sizeof( VkAccelerationStructureGeometryMotionTrianglesDataNV );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MOTION_INFO_NV                   : return sizeof( VkAccelerationStructureMotionInfoNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MOTION_BLUR_FEATURES_NV     : return sizeof( VkPhysicalDeviceRayTracingMotionBlurFeaturesNV );
+
+        //=== VK_EXT_mesh_shader ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT  : return sizeof( VkPhysicalDeviceMeshShaderFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceMeshShaderPropertiesEXT );
+
+        //=== VK_EXT_ycbcr_2plane_444_formats ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_2_PLANE_444_FORMATS_FEATURES_EXT: return sizeof( VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT );
+
+        //=== VK_EXT_fragment_density_map2 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_FEATURES_EXT  : return sizeof( VkPhysicalDeviceFragmentDensityMap2FeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceFragmentDensityMap2PropertiesEXT );
+
+        //=== VK_QCOM_rotated_copy_commands ===
+        case VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCOM: return sizeof( VkCopyCommandTransformInfoQCOM );
+
+        //=== VK_KHR_workgroup_memory_explicit_layout ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_FEATURES_KHR:
+          return sizeof( VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR );
+
+        //=== VK_EXT_image_compression_control ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_COMPRESSION_CONTROL_FEATURES_EXT: return sizeof( VkPhysicalDeviceImageCompressionControlFeaturesEXT );
+        case VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_CONTROL_EXT                         : return sizeof( VkImageCompressionControlEXT );
+        case VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_PROPERTIES_EXT                      : return sizeof( VkImageCompressionPropertiesEXT );
+
+        //=== VK_EXT_attachment_feedback_loop_layout ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ATTACHMENT_FEEDBACK_LOOP_LAYOUT_FEATURES_EXT:
+          return sizeof( VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT );
+
+        //=== VK_EXT_4444_formats ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_4444_FORMATS_FEATURES_EXT: return sizeof( VkPhysicalDevice4444FormatsFeaturesEXT );
+
+        //=== VK_EXT_device_fault ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FAULT_FEATURES_EXT: return sizeof( VkPhysicalDeviceFaultFeaturesEXT );
+        case VK_STRUCTURE_TYPE_DEVICE_FAULT_COUNTS_EXT           : return sizeof( VkDeviceFaultCountsEXT );
+        case VK_STRUCTURE_TYPE_DEVICE_FAULT_INFO_EXT             : return sizeof( VkDeviceFaultInfoEXT );
+
+        //=== VK_EXT_rgba10x6_formats ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RGBA10X6_FORMATS_FEATURES_EXT: return sizeof( VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT );
+
+#if defined( VK_USE_PLATFORM_DIRECTFB_EXT )
+        //=== VK_EXT_directfb_surface ===
+        case VK_STRUCTURE_TYPE_DIRECTFB_SURFACE_CREATE_INFO_EXT: return sizeof( VkDirectFBSurfaceCreateInfoEXT );
+#endif /*VK_USE_PLATFORM_DIRECTFB_EXT*/
+
+        //=== VK_EXT_vertex_input_dynamic_state ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_INPUT_DYNAMIC_STATE_FEATURES_EXT: return sizeof( VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT );
+        case VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT                 : return sizeof( VkVertexInputBindingDescription2EXT );
+        case VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT               : return sizeof( VkVertexInputAttributeDescription2EXT );
+
+        //=== VK_EXT_physical_device_drm ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRM_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceDrmPropertiesEXT );
+
+        //=== VK_EXT_device_address_binding_report ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ADDRESS_BINDING_REPORT_FEATURES_EXT: return sizeof( VkPhysicalDeviceAddressBindingReportFeaturesEXT );
+        case VK_STRUCTURE_TYPE_DEVICE_ADDRESS_BINDING_CALLBACK_DATA_EXT           : return sizeof( VkDeviceAddressBindingCallbackDataEXT );
+
+        //=== VK_EXT_depth_clip_control ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_CONTROL_FEATURES_EXT     : return sizeof( VkPhysicalDeviceDepthClipControlFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLIP_CONTROL_CREATE_INFO_EXT: return sizeof( VkPipelineViewportDepthClipControlCreateInfoEXT );
+
+        //=== VK_EXT_primitive_topology_list_restart ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVE_TOPOLOGY_LIST_RESTART_FEATURES_EXT:
+          return sizeof( VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT );
+
+#if defined( VK_USE_PLATFORM_FUCHSIA )
+        //=== VK_FUCHSIA_external_memory ===
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_ZIRCON_HANDLE_INFO_FUCHSIA: return sizeof( VkImportMemoryZirconHandleInfoFUCHSIA );
+        case VK_STRUCTURE_TYPE_MEMORY_ZIRCON_HANDLE_PROPERTIES_FUCHSIA : return sizeof( VkMemoryZirconHandlePropertiesFUCHSIA );
+        case VK_STRUCTURE_TYPE_MEMORY_GET_ZIRCON_HANDLE_INFO_FUCHSIA   : return sizeof( VkMemoryGetZirconHandleInfoFUCHSIA );
+#endif /*VK_USE_PLATFORM_FUCHSIA*/
+
+#if defined( VK_USE_PLATFORM_FUCHSIA )
+        //=== VK_FUCHSIA_external_semaphore ===
+        case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_ZIRCON_HANDLE_INFO_FUCHSIA: return sizeof( VkImportSemaphoreZirconHandleInfoFUCHSIA );
+        case VK_STRUCTURE_TYPE_SEMAPHORE_GET_ZIRCON_HANDLE_INFO_FUCHSIA   : return sizeof( VkSemaphoreGetZirconHandleInfoFUCHSIA );
+#endif /*VK_USE_PLATFORM_FUCHSIA*/
+
+#if defined( VK_USE_PLATFORM_FUCHSIA )
+        //=== VK_FUCHSIA_buffer_collection ===
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_CREATE_INFO_FUCHSIA       : return sizeof( VkBufferCollectionCreateInfoFUCHSIA );
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_BUFFER_COLLECTION_FUCHSIA     : return sizeof( VkImportMemoryBufferCollectionFUCHSIA );
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_IMAGE_CREATE_INFO_FUCHSIA : return sizeof( VkBufferCollectionImageCreateInfoFUCHSIA );
+        case VK_STRUCTURE_TYPE_BUFFER_CONSTRAINTS_INFO_FUCHSIA             : return sizeof( VkBufferConstraintsInfoFUCHSIA );
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_BUFFER_CREATE_INFO_FUCHSIA: return sizeof( VkBufferCollectionBufferCreateInfoFUCHSIA );
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_PROPERTIES_FUCHSIA        : return sizeof( VkBufferCollectionPropertiesFUCHSIA );
+        case VK_STRUCTURE_TYPE_SYSMEM_COLOR_SPACE_FUCHSIA                  : return sizeof( VkSysmemColorSpaceFUCHSIA );
+        case VK_STRUCTURE_TYPE_IMAGE_CONSTRAINTS_INFO_FUCHSIA              : return sizeof( VkImageConstraintsInfoFUCHSIA );
+        case VK_STRUCTURE_TYPE_IMAGE_FORMAT_CONSTRAINTS_INFO_FUCHSIA       : return sizeof( VkImageFormatConstraintsInfoFUCHSIA );
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_CONSTRAINTS_INFO_FUCHSIA  : return sizeof( VkBufferCollectionConstraintsInfoFUCHSIA );
+#endif /*VK_USE_PLATFORM_FUCHSIA*/
+
+        //=== VK_HUAWEI_subpass_shading ===
+        case VK_STRUCTURE_TYPE_SUBPASS_SHADING_PIPELINE_CREATE_INFO_HUAWEI      : return sizeof( VkSubpassShadingPipelineCreateInfoHUAWEI );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_FEATURES_HUAWEI  : return sizeof( VkPhysicalDeviceSubpassShadingFeaturesHUAWEI );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_PROPERTIES_HUAWEI: return sizeof( VkPhysicalDeviceSubpassShadingPropertiesHUAWEI );
+
+        //=== VK_HUAWEI_invocation_mask ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INVOCATION_MASK_FEATURES_HUAWEI: return sizeof( VkPhysicalDeviceInvocationMaskFeaturesHUAWEI );
+
+        //=== VK_NV_external_memory_rdma ===
+        case VK_STRUCTURE_TYPE_MEMORY_GET_REMOTE_ADDRESS_INFO_NV               : return sizeof( VkMemoryGetRemoteAddressInfoNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_RDMA_FEATURES_NV: return sizeof( VkPhysicalDeviceExternalMemoryRDMAFeaturesNV );
+
+        //=== VK_EXT_pipeline_properties ===
+        case VK_STRUCTURE_TYPE_PIPELINE_PROPERTIES_IDENTIFIER_EXT              : return sizeof( VkPipelinePropertiesIdentifierEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_PROPERTIES_FEATURES_EXT: return sizeof( VkPhysicalDevicePipelinePropertiesFeaturesEXT );
+
+        //=== VK_EXT_frame_boundary ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAME_BOUNDARY_FEATURES_EXT: return sizeof( VkPhysicalDeviceFrameBoundaryFeaturesEXT );
+        case VK_STRUCTURE_TYPE_FRAME_BOUNDARY_EXT                         : return sizeof( VkFrameBoundaryEXT );
+
+        //=== VK_EXT_multisampled_render_to_single_sampled ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTISAMPLED_RENDER_TO_SINGLE_SAMPLED_FEATURES_EXT:
+          return sizeof( VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT );
+        case VK_STRUCTURE_TYPE_SUBPASS_RESOLVE_PERFORMANCE_QUERY_EXT                             : return sizeof( VkSubpassResolvePerformanceQueryEXT );
+        case VK_STRUCTURE_TYPE_MULTISAMPLED_RENDER_TO_SINGLE_SAMPLED_INFO_EXT                    : return sizeof( VkMultisampledRenderToSingleSampledInfoEXT );
+
+        //=== VK_EXT_extended_dynamic_state2 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT: return sizeof( VkPhysicalDeviceExtendedDynamicState2FeaturesEXT );
+
+#if defined( VK_USE_PLATFORM_SCREEN_QNX )
+        //=== VK_QNX_screen_surface ===
+        case VK_STRUCTURE_TYPE_SCREEN_SURFACE_CREATE_INFO_QNX: return sizeof( VkScreenSurfaceCreateInfoQNX );
+#endif /*VK_USE_PLATFORM_SCREEN_QNX*/
+
+        //=== VK_EXT_color_write_enable ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COLOR_WRITE_ENABLE_FEATURES_EXT: return sizeof( VkPhysicalDeviceColorWriteEnableFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT           : return sizeof( VkPipelineColorWriteCreateInfoEXT );
+
+        //=== VK_EXT_primitives_generated_query ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVES_GENERATED_QUERY_FEATURES_EXT: return sizeof( VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT );
+
+        //=== VK_KHR_ray_tracing_maintenance1 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MAINTENANCE_1_FEATURES_KHR: return sizeof( VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR );
+
+        //=== VK_KHR_shader_untyped_pointers ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_UNTYPED_POINTERS_FEATURES_KHR: return sizeof( VkPhysicalDeviceShaderUntypedPointersFeaturesKHR );
+
+        //=== VK_VALVE_video_encode_rgb_conversion ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_ENCODE_RGB_CONVERSION_FEATURES_VALVE:
+          return sizeof( VkPhysicalDeviceVideoEncodeRgbConversionFeaturesVALVE );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_RGB_CONVERSION_CAPABILITIES_VALVE            : return sizeof( VkVideoEncodeRgbConversionCapabilitiesVALVE );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_PROFILE_RGB_CONVERSION_INFO_VALVE            : return sizeof( VkVideoEncodeProfileRgbConversionInfoVALVE );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_SESSION_RGB_CONVERSION_CREATE_INFO_VALVE     : return sizeof( VkVideoEncodeSessionRgbConversionCreateInfoVALVE );
+
+        //=== VK_EXT_image_view_min_lod ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_MIN_LOD_FEATURES_EXT: return sizeof( VkPhysicalDeviceImageViewMinLodFeaturesEXT );
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_MIN_LOD_CREATE_INFO_EXT             : return sizeof( VkImageViewMinLodCreateInfoEXT );
+
+        //=== VK_EXT_multi_draw ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT  : return sizeof( VkPhysicalDeviceMultiDrawFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceMultiDrawPropertiesEXT );
+
+        //=== VK_EXT_image_2d_view_of_3d ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_2D_VIEW_OF_3D_FEATURES_EXT: return sizeof( VkPhysicalDeviceImage2DViewOf3DFeaturesEXT );
+
+        //=== VK_EXT_shader_tile_image ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TILE_IMAGE_FEATURES_EXT  : return sizeof( VkPhysicalDeviceShaderTileImageFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TILE_IMAGE_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceShaderTileImagePropertiesEXT );
+
+        //=== VK_EXT_opacity_micromap ===
+        case VK_STRUCTURE_TYPE_MICROMAP_BUILD_INFO_EXT                              : return sizeof( VkMicromapBuildInfoEXT );
+        case VK_STRUCTURE_TYPE_MICROMAP_CREATE_INFO_EXT                             : return sizeof( VkMicromapCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPACITY_MICROMAP_FEATURES_EXT        : return sizeof( VkPhysicalDeviceOpacityMicromapFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPACITY_MICROMAP_PROPERTIES_EXT      : return sizeof( VkPhysicalDeviceOpacityMicromapPropertiesEXT );
+        case VK_STRUCTURE_TYPE_MICROMAP_VERSION_INFO_EXT                            : return sizeof( VkMicromapVersionInfoEXT );
+        case VK_STRUCTURE_TYPE_COPY_MICROMAP_TO_MEMORY_INFO_EXT                     : return sizeof( VkCopyMicromapToMemoryInfoEXT );
+        case VK_STRUCTURE_TYPE_COPY_MEMORY_TO_MICROMAP_INFO_EXT                     : return sizeof( VkCopyMemoryToMicromapInfoEXT );
+        case VK_STRUCTURE_TYPE_COPY_MICROMAP_INFO_EXT                               : return sizeof( VkCopyMicromapInfoEXT );
+        case VK_STRUCTURE_TYPE_MICROMAP_BUILD_SIZES_INFO_EXT                        : return sizeof( VkMicromapBuildSizesInfoEXT );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_TRIANGLES_OPACITY_MICROMAP_EXT: return sizeof( VkAccelerationStructureTrianglesOpacityMicromapEXT );
+
+#if defined( VK_ENABLE_BETA_EXTENSIONS )
+        //=== VK_NV_displacement_micromap ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISPLACEMENT_MICROMAP_FEATURES_NV        : return sizeof( VkPhysicalDeviceDisplacementMicromapFeaturesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISPLACEMENT_MICROMAP_PROPERTIES_NV      : return sizeof( VkPhysicalDeviceDisplacementMicromapPropertiesNV );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_TRIANGLES_DISPLACEMENT_MICROMAP_NV:
+          return sizeof( VkAccelerationStructureTrianglesDisplacementMicromapNV );
+#endif /*VK_ENABLE_BETA_EXTENSIONS*/
+
+        //=== VK_HUAWEI_cluster_culling_shader ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CLUSTER_CULLING_SHADER_FEATURES_HUAWEI    : return sizeof( VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CLUSTER_CULLING_SHADER_PROPERTIES_HUAWEI:
+          return sizeof( VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CLUSTER_CULLING_SHADER_VRS_FEATURES_HUAWEI:
+          return sizeof( VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI );
+
+        //=== VK_EXT_border_color_swizzle ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BORDER_COLOR_SWIZZLE_FEATURES_EXT     : return sizeof( VkPhysicalDeviceBorderColorSwizzleFeaturesEXT );
+        case VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT: return sizeof( VkSamplerBorderColorComponentMappingCreateInfoEXT );
+
+        //=== VK_EXT_pageable_device_local_memory ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT: return sizeof( VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT );
+
+        //=== VK_ARM_shader_core_properties ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_ARM: return sizeof( VkPhysicalDeviceShaderCorePropertiesARM );
+
+        //=== VK_ARM_scheduling_controls ===
+        case VK_STRUCTURE_TYPE_DEVICE_QUEUE_SHADER_CORE_CONTROL_CREATE_INFO_ARM:
+          return sizeof( VkDeviceQueueShaderCoreControlCreateInfoARM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCHEDULING_CONTROLS_FEATURES_ARM:
+          return sizeof( VkPhysicalDeviceSchedulingControlsFeaturesARM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCHEDULING_CONTROLS_PROPERTIES_ARM:
+          return sizeof( VkPhysicalDeviceSchedulingControlsPropertiesARM );
+        case VK_STRUCTURE_TYPE_DISPATCH_PARAMETERS_ARM                                               : return sizeof( VkDispatchParametersARM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCHEDULING_CONTROLS_DISPATCH_PARAMETERS_PROPERTIES_ARM:
+          return sizeof( VkPhysicalDeviceSchedulingControlsDispatchParametersPropertiesARM );
+
+        //=== VK_EXT_image_sliced_view_of_3d ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_SLICED_VIEW_OF_3D_FEATURES_EXT: return sizeof( VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT );
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_SLICED_CREATE_INFO_EXT                   : return sizeof( VkImageViewSlicedCreateInfoEXT );
+
+        //=== VK_VALVE_descriptor_set_host_mapping ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_SET_HOST_MAPPING_FEATURES_VALVE:
+          return sizeof( VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_BINDING_REFERENCE_VALVE                    : return sizeof( VkDescriptorSetBindingReferenceVALVE );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_HOST_MAPPING_INFO_VALVE             : return sizeof( VkDescriptorSetLayoutHostMappingInfoVALVE );
+
+        //=== VK_EXT_non_seamless_cube_map ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_NON_SEAMLESS_CUBE_MAP_FEATURES_EXT: return sizeof( VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT );
+
+        //=== VK_ARM_render_pass_striped ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RENDER_PASS_STRIPED_FEATURES_ARM  : return sizeof( VkPhysicalDeviceRenderPassStripedFeaturesARM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RENDER_PASS_STRIPED_PROPERTIES_ARM: return sizeof( VkPhysicalDeviceRenderPassStripedPropertiesARM );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_STRIPE_BEGIN_INFO_ARM                 : return sizeof( VkRenderPassStripeBeginInfoARM );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_STRIPE_INFO_ARM                       : return sizeof( VkRenderPassStripeInfoARM );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_STRIPE_SUBMIT_INFO_ARM                : return sizeof( VkRenderPassStripeSubmitInfoARM );
+
+        //=== VK_NV_copy_memory_indirect ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COPY_MEMORY_INDIRECT_FEATURES_NV: return sizeof( VkPhysicalDeviceCopyMemoryIndirectFeaturesNV );
+
+        //=== VK_NV_device_generated_commands_compute ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_COMPUTE_FEATURES_NV:
+          return sizeof( VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV );
+        case VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_INDIRECT_BUFFER_INFO_NV                     : return sizeof( VkComputePipelineIndirectBufferInfoNV );
+        case VK_STRUCTURE_TYPE_PIPELINE_INDIRECT_DEVICE_ADDRESS_INFO_NV                     : return sizeof( VkPipelineIndirectDeviceAddressInfoNV );
+
+        //=== VK_NV_ray_tracing_linear_swept_spheres ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_LINEAR_SWEPT_SPHERES_FEATURES_NV:
+          return sizeof( VkPhysicalDeviceRayTracingLinearSweptSpheresFeaturesNV );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_LINEAR_SWEPT_SPHERES_DATA_NV:
+          return sizeof( VkAccelerationStructureGeometryLinearSweptSpheresDataNV );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_SPHERES_DATA_NV             : return sizeof( VkAccelerationStructureGeometrySpheresDataNV );
+
+        //=== VK_NV_linear_color_attachment ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINEAR_COLOR_ATTACHMENT_FEATURES_NV: return sizeof( VkPhysicalDeviceLinearColorAttachmentFeaturesNV );
+
+        //=== VK_KHR_shader_maximal_reconvergence ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MAXIMAL_RECONVERGENCE_FEATURES_KHR:
+          return sizeof( VkPhysicalDeviceShaderMaximalReconvergenceFeaturesKHR );
+
+        //=== VK_EXT_image_compression_control_swapchain ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_COMPRESSION_CONTROL_SWAPCHAIN_FEATURES_EXT:
+          return sizeof( VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT );
+
+        //=== VK_QCOM_image_processing ===
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_SAMPLE_WEIGHT_CREATE_INFO_QCOM       : return sizeof( VkImageViewSampleWeightCreateInfoQCOM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_PROCESSING_FEATURES_QCOM  : return sizeof( VkPhysicalDeviceImageProcessingFeaturesQCOM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_PROCESSING_PROPERTIES_QCOM: return sizeof( VkPhysicalDeviceImageProcessingPropertiesQCOM );
+
+        //=== VK_EXT_nested_command_buffer ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_NESTED_COMMAND_BUFFER_FEATURES_EXT  : return sizeof( VkPhysicalDeviceNestedCommandBufferFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_NESTED_COMMAND_BUFFER_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceNestedCommandBufferPropertiesEXT );
+
+#if defined( VK_USE_PLATFORM_OHOS )
+        //=== VK_OHOS_external_memory ===
+        case VK_STRUCTURE_TYPE_NATIVE_BUFFER_USAGE_OHOS            : return sizeof( VkNativeBufferUsageOHOS );
+        case VK_STRUCTURE_TYPE_NATIVE_BUFFER_PROPERTIES_OHOS       : return sizeof( VkNativeBufferPropertiesOHOS );
+        case VK_STRUCTURE_TYPE_NATIVE_BUFFER_FORMAT_PROPERTIES_OHOS: return sizeof( VkNativeBufferFormatPropertiesOHOS );
+        case VK_STRUCTURE_TYPE_IMPORT_NATIVE_BUFFER_INFO_OHOS      : return sizeof( VkImportNativeBufferInfoOHOS );
+        case VK_STRUCTURE_TYPE_MEMORY_GET_NATIVE_BUFFER_INFO_OHOS  : return sizeof( VkMemoryGetNativeBufferInfoOHOS );
+        case VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_OHOS                : return sizeof( VkExternalFormatOHOS );
+#endif /*VK_USE_PLATFORM_OHOS*/
+
+        //=== VK_EXT_external_memory_acquire_unmodified ===
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_ACQUIRE_UNMODIFIED_EXT: return sizeof( VkExternalMemoryAcquireUnmodifiedEXT );
+
+        //=== VK_EXT_extended_dynamic_state3 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT  : return sizeof( VkPhysicalDeviceExtendedDynamicState3FeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceExtendedDynamicState3PropertiesEXT );
+
+        //=== VK_EXT_subpass_merge_feedback ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_MERGE_FEEDBACK_FEATURES_EXT: return sizeof( VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_CREATION_CONTROL_EXT                   : return sizeof( VkRenderPassCreationControlEXT );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_CREATION_FEEDBACK_CREATE_INFO_EXT      : return sizeof( VkRenderPassCreationFeedbackCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_SUBPASS_FEEDBACK_CREATE_INFO_EXT       : return sizeof( VkRenderPassSubpassFeedbackCreateInfoEXT );
+
+        //=== VK_LUNARG_direct_driver_loading ===
+        case VK_STRUCTURE_TYPE_DIRECT_DRIVER_LOADING_INFO_LUNARG: return sizeof( VkDirectDriverLoadingInfoLUNARG );
+        case VK_STRUCTURE_TYPE_DIRECT_DRIVER_LOADING_LIST_LUNARG: return sizeof( VkDirectDriverLoadingListLUNARG );
+
+        //=== VK_ARM_tensors ===
+        case VK_STRUCTURE_TYPE_TENSOR_DESCRIPTION_ARM                                 : return sizeof( VkTensorDescriptionARM );
+        case VK_STRUCTURE_TYPE_TENSOR_CREATE_INFO_ARM                                 : return sizeof( VkTensorCreateInfoARM );
+        case VK_STRUCTURE_TYPE_TENSOR_MEMORY_REQUIREMENTS_INFO_ARM                    : return sizeof( VkTensorMemoryRequirementsInfoARM );
+        case VK_STRUCTURE_TYPE_BIND_TENSOR_MEMORY_INFO_ARM                            : return sizeof( VkBindTensorMemoryInfoARM );
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_TENSOR_ARM                        : return sizeof( VkWriteDescriptorSetTensorARM );
+        case VK_STRUCTURE_TYPE_TENSOR_FORMAT_PROPERTIES_ARM                           : return sizeof( VkTensorFormatPropertiesARM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TENSOR_PROPERTIES_ARM                  : return sizeof( VkPhysicalDeviceTensorPropertiesARM );
+        case VK_STRUCTURE_TYPE_TENSOR_MEMORY_BARRIER_ARM                              : return sizeof( VkTensorMemoryBarrierARM );
+        case VK_STRUCTURE_TYPE_TENSOR_DEPENDENCY_INFO_ARM                             : return sizeof( VkTensorDependencyInfoARM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TENSOR_FEATURES_ARM                    : return sizeof( VkPhysicalDeviceTensorFeaturesARM );
+        case VK_STRUCTURE_TYPE_DEVICE_TENSOR_MEMORY_REQUIREMENTS_ARM                  : return sizeof( VkDeviceTensorMemoryRequirementsARM );
+        case VK_STRUCTURE_TYPE_COPY_TENSOR_INFO_ARM                                   : return sizeof( VkCopyTensorInfoARM );
+        case VK_STRUCTURE_TYPE_TENSOR_COPY_ARM                                        : return sizeof( VkTensorCopyARM );
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO_TENSOR_ARM              : return sizeof( VkMemoryDedicatedAllocateInfoTensorARM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_TENSOR_INFO_ARM               : return sizeof( VkPhysicalDeviceExternalTensorInfoARM );
+        case VK_STRUCTURE_TYPE_EXTERNAL_TENSOR_PROPERTIES_ARM                         : return sizeof( VkExternalTensorPropertiesARM );
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_TENSOR_CREATE_INFO_ARM                 : return sizeof( VkExternalMemoryTensorCreateInfoARM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_TENSOR_FEATURES_ARM  : return sizeof( VkPhysicalDeviceDescriptorBufferTensorFeaturesARM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_TENSOR_PROPERTIES_ARM: return sizeof( VkPhysicalDeviceDescriptorBufferTensorPropertiesARM );
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_GET_TENSOR_INFO_ARM                         : return sizeof( VkDescriptorGetTensorInfoARM );
+        case VK_STRUCTURE_TYPE_TENSOR_CAPTURE_DESCRIPTOR_DATA_INFO_ARM                : return sizeof( VkTensorCaptureDescriptorDataInfoARM );
+        case VK_STRUCTURE_TYPE_TENSOR_VIEW_CAPTURE_DESCRIPTOR_DATA_INFO_ARM           : return sizeof( VkTensorViewCaptureDescriptorDataInfoARM );
+        case VK_STRUCTURE_TYPE_FRAME_BOUNDARY_TENSORS_ARM                             : return sizeof( VkFrameBoundaryTensorsARM );
+
+        //=== VK_EXT_shader_module_identifier ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MODULE_IDENTIFIER_FEATURES_EXT  : return sizeof( VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MODULE_IDENTIFIER_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT );
+        case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_MODULE_IDENTIFIER_CREATE_INFO_EXT: return sizeof( VkPipelineShaderStageModuleIdentifierCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_SHADER_MODULE_IDENTIFIER_EXT                           : return sizeof( VkShaderModuleIdentifierEXT );
+
+        //=== VK_EXT_rasterization_order_attachment_access ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RASTERIZATION_ORDER_ATTACHMENT_ACCESS_FEATURES_EXT:
+          return sizeof( VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT );
+
+        //=== VK_NV_optical_flow ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPTICAL_FLOW_FEATURES_NV        : return sizeof( VkPhysicalDeviceOpticalFlowFeaturesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPTICAL_FLOW_PROPERTIES_NV      : return sizeof( VkPhysicalDeviceOpticalFlowPropertiesNV );
+        case VK_STRUCTURE_TYPE_OPTICAL_FLOW_IMAGE_FORMAT_INFO_NV               : return sizeof( VkOpticalFlowImageFormatInfoNV );
+        case VK_STRUCTURE_TYPE_OPTICAL_FLOW_IMAGE_FORMAT_PROPERTIES_NV         : return sizeof( VkOpticalFlowImageFormatPropertiesNV );
+        case VK_STRUCTURE_TYPE_OPTICAL_FLOW_SESSION_CREATE_INFO_NV             : return sizeof( VkOpticalFlowSessionCreateInfoNV );
+        case VK_STRUCTURE_TYPE_OPTICAL_FLOW_SESSION_CREATE_PRIVATE_DATA_INFO_NV: return sizeof( VkOpticalFlowSessionCreatePrivateDataInfoNV );
+        case VK_STRUCTURE_TYPE_OPTICAL_FLOW_EXECUTE_INFO_NV                    : return sizeof( VkOpticalFlowExecuteInfoNV );
+
+        //=== VK_EXT_legacy_dithering ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LEGACY_DITHERING_FEATURES_EXT: return sizeof( VkPhysicalDeviceLegacyDitheringFeaturesEXT );
+
+#if defined( VK_USE_PLATFORM_ANDROID_KHR )
+        //=== VK_ANDROID_external_format_resolve ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FORMAT_RESOLVE_FEATURES_ANDROID:
+          return sizeof( VkPhysicalDeviceExternalFormatResolveFeaturesANDROID );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FORMAT_RESOLVE_PROPERTIES_ANDROID:
+          return sizeof( VkPhysicalDeviceExternalFormatResolvePropertiesANDROID );
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_RESOLVE_PROPERTIES_ANDROID:
+          return sizeof( VkAndroidHardwareBufferFormatResolvePropertiesANDROID );
+#endif /*VK_USE_PLATFORM_ANDROID_KHR*/
+
+        //=== VK_AMD_anti_lag ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ANTI_LAG_FEATURES_AMD: return sizeof( VkPhysicalDeviceAntiLagFeaturesAMD );
+        case VK_STRUCTURE_TYPE_ANTI_LAG_DATA_AMD                    : return sizeof( VkAntiLagDataAMD );
+        case VK_STRUCTURE_TYPE_ANTI_LAG_PRESENTATION_INFO_AMD       : return sizeof( VkAntiLagPresentationInfoAMD );
+
+#if defined( VK_ENABLE_BETA_EXTENSIONS )
+        //=== VK_AMDX_dense_geometry_format ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DENSE_GEOMETRY_FORMAT_FEATURES_AMDX:
+          return sizeof( VkPhysicalDeviceDenseGeometryFormatFeaturesAMDX );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DENSE_GEOMETRY_FORMAT_TRIANGLES_DATA_AMDX:
+          return sizeof( VkAccelerationStructureDenseGeometryFormatTrianglesDataAMDX );
+#endif /*VK_ENABLE_BETA_EXTENSIONS*/
+
+        //=== VK_KHR_present_id2 ===
+        case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_PRESENT_ID_2_KHR    : return sizeof( VkSurfaceCapabilitiesPresentId2KHR );
+        case VK_STRUCTURE_TYPE_PRESENT_ID_2_KHR                         : return sizeof( VkPresentId2KHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_2_FEATURES_KHR: return sizeof( VkPhysicalDevicePresentId2FeaturesKHR );
+
+        //=== VK_KHR_present_wait2 ===
+        case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_PRESENT_WAIT_2_KHR    : return sizeof( VkSurfaceCapabilitiesPresentWait2KHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_2_FEATURES_KHR: return sizeof( VkPhysicalDevicePresentWait2FeaturesKHR );
+        case VK_STRUCTURE_TYPE_PRESENT_WAIT_2_INFO_KHR                    : return sizeof( VkPresentWait2InfoKHR );
+
+        //=== VK_KHR_ray_tracing_position_fetch ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_POSITION_FETCH_FEATURES_KHR: return sizeof( VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR );
+
+        //=== VK_EXT_shader_object ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_FEATURES_EXT  : return sizeof( VkPhysicalDeviceShaderObjectFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceShaderObjectPropertiesEXT );
+        case VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT                      : return sizeof( VkShaderCreateInfoEXT );
+
+        //=== VK_KHR_pipeline_binary ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_BINARY_FEATURES_KHR     : return sizeof( VkPhysicalDevicePipelineBinaryFeaturesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_BINARY_PROPERTIES_KHR   : return sizeof( VkPhysicalDevicePipelineBinaryPropertiesKHR );
+        case VK_STRUCTURE_TYPE_DEVICE_PIPELINE_BINARY_INTERNAL_CACHE_CONTROL_KHR: return sizeof( VkDevicePipelineBinaryInternalCacheControlKHR );
+        case VK_STRUCTURE_TYPE_PIPELINE_BINARY_KEY_KHR                          : return sizeof( VkPipelineBinaryKeyKHR );
+        case VK_STRUCTURE_TYPE_PIPELINE_BINARY_CREATE_INFO_KHR                  : return sizeof( VkPipelineBinaryCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_PIPELINE_BINARY_INFO_KHR                         : return sizeof( VkPipelineBinaryInfoKHR );
+        case VK_STRUCTURE_TYPE_RELEASE_CAPTURED_PIPELINE_DATA_INFO_KHR          : return sizeof( VkReleaseCapturedPipelineDataInfoKHR );
+        case VK_STRUCTURE_TYPE_PIPELINE_BINARY_DATA_INFO_KHR                    : return sizeof( VkPipelineBinaryDataInfoKHR );
+        case VK_STRUCTURE_TYPE_PIPELINE_CREATE_INFO_KHR                         : return sizeof( VkPipelineCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_PIPELINE_BINARY_HANDLES_INFO_KHR                 : return sizeof( VkPipelineBinaryHandlesInfoKHR );
+
+        //=== VK_QCOM_tile_properties ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TILE_PROPERTIES_FEATURES_QCOM: return sizeof( VkPhysicalDeviceTilePropertiesFeaturesQCOM );
+        case VK_STRUCTURE_TYPE_TILE_PROPERTIES_QCOM                         : return sizeof( VkTilePropertiesQCOM );
+
+        //=== VK_SEC_amigo_profiling ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_AMIGO_PROFILING_FEATURES_SEC: return sizeof( VkPhysicalDeviceAmigoProfilingFeaturesSEC );
+        case VK_STRUCTURE_TYPE_AMIGO_PROFILING_SUBMIT_INFO_SEC             : return sizeof( VkAmigoProfilingSubmitInfoSEC );
+
+        //=== VK_KHR_surface_maintenance1 ===
+        case VK_STRUCTURE_TYPE_SURFACE_PRESENT_MODE_KHR                : return sizeof( VkSurfacePresentModeKHR );
+        case VK_STRUCTURE_TYPE_SURFACE_PRESENT_SCALING_CAPABILITIES_KHR: return sizeof( VkSurfacePresentScalingCapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_SURFACE_PRESENT_MODE_COMPATIBILITY_KHR  : return sizeof( VkSurfacePresentModeCompatibilityKHR );
+
+        //=== VK_KHR_swapchain_maintenance1 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SWAPCHAIN_MAINTENANCE_1_FEATURES_KHR: return sizeof( VkPhysicalDeviceSwapchainMaintenance1FeaturesKHR );
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_FENCE_INFO_KHR                    : return sizeof( VkSwapchainPresentFenceInfoKHR );
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_MODES_CREATE_INFO_KHR             : return sizeof( VkSwapchainPresentModesCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_MODE_INFO_KHR                     : return sizeof( VkSwapchainPresentModeInfoKHR );
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_SCALING_CREATE_INFO_KHR           : return sizeof( VkSwapchainPresentScalingCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_RELEASE_SWAPCHAIN_IMAGES_INFO_KHR                   : return sizeof( VkReleaseSwapchainImagesInfoKHR );
+
+        //=== VK_QCOM_multiview_per_view_viewports ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_VIEWPORTS_FEATURES_QCOM:
+          return sizeof( VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM );
+
+        //=== VK_NV_ray_tracing_invocation_reorder ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_INVOCATION_REORDER_PROPERTIES_NV:
+          return sizeof( VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_INVOCATION_REORDER_FEATURES_NV:
+          return sizeof( VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV );
+
+        //=== VK_NV_cooperative_vector ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_VECTOR_PROPERTIES_NV: return sizeof( VkPhysicalDeviceCooperativeVectorPropertiesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_VECTOR_FEATURES_NV  : return sizeof( VkPhysicalDeviceCooperativeVectorFeaturesNV );
+        case VK_STRUCTURE_TYPE_COOPERATIVE_VECTOR_PROPERTIES_NV                : return sizeof( VkCooperativeVectorPropertiesNV );
+        case VK_STRUCTURE_TYPE_CONVERT_COOPERATIVE_VECTOR_MATRIX_INFO_NV       : return sizeof( VkConvertCooperativeVectorMatrixInfoNV );
+
+        //=== VK_NV_extended_sparse_address_space ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_SPARSE_ADDRESS_SPACE_FEATURES_NV:
+          return sizeof( VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_SPARSE_ADDRESS_SPACE_PROPERTIES_NV:
+          return sizeof( VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV );
+
+        //=== VK_EXT_mutable_descriptor_type ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MUTABLE_DESCRIPTOR_TYPE_FEATURES_EXT: return sizeof( VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT );
+        case VK_STRUCTURE_TYPE_MUTABLE_DESCRIPTOR_TYPE_CREATE_INFO_EXT             : return sizeof( VkMutableDescriptorTypeCreateInfoEXT );
+
+        //=== VK_EXT_legacy_vertex_attributes ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LEGACY_VERTEX_ATTRIBUTES_FEATURES_EXT  : return sizeof( VkPhysicalDeviceLegacyVertexAttributesFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LEGACY_VERTEX_ATTRIBUTES_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceLegacyVertexAttributesPropertiesEXT );
+
+        //=== VK_EXT_layer_settings ===
+        case VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT: return sizeof( VkLayerSettingsCreateInfoEXT );
+
+        //=== VK_ARM_shader_core_builtins ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_BUILTINS_FEATURES_ARM  : return sizeof( VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_BUILTINS_PROPERTIES_ARM: return sizeof( VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM );
+
+        //=== VK_EXT_pipeline_library_group_handles ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_LIBRARY_GROUP_HANDLES_FEATURES_EXT:
+          return sizeof( VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT );
+
+        //=== VK_EXT_dynamic_rendering_unused_attachments ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_UNUSED_ATTACHMENTS_FEATURES_EXT:
+          return sizeof( VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT );
+
+        //=== VK_KHR_internally_synchronized_queues ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INTERNALLY_SYNCHRONIZED_QUEUES_FEATURES_KHR:
+          return sizeof( VkPhysicalDeviceInternallySynchronizedQueuesFeaturesKHR );
+
+        //=== VK_NV_low_latency2 ===
+        case VK_STRUCTURE_TYPE_LATENCY_SLEEP_MODE_INFO_NV      : return sizeof( VkLatencySleepModeInfoNV );
+        case VK_STRUCTURE_TYPE_LATENCY_SLEEP_INFO_NV           : return sizeof( VkLatencySleepInfoNV );
+        case VK_STRUCTURE_TYPE_SET_LATENCY_MARKER_INFO_NV      : return sizeof( VkSetLatencyMarkerInfoNV );
+        case VK_STRUCTURE_TYPE_GET_LATENCY_MARKER_INFO_NV      : return sizeof( VkGetLatencyMarkerInfoNV );
+        case VK_STRUCTURE_TYPE_LATENCY_TIMINGS_FRAME_REPORT_NV : return sizeof( VkLatencyTimingsFrameReportNV );
+        case VK_STRUCTURE_TYPE_LATENCY_SUBMISSION_PRESENT_ID_NV: return sizeof( VkLatencySubmissionPresentIdNV );
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_LATENCY_CREATE_INFO_NV: return sizeof( VkSwapchainLatencyCreateInfoNV );
+        case VK_STRUCTURE_TYPE_OUT_OF_BAND_QUEUE_TYPE_INFO_NV  : return sizeof( VkOutOfBandQueueTypeInfoNV );
+        case VK_STRUCTURE_TYPE_LATENCY_SURFACE_CAPABILITIES_NV : return sizeof( VkLatencySurfaceCapabilitiesNV );
+
+        //=== VK_KHR_cooperative_matrix ===
+        case VK_STRUCTURE_TYPE_COOPERATIVE_MATRIX_PROPERTIES_KHR                : return sizeof( VkCooperativeMatrixPropertiesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_FEATURES_KHR  : return sizeof( VkPhysicalDeviceCooperativeMatrixFeaturesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_PROPERTIES_KHR: return sizeof( VkPhysicalDeviceCooperativeMatrixPropertiesKHR );
+
+        //=== VK_ARM_data_graph ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DATA_GRAPH_FEATURES_ARM                              : return sizeof( VkPhysicalDeviceDataGraphFeaturesARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_CONSTANT_ARM                                     : return sizeof( VkDataGraphPipelineConstantARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_RESOURCE_INFO_ARM                                : return sizeof( VkDataGraphPipelineResourceInfoARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_COMPILER_CONTROL_CREATE_INFO_ARM:
+          return sizeof( VkDataGraphPipelineCompilerControlCreateInfoARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_CREATE_INFO_ARM                                  : return sizeof( VkDataGraphPipelineCreateInfoARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_SHADER_MODULE_CREATE_INFO_ARM:
+          return sizeof( VkDataGraphPipelineShaderModuleCreateInfoARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_SESSION_CREATE_INFO_ARM                          : return sizeof( VkDataGraphPipelineSessionCreateInfoARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_SESSION_BIND_POINT_REQUIREMENTS_INFO_ARM:
+          return sizeof( VkDataGraphPipelineSessionBindPointRequirementsInfoARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_SESSION_BIND_POINT_REQUIREMENT_ARM:
+          return sizeof( VkDataGraphPipelineSessionBindPointRequirementARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_SESSION_MEMORY_REQUIREMENTS_INFO_ARM:
+          return sizeof( VkDataGraphPipelineSessionMemoryRequirementsInfoARM );
+        case VK_STRUCTURE_TYPE_BIND_DATA_GRAPH_PIPELINE_SESSION_MEMORY_INFO_ARM:
+          return sizeof( VkBindDataGraphPipelineSessionMemoryInfoARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_INFO_ARM                                         : return sizeof( VkDataGraphPipelineInfoARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_PROPERTY_QUERY_RESULT_ARM:
+          return sizeof( VkDataGraphPipelinePropertyQueryResultARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_IDENTIFIER_CREATE_INFO_ARM:
+          return sizeof( VkDataGraphPipelineIdentifierCreateInfoARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_DISPATCH_INFO_ARM                                : return sizeof( VkDataGraphPipelineDispatchInfoARM );
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_DATA_GRAPH_PROPERTIES_ARM                               : return sizeof( VkQueueFamilyDataGraphPropertiesARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PROCESSING_ENGINE_CREATE_INFO_ARM                         : return sizeof( VkDataGraphProcessingEngineCreateInfoARM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_QUEUE_FAMILY_DATA_GRAPH_PROCESSING_ENGINE_INFO_ARM:
+          return sizeof( VkPhysicalDeviceQueueFamilyDataGraphProcessingEngineInfoARM );
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_DATA_GRAPH_PROCESSING_ENGINE_PROPERTIES_ARM:
+          return sizeof( VkQueueFamilyDataGraphProcessingEnginePropertiesARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_CONSTANT_TENSOR_SEMI_STRUCTURED_SPARSITY_INFO_ARM:
+          return sizeof( VkDataGraphPipelineConstantTensorSemiStructuredSparsityInfoARM );
+
+        //=== VK_ARM_data_graph_instruction_set_tosa ===
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_DATA_GRAPH_TOSA_PROPERTIES_ARM: return sizeof( VkQueueFamilyDataGraphTOSAPropertiesARM );
+
+        //=== VK_QCOM_multiview_per_view_render_areas ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_RENDER_AREAS_FEATURES_QCOM:
+          return sizeof( VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM );
+        case VK_STRUCTURE_TYPE_MULTIVIEW_PER_VIEW_RENDER_AREAS_RENDER_PASS_BEGIN_INFO_QCOM:
+          return sizeof( VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM );
+
+        //=== VK_KHR_compute_shader_derivatives ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_DERIVATIVES_FEATURES_KHR  : return sizeof( VkPhysicalDeviceComputeShaderDerivativesFeaturesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_DERIVATIVES_PROPERTIES_KHR:
+          return sizeof( VkPhysicalDeviceComputeShaderDerivativesPropertiesKHR );
+
+        //=== VK_KHR_video_decode_av1 ===
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_AV1_PROFILE_INFO_KHR                  : return sizeof( VkVideoDecodeAV1ProfileInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_AV1_CAPABILITIES_KHR                  : return sizeof( VkVideoDecodeAV1CapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_AV1_SESSION_PARAMETERS_CREATE_INFO_KHR: return sizeof( VkVideoDecodeAV1SessionParametersCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_AV1_PICTURE_INFO_KHR                  : return sizeof( VkVideoDecodeAV1PictureInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_AV1_DPB_SLOT_INFO_KHR                 : return sizeof( VkVideoDecodeAV1DpbSlotInfoKHR );
+
+        //=== VK_KHR_video_encode_av1 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_ENCODE_AV1_FEATURES_KHR      : return sizeof( VkPhysicalDeviceVideoEncodeAV1FeaturesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_AV1_CAPABILITIES_KHR                  : return sizeof( VkVideoEncodeAV1CapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_AV1_QUALITY_LEVEL_PROPERTIES_KHR      : return sizeof( VkVideoEncodeAV1QualityLevelPropertiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_AV1_SESSION_CREATE_INFO_KHR           : return sizeof( VkVideoEncodeAV1SessionCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_AV1_SESSION_PARAMETERS_CREATE_INFO_KHR: return sizeof( VkVideoEncodeAV1SessionParametersCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_AV1_PICTURE_INFO_KHR                  : return sizeof( VkVideoEncodeAV1PictureInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_AV1_DPB_SLOT_INFO_KHR                 : return sizeof( VkVideoEncodeAV1DpbSlotInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_AV1_PROFILE_INFO_KHR                  : return sizeof( VkVideoEncodeAV1ProfileInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_AV1_GOP_REMAINING_FRAME_INFO_KHR      : return sizeof( VkVideoEncodeAV1GopRemainingFrameInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_AV1_RATE_CONTROL_INFO_KHR             : return sizeof( VkVideoEncodeAV1RateControlInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_AV1_RATE_CONTROL_LAYER_INFO_KHR       : return sizeof( VkVideoEncodeAV1RateControlLayerInfoKHR );
+
+        //=== VK_KHR_video_decode_vp9 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_DECODE_VP9_FEATURES_KHR: return sizeof( VkPhysicalDeviceVideoDecodeVP9FeaturesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_VP9_PROFILE_INFO_KHR            : return sizeof( VkVideoDecodeVP9ProfileInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_VP9_CAPABILITIES_KHR            : return sizeof( VkVideoDecodeVP9CapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_VP9_PICTURE_INFO_KHR            : return sizeof( VkVideoDecodeVP9PictureInfoKHR );
+
+        //=== VK_KHR_video_maintenance1 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_MAINTENANCE_1_FEATURES_KHR: return sizeof( VkPhysicalDeviceVideoMaintenance1FeaturesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_INLINE_QUERY_INFO_KHR                     : return sizeof( VkVideoInlineQueryInfoKHR );
+
+        //=== VK_NV_per_stage_descriptor_set ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PER_STAGE_DESCRIPTOR_SET_FEATURES_NV: return sizeof( VkPhysicalDevicePerStageDescriptorSetFeaturesNV );
+
+        //=== VK_QCOM_image_processing2 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_PROCESSING_2_FEATURES_QCOM  : return sizeof( VkPhysicalDeviceImageProcessing2FeaturesQCOM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_PROCESSING_2_PROPERTIES_QCOM: return sizeof( VkPhysicalDeviceImageProcessing2PropertiesQCOM );
+        case VK_STRUCTURE_TYPE_SAMPLER_BLOCK_MATCH_WINDOW_CREATE_INFO_QCOM       : return sizeof( VkSamplerBlockMatchWindowCreateInfoQCOM );
+
+        //=== VK_QCOM_filter_cubic_weights ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUBIC_WEIGHTS_FEATURES_QCOM: return sizeof( VkPhysicalDeviceCubicWeightsFeaturesQCOM );
+        case VK_STRUCTURE_TYPE_SAMPLER_CUBIC_WEIGHTS_CREATE_INFO_QCOM     : return sizeof( VkSamplerCubicWeightsCreateInfoQCOM );
+        case VK_STRUCTURE_TYPE_BLIT_IMAGE_CUBIC_WEIGHTS_INFO_QCOM         : return sizeof( VkBlitImageCubicWeightsInfoQCOM );
+
+        //=== VK_QCOM_ycbcr_degamma ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_DEGAMMA_FEATURES_QCOM            : return sizeof( VkPhysicalDeviceYcbcrDegammaFeaturesQCOM );
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_YCBCR_DEGAMMA_CREATE_INFO_QCOM: return sizeof( VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM );
+
+        //=== VK_QCOM_filter_cubic_clamp ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUBIC_CLAMP_FEATURES_QCOM: return sizeof( VkPhysicalDeviceCubicClampFeaturesQCOM );
+
+        //=== VK_EXT_attachment_feedback_loop_dynamic_state ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ATTACHMENT_FEEDBACK_LOOP_DYNAMIC_STATE_FEATURES_EXT:
+          return sizeof( VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT );
+
+        //=== VK_KHR_unified_image_layouts ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFIED_IMAGE_LAYOUTS_FEATURES_KHR: return sizeof( VkPhysicalDeviceUnifiedImageLayoutsFeaturesKHR );
+        case VK_STRUCTURE_TYPE_ATTACHMENT_FEEDBACK_LOOP_INFO_EXT                 : return sizeof( VkAttachmentFeedbackLoopInfoEXT );
+
+#if defined( VK_USE_PLATFORM_SCREEN_QNX )
+        //=== VK_QNX_external_memory_screen_buffer ===
+        case VK_STRUCTURE_TYPE_SCREEN_BUFFER_PROPERTIES_QNX                              : return sizeof( VkScreenBufferPropertiesQNX );
+        case VK_STRUCTURE_TYPE_SCREEN_BUFFER_FORMAT_PROPERTIES_QNX                       : return sizeof( VkScreenBufferFormatPropertiesQNX );
+        case VK_STRUCTURE_TYPE_IMPORT_SCREEN_BUFFER_INFO_QNX                             : return sizeof( VkImportScreenBufferInfoQNX );
+        case VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_QNX                                       : return sizeof( VkExternalFormatQNX );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_SCREEN_BUFFER_FEATURES_QNX:
+          return sizeof( VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX );
+#endif /*VK_USE_PLATFORM_SCREEN_QNX*/
+
+        //=== VK_MSFT_layered_driver ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LAYERED_DRIVER_PROPERTIES_MSFT: return sizeof( VkPhysicalDeviceLayeredDriverPropertiesMSFT );
+
+        //=== VK_KHR_calibrated_timestamps ===
+        case VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_KHR: return sizeof( VkCalibratedTimestampInfoKHR );
+
+        //=== VK_KHR_maintenance6 ===
+        case VK_STRUCTURE_TYPE_SET_DESCRIPTOR_BUFFER_OFFSETS_INFO_EXT           : return sizeof( VkSetDescriptorBufferOffsetsInfoEXT );
+        case VK_STRUCTURE_TYPE_BIND_DESCRIPTOR_BUFFER_EMBEDDED_SAMPLERS_INFO_EXT: return sizeof( VkBindDescriptorBufferEmbeddedSamplersInfoEXT );
+
+        //=== VK_NV_descriptor_pool_overallocation ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_POOL_OVERALLOCATION_FEATURES_NV:
+          return sizeof( VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV );
+
+        //=== VK_QCOM_tile_memory_heap ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TILE_MEMORY_HEAP_FEATURES_QCOM  : return sizeof( VkPhysicalDeviceTileMemoryHeapFeaturesQCOM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TILE_MEMORY_HEAP_PROPERTIES_QCOM: return sizeof( VkPhysicalDeviceTileMemoryHeapPropertiesQCOM );
+        case VK_STRUCTURE_TYPE_TILE_MEMORY_REQUIREMENTS_QCOM                   : return sizeof( VkTileMemoryRequirementsQCOM );
+        case VK_STRUCTURE_TYPE_TILE_MEMORY_BIND_INFO_QCOM                      : return sizeof( VkTileMemoryBindInfoQCOM );
+        case VK_STRUCTURE_TYPE_TILE_MEMORY_SIZE_INFO_QCOM                      : return sizeof( VkTileMemorySizeInfoQCOM );
+
+        //=== VK_KHR_copy_memory_indirect ===
+        case VK_STRUCTURE_TYPE_COPY_MEMORY_INDIRECT_INFO_KHR                      : return sizeof( VkCopyMemoryIndirectInfoKHR );
+        case VK_STRUCTURE_TYPE_COPY_MEMORY_TO_IMAGE_INDIRECT_INFO_KHR             : return sizeof( VkCopyMemoryToImageIndirectInfoKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COPY_MEMORY_INDIRECT_FEATURES_KHR  : return sizeof( VkPhysicalDeviceCopyMemoryIndirectFeaturesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COPY_MEMORY_INDIRECT_PROPERTIES_KHR: return sizeof( VkPhysicalDeviceCopyMemoryIndirectPropertiesKHR );
+
+        //=== VK_EXT_memory_decompression ===
+        case VK_STRUCTURE_TYPE_DECOMPRESS_MEMORY_INFO_EXT                         : return sizeof( VkDecompressMemoryInfoEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_DECOMPRESSION_FEATURES_EXT  : return sizeof( VkPhysicalDeviceMemoryDecompressionFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_DECOMPRESSION_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceMemoryDecompressionPropertiesEXT );
+
+        //=== VK_NV_display_stereo ===
+        case VK_STRUCTURE_TYPE_DISPLAY_SURFACE_STEREO_CREATE_INFO_NV: return sizeof( VkDisplaySurfaceStereoCreateInfoNV );
+        case VK_STRUCTURE_TYPE_DISPLAY_MODE_STEREO_PROPERTIES_NV    : return sizeof( VkDisplayModeStereoPropertiesNV );
+
+        //=== VK_KHR_video_encode_intra_refresh ===
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_INTRA_REFRESH_CAPABILITIES_KHR            : return sizeof( VkVideoEncodeIntraRefreshCapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_SESSION_INTRA_REFRESH_CREATE_INFO_KHR     : return sizeof( VkVideoEncodeSessionIntraRefreshCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_INTRA_REFRESH_INFO_KHR                    : return sizeof( VkVideoEncodeIntraRefreshInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_REFERENCE_INTRA_REFRESH_INFO_KHR                 : return sizeof( VkVideoReferenceIntraRefreshInfoKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_ENCODE_INTRA_REFRESH_FEATURES_KHR: return sizeof( VkPhysicalDeviceVideoEncodeIntraRefreshFeaturesKHR );
+
+        //=== VK_KHR_video_encode_quantization_map ===
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_QUANTIZATION_MAP_CAPABILITIES_KHR                  : return sizeof( VkVideoEncodeQuantizationMapCapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_FORMAT_QUANTIZATION_MAP_PROPERTIES_KHR                    : return sizeof( VkVideoFormatQuantizationMapPropertiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_QUANTIZATION_MAP_INFO_KHR                          : return sizeof( VkVideoEncodeQuantizationMapInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_QUANTIZATION_MAP_SESSION_PARAMETERS_CREATE_INFO_KHR:
+          return sizeof( VkVideoEncodeQuantizationMapSessionParametersCreateInfoKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_ENCODE_QUANTIZATION_MAP_FEATURES_KHR:
+          return sizeof( VkPhysicalDeviceVideoEncodeQuantizationMapFeaturesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_QUANTIZATION_MAP_CAPABILITIES_KHR:
+          return sizeof( VkVideoEncodeH264QuantizationMapCapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_QUANTIZATION_MAP_CAPABILITIES_KHR:
+          return sizeof( VkVideoEncodeH265QuantizationMapCapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_FORMAT_H265_QUANTIZATION_MAP_PROPERTIES_KHR               : return sizeof( VkVideoFormatH265QuantizationMapPropertiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_AV1_QUANTIZATION_MAP_CAPABILITIES_KHR:
+          return sizeof( VkVideoEncodeAV1QuantizationMapCapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_FORMAT_AV1_QUANTIZATION_MAP_PROPERTIES_KHR                : return sizeof( VkVideoFormatAV1QuantizationMapPropertiesKHR );
+
+        //=== VK_NV_raw_access_chains ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAW_ACCESS_CHAINS_FEATURES_NV: return sizeof( VkPhysicalDeviceRawAccessChainsFeaturesNV );
+
+        //=== VK_NV_external_compute_queue ===
+        case VK_STRUCTURE_TYPE_EXTERNAL_COMPUTE_QUEUE_DEVICE_CREATE_INFO_NV        : return sizeof( VkExternalComputeQueueDeviceCreateInfoNV );
+        case VK_STRUCTURE_TYPE_EXTERNAL_COMPUTE_QUEUE_CREATE_INFO_NV               : return sizeof( VkExternalComputeQueueCreateInfoNV );
+        case VK_STRUCTURE_TYPE_EXTERNAL_COMPUTE_QUEUE_DATA_PARAMS_NV               : return sizeof( VkExternalComputeQueueDataParamsNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_COMPUTE_QUEUE_PROPERTIES_NV: return sizeof( VkPhysicalDeviceExternalComputeQueuePropertiesNV );
+
+        //=== VK_KHR_shader_relaxed_extended_instruction ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_RELAXED_EXTENDED_INSTRUCTION_FEATURES_KHR:
+          return sizeof( VkPhysicalDeviceShaderRelaxedExtendedInstructionFeaturesKHR );
+
+        //=== VK_NV_command_buffer_inheritance ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMMAND_BUFFER_INHERITANCE_FEATURES_NV: return sizeof( VkPhysicalDeviceCommandBufferInheritanceFeaturesNV );
+
+        //=== VK_KHR_maintenance7 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_7_FEATURES_KHR       : return sizeof( VkPhysicalDeviceMaintenance7FeaturesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_7_PROPERTIES_KHR     : return sizeof( VkPhysicalDeviceMaintenance7PropertiesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LAYERED_API_PROPERTIES_LIST_KHR  : return sizeof( VkPhysicalDeviceLayeredApiPropertiesListKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LAYERED_API_PROPERTIES_KHR       : return sizeof( VkPhysicalDeviceLayeredApiPropertiesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LAYERED_API_VULKAN_PROPERTIES_KHR: return sizeof( VkPhysicalDeviceLayeredApiVulkanPropertiesKHR );
+
+        //=== VK_NV_shader_atomic_float16_vector ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT16_VECTOR_FEATURES_NV: return sizeof( VkPhysicalDeviceShaderAtomicFloat16VectorFeaturesNV );
+
+        //=== VK_EXT_shader_replicated_composites ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_REPLICATED_COMPOSITES_FEATURES_EXT:
+          return sizeof( VkPhysicalDeviceShaderReplicatedCompositesFeaturesEXT );
+
+        //=== VK_ARM_tensor_controls ===
+        case VK_STRUCTURE_TYPE_TENSOR_ROLLING_BACKING_CREATE_INFO_ARM      : return sizeof( VkTensorRollingBackingCreateInfoARM );
+        case VK_STRUCTURE_TYPE_TENSOR_EXPLICIT_TILING_FORMAT_PROPERTIES_ARM: return sizeof( VkTensorExplicitTilingFormatPropertiesARM );
+
+        //=== VK_EXT_shader_float8 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT8_FEATURES_EXT: return sizeof( VkPhysicalDeviceShaderFloat8FeaturesEXT );
+
+        //=== VK_NV_ray_tracing_validation ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_VALIDATION_FEATURES_NV: return sizeof( VkPhysicalDeviceRayTracingValidationFeaturesNV );
+
+        //=== VK_NV_cluster_acceleration_structure ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CLUSTER_ACCELERATION_STRUCTURE_FEATURES_NV:
+          return sizeof( VkPhysicalDeviceClusterAccelerationStructureFeaturesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CLUSTER_ACCELERATION_STRUCTURE_PROPERTIES_NV:
+          return sizeof( VkPhysicalDeviceClusterAccelerationStructurePropertiesNV );
+        case VK_STRUCTURE_TYPE_CLUSTER_ACCELERATION_STRUCTURE_CLUSTERS_BOTTOM_LEVEL_INPUT_NV:
+          return sizeof( VkClusterAccelerationStructureClustersBottomLevelInputNV );
+        case VK_STRUCTURE_TYPE_CLUSTER_ACCELERATION_STRUCTURE_TRIANGLE_CLUSTER_INPUT_NV:
+          return sizeof( VkClusterAccelerationStructureTriangleClusterInputNV );
+        case VK_STRUCTURE_TYPE_CLUSTER_ACCELERATION_STRUCTURE_MOVE_OBJECTS_INPUT_NV:
+          return sizeof( VkClusterAccelerationStructureMoveObjectsInputNV );
+        case VK_STRUCTURE_TYPE_CLUSTER_ACCELERATION_STRUCTURE_INPUT_INFO_NV                      : return sizeof( VkClusterAccelerationStructureInputInfoNV );
+        case VK_STRUCTURE_TYPE_CLUSTER_ACCELERATION_STRUCTURE_COMMANDS_INFO_NV:
+          return sizeof( VkClusterAccelerationStructureCommandsInfoNV );
+        case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CLUSTER_ACCELERATION_STRUCTURE_CREATE_INFO_NV:
+          return sizeof( VkRayTracingPipelineClusterAccelerationStructureCreateInfoNV );
+
+        //=== VK_NV_partitioned_acceleration_structure ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PARTITIONED_ACCELERATION_STRUCTURE_FEATURES_NV:
+          return sizeof( VkPhysicalDevicePartitionedAccelerationStructureFeaturesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PARTITIONED_ACCELERATION_STRUCTURE_PROPERTIES_NV:
+          return sizeof( VkPhysicalDevicePartitionedAccelerationStructurePropertiesNV );
+        case VK_STRUCTURE_TYPE_PARTITIONED_ACCELERATION_STRUCTURE_FLAGS_NV                     : return sizeof( VkPartitionedAccelerationStructureFlagsNV );
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_PARTITIONED_ACCELERATION_STRUCTURE_NV:
+          return sizeof( VkWriteDescriptorSetPartitionedAccelerationStructureNV );
+        case VK_STRUCTURE_TYPE_PARTITIONED_ACCELERATION_STRUCTURE_INSTANCES_INPUT_NV:
+          return sizeof( VkPartitionedAccelerationStructureInstancesInputNV );
+        case VK_STRUCTURE_TYPE_BUILD_PARTITIONED_ACCELERATION_STRUCTURE_INFO_NV                : return sizeof( VkBuildPartitionedAccelerationStructureInfoNV );
+
+        //=== VK_EXT_device_generated_commands ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_EXT  : return sizeof( VkPhysicalDeviceDeviceGeneratedCommandsFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceDeviceGeneratedCommandsPropertiesEXT );
+        case VK_STRUCTURE_TYPE_GENERATED_COMMANDS_MEMORY_REQUIREMENTS_INFO_EXT         : return sizeof( VkGeneratedCommandsMemoryRequirementsInfoEXT );
+        case VK_STRUCTURE_TYPE_INDIRECT_EXECUTION_SET_CREATE_INFO_EXT                  : return sizeof( VkIndirectExecutionSetCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_INDIRECT_EXECUTION_SET_PIPELINE_INFO_EXT                : return sizeof( VkIndirectExecutionSetPipelineInfoEXT );
+        case VK_STRUCTURE_TYPE_INDIRECT_EXECUTION_SET_SHADER_INFO_EXT                  : return sizeof( VkIndirectExecutionSetShaderInfoEXT );
+        case VK_STRUCTURE_TYPE_GENERATED_COMMANDS_INFO_EXT                             : return sizeof( VkGeneratedCommandsInfoEXT );
+        case VK_STRUCTURE_TYPE_WRITE_INDIRECT_EXECUTION_SET_PIPELINE_EXT               : return sizeof( VkWriteIndirectExecutionSetPipelineEXT );
+        case VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_CREATE_INFO_EXT                : return sizeof( VkIndirectCommandsLayoutCreateInfoEXT );
+        case VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_TOKEN_EXT                      : return sizeof( VkIndirectCommandsLayoutTokenEXT );
+        case VK_STRUCTURE_TYPE_INDIRECT_EXECUTION_SET_SHADER_LAYOUT_INFO_EXT           : return sizeof( VkIndirectExecutionSetShaderLayoutInfoEXT );
+        case VK_STRUCTURE_TYPE_GENERATED_COMMANDS_PIPELINE_INFO_EXT                    : return sizeof( VkGeneratedCommandsPipelineInfoEXT );
+        case VK_STRUCTURE_TYPE_GENERATED_COMMANDS_SHADER_INFO_EXT                      : return sizeof( VkGeneratedCommandsShaderInfoEXT );
+        case VK_STRUCTURE_TYPE_WRITE_INDIRECT_EXECUTION_SET_SHADER_EXT                 : return sizeof( VkWriteIndirectExecutionSetShaderEXT );
+
+        //=== VK_KHR_device_fault ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FAULT_FEATURES_KHR  : return sizeof( VkPhysicalDeviceFaultFeaturesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FAULT_PROPERTIES_KHR: return sizeof( VkPhysicalDeviceFaultPropertiesKHR );
+        case VK_STRUCTURE_TYPE_DEVICE_FAULT_INFO_KHR               : return sizeof( VkDeviceFaultInfoKHR );
+        case VK_STRUCTURE_TYPE_DEVICE_FAULT_DEBUG_INFO_KHR         : return sizeof( VkDeviceFaultDebugInfoKHR );
+
+        //=== VK_KHR_maintenance8 ===
+        case VK_STRUCTURE_TYPE_MEMORY_BARRIER_ACCESS_FLAGS_3_KHR         : return sizeof( VkMemoryBarrierAccessFlags3KHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_8_FEATURES_KHR: return sizeof( VkPhysicalDeviceMaintenance8FeaturesKHR );
+
+        //=== VK_MESA_image_alignment_control ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ALIGNMENT_CONTROL_FEATURES_MESA  : return sizeof( VkPhysicalDeviceImageAlignmentControlFeaturesMESA );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ALIGNMENT_CONTROL_PROPERTIES_MESA: return sizeof( VkPhysicalDeviceImageAlignmentControlPropertiesMESA );
+        case VK_STRUCTURE_TYPE_IMAGE_ALIGNMENT_CONTROL_CREATE_INFO_MESA               : return sizeof( VkImageAlignmentControlCreateInfoMESA );
+
+        //=== VK_KHR_shader_fma ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FMA_FEATURES_KHR: return sizeof( VkPhysicalDeviceShaderFmaFeaturesKHR );
+
+        //=== VK_NV_push_constant_bank ===
+        case VK_STRUCTURE_TYPE_PUSH_CONSTANT_BANK_INFO_NV                      : return sizeof( VkPushConstantBankInfoNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_CONSTANT_BANK_FEATURES_NV  : return sizeof( VkPhysicalDevicePushConstantBankFeaturesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_CONSTANT_BANK_PROPERTIES_NV: return sizeof( VkPhysicalDevicePushConstantBankPropertiesNV );
+
+        //=== VK_EXT_ray_tracing_invocation_reorder ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_INVOCATION_REORDER_PROPERTIES_EXT:
+          return sizeof( VkPhysicalDeviceRayTracingInvocationReorderPropertiesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_INVOCATION_REORDER_FEATURES_EXT:
+          return sizeof( VkPhysicalDeviceRayTracingInvocationReorderFeaturesEXT );
+
+        //=== VK_EXT_depth_clamp_control ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLAMP_CONTROL_FEATURES_EXT     : return sizeof( VkPhysicalDeviceDepthClampControlFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLAMP_CONTROL_CREATE_INFO_EXT: return sizeof( VkPipelineViewportDepthClampControlCreateInfoEXT );
+
+        //=== VK_KHR_maintenance9 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_9_FEATURES_KHR    : return sizeof( VkPhysicalDeviceMaintenance9FeaturesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_9_PROPERTIES_KHR  : return sizeof( VkPhysicalDeviceMaintenance9PropertiesKHR );
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_OWNERSHIP_TRANSFER_PROPERTIES_KHR: return sizeof( VkQueueFamilyOwnershipTransferPropertiesKHR );
+
+        //=== VK_KHR_video_maintenance2 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_MAINTENANCE_2_FEATURES_KHR    : return sizeof( VkPhysicalDeviceVideoMaintenance2FeaturesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_INLINE_SESSION_PARAMETERS_INFO_KHR: return sizeof( VkVideoDecodeH264InlineSessionParametersInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_INLINE_SESSION_PARAMETERS_INFO_KHR: return sizeof( VkVideoDecodeH265InlineSessionParametersInfoKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_AV1_INLINE_SESSION_PARAMETERS_INFO_KHR : return sizeof( VkVideoDecodeAV1InlineSessionParametersInfoKHR );
+
+#if defined( VK_USE_PLATFORM_OHOS )
+        //=== VK_OHOS_surface ===
+        case VK_STRUCTURE_TYPE_SURFACE_CREATE_INFO_OHOS: return sizeof( VkSurfaceCreateInfoOHOS );
+#endif /*VK_USE_PLATFORM_OHOS*/
+
+        //=== VK_HUAWEI_hdr_vivid ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HDR_VIVID_FEATURES_HUAWEI: return sizeof( VkPhysicalDeviceHdrVividFeaturesHUAWEI );
+        case VK_STRUCTURE_TYPE_HDR_VIVID_DYNAMIC_METADATA_HUAWEI        : return sizeof( VkHdrVividDynamicMetadataHUAWEI );
+
+        //=== VK_NV_cooperative_matrix2 ===
+        case VK_STRUCTURE_TYPE_COOPERATIVE_MATRIX_FLEXIBLE_DIMENSIONS_PROPERTIES_NV: return sizeof( VkCooperativeMatrixFlexibleDimensionsPropertiesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_2_FEATURES_NV    : return sizeof( VkPhysicalDeviceCooperativeMatrix2FeaturesNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_2_PROPERTIES_NV  : return sizeof( VkPhysicalDeviceCooperativeMatrix2PropertiesNV );
+
+        //=== VK_ARM_pipeline_opacity_micromap ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_OPACITY_MICROMAP_FEATURES_ARM: return sizeof( VkPhysicalDevicePipelineOpacityMicromapFeaturesARM );
+
+        //=== VK_KHR_video_encode_feedback2 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_ENCODE_FEEDBACK_2_FEATURES_KHR          : return sizeof( VkPhysicalDeviceVideoEncodeFeedback2FeaturesKHR );
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_FEEDBACK_2_CAPABILITIES_KHR                      : return sizeof( VkVideoEncodeFeedback2CapabilitiesKHR );
+        case VK_STRUCTURE_TYPE_QUERY_POOL_VIDEO_ENCODE_PER_PARTITION_FEEDBACK_CREATE_INFO_KHR:
+          return sizeof( VkQueryPoolVideoEncodePerPartitionFeedbackCreateInfoKHR );
+
+#if defined( VK_USE_PLATFORM_METAL_EXT )
+        //=== VK_EXT_external_memory_metal ===
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_METAL_HANDLE_INFO_EXT: return sizeof( VkImportMemoryMetalHandleInfoEXT );
+        case VK_STRUCTURE_TYPE_MEMORY_METAL_HANDLE_PROPERTIES_EXT : return sizeof( VkMemoryMetalHandlePropertiesEXT );
+        case VK_STRUCTURE_TYPE_MEMORY_GET_METAL_HANDLE_INFO_EXT   : return sizeof( VkMemoryGetMetalHandleInfoEXT );
+#endif /*VK_USE_PLATFORM_METAL_EXT*/
+
+        //=== VK_KHR_depth_clamp_zero_one ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLAMP_ZERO_ONE_FEATURES_KHR: return sizeof( VkPhysicalDeviceDepthClampZeroOneFeaturesKHR );
+
+        //=== VK_ARM_performance_counters_by_region ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_COUNTERS_BY_REGION_FEATURES_ARM:
+          return sizeof( VkPhysicalDevicePerformanceCountersByRegionFeaturesARM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_COUNTERS_BY_REGION_PROPERTIES_ARM:
+          return sizeof( VkPhysicalDevicePerformanceCountersByRegionPropertiesARM );
+        case VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_ARM                                      : return sizeof( VkPerformanceCounterARM );
+        case VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_DESCRIPTION_ARM                          : return sizeof( VkPerformanceCounterDescriptionARM );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_PERFORMANCE_COUNTERS_BY_REGION_BEGIN_INFO_ARM:
+          return sizeof( VkRenderPassPerformanceCountersByRegionBeginInfoARM );
+
+        //=== VK_ARM_shader_instrumentation ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INSTRUMENTATION_FEATURES_ARM  : return sizeof( VkPhysicalDeviceShaderInstrumentationFeaturesARM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INSTRUMENTATION_PROPERTIES_ARM: return sizeof( VkPhysicalDeviceShaderInstrumentationPropertiesARM );
+        case VK_STRUCTURE_TYPE_SHADER_INSTRUMENTATION_CREATE_INFO_ARM               : return sizeof( VkShaderInstrumentationCreateInfoARM );
+        case VK_STRUCTURE_TYPE_SHADER_INSTRUMENTATION_METRIC_DESCRIPTION_ARM        : return sizeof( VkShaderInstrumentationMetricDescriptionARM );
+
+        //=== VK_EXT_vertex_attribute_robustness ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_ROBUSTNESS_FEATURES_EXT: return sizeof( VkPhysicalDeviceVertexAttributeRobustnessFeaturesEXT );
+
+        //=== VK_ARM_format_pack ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FORMAT_PACK_FEATURES_ARM: return sizeof( VkPhysicalDeviceFormatPackFeaturesARM );
+
+        //=== VK_VALVE_fragment_density_map_layered ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_LAYERED_FEATURES_VALVE:
+          return sizeof( VkPhysicalDeviceFragmentDensityMapLayeredFeaturesVALVE );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_LAYERED_PROPERTIES_VALVE:
+          return sizeof( VkPhysicalDeviceFragmentDensityMapLayeredPropertiesVALVE );
+        case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_DENSITY_MAP_LAYERED_CREATE_INFO_VALVE:
+          return sizeof( VkPipelineFragmentDensityMapLayeredCreateInfoVALVE );
+
+        //=== VK_KHR_robustness2 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FEATURES_KHR  : return sizeof( VkPhysicalDeviceRobustness2FeaturesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_PROPERTIES_KHR: return sizeof( VkPhysicalDeviceRobustness2PropertiesKHR );
+
+        //=== VK_NV_present_metering ===
+        case VK_STRUCTURE_TYPE_SET_PRESENT_CONFIG_NV                       : return sizeof( VkSetPresentConfigNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_METERING_FEATURES_NV: return sizeof( VkPhysicalDevicePresentMeteringFeaturesNV );
+
+        //=== VK_EXT_multisampled_render_to_swapchain ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTISAMPLED_RENDER_TO_SWAPCHAIN_FEATURES_EXT:
+          return sizeof( VkPhysicalDeviceMultisampledRenderToSwapchainFeaturesEXT );
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_FLAGS_SURFACE_CAPABILITIES_EXT                     : return sizeof( VkSwapchainFlagsSurfaceCapabilitiesEXT );
+
+        //=== VK_EXT_fragment_density_map_offset ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_OFFSET_FEATURES_EXT  : return sizeof( VkPhysicalDeviceFragmentDensityMapOffsetFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_OFFSET_PROPERTIES_EXT:
+          return sizeof( VkPhysicalDeviceFragmentDensityMapOffsetPropertiesEXT );
+        case VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_OFFSET_END_INFO_EXT      : return sizeof( VkRenderPassFragmentDensityMapOffsetEndInfoEXT );
+
+        //=== VK_EXT_zero_initialize_device_memory ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_DEVICE_MEMORY_FEATURES_EXT:
+          return sizeof( VkPhysicalDeviceZeroInitializeDeviceMemoryFeaturesEXT );
+
+        //=== VK_KHR_present_mode_fifo_latest_ready ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_MODE_FIFO_LATEST_READY_FEATURES_KHR:
+          return sizeof( VkPhysicalDevicePresentModeFifoLatestReadyFeaturesKHR );
+
+        //=== VK_KHR_opacity_micromap ===
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_MICROMAP_DATA_KHR    : return sizeof( VkAccelerationStructureGeometryMicromapDataKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPACITY_MICROMAP_FEATURES_KHR        : return sizeof( VkPhysicalDeviceOpacityMicromapFeaturesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPACITY_MICROMAP_PROPERTIES_KHR      : return sizeof( VkPhysicalDeviceOpacityMicromapPropertiesKHR );
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_TRIANGLES_OPACITY_MICROMAP_KHR: return sizeof( VkAccelerationStructureTrianglesOpacityMicromapKHR );
+
+        //=== VK_EXT_shader_64bit_indexing ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_64_BIT_INDEXING_FEATURES_EXT: return sizeof( VkPhysicalDeviceShader64BitIndexingFeaturesEXT );
+
+        //=== VK_EXT_custom_resolve ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_RESOLVE_FEATURES_EXT: return sizeof( VkPhysicalDeviceCustomResolveFeaturesEXT );
+        case VK_STRUCTURE_TYPE_BEGIN_CUSTOM_RESOLVE_INFO_EXT              : return sizeof( VkBeginCustomResolveInfoEXT );
+        case VK_STRUCTURE_TYPE_CUSTOM_RESOLVE_CREATE_INFO_EXT             : return sizeof( VkCustomResolveCreateInfoEXT );
+
+        //=== VK_QCOM_data_graph_model ===
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_BUILTIN_MODEL_CREATE_INFO_QCOM: return sizeof( VkDataGraphPipelineBuiltinModelCreateInfoQCOM );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DATA_GRAPH_MODEL_FEATURES_QCOM    : return sizeof( VkPhysicalDeviceDataGraphModelFeaturesQCOM );
+
+        //=== VK_KHR_maintenance10 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_10_FEATURES_KHR  : return sizeof( VkPhysicalDeviceMaintenance10FeaturesKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_10_PROPERTIES_KHR: return sizeof( VkPhysicalDeviceMaintenance10PropertiesKHR );
+        case VK_STRUCTURE_TYPE_RENDERING_END_INFO_KHR                       : return sizeof( VkRenderingEndInfoKHR );
+        case VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_FLAGS_INFO_KHR          : return sizeof( VkRenderingAttachmentFlagsInfoKHR );
+        case VK_STRUCTURE_TYPE_RESOLVE_IMAGE_MODE_INFO_KHR                  : return sizeof( VkResolveImageModeInfoKHR );
+
+        //=== VK_ARM_data_graph_optical_flow ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DATA_GRAPH_OPTICAL_FLOW_FEATURES_ARM: return sizeof( VkPhysicalDeviceDataGraphOpticalFlowFeaturesARM );
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_DATA_GRAPH_OPTICAL_FLOW_PROPERTIES_ARM : return sizeof( VkQueueFamilyDataGraphOpticalFlowPropertiesARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_OPTICAL_FLOW_CREATE_INFO_ARM    : return sizeof( VkDataGraphPipelineOpticalFlowCreateInfoARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_OPTICAL_FLOW_IMAGE_FORMAT_PROPERTIES_ARM : return sizeof( VkDataGraphOpticalFlowImageFormatPropertiesARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_OPTICAL_FLOW_IMAGE_FORMAT_INFO_ARM       : return sizeof( VkDataGraphOpticalFlowImageFormatInfoARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_OPTICAL_FLOW_DISPATCH_INFO_ARM  : return sizeof( VkDataGraphPipelineOpticalFlowDispatchInfoARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_RESOURCE_INFO_IMAGE_LAYOUT_ARM  : return sizeof( VkDataGraphPipelineResourceInfoImageLayoutARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_SINGLE_NODE_CREATE_INFO_ARM     : return sizeof( VkDataGraphPipelineSingleNodeCreateInfoARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_SINGLE_NODE_CONNECTION_ARM      : return sizeof( VkDataGraphPipelineSingleNodeConnectionARM );
+
+        //=== VK_EXT_shader_long_vector ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_LONG_VECTOR_FEATURES_EXT  : return sizeof( VkPhysicalDeviceShaderLongVectorFeaturesEXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_LONG_VECTOR_PROPERTIES_EXT: return sizeof( VkPhysicalDeviceShaderLongVectorPropertiesEXT );
+
+        //=== VK_SEC_pipeline_cache_incremental_mode ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CACHE_INCREMENTAL_MODE_FEATURES_SEC:
+          return sizeof( VkPhysicalDevicePipelineCacheIncrementalModeFeaturesSEC );
+
+        //=== VK_EXT_shader_uniform_buffer_unsized_array ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_UNIFORM_BUFFER_UNSIZED_ARRAY_FEATURES_EXT:
+          return sizeof( VkPhysicalDeviceShaderUniformBufferUnsizedArrayFeaturesEXT );
+
+        //=== VK_NV_compute_occupancy_priority ===
+        case VK_STRUCTURE_TYPE_COMPUTE_OCCUPANCY_PRIORITY_PARAMETERS_NV              : return sizeof( VkComputeOccupancyPriorityParametersNV );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_OCCUPANCY_PRIORITY_FEATURES_NV: return sizeof( VkPhysicalDeviceComputeOccupancyPriorityFeaturesNV );
+
+        //=== VK_KHR_maintenance11 ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_11_FEATURES_KHR                   : return sizeof( VkPhysicalDeviceMaintenance11FeaturesKHR );
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_OPTIMAL_IMAGE_TRANSFER_GRANULARITY_PROPERTIES_KHR:
+          return sizeof( VkQueueFamilyOptimalImageTransferGranularityPropertiesKHR );
+
+        //=== VK_EXT_cooperative_matrix_maintenance1 ===
+        case VK_STRUCTURE_TYPE_COOPERATIVE_MATRIX_PROPERTIES_2_EXT                          : return sizeof( VkCooperativeMatrixProperties2EXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_INFO_2_EXT                : return sizeof( VkPhysicalDeviceCooperativeMatrixInfo2EXT );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_MAINTENANCE_1_FEATURES_EXT:
+          return sizeof( VkPhysicalDeviceCooperativeMatrixMaintenance1FeaturesEXT );
+
+        //=== VK_EXT_shader_subgroup_partitioned ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_PARTITIONED_FEATURES_EXT: return sizeof( VkPhysicalDeviceShaderSubgroupPartitionedFeaturesEXT );
+
+#if defined( VK_USE_PLATFORM_UBM_SEC )
+        //=== VK_SEC_ubm_surface ===
+        case VK_STRUCTURE_TYPE_UBM_SURFACE_CREATE_INFO_SEC: return sizeof( VkUbmSurfaceCreateInfoSEC );
+#endif /*VK_USE_PLATFORM_UBM_SEC*/
+
+        //=== VK_KHR_extended_flags ===
+        case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_4_KHR                    : return sizeof( VkFormatProperties4KHR );
+        case VK_STRUCTURE_TYPE_IMAGE_USAGE_FLAGS_2_CREATE_INFO_KHR        : return sizeof( VkImageUsageFlags2CreateInfoKHR );
+        case VK_STRUCTURE_TYPE_IMAGE_CREATE_FLAGS_2_CREATE_INFO_KHR       : return sizeof( VkImageCreateFlags2CreateInfoKHR );
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_2_CREATE_INFO_KHR         : return sizeof( VkImageViewUsage2CreateInfoKHR );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_FLAGS_FEATURES_KHR: return sizeof( VkPhysicalDeviceExtendedFlagsFeaturesKHR );
+        case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_2_CREATE_INFO_KHR      : return sizeof( VkImageStencilUsage2CreateInfoKHR );
+        case VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_2_KHR  : return sizeof( VkSharedPresentSurfaceCapabilities2KHR );
+
+        //=== VK_EXT_shader_ocp_microscaling_types ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OCP_MICROSCALING_TYPES_FEATURES_EXT:
+          return sizeof( VkPhysicalDeviceShaderOCPMicroscalingTypesFeaturesEXT );
+
+        //=== VK_VALVE_shader_mixed_float_dot_product ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MIXED_FLOAT_DOT_PRODUCT_FEATURES_VALVE:
+          return sizeof( VkPhysicalDeviceShaderMixedFloatDotProductFeaturesVALVE );
+
+        //=== VK_SEC_throttle_hint ===
+        case VK_STRUCTURE_TYPE_THROTTLE_HINT_SUBMIT_INFO_SEC             : return sizeof( VkThrottleHintSubmitInfoSEC );
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_THROTTLE_HINT_FEATURES_SEC: return sizeof( VkPhysicalDeviceThrottleHintFeaturesSEC );
+
+        //=== VK_ARM_data_graph_neural_accelerator_statistics ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DATA_GRAPH_NEURAL_ACCELERATOR_STATISTICS_FEATURES_ARM:
+          return sizeof( VkPhysicalDeviceDataGraphNeuralAcceleratorStatisticsFeaturesARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_NEURAL_STATISTICS_CREATE_INFO_ARM:
+          return sizeof( VkDataGraphPipelineNeuralStatisticsCreateInfoARM );
+        case VK_STRUCTURE_TYPE_DATA_GRAPH_PIPELINE_SESSION_NEURAL_STATISTICS_CREATE_INFO_ARM:
+          return sizeof( VkDataGraphPipelineSessionNeuralStatisticsCreateInfoARM );
+
+        //=== VK_EXT_primitive_restart_index ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVE_RESTART_INDEX_FEATURES_EXT: return sizeof( VkPhysicalDevicePrimitiveRestartIndexFeaturesEXT );
+
+        //=== VK_EXT_image_tiling_control ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_TILING_CONTROL_FEATURES_EXT: return sizeof( VkPhysicalDeviceImageTilingControlFeaturesEXT );
+        case VK_STRUCTURE_TYPE_IMAGE_TILING_CONTROL_CREATE_INFO_EXT             : return sizeof( VkImageTilingControlCreateInfoEXT );
+
+        //=== VK_NV_cooperative_matrix_decode_vector ===
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_DECODE_VECTOR_FEATURES_NV:
+          return sizeof( VkPhysicalDeviceCooperativeMatrixDecodeVectorFeaturesNV );
+
+        default: return 0;
+      }
+    }
+
+    // the kinds of output parameters
+    struct NullDriverCountOutput
+    {
+    };
+
+    struct NullDriverHandleOutput
+    {
+    };
+
+    struct NullDriverMemoryOutput
+    {
+    };
+
+    struct NullDriverBytesOutput
+    {
+    };
+
+    struct NullDriverStructureOutput
+    {
+    };
+
+    struct NullDriverValueOutput
+    {
+    };
+
+    template <typename T>
+    struct NullDriverOutputKind
+    {
+      using type = typename std::conditional<
+        std::is_same<T, size_t>::value,
+        NullDriverCountOutput,
+        typename std::conditional<std::is_class<T>::value, NullDriverStructureOutput, NullDriverValueOutput>::type>::type;
+    };
+
+    // handles are pointers to incomplete structs, any other pointer is some memory
+    template <typename T>
+    struct NullDriverOutputKind<T *>
+    {
+      using type = typename std::conditional<std::is_class<T>::value, NullDriverHandleOutput, NullDriverMemoryOutput>::type;
+    };
+
+    template <>
+    struct NullDriverOutputKind<void>
+    {
+      using type = NullDriverBytesOutput;
+    };
+
+    // a uint32_t or size_t might be the count of an enumeration
+    template <>
+    struct NullDriverOutputKind<uint32_t>
+    {
+      using type = NullDriverCountOutput;
+    };
+
+    // on 32-bit platforms, the non-dispatchable handles are uint64_t; otherwise, a uint64_t is treated like a size_t
+    template <>
+    struct NullDriverOutputKind<uint64_t>
+    {
+#if ( VK_USE_64_BIT_PTR_DEFINES == 1 )
+      using type = NullDriverCountOutput;
+#else
+      using type = NullDriverHandleOutput;
+#endif
+    };
+
+    template <typename T, typename = void>
+    struct NullDriverHasStructureType : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct NullDriverHasStructureType<T, decltype( (void)std::declval<T &>().sType )> : std::true_type
+    {
+    };
+
+    template <typename ReturnType>
+    struct NullDriverResult
+    {
+      static ReturnType get( bool /*incomplete*/ ) VULKAN_HPP_NOEXCEPT
+      {
+        return ReturnType();
+      }
+    };
+
+    template <>
+    struct NullDriverResult<VkResult>
+    {
+      static VkResult get( bool incomplete ) VULKAN_HPP_NOEXCEPT
+      {
+        return incomplete ? VK_INCOMPLETE : VK_SUCCESS;
+      }
+    };
+
+    // Walks through the parameters of one call, in order, writing the outputs. A count output directly followed by an array output is
+    // treated as a two-call enumeration; all array outputs directly following it share its count.
+    class NullDriverCall
+    {
+    public:
+      explicit NullDriverCall( uint32_t handleCount ) VULKAN_HPP_NOEXCEPT : m_handleCount( handleCount ) {}
+
+      template <typename T>
+      void process( T const &, std::false_type /*isOutput*/ ) VULKAN_HPP_NOEXCEPT
+      {
+        endEnumeration();
+      }
+
+      template <typename T>
+      void process( T * pOutput, std::true_type /*isOutput*/ ) VULKAN_HPP_NOEXCEPT
+      {
+        output( pOutput, typename NullDriverOutputKind<T>::type() );
+      }
+
+      template <typename ReturnType>
+      ReturnType finish() VULKAN_HPP_NOEXCEPT
+      {
+        endEnumeration();
+        return NullDriverResult<ReturnType>::get( m_incomplete );
+      }
+
+    private:
+      template <typename T>
+      void output( T * pCount, NullDriverCountOutput ) VULKAN_HPP_NOEXCEPT
+      {
+        endEnumeration();
+        m_count     = pCount;
+        m_countSize = sizeof( T );
+      }
+
+      template <typename T>
+      void output( T * pMemory, NullDriverMemoryOutput ) VULKAN_HPP_NOEXCEPT
+      {
+        endEnumeration();
+        if ( pMemory )
+        {
+          *pMemory = NullDriver::mappedMemory();
+        }
+      }
+
+      template <typename T, typename Kind>
+      void output( T * pOutput, Kind kind ) VULKAN_HPP_NOEXCEPT
+      {
+        uint64_t count = std::is_same<Kind, NullDriverHandleOutput>::value ? m_handleCount : 1;
+        if ( m_count )
+        {
+          // the array of a two-call enumeration
+          uint64_t enumerationCount = NullDriver::configuration().enumerationCount;
+          count                     = pOutput ? ( std::min )( readCount(), enumerationCount ) : 0;
+          m_incomplete              = m_incomplete || ( pOutput && ( count < enumerationCount ) );
+          writeCount( pOutput ? count : enumerationCount );
+          m_count          = nullptr;
+          m_inEnumeration  = true;
+          m_enumeratedSize = count;
+        }
+        else if ( m_inEnumeration )
+        {
+          count = m_enumeratedSize;
+        }
+        if ( pOutput )
+        {
+          fill( pOutput, count, kind );
+        }
+      }
+
+      template <typename T>
+      void fill( T * pHandles, uint64_t count, NullDriverHandleOutput ) VULKAN_HPP_NOEXCEPT
+      {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+          pHandles[i] = NullDriver::nextHandle<T>();
+        }
+      }
+
+      void fill( void * pBytes, uint64_t count, NullDriverBytesOutput ) VULKAN_HPP_NOEXCEPT
+      {
+        // only the bytes of an enumeration have a known size
+        if ( m_inEnumeration )
+        {
+          memset( pBytes, 0, static_cast<size_t>( count ) );
+        }
+      }
+
+      template <typename T>
+      void fill( T * pStructures, uint64_t count, NullDriverStructureOutput ) VULKAN_HPP_NOEXCEPT
+      {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+          clearStructure( pStructures[i], NullDriverHasStructureType<T>() );
+        }
+      }
+
+      template <typename T>
+      void fill( T * pValues, uint64_t count, NullDriverValueOutput ) VULKAN_HPP_NOEXCEPT
+      {
+        memset( pValues, 0, static_cast<size_t>( count ) * sizeof( T ) );
+      }
+
+      template <typename T>
+      static void clearStructure( T & structure, std::true_type /*hasStructureType*/ ) VULKAN_HPP_NOEXCEPT
+      {
+        clearChainedStructure( reinterpret_cast<VkBaseOutStructure *>( &structure ), sizeof( T ) );
+      }
+
+      template <typename T>
+      static void clearStructure( T & structure, std::false_type /*hasStructureType*/ ) VULKAN_HPP_NOEXCEPT
+      {
+        memset( &structure, 0, sizeof( T ) );
+      }
+
+      // clears everything but sType and pNext, and continues with the next structure in the chain
+      static void clearChainedStructure( VkBaseOutStructure * structure, size_t size ) VULKAN_HPP_NOEXCEPT
+      {
+        while ( structure && ( sizeof( VkBaseOutStructure ) <= size ) )
+        {
+          memset( reinterpret_cast<uint8_t *>( structure ) + sizeof( VkBaseOutStructure ), 0, size - sizeof( VkBaseOutStructure ) );
+          structure = structure->pNext;
+          size      = structure ? nullDriverStructureSize( structure->sType ) : 0;
+        }
+      }
+
+      uint64_t readCount() const VULKAN_HPP_NOEXCEPT
+      {
+        if ( m_countSize == sizeof( uint32_t ) )
+        {
+          uint32_t count;
+          memcpy( &count, m_count, sizeof( count ) );
+          return count;
+        }
+        uint64_t count;
+        memcpy( &count, m_count, sizeof( count ) );
+        return count;
+      }
+
+      void writeCount( uint64_t count ) VULKAN_HPP_NOEXCEPT
+      {
+        if ( m_countSize == sizeof( uint32_t ) )
+        {
+          uint32_t count32 = static_cast<uint32_t>( count );
+          memcpy( m_count, &count32, sizeof( count32 ) );
+        }
+        else
+        {
+          memcpy( m_count, &count, sizeof( count ) );
+        }
+      }
+
+      void endEnumeration() VULKAN_HPP_NOEXCEPT
+      {
+        if ( m_count )
+        {
+          // a count output not followed by an array is just a scalar
+          writeCount( 0 );
+          m_count = nullptr;
+        }
+        m_inEnumeration = false;
+      }
+
+    private:
+      uint32_t m_handleCount;
+      void *   m_count          = nullptr;  // a pending count output, that might be followed by the array of an enumeration
+      size_t   m_countSize      = 0;
+      bool     m_inEnumeration  = false;
+      uint64_t m_enumeratedSize = 0;
+      bool     m_incomplete     = false;
+    };
+
+    // the number of handles returned by a command; specialized for the commands returning an array of handles
+    template <typename PFN>
+    struct NullDriverHandleCount
+    {
+      template <typename... Args>
+      static uint32_t get( Args... ) VULKAN_HPP_NOEXCEPT
+      {
+        return 1;
+      }
+    };
+
+    //=== VK_VERSION_1_0 ===
+
+    template <>
+    struct NullDriverHandleCount<PFN_vkAllocateCommandBuffers>
+    {
+      static uint32_t get( VkDevice, VkCommandBufferAllocateInfo const * pAllocateInfo, VkCommandBuffer * ) VULKAN_HPP_NOEXCEPT
+      {
+        return pAllocateInfo->commandBufferCount;
+      }
+    };
+
+    template <>
+    struct NullDriverHandleCount<PFN_vkCreateComputePipelines>
+    {
+      static uint32_t get( VkDevice,
+                           VkPipelineCache,
+                           uint32_t createInfoCount,
+                           VkComputePipelineCreateInfo const *,
+                           VkAllocationCallbacks const *,
+                           VkPipeline * ) VULKAN_HPP_NOEXCEPT
+      {
+        return createInfoCount;
+      }
+    };
+
+    template <>
+    struct NullDriverHandleCount<PFN_vkAllocateDescriptorSets>
+    {
+      static uint32_t get( VkDevice, VkDescriptorSetAllocateInfo const * pAllocateInfo, VkDescriptorSet * ) VULKAN_HPP_NOEXCEPT
+      {
+        return pAllocateInfo->descriptorSetCount;
+      }
+    };
+
+    template <>
+    struct NullDriverHandleCount<PFN_vkCreateGraphicsPipelines>
+    {
+      static uint32_t get( VkDevice,
+                           VkPipelineCache,
+                           uint32_t createInfoCount,
+                           VkGraphicsPipelineCreateInfo const *,
+                           VkAllocationCallbacks const *,
+                           VkPipeline * ) VULKAN_HPP_NOEXCEPT
+      {
+        return createInfoCount;
+      }
+    };
+
+    //=== VK_KHR_display_swapchain ===
+
+    template <>
+    struct NullDriverHandleCount<PFN_vkCreateSharedSwapchainsKHR>
+    {
+      static uint32_t get( VkDevice,
+                           uint32_t swapchainCount,
+                           VkSwapchainCreateInfoKHR const *,
+                           VkAllocationCallbacks const *,
+                           VkSwapchainKHR * ) VULKAN_HPP_NOEXCEPT
+      {
+        return swapchainCount;
+      }
+    };
+
+#if defined( VK_ENABLE_BETA_EXTENSIONS )
+    //=== VK_AMDX_shader_enqueue ===
+
+    template <>
+    struct NullDriverHandleCount<PFN_vkCreateExecutionGraphPipelinesAMDX>
+    {
+      static uint32_t get( VkDevice,
+                           VkPipelineCache,
+                           uint32_t createInfoCount,
+                           VkExecutionGraphPipelineCreateInfoAMDX const *,
+                           VkAllocationCallbacks const *,
+                           VkPipeline * ) VULKAN_HPP_NOEXCEPT
+      {
+        return createInfoCount;
+      }
+    };
+#endif /*VK_ENABLE_BETA_EXTENSIONS*/
+
+    //=== VK_KHR_ray_tracing_pipeline ===
+
+    template <>
+    struct NullDriverHandleCount<PFN_vkCreateRayTracingPipelinesKHR>
+    {
+      static uint32_t get( VkDevice,
+                           VkDeferredOperationKHR,
+                           VkPipelineCache,
+                           uint32_t createInfoCount,
+                           VkRayTracingPipelineCreateInfoKHR const *,
+                           VkAllocationCallbacks const *,
+                           VkPipeline * ) VULKAN_HPP_NOEXCEPT
+      {
+        return createInfoCount;
+      }
+    };
+
+    //=== VK_NV_ray_tracing ===
+
+    template <>
+    struct NullDriverHandleCount<PFN_vkCreateRayTracingPipelinesNV>
+    {
+      static uint32_t get( VkDevice,
+                           VkPipelineCache,
+                           uint32_t createInfoCount,
+                           VkRayTracingPipelineCreateInfoNV const *,
+                           VkAllocationCallbacks const *,
+                           VkPipeline * ) VULKAN_HPP_NOEXCEPT
+      {
+        return createInfoCount;
+      }
+    };
+
+    //=== VK_EXT_shader_object ===
+
+    template <>
+    struct NullDriverHandleCount<PFN_vkCreateShadersEXT>
+    {
+      static uint32_t get( VkDevice, uint32_t createInfoCount, VkShaderCreateInfoEXT const *, VkAllocationCallbacks const *, VkShaderEXT * ) VULKAN_HPP_NOEXCEPT
+      {
+        return createInfoCount;
+      }
+    };
+
+    //=== VK_ARM_data_graph ===
+
+    template <>
+    struct NullDriverHandleCount<PFN_vkCreateDataGraphPipelinesARM>
+    {
+      static uint32_t get( VkDevice,
+                           VkDeferredOperationKHR,
+                           VkPipelineCache,
+                           uint32_t createInfoCount,
+                           VkDataGraphPipelineCreateInfoARM const *,
+                           VkAllocationCallbacks const *,
+                           VkPipeline * ) VULKAN_HPP_NOEXCEPT
+      {
+        return createInfoCount;
+      }
+    };
+
+    // bit i of OutputMask is set if parameter i of the command is an output
+    template <typename PFN, uint32_t OutputMask>
+    class NullDriverCommand;
+
+    template <uint32_t OutputMask, typename ReturnType, typename... Args>
+    class NullDriverCommand<ReturnType( VKAPI_PTR * )( Args... ), OutputMask>
+    {
+    public:
+      static PFN_vkVoidFunction pfn() VULKAN_HPP_NOEXCEPT
+      {
+        return reinterpret_cast<PFN_vkVoidFunction>( &NullDriverCommand::call );
+      }
+
+    private:
+      static VKAPI_ATTR ReturnType VKAPI_CALL call( Args... args )
+      {
+        NullDriverCall nullDriverCall( NullDriverHandleCount<ReturnType( VKAPI_PTR * )( Args... )>::get( args... ) );
+        processArguments<OutputMask>( nullDriverCall, args... );
+        return nullDriverCall.finish<ReturnType>();
+      }
+
+      template <uint32_t Mask, typename Arg, typename... Rest>
+      static void processArguments( NullDriverCall & nullDriverCall, Arg arg, Rest... rest ) VULKAN_HPP_NOEXCEPT
+      {
+        nullDriverCall.process( arg, std::integral_constant<bool, ( Mask & 1 ) != 0>() );
+        processArguments<( Mask >> 1 )>( nullDriverCall, rest... );
+      }
+
+      template <uint32_t Mask>
+      static void processArguments( NullDriverCall & ) VULKAN_HPP_NOEXCEPT
+      {
+      }
+    };
+
+    struct NullDriverCommandEntry
+    {
+      char const *       name;
+      PFN_vkVoidFunction pfn;
+    };
+
+    inline PFN_vkVoidFunction NullDriver::getProcAddr( char const * pName )
+    {
+      for ( auto const & command : configuration().overrides )
+      {
+        if ( command.first == pName )
+        {
+          return command.second;
+        }
+      }
+      if ( strcmp( pName, "vkGetInstanceProcAddr" ) == 0 )
+      {
+        return reinterpret_cast<PFN_vkVoidFunction>( &NullDriver::getInstanceProcAddr );
+      }
+      if ( strcmp( pName, "vkGetDeviceProcAddr" ) == 0 )
+      {
+        return reinterpret_cast<PFN_vkVoidFunction>( &NullDriver::getDeviceProcAddr );
+      }
+      if ( strcmp( pName, "vkEnumerateInstanceVersion" ) == 0 )
+      {
+        return reinterpret_cast<PFN_vkVoidFunction>( &NullDriver::enumerateInstanceVersion );
+      }
+
+      // sorted once, to look up the commands by binary search
+      static std::vector<NullDriverCommandEntry> const commands = []()
+      {
+        std::vector<NullDriverCommandEntry> commands = {
+          //=== VK_VERSION_1_0 ===
+          { "vkCreateInstance", NullDriverCommand<PFN_vkCreateInstance, 0x4>::pfn() },
+          { "vkDestroyInstance", NullDriverCommand<PFN_vkDestroyInstance, 0x0>::pfn() },
+          { "vkEnumeratePhysicalDevices", NullDriverCommand<PFN_vkEnumeratePhysicalDevices, 0x6>::pfn() },
+          { "vkGetPhysicalDeviceFeatures", NullDriverCommand<PFN_vkGetPhysicalDeviceFeatures, 0x2>::pfn() },
+          { "vkGetPhysicalDeviceFormatProperties", NullDriverCommand<PFN_vkGetPhysicalDeviceFormatProperties, 0x4>::pfn() },
+          { "vkGetPhysicalDeviceImageFormatProperties", NullDriverCommand<PFN_vkGetPhysicalDeviceImageFormatProperties, 0x40>::pfn() },
+          { "vkGetPhysicalDeviceProperties", NullDriverCommand<PFN_vkGetPhysicalDeviceProperties, 0x2>::pfn() },
+          { "vkGetPhysicalDeviceQueueFamilyProperties", NullDriverCommand<PFN_vkGetPhysicalDeviceQueueFamilyProperties, 0x6>::pfn() },
+          { "vkGetPhysicalDeviceMemoryProperties", NullDriverCommand<PFN_vkGetPhysicalDeviceMemoryProperties, 0x2>::pfn() },
+          { "vkGetInstanceProcAddr", NullDriverCommand<PFN_vkGetInstanceProcAddr, 0x0>::pfn() },
+          { "vkGetDeviceProcAddr", NullDriverCommand<PFN_vkGetDeviceProcAddr, 0x0>::pfn() },
+          { "vkCreateDevice", NullDriverCommand<PFN_vkCreateDevice, 0x8>::pfn() },
+          { "vkDestroyDevice", NullDriverCommand<PFN_vkDestroyDevice, 0x0>::pfn() },
+          { "vkEnumerateInstanceExtensionProperties", NullDriverCommand<PFN_vkEnumerateInstanceExtensionProperties, 0x6>::pfn() },
+          { "vkEnumerateDeviceExtensionProperties", NullDriverCommand<PFN_vkEnumerateDeviceExtensionProperties, 0xc>::pfn() },
+          { "vkEnumerateInstanceLayerProperties", NullDriverCommand<PFN_vkEnumerateInstanceLayerProperties, 0x3>::pfn() },
+          { "vkEnumerateDeviceLayerProperties", NullDriverCommand<PFN_vkEnumerateDeviceLayerProperties, 0x6>::pfn() },
+          { "vkGetDeviceQueue", NullDriverCommand<PFN_vkGetDeviceQueue, 0x8>::pfn() },
+          { "vkQueueSubmit", NullDriverCommand<PFN_vkQueueSubmit, 0x0>::pfn() },
+          { "vkQueueWaitIdle", NullDriverCommand<PFN_vkQueueWaitIdle, 0x0>::pfn() },
+          { "vkDeviceWaitIdle", NullDriverCommand<PFN_vkDeviceWaitIdle, 0x0>::pfn() },
+          { "vkAllocateMemory", NullDriverCommand<PFN_vkAllocateMemory, 0x8>::pfn() },
+          { "vkFreeMemory", NullDriverCommand<PFN_vkFreeMemory, 0x0>::pfn() },
+          { "vkMapMemory", NullDriverCommand<PFN_vkMapMemory, 0x20>::pfn() },
+          { "vkUnmapMemory", NullDriverCommand<PFN_vkUnmapMemory, 0x0>::pfn() },
+          { "vkFlushMappedMemoryRanges", NullDriverCommand<PFN_vkFlushMappedMemoryRanges, 0x0>::pfn() },
+          { "vkInvalidateMappedMemoryRanges", NullDriverCommand<PFN_vkInvalidateMappedMemoryRanges, 0x0>::pfn() },
+          { "vkGetDeviceMemoryCommitment", NullDriverCommand<PFN_vkGetDeviceMemoryCommitment, 0x4>::pfn() },
+          { "vkBindBufferMemory", NullDriverCommand<PFN_vkBindBufferMemory, 0x0>::pfn() },
+          { "vkBindImageMemory", NullDriverCommand<PFN_vkBindImageMemory, 0x0>::pfn() },
+          { "vkGetBufferMemoryRequirements", NullDriverCommand<PFN_vkGetBufferMemoryRequirements, 0x4>::pfn() },
+          { "vkGetImageMemoryRequirements", NullDriverCommand<PFN_vkGetImageMemoryRequirements, 0x4>::pfn() },
+          { "vkGetImageSparseMemoryRequirements", NullDriverCommand<PFN_vkGetImageSparseMemoryRequirements, 0xc>::pfn() },
+          { "vkGetPhysicalDeviceSparseImageFormatProperties", NullDriverCommand<PFN_vkGetPhysicalDeviceSparseImageFormatProperties, 0xc0>::pfn() },
+          { "vkQueueBindSparse", NullDriverCommand<PFN_vkQueueBindSparse, 0x0>::pfn() },
+          { "vkCreateFence", NullDriverCommand<PFN_vkCreateFence, 0x8>::pfn() },
+          { "vkDestroyFence", NullDriverCommand<PFN_vkDestroyFence, 0x0>::pfn() },
+          { "vkResetFences", NullDriverCommand<PFN_vkResetFences, 0x0>::pfn() },
+          { "vkGetFenceStatus", NullDriverCommand<PFN_vkGetFenceStatus, 0x0>::pfn() },
+          { "vkWaitForFences", NullDriverCommand<PFN_vkWaitForFences, 0x0>::pfn() },
+          { "vkCreateSemaphore", NullDriverCommand<PFN_vkCreateSemaphore, 0x8>::pfn() },
+          { "vkDestroySemaphore", NullDriverCommand<PFN_vkDestroySemaphore, 0x0>::pfn() },
+          { "vkCreateQueryPool", NullDriverCommand<PFN_vkCreateQueryPool, 0x8>::pfn() },
+          { "vkDestroyQueryPool", NullDriverCommand<PFN_vkDestroyQueryPool, 0x0>::pfn() },
+          { "vkGetQueryPoolResults", NullDriverCommand<PFN_vkGetQueryPoolResults, 0x20>::pfn() },
+          { "vkCreateBuffer", NullDriverCommand<PFN_vkCreateBuffer, 0x8>::pfn() },
+          { "vkDestroyBuffer", NullDriverCommand<PFN_vkDestroyBuffer, 0x0>::pfn() },
+          { "vkCreateImage", NullDriverCommand<PFN_vkCreateImage, 0x8>::pfn() },
+          { "vkDestroyImage", NullDriverCommand<PFN_vkDestroyImage, 0x0>::pfn() },
+          { "vkGetImageSubresourceLayout", NullDriverCommand<PFN_vkGetImageSubresourceLayout, 0x8>::pfn() },
+          { "vkCreateImageView", NullDriverCommand<PFN_vkCreateImageView, 0x8>::pfn() },
+          { "vkDestroyImageView", NullDriverCommand<PFN_vkDestroyImageView, 0x0>::pfn() },
+          { "vkCreateCommandPool", NullDriverCommand<PFN_vkCreateCommandPool, 0x8>::pfn() },
+          { "vkDestroyCommandPool", NullDriverCommand<PFN_vkDestroyCommandPool, 0x0>::pfn() },
+          { "vkResetCommandPool", NullDriverCommand<PFN_vkResetCommandPool, 0x0>::pfn() },
+          { "vkAllocateCommandBuffers", NullDriverCommand<PFN_vkAllocateCommandBuffers, 0x4>::pfn() },
+          { "vkFreeCommandBuffers", NullDriverCommand<PFN_vkFreeCommandBuffers, 0x0>::pfn() },
+          { "vkBeginCommandBuffer", NullDriverCommand<PFN_vkBeginCommandBuffer, 0x0>::pfn() },
+          { "vkEndCommandBuffer", NullDriverCommand<PFN_vkEndCommandBuffer, 0x0>::pfn() },
+          { "vkResetCommandBuffer", NullDriverCommand<PFN_vkResetCommandBuffer, 0x0>::pfn() },
+          { "vkCmdCopyBuffer", NullDriverCommand<PFN_vkCmdCopyBuffer, 0x0>::pfn() },
+          { "vkCmdCopyImage", NullDriverCommand<PFN_vkCmdCopyImage, 0x0>::pfn() },
+          { "vkCmdCopyBufferToImage", NullDriverCommand<PFN_vkCmdCopyBufferToImage, 0x0>::pfn() },
+          { "vkCmdCopyImageToBuffer", NullDriverCommand<PFN_vkCmdCopyImageToBuffer, 0x0>::pfn() },
+          { "vkCmdUpdateBuffer", NullDriverCommand<PFN_vkCmdUpdateBuffer, 0x0>::pfn() },
+          { "vkCmdFillBuffer", NullDriverCommand<PFN_vkCmdFillBuffer, 0x0>::pfn() },
+          { "vkCmdPipelineBarrier", NullDriverCommand<PFN_vkCmdPipelineBarrier, 0x0>::pfn() },
+          { "vkCmdBeginQuery", NullDriverCommand<PFN_vkCmdBeginQuery, 0x0>::pfn() },
+          { "vkCmdEndQuery", NullDriverCommand<PFN_vkCmdEndQuery, 0x0>::pfn() },
+          { "vkCmdResetQueryPool", NullDriverCommand<PFN_vkCmdResetQueryPool, 0x0>::pfn() },
+          { "vkCmdWriteTimestamp", NullDriverCommand<PFN_vkCmdWriteTimestamp, 0x0>::pfn() },
+          { "vkCmdCopyQueryPoolResults", NullDriverCommand<PFN_vkCmdCopyQueryPoolResults, 0x0>::pfn() },
+          { "vkCmdExecuteCommands", NullDriverCommand<PFN_vkCmdExecuteCommands, 0x0>::pfn() },
+          { "vkCreateEvent", NullDriverCommand<PFN_vkCreateEvent, 0x8>::pfn() },
+          { "vkDestroyEvent", NullDriverCommand<PFN_vkDestroyEvent, 0x0>::pfn() },
+          { "vkGetEventStatus", NullDriverCommand<PFN_vkGetEventStatus, 0x0>::pfn() },
+          { "vkSetEvent", NullDriverCommand<PFN_vkSetEvent, 0x0>::pfn() },
+          { "vkResetEvent", NullDriverCommand<PFN_vkResetEvent, 0x0>::pfn() },
+          { "vkCreateBufferView", NullDriverCommand<PFN_vkCreateBufferView, 0x8>::pfn() },
+          { "vkDestroyBufferView", NullDriverCommand<PFN_vkDestroyBufferView, 0x0>::pfn() },
+          { "vkCreateShaderModule", NullDriverCommand<PFN_vkCreateShaderModule, 0x8>::pfn() },
+          { "vkDestroyShaderModule", NullDriverCommand<PFN_vkDestroyShaderModule, 0x0>::pfn() },
+          { "vkCreatePipelineCache", NullDriverCommand<PFN_vkCreatePipelineCache, 0x8>::pfn() },
+          { "vkDestroyPipelineCache", NullDriverCommand<PFN_vkDestroyPipelineCache, 0x0>::pfn() },
+          { "vkGetPipelineCacheData", NullDriverCommand<PFN_vkGetPipelineCacheData, 0xc>::pfn() },
+          { "vkMergePipelineCaches", NullDriverCommand<PFN_vkMergePipelineCaches, 0x0>::pfn() },
+          { "vkCreateComputePipelines", NullDriverCommand<PFN_vkCreateComputePipelines, 0x20>::pfn() },
+          { "vkDestroyPipeline", NullDriverCommand<PFN_vkDestroyPipeline, 0x0>::pfn() },
+          { "vkCreatePipelineLayout", NullDriverCommand<PFN_vkCreatePipelineLayout, 0x8>::pfn() },
+          { "vkDestroyPipelineLayout", NullDriverCommand<PFN_vkDestroyPipelineLayout, 0x0>::pfn() },
+          { "vkCreateSampler", NullDriverCommand<PFN_vkCreateSampler, 0x8>::pfn() },
+          { "vkDestroySampler", NullDriverCommand<PFN_vkDestroySampler, 0x0>::pfn() },
+          { "vkCreateDescriptorSetLayout", NullDriverCommand<PFN_vkCreateDescriptorSetLayout, 0x8>::pfn() },
+          { "vkDestroyDescriptorSetLayout", NullDriverCommand<PFN_vkDestroyDescriptorSetLayout, 0x0>::pfn() },
+          { "vkCreateDescriptorPool", NullDriverCommand<PFN_vkCreateDescriptorPool, 0x8>::pfn() },
+          { "vkDestroyDescriptorPool", NullDriverCommand<PFN_vkDestroyDescriptorPool, 0x0>::pfn() },
+          { "vkResetDescriptorPool", NullDriverCommand<PFN_vkResetDescriptorPool, 0x0>::pfn() },
+          { "vkAllocateDescriptorSets", NullDriverCommand<PFN_vkAllocateDescriptorSets, 0x4>::pfn() },
+          { "vkFreeDescriptorSets", NullDriverCommand<PFN_vkFreeDescriptorSets, 0x0>::pfn() },
+          { "vkUpdateDescriptorSets", NullDriverCommand<PFN_vkUpdateDescriptorSets, 0x0>::pfn() },
+          { "vkCmdBindPipeline", NullDriverCommand<PFN_vkCmdBindPipeline, 0x0>::pfn() },
+          { "vkCmdBindDescriptorSets", NullDriverCommand<PFN_vkCmdBindDescriptorSets, 0x0>::pfn() },
+          { "vkCmdClearColorImage", NullDriverCommand<PFN_vkCmdClearColorImage, 0x0>::pfn() },
+          { "vkCmdDispatch", NullDriverCommand<PFN_vkCmdDispatch, 0x0>::pfn() },
+          { "vkCmdDispatchIndirect", NullDriverCommand<PFN_vkCmdDispatchIndirect, 0x0>::pfn() },
+          { "vkCmdSetEvent", NullDriverCommand<PFN_vkCmdSetEvent, 0x0>::pfn() },
+          { "vkCmdResetEvent", NullDriverCommand<PFN_vkCmdResetEvent, 0x0>::pfn() },
+          { "vkCmdWaitEvents", NullDriverCommand<PFN_vkCmdWaitEvents, 0x0>::pfn() },
+          { "vkCmdPushConstants", NullDriverCommand<PFN_vkCmdPushConstants, 0x0>::pfn() },
+          { "vkCreateGraphicsPipelines", NullDriverCommand<PFN_vkCreateGraphicsPipelines, 0x20>::pfn() },
+          { "vkCreateFramebuffer", NullDriverCommand<PFN_vkCreateFramebuffer, 0x8>::pfn() },
+          { "vkDestroyFramebuffer", NullDriverCommand<PFN_vkDestroyFramebuffer, 0x0>::pfn() },
+          { "vkCreateRenderPass", NullDriverCommand<PFN_vkCreateRenderPass, 0x8>::pfn() },
+          { "vkDestroyRenderPass", NullDriverCommand<PFN_vkDestroyRenderPass, 0x0>::pfn() },
+          { "vkGetRenderAreaGranularity", NullDriverCommand<PFN_vkGetRenderAreaGranularity, 0x4>::pfn() },
+          { "vkCmdSetViewport", NullDriverCommand<PFN_vkCmdSetViewport, 0x0>::pfn() },
+          { "vkCmdSetScissor", NullDriverCommand<PFN_vkCmdSetScissor, 0x0>::pfn() },
+          { "vkCmdSetLineWidth", NullDriverCommand<PFN_vkCmdSetLineWidth, 0x0>::pfn() },
+          { "vkCmdSetDepthBias", NullDriverCommand<PFN_vkCmdSetDepthBias, 0x0>::pfn() },
+          { "vkCmdSetBlendConstants", NullDriverCommand<PFN_vkCmdSetBlendConstants, 0x0>::pfn() },
+          { "vkCmdSetDepthBounds", NullDriverCommand<PFN_vkCmdSetDepthBounds, 0x0>::pfn() },
+          { "vkCmdSetStencilCompareMask", NullDriverCommand<PFN_vkCmdSetStencilCompareMask, 0x0>::pfn() },
+          { "vkCmdSetStencilWriteMask", NullDriverCommand<PFN_vkCmdSetStencilWriteMask, 0x0>::pfn() },
+          { "vkCmdSetStencilReference", NullDriverCommand<PFN_vkCmdSetStencilReference, 0x0>::pfn() },
+          { "vkCmdBindIndexBuffer", NullDriverCommand<PFN_vkCmdBindIndexBuffer, 0x0>::pfn() },
+          { "vkCmdBindVertexBuffers", NullDriverCommand<PFN_vkCmdBindVertexBuffers, 0x0>::pfn() },
+          { "vkCmdDraw", NullDriverCommand<PFN_vkCmdDraw, 0x0>::pfn() },
+          { "vkCmdDrawIndexed", NullDriverCommand<PFN_vkCmdDrawIndexed, 0x0>::pfn() },
+          { "vkCmdDrawIndirect", NullDriverCommand<PFN_vkCmdDrawIndirect, 0x0>::pfn() },
+          { "vkCmdDrawIndexedIndirect", NullDriverCommand<PFN_vkCmdDrawIndexedIndirect, 0x0>::pfn() },
+          { "vkCmdBlitImage", NullDriverCommand<PFN_vkCmdBlitImage, 0x0>::pfn() },
+          { "vkCmdClearDepthStencilImage", NullDriverCommand<PFN_vkCmdClearDepthStencilImage, 0x0>::pfn() },
+          { "vkCmdClearAttachments", NullDriverCommand<PFN_vkCmdClearAttachments, 0x0>::pfn() },
+          { "vkCmdResolveImage", NullDriverCommand<PFN_vkCmdResolveImage, 0x0>::pfn() },
+          { "vkCmdBeginRenderPass", NullDriverCommand<PFN_vkCmdBeginRenderPass, 0x0>::pfn() },
+          { "vkCmdNextSubpass", NullDriverCommand<PFN_vkCmdNextSubpass, 0x0>::pfn() },
+          { "vkCmdEndRenderPass", NullDriverCommand<PFN_vkCmdEndRenderPass, 0x0>::pfn() },
+
+          //=== VK_VERSION_1_1 ===
+          { "vkEnumerateInstanceVersion", NullDriverCommand<PFN_vkEnumerateInstanceVersion, 0x1>::pfn() },
+          { "vkBindBufferMemory2", NullDriverCommand<PFN_vkBindBufferMemory2, 0x0>::pfn() },
+          { "vkBindImageMemory2", NullDriverCommand<PFN_vkBindImageMemory2, 0x0>::pfn() },
+          { "vkGetDeviceGroupPeerMemoryFeatures", NullDriverCommand<PFN_vkGetDeviceGroupPeerMemoryFeatures, 0x10>::pfn() },
+          { "vkCmdSetDeviceMask", NullDriverCommand<PFN_vkCmdSetDeviceMask, 0x0>::pfn() },
+          { "vkEnumeratePhysicalDeviceGroups", NullDriverCommand<PFN_vkEnumeratePhysicalDeviceGroups, 0x6>::pfn() },
+          { "vkGetImageMemoryRequirements2", NullDriverCommand<PFN_vkGetImageMemoryRequirements2, 0x4>::pfn() },
+          { "vkGetBufferMemoryRequirements2", NullDriverCommand<PFN_vkGetBufferMemoryRequirements2, 0x4>::pfn() },
+          { "vkGetImageSparseMemoryRequirements2", NullDriverCommand<PFN_vkGetImageSparseMemoryRequirements2, 0xc>::pfn() },
+          { "vkGetPhysicalDeviceFeatures2", NullDriverCommand<PFN_vkGetPhysicalDeviceFeatures2, 0x2>::pfn() },
+          { "vkGetPhysicalDeviceProperties2", NullDriverCommand<PFN_vkGetPhysicalDeviceProperties2, 0x2>::pfn() },
+          { "vkGetPhysicalDeviceFormatProperties2", NullDriverCommand<PFN_vkGetPhysicalDeviceFormatProperties2, 0x4>::pfn() },
+          { "vkGetPhysicalDeviceImageFormatProperties2", NullDriverCommand<PFN_vkGetPhysicalDeviceImageFormatProperties2, 0x4>::pfn() },
+          { "vkGetPhysicalDeviceQueueFamilyProperties2", NullDriverCommand<PFN_vkGetPhysicalDeviceQueueFamilyProperties2, 0x6>::pfn() },
+          { "vkGetPhysicalDeviceMemoryProperties2", NullDriverCommand<PFN_vkGetPhysicalDeviceMemoryProperties2, 0x2>::pfn() },
+          { "vkGetPhysicalDeviceSparseImageFormatProperties2", NullDriverCommand<PFN_vkGetPhysicalDeviceSparseImageFormatProperties2, 0xc>::pfn() },
+          { "vkTrimCommandPool", NullDriverCommand<PFN_vkTrimCommandPool, 0x0>::pfn() },
+          { "vkGetDeviceQueue2", NullDriverCommand<PFN_vkGetDeviceQueue2, 0x4>::pfn() },
+          { "vkGetPhysicalDeviceExternalBufferProperties", NullDriverCommand<PFN_vkGetPhysicalDeviceExternalBufferProperties, 0x4>::pfn() },
+          { "vkGetPhysicalDeviceExternalFenceProperties", NullDriverCommand<PFN_vkGetPhysicalDeviceExternalFenceProperties, 0x4>::pfn() },
+          { "vkGetPhysicalDeviceExternalSemaphoreProperties", NullDriverCommand<PFN_vkGetPhysicalDeviceExternalSemaphoreProperties, 0x4>::pfn() },
+          { "vkCmdDispatchBase", NullDriverCommand<PFN_vkCmdDispatchBase, 0x0>::pfn() },
+          { "vkCreateDescriptorUpdateTemplate", NullDriverCommand<PFN_vkCreateDescriptorUpdateTemplate, 0x8>::pfn() },
+          { "vkDestroyDescriptorUpdateTemplate", NullDriverCommand<PFN_vkDestroyDescriptorUpdateTemplate, 0x0>::pfn() },
+          { "vkUpdateDescriptorSetWithTemplate", NullDriverCommand<PFN_vkUpdateDescriptorSetWithTemplate, 0x0>::pfn() },
+          { "vkGetDescriptorSetLayoutSupport", NullDriverCommand<PFN_vkGetDescriptorSetLayoutSupport, 0x4>::pfn() },
+          { "vkCreateSamplerYcbcrConversion", NullDriverCommand<PFN_vkCreateSamplerYcbcrConversion, 0x8>::pfn() },
+          { "vkDestroySamplerYcbcrConversion", NullDriverCommand<PFN_vkDestroySamplerYcbcrConversion, 0x0>::pfn() },
+
+          //=== VK_VERSION_1_2 ===
+          { "vkResetQueryPool", NullDriverCommand<PFN_vkResetQueryPool, 0x0>::pfn() },
+          { "vkGetSemaphoreCounterValue", NullDriverCommand<PFN_vkGetSemaphoreCounterValue, 0x4>::pfn() },
+          { "vkWaitSemaphores", NullDriverCommand<PFN_vkWaitSemaphores, 0x0>::pfn() },
+          { "vkSignalSemaphore", NullDriverCommand<PFN_vkSignalSemaphore, 0x0>::pfn() },
+          { "vkGetBufferDeviceAddress", NullDriverCommand<PFN_vkGetBufferDeviceAddress, 0x0>::pfn() },
+          { "vkGetBufferOpaqueCaptureAddress", NullDriverCommand<PFN_vkGetBufferOpaqueCaptureAddress, 0x0>::pfn() },
+          { "vkGetDeviceMemoryOpaqueCaptureAddress", NullDriverCommand<PFN_vkGetDeviceMemoryOpaqueCaptureAddress, 0x0>::pfn() },
+          { "vkCmdDrawIndirectCount", NullDriverCommand<PFN_vkCmdDrawIndirectCount, 0x0>::pfn() },
+          { "vkCmdDrawIndexedIndirectCount", NullDriverCommand<PFN_vkCmdDrawIndexedIndirectCount, 0x0>::pfn() },
+          { "vkCreateRenderPass2", NullDriverCommand<PFN_vkCreateRenderPass2, 0x8>::pfn() },
+          { "vkCmdBeginRenderPass2", NullDriverCommand<PFN_vkCmdBeginRenderPass2, 0x0>::pfn() },
+          { "vkCmdNextSubpass2", NullDriverCommand<PFN_vkCmdNextSubpass2, 0x0>::pfn() },
+          { "vkCmdEndRenderPass2", NullDriverCommand<PFN_vkCmdEndRenderPass2, 0x0>::pfn() },
+
+          //=== VK_VERSION_1_3 ===
+          { "vkGetPhysicalDeviceToolProperties", NullDriverCommand<PFN_vkGetPhysicalDeviceToolProperties, 0x6>::pfn() },
+          { "vkCreatePrivateDataSlot", NullDriverCommand<PFN_vkCreatePrivateDataSlot, 0x8>::pfn() },
+          { "vkDestroyPrivateDataSlot", NullDriverCommand<PFN_vkDestroyPrivateDataSlot, 0x0>::pfn() },
+          { "vkSetPrivateData", NullDriverCommand<PFN_vkSetPrivateData, 0x0>::pfn() },
+          { "vkGetPrivateData", NullDriverCommand<PFN_vkGetPrivateData, 0x10>::pfn() },
+          { "vkCmdPipelineBarrier2", NullDriverCommand<PFN_vkCmdPipelineBarrier2, 0x0>::pfn() },
+          { "vkCmdWriteTimestamp2", NullDriverCommand<PFN_vkCmdWriteTimestamp2, 0x0>::pfn() },
+          { "vkQueueSubmit2", NullDriverCommand<PFN_vkQueueSubmit2, 0x0>::pfn() },
+          { "vkCmdCopyBuffer2", NullDriverCommand<PFN_vkCmdCopyBuffer2, 0x0>::pfn() },
+          { "vkCmdCopyImage2", NullDriverCommand<PFN_vkCmdCopyImage2, 0x0>::pfn() },
+          { "vkCmdCopyBufferToImage2", NullDriverCommand<PFN_vkCmdCopyBufferToImage2, 0x0>::pfn() },
+          { "vkCmdCopyImageToBuffer2", NullDriverCommand<PFN_vkCmdCopyImageToBuffer2, 0x0>::pfn() },
+          { "vkGetDeviceBufferMemoryRequirements", NullDriverCommand<PFN_vkGetDeviceBufferMemoryRequirements, 0x4>::pfn() },
+          { "vkGetDeviceImageMemoryRequirements", NullDriverCommand<PFN_vkGetDeviceImageMemoryRequirements, 0x4>::pfn() },
+          { "vkGetDeviceImageSparseMemoryRequirements", NullDriverCommand<PFN_vkGetDeviceImageSparseMemoryRequirements, 0xc>::pfn() },
+          { "vkCmdSetEvent2", NullDriverCommand<PFN_vkCmdSetEvent2, 0x0>::pfn() },
+          { "vkCmdResetEvent2", NullDriverCommand<PFN_vkCmdResetEvent2, 0x0>::pfn() },
+          { "vkCmdWaitEvents2", NullDriverCommand<PFN_vkCmdWaitEvents2, 0x0>::pfn() },
+          { "vkCmdBlitImage2", NullDriverCommand<PFN_vkCmdBlitImage2, 0x0>::pfn() },
+          { "vkCmdResolveImage2", NullDriverCommand<PFN_vkCmdResolveImage2, 0x0>::pfn() },
+          { "vkCmdBeginRendering", NullDriverCommand<PFN_vkCmdBeginRendering, 0x0>::pfn() },
+          { "vkCmdEndRendering", NullDriverCommand<PFN_vkCmdEndRendering, 0x0>::pfn() },
+          { "vkCmdSetCullMode", NullDriverCommand<PFN_vkCmdSetCullMode, 0x0>::pfn() },
+          { "vkCmdSetFrontFace", NullDriverCommand<PFN_vkCmdSetFrontFace, 0x0>::pfn() },
+          { "vkCmdSetPrimitiveTopology", NullDriverCommand<PFN_vkCmdSetPrimitiveTopology, 0x0>::pfn() },
+          { "vkCmdSetViewportWithCount", NullDriverCommand<PFN_vkCmdSetViewportWithCount, 0x0>::pfn() },
+          { "vkCmdSetScissorWithCount", NullDriverCommand<PFN_vkCmdSetScissorWithCount, 0x0>::pfn() },
+          { "vkCmdBindVertexBuffers2", NullDriverCommand<PFN_vkCmdBindVertexBuffers2, 0x0>::pfn() },
+          { "vkCmdSetDepthTestEnable", NullDriverCommand<PFN_vkCmdSetDepthTestEnable, 0x0>::pfn() },
+          { "vkCmdSetDepthWriteEnable", NullDriverCommand<PFN_vkCmdSetDepthWriteEnable, 0x0>::pfn() },
+          { "vkCmdSetDepthCompareOp", NullDriverCommand<PFN_vkCmdSetDepthCompareOp, 0x0>::pfn() },
+          { "vkCmdSetDepthBoundsTestEnable", NullDriverCommand<PFN_vkCmdSetDepthBoundsTestEnable, 0x0>::pfn() },
+          { "vkCmdSetStencilTestEnable", NullDriverCommand<PFN_vkCmdSetStencilTestEnable, 0x0>::pfn() },
+          { "vkCmdSetStencilOp", NullDriverCommand<PFN_vkCmdSetStencilOp, 0x0>::pfn() },
+          { "vkCmdSetRasterizerDiscardEnable", NullDriverCommand<PFN_vkCmdSetRasterizerDiscardEnable, 0x0>::pfn() },
+          { "vkCmdSetDepthBiasEnable", NullDriverCommand<PFN_vkCmdSetDepthBiasEnable, 0x0>::pfn() },
+          { "vkCmdSetPrimitiveRestartEnable", NullDriverCommand<PFN_vkCmdSetPrimitiveRestartEnable, 0x0>::pfn() },
+
+          //=== VK_VERSION_1_4 ===
+          { "vkMapMemory2", NullDriverCommand<PFN_vkMapMemory2, 0x4>::pfn() },
+          { "vkUnmapMemory2", NullDriverCommand<PFN_vkUnmapMemory2, 0x0>::pfn() },
+          { "vkGetDeviceImageSubresourceLayout", NullDriverCommand<PFN_vkGetDeviceImageSubresourceLayout, 0x4>::pfn() },
+          { "vkGetImageSubresourceLayout2", NullDriverCommand<PFN_vkGetImageSubresourceLayout2, 0x8>::pfn() },
+          { "vkCopyMemoryToImage", NullDriverCommand<PFN_vkCopyMemoryToImage, 0x0>::pfn() },
+          { "vkCopyImageToMemory", NullDriverCommand<PFN_vkCopyImageToMemory, 0x0>::pfn() },
+          { "vkCopyImageToImage", NullDriverCommand<PFN_vkCopyImageToImage, 0x0>::pfn() },
+          { "vkTransitionImageLayout", NullDriverCommand<PFN_vkTransitionImageLayout, 0x0>::pfn() },
+          { "vkCmdPushDescriptorSet", NullDriverCommand<PFN_vkCmdPushDescriptorSet, 0x0>::pfn() },
+          { "vkCmdPushDescriptorSetWithTemplate", NullDriverCommand<PFN_vkCmdPushDescriptorSetWithTemplate, 0x0>::pfn() },
+          { "vkCmdBindDescriptorSets2", NullDriverCommand<PFN_vkCmdBindDescriptorSets2, 0x0>::pfn() },
+          { "vkCmdPushConstants2", NullDriverCommand<PFN_vkCmdPushConstants2, 0x0>::pfn() },
+          { "vkCmdPushDescriptorSet2", NullDriverCommand<PFN_vkCmdPushDescriptorSet2, 0x0>::pfn() },
+          { "vkCmdPushDescriptorSetWithTemplate2", NullDriverCommand<PFN_vkCmdPushDescriptorSetWithTemplate2, 0x0>::pfn() },
+          { "vkCmdSetLineStipple", NullDriverCommand<PFN_vkCmdSetLineStipple, 0x0>::pfn() },
+          { "vkCmdBindIndexBuffer2", NullDriverCommand<PFN_vkCmdBindIndexBuffer2, 0x0>::pfn() },
+          { "vkGetRenderingAreaGranularity", NullDriverCommand<PFN_vkGetRenderingAreaGranularity, 0x4>::pfn() },
+          { "vkCmdSetRenderingAttachmentLocations", NullDriverCommand<PFN_vkCmdSetRenderingAttachmentLocations, 0x0>::pfn() },
+          { "vkCmdSetRenderingInputAttachmentIndices", NullDriverCommand<PFN_vkCmdSetRenderingInputAttachmentIndices, 0x0>::pfn() },
+
+          //=== VK_KHR_surface ===
+          { "vkDestroySurfaceKHR", NullDriverCommand<PFN_vkDestroySurfaceKHR, 0x0>::pfn() },
+          { "vkGetPhysicalDeviceSurfaceSupportKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceSurfaceSupportKHR, 0x8>::pfn() },
+          { "vkGetPhysicalDeviceSurfaceCapabilitiesKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR, 0x4>::pfn() },
+          { "vkGetPhysicalDeviceSurfaceFormatsKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceSurfaceFormatsKHR, 0xc>::pfn() },
+          { "vkGetPhysicalDeviceSurfacePresentModesKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceSurfacePresentModesKHR, 0xc>::pfn() },
+
+          //=== VK_KHR_swapchain ===
+          { "vkCreateSwapchainKHR", NullDriverCommand<PFN_vkCreateSwapchainKHR, 0x8>::pfn() },
+          { "vkDestroySwapchainKHR", NullDriverCommand<PFN_vkDestroySwapchainKHR, 0x0>::pfn() },
+          { "vkGetSwapchainImagesKHR", NullDriverCommand<PFN_vkGetSwapchainImagesKHR, 0xc>::pfn() },
+          { "vkAcquireNextImageKHR", NullDriverCommand<PFN_vkAcquireNextImageKHR, 0x20>::pfn() },
+          { "vkQueuePresentKHR", NullDriverCommand<PFN_vkQueuePresentKHR, 0x0>::pfn() },
+          { "vkGetDeviceGroupPresentCapabilitiesKHR", NullDriverCommand<PFN_vkGetDeviceGroupPresentCapabilitiesKHR, 0x2>::pfn() },
+          { "vkGetDeviceGroupSurfacePresentModesKHR", NullDriverCommand<PFN_vkGetDeviceGroupSurfacePresentModesKHR, 0x4>::pfn() },
+          { "vkGetPhysicalDevicePresentRectanglesKHR", NullDriverCommand<PFN_vkGetPhysicalDevicePresentRectanglesKHR, 0xc>::pfn() },
+          { "vkAcquireNextImage2KHR", NullDriverCommand<PFN_vkAcquireNextImage2KHR, 0x4>::pfn() },
+
+          //=== VK_KHR_display ===
+          { "vkGetPhysicalDeviceDisplayPropertiesKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceDisplayPropertiesKHR, 0x6>::pfn() },
+          { "vkGetPhysicalDeviceDisplayPlanePropertiesKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR, 0x6>::pfn() },
+          { "vkGetDisplayPlaneSupportedDisplaysKHR", NullDriverCommand<PFN_vkGetDisplayPlaneSupportedDisplaysKHR, 0xc>::pfn() },
+          { "vkGetDisplayModePropertiesKHR", NullDriverCommand<PFN_vkGetDisplayModePropertiesKHR, 0xc>::pfn() },
+          { "vkCreateDisplayModeKHR", NullDriverCommand<PFN_vkCreateDisplayModeKHR, 0x10>::pfn() },
+          { "vkGetDisplayPlaneCapabilitiesKHR", NullDriverCommand<PFN_vkGetDisplayPlaneCapabilitiesKHR, 0x8>::pfn() },
+          { "vkCreateDisplayPlaneSurfaceKHR", NullDriverCommand<PFN_vkCreateDisplayPlaneSurfaceKHR, 0x8>::pfn() },
+
+          //=== VK_KHR_display_swapchain ===
+          { "vkCreateSharedSwapchainsKHR", NullDriverCommand<PFN_vkCreateSharedSwapchainsKHR, 0x10>::pfn() },
+
+#if defined( VK_USE_PLATFORM_XLIB_KHR )
+          //=== VK_KHR_xlib_surface ===
+          { "vkCreateXlibSurfaceKHR", NullDriverCommand<PFN_vkCreateXlibSurfaceKHR, 0x8>::pfn() },
+          { "vkGetPhysicalDeviceXlibPresentationSupportKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR, 0x0>::pfn() },
+#endif /*VK_USE_PLATFORM_XLIB_KHR*/
+
+#if defined( VK_USE_PLATFORM_XCB_KHR )
+          //=== VK_KHR_xcb_surface ===
+          { "vkCreateXcbSurfaceKHR", NullDriverCommand<PFN_vkCreateXcbSurfaceKHR, 0x8>::pfn() },
+          { "vkGetPhysicalDeviceXcbPresentationSupportKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR, 0x0>::pfn() },
+#endif /*VK_USE_PLATFORM_XCB_KHR*/
+
+#if defined( VK_USE_PLATFORM_WAYLAND_KHR )
+          //=== VK_KHR_wayland_surface ===
+          { "vkCreateWaylandSurfaceKHR", NullDriverCommand<PFN_vkCreateWaylandSurfaceKHR, 0x8>::pfn() },
+          { "vkGetPhysicalDeviceWaylandPresentationSupportKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR, 0x0>::pfn() },
+#endif /*VK_USE_PLATFORM_WAYLAND_KHR*/
+
+#if defined( VK_USE_PLATFORM_ANDROID_KHR )
+          //=== VK_KHR_android_surface ===
+          { "vkCreateAndroidSurfaceKHR", NullDriverCommand<PFN_vkCreateAndroidSurfaceKHR, 0x8>::pfn() },
+#endif /*VK_USE_PLATFORM_ANDROID_KHR*/
+
+#if defined( VK_USE_PLATFORM_WIN32_KHR )
+          //=== VK_KHR_win32_surface ===
+          { "vkCreateWin32SurfaceKHR", NullDriverCommand<PFN_vkCreateWin32SurfaceKHR, 0x8>::pfn() },
+          { "vkGetPhysicalDeviceWin32PresentationSupportKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR, 0x0>::pfn() },
+#endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+          //=== VK_EXT_debug_report ===
+          { "vkCreateDebugReportCallbackEXT", NullDriverCommand<PFN_vkCreateDebugReportCallbackEXT, 0x8>::pfn() },
+          { "vkDestroyDebugReportCallbackEXT", NullDriverCommand<PFN_vkDestroyDebugReportCallbackEXT, 0x0>::pfn() },
+          { "vkDebugReportMessageEXT", NullDriverCommand<PFN_vkDebugReportMessageEXT, 0x0>::pfn() },
+
+          //=== VK_EXT_debug_marker ===
+          { "vkDebugMarkerSetObjectTagEXT", NullDriverCommand<PFN_vkDebugMarkerSetObjectTagEXT, 0x0>::pfn() },
+          { "vkDebugMarkerSetObjectNameEXT", NullDriverCommand<PFN_vkDebugMarkerSetObjectNameEXT, 0x0>::pfn() },
+          { "vkCmdDebugMarkerBeginEXT", NullDriverCommand<PFN_vkCmdDebugMarkerBeginEXT, 0x0>::pfn() },
+          { "vkCmdDebugMarkerEndEXT", NullDriverCommand<PFN_vkCmdDebugMarkerEndEXT, 0x0>::pfn() },
+          { "vkCmdDebugMarkerInsertEXT", NullDriverCommand<PFN_vkCmdDebugMarkerInsertEXT, 0x0>::pfn() },
+
+          //=== VK_KHR_video_queue ===
+          { "vkGetPhysicalDeviceVideoCapabilitiesKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceVideoCapabilitiesKHR, 0x4>::pfn() },
+          { "vkGetPhysicalDeviceVideoFormatPropertiesKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceVideoFormatPropertiesKHR, 0xc>::pfn() },
+          { "vkCreateVideoSessionKHR", NullDriverCommand<PFN_vkCreateVideoSessionKHR, 0x8>::pfn() },
+          { "vkDestroyVideoSessionKHR", NullDriverCommand<PFN_vkDestroyVideoSessionKHR, 0x0>::pfn() },
+          { "vkGetVideoSessionMemoryRequirementsKHR", NullDriverCommand<PFN_vkGetVideoSessionMemoryRequirementsKHR, 0xc>::pfn() },
+          { "vkBindVideoSessionMemoryKHR", NullDriverCommand<PFN_vkBindVideoSessionMemoryKHR, 0x0>::pfn() },
+          { "vkCreateVideoSessionParametersKHR", NullDriverCommand<PFN_vkCreateVideoSessionParametersKHR, 0x8>::pfn() },
+          { "vkUpdateVideoSessionParametersKHR", NullDriverCommand<PFN_vkUpdateVideoSessionParametersKHR, 0x0>::pfn() },
+          { "vkDestroyVideoSessionParametersKHR", NullDriverCommand<PFN_vkDestroyVideoSessionParametersKHR, 0x0>::pfn() },
+          { "vkCmdBeginVideoCodingKHR", NullDriverCommand<PFN_vkCmdBeginVideoCodingKHR, 0x0>::pfn() },
+          { "vkCmdEndVideoCodingKHR", NullDriverCommand<PFN_vkCmdEndVideoCodingKHR, 0x0>::pfn() },
+          { "vkCmdControlVideoCodingKHR", NullDriverCommand<PFN_vkCmdControlVideoCodingKHR, 0x0>::pfn() },
+
+          //=== VK_KHR_video_decode_queue ===
+          { "vkCmdDecodeVideoKHR", NullDriverCommand<PFN_vkCmdDecodeVideoKHR, 0x0>::pfn() },
+
+          //=== VK_EXT_transform_feedback ===
+          { "vkCmdBindTransformFeedbackBuffersEXT", NullDriverCommand<PFN_vkCmdBindTransformFeedbackBuffersEXT, 0x0>::pfn() },
+          { "vkCmdBeginTransformFeedbackEXT", NullDriverCommand<PFN_vkCmdBeginTransformFeedbackEXT, 0x0>::pfn() },
+          { "vkCmdEndTransformFeedbackEXT", NullDriverCommand<PFN_vkCmdEndTransformFeedbackEXT, 0x0>::pfn() },
+          { "vkCmdBeginQueryIndexedEXT", NullDriverCommand<PFN_vkCmdBeginQueryIndexedEXT, 0x0>::pfn() },
+          { "vkCmdEndQueryIndexedEXT", NullDriverCommand<PFN_vkCmdEndQueryIndexedEXT, 0x0>::pfn() },
+          { "vkCmdDrawIndirectByteCountEXT", NullDriverCommand<PFN_vkCmdDrawIndirectByteCountEXT, 0x0>::pfn() },
+
+          //=== VK_NVX_binary_import ===
+          { "vkCreateCuModuleNVX", NullDriverCommand<PFN_vkCreateCuModuleNVX, 0x8>::pfn() },
+          { "vkCreateCuFunctionNVX", NullDriverCommand<PFN_vkCreateCuFunctionNVX, 0x8>::pfn() },
+          { "vkDestroyCuModuleNVX", NullDriverCommand<PFN_vkDestroyCuModuleNVX, 0x0>::pfn() },
+          { "vkDestroyCuFunctionNVX", NullDriverCommand<PFN_vkDestroyCuFunctionNVX, 0x0>::pfn() },
+          { "vkCmdCuLaunchKernelNVX", NullDriverCommand<PFN_vkCmdCuLaunchKernelNVX, 0x0>::pfn() },
+
+          //=== VK_NVX_image_view_handle ===
+          { "vkGetImageViewHandleNVX", NullDriverCommand<PFN_vkGetImageViewHandleNVX, 0x0>::pfn() },
+          { "vkGetImageViewHandle64NVX", NullDriverCommand<PFN_vkGetImageViewHandle64NVX, 0x0>::pfn() },
+          { "vkGetImageViewAddressNVX", NullDriverCommand<PFN_vkGetImageViewAddressNVX, 0x4>::pfn() },
+          { "vkGetDeviceCombinedImageSamplerIndexNVX", NullDriverCommand<PFN_vkGetDeviceCombinedImageSamplerIndexNVX, 0x0>::pfn() },
+
+          //=== VK_AMD_draw_indirect_count ===
+          { "vkCmdDrawIndirectCountAMD", NullDriverCommand<PFN_vkCmdDrawIndirectCountAMD, 0x0>::pfn() },
+          { "vkCmdDrawIndexedIndirectCountAMD", NullDriverCommand<PFN_vkCmdDrawIndexedIndirectCountAMD, 0x0>::pfn() },
+
+          //=== VK_AMD_shader_info ===
+          { "vkGetShaderInfoAMD", NullDriverCommand<PFN_vkGetShaderInfoAMD, 0x30>::pfn() },
+
+          //=== VK_KHR_dynamic_rendering ===
+          { "vkCmdBeginRenderingKHR", NullDriverCommand<PFN_vkCmdBeginRenderingKHR, 0x0>::pfn() },
+          { "vkCmdEndRenderingKHR", NullDriverCommand<PFN_vkCmdEndRenderingKHR, 0x0>::pfn() },
+
+#if defined( VK_USE_PLATFORM_GGP )
+          //=== VK_GGP_stream_descriptor_surface ===
+          { "vkCreateStreamDescriptorSurfaceGGP", NullDriverCommand<PFN_vkCreateStreamDescriptorSurfaceGGP, 0x8>::pfn() },
+#endif /*VK_USE_PLATFORM_GGP*/
+
+          //=== VK_NV_external_memory_capabilities ===
+          { "vkGetPhysicalDeviceExternalImageFormatPropertiesNV", NullDriverCommand<PFN_vkGetPhysicalDeviceExternalImageFormatPropertiesNV, 0x80>::pfn() },
+
+#if defined( VK_USE_PLATFORM_WIN32_KHR )
+          //=== VK_NV_external_memory_win32 ===
+          { "vkGetMemoryWin32HandleNV", NullDriverCommand<PFN_vkGetMemoryWin32HandleNV, 0x8>::pfn() },
+#endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+          //=== VK_KHR_get_physical_device_properties2 ===
+          { "vkGetPhysicalDeviceFeatures2KHR", NullDriverCommand<PFN_vkGetPhysicalDeviceFeatures2KHR, 0x2>::pfn() },
+          { "vkGetPhysicalDeviceProperties2KHR", NullDriverCommand<PFN_vkGetPhysicalDeviceProperties2KHR, 0x2>::pfn() },
+          { "vkGetPhysicalDeviceFormatProperties2KHR", NullDriverCommand<PFN_vkGetPhysicalDeviceFormatProperties2KHR, 0x4>::pfn() },
+          { "vkGetPhysicalDeviceImageFormatProperties2KHR", NullDriverCommand<PFN_vkGetPhysicalDeviceImageFormatProperties2KHR, 0x4>::pfn() },
+          { "vkGetPhysicalDeviceQueueFamilyProperties2KHR", NullDriverCommand<PFN_vkGetPhysicalDeviceQueueFamilyProperties2KHR, 0x6>::pfn() },
+          { "vkGetPhysicalDeviceMemoryProperties2KHR", NullDriverCommand<PFN_vkGetPhysicalDeviceMemoryProperties2KHR, 0x2>::pfn() },
+          { "vkGetPhysicalDeviceSparseImageFormatProperties2KHR", NullDriverCommand<PFN_vkGetPhysicalDeviceSparseImageFormatProperties2KHR, 0xc>::pfn() },
+
+          //=== VK_KHR_device_group ===
+          { "vkGetDeviceGroupPeerMemoryFeaturesKHR", NullDriverCommand<PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR, 0x10>::pfn() },
+          { "vkCmdSetDeviceMaskKHR", NullDriverCommand<PFN_vkCmdSetDeviceMaskKHR, 0x0>::pfn() },
+          { "vkCmdDispatchBaseKHR", NullDriverCommand<PFN_vkCmdDispatchBaseKHR, 0x0>::pfn() },
+
+#if defined( VK_USE_PLATFORM_VI_NN )
+          //=== VK_NN_vi_surface ===
+          { "vkCreateViSurfaceNN", NullDriverCommand<PFN_vkCreateViSurfaceNN, 0x8>::pfn() },
+#endif /*VK_USE_PLATFORM_VI_NN*/
+
+          //=== VK_KHR_maintenance1 ===
+          { "vkTrimCommandPoolKHR", NullDriverCommand<PFN_vkTrimCommandPoolKHR, 0x0>::pfn() },
+
+          //=== VK_KHR_device_group_creation ===
+          { "vkEnumeratePhysicalDeviceGroupsKHR", NullDriverCommand<PFN_vkEnumeratePhysicalDeviceGroupsKHR, 0x6>::pfn() },
+
+          //=== VK_KHR_external_memory_capabilities ===
+          { "vkGetPhysicalDeviceExternalBufferPropertiesKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceExternalBufferPropertiesKHR, 0x4>::pfn() },
+
+#if defined( VK_USE_PLATFORM_WIN32_KHR )
+          //=== VK_KHR_external_memory_win32 ===
+          { "vkGetMemoryWin32HandleKHR", NullDriverCommand<PFN_vkGetMemoryWin32HandleKHR, 0x4>::pfn() },
+          { "vkGetMemoryWin32HandlePropertiesKHR", NullDriverCommand<PFN_vkGetMemoryWin32HandlePropertiesKHR, 0x8>::pfn() },
+#endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+          //=== VK_KHR_external_memory_fd ===
+          { "vkGetMemoryFdKHR", NullDriverCommand<PFN_vkGetMemoryFdKHR, 0x4>::pfn() },
+          { "vkGetMemoryFdPropertiesKHR", NullDriverCommand<PFN_vkGetMemoryFdPropertiesKHR, 0x8>::pfn() },
+
+          //=== VK_KHR_external_semaphore_capabilities ===
+          { "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR, 0x4>::pfn() },
+
+#if defined( VK_USE_PLATFORM_WIN32_KHR )
+          //=== VK_KHR_external_semaphore_win32 ===
+          { "vkImportSemaphoreWin32HandleKHR", NullDriverCommand<PFN_vkImportSemaphoreWin32HandleKHR, 0x0>::pfn() },
+          { "vkGetSemaphoreWin32HandleKHR", NullDriverCommand<PFN_vkGetSemaphoreWin32HandleKHR, 0x4>::pfn() },
+#endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+          //=== VK_KHR_external_semaphore_fd ===
+          { "vkImportSemaphoreFdKHR", NullDriverCommand<PFN_vkImportSemaphoreFdKHR, 0x0>::pfn() },
+          { "vkGetSemaphoreFdKHR", NullDriverCommand<PFN_vkGetSemaphoreFdKHR, 0x4>::pfn() },
+
+          //=== VK_KHR_push_descriptor ===
+          { "vkCmdPushDescriptorSetKHR", NullDriverCommand<PFN_vkCmdPushDescriptorSetKHR, 0x0>::pfn() },
+          { "vkCmdPushDescriptorSetWithTemplateKHR", NullDriverCommand<PFN_vkCmdPushDescriptorSetWithTemplateKHR, 0x0>::pfn() },
+
+          //=== VK_EXT_conditional_rendering ===
+          { "vkCmdBeginConditionalRenderingEXT", NullDriverCommand<PFN_vkCmdBeginConditionalRenderingEXT, 0x0>::pfn() },
+          { "vkCmdEndConditionalRenderingEXT", NullDriverCommand<PFN_vkCmdEndConditionalRenderingEXT, 0x0>::pfn() },
+
+          //=== VK_KHR_descriptor_update_template ===
+          { "vkCreateDescriptorUpdateTemplateKHR", NullDriverCommand<PFN_vkCreateDescriptorUpdateTemplateKHR, 0x8>::pfn() },
+          { "vkDestroyDescriptorUpdateTemplateKHR", NullDriverCommand<PFN_vkDestroyDescriptorUpdateTemplateKHR, 0x0>::pfn() },
+          { "vkUpdateDescriptorSetWithTemplateKHR", NullDriverCommand<PFN_vkUpdateDescriptorSetWithTemplateKHR, 0x0>::pfn() },
+
+          //=== VK_NV_clip_space_w_scaling ===
+          { "vkCmdSetViewportWScalingNV", NullDriverCommand<PFN_vkCmdSetViewportWScalingNV, 0x0>::pfn() },
+
+          //=== VK_EXT_direct_mode_display ===
+          { "vkReleaseDisplayEXT", NullDriverCommand<PFN_vkReleaseDisplayEXT, 0x0>::pfn() },
+
+#if defined( VK_USE_PLATFORM_XLIB_XRANDR_EXT )
+          //=== VK_EXT_acquire_xlib_display ===
+          { "vkAcquireXlibDisplayEXT", NullDriverCommand<PFN_vkAcquireXlibDisplayEXT, 0x0>::pfn() },
+          { "vkGetRandROutputDisplayEXT", NullDriverCommand<PFN_vkGetRandROutputDisplayEXT, 0x8>::pfn() },
+#endif /*VK_USE_PLATFORM_XLIB_XRANDR_EXT*/
+
+          //=== VK_EXT_display_surface_counter ===
+          { "vkGetPhysicalDeviceSurfaceCapabilities2EXT", NullDriverCommand<PFN_vkGetPhysicalDeviceSurfaceCapabilities2EXT, 0x4>::pfn() },
+
+          //=== VK_EXT_display_control ===
+          { "vkDisplayPowerControlEXT", NullDriverCommand<PFN_vkDisplayPowerControlEXT, 0x0>::pfn() },
+          { "vkRegisterDeviceEventEXT", NullDriverCommand<PFN_vkRegisterDeviceEventEXT, 0x8>::pfn() },
+          { "vkRegisterDisplayEventEXT", NullDriverCommand<PFN_vkRegisterDisplayEventEXT, 0x10>::pfn() },
+          { "vkGetSwapchainCounterEXT", NullDriverCommand<PFN_vkGetSwapchainCounterEXT, 0x8>::pfn() },
+
+          //=== VK_GOOGLE_display_timing ===
+          { "vkGetRefreshCycleDurationGOOGLE", NullDriverCommand<PFN_vkGetRefreshCycleDurationGOOGLE, 0x4>::pfn() },
+          { "vkGetPastPresentationTimingGOOGLE", NullDriverCommand<PFN_vkGetPastPresentationTimingGOOGLE, 0xc>::pfn() },
+
+          //=== VK_EXT_discard_rectangles ===
+          { "vkCmdSetDiscardRectangleEXT", NullDriverCommand<PFN_vkCmdSetDiscardRectangleEXT, 0x0>::pfn() },
+          { "vkCmdSetDiscardRectangleEnableEXT", NullDriverCommand<PFN_vkCmdSetDiscardRectangleEnableEXT, 0x0>::pfn() },
+          { "vkCmdSetDiscardRectangleModeEXT", NullDriverCommand<PFN_vkCmdSetDiscardRectangleModeEXT, 0x0>::pfn() },
+
+          //=== VK_EXT_hdr_metadata ===
+          { "vkSetHdrMetadataEXT", NullDriverCommand<PFN_vkSetHdrMetadataEXT, 0x0>::pfn() },
+
+          //=== VK_KHR_create_renderpass2 ===
+          { "vkCreateRenderPass2KHR", NullDriverCommand<PFN_vkCreateRenderPass2KHR, 0x8>::pfn() },
+          { "vkCmdBeginRenderPass2KHR", NullDriverCommand<PFN_vkCmdBeginRenderPass2KHR, 0x0>::pfn() },
+          { "vkCmdNextSubpass2KHR", NullDriverCommand<PFN_vkCmdNextSubpass2KHR, 0x0>::pfn() },
+          { "vkCmdEndRenderPass2KHR", NullDriverCommand<PFN_vkCmdEndRenderPass2KHR, 0x0>::pfn() },
+
+          //=== VK_KHR_shared_presentable_image ===
+          { "vkGetSwapchainStatusKHR", NullDriverCommand<PFN_vkGetSwapchainStatusKHR, 0x0>::pfn() },
+
+          //=== VK_KHR_external_fence_capabilities ===
+          { "vkGetPhysicalDeviceExternalFencePropertiesKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceExternalFencePropertiesKHR, 0x4>::pfn() },
+
+#if defined( VK_USE_PLATFORM_WIN32_KHR )
+          //=== VK_KHR_external_fence_win32 ===
+          { "vkImportFenceWin32HandleKHR", NullDriverCommand<PFN_vkImportFenceWin32HandleKHR, 0x0>::pfn() },
+          { "vkGetFenceWin32HandleKHR", NullDriverCommand<PFN_vkGetFenceWin32HandleKHR, 0x4>::pfn() },
+#endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+          //=== VK_KHR_external_fence_fd ===
+          { "vkImportFenceFdKHR", NullDriverCommand<PFN_vkImportFenceFdKHR, 0x0>::pfn() },
+          { "vkGetFenceFdKHR", NullDriverCommand<PFN_vkGetFenceFdKHR, 0x4>::pfn() },
+
+          //=== VK_KHR_performance_query ===
+          { "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR",
+            NullDriverCommand<PFN_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR, 0x1c>::pfn() },
+          { "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR",
+            NullDriverCommand<PFN_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR, 0x4>::pfn() },
+          { "vkAcquireProfilingLockKHR", NullDriverCommand<PFN_vkAcquireProfilingLockKHR, 0x0>::pfn() },
+          { "vkReleaseProfilingLockKHR", NullDriverCommand<PFN_vkReleaseProfilingLockKHR, 0x0>::pfn() },
+
+          //=== VK_KHR_get_surface_capabilities2 ===
+          { "vkGetPhysicalDeviceSurfaceCapabilities2KHR", NullDriverCommand<PFN_vkGetPhysicalDeviceSurfaceCapabilities2KHR, 0x4>::pfn() },
+          { "vkGetPhysicalDeviceSurfaceFormats2KHR", NullDriverCommand<PFN_vkGetPhysicalDeviceSurfaceFormats2KHR, 0xc>::pfn() },
+
+          //=== VK_KHR_get_display_properties2 ===
+          { "vkGetPhysicalDeviceDisplayProperties2KHR", NullDriverCommand<PFN_vkGetPhysicalDeviceDisplayProperties2KHR, 0x6>::pfn() },
+          { "vkGetPhysicalDeviceDisplayPlaneProperties2KHR", NullDriverCommand<PFN_vkGetPhysicalDeviceDisplayPlaneProperties2KHR, 0x6>::pfn() },
+          { "vkGetDisplayModeProperties2KHR", NullDriverCommand<PFN_vkGetDisplayModeProperties2KHR, 0xc>::pfn() },
+          { "vkGetDisplayPlaneCapabilities2KHR", NullDriverCommand<PFN_vkGetDisplayPlaneCapabilities2KHR, 0x4>::pfn() },
+
+#if defined( VK_USE_PLATFORM_IOS_MVK )
+          //=== VK_MVK_ios_surface ===
+          { "vkCreateIOSSurfaceMVK", NullDriverCommand<PFN_vkCreateIOSSurfaceMVK, 0x8>::pfn() },
+#endif /*VK_USE_PLATFORM_IOS_MVK*/
+
+#if defined( VK_USE_PLATFORM_MACOS_MVK )
+          //=== VK_MVK_macos_surface ===
+          { "vkCreateMacOSSurfaceMVK", NullDriverCommand<PFN_vkCreateMacOSSurfaceMVK, 0x8>::pfn() },
+#endif /*VK_USE_PLATFORM_MACOS_MVK*/
+
+          //=== VK_EXT_debug_utils ===
+          { "vkSetDebugUtilsObjectNameEXT", NullDriverCommand<PFN_vkSetDebugUtilsObjectNameEXT, 0x0>::pfn() },
+          { "vkSetDebugUtilsObjectTagEXT", NullDriverCommand<PFN_vkSetDebugUtilsObjectTagEXT, 0x0>::pfn() },
+          { "vkQueueBeginDebugUtilsLabelEXT", NullDriverCommand<PFN_vkQueueBeginDebugUtilsLabelEXT, 0x0>::pfn() },
+          { "vkQueueEndDebugUtilsLabelEXT", NullDriverCommand<PFN_vkQueueEndDebugUtilsLabelEXT, 0x0>::pfn() },
+          { "vkQueueInsertDebugUtilsLabelEXT", NullDriverCommand<PFN_vkQueueInsertDebugUtilsLabelEXT, 0x0>::pfn() },
+          { "vkCmdBeginDebugUtilsLabelEXT", NullDriverCommand<PFN_vkCmdBeginDebugUtilsLabelEXT, 0x0>::pfn() },
+          { "vkCmdEndDebugUtilsLabelEXT", NullDriverCommand<PFN_vkCmdEndDebugUtilsLabelEXT, 0x0>::pfn() },
+          { "vkCmdInsertDebugUtilsLabelEXT", NullDriverCommand<PFN_vkCmdInsertDebugUtilsLabelEXT, 0x0>::pfn() },
+          { "vkCreateDebugUtilsMessengerEXT", NullDriverCommand<PFN_vkCreateDebugUtilsMessengerEXT, 0x8>::pfn() },
+          { "vkDestroyDebugUtilsMessengerEXT", NullDriverCommand<PFN_vkDestroyDebugUtilsMessengerEXT, 0x0>::pfn() },
+          { "vkSubmitDebugUtilsMessageEXT", NullDriverCommand<PFN_vkSubmitDebugUtilsMessageEXT, 0x0>::pfn() },
+
+#if defined( VK_USE_PLATFORM_ANDROID_KHR )
+          //=== VK_ANDROID_external_memory_android_hardware_buffer ===
+          { "vkGetAndroidHardwareBufferPropertiesANDROID", NullDriverCommand<PFN_vkGetAndroidHardwareBufferPropertiesANDROID, 0x4>::pfn() },
+          { "vkGetMemoryAndroidHardwareBufferANDROID", NullDriverCommand<PFN_vkGetMemoryAndroidHardwareBufferANDROID, 0x4>::pfn() },
+#endif /*VK_USE_PLATFORM_ANDROID_KHR*/
+
+          //=== VK_AMD_gpa_interface ===
+          { "vkCreateGpaSessionAMD", NullDriverCommand<PFN_vkCreateGpaSessionAMD, 0x8>::pfn() },
+          { "vkDestroyGpaSessionAMD", NullDriverCommand<PFN_vkDestroyGpaSessionAMD, 0x0>::pfn() },
+          { "vkSetGpaDeviceClockModeAMD", NullDriverCommand<PFN_vkSetGpaDeviceClockModeAMD, 0x2>::pfn() },
+          { "vkGetGpaDeviceClockInfoAMD", NullDriverCommand<PFN_vkGetGpaDeviceClockInfoAMD, 0x2>::pfn() },
+          { "vkCmdBeginGpaSessionAMD", NullDriverCommand<PFN_vkCmdBeginGpaSessionAMD, 0x0>::pfn() },
+          { "vkCmdEndGpaSessionAMD", NullDriverCommand<PFN_vkCmdEndGpaSessionAMD, 0x0>::pfn() },
+          { "vkCmdBeginGpaSampleAMD", NullDriverCommand<PFN_vkCmdBeginGpaSampleAMD, 0x8>::pfn() },
+          { "vkCmdEndGpaSampleAMD", NullDriverCommand<PFN_vkCmdEndGpaSampleAMD, 0x0>::pfn() },
+          { "vkGetGpaSessionStatusAMD", NullDriverCommand<PFN_vkGetGpaSessionStatusAMD, 0x0>::pfn() },
+          { "vkGetGpaSessionResultsAMD", NullDriverCommand<PFN_vkGetGpaSessionResultsAMD, 0x18>::pfn() },
+          { "vkResetGpaSessionAMD", NullDriverCommand<PFN_vkResetGpaSessionAMD, 0x0>::pfn() },
+          { "vkCmdCopyGpaSessionResultsAMD", NullDriverCommand<PFN_vkCmdCopyGpaSessionResultsAMD, 0x0>::pfn() },
+
+#if defined( VK_ENABLE_BETA_EXTENSIONS )
+          //=== VK_AMDX_shader_enqueue ===
+          { "vkCreateExecutionGraphPipelinesAMDX", NullDriverCommand<PFN_vkCreateExecutionGraphPipelinesAMDX, 0x20>::pfn() },
+          { "vkGetExecutionGraphPipelineScratchSizeAMDX", NullDriverCommand<PFN_vkGetExecutionGraphPipelineScratchSizeAMDX, 0x4>::pfn() },
+          { "vkGetExecutionGraphPipelineNodeIndexAMDX", NullDriverCommand<PFN_vkGetExecutionGraphPipelineNodeIndexAMDX, 0x8>::pfn() },
+          { "vkCmdInitializeGraphScratchMemoryAMDX", NullDriverCommand<PFN_vkCmdInitializeGraphScratchMemoryAMDX, 0x0>::pfn() },
+          { "vkCmdDispatchGraphAMDX", NullDriverCommand<PFN_vkCmdDispatchGraphAMDX, 0x0>::pfn() },
+          { "vkCmdDispatchGraphIndirectAMDX", NullDriverCommand<PFN_vkCmdDispatchGraphIndirectAMDX, 0x0>::pfn() },
+          { "vkCmdDispatchGraphIndirectCountAMDX", NullDriverCommand<PFN_vkCmdDispatchGraphIndirectCountAMDX, 0x0>::pfn() },
+#endif /*VK_ENABLE_BETA_EXTENSIONS*/
+
+          //=== VK_EXT_descriptor_heap ===
+          { "vkWriteSamplerDescriptorsEXT", NullDriverCommand<PFN_vkWriteSamplerDescriptorsEXT, 0x0>::pfn() },
+          { "vkWriteResourceDescriptorsEXT", NullDriverCommand<PFN_vkWriteResourceDescriptorsEXT, 0x0>::pfn() },
+          { "vkCmdBindSamplerHeapEXT", NullDriverCommand<PFN_vkCmdBindSamplerHeapEXT, 0x0>::pfn() },
+          { "vkCmdBindResourceHeapEXT", NullDriverCommand<PFN_vkCmdBindResourceHeapEXT, 0x0>::pfn() },
+          { "vkCmdPushDataEXT", NullDriverCommand<PFN_vkCmdPushDataEXT, 0x0>::pfn() },
+          { "vkGetImageOpaqueCaptureDataEXT", NullDriverCommand<PFN_vkGetImageOpaqueCaptureDataEXT, 0x8>::pfn() },
+          { "vkGetPhysicalDeviceDescriptorSizeEXT", NullDriverCommand<PFN_vkGetPhysicalDeviceDescriptorSizeEXT, 0x0>::pfn() },
+          { "vkRegisterCustomBorderColorEXT", NullDriverCommand<PFN_vkRegisterCustomBorderColorEXT, 0x8>::pfn() },
+          { "vkUnregisterCustomBorderColorEXT", NullDriverCommand<PFN_vkUnregisterCustomBorderColorEXT, 0x0>::pfn() },
+          { "vkGetTensorOpaqueCaptureDataARM", NullDriverCommand<PFN_vkGetTensorOpaqueCaptureDataARM, 0x8>::pfn() },
+
+          //=== VK_EXT_sample_locations ===
+          { "vkCmdSetSampleLocationsEXT", NullDriverCommand<PFN_vkCmdSetSampleLocationsEXT, 0x0>::pfn() },
+          { "vkGetPhysicalDeviceMultisamplePropertiesEXT", NullDriverCommand<PFN_vkGetPhysicalDeviceMultisamplePropertiesEXT, 0x4>::pfn() },
+
+          //=== VK_KHR_get_memory_requirements2 ===
+          { "vkGetImageMemoryRequirements2KHR", NullDriverCommand<PFN_vkGetImageMemoryRequirements2KHR, 0x4>::pfn() },
+          { "vkGetBufferMemoryRequirements2KHR", NullDriverCommand<PFN_vkGetBufferMemoryRequirements2KHR, 0x4>::pfn() },
+          { "vkGetImageSparseMemoryRequirements2KHR", NullDriverCommand<PFN_vkGetImageSparseMemoryRequirements2KHR, 0xc>::pfn() },
+
+          //=== VK_KHR_acceleration_structure ===
+          { "vkCreateAccelerationStructureKHR", NullDriverCommand<PFN_vkCreateAccelerationStructureKHR, 0x8>::pfn() },
+          { "vkDestroyAccelerationStructureKHR", NullDriverCommand<PFN_vkDestroyAccelerationStructureKHR, 0x0>::pfn() },
+          { "vkCmdBuildAccelerationStructuresKHR", NullDriverCommand<PFN_vkCmdBuildAccelerationStructuresKHR, 0x0>::pfn() },
+          { "vkCmdBuildAccelerationStructuresIndirectKHR", NullDriverCommand<PFN_vkCmdBuildAccelerationStructuresIndirectKHR, 0x0>::pfn() },
+          { "vkBuildAccelerationStructuresKHR", NullDriverCommand<PFN_vkBuildAccelerationStructuresKHR, 0x0>::pfn() },
+          { "vkCopyAccelerationStructureKHR", NullDriverCommand<PFN_vkCopyAccelerationStructureKHR, 0x0>::pfn() },
+          { "vkCopyAccelerationStructureToMemoryKHR", NullDriverCommand<PFN_vkCopyAccelerationStructureToMemoryKHR, 0x0>::pfn() },
+          { "vkCopyMemoryToAccelerationStructureKHR", NullDriverCommand<PFN_vkCopyMemoryToAccelerationStructureKHR, 0x0>::pfn() },
+          { "vkWriteAccelerationStructuresPropertiesKHR", NullDriverCommand<PFN_vkWriteAccelerationStructuresPropertiesKHR, 0x20>::pfn() },
+          { "vkCmdCopyAccelerationStructureKHR", NullDriverCommand<PFN_vkCmdCopyAccelerationStructureKHR, 0x0>::pfn() },
+          { "vkCmdCopyAccelerationStructureToMemoryKHR", NullDriverCommand<PFN_vkCmdCopyAccelerationStructureToMemoryKHR, 0x0>::pfn() },
+          { "vkCmdCopyMemoryToAccelerationStructureKHR", NullDriverCommand<PFN_vkCmdCopyMemoryToAccelerationStructureKHR, 0x0>::pfn() },
+          { "vkGetAccelerationStructureDeviceAddressKHR", NullDriverCommand<PFN_vkGetAccelerationStructureDeviceAddressKHR, 0x0>::pfn() },
+          { "vkCmdWriteAccelerationStructuresPropertiesKHR", NullDriverCommand<PFN_vkCmdWriteAccelerationStructuresPropertiesKHR, 0x0>::pfn() },
+          { "vkGetDeviceAccelerationStructureCompatibilityKHR", NullDriverCommand<PFN_vkGetDeviceAccelerationStructureCompatibilityKHR, 0x4>::pfn() },
+          { "vkGetAccelerationStructureBuildSizesKHR", NullDriverCommand<PFN_vkGetAccelerationStructureBuildSizesKHR, 0x10>::pfn() },
+
+          //=== VK_KHR_ray_tracing_pipeline ===
+          { "vkCmdTraceRaysKHR", NullDriverCommand<PFN_vkCmdTraceRaysKHR, 0x0>::pfn() },
+          { "vkCreateRayTracingPipelinesKHR", NullDriverCommand<PFN_vkCreateRayTracingPipelinesKHR, 0x40>::pfn() },
+          { "vkGetRayTracingShaderGroupHandlesKHR", NullDriverCommand<PFN_vkGetRayTracingShaderGroupHandlesKHR, 0x20>::pfn() },
+          { "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR", NullDriverCommand<PFN_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR, 0x20>::pfn() },
+          { "vkCmdTraceRaysIndirectKHR", NullDriverCommand<PFN_vkCmdTraceRaysIndirectKHR, 0x0>::pfn() },
+          { "vkGetRayTracingShaderGroupStackSizeKHR", NullDriverCommand<PFN_vkGetRayTracingShaderGroupStackSizeKHR, 0x0>::pfn() },
+          { "vkCmdSetRayTracingPipelineStackSizeKHR", NullDriverCommand<PFN_vkCmdSetRayTracingPipelineStackSizeKHR, 0x0>::pfn() },
+
+          //=== VK_KHR_sampler_ycbcr_conversion ===
+          { "vkCreateSamplerYcbcrConversionKHR", NullDriverCommand<PFN_vkCreateSamplerYcbcrConversionKHR, 0x8>::pfn() },
+          { "vkDestroySamplerYcbcrConversionKHR", NullDriverCommand<PFN_vkDestroySamplerYcbcrConversionKHR, 0x0>::pfn() },
+
+          //=== VK_KHR_bind_memory2 ===
+          { "vkBindBufferMemory2KHR", NullDriverCommand<PFN_vkBindBufferMemory2KHR, 0x0>::pfn() },
+          { "vkBindImageMemory2KHR", NullDriverCommand<PFN_vkBindImageMemory2KHR, 0x0>::pfn() },
+
+          //=== VK_EXT_image_drm_format_modifier ===
+          { "vkGetImageDrmFormatModifierPropertiesEXT", NullDriverCommand<PFN_vkGetImageDrmFormatModifierPropertiesEXT, 0x4>::pfn() },
+
+          //=== VK_EXT_validation_cache ===
+          { "vkCreateValidationCacheEXT", NullDriverCommand<PFN_vkCreateValidationCacheEXT, 0x8>::pfn() },
+          { "vkDestroyValidationCacheEXT", NullDriverCommand<PFN_vkDestroyValidationCacheEXT, 0x0>::pfn() },
+          { "vkMergeValidationCachesEXT", NullDriverCommand<PFN_vkMergeValidationCachesEXT, 0x0>::pfn() },
+          { "vkGetValidationCacheDataEXT", NullDriverCommand<PFN_vkGetValidationCacheDataEXT, 0xc>::pfn() },
+
+          //=== VK_NV_shading_rate_image ===
+          { "vkCmdBindShadingRateImageNV", NullDriverCommand<PFN_vkCmdBindShadingRateImageNV, 0x0>::pfn() },
+          { "vkCmdSetViewportShadingRatePaletteNV", NullDriverCommand<PFN_vkCmdSetViewportShadingRatePaletteNV, 0x0>::pfn() },
+          { "vkCmdSetCoarseSampleOrderNV", NullDriverCommand<PFN_vkCmdSetCoarseSampleOrderNV, 0x0>::pfn() },
+
+          //=== VK_NV_ray_tracing ===
+          { "vkCreateAccelerationStructureNV", NullDriverCommand<PFN_vkCreateAccelerationStructureNV, 0x8>::pfn() },
+          { "vkDestroyAccelerationStructureNV", NullDriverCommand<PFN_vkDestroyAccelerationStructureNV, 0x0>::pfn() },
+          { "vkGetAccelerationStructureMemoryRequirementsNV", NullDriverCommand<PFN_vkGetAccelerationStructureMemoryRequirementsNV, 0x4>::pfn() },
+          { "vkBindAccelerationStructureMemoryNV", NullDriverCommand<PFN_vkBindAccelerationStructureMemoryNV, 0x0>::pfn() },
+          { "vkCmdBuildAccelerationStructureNV", NullDriverCommand<PFN_vkCmdBuildAccelerationStructureNV, 0x0>::pfn() },
+          { "vkCmdCopyAccelerationStructureNV", NullDriverCommand<PFN_vkCmdCopyAccelerationStructureNV, 0x0>::pfn() },
+          { "vkCmdTraceRaysNV", NullDriverCommand<PFN_vkCmdTraceRaysNV, 0x0>::pfn() },
+          { "vkCreateRayTracingPipelinesNV", NullDriverCommand<PFN_vkCreateRayTracingPipelinesNV, 0x20>::pfn() },
+          { "vkGetRayTracingShaderGroupHandlesNV", NullDriverCommand<PFN_vkGetRayTracingShaderGroupHandlesNV, 0x20>::pfn() },
+          { "vkGetAccelerationStructureHandleNV", NullDriverCommand<PFN_vkGetAccelerationStructureHandleNV, 0x8>::pfn() },
+          { "vkCmdWriteAccelerationStructuresPropertiesNV", NullDriverCommand<PFN_vkCmdWriteAccelerationStructuresPropertiesNV, 0x0>::pfn() },
+          { "vkCompileDeferredNV", NullDriverCommand<PFN_vkCompileDeferredNV, 0x0>::pfn() },
+
+          //=== VK_KHR_maintenance3 ===
+          { "vkGetDescriptorSetLayoutSupportKHR", NullDriverCommand<PFN_vkGetDescriptorSetLayoutSupportKHR, 0x4>::pfn() },
+
+          //=== VK_KHR_draw_indirect_count ===
+          { "vkCmdDrawIndirectCountKHR", NullDriverCommand<PFN_vkCmdDrawIndirectCountKHR, 0x0>::pfn() },
+          { "vkCmdDrawIndexedIndirectCountKHR", NullDriverCommand<PFN_vkCmdDrawIndexedIndirectCountKHR, 0x0>::pfn() },
+
+          //=== VK_EXT_external_memory_host ===
+          { "vkGetMemoryHostPointerPropertiesEXT", NullDriverCommand<PFN_vkGetMemoryHostPointerPropertiesEXT, 0x8>::pfn() },
+
+          //=== VK_AMD_buffer_marker ===
+          { "vkCmdWriteBufferMarkerAMD", NullDriverCommand<PFN_vkCmdWriteBufferMarkerAMD, 0x0>::pfn() },
+          { "vkCmdWriteBufferMarker2AMD", NullDriverCommand<PFN_vkCmdWriteBufferMarker2AMD, 0x0>::pfn() },
+
+          //=== VK_EXT_calibrated_timestamps ===
+          { "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT", NullDriverCommand<PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT, 0x6>::pfn() },
+          { "vkGetCalibratedTimestampsEXT", NullDriverCommand<PFN_vkGetCalibratedTimestampsEXT, 0x18>::pfn() },
+
+          //=== VK_NV_mesh_shader ===
+          { "vkCmdDrawMeshTasksNV", NullDriverCommand<PFN_vkCmdDrawMeshTasksNV, 0x0>::pfn() },
+          { "vkCmdDrawMeshTasksIndirectNV", NullDriverCommand<PFN_vkCmdDrawMeshTasksIndirectNV, 0x0>::pfn() },
+          { "vkCmdDrawMeshTasksIndirectCountNV", NullDriverCommand<PFN_vkCmdDrawMeshTasksIndirectCountNV, 0x0>::pfn() },
+
+          //=== VK_NV_scissor_exclusive ===
+          { "vkCmdSetExclusiveScissorEnableNV", NullDriverCommand<PFN_vkCmdSetExclusiveScissorEnableNV, 0x0>::pfn() },
+          { "vkCmdSetExclusiveScissorNV", NullDriverCommand<PFN_vkCmdSetExclusiveScissorNV, 0x0>::pfn() },
+
+          //=== VK_NV_device_diagnostic_checkpoints ===
+          { "vkCmdSetCheckpointNV", NullDriverCommand<PFN_vkCmdSetCheckpointNV, 0x0>::pfn() },
+          { "vkGetQueueCheckpointDataNV", NullDriverCommand<PFN_vkGetQueueCheckpointDataNV, 0x6>::pfn() },
+          { "vkGetQueueCheckpointData2NV", NullDriverCommand<PFN_vkGetQueueCheckpointData2NV, 0x6>::pfn() },
+
+          //=== VK_KHR_timeline_semaphore ===
+          { "vkGetSemaphoreCounterValueKHR", NullDriverCommand<PFN_vkGetSemaphoreCounterValueKHR, 0x4>::pfn() },
+          { "vkWaitSemaphoresKHR", NullDriverCommand<PFN_vkWaitSemaphoresKHR, 0x0>::pfn() },
+          { "vkSignalSemaphoreKHR", NullDriverCommand<PFN_vkSignalSemaphoreKHR, 0x0>::pfn() },
+
+          //=== VK_EXT_present_timing ===
+          { "vkSetSwapchainPresentTimingQueueSizeEXT", NullDriverCommand<PFN_vkSetSwapchainPresentTimingQueueSizeEXT, 0x0>::pfn() },
+          { "vkGetSwapchainTimingPropertiesEXT", NullDriverCommand<PFN_vkGetSwapchainTimingPropertiesEXT, 0xc>::pfn() },
+          { "vkGetSwapchainTimeDomainPropertiesEXT", NullDriverCommand<PFN_vkGetSwapchainTimeDomainPropertiesEXT, 0xc>::pfn() },
+          { "vkGetPastPresentationTimingEXT", NullDriverCommand<PFN_vkGetPastPresentationTimingEXT, 0x4>::pfn() },
+
+          //=== VK_INTEL_performance_query ===
+          { "vkInitializePerformanceApiINTEL", NullDriverCommand<PFN_vkInitializePerformanceApiINTEL, 0x0>::pfn() },
+          { "vkUninitializePerformanceApiINTEL", NullDriverCommand<PFN_vkUninitializePerformanceApiINTEL, 0x0>::pfn() },
+          { "vkCmdSetPerformanceMarkerINTEL", NullDriverCommand<PFN_vkCmdSetPerformanceMarkerINTEL, 0x0>::pfn() },
+          { "vkCmdSetPerformanceStreamMarkerINTEL", NullDriverCommand<PFN_vkCmdSetPerformanceStreamMarkerINTEL, 0x0>::pfn() },
+          { "vkCmdSetPerformanceOverrideINTEL", NullDriverCommand<PFN_vkCmdSetPerformanceOverrideINTEL, 0x0>::pfn() },
+          { "vkAcquirePerformanceConfigurationINTEL", NullDriverCommand<PFN_vkAcquirePerformanceConfigurationINTEL, 0x4>::pfn() },
+          { "vkReleasePerformanceConfigurationINTEL", NullDriverCommand<PFN_vkReleasePerformanceConfigurationINTEL, 0x0>::pfn() },
+          { "vkQueueSetPerformanceConfigurationINTEL", NullDriverCommand<PFN_vkQueueSetPerformanceConfigurationINTEL, 0x0>::pfn() },
+          { "vkGetPerformanceParameterINTEL", NullDriverCommand<PFN_vkGetPerformanceParameterINTEL, 0x4>::pfn() },
+
+          //=== VK_AMD_display_native_hdr ===
+          { "vkSetLocalDimmingAMD", NullDriverCommand<PFN_vkSetLocalDimmingAMD, 0x0>::pfn() },
+
+#if defined( VK_USE_PLATFORM_FUCHSIA )
+          //=== VK_FUCHSIA_imagepipe_surface ===
+          { "vkCreateImagePipeSurfaceFUCHSIA", NullDriverCommand<PFN_vkCreateImagePipeSurfaceFUCHSIA, 0x8>::pfn() },
+#endif /*VK_USE_PLATFORM_FUCHSIA*/
+
+#if defined( VK_USE_PLATFORM_METAL_EXT )
+          //=== VK_EXT_metal_surface ===
+          { "vkCreateMetalSurfaceEXT", NullDriverCommand<PFN_vkCreateMetalSurfaceEXT, 0x8>::pfn() },
+#endif /*VK_USE_PLATFORM_METAL_EXT*/
+
+          //=== VK_KHR_fragment_shading_rate ===
+          { "vkGetPhysicalDeviceFragmentShadingRatesKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceFragmentShadingRatesKHR, 0x6>::pfn() },
+          { "vkCmdSetFragmentShadingRateKHR", NullDriverCommand<PFN_vkCmdSetFragmentShadingRateKHR, 0x0>::pfn() },
+
+          //=== VK_KHR_dynamic_rendering_local_read ===
+          { "vkCmdSetRenderingAttachmentLocationsKHR", NullDriverCommand<PFN_vkCmdSetRenderingAttachmentLocationsKHR, 0x0>::pfn() },
+          { "vkCmdSetRenderingInputAttachmentIndicesKHR", NullDriverCommand<PFN_vkCmdSetRenderingInputAttachmentIndicesKHR, 0x0>::pfn() },
+
+          //=== VK_EXT_buffer_device_address ===
+          { "vkGetBufferDeviceAddressEXT", NullDriverCommand<PFN_vkGetBufferDeviceAddressEXT, 0x0>::pfn() },
+
+          //=== VK_EXT_tooling_info ===
+          { "vkGetPhysicalDeviceToolPropertiesEXT", NullDriverCommand<PFN_vkGetPhysicalDeviceToolPropertiesEXT, 0x6>::pfn() },
+
+          //=== VK_KHR_present_wait ===
+          { "vkWaitForPresentKHR", NullDriverCommand<PFN_vkWaitForPresentKHR, 0x0>::pfn() },
+
+          //=== VK_NV_cooperative_matrix ===
+          { "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV", NullDriverCommand<PFN_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV, 0x6>::pfn() },
+
+          //=== VK_NV_coverage_reduction_mode ===
+          { "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV",
+            NullDriverCommand<PFN_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV, 0x6>::pfn() },
+
+#if defined( VK_USE_PLATFORM_WIN32_KHR )
+          //=== VK_EXT_full_screen_exclusive ===
+          { "vkGetPhysicalDeviceSurfacePresentModes2EXT", NullDriverCommand<PFN_vkGetPhysicalDeviceSurfacePresentModes2EXT, 0xc>::pfn() },
+          { "vkAcquireFullScreenExclusiveModeEXT", NullDriverCommand<PFN_vkAcquireFullScreenExclusiveModeEXT, 0x0>::pfn() },
+          { "vkReleaseFullScreenExclusiveModeEXT", NullDriverCommand<PFN_vkReleaseFullScreenExclusiveModeEXT, 0x0>::pfn() },
+          { "vkGetDeviceGroupSurfacePresentModes2EXT", NullDriverCommand<PFN_vkGetDeviceGroupSurfacePresentModes2EXT, 0x4>::pfn() },
+#endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+          //=== VK_EXT_headless_surface ===
+          { "vkCreateHeadlessSurfaceEXT", NullDriverCommand<PFN_vkCreateHeadlessSurfaceEXT, 0x8>::pfn() },
+
+          //=== VK_KHR_buffer_device_address ===
+          { "vkGetBufferDeviceAddressKHR", NullDriverCommand<PFN_vkGetBufferDeviceAddressKHR, 0x0>::pfn() },
+          { "vkGetBufferOpaqueCaptureAddressKHR", NullDriverCommand<PFN_vkGetBufferOpaqueCaptureAddressKHR, 0x0>::pfn() },
+          { "vkGetDeviceMemoryOpaqueCaptureAddressKHR", NullDriverCommand<PFN_vkGetDeviceMemoryOpaqueCaptureAddressKHR, 0x0>::pfn() },
+
+          //=== VK_EXT_line_rasterization ===
+          { "vkCmdSetLineStippleEXT", NullDriverCommand<PFN_vkCmdSetLineStippleEXT, 0x0>::pfn() },
+
+          //=== VK_EXT_host_query_reset ===
+          { "vkResetQueryPoolEXT", NullDriverCommand<PFN_vkResetQueryPoolEXT, 0x0>::pfn() },
+
+          //=== VK_EXT_extended_dynamic_state ===
+          { "vkCmdSetCullModeEXT", NullDriverCommand<PFN_vkCmdSetCullModeEXT, 0x0>::pfn() },
+          { "vkCmdSetFrontFaceEXT", NullDriverCommand<PFN_vkCmdSetFrontFaceEXT, 0x0>::pfn() },
+          { "vkCmdSetPrimitiveTopologyEXT", NullDriverCommand<PFN_vkCmdSetPrimitiveTopologyEXT, 0x0>::pfn() },
+          { "vkCmdSetViewportWithCountEXT", NullDriverCommand<PFN_vkCmdSetViewportWithCountEXT, 0x0>::pfn() },
+          { "vkCmdSetScissorWithCountEXT", NullDriverCommand<PFN_vkCmdSetScissorWithCountEXT, 0x0>::pfn() },
+          { "vkCmdBindVertexBuffers2EXT", NullDriverCommand<PFN_vkCmdBindVertexBuffers2EXT, 0x0>::pfn() },
+          { "vkCmdSetDepthTestEnableEXT", NullDriverCommand<PFN_vkCmdSetDepthTestEnableEXT, 0x0>::pfn() },
+          { "vkCmdSetDepthWriteEnableEXT", NullDriverCommand<PFN_vkCmdSetDepthWriteEnableEXT, 0x0>::pfn() },
+          { "vkCmdSetDepthCompareOpEXT", NullDriverCommand<PFN_vkCmdSetDepthCompareOpEXT, 0x0>::pfn() },
+          { "vkCmdSetDepthBoundsTestEnableEXT", NullDriverCommand<PFN_vkCmdSetDepthBoundsTestEnableEXT, 0x0>::pfn() },
+          { "vkCmdSetStencilTestEnableEXT", NullDriverCommand<PFN_vkCmdSetStencilTestEnableEXT, 0x0>::pfn() },
+          { "vkCmdSetStencilOpEXT", NullDriverCommand<PFN_vkCmdSetStencilOpEXT, 0x0>::pfn() },
+
+          //=== VK_KHR_deferred_host_operations ===
+          { "vkCreateDeferredOperationKHR", NullDriverCommand<PFN_vkCreateDeferredOperationKHR, 0x4>::pfn() },
+          { "vkDestroyDeferredOperationKHR", NullDriverCommand<PFN_vkDestroyDeferredOperationKHR, 0x0>::pfn() },
+          { "vkGetDeferredOperationMaxConcurrencyKHR", NullDriverCommand<PFN_vkGetDeferredOperationMaxConcurrencyKHR, 0x0>::pfn() },
+          { "vkGetDeferredOperationResultKHR", NullDriverCommand<PFN_vkGetDeferredOperationResultKHR, 0x0>::pfn() },
+          { "vkDeferredOperationJoinKHR", NullDriverCommand<PFN_vkDeferredOperationJoinKHR, 0x0>::pfn() },
+
+          //=== VK_KHR_pipeline_executable_properties ===
+          { "vkGetPipelineExecutablePropertiesKHR", NullDriverCommand<PFN_vkGetPipelineExecutablePropertiesKHR, 0xc>::pfn() },
+          { "vkGetPipelineExecutableStatisticsKHR", NullDriverCommand<PFN_vkGetPipelineExecutableStatisticsKHR, 0xc>::pfn() },
+          { "vkGetPipelineExecutableInternalRepresentationsKHR", NullDriverCommand<PFN_vkGetPipelineExecutableInternalRepresentationsKHR, 0xc>::pfn() },
+
+          //=== VK_EXT_host_image_copy ===
+          { "vkCopyMemoryToImageEXT", NullDriverCommand<PFN_vkCopyMemoryToImageEXT, 0x0>::pfn() },
+          { "vkCopyImageToMemoryEXT", NullDriverCommand<PFN_vkCopyImageToMemoryEXT, 0x0>::pfn() },
+          { "vkCopyImageToImageEXT", NullDriverCommand<PFN_vkCopyImageToImageEXT, 0x0>::pfn() },
+          { "vkTransitionImageLayoutEXT", NullDriverCommand<PFN_vkTransitionImageLayoutEXT, 0x0>::pfn() },
+          { "vkGetImageSubresourceLayout2EXT", NullDriverCommand<PFN_vkGetImageSubresourceLayout2EXT, 0x8>::pfn() },
+
+          //=== VK_KHR_map_memory2 ===
+          { "vkMapMemory2KHR", NullDriverCommand<PFN_vkMapMemory2KHR, 0x4>::pfn() },
+          { "vkUnmapMemory2KHR", NullDriverCommand<PFN_vkUnmapMemory2KHR, 0x0>::pfn() },
+
+          //=== VK_EXT_swapchain_maintenance1 ===
+          { "vkReleaseSwapchainImagesEXT", NullDriverCommand<PFN_vkReleaseSwapchainImagesEXT, 0x0>::pfn() },
+
+          //=== VK_NV_device_generated_commands ===
+          { "vkGetGeneratedCommandsMemoryRequirementsNV", NullDriverCommand<PFN_vkGetGeneratedCommandsMemoryRequirementsNV, 0x4>::pfn() },
+          { "vkCmdPreprocessGeneratedCommandsNV", NullDriverCommand<PFN_vkCmdPreprocessGeneratedCommandsNV, 0x0>::pfn() },
+          { "vkCmdExecuteGeneratedCommandsNV", NullDriverCommand<PFN_vkCmdExecuteGeneratedCommandsNV, 0x0>::pfn() },
+          { "vkCmdBindPipelineShaderGroupNV", NullDriverCommand<PFN_vkCmdBindPipelineShaderGroupNV, 0x0>::pfn() },
+          { "vkCreateIndirectCommandsLayoutNV", NullDriverCommand<PFN_vkCreateIndirectCommandsLayoutNV, 0x8>::pfn() },
+          { "vkDestroyIndirectCommandsLayoutNV", NullDriverCommand<PFN_vkDestroyIndirectCommandsLayoutNV, 0x0>::pfn() },
+
+          //=== VK_EXT_depth_bias_control ===
+          { "vkCmdSetDepthBias2EXT", NullDriverCommand<PFN_vkCmdSetDepthBias2EXT, 0x0>::pfn() },
+
+          //=== VK_EXT_acquire_drm_display ===
+          { "vkAcquireDrmDisplayEXT", NullDriverCommand<PFN_vkAcquireDrmDisplayEXT, 0x0>::pfn() },
+          { "vkGetDrmDisplayEXT", NullDriverCommand<PFN_vkGetDrmDisplayEXT, 0x8>::pfn() },
+
+          //=== VK_EXT_private_data ===
+          { "vkCreatePrivateDataSlotEXT", NullDriverCommand<PFN_vkCreatePrivateDataSlotEXT, 0x8>::pfn() },
+          { "vkDestroyPrivateDataSlotEXT", NullDriverCommand<PFN_vkDestroyPrivateDataSlotEXT, 0x0>::pfn() },
+          { "vkSetPrivateDataEXT", NullDriverCommand<PFN_vkSetPrivateDataEXT, 0x0>::pfn() },
+          { "vkGetPrivateDataEXT", NullDriverCommand<PFN_vkGetPrivateDataEXT, 0x10>::pfn() },
+
+          //=== VK_KHR_video_encode_queue ===
+          { "vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR",
+            NullDriverCommand<PFN_vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR, 0x4>::pfn() },
+          { "vkGetEncodedVideoSessionParametersKHR", NullDriverCommand<PFN_vkGetEncodedVideoSessionParametersKHR, 0x1c>::pfn() },
+          { "vkCmdEncodeVideoKHR", NullDriverCommand<PFN_vkCmdEncodeVideoKHR, 0x0>::pfn() },
+
+          //=== VK_QCOM_queue_perf_hint ===
+          { "vkQueueSetPerfHintQCOM", NullDriverCommand<PFN_vkQueueSetPerfHintQCOM, 0x0>::pfn() },
+
+#if defined( VK_ENABLE_BETA_EXTENSIONS )
+          //=== VK_NV_cuda_kernel_launch ===
+          { "vkCreateCudaModuleNV", NullDriverCommand<PFN_vkCreateCudaModuleNV, 0x8>::pfn() },
+          { "vkGetCudaModuleCacheNV", NullDriverCommand<PFN_vkGetCudaModuleCacheNV, 0xc>::pfn() },
+          { "vkCreateCudaFunctionNV", NullDriverCommand<PFN_vkCreateCudaFunctionNV, 0x8>::pfn() },
+          { "vkDestroyCudaModuleNV", NullDriverCommand<PFN_vkDestroyCudaModuleNV, 0x0>::pfn() },
+          { "vkDestroyCudaFunctionNV", NullDriverCommand<PFN_vkDestroyCudaFunctionNV, 0x0>::pfn() },
+          { "vkCmdCudaLaunchKernelNV", NullDriverCommand<PFN_vkCmdCudaLaunchKernelNV, 0x0>::pfn() },
+#endif /*VK_ENABLE_BETA_EXTENSIONS*/
+
+          //=== VK_QCOM_tile_shading ===
+          { "vkCmdDispatchTileQCOM", NullDriverCommand<PFN_vkCmdDispatchTileQCOM, 0x0>::pfn() },
+          { "vkCmdBeginPerTileExecutionQCOM", NullDriverCommand<PFN_vkCmdBeginPerTileExecutionQCOM, 0x0>::pfn() },
+          { "vkCmdEndPerTileExecutionQCOM", NullDriverCommand<PFN_vkCmdEndPerTileExecutionQCOM, 0x0>::pfn() },
+
+          //=== VK_NV_low_latency ===
+          { "vkSetLatencySleepModeLegacyNV", NullDriverCommand<PFN_vkSetLatencySleepModeLegacyNV, 0x0>::pfn() },
+          { "vkLatencySleepLegacyNV", NullDriverCommand<PFN_vkLatencySleepLegacyNV, 0x0>::pfn() },
+          { "vkSetLatencyMarkerLegacyNV", NullDriverCommand<PFN_vkSetLatencyMarkerLegacyNV, 0x0>::pfn() },
+          { "vkGetLatencyTimingsLegacyNV", NullDriverCommand<PFN_vkGetLatencyTimingsLegacyNV, 0x2>::pfn() },
+          { "vkQueueNotifyOutOfBandLegacyNV", NullDriverCommand<PFN_vkQueueNotifyOutOfBandLegacyNV, 0x0>::pfn() },
+          { "vkGetSleepStatusLegacyNV", NullDriverCommand<PFN_vkGetSleepStatusLegacyNV, 0x2>::pfn() },
+          { "vkShutdownLatencyDeviceLegacyNV", NullDriverCommand<PFN_vkShutdownLatencyDeviceLegacyNV, 0x0>::pfn() },
+
+#if defined( VK_USE_PLATFORM_METAL_EXT )
+          //=== VK_EXT_metal_objects ===
+          { "vkExportMetalObjectsEXT", NullDriverCommand<PFN_vkExportMetalObjectsEXT, 0x2>::pfn() },
+#endif /*VK_USE_PLATFORM_METAL_EXT*/
+
+          //=== VK_KHR_synchronization2 ===
+          { "vkCmdSetEvent2KHR", NullDriverCommand<PFN_vkCmdSetEvent2KHR, 0x0>::pfn() },
+          { "vkCmdResetEvent2KHR", NullDriverCommand<PFN_vkCmdResetEvent2KHR, 0x0>::pfn() },
+          { "vkCmdWaitEvents2KHR", NullDriverCommand<PFN_vkCmdWaitEvents2KHR, 0x0>::pfn() },
+          { "vkCmdPipelineBarrier2KHR", NullDriverCommand<PFN_vkCmdPipelineBarrier2KHR, 0x0>::pfn() },
+          { "vkCmdWriteTimestamp2KHR", NullDriverCommand<PFN_vkCmdWriteTimestamp2KHR, 0x0>::pfn() },
+          { "vkQueueSubmit2KHR", NullDriverCommand<PFN_vkQueueSubmit2KHR, 0x0>::pfn() },
+
+          //=== VK_EXT_descriptor_buffer ===
+          { "vkGetDescriptorSetLayoutSizeEXT", NullDriverCommand<PFN_vkGetDescriptorSetLayoutSizeEXT, 0x4>::pfn() },
+          { "vkGetDescriptorSetLayoutBindingOffsetEXT", NullDriverCommand<PFN_vkGetDescriptorSetLayoutBindingOffsetEXT, 0x8>::pfn() },
+          { "vkGetDescriptorEXT", NullDriverCommand<PFN_vkGetDescriptorEXT, 0x8>::pfn() },
+          { "vkCmdBindDescriptorBuffersEXT", NullDriverCommand<PFN_vkCmdBindDescriptorBuffersEXT, 0x0>::pfn() },
+          { "vkCmdSetDescriptorBufferOffsetsEXT", NullDriverCommand<PFN_vkCmdSetDescriptorBufferOffsetsEXT, 0x0>::pfn() },
+          { "vkCmdBindDescriptorBufferEmbeddedSamplersEXT", NullDriverCommand<PFN_vkCmdBindDescriptorBufferEmbeddedSamplersEXT, 0x0>::pfn() },
+          { "vkGetBufferOpaqueCaptureDescriptorDataEXT", NullDriverCommand<PFN_vkGetBufferOpaqueCaptureDescriptorDataEXT, 0x4>::pfn() },
+          { "vkGetImageOpaqueCaptureDescriptorDataEXT", NullDriverCommand<PFN_vkGetImageOpaqueCaptureDescriptorDataEXT, 0x4>::pfn() },
+          { "vkGetImageViewOpaqueCaptureDescriptorDataEXT", NullDriverCommand<PFN_vkGetImageViewOpaqueCaptureDescriptorDataEXT, 0x4>::pfn() },
+          { "vkGetSamplerOpaqueCaptureDescriptorDataEXT", NullDriverCommand<PFN_vkGetSamplerOpaqueCaptureDescriptorDataEXT, 0x4>::pfn() },
+          { "vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT",
+            NullDriverCommand<PFN_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT, 0x4>::pfn() },
+
+          //=== VK_KHR_device_address_commands ===
+          { "vkCmdBindIndexBuffer3KHR", NullDriverCommand<PFN_vkCmdBindIndexBuffer3KHR, 0x0>::pfn() },
+          { "vkCmdBindVertexBuffers3KHR", NullDriverCommand<PFN_vkCmdBindVertexBuffers3KHR, 0x0>::pfn() },
+          { "vkCmdDrawIndirect2KHR", NullDriverCommand<PFN_vkCmdDrawIndirect2KHR, 0x0>::pfn() },
+          { "vkCmdDrawIndexedIndirect2KHR", NullDriverCommand<PFN_vkCmdDrawIndexedIndirect2KHR, 0x0>::pfn() },
+          { "vkCmdDispatchIndirect2KHR", NullDriverCommand<PFN_vkCmdDispatchIndirect2KHR, 0x0>::pfn() },
+          { "vkCmdCopyMemoryKHR", NullDriverCommand<PFN_vkCmdCopyMemoryKHR, 0x0>::pfn() },
+          { "vkCmdCopyMemoryToImageKHR", NullDriverCommand<PFN_vkCmdCopyMemoryToImageKHR, 0x0>::pfn() },
+          { "vkCmdCopyImageToMemoryKHR", NullDriverCommand<PFN_vkCmdCopyImageToMemoryKHR, 0x0>::pfn() },
+          { "vkCmdUpdateMemoryKHR", NullDriverCommand<PFN_vkCmdUpdateMemoryKHR, 0x0>::pfn() },
+          { "vkCmdFillMemoryKHR", NullDriverCommand<PFN_vkCmdFillMemoryKHR, 0x0>::pfn() },
+          { "vkCmdCopyQueryPoolResultsToMemoryKHR", NullDriverCommand<PFN_vkCmdCopyQueryPoolResultsToMemoryKHR, 0x0>::pfn() },
+          { "vkCmdDrawIndirectCount2KHR", NullDriverCommand<PFN_vkCmdDrawIndirectCount2KHR, 0x0>::pfn() },
+          { "vkCmdDrawIndexedIndirectCount2KHR", NullDriverCommand<PFN_vkCmdDrawIndexedIndirectCount2KHR, 0x0>::pfn() },
+          { "vkCmdBeginConditionalRendering2EXT", NullDriverCommand<PFN_vkCmdBeginConditionalRendering2EXT, 0x0>::pfn() },
+          { "vkCmdBindTransformFeedbackBuffers2EXT", NullDriverCommand<PFN_vkCmdBindTransformFeedbackBuffers2EXT, 0x0>::pfn() },
+          { "vkCmdBeginTransformFeedback2EXT", NullDriverCommand<PFN_vkCmdBeginTransformFeedback2EXT, 0x0>::pfn() },
+          { "vkCmdEndTransformFeedback2EXT", NullDriverCommand<PFN_vkCmdEndTransformFeedback2EXT, 0x0>::pfn() },
+          { "vkCmdDrawIndirectByteCount2EXT", NullDriverCommand<PFN_vkCmdDrawIndirectByteCount2EXT, 0x0>::pfn() },
+          { "vkCmdDrawMeshTasksIndirect2EXT", NullDriverCommand<PFN_vkCmdDrawMeshTasksIndirect2EXT, 0x0>::pfn() },
+          { "vkCmdDrawMeshTasksIndirectCount2EXT", NullDriverCommand<PFN_vkCmdDrawMeshTasksIndirectCount2EXT, 0x0>::pfn() },
+          { "vkCmdWriteMarkerToMemoryAMD", NullDriverCommand<PFN_vkCmdWriteMarkerToMemoryAMD, 0x0>::pfn() },
+          { "vkCreateAccelerationStructure2KHR", NullDriverCommand<PFN_vkCreateAccelerationStructure2KHR, 0x8>::pfn() },
+
+          //=== VK_NV_fragment_shading_rate_enums ===
+          { "vkCmdSetFragmentShadingRateEnumNV", NullDriverCommand<PFN_vkCmdSetFragmentShadingRateEnumNV, 0x0>::pfn() },
+
+          //=== VK_EXT_mesh_shader ===
+          { "vkCmdDrawMeshTasksEXT", NullDriverCommand<PFN_vkCmdDrawMeshTasksEXT, 0x0>::pfn() },
+          { "vkCmdDrawMeshTasksIndirectEXT", NullDriverCommand<PFN_vkCmdDrawMeshTasksIndirectEXT, 0x0>::pfn() },
+          { "vkCmdDrawMeshTasksIndirectCountEXT", NullDriverCommand<PFN_vkCmdDrawMeshTasksIndirectCountEXT, 0x0>::pfn() },
+
+          //=== VK_KHR_copy_commands2 ===
+          { "vkCmdCopyBuffer2KHR", NullDriverCommand<PFN_vkCmdCopyBuffer2KHR, 0x0>::pfn() },
+          { "vkCmdCopyImage2KHR", NullDriverCommand<PFN_vkCmdCopyImage2KHR, 0x0>::pfn() },
+          { "vkCmdCopyBufferToImage2KHR", NullDriverCommand<PFN_vkCmdCopyBufferToImage2KHR, 0x0>::pfn() },
+          { "vkCmdCopyImageToBuffer2KHR", NullDriverCommand<PFN_vkCmdCopyImageToBuffer2KHR, 0x0>::pfn() },
+          { "vkCmdBlitImage2KHR", NullDriverCommand<PFN_vkCmdBlitImage2KHR, 0x0>::pfn() },
+          { "vkCmdResolveImage2KHR", NullDriverCommand<PFN_vkCmdResolveImage2KHR, 0x0>::pfn() },
+
+          //=== VK_EXT_device_fault ===
+          { "vkGetDeviceFaultInfoEXT", NullDriverCommand<PFN_vkGetDeviceFaultInfoEXT, 0x6>::pfn() },
+
+#if defined( VK_USE_PLATFORM_WIN32_KHR )
+          //=== VK_NV_acquire_winrt_display ===
+          { "vkAcquireWinrtDisplayNV", NullDriverCommand<PFN_vkAcquireWinrtDisplayNV, 0x0>::pfn() },
+          { "vkGetWinrtDisplayNV", NullDriverCommand<PFN_vkGetWinrtDisplayNV, 0x4>::pfn() },
+#endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+#if defined( VK_USE_PLATFORM_DIRECTFB_EXT )
+          //=== VK_EXT_directfb_surface ===
+          { "vkCreateDirectFBSurfaceEXT", NullDriverCommand<PFN_vkCreateDirectFBSurfaceEXT, 0x8>::pfn() },
+          { "vkGetPhysicalDeviceDirectFBPresentationSupportEXT", NullDriverCommand<PFN_vkGetPhysicalDeviceDirectFBPresentationSupportEXT, 0x0>::pfn() },
+#endif /*VK_USE_PLATFORM_DIRECTFB_EXT*/
+
+          //=== VK_EXT_vertex_input_dynamic_state ===
+          { "vkCmdSetVertexInputEXT", NullDriverCommand<PFN_vkCmdSetVertexInputEXT, 0x0>::pfn() },
+
+#if defined( VK_USE_PLATFORM_FUCHSIA )
+          //=== VK_FUCHSIA_external_memory ===
+          { "vkGetMemoryZirconHandleFUCHSIA", NullDriverCommand<PFN_vkGetMemoryZirconHandleFUCHSIA, 0x4>::pfn() },
+          { "vkGetMemoryZirconHandlePropertiesFUCHSIA", NullDriverCommand<PFN_vkGetMemoryZirconHandlePropertiesFUCHSIA, 0x8>::pfn() },
+#endif /*VK_USE_PLATFORM_FUCHSIA*/
+
+#if defined( VK_USE_PLATFORM_FUCHSIA )
+          //=== VK_FUCHSIA_external_semaphore ===
+          { "vkImportSemaphoreZirconHandleFUCHSIA", NullDriverCommand<PFN_vkImportSemaphoreZirconHandleFUCHSIA, 0x0>::pfn() },
+          { "vkGetSemaphoreZirconHandleFUCHSIA", NullDriverCommand<PFN_vkGetSemaphoreZirconHandleFUCHSIA, 0x4>::pfn() },
+#endif /*VK_USE_PLATFORM_FUCHSIA*/
+
+#if defined( VK_USE_PLATFORM_FUCHSIA )
+          //=== VK_FUCHSIA_buffer_collection ===
+          { "vkCreateBufferCollectionFUCHSIA", NullDriverCommand<PFN_vkCreateBufferCollectionFUCHSIA, 0x8>::pfn() },
+          { "vkSetBufferCollectionImageConstraintsFUCHSIA", NullDriverCommand<PFN_vkSetBufferCollectionImageConstraintsFUCHSIA, 0x0>::pfn() },
+          { "vkSetBufferCollectionBufferConstraintsFUCHSIA", NullDriverCommand<PFN_vkSetBufferCollectionBufferConstraintsFUCHSIA, 0x0>::pfn() },
+          { "vkDestroyBufferCollectionFUCHSIA", NullDriverCommand<PFN_vkDestroyBufferCollectionFUCHSIA, 0x0>::pfn() },
+          { "vkGetBufferCollectionPropertiesFUCHSIA", NullDriverCommand<PFN_vkGetBufferCollectionPropertiesFUCHSIA, 0x4>::pfn() },
+#endif /*VK_USE_PLATFORM_FUCHSIA*/
+
+          //=== VK_HUAWEI_subpass_shading ===
+          { "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI", NullDriverCommand<PFN_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI, 0x4>::pfn() },
+          { "vkCmdSubpassShadingHUAWEI", NullDriverCommand<PFN_vkCmdSubpassShadingHUAWEI, 0x0>::pfn() },
+
+          //=== VK_HUAWEI_invocation_mask ===
+          { "vkCmdBindInvocationMaskHUAWEI", NullDriverCommand<PFN_vkCmdBindInvocationMaskHUAWEI, 0x0>::pfn() },
+
+          //=== VK_NV_external_memory_rdma ===
+          { "vkGetMemoryRemoteAddressNV", NullDriverCommand<PFN_vkGetMemoryRemoteAddressNV, 0x4>::pfn() },
+
+          //=== VK_EXT_pipeline_properties ===
+          { "vkGetPipelinePropertiesEXT", NullDriverCommand<PFN_vkGetPipelinePropertiesEXT, 0x4>::pfn() },
+
+          //=== VK_EXT_extended_dynamic_state2 ===
+          { "vkCmdSetPatchControlPointsEXT", NullDriverCommand<PFN_vkCmdSetPatchControlPointsEXT, 0x0>::pfn() },
+          { "vkCmdSetRasterizerDiscardEnableEXT", NullDriverCommand<PFN_vkCmdSetRasterizerDiscardEnableEXT, 0x0>::pfn() },
+          { "vkCmdSetDepthBiasEnableEXT", NullDriverCommand<PFN_vkCmdSetDepthBiasEnableEXT, 0x0>::pfn() },
+          { "vkCmdSetLogicOpEXT", NullDriverCommand<PFN_vkCmdSetLogicOpEXT, 0x0>::pfn() },
+          { "vkCmdSetPrimitiveRestartEnableEXT", NullDriverCommand<PFN_vkCmdSetPrimitiveRestartEnableEXT, 0x0>::pfn() },
+
+#if defined( VK_USE_PLATFORM_SCREEN_QNX )
+          //=== VK_QNX_screen_surface ===
+          { "vkCreateScreenSurfaceQNX", NullDriverCommand<PFN_vkCreateScreenSurfaceQNX, 0x8>::pfn() },
+          { "vkGetPhysicalDeviceScreenPresentationSupportQNX", NullDriverCommand<PFN_vkGetPhysicalDeviceScreenPresentationSupportQNX, 0x0>::pfn() },
+#endif /*VK_USE_PLATFORM_SCREEN_QNX*/
+
+          //=== VK_EXT_color_write_enable ===
+          { "vkCmdSetColorWriteEnableEXT", NullDriverCommand<PFN_vkCmdSetColorWriteEnableEXT, 0x0>::pfn() },
+
+          //=== VK_KHR_ray_tracing_maintenance1 ===
+          { "vkCmdTraceRaysIndirect2KHR", NullDriverCommand<PFN_vkCmdTraceRaysIndirect2KHR, 0x0>::pfn() },
+
+          //=== VK_EXT_multi_draw ===
+          { "vkCmdDrawMultiEXT", NullDriverCommand<PFN_vkCmdDrawMultiEXT, 0x0>::pfn() },
+          { "vkCmdDrawMultiIndexedEXT", NullDriverCommand<PFN_vkCmdDrawMultiIndexedEXT, 0x0>::pfn() },
+
+          //=== VK_EXT_opacity_micromap ===
+          { "vkCreateMicromapEXT", NullDriverCommand<PFN_vkCreateMicromapEXT, 0x8>::pfn() },
+          { "vkDestroyMicromapEXT", NullDriverCommand<PFN_vkDestroyMicromapEXT, 0x0>::pfn() },
+          { "vkCmdBuildMicromapsEXT", NullDriverCommand<PFN_vkCmdBuildMicromapsEXT, 0x0>::pfn() },
+          { "vkBuildMicromapsEXT", NullDriverCommand<PFN_vkBuildMicromapsEXT, 0x0>::pfn() },
+          { "vkCopyMicromapEXT", NullDriverCommand<PFN_vkCopyMicromapEXT, 0x0>::pfn() },
+          { "vkCopyMicromapToMemoryEXT", NullDriverCommand<PFN_vkCopyMicromapToMemoryEXT, 0x0>::pfn() },
+          { "vkCopyMemoryToMicromapEXT", NullDriverCommand<PFN_vkCopyMemoryToMicromapEXT, 0x0>::pfn() },
+          { "vkWriteMicromapsPropertiesEXT", NullDriverCommand<PFN_vkWriteMicromapsPropertiesEXT, 0x20>::pfn() },
+          { "vkCmdCopyMicromapEXT", NullDriverCommand<PFN_vkCmdCopyMicromapEXT, 0x0>::pfn() },
+          { "vkCmdCopyMicromapToMemoryEXT", NullDriverCommand<PFN_vkCmdCopyMicromapToMemoryEXT, 0x0>::pfn() },
+          { "vkCmdCopyMemoryToMicromapEXT", NullDriverCommand<PFN_vkCmdCopyMemoryToMicromapEXT, 0x0>::pfn() },
+          { "vkCmdWriteMicromapsPropertiesEXT", NullDriverCommand<PFN_vkCmdWriteMicromapsPropertiesEXT, 0x0>::pfn() },
+          { "vkGetDeviceMicromapCompatibilityEXT", NullDriverCommand<PFN_vkGetDeviceMicromapCompatibilityEXT, 0x4>::pfn() },
+          { "vkGetMicromapBuildSizesEXT", NullDriverCommand<PFN_vkGetMicromapBuildSizesEXT, 0x8>::pfn() },
+
+          //=== VK_HUAWEI_cluster_culling_shader ===
+          { "vkCmdDrawClusterHUAWEI", NullDriverCommand<PFN_vkCmdDrawClusterHUAWEI, 0x0>::pfn() },
+          { "vkCmdDrawClusterIndirectHUAWEI", NullDriverCommand<PFN_vkCmdDrawClusterIndirectHUAWEI, 0x0>::pfn() },
+
+          //=== VK_EXT_pageable_device_local_memory ===
+          { "vkSetDeviceMemoryPriorityEXT", NullDriverCommand<PFN_vkSetDeviceMemoryPriorityEXT, 0x0>::pfn() },
+
+          //=== VK_KHR_maintenance4 ===
+          { "vkGetDeviceBufferMemoryRequirementsKHR", NullDriverCommand<PFN_vkGetDeviceBufferMemoryRequirementsKHR, 0x4>::pfn() },
+          { "vkGetDeviceImageMemoryRequirementsKHR", NullDriverCommand<PFN_vkGetDeviceImageMemoryRequirementsKHR, 0x4>::pfn() },
+          { "vkGetDeviceImageSparseMemoryRequirementsKHR", NullDriverCommand<PFN_vkGetDeviceImageSparseMemoryRequirementsKHR, 0xc>::pfn() },
+
+          //=== VK_ARM_scheduling_controls ===
+          { "vkCmdSetDispatchParametersARM", NullDriverCommand<PFN_vkCmdSetDispatchParametersARM, 0x0>::pfn() },
+
+          //=== VK_VALVE_descriptor_set_host_mapping ===
+          { "vkGetDescriptorSetLayoutHostMappingInfoVALVE", NullDriverCommand<PFN_vkGetDescriptorSetLayoutHostMappingInfoVALVE, 0x4>::pfn() },
+          { "vkGetDescriptorSetHostMappingVALVE", NullDriverCommand<PFN_vkGetDescriptorSetHostMappingVALVE, 0x4>::pfn() },
+
+          //=== VK_NV_copy_memory_indirect ===
+          { "vkCmdCopyMemoryIndirectNV", NullDriverCommand<PFN_vkCmdCopyMemoryIndirectNV, 0x0>::pfn() },
+          { "vkCmdCopyMemoryToImageIndirectNV", NullDriverCommand<PFN_vkCmdCopyMemoryToImageIndirectNV, 0x0>::pfn() },
+
+          //=== VK_NV_memory_decompression ===
+          { "vkCmdDecompressMemoryNV", NullDriverCommand<PFN_vkCmdDecompressMemoryNV, 0x0>::pfn() },
+          { "vkCmdDecompressMemoryIndirectCountNV", NullDriverCommand<PFN_vkCmdDecompressMemoryIndirectCountNV, 0x0>::pfn() },
+
+          //=== VK_NV_device_generated_commands_compute ===
+          { "vkGetPipelineIndirectMemoryRequirementsNV", NullDriverCommand<PFN_vkGetPipelineIndirectMemoryRequirementsNV, 0x4>::pfn() },
+          { "vkCmdUpdatePipelineIndirectBufferNV", NullDriverCommand<PFN_vkCmdUpdatePipelineIndirectBufferNV, 0x0>::pfn() },
+          { "vkGetPipelineIndirectDeviceAddressNV", NullDriverCommand<PFN_vkGetPipelineIndirectDeviceAddressNV, 0x0>::pfn() },
+
+#if defined( VK_USE_PLATFORM_OHOS )
+          //=== VK_OHOS_external_memory ===
+          { "vkGetNativeBufferPropertiesOHOS", NullDriverCommand<PFN_vkGetNativeBufferPropertiesOHOS, 0x4>::pfn() },
+          { "vkGetMemoryNativeBufferOHOS", NullDriverCommand<PFN_vkGetMemoryNativeBufferOHOS, 0x4>::pfn() },
+#endif /*VK_USE_PLATFORM_OHOS*/
+
+          //=== VK_EXT_extended_dynamic_state3 ===
+          { "vkCmdSetDepthClampEnableEXT", NullDriverCommand<PFN_vkCmdSetDepthClampEnableEXT, 0x0>::pfn() },
+          { "vkCmdSetPolygonModeEXT", NullDriverCommand<PFN_vkCmdSetPolygonModeEXT, 0x0>::pfn() },
+          { "vkCmdSetRasterizationSamplesEXT", NullDriverCommand<PFN_vkCmdSetRasterizationSamplesEXT, 0x0>::pfn() },
+          { "vkCmdSetSampleMaskEXT", NullDriverCommand<PFN_vkCmdSetSampleMaskEXT, 0x0>::pfn() },
+          { "vkCmdSetAlphaToCoverageEnableEXT", NullDriverCommand<PFN_vkCmdSetAlphaToCoverageEnableEXT, 0x0>::pfn() },
+          { "vkCmdSetAlphaToOneEnableEXT", NullDriverCommand<PFN_vkCmdSetAlphaToOneEnableEXT, 0x0>::pfn() },
+          { "vkCmdSetLogicOpEnableEXT", NullDriverCommand<PFN_vkCmdSetLogicOpEnableEXT, 0x0>::pfn() },
+          { "vkCmdSetColorBlendEnableEXT", NullDriverCommand<PFN_vkCmdSetColorBlendEnableEXT, 0x0>::pfn() },
+          { "vkCmdSetColorBlendEquationEXT", NullDriverCommand<PFN_vkCmdSetColorBlendEquationEXT, 0x0>::pfn() },
+          { "vkCmdSetColorWriteMaskEXT", NullDriverCommand<PFN_vkCmdSetColorWriteMaskEXT, 0x0>::pfn() },
+          { "vkCmdSetTessellationDomainOriginEXT", NullDriverCommand<PFN_vkCmdSetTessellationDomainOriginEXT, 0x0>::pfn() },
+          { "vkCmdSetRasterizationStreamEXT", NullDriverCommand<PFN_vkCmdSetRasterizationStreamEXT, 0x0>::pfn() },
+          { "vkCmdSetConservativeRasterizationModeEXT", NullDriverCommand<PFN_vkCmdSetConservativeRasterizationModeEXT, 0x0>::pfn() },
+          { "vkCmdSetExtraPrimitiveOverestimationSizeEXT", NullDriverCommand<PFN_vkCmdSetExtraPrimitiveOverestimationSizeEXT, 0x0>::pfn() },
+          { "vkCmdSetDepthClipEnableEXT", NullDriverCommand<PFN_vkCmdSetDepthClipEnableEXT, 0x0>::pfn() },
+          { "vkCmdSetSampleLocationsEnableEXT", NullDriverCommand<PFN_vkCmdSetSampleLocationsEnableEXT, 0x0>::pfn() },
+          { "vkCmdSetColorBlendAdvancedEXT", NullDriverCommand<PFN_vkCmdSetColorBlendAdvancedEXT, 0x0>::pfn() },
+          { "vkCmdSetProvokingVertexModeEXT", NullDriverCommand<PFN_vkCmdSetProvokingVertexModeEXT, 0x0>::pfn() },
+          { "vkCmdSetLineRasterizationModeEXT", NullDriverCommand<PFN_vkCmdSetLineRasterizationModeEXT, 0x0>::pfn() },
+          { "vkCmdSetLineStippleEnableEXT", NullDriverCommand<PFN_vkCmdSetLineStippleEnableEXT, 0x0>::pfn() },
+          { "vkCmdSetDepthClipNegativeOneToOneEXT", NullDriverCommand<PFN_vkCmdSetDepthClipNegativeOneToOneEXT, 0x0>::pfn() },
+          { "vkCmdSetViewportWScalingEnableNV", NullDriverCommand<PFN_vkCmdSetViewportWScalingEnableNV, 0x0>::pfn() },
+          { "vkCmdSetViewportSwizzleNV", NullDriverCommand<PFN_vkCmdSetViewportSwizzleNV, 0x0>::pfn() },
+          { "vkCmdSetCoverageToColorEnableNV", NullDriverCommand<PFN_vkCmdSetCoverageToColorEnableNV, 0x0>::pfn() },
+          { "vkCmdSetCoverageToColorLocationNV", NullDriverCommand<PFN_vkCmdSetCoverageToColorLocationNV, 0x0>::pfn() },
+          { "vkCmdSetCoverageModulationModeNV", NullDriverCommand<PFN_vkCmdSetCoverageModulationModeNV, 0x0>::pfn() },
+          { "vkCmdSetCoverageModulationTableEnableNV", NullDriverCommand<PFN_vkCmdSetCoverageModulationTableEnableNV, 0x0>::pfn() },
+          { "vkCmdSetCoverageModulationTableNV", NullDriverCommand<PFN_vkCmdSetCoverageModulationTableNV, 0x0>::pfn() },
+          { "vkCmdSetShadingRateImageEnableNV", NullDriverCommand<PFN_vkCmdSetShadingRateImageEnableNV, 0x0>::pfn() },
+          { "vkCmdSetRepresentativeFragmentTestEnableNV", NullDriverCommand<PFN_vkCmdSetRepresentativeFragmentTestEnableNV, 0x0>::pfn() },
+          { "vkCmdSetCoverageReductionModeNV", NullDriverCommand<PFN_vkCmdSetCoverageReductionModeNV, 0x0>::pfn() },
+
+          //=== VK_ARM_tensors ===
+          { "vkCreateTensorARM", NullDriverCommand<PFN_vkCreateTensorARM, 0x8>::pfn() },
+          { "vkDestroyTensorARM", NullDriverCommand<PFN_vkDestroyTensorARM, 0x0>::pfn() },
+          { "vkCreateTensorViewARM", NullDriverCommand<PFN_vkCreateTensorViewARM, 0x8>::pfn() },
+          { "vkDestroyTensorViewARM", NullDriverCommand<PFN_vkDestroyTensorViewARM, 0x0>::pfn() },
+          { "vkGetTensorMemoryRequirementsARM", NullDriverCommand<PFN_vkGetTensorMemoryRequirementsARM, 0x4>::pfn() },
+          { "vkBindTensorMemoryARM", NullDriverCommand<PFN_vkBindTensorMemoryARM, 0x0>::pfn() },
+          { "vkGetDeviceTensorMemoryRequirementsARM", NullDriverCommand<PFN_vkGetDeviceTensorMemoryRequirementsARM, 0x4>::pfn() },
+          { "vkCmdCopyTensorARM", NullDriverCommand<PFN_vkCmdCopyTensorARM, 0x0>::pfn() },
+          { "vkGetPhysicalDeviceExternalTensorPropertiesARM", NullDriverCommand<PFN_vkGetPhysicalDeviceExternalTensorPropertiesARM, 0x4>::pfn() },
+          { "vkGetTensorOpaqueCaptureDescriptorDataARM", NullDriverCommand<PFN_vkGetTensorOpaqueCaptureDescriptorDataARM, 0x4>::pfn() },
+          { "vkGetTensorViewOpaqueCaptureDescriptorDataARM", NullDriverCommand<PFN_vkGetTensorViewOpaqueCaptureDescriptorDataARM, 0x4>::pfn() },
+
+          //=== VK_EXT_shader_module_identifier ===
+          { "vkGetShaderModuleIdentifierEXT", NullDriverCommand<PFN_vkGetShaderModuleIdentifierEXT, 0x4>::pfn() },
+          { "vkGetShaderModuleCreateInfoIdentifierEXT", NullDriverCommand<PFN_vkGetShaderModuleCreateInfoIdentifierEXT, 0x4>::pfn() },
+
+          //=== VK_NV_optical_flow ===
+          { "vkGetPhysicalDeviceOpticalFlowImageFormatsNV", NullDriverCommand<PFN_vkGetPhysicalDeviceOpticalFlowImageFormatsNV, 0xc>::pfn() },
+          { "vkCreateOpticalFlowSessionNV", NullDriverCommand<PFN_vkCreateOpticalFlowSessionNV, 0x8>::pfn() },
+          { "vkDestroyOpticalFlowSessionNV", NullDriverCommand<PFN_vkDestroyOpticalFlowSessionNV, 0x0>::pfn() },
+          { "vkBindOpticalFlowSessionImageNV", NullDriverCommand<PFN_vkBindOpticalFlowSessionImageNV, 0x0>::pfn() },
+          { "vkCmdOpticalFlowExecuteNV", NullDriverCommand<PFN_vkCmdOpticalFlowExecuteNV, 0x0>::pfn() },
+
+          //=== VK_KHR_maintenance5 ===
+          { "vkCmdBindIndexBuffer2KHR", NullDriverCommand<PFN_vkCmdBindIndexBuffer2KHR, 0x0>::pfn() },
+          { "vkGetRenderingAreaGranularityKHR", NullDriverCommand<PFN_vkGetRenderingAreaGranularityKHR, 0x4>::pfn() },
+          { "vkGetDeviceImageSubresourceLayoutKHR", NullDriverCommand<PFN_vkGetDeviceImageSubresourceLayoutKHR, 0x4>::pfn() },
+          { "vkGetImageSubresourceLayout2KHR", NullDriverCommand<PFN_vkGetImageSubresourceLayout2KHR, 0x8>::pfn() },
+
+          //=== VK_AMD_anti_lag ===
+          { "vkAntiLagUpdateAMD", NullDriverCommand<PFN_vkAntiLagUpdateAMD, 0x0>::pfn() },
+
+          //=== VK_KHR_present_wait2 ===
+          { "vkWaitForPresent2KHR", NullDriverCommand<PFN_vkWaitForPresent2KHR, 0x0>::pfn() },
+
+          //=== VK_EXT_shader_object ===
+          { "vkCreateShadersEXT", NullDriverCommand<PFN_vkCreateShadersEXT, 0x10>::pfn() },
+          { "vkDestroyShaderEXT", NullDriverCommand<PFN_vkDestroyShaderEXT, 0x0>::pfn() },
+          { "vkGetShaderBinaryDataEXT", NullDriverCommand<PFN_vkGetShaderBinaryDataEXT, 0xc>::pfn() },
+          { "vkCmdBindShadersEXT", NullDriverCommand<PFN_vkCmdBindShadersEXT, 0x0>::pfn() },
+          { "vkCmdSetDepthClampRangeEXT", NullDriverCommand<PFN_vkCmdSetDepthClampRangeEXT, 0x0>::pfn() },
+
+          //=== VK_KHR_pipeline_binary ===
+          { "vkCreatePipelineBinariesKHR", NullDriverCommand<PFN_vkCreatePipelineBinariesKHR, 0x8>::pfn() },
+          { "vkDestroyPipelineBinaryKHR", NullDriverCommand<PFN_vkDestroyPipelineBinaryKHR, 0x0>::pfn() },
+          { "vkGetPipelineKeyKHR", NullDriverCommand<PFN_vkGetPipelineKeyKHR, 0x4>::pfn() },
+          { "vkGetPipelineBinaryDataKHR", NullDriverCommand<PFN_vkGetPipelineBinaryDataKHR, 0x1c>::pfn() },
+          { "vkReleaseCapturedPipelineDataKHR", NullDriverCommand<PFN_vkReleaseCapturedPipelineDataKHR, 0x0>::pfn() },
+
+          //=== VK_QCOM_tile_properties ===
+          { "vkGetFramebufferTilePropertiesQCOM", NullDriverCommand<PFN_vkGetFramebufferTilePropertiesQCOM, 0xc>::pfn() },
+          { "vkGetDynamicRenderingTilePropertiesQCOM", NullDriverCommand<PFN_vkGetDynamicRenderingTilePropertiesQCOM, 0x4>::pfn() },
+
+          //=== VK_KHR_swapchain_maintenance1 ===
+          { "vkReleaseSwapchainImagesKHR", NullDriverCommand<PFN_vkReleaseSwapchainImagesKHR, 0x0>::pfn() },
+
+          //=== VK_NV_cooperative_vector ===
+          { "vkGetPhysicalDeviceCooperativeVectorPropertiesNV", NullDriverCommand<PFN_vkGetPhysicalDeviceCooperativeVectorPropertiesNV, 0x6>::pfn() },
+          { "vkConvertCooperativeVectorMatrixNV", NullDriverCommand<PFN_vkConvertCooperativeVectorMatrixNV, 0x0>::pfn() },
+          { "vkCmdConvertCooperativeVectorMatrixNV", NullDriverCommand<PFN_vkCmdConvertCooperativeVectorMatrixNV, 0x0>::pfn() },
+
+          //=== VK_NV_low_latency2 ===
+          { "vkSetLatencySleepModeNV", NullDriverCommand<PFN_vkSetLatencySleepModeNV, 0x0>::pfn() },
+          { "vkLatencySleepNV", NullDriverCommand<PFN_vkLatencySleepNV, 0x0>::pfn() },
+          { "vkSetLatencyMarkerNV", NullDriverCommand<PFN_vkSetLatencyMarkerNV, 0x0>::pfn() },
+          { "vkGetLatencyTimingsNV", NullDriverCommand<PFN_vkGetLatencyTimingsNV, 0x4>::pfn() },
+          { "vkQueueNotifyOutOfBandNV", NullDriverCommand<PFN_vkQueueNotifyOutOfBandNV, 0x0>::pfn() },
+
+          //=== VK_KHR_cooperative_matrix ===
+          { "vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR, 0x6>::pfn() },
+
+          //=== VK_ARM_data_graph ===
+          { "vkCreateDataGraphPipelinesARM", NullDriverCommand<PFN_vkCreateDataGraphPipelinesARM, 0x40>::pfn() },
+          { "vkCreateDataGraphPipelineSessionARM", NullDriverCommand<PFN_vkCreateDataGraphPipelineSessionARM, 0x8>::pfn() },
+          { "vkGetDataGraphPipelineSessionBindPointRequirementsARM", NullDriverCommand<PFN_vkGetDataGraphPipelineSessionBindPointRequirementsARM, 0xc>::pfn() },
+          { "vkGetDataGraphPipelineSessionMemoryRequirementsARM", NullDriverCommand<PFN_vkGetDataGraphPipelineSessionMemoryRequirementsARM, 0x4>::pfn() },
+          { "vkBindDataGraphPipelineSessionMemoryARM", NullDriverCommand<PFN_vkBindDataGraphPipelineSessionMemoryARM, 0x0>::pfn() },
+          { "vkDestroyDataGraphPipelineSessionARM", NullDriverCommand<PFN_vkDestroyDataGraphPipelineSessionARM, 0x0>::pfn() },
+          { "vkCmdDispatchDataGraphARM", NullDriverCommand<PFN_vkCmdDispatchDataGraphARM, 0x0>::pfn() },
+          { "vkGetDataGraphPipelineAvailablePropertiesARM", NullDriverCommand<PFN_vkGetDataGraphPipelineAvailablePropertiesARM, 0xc>::pfn() },
+          { "vkGetDataGraphPipelinePropertiesARM", NullDriverCommand<PFN_vkGetDataGraphPipelinePropertiesARM, 0x8>::pfn() },
+          { "vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM", NullDriverCommand<PFN_vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM, 0xc>::pfn() },
+          { "vkGetPhysicalDeviceQueueFamilyDataGraphProcessingEnginePropertiesARM",
+            NullDriverCommand<PFN_vkGetPhysicalDeviceQueueFamilyDataGraphProcessingEnginePropertiesARM, 0x4>::pfn() },
+
+          //=== VK_ARM_data_graph_instruction_set_tosa ===
+          { "vkGetPhysicalDeviceQueueFamilyDataGraphEngineOperationPropertiesARM",
+            NullDriverCommand<PFN_vkGetPhysicalDeviceQueueFamilyDataGraphEngineOperationPropertiesARM, 0x8>::pfn() },
+
+          //=== VK_EXT_attachment_feedback_loop_dynamic_state ===
+          { "vkCmdSetAttachmentFeedbackLoopEnableEXT", NullDriverCommand<PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT, 0x0>::pfn() },
+
+#if defined( VK_USE_PLATFORM_SCREEN_QNX )
+          //=== VK_QNX_external_memory_screen_buffer ===
+          { "vkGetScreenBufferPropertiesQNX", NullDriverCommand<PFN_vkGetScreenBufferPropertiesQNX, 0x4>::pfn() },
+#endif /*VK_USE_PLATFORM_SCREEN_QNX*/
+
+          //=== VK_KHR_line_rasterization ===
+          { "vkCmdSetLineStippleKHR", NullDriverCommand<PFN_vkCmdSetLineStippleKHR, 0x0>::pfn() },
+
+          //=== VK_KHR_calibrated_timestamps ===
+          { "vkGetPhysicalDeviceCalibrateableTimeDomainsKHR", NullDriverCommand<PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsKHR, 0x6>::pfn() },
+          { "vkGetCalibratedTimestampsKHR", NullDriverCommand<PFN_vkGetCalibratedTimestampsKHR, 0x18>::pfn() },
+
+          //=== VK_KHR_maintenance6 ===
+          { "vkCmdBindDescriptorSets2KHR", NullDriverCommand<PFN_vkCmdBindDescriptorSets2KHR, 0x0>::pfn() },
+          { "vkCmdPushConstants2KHR", NullDriverCommand<PFN_vkCmdPushConstants2KHR, 0x0>::pfn() },
+          { "vkCmdPushDescriptorSet2KHR", NullDriverCommand<PFN_vkCmdPushDescriptorSet2KHR, 0x0>::pfn() },
+          { "vkCmdPushDescriptorSetWithTemplate2KHR", NullDriverCommand<PFN_vkCmdPushDescriptorSetWithTemplate2KHR, 0x0>::pfn() },
+          { "vkCmdSetDescriptorBufferOffsets2EXT", NullDriverCommand<PFN_vkCmdSetDescriptorBufferOffsets2EXT, 0x0>::pfn() },
+          { "vkCmdBindDescriptorBufferEmbeddedSamplers2EXT", NullDriverCommand<PFN_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT, 0x0>::pfn() },
+
+          //=== VK_QCOM_tile_memory_heap ===
+          { "vkCmdBindTileMemoryQCOM", NullDriverCommand<PFN_vkCmdBindTileMemoryQCOM, 0x0>::pfn() },
+
+          //=== VK_KHR_copy_memory_indirect ===
+          { "vkCmdCopyMemoryIndirectKHR", NullDriverCommand<PFN_vkCmdCopyMemoryIndirectKHR, 0x0>::pfn() },
+          { "vkCmdCopyMemoryToImageIndirectKHR", NullDriverCommand<PFN_vkCmdCopyMemoryToImageIndirectKHR, 0x0>::pfn() },
+
+          //=== VK_EXT_memory_decompression ===
+          { "vkCmdDecompressMemoryEXT", NullDriverCommand<PFN_vkCmdDecompressMemoryEXT, 0x0>::pfn() },
+          { "vkCmdDecompressMemoryIndirectCountEXT", NullDriverCommand<PFN_vkCmdDecompressMemoryIndirectCountEXT, 0x0>::pfn() },
+
+          //=== VK_NV_external_compute_queue ===
+          { "vkCreateExternalComputeQueueNV", NullDriverCommand<PFN_vkCreateExternalComputeQueueNV, 0x8>::pfn() },
+          { "vkDestroyExternalComputeQueueNV", NullDriverCommand<PFN_vkDestroyExternalComputeQueueNV, 0x0>::pfn() },
+          { "vkGetExternalComputeQueueDataNV", NullDriverCommand<PFN_vkGetExternalComputeQueueDataNV, 0x6>::pfn() },
+
+          //=== VK_NV_cluster_acceleration_structure ===
+          { "vkGetClusterAccelerationStructureBuildSizesNV", NullDriverCommand<PFN_vkGetClusterAccelerationStructureBuildSizesNV, 0x4>::pfn() },
+          { "vkCmdBuildClusterAccelerationStructureIndirectNV", NullDriverCommand<PFN_vkCmdBuildClusterAccelerationStructureIndirectNV, 0x0>::pfn() },
+
+          //=== VK_NV_partitioned_acceleration_structure ===
+          { "vkGetPartitionedAccelerationStructuresBuildSizesNV", NullDriverCommand<PFN_vkGetPartitionedAccelerationStructuresBuildSizesNV, 0x4>::pfn() },
+          { "vkCmdBuildPartitionedAccelerationStructuresNV", NullDriverCommand<PFN_vkCmdBuildPartitionedAccelerationStructuresNV, 0x0>::pfn() },
+
+          //=== VK_EXT_device_generated_commands ===
+          { "vkGetGeneratedCommandsMemoryRequirementsEXT", NullDriverCommand<PFN_vkGetGeneratedCommandsMemoryRequirementsEXT, 0x4>::pfn() },
+          { "vkCmdPreprocessGeneratedCommandsEXT", NullDriverCommand<PFN_vkCmdPreprocessGeneratedCommandsEXT, 0x0>::pfn() },
+          { "vkCmdExecuteGeneratedCommandsEXT", NullDriverCommand<PFN_vkCmdExecuteGeneratedCommandsEXT, 0x0>::pfn() },
+          { "vkCreateIndirectCommandsLayoutEXT", NullDriverCommand<PFN_vkCreateIndirectCommandsLayoutEXT, 0x8>::pfn() },
+          { "vkDestroyIndirectCommandsLayoutEXT", NullDriverCommand<PFN_vkDestroyIndirectCommandsLayoutEXT, 0x0>::pfn() },
+          { "vkCreateIndirectExecutionSetEXT", NullDriverCommand<PFN_vkCreateIndirectExecutionSetEXT, 0x8>::pfn() },
+          { "vkDestroyIndirectExecutionSetEXT", NullDriverCommand<PFN_vkDestroyIndirectExecutionSetEXT, 0x0>::pfn() },
+          { "vkUpdateIndirectExecutionSetPipelineEXT", NullDriverCommand<PFN_vkUpdateIndirectExecutionSetPipelineEXT, 0x0>::pfn() },
+          { "vkUpdateIndirectExecutionSetShaderEXT", NullDriverCommand<PFN_vkUpdateIndirectExecutionSetShaderEXT, 0x0>::pfn() },
+
+          //=== VK_KHR_device_fault ===
+          { "vkGetDeviceFaultReportsKHR", NullDriverCommand<PFN_vkGetDeviceFaultReportsKHR, 0xc>::pfn() },
+          { "vkGetDeviceFaultDebugInfoKHR", NullDriverCommand<PFN_vkGetDeviceFaultDebugInfoKHR, 0x2>::pfn() },
+
+#if defined( VK_USE_PLATFORM_OHOS )
+          //=== VK_OHOS_surface ===
+          { "vkCreateSurfaceOHOS", NullDriverCommand<PFN_vkCreateSurfaceOHOS, 0x8>::pfn() },
+#endif /*VK_USE_PLATFORM_OHOS*/
+
+          //=== VK_NV_cooperative_matrix2 ===
+          { "vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV",
+            NullDriverCommand<PFN_vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV, 0x6>::pfn() },
+
+#if defined( VK_USE_PLATFORM_METAL_EXT )
+          //=== VK_EXT_external_memory_metal ===
+          { "vkGetMemoryMetalHandleEXT", NullDriverCommand<PFN_vkGetMemoryMetalHandleEXT, 0x4>::pfn() },
+          { "vkGetMemoryMetalHandlePropertiesEXT", NullDriverCommand<PFN_vkGetMemoryMetalHandlePropertiesEXT, 0x8>::pfn() },
+#endif /*VK_USE_PLATFORM_METAL_EXT*/
+
+          //=== VK_ARM_performance_counters_by_region ===
+          { "vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM",
+            NullDriverCommand<PFN_vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM, 0x1c>::pfn() },
+
+          //=== VK_ARM_shader_instrumentation ===
+          { "vkEnumeratePhysicalDeviceShaderInstrumentationMetricsARM",
+            NullDriverCommand<PFN_vkEnumeratePhysicalDeviceShaderInstrumentationMetricsARM, 0x6>::pfn() },
+          { "vkCreateShaderInstrumentationARM", NullDriverCommand<PFN_vkCreateShaderInstrumentationARM, 0x8>::pfn() },
+          { "vkDestroyShaderInstrumentationARM", NullDriverCommand<PFN_vkDestroyShaderInstrumentationARM, 0x0>::pfn() },
+          { "vkCmdBeginShaderInstrumentationARM", NullDriverCommand<PFN_vkCmdBeginShaderInstrumentationARM, 0x0>::pfn() },
+          { "vkCmdEndShaderInstrumentationARM", NullDriverCommand<PFN_vkCmdEndShaderInstrumentationARM, 0x0>::pfn() },
+          { "vkGetShaderInstrumentationValuesARM", NullDriverCommand<PFN_vkGetShaderInstrumentationValuesARM, 0xc>::pfn() },
+          { "vkClearShaderInstrumentationMetricsARM", NullDriverCommand<PFN_vkClearShaderInstrumentationMetricsARM, 0x0>::pfn() },
+
+          //=== VK_EXT_fragment_density_map_offset ===
+          { "vkCmdEndRendering2EXT", NullDriverCommand<PFN_vkCmdEndRendering2EXT, 0x0>::pfn() },
+
+          //=== VK_EXT_custom_resolve ===
+          { "vkCmdBeginCustomResolveEXT", NullDriverCommand<PFN_vkCmdBeginCustomResolveEXT, 0x0>::pfn() },
+
+          //=== VK_KHR_maintenance10 ===
+          { "vkCmdEndRendering2KHR", NullDriverCommand<PFN_vkCmdEndRendering2KHR, 0x0>::pfn() },
+
+          //=== VK_ARM_data_graph_optical_flow ===
+          { "vkGetPhysicalDeviceQueueFamilyDataGraphOpticalFlowImageFormatsARM",
+            NullDriverCommand<PFN_vkGetPhysicalDeviceQueueFamilyDataGraphOpticalFlowImageFormatsARM, 0x30>::pfn() },
+
+          //=== VK_NV_compute_occupancy_priority ===
+          { "vkCmdSetComputeOccupancyPriorityNV", NullDriverCommand<PFN_vkCmdSetComputeOccupancyPriorityNV, 0x0>::pfn() },
+
+          //=== VK_EXT_cooperative_matrix_maintenance1 ===
+          { "vkGetPhysicalDeviceCooperativeMatrixProperties2EXT", NullDriverCommand<PFN_vkGetPhysicalDeviceCooperativeMatrixProperties2EXT, 0xc>::pfn() },
+
+#if defined( VK_USE_PLATFORM_UBM_SEC )
+          //=== VK_SEC_ubm_surface ===
+          { "vkCreateUbmSurfaceSEC", NullDriverCommand<PFN_vkCreateUbmSurfaceSEC, 0x8>::pfn() },
+          { "vkGetPhysicalDeviceUbmPresentationSupportSEC", NullDriverCommand<PFN_vkGetPhysicalDeviceUbmPresentationSupportSEC, 0x0>::pfn() },
+#endif /*VK_USE_PLATFORM_UBM_SEC*/
+
+          //=== VK_EXT_primitive_restart_index ===
+          { "vkCmdSetPrimitiveRestartIndexEXT", NullDriverCommand<PFN_vkCmdSetPrimitiveRestartIndexEXT, 0x0>::pfn() },
+        };
+        std::sort( commands.begin(),
+                   commands.end(),
+                   []( NullDriverCommandEntry const & lhs, NullDriverCommandEntry const & rhs ) { return strcmp( lhs.name, rhs.name ) < 0; } );
+        return commands;
+      }();
+
+      auto it = std::lower_bound(
+        commands.begin(), commands.end(), pName, []( NullDriverCommandEntry const & command, char const * name ) { return strcmp( command.name, name ) < 0; } );
+      return ( ( it != commands.end() ) && ( strcmp( it->name, pName ) == 0 ) ) ? it->pfn : nullptr;
+    }
+
+    // A DispatchLoaderDynamic with all function pointers set to the commands of the NullDriver, for a fake instance and device.
+    class DispatchLoaderNull : public DispatchLoaderDynamic
+    {
+    public:
+      DispatchLoaderNull() VULKAN_HPP_NOEXCEPT
+        : DispatchLoaderDynamic(
+            NullDriver::nextHandle<VkInstance>(), &NullDriver::getInstanceProcAddr, NullDriver::nextHandle<VkDevice>(), &NullDriver::getDeviceProcAddr )
+      {
+      }
+    };
+  }  // namespace detail
+}  // namespace VULKAN_HPP_NAMESPACE
+#endif
@@ -0,0 +1,12 @@
+// Copyright 2015-2026 The Khronos Group Inc.
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+//
+
+// This header is generated from the Khronos Vulkan XML API Registry.
+
+// The source of the Vulkan::HppCompiled library: compiles the non-template functions of vulkan_raii.hpp once, instead of inlining them into
+// every translation unit. Everything linking against that library is compiled with VULKAN_HPP_COMPILED, which leaves just their declarations.
+
+#define VULKAN_HPP_COMPILED_DEFINITIONS 1
+
+#include <vulkan/vulkan_raii.hpp>
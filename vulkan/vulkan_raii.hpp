@@ -3527,6 +3527,12 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       // wrapper function for command vkEnumeratePhysicalDevices, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkEnumeratePhysicalDevices.html
       VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<PhysicalDevice>>::type enumeratePhysicalDevices() const;
 
+      // wrapper function for command vkEnumeratePhysicalDevices, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkEnumeratePhysicalDevices.html
+      template <typename PhysicalDeviceAllocator,
+                typename std::enable_if<std::is_same<typename PhysicalDeviceAllocator::value_type, PhysicalDevice>::value, int>::type = 0>
+      VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<PhysicalDevice, PhysicalDeviceAllocator>>::type
+        enumeratePhysicalDevices( PhysicalDeviceAllocator const & physicalDeviceAllocator ) const;
+
       // wrapper function for command vkGetInstanceProcAddr, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetInstanceProcAddr.html
       VULKAN_HPP_NODISCARD PFN_VoidFunction getProcAddr( std::string const & name ) const VULKAN_HPP_NOEXCEPT;
 
@@ -4005,6 +4011,12 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDisplayPlaneSupportedDisplaysKHR.html
       VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<DisplayKHR>>::type getDisplayPlaneSupportedDisplaysKHR( uint32_t planeIndex ) const;
 
+      // wrapper function for command vkGetDisplayPlaneSupportedDisplaysKHR, see
+      // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDisplayPlaneSupportedDisplaysKHR.html
+      template <typename DisplayKHRAllocator, typename std::enable_if<std::is_same<typename DisplayKHRAllocator::value_type, DisplayKHR>::value, int>::type = 0>
+      VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<DisplayKHR, DisplayKHRAllocator>>::type
+        getDisplayPlaneSupportedDisplaysKHR( uint32_t planeIndex, DisplayKHRAllocator const & displayKHRAllocator ) const;
+
 #  if defined( VK_USE_PLATFORM_XLIB_KHR )
       //=== VK_KHR_xlib_surface ===
 
@@ -4634,6 +4646,12 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<CommandBuffer>>::type
         allocateCommandBuffers( CommandBufferAllocateInfo const & allocateInfo ) const;
 
+      // wrapper function for command vkAllocateCommandBuffers, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkAllocateCommandBuffers.html
+      template <typename CommandBufferAllocator,
+                typename std::enable_if<std::is_same<typename CommandBufferAllocator::value_type, CommandBuffer>::value, int>::type = 0>
+      VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<CommandBuffer, CommandBufferAllocator>>::type
+        allocateCommandBuffers( CommandBufferAllocateInfo const & allocateInfo, CommandBufferAllocator const & commandBufferAllocator ) const;
+
       // wrapper function for command vkCreateEvent, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateEvent.html
       VULKAN_HPP_NODISCARD typename ResultValueType<Event>::type
         createEvent( EventCreateInfo const & createInfo, Optional<AllocationCallbacks const> allocator = nullptr ) const VULKAN_HPP_NOEXCEPT_WHEN_NO_EXCEPTIONS;
@@ -4659,6 +4677,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                 ArrayProxy<ComputePipelineCreateInfo> const & createInfos,
                                 Optional<AllocationCallbacks const>           allocator = nullptr ) const;
 
+      // wrapper function for command vkCreateComputePipelines, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateComputePipelines.html
+      template <typename PipelineAllocator, typename std::enable_if<std::is_same<typename PipelineAllocator::value_type, Pipeline>::value, int>::type = 0>
+      VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<Pipeline, PipelineAllocator>>::type
+        createComputePipelines( Optional<PipelineCache const> const &         pipelineCache,
+                                ArrayProxy<ComputePipelineCreateInfo> const & createInfos,
+                                Optional<AllocationCallbacks const>           allocator,
+                                PipelineAllocator const &                     pipelineAllocator ) const;
+
       // wrapper function for command vkCreateComputePipelines, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateComputePipelines.html
       VULKAN_HPP_NODISCARD typename ResultValueType<Pipeline>::type
         createComputePipeline( Optional<PipelineCache const> const & pipelineCache,
@@ -4690,6 +4716,12 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<DescriptorSet>>::type
         allocateDescriptorSets( DescriptorSetAllocateInfo const & allocateInfo ) const;
 
+      // wrapper function for command vkAllocateDescriptorSets, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkAllocateDescriptorSets.html
+      template <typename DescriptorSetAllocator,
+                typename std::enable_if<std::is_same<typename DescriptorSetAllocator::value_type, DescriptorSet>::value, int>::type = 0>
+      VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<DescriptorSet, DescriptorSetAllocator>>::type
+        allocateDescriptorSets( DescriptorSetAllocateInfo const & allocateInfo, DescriptorSetAllocator const & descriptorSetAllocator ) const;
+
       // wrapper function for command vkUpdateDescriptorSets, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkUpdateDescriptorSets.html
       void updateDescriptorSets( ArrayProxy<WriteDescriptorSet const> const & descriptorWrites,
                                  ArrayProxy<CopyDescriptorSet const> const &  descriptorCopies ) const VULKAN_HPP_NOEXCEPT;
@@ -4700,6 +4732,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                  ArrayProxy<GraphicsPipelineCreateInfo> const & createInfos,
                                  Optional<AllocationCallbacks const>            allocator = nullptr ) const;
 
+      // wrapper function for command vkCreateGraphicsPipelines, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateGraphicsPipelines.html
+      template <typename PipelineAllocator, typename std::enable_if<std::is_same<typename PipelineAllocator::value_type, Pipeline>::value, int>::type = 0>
+      VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<Pipeline, PipelineAllocator>>::type
+        createGraphicsPipelines( Optional<PipelineCache const> const &          pipelineCache,
+                                 ArrayProxy<GraphicsPipelineCreateInfo> const & createInfos,
+                                 Optional<AllocationCallbacks const>            allocator,
+                                 PipelineAllocator const &                      pipelineAllocator ) const;
+
       // wrapper function for command vkCreateGraphicsPipelines, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateGraphicsPipelines.html
       VULKAN_HPP_NODISCARD typename ResultValueType<Pipeline>::type
         createGraphicsPipeline( Optional<PipelineCache const> const & pipelineCache,
@@ -4900,6 +4940,15 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<SwapchainKHR>>::type
         createSharedSwapchainsKHR( ArrayProxy<SwapchainCreateInfoKHR> const & createInfos, Optional<AllocationCallbacks const> allocator = nullptr ) const;
 
+      // wrapper function for command vkCreateSharedSwapchainsKHR, see
+      // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateSharedSwapchainsKHR.html
+      template <typename SwapchainKHRAllocator,
+                typename std::enable_if<std::is_same<typename SwapchainKHRAllocator::value_type, SwapchainKHR>::value, int>::type = 0>
+      VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<SwapchainKHR, SwapchainKHRAllocator>>::type
+        createSharedSwapchainsKHR( ArrayProxy<SwapchainCreateInfoKHR> const & createInfos,
+                                   Optional<AllocationCallbacks const>        allocator,
+                                   SwapchainKHRAllocator const &              swapchainKHRAllocator ) const;
+
       // wrapper function for command vkCreateSharedSwapchainsKHR, see
       // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateSharedSwapchainsKHR.html
       VULKAN_HPP_NODISCARD typename ResultValueType<SwapchainKHR>::type
@@ -5136,6 +5185,15 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                            ArrayProxy<ExecutionGraphPipelineCreateInfoAMDX> const & createInfos,
                                            Optional<AllocationCallbacks const>                      allocator = nullptr ) const;
 
+      // wrapper function for command vkCreateExecutionGraphPipelinesAMDX, see
+      // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateExecutionGraphPipelinesAMDX.html
+      template <typename PipelineAllocator, typename std::enable_if<std::is_same<typename PipelineAllocator::value_type, Pipeline>::value, int>::type = 0>
+      VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<Pipeline, PipelineAllocator>>::type
+        createExecutionGraphPipelinesAMDX( Optional<PipelineCache const> const &                    pipelineCache,
+                                           ArrayProxy<ExecutionGraphPipelineCreateInfoAMDX> const & createInfos,
+                                           Optional<AllocationCallbacks const>                      allocator,
+                                           PipelineAllocator const &                                pipelineAllocator ) const;
+
       // wrapper function for command vkCreateExecutionGraphPipelinesAMDX, see
       // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateExecutionGraphPipelinesAMDX.html
       VULKAN_HPP_NODISCARD typename ResultValueType<Pipeline>::type
@@ -5282,6 +5340,16 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                       ArrayProxy<RayTracingPipelineCreateInfoKHR> const & createInfos,
                                       Optional<AllocationCallbacks const>                 allocator = nullptr ) const;
 
+      // wrapper function for command vkCreateRayTracingPipelinesKHR, see
+      // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateRayTracingPipelinesKHR.html
+      template <typename PipelineAllocator, typename std::enable_if<std::is_same<typename PipelineAllocator::value_type, Pipeline>::value, int>::type = 0>
+      VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<Pipeline, PipelineAllocator>>::type
+        createRayTracingPipelinesKHR( Optional<DeferredOperationKHR const> const &        deferredOperation,
+                                      Optional<PipelineCache const> const &               pipelineCache,
+                                      ArrayProxy<RayTracingPipelineCreateInfoKHR> const & createInfos,
+                                      Optional<AllocationCallbacks const>                 allocator,
+                                      PipelineAllocator const &                           pipelineAllocator ) const;
+
       // wrapper function for command vkCreateRayTracingPipelinesKHR, see
       // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateRayTracingPipelinesKHR.html
       VULKAN_HPP_NODISCARD typename ResultValueType<Pipeline>::type
@@ -5348,6 +5416,15 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                      ArrayProxy<RayTracingPipelineCreateInfoNV> const & createInfos,
                                      Optional<AllocationCallbacks const>                allocator = nullptr ) const;
 
+      // wrapper function for command vkCreateRayTracingPipelinesNV, see
+      // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateRayTracingPipelinesNV.html
+      template <typename PipelineAllocator, typename std::enable_if<std::is_same<typename PipelineAllocator::value_type, Pipeline>::value, int>::type = 0>
+      VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<Pipeline, PipelineAllocator>>::type
+        createRayTracingPipelinesNV( Optional<PipelineCache const> const &              pipelineCache,
+                                     ArrayProxy<RayTracingPipelineCreateInfoNV> const & createInfos,
+                                     Optional<AllocationCallbacks const>                allocator,
+                                     PipelineAllocator const &                          pipelineAllocator ) const;
+
       // wrapper function for command vkCreateRayTracingPipelinesNV, see
       // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateRayTracingPipelinesNV.html
       VULKAN_HPP_NODISCARD typename ResultValueType<Pipeline>::type
@@ -5911,6 +5988,13 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<ShaderEXT>>::type
         createShadersEXT( ArrayProxy<ShaderCreateInfoEXT> const & createInfos, Optional<AllocationCallbacks const> allocator = nullptr ) const;
 
+      // wrapper function for command vkCreateShadersEXT, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateShadersEXT.html
+      template <typename ShaderEXTAllocator, typename std::enable_if<std::is_same<typename ShaderEXTAllocator::value_type, ShaderEXT>::value, int>::type = 0>
+      VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<ShaderEXT, ShaderEXTAllocator>>::type
+        createShadersEXT( ArrayProxy<ShaderCreateInfoEXT> const & createInfos,
+                          Optional<AllocationCallbacks const>     allocator,
+                          ShaderEXTAllocator const &              shaderEXTAllocator ) const;
+
       // wrapper function for command vkCreateShadersEXT, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateShadersEXT.html
       VULKAN_HPP_NODISCARD typename ResultValueType<ShaderEXT>::type
         createShaderEXT( ShaderCreateInfoEXT const &         createInfo,
@@ -5966,6 +6050,16 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                      ArrayProxy<DataGraphPipelineCreateInfoARM> const & createInfos,
                                      Optional<AllocationCallbacks const>                allocator = nullptr ) const;
 
+      // wrapper function for command vkCreateDataGraphPipelinesARM, see
+      // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateDataGraphPipelinesARM.html
+      template <typename PipelineAllocator, typename std::enable_if<std::is_same<typename PipelineAllocator::value_type, Pipeline>::value, int>::type = 0>
+      VULKAN_HPP_NODISCARD typename ResultValueType<std::vector<Pipeline, PipelineAllocator>>::type
+        createDataGraphPipelinesARM( Optional<DeferredOperationKHR const> const &       deferredOperation,
+                                     Optional<PipelineCache const> const &              pipelineCache,
+                                     ArrayProxy<DataGraphPipelineCreateInfoARM> const & createInfos,
+                                     Optional<AllocationCallbacks const>                allocator,
+                                     PipelineAllocator const &                          pipelineAllocator ) const;
+
       // wrapper function for command vkCreateDataGraphPipelinesARM, see
       // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateDataGraphPipelinesARM.html
       VULKAN_HPP_NODISCARD typename ResultValueType<Pipeline>::type
@@ -13509,6 +13603,22 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NODISCARD ResultValue<DataType>
         getResult( uint32_t firstQuery, uint32_t queryCount, DeviceSize stride, QueryResultFlags flags VULKAN_HPP_DEFAULT_ASSIGNMENT( {} ) ) const;
 
+      // wrapper function for command vkGetQueryPoolResults, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueryPoolResults.html
+      template <typename DataType>
+      VULKAN_HPP_NODISCARD ResultValue<QueryResultView<DataType>>
+        getResults( uint32_t                                  firstQuery,
+                    uint32_t                                  queryCount,
+                    ArrayProxyNoTemporaries<uint32_t> const & data,
+                    QueryResultFlags flags                    VULKAN_HPP_DEFAULT_ASSIGNMENT( {} ) ) const;
+
+      // wrapper function for command vkGetQueryPoolResults, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueryPoolResults.html
+      template <typename DataType>
+      VULKAN_HPP_NODISCARD ResultValue<QueryResultView<DataType>>
+        getResults( uint32_t                                  firstQuery,
+                    uint32_t                                  queryCount,
+                    ArrayProxyNoTemporaries<uint64_t> const & data,
+                    QueryResultFlags flags                    VULKAN_HPP_DEFAULT_ASSIGNMENT( {} ) ) const;
+
       //=== VK_VERSION_1_2 ===
 
       // wrapper function for command vkResetQueryPool, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkResetQueryPool.html
@@ -15930,6 +16040,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     //=== COMMAND Definitions ===
     //===========================
 
+#  if !defined( VULKAN_HPP_COMPILED ) || defined( VULKAN_HPP_COMPILED_DEFINITIONS )
+    // with VULKAN_HPP_COMPILED, the non-template functions are not defined here, but compiled once into a library (see vulkan_raii.cpp)
+#    if defined( VULKAN_HPP_COMPILED_DEFINITIONS )
+#      pragma push_macro( "VULKAN_HPP_INLINE" )
+#      undef VULKAN_HPP_INLINE
+#      define VULKAN_HPP_INLINE
+#    endif
+
     //=== VK_VERSION_1_0 ===
 
     // wrapper function for command vkCreateInstance, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateInstance.html
@@ -16517,7 +16635,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_ASSERT( getDispatcher()->vkGetFenceStatus && "Function <vkGetFenceStatus> requires <VK_VERSION_1_0>" );
 
       Result result = static_cast<Result>( getDispatcher()->vkGetFenceStatus( static_cast<VkDevice>( m_device ), static_cast<VkFence>( m_fence ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Fence::getStatus", { Result::eSuccess, Result::eNotReady } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eNotReady>( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Fence::getStatus" );
 
       return static_cast<Result>( result );
     }
@@ -16531,7 +16649,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       Result result = static_cast<Result>( getDispatcher()->vkWaitForFences(
         static_cast<VkDevice>( m_device ), fences.size(), reinterpret_cast<VkFence const *>( fences.data() ), static_cast<VkBool32>( waitAll ), timeout ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::waitForFences", { Result::eSuccess, Result::eTimeout } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eTimeout>( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::waitForFences" );
 
       return static_cast<Result>( result );
     }
@@ -16583,49 +16701,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                           static_cast<VkQueryResultFlags>( flags ) ) );
     }
 
-    // wrapper function for command vkGetQueryPoolResults, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueryPoolResults.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE ResultValue<std::vector<DataType>>
-      QueryPool::getResults( uint32_t firstQuery, uint32_t queryCount, size_t dataSize, DeviceSize stride, QueryResultFlags flags ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetQueryPoolResults && "Function <vkGetQueryPoolResults> requires <VK_VERSION_1_0>" );
-
-      VULKAN_HPP_ASSERT( dataSize % sizeof( DataType ) == 0 );
-      std::vector<DataType> data( dataSize / sizeof( DataType ) );
-      Result                result = static_cast<Result>( getDispatcher()->vkGetQueryPoolResults( static_cast<VkDevice>( m_device ),
-                                                                                                  static_cast<VkQueryPool>( m_queryPool ),
-                                                                                                  firstQuery,
-                                                                                                  queryCount,
-                                                                                                  data.size() * sizeof( DataType ),
-                                                                                                  reinterpret_cast<void *>( data.data() ),
-                                                                                                  static_cast<VkDeviceSize>( stride ),
-                                                                                                  static_cast<VkQueryResultFlags>( flags ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::QueryPool::getResults", { Result::eSuccess, Result::eNotReady } );
-
-      return { result, data };
-    }
-
-    // wrapper function for command vkGetQueryPoolResults, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueryPoolResults.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE ResultValue<DataType>
-                                           QueryPool::getResult( uint32_t firstQuery, uint32_t queryCount, DeviceSize stride, QueryResultFlags flags ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetQueryPoolResults && "Function <vkGetQueryPoolResults> requires <VK_VERSION_1_0>" );
-
-      DataType data;
-      Result   result = static_cast<Result>( getDispatcher()->vkGetQueryPoolResults( static_cast<VkDevice>( m_device ),
-                                                                                     static_cast<VkQueryPool>( m_queryPool ),
-                                                                                     firstQuery,
-                                                                                     queryCount,
-                                                                                     sizeof( DataType ),
-                                                                                     reinterpret_cast<void *>( &data ),
-                                                                                     static_cast<VkDeviceSize>( stride ),
-                                                                                     static_cast<VkQueryResultFlags>( flags ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::QueryPool::getResult", { Result::eSuccess, Result::eNotReady } );
-
-      return { result, data };
-    }
-
     // wrapper function for command vkCreateBuffer, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateBuffer.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<Buffer>::type
       Device::createBuffer( BufferCreateInfo const & createInfo, Optional<AllocationCallbacks const> allocator ) const VULKAN_HPP_NOEXCEPT_WHEN_NO_EXCEPTIONS
@@ -16851,21 +16926,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                           pData );
     }
 
-    // wrapper function for command vkCmdUpdateBuffer, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdUpdateBuffer.html
-    template <typename DataType>
-    VULKAN_HPP_INLINE void CommandBuffer::updateBuffer( VULKAN_HPP_NAMESPACE::Buffer       dstBuffer,
-                                                        DeviceSize                         dstOffset,
-                                                        ArrayProxy<DataType const> const & data ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkCmdUpdateBuffer && "Function <vkCmdUpdateBuffer> requires <VK_VERSION_1_0>" );
-
-      getDispatcher()->vkCmdUpdateBuffer( static_cast<VkCommandBuffer>( m_commandBuffer ),
-                                          static_cast<VkBuffer>( dstBuffer ),
-                                          static_cast<VkDeviceSize>( dstOffset ),
-                                          data.size() * sizeof( DataType ),
-                                          reinterpret_cast<void const *>( data.data() ) );
-    }
-
     // wrapper function for command vkCmdFillBuffer, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdFillBuffer.html
     VULKAN_HPP_INLINE void
       CommandBuffer::fillBuffer( VULKAN_HPP_NAMESPACE::Buffer dstBuffer, DeviceSize dstOffset, DeviceSize size, uint32_t data ) const VULKAN_HPP_NOEXCEPT
@@ -16990,7 +17050,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_ASSERT( getDispatcher()->vkGetEventStatus && "Function <vkGetEventStatus> requires <VK_VERSION_1_0>" );
 
       Result result = static_cast<Result>( getDispatcher()->vkGetEventStatus( static_cast<VkDevice>( m_device ), static_cast<VkEvent>( m_event ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Event::getStatus", { Result::eEventSet, Result::eEventReset } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eEventSet, Result::eEventReset>( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Event::getStatus" );
 
       return static_cast<Result>( result );
     }
@@ -17125,8 +17185,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                         reinterpret_cast<VkComputePipelineCreateInfo const *>( createInfos.data() ),
                                                                         reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                         reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createComputePipelines", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createComputePipelines" );
       std::vector<Pipeline> pipelinesRAII;
       if ( result == Result::eSuccess )
       {
@@ -17154,8 +17214,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                       reinterpret_cast<VkComputePipelineCreateInfo const *>( &createInfo ),
                                                                                       reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                                       reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createComputePipeline", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createComputePipeline" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, Pipeline( *this, *reinterpret_cast<VkPipeline *>( &pipeline ), allocator, result ) );
     }
 
@@ -17390,23 +17450,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                            pValues );
     }
 
-    // wrapper function for command vkCmdPushConstants, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdPushConstants.html
-    template <typename ValuesType>
-    VULKAN_HPP_INLINE void CommandBuffer::pushConstants( VULKAN_HPP_NAMESPACE::PipelineLayout layout,
-                                                         ShaderStageFlags                     stageFlags,
-                                                         uint32_t                             offset,
-                                                         ArrayProxy<ValuesType const> const & values ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkCmdPushConstants && "Function <vkCmdPushConstants> requires <VK_VERSION_1_0>" );
-
-      getDispatcher()->vkCmdPushConstants( static_cast<VkCommandBuffer>( m_commandBuffer ),
-                                           static_cast<VkPipelineLayout>( layout ),
-                                           static_cast<VkShaderStageFlags>( stageFlags ),
-                                           offset,
-                                           values.size() * sizeof( ValuesType ),
-                                           reinterpret_cast<void const *>( values.data() ) );
-    }
-
     // wrapper function for command vkCreateGraphicsPipelines, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateGraphicsPipelines.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<Pipeline>>::type
                          Device::createGraphicsPipelines( Optional<PipelineCache const> const &          pipelineCache,
@@ -17423,8 +17466,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                          reinterpret_cast<VkGraphicsPipelineCreateInfo const *>( createInfos.data() ),
                                                                          reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                          reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createGraphicsPipelines", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createGraphicsPipelines" );
       std::vector<Pipeline> pipelinesRAII;
       if ( result == Result::eSuccess )
       {
@@ -17452,8 +17495,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                        reinterpret_cast<VkGraphicsPipelineCreateInfo const *>( &createInfo ),
                                                                                        reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                                        reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createGraphicsPipeline", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createGraphicsPipeline" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, Pipeline( *this, *reinterpret_cast<VkPipeline *>( &pipeline ), allocator, result ) );
     }
 
@@ -17594,14 +17637,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                              ArrayProxy<DeviceSize const> const &                   offsets ) const
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkCmdBindVertexBuffers && "Function <vkCmdBindVertexBuffers> requires <VK_VERSION_1_0>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( buffers.size() == offsets.size() );
-#  else
+#    else
       if ( buffers.size() != offsets.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::bindVertexBuffers: buffers.size() != offsets.size()" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       getDispatcher()->vkCmdBindVertexBuffers( static_cast<VkCommandBuffer>( m_commandBuffer ),
                                                firstBinding,
@@ -17857,24 +17900,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryRequirements;
     }
 
-    // wrapper function for command vkGetImageMemoryRequirements2, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageMemoryRequirements2.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-                                           Device::getImageMemoryRequirements2( ImageMemoryRequirementsInfo2 const & info ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetImageMemoryRequirements2 &&
-                         "Function <vkGetImageMemoryRequirements2> requires <VK_KHR_get_memory_requirements2> or <VK_VERSION_1_1>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
-      getDispatcher()->vkGetImageMemoryRequirements2( static_cast<VkDevice>( m_device ),
-                                                      reinterpret_cast<VkImageMemoryRequirementsInfo2 const *>( &info ),
-                                                      reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetBufferMemoryRequirements2, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetBufferMemoryRequirements2.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE MemoryRequirements2
@@ -17891,24 +17916,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryRequirements;
     }
 
-    // wrapper function for command vkGetBufferMemoryRequirements2, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetBufferMemoryRequirements2.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-                                           Device::getBufferMemoryRequirements2( BufferMemoryRequirementsInfo2 const & info ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetBufferMemoryRequirements2 &&
-                         "Function <vkGetBufferMemoryRequirements2> requires <VK_KHR_get_memory_requirements2> or <VK_VERSION_1_1>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
-      getDispatcher()->vkGetBufferMemoryRequirements2( static_cast<VkDevice>( m_device ),
-                                                       reinterpret_cast<VkBufferMemoryRequirementsInfo2 const *>( &info ),
-                                                       reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetImageSparseMemoryRequirements2, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageSparseMemoryRequirements2.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::vector<SparseImageMemoryRequirements2>
@@ -17949,22 +17956,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return features;
     }
 
-    // wrapper function for command vkGetPhysicalDeviceFeatures2, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceFeatures2.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...> PhysicalDevice::getFeatures2() const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceFeatures2 &&
-                         "Function <vkGetPhysicalDeviceFeatures2> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      PhysicalDeviceFeatures2 &  features = structureChain.template get<PhysicalDeviceFeatures2>();
-      getDispatcher()->vkGetPhysicalDeviceFeatures2( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                     reinterpret_cast<VkPhysicalDeviceFeatures2 *>( &features ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetPhysicalDeviceProperties2, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceProperties2.html
     VULKAN_HPP_INLINE void PhysicalDevice::getProperties2( PhysicalDeviceProperties2 * pProperties ) const VULKAN_HPP_NOEXCEPT
@@ -17989,22 +17980,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return properties;
     }
 
-    // wrapper function for command vkGetPhysicalDeviceProperties2, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceProperties2.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...> PhysicalDevice::getProperties2() const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceProperties2 &&
-                         "Function <vkGetPhysicalDeviceProperties2> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
-
-      StructureChain<X, Y, Z...>  structureChain;
-      PhysicalDeviceProperties2 & properties = structureChain.template get<PhysicalDeviceProperties2>();
-      getDispatcher()->vkGetPhysicalDeviceProperties2( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                       reinterpret_cast<VkPhysicalDeviceProperties2 *>( &properties ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetPhysicalDeviceFormatProperties2, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceFormatProperties2.html
     VULKAN_HPP_INLINE void PhysicalDevice::getFormatProperties2( Format format, FormatProperties2 * pFormatProperties ) const VULKAN_HPP_NOEXCEPT
@@ -18029,22 +18004,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return formatProperties;
     }
 
-    // wrapper function for command vkGetPhysicalDeviceFormatProperties2, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceFormatProperties2.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...> PhysicalDevice::getFormatProperties2( Format format ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceFormatProperties2 &&
-                         "Function <vkGetPhysicalDeviceFormatProperties2> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      FormatProperties2 &        formatProperties = structureChain.template get<FormatProperties2>();
-      getDispatcher()->vkGetPhysicalDeviceFormatProperties2(
-        static_cast<VkPhysicalDevice>( m_physicalDevice ), static_cast<VkFormat>( format ), reinterpret_cast<VkFormatProperties2 *>( &formatProperties ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetPhysicalDeviceImageFormatProperties2, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceImageFormatProperties2.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<ImageFormatProperties2>::type
@@ -18063,26 +18022,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( imageFormatProperties ) );
     }
 
-    // wrapper function for command vkGetPhysicalDeviceImageFormatProperties2, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceImageFormatProperties2.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<StructureChain<X, Y, Z...>>::type
-                         PhysicalDevice::getImageFormatProperties2( PhysicalDeviceImageFormatInfo2 const & imageFormatInfo ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceImageFormatProperties2 &&
-                         "Function <vkGetPhysicalDeviceImageFormatProperties2> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      ImageFormatProperties2 &   imageFormatProperties = structureChain.template get<ImageFormatProperties2>();
-      Result                     result                = static_cast<Result>(
-        getDispatcher()->vkGetPhysicalDeviceImageFormatProperties2( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                                    reinterpret_cast<VkPhysicalDeviceImageFormatInfo2 const *>( &imageFormatInfo ),
-                                                                    reinterpret_cast<VkImageFormatProperties2 *>( &imageFormatProperties ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getImageFormatProperties2" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChain ) );
-    }
-
     // wrapper function for command vkGetPhysicalDeviceQueueFamilyProperties2, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceQueueFamilyProperties2.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::vector<QueueFamilyProperties2> PhysicalDevice::getQueueFamilyProperties2() const
@@ -18106,46 +18045,12 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return queueFamilyProperties;
     }
 
-    // wrapper function for command vkGetPhysicalDeviceQueueFamilyProperties2, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceQueueFamilyProperties2.html
-    template <typename StructureChain>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::vector<StructureChain> PhysicalDevice::getQueueFamilyProperties2() const
+    // wrapper function for command vkGetPhysicalDeviceMemoryProperties2, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceMemoryProperties2.html
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE PhysicalDeviceMemoryProperties2 PhysicalDevice::getMemoryProperties2() const VULKAN_HPP_NOEXCEPT
     {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceQueueFamilyProperties2 &&
-                         "Function <vkGetPhysicalDeviceQueueFamilyProperties2> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
-
-      std::vector<StructureChain>         structureChains;
-      std::vector<QueueFamilyProperties2> queueFamilyProperties;
-      uint32_t                            queueFamilyPropertyCount;
-      getDispatcher()->vkGetPhysicalDeviceQueueFamilyProperties2( static_cast<VkPhysicalDevice>( m_physicalDevice ), &queueFamilyPropertyCount, nullptr );
-      structureChains.resize( queueFamilyPropertyCount );
-      queueFamilyProperties.resize( queueFamilyPropertyCount );
-      for ( uint32_t i = 0; i < queueFamilyPropertyCount; i++ )
-      {
-        queueFamilyProperties[i].pNext = structureChains[i].template get<QueueFamilyProperties2>().pNext;
-      }
-      getDispatcher()->vkGetPhysicalDeviceQueueFamilyProperties2( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                                  &queueFamilyPropertyCount,
-                                                                  reinterpret_cast<VkQueueFamilyProperties2 *>( queueFamilyProperties.data() ) );
-
-      VULKAN_HPP_ASSERT( queueFamilyPropertyCount <= queueFamilyProperties.size() );
-      if ( queueFamilyPropertyCount < queueFamilyProperties.size() )
-      {
-        structureChains.resize( queueFamilyPropertyCount );
-      }
-      for ( uint32_t i = 0; i < queueFamilyPropertyCount; i++ )
-      {
-        structureChains[i].template get<QueueFamilyProperties2>() = queueFamilyProperties[i];
-      }
-      return structureChains;
-    }
-
-    // wrapper function for command vkGetPhysicalDeviceMemoryProperties2, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceMemoryProperties2.html
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE PhysicalDeviceMemoryProperties2 PhysicalDevice::getMemoryProperties2() const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceMemoryProperties2 &&
-                         "Function <vkGetPhysicalDeviceMemoryProperties2> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceMemoryProperties2 &&
+                         "Function <vkGetPhysicalDeviceMemoryProperties2> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
 
       PhysicalDeviceMemoryProperties2 memoryProperties;
       getDispatcher()->vkGetPhysicalDeviceMemoryProperties2( static_cast<VkPhysicalDevice>( m_physicalDevice ),
@@ -18154,22 +18059,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryProperties;
     }
 
-    // wrapper function for command vkGetPhysicalDeviceMemoryProperties2, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceMemoryProperties2.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...> PhysicalDevice::getMemoryProperties2() const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceMemoryProperties2 &&
-                         "Function <vkGetPhysicalDeviceMemoryProperties2> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
-
-      StructureChain<X, Y, Z...>        structureChain;
-      PhysicalDeviceMemoryProperties2 & memoryProperties = structureChain.template get<PhysicalDeviceMemoryProperties2>();
-      getDispatcher()->vkGetPhysicalDeviceMemoryProperties2( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                             reinterpret_cast<VkPhysicalDeviceMemoryProperties2 *>( &memoryProperties ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetPhysicalDeviceSparseImageFormatProperties2, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceSparseImageFormatProperties2.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::vector<SparseImageFormatProperties2>
@@ -18302,21 +18191,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         result, DescriptorUpdateTemplate( *this, *reinterpret_cast<VkDescriptorUpdateTemplate *>( &descriptorUpdateTemplate ), allocator ) );
     }
 
-    // wrapper function for command vkUpdateDescriptorSetWithTemplate, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkUpdateDescriptorSetWithTemplate.html
-    template <typename DataType>
-    VULKAN_HPP_INLINE void DescriptorSet::updateWithTemplate( VULKAN_HPP_NAMESPACE::DescriptorUpdateTemplate descriptorUpdateTemplate,
-                                                              DataType const &                               data ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkUpdateDescriptorSetWithTemplate &&
-                         "Function <vkUpdateDescriptorSetWithTemplate> requires <VK_KHR_descriptor_update_template> or <VK_VERSION_1_1>" );
-
-      getDispatcher()->vkUpdateDescriptorSetWithTemplate( static_cast<VkDevice>( m_device ),
-                                                          static_cast<VkDescriptorSet>( m_descriptorSet ),
-                                                          static_cast<VkDescriptorUpdateTemplate>( descriptorUpdateTemplate ),
-                                                          reinterpret_cast<void const *>( &data ) );
-    }
-
     // wrapper function for command vkGetDescriptorSetLayoutSupport, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDescriptorSetLayoutSupport.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE DescriptorSetLayoutSupport
@@ -18333,24 +18207,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return support;
     }
 
-    // wrapper function for command vkGetDescriptorSetLayoutSupport, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDescriptorSetLayoutSupport.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-                                           Device::getDescriptorSetLayoutSupport( DescriptorSetLayoutCreateInfo const & createInfo ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDescriptorSetLayoutSupport &&
-                         "Function <vkGetDescriptorSetLayoutSupport> requires <VK_KHR_maintenance3> or <VK_VERSION_1_1>" );
-
-      StructureChain<X, Y, Z...>   structureChain;
-      DescriptorSetLayoutSupport & support = structureChain.template get<DescriptorSetLayoutSupport>();
-      getDispatcher()->vkGetDescriptorSetLayoutSupport( static_cast<VkDevice>( m_device ),
-                                                        reinterpret_cast<VkDescriptorSetLayoutCreateInfo const *>( &createInfo ),
-                                                        reinterpret_cast<VkDescriptorSetLayoutSupport *>( &support ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkCreateSamplerYcbcrConversion, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateSamplerYcbcrConversion.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<SamplerYcbcrConversion>::type
@@ -18402,7 +18258,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       Result result = static_cast<Result>(
         getDispatcher()->vkWaitSemaphores( static_cast<VkDevice>( m_device ), reinterpret_cast<VkSemaphoreWaitInfo const *>( &waitInfo ), timeout ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::waitSemaphores", { Result::eSuccess, Result::eTimeout } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eTimeout>( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::waitSemaphores" );
 
       return static_cast<Result>( result );
     }
@@ -18705,24 +18561,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryRequirements;
     }
 
-    // wrapper function for command vkGetDeviceBufferMemoryRequirements, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceBufferMemoryRequirements.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-                                           Device::getBufferMemoryRequirements( DeviceBufferMemoryRequirements const & info ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDeviceBufferMemoryRequirements &&
-                         "Function <vkGetDeviceBufferMemoryRequirements> requires <VK_KHR_maintenance4> or <VK_VERSION_1_3>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
-      getDispatcher()->vkGetDeviceBufferMemoryRequirements( static_cast<VkDevice>( m_device ),
-                                                            reinterpret_cast<VkDeviceBufferMemoryRequirements const *>( &info ),
-                                                            reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetDeviceImageMemoryRequirements, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceImageMemoryRequirements.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE MemoryRequirements2
@@ -18739,24 +18577,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryRequirements;
     }
 
-    // wrapper function for command vkGetDeviceImageMemoryRequirements, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceImageMemoryRequirements.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-                                           Device::getImageMemoryRequirements( DeviceImageMemoryRequirements const & info ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDeviceImageMemoryRequirements &&
-                         "Function <vkGetDeviceImageMemoryRequirements> requires <VK_KHR_maintenance4> or <VK_VERSION_1_3>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
-      getDispatcher()->vkGetDeviceImageMemoryRequirements( static_cast<VkDevice>( m_device ),
-                                                           reinterpret_cast<VkDeviceImageMemoryRequirements const *>( &info ),
-                                                           reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetDeviceImageSparseMemoryRequirements, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceImageSparseMemoryRequirements.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::vector<SparseImageMemoryRequirements2>
@@ -18806,14 +18626,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                        ArrayProxy<DependencyInfo const> const &              dependencyInfos ) const
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkCmdWaitEvents2 && "Function <vkCmdWaitEvents2> requires <VK_KHR_synchronization2> or <VK_VERSION_1_3>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( events.size() == dependencyInfos.size() );
-#  else
+#    else
       if ( events.size() != dependencyInfos.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::waitEvents2: events.size() != dependencyInfos.size()" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       getDispatcher()->vkCmdWaitEvents2( static_cast<VkCommandBuffer>( m_commandBuffer ),
                                          events.size(),
@@ -18910,11 +18730,11 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkCmdBindVertexBuffers2 &&
                          "Function <vkCmdBindVertexBuffers2> requires <VK_EXT_extended_dynamic_state> or <VK_EXT_shader_object> or <VK_VERSION_1_3>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( buffers.size() == offsets.size() );
       VULKAN_HPP_ASSERT( sizes.empty() || buffers.size() == sizes.size() );
       VULKAN_HPP_ASSERT( strides.empty() || buffers.size() == strides.size() );
-#  else
+#    else
       if ( buffers.size() != offsets.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::bindVertexBuffers2: buffers.size() != offsets.size()" );
@@ -18927,7 +18747,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::bindVertexBuffers2: buffers.size() != strides.size()" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       getDispatcher()->vkCmdBindVertexBuffers2( static_cast<VkCommandBuffer>( m_commandBuffer ),
                                                 firstBinding,
@@ -19071,24 +18891,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return layout;
     }
 
-    // wrapper function for command vkGetDeviceImageSubresourceLayout, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceImageSubresourceLayout.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-                                           Device::getImageSubresourceLayout( DeviceImageSubresourceInfo const & info ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDeviceImageSubresourceLayout &&
-                         "Function <vkGetDeviceImageSubresourceLayout> requires <VK_KHR_maintenance5> or <VK_VERSION_1_4>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      SubresourceLayout2 &       layout = structureChain.template get<SubresourceLayout2>();
-      getDispatcher()->vkGetDeviceImageSubresourceLayout( static_cast<VkDevice>( m_device ),
-                                                          reinterpret_cast<VkDeviceImageSubresourceInfo const *>( &info ),
-                                                          reinterpret_cast<VkSubresourceLayout2 *>( &layout ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetImageSubresourceLayout2, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageSubresourceLayout2.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE SubresourceLayout2 Image::getSubresourceLayout2( ImageSubresource2 const & subresource ) const VULKAN_HPP_NOEXCEPT
@@ -19106,26 +18908,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return layout;
     }
 
-    // wrapper function for command vkGetImageSubresourceLayout2, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageSubresourceLayout2.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-                                           Image::getSubresourceLayout2( ImageSubresource2 const & subresource ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT(
-        getDispatcher()->vkGetImageSubresourceLayout2 &&
-        "Function <vkGetImageSubresourceLayout2> requires <VK_EXT_host_image_copy> or <VK_EXT_image_compression_control> or <VK_KHR_maintenance5> or <VK_VERSION_1_4>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      SubresourceLayout2 &       layout = structureChain.template get<SubresourceLayout2>();
-      getDispatcher()->vkGetImageSubresourceLayout2( static_cast<VkDevice>( m_device ),
-                                                     static_cast<VkImage>( m_image ),
-                                                     reinterpret_cast<VkImageSubresource2 const *>( &subresource ),
-                                                     reinterpret_cast<VkSubresourceLayout2 *>( &layout ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkCopyMemoryToImage, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCopyMemoryToImage.html
     VULKAN_HPP_INLINE typename ResultValueType<void>::type Device::copyMemoryToImage( CopyMemoryToImageInfo const & copyMemoryToImageInfo ) const
     {
@@ -19192,25 +18974,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                reinterpret_cast<VkWriteDescriptorSet const *>( descriptorWrites.data() ) );
     }
 
-    // wrapper function for command vkCmdPushDescriptorSetWithTemplate, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdPushDescriptorSetWithTemplate.html
-    template <typename DataType>
-    VULKAN_HPP_INLINE void CommandBuffer::pushDescriptorSetWithTemplate( VULKAN_HPP_NAMESPACE::DescriptorUpdateTemplate descriptorUpdateTemplate,
-                                                                         VULKAN_HPP_NAMESPACE::PipelineLayout           layout,
-                                                                         uint32_t                                       set,
-                                                                         DataType const &                               data ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT(
-        getDispatcher()->vkCmdPushDescriptorSetWithTemplate &&
-        "Function <vkCmdPushDescriptorSetWithTemplate> requires <VK_KHR_descriptor_update_template> or <VK_KHR_push_descriptor> or <VK_VERSION_1_4>" );
-
-      getDispatcher()->vkCmdPushDescriptorSetWithTemplate( static_cast<VkCommandBuffer>( m_commandBuffer ),
-                                                           static_cast<VkDescriptorUpdateTemplate>( descriptorUpdateTemplate ),
-                                                           static_cast<VkPipelineLayout>( layout ),
-                                                           set,
-                                                           reinterpret_cast<void const *>( &data ) );
-    }
-
     // wrapper function for command vkCmdBindDescriptorSets2, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdBindDescriptorSets2.html
     VULKAN_HPP_INLINE void CommandBuffer::bindDescriptorSets2( BindDescriptorSetsInfo const & bindDescriptorSetsInfo ) const VULKAN_HPP_NOEXCEPT
     {
@@ -19477,16 +19240,13 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                      static_cast<VkFence>( fence ),
                                                                                      &imageIndex ) );
 
-#  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result,
-        VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::acquireNextImage",
-        { Result::eSuccess, Result::eTimeout, Result::eNotReady, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR } );
-#  else
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result,
-                                                 VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::acquireNextImage",
-                                                 { Result::eSuccess, Result::eTimeout, Result::eNotReady, Result::eSuboptimalKHR } );
-#  endif
+#    if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eTimeout, Result::eNotReady, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::acquireNextImage" );
+#    else
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eTimeout, Result::eNotReady, Result::eSuboptimalKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::acquireNextImage" );
+#    endif
 
       return { result, imageIndex };
     }
@@ -19499,12 +19259,12 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       Result result = static_cast<Result>(
         getDispatcher()->vkQueuePresentKHR( static_cast<VkQueue>( m_queue ), reinterpret_cast<VkPresentInfoKHR const *>( &presentInfo ) ) );
 
-#  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Queue::presentKHR", { Result::eSuccess, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR } );
-#  else
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Queue::presentKHR", { Result::eSuccess, Result::eSuboptimalKHR } );
-#  endif
+#    if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Queue::presentKHR" );
+#    else
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eSuboptimalKHR>( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Queue::presentKHR" );
+#    endif
 
       return static_cast<Result>( result );
     }
@@ -19582,16 +19342,13 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       Result   result = static_cast<Result>( getDispatcher()->vkAcquireNextImage2KHR(
         static_cast<VkDevice>( m_device ), reinterpret_cast<VkAcquireNextImageInfoKHR const *>( &acquireInfo ), &imageIndex ) );
 
-#  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result,
-        VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::acquireNextImage2KHR",
-        { Result::eSuccess, Result::eTimeout, Result::eNotReady, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR } );
-#  else
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result,
-                                                 VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::acquireNextImage2KHR",
-                                                 { Result::eSuccess, Result::eTimeout, Result::eNotReady, Result::eSuboptimalKHR } );
-#  endif
+#    if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eTimeout, Result::eNotReady, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::acquireNextImage2KHR" );
+#    else
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eTimeout, Result::eNotReady, Result::eSuboptimalKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::acquireNextImage2KHR" );
+#    endif
 
       return { result, imageIndex };
     }
@@ -19823,7 +19580,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, SwapchainKHR( *this, *reinterpret_cast<VkSwapchainKHR *>( &swapchain ), allocator ) );
     }
 
-#  if defined( VK_USE_PLATFORM_XLIB_KHR )
+#    if defined( VK_USE_PLATFORM_XLIB_KHR )
     //=== VK_KHR_xlib_surface ===
 
     // wrapper function for command vkCreateXlibSurfaceKHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateXlibSurfaceKHR.html
@@ -19856,9 +19613,9 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return static_cast<Bool32>( result );
     }
-#  endif /*VK_USE_PLATFORM_XLIB_KHR*/
+#    endif /*VK_USE_PLATFORM_XLIB_KHR*/
 
-#  if defined( VK_USE_PLATFORM_XCB_KHR )
+#    if defined( VK_USE_PLATFORM_XCB_KHR )
     //=== VK_KHR_xcb_surface ===
 
     // wrapper function for command vkCreateXcbSurfaceKHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateXcbSurfaceKHR.html
@@ -19891,9 +19648,9 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return static_cast<Bool32>( result );
     }
-#  endif /*VK_USE_PLATFORM_XCB_KHR*/
+#    endif /*VK_USE_PLATFORM_XCB_KHR*/
 
-#  if defined( VK_USE_PLATFORM_WAYLAND_KHR )
+#    if defined( VK_USE_PLATFORM_WAYLAND_KHR )
     //=== VK_KHR_wayland_surface ===
 
     // wrapper function for command vkCreateWaylandSurfaceKHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateWaylandSurfaceKHR.html
@@ -19925,9 +19682,9 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return static_cast<Bool32>( result );
     }
-#  endif /*VK_USE_PLATFORM_WAYLAND_KHR*/
+#    endif /*VK_USE_PLATFORM_WAYLAND_KHR*/
 
-#  if defined( VK_USE_PLATFORM_ANDROID_KHR )
+#    if defined( VK_USE_PLATFORM_ANDROID_KHR )
     //=== VK_KHR_android_surface ===
 
     // wrapper function for command vkCreateAndroidSurfaceKHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateAndroidSurfaceKHR.html
@@ -19945,9 +19702,9 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Instance::createAndroidSurfaceKHR" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, SurfaceKHR( *this, *reinterpret_cast<VkSurfaceKHR *>( &surface ), allocator ) );
     }
-#  endif /*VK_USE_PLATFORM_ANDROID_KHR*/
+#    endif /*VK_USE_PLATFORM_ANDROID_KHR*/
 
-#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+#    if defined( VK_USE_PLATFORM_WIN32_KHR )
     //=== VK_KHR_win32_surface ===
 
     // wrapper function for command vkCreateWin32SurfaceKHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateWin32SurfaceKHR.html
@@ -19977,7 +19734,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return static_cast<Bool32>( result );
     }
-#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+#    endif /*VK_USE_PLATFORM_WIN32_KHR*/
 
     //=== VK_EXT_debug_report ===
 
@@ -20095,26 +19852,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( capabilities ) );
     }
 
-    // wrapper function for command vkGetPhysicalDeviceVideoCapabilitiesKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceVideoCapabilitiesKHR.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<StructureChain<X, Y, Z...>>::type
-                         PhysicalDevice::getVideoCapabilitiesKHR( VideoProfileInfoKHR const & videoProfile ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceVideoCapabilitiesKHR &&
-                         "Function <vkGetPhysicalDeviceVideoCapabilitiesKHR> requires <VK_KHR_video_queue>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      VideoCapabilitiesKHR &     capabilities = structureChain.template get<VideoCapabilitiesKHR>();
-      Result                     result =
-        static_cast<Result>( getDispatcher()->vkGetPhysicalDeviceVideoCapabilitiesKHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                                                       reinterpret_cast<VkVideoProfileInfoKHR const *>( &videoProfile ),
-                                                                                       reinterpret_cast<VkVideoCapabilitiesKHR *>( &capabilities ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getVideoCapabilitiesKHR" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChain ) );
-    }
-
     // wrapper function for command vkGetPhysicalDeviceVideoFormatPropertiesKHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceVideoFormatPropertiesKHR.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<VideoFormatPropertiesKHR>>::type
@@ -20152,82 +19889,34 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( videoFormatProperties ) );
     }
 
-    // wrapper function for command vkGetPhysicalDeviceVideoFormatPropertiesKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceVideoFormatPropertiesKHR.html
-    template <typename StructureChain>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<StructureChain>>::type
-                         PhysicalDevice::getVideoFormatPropertiesKHR( PhysicalDeviceVideoFormatInfoKHR const & videoFormatInfo ) const
+    // wrapper function for command vkCreateVideoSessionKHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateVideoSessionKHR.html
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<VideoSessionKHR>::type
+                         Device::createVideoSessionKHR( VideoSessionCreateInfoKHR const &   createInfo,
+                                                        Optional<AllocationCallbacks const> allocator ) const VULKAN_HPP_NOEXCEPT_WHEN_NO_EXCEPTIONS
     {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceVideoFormatPropertiesKHR &&
-                         "Function <vkGetPhysicalDeviceVideoFormatPropertiesKHR> requires <VK_KHR_video_queue>" );
+      VULKAN_HPP_ASSERT( getDispatcher()->vkCreateVideoSessionKHR && "Function <vkCreateVideoSessionKHR> requires <VK_KHR_video_queue>" );
 
-      std::vector<StructureChain>           structureChains;
-      std::vector<VideoFormatPropertiesKHR> videoFormatProperties;
-      uint32_t                              videoFormatPropertyCount;
-      Result                                result;
-      do
-      {
-        result = static_cast<Result>(
-          getDispatcher()->vkGetPhysicalDeviceVideoFormatPropertiesKHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                                        reinterpret_cast<VkPhysicalDeviceVideoFormatInfoKHR const *>( &videoFormatInfo ),
-                                                                        &videoFormatPropertyCount,
-                                                                        nullptr ) );
-        if ( ( result == Result::eSuccess ) && videoFormatPropertyCount )
-        {
-          structureChains.resize( videoFormatPropertyCount );
-          videoFormatProperties.resize( videoFormatPropertyCount );
-          for ( uint32_t i = 0; i < videoFormatPropertyCount; i++ )
-          {
-            videoFormatProperties[i].pNext = structureChains[i].template get<VideoFormatPropertiesKHR>().pNext;
-          }
-          result = static_cast<Result>(
-            getDispatcher()->vkGetPhysicalDeviceVideoFormatPropertiesKHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                                          reinterpret_cast<VkPhysicalDeviceVideoFormatInfoKHR const *>( &videoFormatInfo ),
-                                                                          &videoFormatPropertyCount,
-                                                                          reinterpret_cast<VkVideoFormatPropertiesKHR *>( videoFormatProperties.data() ) ) );
-        }
-      } while ( result == Result::eIncomplete );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getVideoFormatPropertiesKHR" );
-      VULKAN_HPP_ASSERT( videoFormatPropertyCount <= videoFormatProperties.size() );
-      if ( videoFormatPropertyCount < videoFormatProperties.size() )
-      {
-        structureChains.resize( videoFormatPropertyCount );
-      }
-      for ( uint32_t i = 0; i < videoFormatPropertyCount; i++ )
-      {
-        structureChains[i].template get<VideoFormatPropertiesKHR>() = videoFormatProperties[i];
-      }
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChains ) );
-    }
-
-    // wrapper function for command vkCreateVideoSessionKHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateVideoSessionKHR.html
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<VideoSessionKHR>::type
-                         Device::createVideoSessionKHR( VideoSessionCreateInfoKHR const &   createInfo,
-                                                        Optional<AllocationCallbacks const> allocator ) const VULKAN_HPP_NOEXCEPT_WHEN_NO_EXCEPTIONS
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkCreateVideoSessionKHR && "Function <vkCreateVideoSessionKHR> requires <VK_KHR_video_queue>" );
-
-      VULKAN_HPP_NAMESPACE::VideoSessionKHR videoSession;
-      Result result = static_cast<Result>( getDispatcher()->vkCreateVideoSessionKHR( static_cast<VkDevice>( m_device ),
-                                                                                     reinterpret_cast<VkVideoSessionCreateInfoKHR const *>( &createInfo ),
-                                                                                     reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
-                                                                                     reinterpret_cast<VkVideoSessionKHR *>( &videoSession ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createVideoSessionKHR" );
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType(
-        result, VideoSessionKHR( *this, *reinterpret_cast<VkVideoSessionKHR *>( &videoSession ), allocator ) );
-    }
-
-    // wrapper function for command vkGetVideoSessionMemoryRequirementsKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetVideoSessionMemoryRequirementsKHR.html
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<VideoSessionMemoryRequirementsKHR>>::type
-                         VideoSessionKHR::getMemoryRequirements() const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetVideoSessionMemoryRequirementsKHR &&
-                         "Function <vkGetVideoSessionMemoryRequirementsKHR> requires <VK_KHR_video_queue>" );
-
-      std::vector<VideoSessionMemoryRequirementsKHR> memoryRequirements;
-      uint32_t                                       memoryRequirementsCount;
-      Result                                         result;
+      VULKAN_HPP_NAMESPACE::VideoSessionKHR videoSession;
+      Result result = static_cast<Result>( getDispatcher()->vkCreateVideoSessionKHR( static_cast<VkDevice>( m_device ),
+                                                                                     reinterpret_cast<VkVideoSessionCreateInfoKHR const *>( &createInfo ),
+                                                                                     reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
+                                                                                     reinterpret_cast<VkVideoSessionKHR *>( &videoSession ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createVideoSessionKHR" );
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType(
+        result, VideoSessionKHR( *this, *reinterpret_cast<VkVideoSessionKHR *>( &videoSession ), allocator ) );
+    }
+
+    // wrapper function for command vkGetVideoSessionMemoryRequirementsKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetVideoSessionMemoryRequirementsKHR.html
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<VideoSessionMemoryRequirementsKHR>>::type
+                         VideoSessionKHR::getMemoryRequirements() const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetVideoSessionMemoryRequirementsKHR &&
+                         "Function <vkGetVideoSessionMemoryRequirementsKHR> requires <VK_KHR_video_queue>" );
+
+      std::vector<VideoSessionMemoryRequirementsKHR> memoryRequirements;
+      uint32_t                                       memoryRequirementsCount;
+      Result                                         result;
       do
       {
         result = static_cast<Result>( getDispatcher()->vkGetVideoSessionMemoryRequirementsKHR(
@@ -20349,10 +20038,10 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkCmdBindTransformFeedbackBuffersEXT &&
                          "Function <vkCmdBindTransformFeedbackBuffersEXT> requires <VK_EXT_transform_feedback>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( buffers.size() == offsets.size() );
       VULKAN_HPP_ASSERT( sizes.empty() || buffers.size() == sizes.size() );
-#  else
+#    else
       if ( buffers.size() != offsets.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::bindTransformFeedbackBuffersEXT: buffers.size() != offsets.size()" );
@@ -20361,7 +20050,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::bindTransformFeedbackBuffersEXT: buffers.size() != sizes.size()" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       getDispatcher()->vkCmdBindTransformFeedbackBuffersEXT( static_cast<VkCommandBuffer>( m_commandBuffer ),
                                                              firstBinding,
@@ -20378,14 +20067,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                      ArrayProxy<DeviceSize const> const &                   counterBufferOffsets ) const
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkCmdBeginTransformFeedbackEXT && "Function <vkCmdBeginTransformFeedbackEXT> requires <VK_EXT_transform_feedback>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( counterBufferOffsets.empty() || counterBuffers.size() == counterBufferOffsets.size() );
-#  else
+#    else
       if ( !counterBufferOffsets.empty() && counterBuffers.size() != counterBufferOffsets.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::beginTransformFeedbackEXT: counterBuffers.size() != counterBufferOffsets.size()" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       getDispatcher()->vkCmdBeginTransformFeedbackEXT( static_cast<VkCommandBuffer>( m_commandBuffer ),
                                                        firstCounterBuffer,
@@ -20401,14 +20090,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                    ArrayProxy<DeviceSize const> const &                   counterBufferOffsets ) const
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkCmdEndTransformFeedbackEXT && "Function <vkCmdEndTransformFeedbackEXT> requires <VK_EXT_transform_feedback>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( counterBufferOffsets.empty() || counterBuffers.size() == counterBufferOffsets.size() );
-#  else
+#    else
       if ( !counterBufferOffsets.empty() && counterBuffers.size() != counterBufferOffsets.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::endTransformFeedbackEXT: counterBuffers.size() != counterBufferOffsets.size()" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       getDispatcher()->vkCmdEndTransformFeedbackEXT( static_cast<VkCommandBuffer>( m_commandBuffer ),
                                                      firstCounterBuffer,
@@ -20653,7 +20342,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       getDispatcher()->vkCmdEndRenderingKHR( static_cast<VkCommandBuffer>( m_commandBuffer ) );
     }
 
-#  if defined( VK_USE_PLATFORM_GGP )
+#    if defined( VK_USE_PLATFORM_GGP )
     //=== VK_GGP_stream_descriptor_surface ===
 
     // wrapper function for command vkCreateStreamDescriptorSurfaceGGP, see
@@ -20674,7 +20363,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Instance::createStreamDescriptorSurfaceGGP" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, SurfaceKHR( *this, *reinterpret_cast<VkSurfaceKHR *>( &surface ), allocator ) );
     }
-#  endif /*VK_USE_PLATFORM_GGP*/
+#    endif /*VK_USE_PLATFORM_GGP*/
 
     //=== VK_NV_external_memory_capabilities ===
 
@@ -20706,7 +20395,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( externalImageFormatProperties ) );
     }
 
-#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+#    if defined( VK_USE_PLATFORM_WIN32_KHR )
     //=== VK_NV_external_memory_win32 ===
 
     // wrapper function for command vkGetMemoryWin32HandleNV, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetMemoryWin32HandleNV.html
@@ -20724,7 +20413,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( handle ) );
     }
-#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+#    endif /*VK_USE_PLATFORM_WIN32_KHR*/
 
     //=== VK_KHR_get_physical_device_properties2 ===
 
@@ -20742,22 +20431,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return features;
     }
 
-    // wrapper function for command vkGetPhysicalDeviceFeatures2KHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceFeatures2KHR.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...> PhysicalDevice::getFeatures2KHR() const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceFeatures2KHR &&
-                         "Function <vkGetPhysicalDeviceFeatures2KHR> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      PhysicalDeviceFeatures2 &  features = structureChain.template get<PhysicalDeviceFeatures2>();
-      getDispatcher()->vkGetPhysicalDeviceFeatures2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                        reinterpret_cast<VkPhysicalDeviceFeatures2 *>( &features ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetPhysicalDeviceProperties2KHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceProperties2KHR.html
     VULKAN_HPP_INLINE void PhysicalDevice::getProperties2KHR( PhysicalDeviceProperties2 * pProperties ) const VULKAN_HPP_NOEXCEPT
@@ -20782,22 +20455,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return properties;
     }
 
-    // wrapper function for command vkGetPhysicalDeviceProperties2KHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceProperties2KHR.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...> PhysicalDevice::getProperties2KHR() const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceProperties2KHR &&
-                         "Function <vkGetPhysicalDeviceProperties2KHR> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
-
-      StructureChain<X, Y, Z...>  structureChain;
-      PhysicalDeviceProperties2 & properties = structureChain.template get<PhysicalDeviceProperties2>();
-      getDispatcher()->vkGetPhysicalDeviceProperties2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                          reinterpret_cast<VkPhysicalDeviceProperties2 *>( &properties ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetPhysicalDeviceFormatProperties2KHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceFormatProperties2KHR.html
     VULKAN_HPP_INLINE void PhysicalDevice::getFormatProperties2KHR( Format format, FormatProperties2 * pFormatProperties ) const VULKAN_HPP_NOEXCEPT
@@ -20822,22 +20479,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return formatProperties;
     }
 
-    // wrapper function for command vkGetPhysicalDeviceFormatProperties2KHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceFormatProperties2KHR.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...> PhysicalDevice::getFormatProperties2KHR( Format format ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceFormatProperties2KHR &&
-                         "Function <vkGetPhysicalDeviceFormatProperties2KHR> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      FormatProperties2 &        formatProperties = structureChain.template get<FormatProperties2>();
-      getDispatcher()->vkGetPhysicalDeviceFormatProperties2KHR(
-        static_cast<VkPhysicalDevice>( m_physicalDevice ), static_cast<VkFormat>( format ), reinterpret_cast<VkFormatProperties2 *>( &formatProperties ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetPhysicalDeviceImageFormatProperties2KHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceImageFormatProperties2KHR.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<ImageFormatProperties2>::type
@@ -20856,26 +20497,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( imageFormatProperties ) );
     }
 
-    // wrapper function for command vkGetPhysicalDeviceImageFormatProperties2KHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceImageFormatProperties2KHR.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<StructureChain<X, Y, Z...>>::type
-                         PhysicalDevice::getImageFormatProperties2KHR( PhysicalDeviceImageFormatInfo2 const & imageFormatInfo ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceImageFormatProperties2KHR &&
-                         "Function <vkGetPhysicalDeviceImageFormatProperties2KHR> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      ImageFormatProperties2 &   imageFormatProperties = structureChain.template get<ImageFormatProperties2>();
-      Result                     result                = static_cast<Result>(
-        getDispatcher()->vkGetPhysicalDeviceImageFormatProperties2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                                       reinterpret_cast<VkPhysicalDeviceImageFormatInfo2 const *>( &imageFormatInfo ),
-                                                                       reinterpret_cast<VkImageFormatProperties2 *>( &imageFormatProperties ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getImageFormatProperties2KHR" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChain ) );
-    }
-
     // wrapper function for command vkGetPhysicalDeviceQueueFamilyProperties2KHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceQueueFamilyProperties2KHR.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::vector<QueueFamilyProperties2> PhysicalDevice::getQueueFamilyProperties2KHR() const
@@ -20899,40 +20520,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return queueFamilyProperties;
     }
 
-    // wrapper function for command vkGetPhysicalDeviceQueueFamilyProperties2KHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceQueueFamilyProperties2KHR.html
-    template <typename StructureChain>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::vector<StructureChain> PhysicalDevice::getQueueFamilyProperties2KHR() const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceQueueFamilyProperties2KHR &&
-                         "Function <vkGetPhysicalDeviceQueueFamilyProperties2KHR> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
-
-      std::vector<StructureChain>         structureChains;
-      std::vector<QueueFamilyProperties2> queueFamilyProperties;
-      uint32_t                            queueFamilyPropertyCount;
-      getDispatcher()->vkGetPhysicalDeviceQueueFamilyProperties2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ), &queueFamilyPropertyCount, nullptr );
-      structureChains.resize( queueFamilyPropertyCount );
-      queueFamilyProperties.resize( queueFamilyPropertyCount );
-      for ( uint32_t i = 0; i < queueFamilyPropertyCount; i++ )
-      {
-        queueFamilyProperties[i].pNext = structureChains[i].template get<QueueFamilyProperties2>().pNext;
-      }
-      getDispatcher()->vkGetPhysicalDeviceQueueFamilyProperties2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                                     &queueFamilyPropertyCount,
-                                                                     reinterpret_cast<VkQueueFamilyProperties2 *>( queueFamilyProperties.data() ) );
-
-      VULKAN_HPP_ASSERT( queueFamilyPropertyCount <= queueFamilyProperties.size() );
-      if ( queueFamilyPropertyCount < queueFamilyProperties.size() )
-      {
-        structureChains.resize( queueFamilyPropertyCount );
-      }
-      for ( uint32_t i = 0; i < queueFamilyPropertyCount; i++ )
-      {
-        structureChains[i].template get<QueueFamilyProperties2>() = queueFamilyProperties[i];
-      }
-      return structureChains;
-    }
-
     // wrapper function for command vkGetPhysicalDeviceMemoryProperties2KHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceMemoryProperties2KHR.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE PhysicalDeviceMemoryProperties2 PhysicalDevice::getMemoryProperties2KHR() const VULKAN_HPP_NOEXCEPT
@@ -20947,22 +20534,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryProperties;
     }
 
-    // wrapper function for command vkGetPhysicalDeviceMemoryProperties2KHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceMemoryProperties2KHR.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...> PhysicalDevice::getMemoryProperties2KHR() const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceMemoryProperties2KHR &&
-                         "Function <vkGetPhysicalDeviceMemoryProperties2KHR> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
-
-      StructureChain<X, Y, Z...>        structureChain;
-      PhysicalDeviceMemoryProperties2 & memoryProperties = structureChain.template get<PhysicalDeviceMemoryProperties2>();
-      getDispatcher()->vkGetPhysicalDeviceMemoryProperties2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                                reinterpret_cast<VkPhysicalDeviceMemoryProperties2 *>( &memoryProperties ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetPhysicalDeviceSparseImageFormatProperties2KHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceSparseImageFormatProperties2KHR.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::vector<SparseImageFormatProperties2>
@@ -21035,7 +20606,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         static_cast<VkCommandBuffer>( m_commandBuffer ), baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ );
     }
 
-#  if defined( VK_USE_PLATFORM_VI_NN )
+#    if defined( VK_USE_PLATFORM_VI_NN )
     //=== VK_NN_vi_surface ===
 
     // wrapper function for command vkCreateViSurfaceNN, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateViSurfaceNN.html
@@ -21053,7 +20624,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Instance::createViSurfaceNN" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, SurfaceKHR( *this, *reinterpret_cast<VkSurfaceKHR *>( &surface ), allocator ) );
     }
-#  endif /*VK_USE_PLATFORM_VI_NN*/
+#    endif /*VK_USE_PLATFORM_VI_NN*/
 
     //=== VK_KHR_maintenance1 ===
 
@@ -21119,7 +20690,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return externalBufferProperties;
     }
 
-#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+#    if defined( VK_USE_PLATFORM_WIN32_KHR )
     //=== VK_KHR_external_memory_win32 ===
 
     // wrapper function for command vkGetMemoryWin32HandleKHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetMemoryWin32HandleKHR.html
@@ -21154,7 +20725,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( memoryWin32HandleProperties ) );
     }
-#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+#    endif /*VK_USE_PLATFORM_WIN32_KHR*/
 
     //=== VK_KHR_external_memory_fd ===
 
@@ -21206,7 +20777,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return externalSemaphoreProperties;
     }
 
-#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+#    if defined( VK_USE_PLATFORM_WIN32_KHR )
     //=== VK_KHR_external_semaphore_win32 ===
 
     // wrapper function for command vkImportSemaphoreWin32HandleKHR, see
@@ -21239,7 +20810,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( handle ) );
     }
-#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+#    endif /*VK_USE_PLATFORM_WIN32_KHR*/
 
     //=== VK_KHR_external_semaphore_fd ===
 
@@ -21287,25 +20858,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                   reinterpret_cast<VkWriteDescriptorSet const *>( descriptorWrites.data() ) );
     }
 
-    // wrapper function for command vkCmdPushDescriptorSetWithTemplateKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdPushDescriptorSetWithTemplateKHR.html
-    template <typename DataType>
-    VULKAN_HPP_INLINE void CommandBuffer::pushDescriptorSetWithTemplateKHR( VULKAN_HPP_NAMESPACE::DescriptorUpdateTemplate descriptorUpdateTemplate,
-                                                                            VULKAN_HPP_NAMESPACE::PipelineLayout           layout,
-                                                                            uint32_t                                       set,
-                                                                            DataType const &                               data ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT(
-        getDispatcher()->vkCmdPushDescriptorSetWithTemplateKHR &&
-        "Function <vkCmdPushDescriptorSetWithTemplateKHR> requires <VK_KHR_descriptor_update_template> or <VK_KHR_push_descriptor> or <VK_VERSION_1_4>" );
-
-      getDispatcher()->vkCmdPushDescriptorSetWithTemplateKHR( static_cast<VkCommandBuffer>( m_commandBuffer ),
-                                                              static_cast<VkDescriptorUpdateTemplate>( descriptorUpdateTemplate ),
-                                                              static_cast<VkPipelineLayout>( layout ),
-                                                              set,
-                                                              reinterpret_cast<void const *>( &data ) );
-    }
-
     //=== VK_EXT_conditional_rendering ===
 
     // wrapper function for command vkCmdBeginConditionalRenderingEXT, see
@@ -21365,21 +20917,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                              reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ) );
     }
 
-    // wrapper function for command vkUpdateDescriptorSetWithTemplateKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkUpdateDescriptorSetWithTemplateKHR.html
-    template <typename DataType>
-    VULKAN_HPP_INLINE void DescriptorSet::updateWithTemplateKHR( VULKAN_HPP_NAMESPACE::DescriptorUpdateTemplate descriptorUpdateTemplate,
-                                                                 DataType const &                               data ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkUpdateDescriptorSetWithTemplateKHR &&
-                         "Function <vkUpdateDescriptorSetWithTemplateKHR> requires <VK_KHR_descriptor_update_template> or <VK_VERSION_1_1>" );
-
-      getDispatcher()->vkUpdateDescriptorSetWithTemplateKHR( static_cast<VkDevice>( m_device ),
-                                                             static_cast<VkDescriptorSet>( m_descriptorSet ),
-                                                             static_cast<VkDescriptorUpdateTemplate>( descriptorUpdateTemplate ),
-                                                             reinterpret_cast<void const *>( &data ) );
-    }
-
     //=== VK_NV_clip_space_w_scaling ===
 
     // wrapper function for command vkCmdSetViewportWScalingNV, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdSetViewportWScalingNV.html
@@ -21394,7 +20931,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                    reinterpret_cast<VkViewportWScalingNV const *>( viewportWScalings.data() ) );
     }
 
-#  if defined( VK_USE_PLATFORM_XLIB_XRANDR_EXT )
+#    if defined( VK_USE_PLATFORM_XLIB_XRANDR_EXT )
     //=== VK_EXT_acquire_xlib_display ===
 
     // wrapper function for command vkAcquireXlibDisplayEXT, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkAcquireXlibDisplayEXT.html
@@ -21422,7 +20959,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getRandROutputDisplayEXT" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, DisplayKHR( *this, *reinterpret_cast<VkDisplayKHR *>( &display ) ) );
     }
-#  endif /*VK_USE_PLATFORM_XLIB_XRANDR_EXT*/
+#    endif /*VK_USE_PLATFORM_XLIB_XRANDR_EXT*/
 
     //=== VK_EXT_display_surface_counter ===
 
@@ -21495,11 +21032,11 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
     // wrapper function for command vkGetSwapchainCounterEXT, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetSwapchainCounterEXT.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE
-#  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
+#    if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
       ResultValue<uint64_t>
-#  else
+#    else
       typename ResultValueType<uint64_t>::type
-#  endif
+#    endif
       SwapchainKHR::getCounterEXT( SurfaceCounterFlagBitsEXT counter ) const
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkGetSwapchainCounterEXT && "Function <vkGetSwapchainCounterEXT> requires <VK_EXT_display_control>" );
@@ -21510,18 +21047,18 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                         static_cast<VkSurfaceCounterFlagBitsEXT>( counter ),
                                                                                         &counterValue ) );
 
-#  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::getCounterEXT", { Result::eSuccess, Result::eErrorOutOfDateKHR } );
-#  else
+#    if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eErrorOutOfDateKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::getCounterEXT" );
+#    else
       VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::getCounterEXT" );
-#  endif
+#    endif
 
-#  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
+#    if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
       return ResultValue<uint64_t>( result, std::move( counterValue ) );
-#  else
+#    else
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( counterValue ) );
-#  endif
+#    endif
     }
 
     //=== VK_GOOGLE_display_timing ===
@@ -21545,11 +21082,11 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     // wrapper function for command vkGetPastPresentationTimingGOOGLE, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPastPresentationTimingGOOGLE.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE
-#  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
+#    if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
       ResultValue<std::vector<PastPresentationTimingGOOGLE>>
-#  else
+#    else
       typename ResultValueType<std::vector<PastPresentationTimingGOOGLE>>::type
-#  endif
+#    endif
       SwapchainKHR::getPastPresentationTimingGOOGLE() const
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkGetPastPresentationTimingGOOGLE &&
@@ -21573,13 +21110,12 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         }
       } while ( result == Result::eIncomplete );
 
-#  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result,
-                                                 VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::getPastPresentationTimingGOOGLE",
-                                                 { Result::eSuccess, Result::eIncomplete, Result::eErrorOutOfDateKHR } );
-#  else
+#    if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eIncomplete, Result::eErrorOutOfDateKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::getPastPresentationTimingGOOGLE" );
+#    else
       VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::getPastPresentationTimingGOOGLE" );
-#  endif
+#    endif
 
       VULKAN_HPP_ASSERT( presentationTimingCount <= presentationTimings.size() );
       if ( presentationTimingCount < presentationTimings.size() )
@@ -21587,11 +21123,11 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         presentationTimings.resize( presentationTimingCount );
       }
 
-#  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
+#    if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
       return ResultValue<std::vector<PastPresentationTimingGOOGLE>>( result, std::move( presentationTimings ) );
-#  else
+#    else
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( presentationTimings ) );
-#  endif
+#    endif
     }
 
     //=== VK_EXT_discard_rectangles ===
@@ -21636,14 +21172,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                       ArrayProxy<HdrMetadataEXT const> const &                     metadata ) const
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkSetHdrMetadataEXT && "Function <vkSetHdrMetadataEXT> requires <VK_EXT_hdr_metadata>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( swapchains.size() == metadata.size() );
-#  else
+#    else
       if ( swapchains.size() != metadata.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::Device::setHdrMetadataEXT: swapchains.size() != metadata.size()" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       getDispatcher()->vkSetHdrMetadataEXT( static_cast<VkDevice>( m_device ),
                                             swapchains.size(),
@@ -21712,13 +21248,13 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       Result result =
         static_cast<Result>( getDispatcher()->vkGetSwapchainStatusKHR( static_cast<VkDevice>( m_device ), static_cast<VkSwapchainKHR>( m_swapchainKHR ) ) );
 
-#  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::getStatus", { Result::eSuccess, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR } );
-#  else
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::getStatus", { Result::eSuccess, Result::eSuboptimalKHR } );
-#  endif
+#    if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::getStatus" );
+#    else
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eSuboptimalKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::getStatus" );
+#    endif
 
       return static_cast<Result>( result );
     }
@@ -21741,7 +21277,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return externalFenceProperties;
     }
 
-#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+#    if defined( VK_USE_PLATFORM_WIN32_KHR )
     //=== VK_KHR_external_fence_win32 ===
 
     // wrapper function for command vkImportFenceWin32HandleKHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkImportFenceWin32HandleKHR.html
@@ -21770,7 +21306,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( handle ) );
     }
-#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+#    endif /*VK_USE_PLATFORM_WIN32_KHR*/
 
     //=== VK_KHR_external_fence_fd ===
 
@@ -21879,6 +21415,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     }
 
     //=== VK_KHR_get_surface_capabilities2 ===
+
     // wrapper function for command vkGetPhysicalDeviceSurfaceCapabilities2KHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceSurfaceCapabilities2KHR.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE Result PhysicalDevice::getSurfaceCapabilities2KHR(
@@ -21910,26 +21447,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( surfaceCapabilities ) );
     }
 
-    // wrapper function for command vkGetPhysicalDeviceSurfaceCapabilities2KHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceSurfaceCapabilities2KHR.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<StructureChain<X, Y, Z...>>::type
-                         PhysicalDevice::getSurfaceCapabilities2KHR( PhysicalDeviceSurfaceInfo2KHR const & surfaceInfo ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceSurfaceCapabilities2KHR &&
-                         "Function <vkGetPhysicalDeviceSurfaceCapabilities2KHR> requires <VK_KHR_get_surface_capabilities2>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      SurfaceCapabilities2KHR &  surfaceCapabilities = structureChain.template get<SurfaceCapabilities2KHR>();
-      Result                     result              = static_cast<Result>(
-        getDispatcher()->vkGetPhysicalDeviceSurfaceCapabilities2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                                     reinterpret_cast<VkPhysicalDeviceSurfaceInfo2KHR const *>( &surfaceInfo ),
-                                                                     reinterpret_cast<VkSurfaceCapabilities2KHR *>( &surfaceCapabilities ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getSurfaceCapabilities2KHR" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChain ) );
-    }
-
     // wrapper function for command vkGetPhysicalDeviceSurfaceFormats2KHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceSurfaceFormats2KHR.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<SurfaceFormat2KHR>>::type
@@ -21967,54 +21484,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( surfaceFormats ) );
     }
 
-    // wrapper function for command vkGetPhysicalDeviceSurfaceFormats2KHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceSurfaceFormats2KHR.html
-    template <typename StructureChain>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<StructureChain>>::type
-                         PhysicalDevice::getSurfaceFormats2KHR( PhysicalDeviceSurfaceInfo2KHR const & surfaceInfo ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceSurfaceFormats2KHR &&
-                         "Function <vkGetPhysicalDeviceSurfaceFormats2KHR> requires <VK_KHR_get_surface_capabilities2>" );
-
-      std::vector<StructureChain>    structureChains;
-      std::vector<SurfaceFormat2KHR> surfaceFormats;
-      uint32_t                       surfaceFormatCount;
-      Result                         result;
-      do
-      {
-        result = static_cast<Result>(
-          getDispatcher()->vkGetPhysicalDeviceSurfaceFormats2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                                  reinterpret_cast<VkPhysicalDeviceSurfaceInfo2KHR const *>( &surfaceInfo ),
-                                                                  &surfaceFormatCount,
-                                                                  nullptr ) );
-        if ( ( result == Result::eSuccess ) && surfaceFormatCount )
-        {
-          structureChains.resize( surfaceFormatCount );
-          surfaceFormats.resize( surfaceFormatCount );
-          for ( uint32_t i = 0; i < surfaceFormatCount; i++ )
-          {
-            surfaceFormats[i].pNext = structureChains[i].template get<SurfaceFormat2KHR>().pNext;
-          }
-          result = static_cast<Result>(
-            getDispatcher()->vkGetPhysicalDeviceSurfaceFormats2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                                    reinterpret_cast<VkPhysicalDeviceSurfaceInfo2KHR const *>( &surfaceInfo ),
-                                                                    &surfaceFormatCount,
-                                                                    reinterpret_cast<VkSurfaceFormat2KHR *>( surfaceFormats.data() ) ) );
-        }
-      } while ( result == Result::eIncomplete );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getSurfaceFormats2KHR" );
-      VULKAN_HPP_ASSERT( surfaceFormatCount <= surfaceFormats.size() );
-      if ( surfaceFormatCount < surfaceFormats.size() )
-      {
-        structureChains.resize( surfaceFormatCount );
-      }
-      for ( uint32_t i = 0; i < surfaceFormatCount; i++ )
-      {
-        structureChains[i].template get<SurfaceFormat2KHR>() = surfaceFormats[i];
-      }
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChains ) );
-    }
-
     //=== VK_KHR_get_display_properties2 ===
 
     // wrapper function for command vkGetPhysicalDeviceDisplayProperties2KHR, see
@@ -22111,50 +21580,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( properties ) );
     }
 
-    // wrapper function for command vkGetDisplayModeProperties2KHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDisplayModeProperties2KHR.html
-    template <typename StructureChain>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<StructureChain>>::type DisplayKHR::getModeProperties2() const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDisplayModeProperties2KHR &&
-                         "Function <vkGetDisplayModeProperties2KHR> requires <VK_KHR_get_display_properties2>" );
-
-      std::vector<StructureChain>            structureChains;
-      std::vector<DisplayModeProperties2KHR> properties;
-      uint32_t                               propertyCount;
-      Result                                 result;
-      do
-      {
-        result = static_cast<Result>( getDispatcher()->vkGetDisplayModeProperties2KHR(
-          static_cast<VkPhysicalDevice>( m_physicalDevice ), static_cast<VkDisplayKHR>( m_displayKHR ), &propertyCount, nullptr ) );
-        if ( ( result == Result::eSuccess ) && propertyCount )
-        {
-          structureChains.resize( propertyCount );
-          properties.resize( propertyCount );
-          for ( uint32_t i = 0; i < propertyCount; i++ )
-          {
-            properties[i].pNext = structureChains[i].template get<DisplayModeProperties2KHR>().pNext;
-          }
-          result =
-            static_cast<Result>( getDispatcher()->vkGetDisplayModeProperties2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
-                                                                                  static_cast<VkDisplayKHR>( m_displayKHR ),
-                                                                                  &propertyCount,
-                                                                                  reinterpret_cast<VkDisplayModeProperties2KHR *>( properties.data() ) ) );
-        }
-      } while ( result == Result::eIncomplete );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::DisplayKHR::getModeProperties2" );
-      VULKAN_HPP_ASSERT( propertyCount <= properties.size() );
-      if ( propertyCount < properties.size() )
-      {
-        structureChains.resize( propertyCount );
-      }
-      for ( uint32_t i = 0; i < propertyCount; i++ )
-      {
-        structureChains[i].template get<DisplayModeProperties2KHR>() = properties[i];
-      }
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChains ) );
-    }
-
     // wrapper function for command vkGetDisplayPlaneCapabilities2KHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDisplayPlaneCapabilities2KHR.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DisplayPlaneCapabilities2KHR>::type
@@ -22173,7 +21598,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( capabilities ) );
     }
 
-#  if defined( VK_USE_PLATFORM_IOS_MVK )
+#    if defined( VK_USE_PLATFORM_IOS_MVK )
     //=== VK_MVK_ios_surface ===
 
     // wrapper function for command vkCreateIOSSurfaceMVK, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateIOSSurfaceMVK.html
@@ -22191,9 +21616,9 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Instance::createIOSSurfaceMVK" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, SurfaceKHR( *this, *reinterpret_cast<VkSurfaceKHR *>( &surface ), allocator ) );
     }
-#  endif /*VK_USE_PLATFORM_IOS_MVK*/
+#    endif /*VK_USE_PLATFORM_IOS_MVK*/
 
-#  if defined( VK_USE_PLATFORM_MACOS_MVK )
+#    if defined( VK_USE_PLATFORM_MACOS_MVK )
     //=== VK_MVK_macos_surface ===
 
     // wrapper function for command vkCreateMacOSSurfaceMVK, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateMacOSSurfaceMVK.html
@@ -22211,7 +21636,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Instance::createMacOSSurfaceMVK" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, SurfaceKHR( *this, *reinterpret_cast<VkSurfaceKHR *>( &surface ), allocator ) );
     }
-#  endif /*VK_USE_PLATFORM_MACOS_MVK*/
+#    endif /*VK_USE_PLATFORM_MACOS_MVK*/
 
     //=== VK_EXT_debug_utils ===
 
@@ -22228,24 +21653,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result );
     }
 
-    // wrapper function for command vkSetDebugUtilsObjectNameEXT, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkSetDebugUtilsObjectNameEXT.html
-    template <typename HandleType>
-    VULKAN_HPP_INLINE typename ResultValueType<void>::type Device::setDebugUtilsObjectNameEXT( HandleType const & handle, std::string const & name ) const
-    {
-      VULKAN_HPP_STATIC_ASSERT( VULKAN_HPP_NAMESPACE::isVulkanHandleType<HandleType>::value, "HandleType must be a Vulkan handle type" );
-      // It might be, that neither constructors, nor setters, nor designated initializers are available... need to explicitly set member by member
-      VULKAN_HPP_NAMESPACE::DebugUtilsObjectNameInfoEXT nameInfo;
-      nameInfo.objectType = handle.objectType;
-#  if ( VK_USE_64_BIT_PTR_DEFINES == 1 )
-      nameInfo.objectHandle = reinterpret_cast<uint64_t>( static_cast<typename HandleType::CType>( handle ) );
-#  else
-      nameInfo.objectHandle = static_cast<typename HandleType::CType>( handle );
-#  endif
-      nameInfo.pObjectName = name.c_str();
-      return setDebugUtilsObjectNameEXT( nameInfo );
-    }
-
     // wrapper function for command vkSetDebugUtilsObjectTagEXT, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkSetDebugUtilsObjectTagEXT.html
     VULKAN_HPP_INLINE typename ResultValueType<void>::type Device::setDebugUtilsObjectTagEXT( DebugUtilsObjectTagInfoEXT const & tagInfo ) const
     {
@@ -22258,27 +21665,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result );
     }
 
-    // wrapper function for command vkSetDebugUtilsObjectTagEXT, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkSetDebugUtilsObjectTagEXT.html
-    template <typename HandleType, typename TagType>
-    VULKAN_HPP_INLINE typename ResultValueType<void>::type
-      Device::setDebugUtilsObjectTagEXT( HandleType const & handle, uint64_t name, TagType const & tag ) const
-    {
-      VULKAN_HPP_STATIC_ASSERT( VULKAN_HPP_NAMESPACE::isVulkanHandleType<HandleType>::value, "HandleType must be a Vulkan handle type" );
-      // It might be, that neither constructors, nor setters, nor designated initializers are available... need to explicitly set member by member
-      VULKAN_HPP_NAMESPACE::DebugUtilsObjectTagInfoEXT tagInfo;
-      tagInfo.objectType = handle.objectType;
-#  if ( VK_USE_64_BIT_PTR_DEFINES == 1 )
-      tagInfo.objectHandle = reinterpret_cast<uint64_t>( static_cast<typename HandleType::CType>( handle ) );
-#  else
-      tagInfo.objectHandle = static_cast<typename HandleType::CType>( handle );
-#  endif
-      tagInfo.tagName = name;
-      tagInfo.tagSize = sizeof( TagType );
-      tagInfo.pTag    = &tag;
-      return setDebugUtilsObjectTagEXT( tagInfo );
-    }
-
     // wrapper function for command vkQueueBeginDebugUtilsLabelEXT, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkQueueBeginDebugUtilsLabelEXT.html
     VULKAN_HPP_INLINE void Queue::beginDebugUtilsLabelEXT( DebugUtilsLabelEXT const & labelInfo ) const VULKAN_HPP_NOEXCEPT
@@ -22367,7 +21753,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                      reinterpret_cast<VkDebugUtilsMessengerCallbackDataEXT const *>( &callbackData ) );
     }
 
-#  if defined( VK_USE_PLATFORM_ANDROID_KHR )
+#    if defined( VK_USE_PLATFORM_ANDROID_KHR )
     //=== VK_ANDROID_external_memory_android_hardware_buffer ===
 
     // wrapper function for command vkGetAndroidHardwareBufferPropertiesANDROID, see
@@ -22386,24 +21772,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( properties ) );
     }
 
-    // wrapper function for command vkGetAndroidHardwareBufferPropertiesANDROID, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetAndroidHardwareBufferPropertiesANDROID.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<StructureChain<X, Y, Z...>>::type
-                         Device::getAndroidHardwareBufferPropertiesANDROID( struct AHardwareBuffer const & buffer ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetAndroidHardwareBufferPropertiesANDROID &&
-                         "Function <vkGetAndroidHardwareBufferPropertiesANDROID> requires <VK_ANDROID_external_memory_android_hardware_buffer>" );
-
-      StructureChain<X, Y, Z...>               structureChain;
-      AndroidHardwareBufferPropertiesANDROID & properties = structureChain.template get<AndroidHardwareBufferPropertiesANDROID>();
-      Result                                   result     = static_cast<Result>( getDispatcher()->vkGetAndroidHardwareBufferPropertiesANDROID(
-        static_cast<VkDevice>( m_device ), &buffer, reinterpret_cast<VkAndroidHardwareBufferPropertiesANDROID *>( &properties ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getAndroidHardwareBufferPropertiesANDROID" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChain ) );
-    }
-
     // wrapper function for command vkGetMemoryAndroidHardwareBufferANDROID, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetMemoryAndroidHardwareBufferANDROID.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<struct AHardwareBuffer *>::type
@@ -22419,7 +21787,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( buffer ) );
     }
-#  endif /*VK_USE_PLATFORM_ANDROID_KHR*/
+#    endif /*VK_USE_PLATFORM_ANDROID_KHR*/
 
     //=== VK_AMD_gpa_interface ===
 
@@ -22575,7 +21943,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       getDispatcher()->vkCmdCopyGpaSessionResultsAMD( static_cast<VkCommandBuffer>( m_commandBuffer ), static_cast<VkGpaSessionAMD>( gpaSession ) );
     }
 
-#  if defined( VK_ENABLE_BETA_EXTENSIONS )
+#    if defined( VK_ENABLE_BETA_EXTENSIONS )
     //=== VK_AMDX_shader_enqueue ===
 
     // wrapper function for command vkCreateExecutionGraphPipelinesAMDX, see
@@ -22596,8 +21964,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                               reinterpret_cast<VkExecutionGraphPipelineCreateInfoAMDX const *>( createInfos.data() ),
                                                               reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                               reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createExecutionGraphPipelinesAMDX", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createExecutionGraphPipelinesAMDX" );
       std::vector<Pipeline> pipelinesRAII;
       if ( result == Result::eSuccess )
       {
@@ -22628,8 +21996,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                               reinterpret_cast<VkExecutionGraphPipelineCreateInfoAMDX const *>( &createInfo ),
                                                               reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                               reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createExecutionGraphPipelineAMDX", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createExecutionGraphPipelineAMDX" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, Pipeline( *this, *reinterpret_cast<VkPipeline *>( &pipeline ), allocator, result ) );
     }
 
@@ -22722,7 +22090,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                             static_cast<VkDeviceSize>( scratchSize ),
                                                             static_cast<VkDeviceAddress>( countInfo ) );
     }
-#  endif /*VK_ENABLE_BETA_EXTENSIONS*/
+#    endif /*VK_ENABLE_BETA_EXTENSIONS*/
 
     //=== VK_EXT_descriptor_heap ===
 
@@ -22732,14 +22100,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                                ArrayProxy<HostAddressRangeEXT const> const & descriptors ) const
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkWriteSamplerDescriptorsEXT && "Function <vkWriteSamplerDescriptorsEXT> requires <VK_EXT_descriptor_heap>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( samplers.size() == descriptors.size() );
-#  else
+#    else
       if ( samplers.size() != descriptors.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::Device::writeSamplerDescriptorsEXT: samplers.size() != descriptors.size()" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       Result result =
         static_cast<Result>( getDispatcher()->vkWriteSamplerDescriptorsEXT( static_cast<VkDevice>( m_device ),
@@ -22758,14 +22126,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                            ArrayProxy<HostAddressRangeEXT const> const &       descriptors ) const
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkWriteResourceDescriptorsEXT && "Function <vkWriteResourceDescriptorsEXT> requires <VK_EXT_descriptor_heap>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( resources.size() == descriptors.size() );
-#  else
+#    else
       if ( resources.size() != descriptors.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::Device::writeResourceDescriptorsEXT: resources.size() != descriptors.size()" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       Result result =
         static_cast<Result>( getDispatcher()->vkWriteResourceDescriptorsEXT( static_cast<VkDevice>( m_device ),
@@ -22910,24 +22278,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryRequirements;
     }
 
-    // wrapper function for command vkGetImageMemoryRequirements2KHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageMemoryRequirements2KHR.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-                                           Device::getImageMemoryRequirements2KHR( ImageMemoryRequirementsInfo2 const & info ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetImageMemoryRequirements2KHR &&
-                         "Function <vkGetImageMemoryRequirements2KHR> requires <VK_KHR_get_memory_requirements2> or <VK_VERSION_1_1>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
-      getDispatcher()->vkGetImageMemoryRequirements2KHR( static_cast<VkDevice>( m_device ),
-                                                         reinterpret_cast<VkImageMemoryRequirementsInfo2 const *>( &info ),
-                                                         reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetBufferMemoryRequirements2KHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetBufferMemoryRequirements2KHR.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE MemoryRequirements2
@@ -22944,24 +22294,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryRequirements;
     }
 
-    // wrapper function for command vkGetBufferMemoryRequirements2KHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetBufferMemoryRequirements2KHR.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-                                           Device::getBufferMemoryRequirements2KHR( BufferMemoryRequirementsInfo2 const & info ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetBufferMemoryRequirements2KHR &&
-                         "Function <vkGetBufferMemoryRequirements2KHR> requires <VK_KHR_get_memory_requirements2> or <VK_VERSION_1_1>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
-      getDispatcher()->vkGetBufferMemoryRequirements2KHR( static_cast<VkDevice>( m_device ),
-                                                          reinterpret_cast<VkBufferMemoryRequirementsInfo2 const *>( &info ),
-                                                          reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetImageSparseMemoryRequirements2KHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageSparseMemoryRequirements2KHR.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::vector<SparseImageMemoryRequirements2>
@@ -23018,14 +22350,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkCmdBuildAccelerationStructuresKHR &&
                          "Function <vkCmdBuildAccelerationStructuresKHR> requires <VK_KHR_acceleration_structure>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( infos.size() == pBuildRangeInfos.size() );
-#  else
+#    else
       if ( infos.size() != pBuildRangeInfos.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::buildAccelerationStructuresKHR: infos.size() != pBuildRangeInfos.size()" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       getDispatcher()->vkCmdBuildAccelerationStructuresKHR(
         static_cast<VkCommandBuffer>( m_commandBuffer ),
@@ -23043,11 +22375,11 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkCmdBuildAccelerationStructuresIndirectKHR &&
                          "Function <vkCmdBuildAccelerationStructuresIndirectKHR> requires <VK_KHR_acceleration_structure>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( infos.size() == indirectDeviceAddresses.size() );
       VULKAN_HPP_ASSERT( infos.size() == indirectStrides.size() );
       VULKAN_HPP_ASSERT( infos.size() == pMaxPrimitiveCounts.size() );
-#  else
+#    else
       if ( infos.size() != indirectDeviceAddresses.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING
@@ -23061,7 +22393,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::buildAccelerationStructuresIndirectKHR: infos.size() != pMaxPrimitiveCounts.size()" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       getDispatcher()->vkCmdBuildAccelerationStructuresIndirectKHR( static_cast<VkCommandBuffer>( m_commandBuffer ),
                                                                     infos.size(),
@@ -23080,14 +22412,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkBuildAccelerationStructuresKHR &&
                          "Function <vkBuildAccelerationStructuresKHR> requires <VK_KHR_acceleration_structure>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( infos.size() == pBuildRangeInfos.size() );
-#  else
+#    else
       if ( infos.size() != pBuildRangeInfos.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::Device::buildAccelerationStructuresKHR: infos.size() != pBuildRangeInfos.size()" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       Result result = static_cast<Result>( getDispatcher()->vkBuildAccelerationStructuresKHR(
         static_cast<VkDevice>( m_device ),
@@ -23095,9 +22427,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         infos.size(),
         reinterpret_cast<VkAccelerationStructureBuildGeometryInfoKHR const *>( infos.data() ),
         reinterpret_cast<VkAccelerationStructureBuildRangeInfoKHR const * const *>( pBuildRangeInfos.data() ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result,
-                                                 VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::buildAccelerationStructuresKHR",
-                                                 { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::buildAccelerationStructuresKHR" );
 
       return static_cast<Result>( result );
     }
@@ -23114,9 +22445,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         static_cast<Result>( getDispatcher()->vkCopyAccelerationStructureKHR( static_cast<VkDevice>( m_device ),
                                                                               static_cast<VkDeferredOperationKHR>( deferredOperation ),
                                                                               reinterpret_cast<VkCopyAccelerationStructureInfoKHR const *>( &info ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result,
-                                                 VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::copyAccelerationStructureKHR",
-                                                 { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::copyAccelerationStructureKHR" );
 
       return static_cast<Result>( result );
     }
@@ -23133,9 +22463,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         getDispatcher()->vkCopyAccelerationStructureToMemoryKHR( static_cast<VkDevice>( m_device ),
                                                                  static_cast<VkDeferredOperationKHR>( deferredOperation ),
                                                                  reinterpret_cast<VkCopyAccelerationStructureToMemoryInfoKHR const *>( &info ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result,
-                                                 VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::copyAccelerationStructureToMemoryKHR",
-                                                 { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::copyAccelerationStructureToMemoryKHR" );
 
       return static_cast<Result>( result );
     }
@@ -23152,9 +22481,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         getDispatcher()->vkCopyMemoryToAccelerationStructureKHR( static_cast<VkDevice>( m_device ),
                                                                  static_cast<VkDeferredOperationKHR>( deferredOperation ),
                                                                  reinterpret_cast<VkCopyMemoryToAccelerationStructureInfoKHR const *>( &info ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result,
-                                                 VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::copyMemoryToAccelerationStructureKHR",
-                                                 { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::copyMemoryToAccelerationStructureKHR" );
 
       return static_cast<Result>( result );
     }
@@ -23181,56 +22509,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                      stride ) );
     }
 
-    // wrapper function for command vkWriteAccelerationStructuresPropertiesKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkWriteAccelerationStructuresPropertiesKHR.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<DataType>>::type
-      Device::writeAccelerationStructuresPropertiesKHR( ArrayProxy<VULKAN_HPP_NAMESPACE::AccelerationStructureKHR const> const & accelerationStructures,
-                                                        QueryType                                                                queryType,
-                                                        size_t                                                                   dataSize,
-                                                        size_t                                                                   stride ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkWriteAccelerationStructuresPropertiesKHR &&
-                         "Function <vkWriteAccelerationStructuresPropertiesKHR> requires <VK_KHR_acceleration_structure>" );
-
-      VULKAN_HPP_ASSERT( dataSize % sizeof( DataType ) == 0 );
-      std::vector<DataType> data( dataSize / sizeof( DataType ) );
-      Result                result = static_cast<Result>(
-        getDispatcher()->vkWriteAccelerationStructuresPropertiesKHR( static_cast<VkDevice>( m_device ),
-                                                                     accelerationStructures.size(),
-                                                                     reinterpret_cast<VkAccelerationStructureKHR const *>( accelerationStructures.data() ),
-                                                                     static_cast<VkQueryType>( queryType ),
-                                                                     data.size() * sizeof( DataType ),
-                                                                     reinterpret_cast<void *>( data.data() ),
-                                                                     stride ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::writeAccelerationStructuresPropertiesKHR" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
-    // wrapper function for command vkWriteAccelerationStructuresPropertiesKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkWriteAccelerationStructuresPropertiesKHR.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type Device::writeAccelerationStructuresPropertyKHR(
-      ArrayProxy<VULKAN_HPP_NAMESPACE::AccelerationStructureKHR const> const & accelerationStructures, QueryType queryType, size_t stride ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkWriteAccelerationStructuresPropertiesKHR &&
-                         "Function <vkWriteAccelerationStructuresPropertiesKHR> requires <VK_KHR_acceleration_structure>" );
-
-      DataType data;
-      Result   result = static_cast<Result>(
-        getDispatcher()->vkWriteAccelerationStructuresPropertiesKHR( static_cast<VkDevice>( m_device ),
-                                                                     accelerationStructures.size(),
-                                                                     reinterpret_cast<VkAccelerationStructureKHR const *>( accelerationStructures.data() ),
-                                                                     static_cast<VkQueryType>( queryType ),
-                                                                     sizeof( DataType ),
-                                                                     reinterpret_cast<void *>( &data ),
-                                                                     stride ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::writeAccelerationStructuresPropertyKHR" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
     // wrapper function for command vkCmdCopyAccelerationStructureKHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdCopyAccelerationStructureKHR.html
     VULKAN_HPP_INLINE void CommandBuffer::copyAccelerationStructureKHR( CopyAccelerationStructureInfoKHR const & info ) const VULKAN_HPP_NOEXCEPT
@@ -23324,14 +22602,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkGetAccelerationStructureBuildSizesKHR &&
                          "Function <vkGetAccelerationStructureBuildSizesKHR> requires <VK_KHR_acceleration_structure>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( maxPrimitiveCounts.size() == buildInfo.geometryCount );
-#  else
+#    else
       if ( maxPrimitiveCounts.size() != buildInfo.geometryCount )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::Device::getAccelerationStructureBuildSizesKHR: maxPrimitiveCounts.size() != buildInfo.geometryCount" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       AccelerationStructureBuildSizesInfoKHR sizeInfo;
       getDispatcher()->vkGetAccelerationStructureBuildSizesKHR( static_cast<VkDevice>( m_device ),
@@ -23386,10 +22664,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                          reinterpret_cast<VkRayTracingPipelineCreateInfoKHR const *>( createInfos.data() ),
                                                          reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                          reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result,
-        VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createRayTracingPipelinesKHR",
-        { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createRayTracingPipelinesKHR" );
       std::vector<Pipeline> pipelinesRAII;
       if ( result == Result::eSuccess )
       {
@@ -23422,10 +22698,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                          reinterpret_cast<VkRayTracingPipelineCreateInfoKHR const *>( &createInfo ),
                                                          reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                          reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result,
-        VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createRayTracingPipelineKHR",
-        { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createRayTracingPipelineKHR" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, Pipeline( *this, *reinterpret_cast<VkPipeline *>( &pipeline ), allocator, result ) );
     }
 
@@ -23442,49 +22716,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         static_cast<VkDevice>( m_device ), static_cast<VkPipeline>( m_pipeline ), firstGroup, groupCount, dataSize, pData ) );
     }
 
-    // wrapper function for command vkGetRayTracingShaderGroupHandlesKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetRayTracingShaderGroupHandlesKHR.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<DataType>>::type
-                         Pipeline::getRayTracingShaderGroupHandlesKHR( uint32_t firstGroup, uint32_t groupCount, size_t dataSize ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetRayTracingShaderGroupHandlesKHR &&
-                         "Function <vkGetRayTracingShaderGroupHandlesKHR> requires <VK_KHR_ray_tracing_pipeline> or <VK_NV_ray_tracing>" );
-
-      VULKAN_HPP_ASSERT( dataSize % sizeof( DataType ) == 0 );
-      std::vector<DataType> data( dataSize / sizeof( DataType ) );
-      Result                result = static_cast<Result>( getDispatcher()->vkGetRayTracingShaderGroupHandlesKHR( static_cast<VkDevice>( m_device ),
-                                                                                                                 static_cast<VkPipeline>( m_pipeline ),
-                                                                                                                 firstGroup,
-                                                                                                                 groupCount,
-                                                                                                                 data.size() * sizeof( DataType ),
-                                                                                                                 reinterpret_cast<void *>( data.data() ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Pipeline::getRayTracingShaderGroupHandlesKHR" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
-    // wrapper function for command vkGetRayTracingShaderGroupHandlesKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetRayTracingShaderGroupHandlesKHR.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type Pipeline::getRayTracingShaderGroupHandleKHR( uint32_t firstGroup,
-                                                                                                                                 uint32_t groupCount ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetRayTracingShaderGroupHandlesKHR &&
-                         "Function <vkGetRayTracingShaderGroupHandlesKHR> requires <VK_KHR_ray_tracing_pipeline> or <VK_NV_ray_tracing>" );
-
-      DataType data;
-      Result   result = static_cast<Result>( getDispatcher()->vkGetRayTracingShaderGroupHandlesKHR( static_cast<VkDevice>( m_device ),
-                                                                                                    static_cast<VkPipeline>( m_pipeline ),
-                                                                                                    firstGroup,
-                                                                                                    groupCount,
-                                                                                                    sizeof( DataType ),
-                                                                                                    reinterpret_cast<void *>( &data ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Pipeline::getRayTracingShaderGroupHandleKHR" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
     // wrapper function for command vkGetRayTracingCaptureReplayShaderGroupHandlesKHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetRayTracingCaptureReplayShaderGroupHandlesKHR.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE Result Pipeline::getRayTracingCaptureReplayShaderGroupHandlesKHR( uint32_t firstGroup,
@@ -23498,49 +22729,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         static_cast<VkDevice>( m_device ), static_cast<VkPipeline>( m_pipeline ), firstGroup, groupCount, dataSize, pData ) );
     }
 
-    // wrapper function for command vkGetRayTracingCaptureReplayShaderGroupHandlesKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetRayTracingCaptureReplayShaderGroupHandlesKHR.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<DataType>>::type
-                         Pipeline::getRayTracingCaptureReplayShaderGroupHandlesKHR( uint32_t firstGroup, uint32_t groupCount, size_t dataSize ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetRayTracingCaptureReplayShaderGroupHandlesKHR &&
-                         "Function <vkGetRayTracingCaptureReplayShaderGroupHandlesKHR> requires <VK_KHR_ray_tracing_pipeline>" );
-
-      VULKAN_HPP_ASSERT( dataSize % sizeof( DataType ) == 0 );
-      std::vector<DataType> data( dataSize / sizeof( DataType ) );
-      Result result = static_cast<Result>( getDispatcher()->vkGetRayTracingCaptureReplayShaderGroupHandlesKHR( static_cast<VkDevice>( m_device ),
-                                                                                                               static_cast<VkPipeline>( m_pipeline ),
-                                                                                                               firstGroup,
-                                                                                                               groupCount,
-                                                                                                               data.size() * sizeof( DataType ),
-                                                                                                               reinterpret_cast<void *>( data.data() ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Pipeline::getRayTracingCaptureReplayShaderGroupHandlesKHR" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
-    // wrapper function for command vkGetRayTracingCaptureReplayShaderGroupHandlesKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetRayTracingCaptureReplayShaderGroupHandlesKHR.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
-                         Pipeline::getRayTracingCaptureReplayShaderGroupHandleKHR( uint32_t firstGroup, uint32_t groupCount ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetRayTracingCaptureReplayShaderGroupHandlesKHR &&
-                         "Function <vkGetRayTracingCaptureReplayShaderGroupHandlesKHR> requires <VK_KHR_ray_tracing_pipeline>" );
-
-      DataType data;
-      Result   result = static_cast<Result>( getDispatcher()->vkGetRayTracingCaptureReplayShaderGroupHandlesKHR( static_cast<VkDevice>( m_device ),
-                                                                                                                 static_cast<VkPipeline>( m_pipeline ),
-                                                                                                                 firstGroup,
-                                                                                                                 groupCount,
-                                                                                                                 sizeof( DataType ),
-                                                                                                                 reinterpret_cast<void *>( &data ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Pipeline::getRayTracingCaptureReplayShaderGroupHandleKHR" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
     // wrapper function for command vkCmdTraceRaysIndirectKHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdTraceRaysIndirectKHR.html
     VULKAN_HPP_INLINE void CommandBuffer::traceRaysIndirectKHR( StridedDeviceAddressRegionKHR const & raygenShaderBindingTable,
                                                                 StridedDeviceAddressRegionKHR const & missShaderBindingTable,
@@ -23800,24 +22988,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryRequirements;
     }
 
-    // wrapper function for command vkGetAccelerationStructureMemoryRequirementsNV, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetAccelerationStructureMemoryRequirementsNV.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-      Device::getAccelerationStructureMemoryRequirementsNV( AccelerationStructureMemoryRequirementsInfoNV const & info ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetAccelerationStructureMemoryRequirementsNV &&
-                         "Function <vkGetAccelerationStructureMemoryRequirementsNV> requires <VK_NV_ray_tracing>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
-      getDispatcher()->vkGetAccelerationStructureMemoryRequirementsNV( static_cast<VkDevice>( m_device ),
-                                                                       reinterpret_cast<VkAccelerationStructureMemoryRequirementsInfoNV const *>( &info ),
-                                                                       reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkBindAccelerationStructureMemoryNV, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkBindAccelerationStructureMemoryNV.html
     VULKAN_HPP_INLINE typename ResultValueType<void>::type
@@ -23923,8 +23093,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                              reinterpret_cast<VkRayTracingPipelineCreateInfoNV const *>( createInfos.data() ),
                                                                              reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                              reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createRayTracingPipelinesNV", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createRayTracingPipelinesNV" );
       std::vector<Pipeline> pipelinesRAII;
       if ( result == Result::eSuccess )
       {
@@ -23954,8 +23124,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                              reinterpret_cast<VkRayTracingPipelineCreateInfoNV const *>( &createInfo ),
                                                                              reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                              reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createRayTracingPipelineNV", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createRayTracingPipelineNV" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, Pipeline( *this, *reinterpret_cast<VkPipeline *>( &pipeline ), allocator, result ) );
     }
 
@@ -23972,49 +23142,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         static_cast<VkDevice>( m_device ), static_cast<VkPipeline>( m_pipeline ), firstGroup, groupCount, dataSize, pData ) );
     }
 
-    // wrapper function for command vkGetRayTracingShaderGroupHandlesNV, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetRayTracingShaderGroupHandlesNV.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<DataType>>::type
-                         Pipeline::getRayTracingShaderGroupHandlesNV( uint32_t firstGroup, uint32_t groupCount, size_t dataSize ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetRayTracingShaderGroupHandlesNV &&
-                         "Function <vkGetRayTracingShaderGroupHandlesNV> requires <VK_KHR_ray_tracing_pipeline> or <VK_NV_ray_tracing>" );
-
-      VULKAN_HPP_ASSERT( dataSize % sizeof( DataType ) == 0 );
-      std::vector<DataType> data( dataSize / sizeof( DataType ) );
-      Result                result = static_cast<Result>( getDispatcher()->vkGetRayTracingShaderGroupHandlesNV( static_cast<VkDevice>( m_device ),
-                                                                                                                static_cast<VkPipeline>( m_pipeline ),
-                                                                                                                firstGroup,
-                                                                                                                groupCount,
-                                                                                                                data.size() * sizeof( DataType ),
-                                                                                                                reinterpret_cast<void *>( data.data() ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Pipeline::getRayTracingShaderGroupHandlesNV" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
-    // wrapper function for command vkGetRayTracingShaderGroupHandlesNV, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetRayTracingShaderGroupHandlesNV.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type Pipeline::getRayTracingShaderGroupHandleNV( uint32_t firstGroup,
-                                                                                                                                uint32_t groupCount ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetRayTracingShaderGroupHandlesNV &&
-                         "Function <vkGetRayTracingShaderGroupHandlesNV> requires <VK_KHR_ray_tracing_pipeline> or <VK_NV_ray_tracing>" );
-
-      DataType data;
-      Result   result = static_cast<Result>( getDispatcher()->vkGetRayTracingShaderGroupHandlesNV( static_cast<VkDevice>( m_device ),
-                                                                                                   static_cast<VkPipeline>( m_pipeline ),
-                                                                                                   firstGroup,
-                                                                                                   groupCount,
-                                                                                                   sizeof( DataType ),
-                                                                                                   reinterpret_cast<void *>( &data ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Pipeline::getRayTracingShaderGroupHandleNV" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
     // wrapper function for command vkGetAccelerationStructureHandleNV, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetAccelerationStructureHandleNV.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE Result AccelerationStructureNV::getHandle( size_t dataSize, void * pData ) const VULKAN_HPP_NOEXCEPT
@@ -24024,43 +23151,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         static_cast<VkDevice>( m_device ), static_cast<VkAccelerationStructureNV>( m_accelerationStructureNV ), dataSize, pData ) );
     }
 
-    // wrapper function for command vkGetAccelerationStructureHandleNV, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetAccelerationStructureHandleNV.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<DataType>>::type AccelerationStructureNV::getHandle( size_t dataSize ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetAccelerationStructureHandleNV && "Function <vkGetAccelerationStructureHandleNV> requires <VK_NV_ray_tracing>" );
-
-      VULKAN_HPP_ASSERT( dataSize % sizeof( DataType ) == 0 );
-      std::vector<DataType> data( dataSize / sizeof( DataType ) );
-      Result                result =
-        static_cast<Result>( getDispatcher()->vkGetAccelerationStructureHandleNV( static_cast<VkDevice>( m_device ),
-                                                                                  static_cast<VkAccelerationStructureNV>( m_accelerationStructureNV ),
-                                                                                  data.size() * sizeof( DataType ),
-                                                                                  reinterpret_cast<void *>( data.data() ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::AccelerationStructureNV::getHandle" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
-    // wrapper function for command vkGetAccelerationStructureHandleNV, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetAccelerationStructureHandleNV.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type AccelerationStructureNV::getHandle() const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetAccelerationStructureHandleNV && "Function <vkGetAccelerationStructureHandleNV> requires <VK_NV_ray_tracing>" );
-
-      DataType data;
-      Result   result =
-        static_cast<Result>( getDispatcher()->vkGetAccelerationStructureHandleNV( static_cast<VkDevice>( m_device ),
-                                                                                  static_cast<VkAccelerationStructureNV>( m_accelerationStructureNV ),
-                                                                                  sizeof( DataType ),
-                                                                                  reinterpret_cast<void *>( &data ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::AccelerationStructureNV::getHandle" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
     // wrapper function for command vkCmdWriteAccelerationStructuresPropertiesNV, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdWriteAccelerationStructuresPropertiesNV.html
     VULKAN_HPP_INLINE void
@@ -24110,24 +23200,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return support;
     }
 
-    // wrapper function for command vkGetDescriptorSetLayoutSupportKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDescriptorSetLayoutSupportKHR.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-      Device::getDescriptorSetLayoutSupportKHR( DescriptorSetLayoutCreateInfo const & createInfo ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDescriptorSetLayoutSupportKHR &&
-                         "Function <vkGetDescriptorSetLayoutSupportKHR> requires <VK_KHR_maintenance3> or <VK_VERSION_1_1>" );
-
-      StructureChain<X, Y, Z...>   structureChain;
-      DescriptorSetLayoutSupport & support = structureChain.template get<DescriptorSetLayoutSupport>();
-      getDispatcher()->vkGetDescriptorSetLayoutSupportKHR( static_cast<VkDevice>( m_device ),
-                                                           reinterpret_cast<VkDescriptorSetLayoutCreateInfo const *>( &createInfo ),
-                                                           reinterpret_cast<VkDescriptorSetLayoutSupport *>( &support ) );
-
-      return structureChain;
-    }
-
     //=== VK_KHR_draw_indirect_count ===
 
     // wrapper function for command vkCmdDrawIndirectCountKHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdDrawIndirectCountKHR.html
@@ -24371,15 +23443,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
     //=== VK_NV_device_diagnostic_checkpoints ===
 
-    // wrapper function for command vkCmdSetCheckpointNV, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdSetCheckpointNV.html
-    template <typename CheckpointMarkerType>
-    VULKAN_HPP_INLINE void CommandBuffer::setCheckpointNV( CheckpointMarkerType const & checkpointMarker ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkCmdSetCheckpointNV && "Function <vkCmdSetCheckpointNV> requires <VK_NV_device_diagnostic_checkpoints>" );
-
-      getDispatcher()->vkCmdSetCheckpointNV( static_cast<VkCommandBuffer>( m_commandBuffer ), reinterpret_cast<void const *>( &checkpointMarker ) );
-    }
-
     // wrapper function for command vkGetQueueCheckpointDataNV, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueueCheckpointDataNV.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::vector<CheckpointDataNV> Queue::getCheckpointDataNV() const
     {
@@ -24446,8 +23509,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       Result result = static_cast<Result>(
         getDispatcher()->vkWaitSemaphoresKHR( static_cast<VkDevice>( m_device ), reinterpret_cast<VkSemaphoreWaitInfo const *>( &waitInfo ), timeout ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::waitSemaphoresKHR", { Result::eSuccess, Result::eTimeout } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eTimeout>( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::waitSemaphoresKHR" );
 
       return static_cast<Result>( result );
     }
@@ -24475,8 +23537,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       Result result = static_cast<Result>(
         getDispatcher()->vkSetSwapchainPresentTimingQueueSizeEXT( static_cast<VkDevice>( m_device ), static_cast<VkSwapchainKHR>( m_swapchainKHR ), size ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::setPresentTimingQueueSizeEXT", { Result::eSuccess, Result::eNotReady } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eNotReady>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::setPresentTimingQueueSizeEXT" );
 
       return static_cast<Result>( result );
     }
@@ -24496,8 +23558,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                             static_cast<VkSwapchainKHR>( m_swapchainKHR ),
                                                             reinterpret_cast<VkSwapchainTimingPropertiesEXT *>( &swapchainTimingProperties ),
                                                             &swapchainTimingPropertiesCounter ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::getTimingPropertiesEXT", { Result::eSuccess, Result::eNotReady } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eNotReady>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::getTimingPropertiesEXT" );
 
       return { result, data_ };
     }
@@ -24656,7 +23718,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         static_cast<VkDevice>( m_device ), static_cast<VkSwapchainKHR>( m_swapchainKHR ), static_cast<VkBool32>( localDimmingEnable ) );
     }
 
-#  if defined( VK_USE_PLATFORM_FUCHSIA )
+#    if defined( VK_USE_PLATFORM_FUCHSIA )
     //=== VK_FUCHSIA_imagepipe_surface ===
 
     // wrapper function for command vkCreateImagePipeSurfaceFUCHSIA, see
@@ -24677,9 +23739,9 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Instance::createImagePipeSurfaceFUCHSIA" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, SurfaceKHR( *this, *reinterpret_cast<VkSurfaceKHR *>( &surface ), allocator ) );
     }
-#  endif /*VK_USE_PLATFORM_FUCHSIA*/
+#    endif /*VK_USE_PLATFORM_FUCHSIA*/
 
-#  if defined( VK_USE_PLATFORM_METAL_EXT )
+#    if defined( VK_USE_PLATFORM_METAL_EXT )
     //=== VK_EXT_metal_surface ===
 
     // wrapper function for command vkCreateMetalSurfaceEXT, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateMetalSurfaceEXT.html
@@ -24697,7 +23759,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Instance::createMetalSurfaceEXT" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, SurfaceKHR( *this, *reinterpret_cast<VkSurfaceKHR *>( &surface ), allocator ) );
     }
-#  endif /*VK_USE_PLATFORM_METAL_EXT*/
+#    endif /*VK_USE_PLATFORM_METAL_EXT*/
 
     //=== VK_KHR_fragment_shading_rate ===
 
@@ -24831,14 +23893,13 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       Result result = static_cast<Result>(
         getDispatcher()->vkWaitForPresentKHR( static_cast<VkDevice>( m_device ), static_cast<VkSwapchainKHR>( m_swapchainKHR ), presentId, timeout ) );
 
-#  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result,
-                                                 VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::waitForPresent",
-                                                 { Result::eSuccess, Result::eTimeout, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR } );
-#  else
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::waitForPresent", { Result::eSuccess, Result::eTimeout, Result::eSuboptimalKHR } );
-#  endif
+#    if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eTimeout, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::waitForPresent" );
+#    else
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eTimeout, Result::eSuboptimalKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::waitForPresent" );
+#    endif
 
       return static_cast<Result>( result );
     }
@@ -24912,7 +23973,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( combinations ) );
     }
 
-#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+#    if defined( VK_USE_PLATFORM_WIN32_KHR )
     //=== VK_EXT_full_screen_exclusive ===
 
     // wrapper function for command vkGetPhysicalDeviceSurfacePresentModes2EXT, see
@@ -24997,7 +24058,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( modes ) );
     }
-#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+#    endif /*VK_USE_PLATFORM_WIN32_KHR*/
 
     //=== VK_EXT_headless_surface ===
 
@@ -25140,11 +24201,11 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkCmdBindVertexBuffers2EXT &&
                          "Function <vkCmdBindVertexBuffers2EXT> requires <VK_EXT_extended_dynamic_state> or <VK_EXT_shader_object> or <VK_VERSION_1_3>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( buffers.size() == offsets.size() );
       VULKAN_HPP_ASSERT( sizes.empty() || buffers.size() == sizes.size() );
       VULKAN_HPP_ASSERT( strides.empty() || buffers.size() == strides.size() );
-#  else
+#    else
       if ( buffers.size() != offsets.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::bindVertexBuffers2EXT: buffers.size() != offsets.size()" );
@@ -25157,7 +24218,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::bindVertexBuffers2EXT: buffers.size() != strides.size()" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       getDispatcher()->vkCmdBindVertexBuffers2EXT( static_cast<VkCommandBuffer>( m_commandBuffer ),
                                                    firstBinding,
@@ -25271,8 +24332,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       Result result = static_cast<Result>(
         getDispatcher()->vkGetDeferredOperationResultKHR( static_cast<VkDevice>( m_device ), static_cast<VkDeferredOperationKHR>( m_deferredOperationKHR ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::DeferredOperationKHR::getResult", { Result::eSuccess, Result::eNotReady } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eNotReady>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::DeferredOperationKHR::getResult" );
 
       return static_cast<Result>( result );
     }
@@ -25284,8 +24345,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       Result result = static_cast<Result>(
         getDispatcher()->vkDeferredOperationJoinKHR( static_cast<VkDevice>( m_device ), static_cast<VkDeferredOperationKHR>( m_deferredOperationKHR ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::DeferredOperationKHR::join", { Result::eSuccess, Result::eThreadDoneKHR, Result::eThreadIdleKHR } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eThreadDoneKHR, Result::eThreadIdleKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::DeferredOperationKHR::join" );
 
       return static_cast<Result>( result );
     }
@@ -25445,26 +24506,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return layout;
     }
 
-    // wrapper function for command vkGetImageSubresourceLayout2EXT, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageSubresourceLayout2EXT.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-                                           Image::getSubresourceLayout2EXT( ImageSubresource2 const & subresource ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT(
-        getDispatcher()->vkGetImageSubresourceLayout2EXT &&
-        "Function <vkGetImageSubresourceLayout2EXT> requires <VK_EXT_host_image_copy> or <VK_EXT_image_compression_control> or <VK_KHR_maintenance5> or <VK_VERSION_1_4>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      SubresourceLayout2 &       layout = structureChain.template get<SubresourceLayout2>();
-      getDispatcher()->vkGetImageSubresourceLayout2EXT( static_cast<VkDevice>( m_device ),
-                                                        static_cast<VkImage>( m_image ),
-                                                        reinterpret_cast<VkImageSubresource2 const *>( &subresource ),
-                                                        reinterpret_cast<VkSubresourceLayout2 *>( &layout ) );
-
-      return structureChain;
-    }
-
     //=== VK_KHR_map_memory2 ===
 
     // wrapper function for command vkMapMemory2KHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkMapMemory2KHR.html
@@ -25525,24 +24566,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryRequirements;
     }
 
-    // wrapper function for command vkGetGeneratedCommandsMemoryRequirementsNV, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetGeneratedCommandsMemoryRequirementsNV.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-      Device::getGeneratedCommandsMemoryRequirementsNV( GeneratedCommandsMemoryRequirementsInfoNV const & info ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetGeneratedCommandsMemoryRequirementsNV &&
-                         "Function <vkGetGeneratedCommandsMemoryRequirementsNV> requires <VK_NV_device_generated_commands>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
-      getDispatcher()->vkGetGeneratedCommandsMemoryRequirementsNV( static_cast<VkDevice>( m_device ),
-                                                                   reinterpret_cast<VkGeneratedCommandsMemoryRequirementsInfoNV const *>( &info ),
-                                                                   reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkCmdPreprocessGeneratedCommandsNV, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdPreprocessGeneratedCommandsNV.html
     VULKAN_HPP_INLINE void CommandBuffer::preprocessGeneratedCommandsNV( GeneratedCommandsInfoNV const & generatedCommandsInfo ) const VULKAN_HPP_NOEXCEPT
@@ -25718,26 +24741,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( qualityLevelProperties ) );
     }
 
-    // wrapper function for command vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<StructureChain<X, Y, Z...>>::type
-                         PhysicalDevice::getVideoEncodeQualityLevelPropertiesKHR( PhysicalDeviceVideoEncodeQualityLevelInfoKHR const & qualityLevelInfo ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR &&
-                         "Function <vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR> requires <VK_KHR_video_encode_queue>" );
-
-      StructureChain<X, Y, Z...>             structureChain;
-      VideoEncodeQualityLevelPropertiesKHR & qualityLevelProperties = structureChain.template get<VideoEncodeQualityLevelPropertiesKHR>();
-      Result                                 result = static_cast<Result>( getDispatcher()->vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR(
-        static_cast<VkPhysicalDevice>( m_physicalDevice ),
-        reinterpret_cast<VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR const *>( &qualityLevelInfo ),
-        reinterpret_cast<VkVideoEncodeQualityLevelPropertiesKHR *>( &qualityLevelProperties ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getVideoEncodeQualityLevelPropertiesKHR" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChain ) );
-    }
-
     // wrapper function for command vkGetEncodedVideoSessionParametersKHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetEncodedVideoSessionParametersKHR.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::pair<VideoEncodeSessionParametersFeedbackInfoKHR, std::vector<uint8_t>>>::type
@@ -25775,44 +24778,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data_ ) );
     }
 
-    // wrapper function for command vkGetEncodedVideoSessionParametersKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetEncodedVideoSessionParametersKHR.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::pair<StructureChain<X, Y, Z...>, std::vector<uint8_t>>>::type
-                         Device::getEncodedVideoSessionParametersKHR( VideoEncodeSessionParametersGetInfoKHR const & videoSessionParametersInfo ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetEncodedVideoSessionParametersKHR &&
-                         "Function <vkGetEncodedVideoSessionParametersKHR> requires <VK_KHR_video_encode_queue>" );
-
-      std::pair<StructureChain<X, Y, Z...>, std::vector<uint8_t>> data_;
-      VideoEncodeSessionParametersFeedbackInfoKHR &               feedbackInfo = data_.first.template get<VideoEncodeSessionParametersFeedbackInfoKHR>();
-      std::vector<uint8_t> &                                      data         = data_.second;
-      size_t                                                      dataSize;
-      Result                                                      result;
-      do
-      {
-        result = static_cast<Result>( getDispatcher()->vkGetEncodedVideoSessionParametersKHR(
-          static_cast<VkDevice>( m_device ),
-          reinterpret_cast<VkVideoEncodeSessionParametersGetInfoKHR const *>( &videoSessionParametersInfo ),
-          reinterpret_cast<VkVideoEncodeSessionParametersFeedbackInfoKHR *>( &feedbackInfo ),
-          &dataSize,
-          nullptr ) );
-        if ( ( result == Result::eSuccess ) && dataSize )
-        {
-          data.resize( dataSize );
-          result = static_cast<Result>( getDispatcher()->vkGetEncodedVideoSessionParametersKHR(
-            static_cast<VkDevice>( m_device ),
-            reinterpret_cast<VkVideoEncodeSessionParametersGetInfoKHR const *>( &videoSessionParametersInfo ),
-            reinterpret_cast<VkVideoEncodeSessionParametersFeedbackInfoKHR *>( &feedbackInfo ),
-            &dataSize,
-            reinterpret_cast<void *>( data.data() ) ) );
-        }
-      } while ( result == Result::eIncomplete );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getEncodedVideoSessionParametersKHR" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data_ ) );
-    }
-
     // wrapper function for command vkCmdEncodeVideoKHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdEncodeVideoKHR.html
     VULKAN_HPP_INLINE void CommandBuffer::encodeVideoKHR( VideoEncodeInfoKHR const & encodeInfo ) const VULKAN_HPP_NOEXCEPT
     {
@@ -25835,7 +24800,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result );
     }
 
-#  if defined( VK_ENABLE_BETA_EXTENSIONS )
+#    if defined( VK_ENABLE_BETA_EXTENSIONS )
     //=== VK_NV_cuda_kernel_launch ===
 
     // wrapper function for command vkCreateCudaModuleNV, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateCudaModuleNV.html
@@ -25906,7 +24871,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       getDispatcher()->vkCmdCudaLaunchKernelNV( static_cast<VkCommandBuffer>( m_commandBuffer ), reinterpret_cast<VkCudaLaunchInfoNV const *>( &launchInfo ) );
     }
-#  endif /*VK_ENABLE_BETA_EXTENSIONS*/
+#    endif /*VK_ENABLE_BETA_EXTENSIONS*/
 
     //=== VK_QCOM_tile_shading ===
 
@@ -25968,18 +24933,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       getDispatcher()->vkSetLatencyMarkerLegacyNV( static_cast<VkDevice>( m_device ), frameID, marker );
     }
 
-    // wrapper function for command vkGetLatencyTimingsLegacyNV, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetLatencyTimingsLegacyNV.html
-    template <typename TimingsType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE TimingsType Device::getLatencyTimingsLegacyNV() const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetLatencyTimingsLegacyNV && "Function <vkGetLatencyTimingsLegacyNV> requires <VK_NV_low_latency>" );
-
-      TimingsType timings;
-      getDispatcher()->vkGetLatencyTimingsLegacyNV( static_cast<VkDevice>( m_device ), &timings );
-
-      return timings;
-    }
-
     // wrapper function for command vkQueueNotifyOutOfBandLegacyNV, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkQueueNotifyOutOfBandLegacyNV.html
     VULKAN_HPP_INLINE void Queue::notifyOutOfBandLegacyNV( uint32_t queueType ) const VULKAN_HPP_NOEXCEPT
@@ -26009,7 +24962,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       getDispatcher()->vkShutdownLatencyDeviceLegacyNV( static_cast<VkDevice>( m_device ) );
     }
 
-#  if defined( VK_USE_PLATFORM_METAL_EXT )
+#    if defined( VK_USE_PLATFORM_METAL_EXT )
     //=== VK_EXT_metal_objects ===
 
     // wrapper function for command vkExportMetalObjectsEXT, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkExportMetalObjectsEXT.html
@@ -26019,7 +24972,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       getDispatcher()->vkExportMetalObjectsEXT( static_cast<VkDevice>( m_device ), reinterpret_cast<VkExportMetalObjectsInfoEXT *>( &metalObjectsInfo ) );
     }
-#  endif /*VK_USE_PLATFORM_METAL_EXT*/
+#    endif /*VK_USE_PLATFORM_METAL_EXT*/
 
     //=== VK_KHR_synchronization2 ===
 
@@ -26046,14 +24999,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                           ArrayProxy<DependencyInfo const> const &              dependencyInfos ) const
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkCmdWaitEvents2KHR && "Function <vkCmdWaitEvents2KHR> requires <VK_KHR_synchronization2> or <VK_VERSION_1_3>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( events.size() == dependencyInfos.size() );
-#  else
+#    else
       if ( events.size() != dependencyInfos.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::waitEvents2KHR: events.size() != dependencyInfos.size()" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       getDispatcher()->vkCmdWaitEvents2KHR( static_cast<VkCommandBuffer>( m_commandBuffer ),
                                             events.size(),
@@ -26144,21 +25097,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         static_cast<VkDevice>( m_device ), reinterpret_cast<VkDescriptorGetInfoEXT const *>( &descriptorInfo ), dataSize, pDescriptor );
     }
 
-    // wrapper function for command vkGetDescriptorEXT, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDescriptorEXT.html
-    template <typename DescriptorType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE DescriptorType Device::getDescriptorEXT( DescriptorGetInfoEXT const & descriptorInfo ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDescriptorEXT && "Function <vkGetDescriptorEXT> requires <VK_EXT_descriptor_buffer>" );
-
-      DescriptorType descriptor;
-      getDispatcher()->vkGetDescriptorEXT( static_cast<VkDevice>( m_device ),
-                                           reinterpret_cast<VkDescriptorGetInfoEXT const *>( &descriptorInfo ),
-                                           sizeof( DescriptorType ),
-                                           reinterpret_cast<void *>( &descriptor ) );
-
-      return descriptor;
-    }
-
     // wrapper function for command vkCmdBindDescriptorBuffersEXT, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdBindDescriptorBuffersEXT.html
     VULKAN_HPP_INLINE void
@@ -26181,14 +25119,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkCmdSetDescriptorBufferOffsetsEXT &&
                          "Function <vkCmdSetDescriptorBufferOffsetsEXT> requires <VK_EXT_descriptor_buffer>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( bufferIndices.size() == offsets.size() );
-#  else
+#    else
       if ( bufferIndices.size() != offsets.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::setDescriptorBufferOffsetsEXT: bufferIndices.size() != offsets.size()" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       getDispatcher()->vkCmdSetDescriptorBufferOffsetsEXT( static_cast<VkCommandBuffer>( m_commandBuffer ),
                                                            static_cast<VkPipelineBindPoint>( pipelineBindPoint ),
@@ -26212,91 +25150,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         static_cast<VkCommandBuffer>( m_commandBuffer ), static_cast<VkPipelineBindPoint>( pipelineBindPoint ), static_cast<VkPipelineLayout>( layout ), set );
     }
 
-    // wrapper function for command vkGetBufferOpaqueCaptureDescriptorDataEXT, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetBufferOpaqueCaptureDescriptorDataEXT.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
-                         Device::getBufferOpaqueCaptureDescriptorDataEXT( BufferCaptureDescriptorDataInfoEXT const & info ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetBufferOpaqueCaptureDescriptorDataEXT &&
-                         "Function <vkGetBufferOpaqueCaptureDescriptorDataEXT> requires <VK_EXT_descriptor_buffer>" );
-
-      DataType data;
-      Result   result = static_cast<Result>( getDispatcher()->vkGetBufferOpaqueCaptureDescriptorDataEXT(
-        static_cast<VkDevice>( m_device ), reinterpret_cast<VkBufferCaptureDescriptorDataInfoEXT const *>( &info ), &data ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getBufferOpaqueCaptureDescriptorDataEXT" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
-    // wrapper function for command vkGetImageOpaqueCaptureDescriptorDataEXT, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageOpaqueCaptureDescriptorDataEXT.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
-                         Device::getImageOpaqueCaptureDescriptorDataEXT( ImageCaptureDescriptorDataInfoEXT const & info ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetImageOpaqueCaptureDescriptorDataEXT &&
-                         "Function <vkGetImageOpaqueCaptureDescriptorDataEXT> requires <VK_EXT_descriptor_buffer>" );
-
-      DataType data;
-      Result   result = static_cast<Result>( getDispatcher()->vkGetImageOpaqueCaptureDescriptorDataEXT(
-        static_cast<VkDevice>( m_device ), reinterpret_cast<VkImageCaptureDescriptorDataInfoEXT const *>( &info ), &data ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getImageOpaqueCaptureDescriptorDataEXT" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
-    // wrapper function for command vkGetImageViewOpaqueCaptureDescriptorDataEXT, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageViewOpaqueCaptureDescriptorDataEXT.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
-                         Device::getImageViewOpaqueCaptureDescriptorDataEXT( ImageViewCaptureDescriptorDataInfoEXT const & info ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetImageViewOpaqueCaptureDescriptorDataEXT &&
-                         "Function <vkGetImageViewOpaqueCaptureDescriptorDataEXT> requires <VK_EXT_descriptor_buffer>" );
-
-      DataType data;
-      Result   result = static_cast<Result>( getDispatcher()->vkGetImageViewOpaqueCaptureDescriptorDataEXT(
-        static_cast<VkDevice>( m_device ), reinterpret_cast<VkImageViewCaptureDescriptorDataInfoEXT const *>( &info ), &data ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getImageViewOpaqueCaptureDescriptorDataEXT" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
-    // wrapper function for command vkGetSamplerOpaqueCaptureDescriptorDataEXT, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetSamplerOpaqueCaptureDescriptorDataEXT.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
-                         Device::getSamplerOpaqueCaptureDescriptorDataEXT( SamplerCaptureDescriptorDataInfoEXT const & info ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetSamplerOpaqueCaptureDescriptorDataEXT &&
-                         "Function <vkGetSamplerOpaqueCaptureDescriptorDataEXT> requires <VK_EXT_descriptor_buffer>" );
-
-      DataType data;
-      Result   result = static_cast<Result>( getDispatcher()->vkGetSamplerOpaqueCaptureDescriptorDataEXT(
-        static_cast<VkDevice>( m_device ), reinterpret_cast<VkSamplerCaptureDescriptorDataInfoEXT const *>( &info ), &data ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getSamplerOpaqueCaptureDescriptorDataEXT" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
-    // wrapper function for command vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
-                         Device::getAccelerationStructureOpaqueCaptureDescriptorDataEXT( AccelerationStructureCaptureDescriptorDataInfoEXT const & info ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT &&
-                         "Function <vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT> requires <VK_EXT_descriptor_buffer>" );
-
-      DataType data;
-      Result   result = static_cast<Result>( getDispatcher()->vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT(
-        static_cast<VkDevice>( m_device ), reinterpret_cast<VkAccelerationStructureCaptureDescriptorDataInfoEXT const *>( &info ), &data ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getAccelerationStructureOpaqueCaptureDescriptorDataEXT" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
     //=== VK_KHR_device_address_commands ===
 
     // wrapper function for command vkCmdBindIndexBuffer3KHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdBindIndexBuffer3KHR.html
@@ -26388,21 +25241,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                              pData );
     }
 
-    // wrapper function for command vkCmdUpdateMemoryKHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdUpdateMemoryKHR.html
-    template <typename DataType>
-    VULKAN_HPP_INLINE void CommandBuffer::updateMemoryKHR( DeviceAddressRangeKHR const &      dstRange,
-                                                           AddressCommandFlagsKHR             dstFlags,
-                                                           ArrayProxy<DataType const> const & data ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkCmdUpdateMemoryKHR && "Function <vkCmdUpdateMemoryKHR> requires <VK_KHR_device_address_commands>" );
-
-      getDispatcher()->vkCmdUpdateMemoryKHR( static_cast<VkCommandBuffer>( m_commandBuffer ),
-                                             reinterpret_cast<VkDeviceAddressRangeKHR const *>( &dstRange ),
-                                             static_cast<VkAddressCommandFlagsKHR>( dstFlags ),
-                                             data.size() * sizeof( DataType ),
-                                             reinterpret_cast<void const *>( data.data() ) );
-    }
-
     // wrapper function for command vkCmdFillMemoryKHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdFillMemoryKHR.html
     VULKAN_HPP_INLINE void
       CommandBuffer::fillMemoryKHR( DeviceAddressRangeKHR const & dstRange, AddressCommandFlagsKHR dstFlags, uint32_t data ) const VULKAN_HPP_NOEXCEPT
@@ -26697,6 +25535,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     }
 
     //=== VK_EXT_device_fault ===
+
     // wrapper function for command vkGetDeviceFaultInfoEXT, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceFaultInfoEXT.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE Result Device::getFaultInfoEXT( DeviceFaultCountsEXT * pFaultCounts,
                                                                            DeviceFaultInfoEXT *   pFaultInfo ) const VULKAN_HPP_NOEXCEPT
@@ -26706,7 +25545,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                             reinterpret_cast<VkDeviceFaultCountsEXT *>( pFaultCounts ),
                                                                             reinterpret_cast<VkDeviceFaultInfoEXT *>( pFaultInfo ) ) );
     }
-#  if defined( VK_USE_PLATFORM_WIN32_KHR )
+
+#    if defined( VK_USE_PLATFORM_WIN32_KHR )
     //=== VK_NV_acquire_winrt_display ===
 
     // wrapper function for command vkAcquireWinrtDisplayNV, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkAcquireWinrtDisplayNV.html
@@ -26733,9 +25573,9 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getWinrtDisplayNV" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, DisplayKHR( *this, *reinterpret_cast<VkDisplayKHR *>( &display ) ) );
     }
-#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+#    endif /*VK_USE_PLATFORM_WIN32_KHR*/
 
-#  if defined( VK_USE_PLATFORM_DIRECTFB_EXT )
+#    if defined( VK_USE_PLATFORM_DIRECTFB_EXT )
     //=== VK_EXT_directfb_surface ===
 
     // wrapper function for command vkCreateDirectFBSurfaceEXT, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateDirectFBSurfaceEXT.html
@@ -26767,7 +25607,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return static_cast<Bool32>( result );
     }
-#  endif /*VK_USE_PLATFORM_DIRECTFB_EXT*/
+#    endif /*VK_USE_PLATFORM_DIRECTFB_EXT*/
 
     //=== VK_EXT_vertex_input_dynamic_state ===
 
@@ -26786,7 +25626,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                reinterpret_cast<VkVertexInputAttributeDescription2EXT const *>( vertexAttributeDescriptions.data() ) );
     }
 
-#  if defined( VK_USE_PLATFORM_FUCHSIA )
+#    if defined( VK_USE_PLATFORM_FUCHSIA )
     //=== VK_FUCHSIA_external_memory ===
 
     // wrapper function for command vkGetMemoryZirconHandleFUCHSIA, see
@@ -26822,9 +25662,9 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( memoryZirconHandleProperties ) );
     }
-#  endif /*VK_USE_PLATFORM_FUCHSIA*/
+#    endif /*VK_USE_PLATFORM_FUCHSIA*/
 
-#  if defined( VK_USE_PLATFORM_FUCHSIA )
+#    if defined( VK_USE_PLATFORM_FUCHSIA )
     //=== VK_FUCHSIA_external_semaphore ===
 
     // wrapper function for command vkImportSemaphoreZirconHandleFUCHSIA, see
@@ -26857,9 +25697,9 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( zirconHandle ) );
     }
-#  endif /*VK_USE_PLATFORM_FUCHSIA*/
+#    endif /*VK_USE_PLATFORM_FUCHSIA*/
 
-#  if defined( VK_USE_PLATFORM_FUCHSIA )
+#    if defined( VK_USE_PLATFORM_FUCHSIA )
     //=== VK_FUCHSIA_buffer_collection ===
 
     // wrapper function for command vkCreateBufferCollectionFUCHSIA, see
@@ -26932,7 +25772,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( properties ) );
     }
-#  endif /*VK_USE_PLATFORM_FUCHSIA*/
+#    endif /*VK_USE_PLATFORM_FUCHSIA*/
 
     //=== VK_HUAWEI_subpass_shading ===
 
@@ -27059,7 +25899,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       getDispatcher()->vkCmdSetPrimitiveRestartEnableEXT( static_cast<VkCommandBuffer>( m_commandBuffer ), static_cast<VkBool32>( primitiveRestartEnable ) );
     }
 
-#  if defined( VK_USE_PLATFORM_SCREEN_QNX )
+#    if defined( VK_USE_PLATFORM_SCREEN_QNX )
     //=== VK_QNX_screen_surface ===
 
     // wrapper function for command vkCreateScreenSurfaceQNX, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateScreenSurfaceQNX.html
@@ -27091,7 +25931,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return static_cast<Bool32>( result );
     }
-#  endif /*VK_USE_PLATFORM_SCREEN_QNX*/
+#    endif /*VK_USE_PLATFORM_SCREEN_QNX*/
 
     //=== VK_EXT_color_write_enable ===
 
@@ -27185,9 +26025,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                  static_cast<VkDeferredOperationKHR>( deferredOperation ),
                                                                                  infos.size(),
                                                                                  reinterpret_cast<VkMicromapBuildInfoEXT const *>( infos.data() ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result,
-                                                 VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::buildMicromapsEXT",
-                                                 { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::buildMicromapsEXT" );
 
       return static_cast<Result>( result );
     }
@@ -27201,9 +26040,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       Result result = static_cast<Result>( getDispatcher()->vkCopyMicromapEXT( static_cast<VkDevice>( m_device ),
                                                                                static_cast<VkDeferredOperationKHR>( deferredOperation ),
                                                                                reinterpret_cast<VkCopyMicromapInfoEXT const *>( &info ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result,
-                                                 VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::copyMicromapEXT",
-                                                 { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::copyMicromapEXT" );
 
       return static_cast<Result>( result );
     }
@@ -27217,9 +26055,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       Result result = static_cast<Result>( getDispatcher()->vkCopyMicromapToMemoryEXT( static_cast<VkDevice>( m_device ),
                                                                                        static_cast<VkDeferredOperationKHR>( deferredOperation ),
                                                                                        reinterpret_cast<VkCopyMicromapToMemoryInfoEXT const *>( &info ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result,
-                                                 VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::copyMicromapToMemoryEXT",
-                                                 { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::copyMicromapToMemoryEXT" );
 
       return static_cast<Result>( result );
     }
@@ -27233,9 +26070,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       Result result = static_cast<Result>( getDispatcher()->vkCopyMemoryToMicromapEXT( static_cast<VkDevice>( m_device ),
                                                                                        static_cast<VkDeferredOperationKHR>( deferredOperation ),
                                                                                        reinterpret_cast<VkCopyMemoryToMicromapInfoEXT const *>( &info ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result,
-                                                 VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::copyMemoryToMicromapEXT",
-                                                 { Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::copyMemoryToMicromapEXT" );
 
       return static_cast<Result>( result );
     }
@@ -27259,49 +26095,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                   stride ) );
     }
 
-    // wrapper function for command vkWriteMicromapsPropertiesEXT, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkWriteMicromapsPropertiesEXT.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<DataType>>::type Device::writeMicromapsPropertiesEXT(
-      ArrayProxy<VULKAN_HPP_NAMESPACE::MicromapEXT const> const & micromaps, QueryType queryType, size_t dataSize, size_t stride ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkWriteMicromapsPropertiesEXT && "Function <vkWriteMicromapsPropertiesEXT> requires <VK_EXT_opacity_micromap>" );
-
-      VULKAN_HPP_ASSERT( dataSize % sizeof( DataType ) == 0 );
-      std::vector<DataType> data( dataSize / sizeof( DataType ) );
-      Result result = static_cast<Result>( getDispatcher()->vkWriteMicromapsPropertiesEXT( static_cast<VkDevice>( m_device ),
-                                                                                           micromaps.size(),
-                                                                                           reinterpret_cast<VkMicromapEXT const *>( micromaps.data() ),
-                                                                                           static_cast<VkQueryType>( queryType ),
-                                                                                           data.size() * sizeof( DataType ),
-                                                                                           reinterpret_cast<void *>( data.data() ),
-                                                                                           stride ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::writeMicromapsPropertiesEXT" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
-    // wrapper function for command vkWriteMicromapsPropertiesEXT, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkWriteMicromapsPropertiesEXT.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
-      Device::writeMicromapsPropertyEXT( ArrayProxy<VULKAN_HPP_NAMESPACE::MicromapEXT const> const & micromaps, QueryType queryType, size_t stride ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkWriteMicromapsPropertiesEXT && "Function <vkWriteMicromapsPropertiesEXT> requires <VK_EXT_opacity_micromap>" );
-
-      DataType data;
-      Result   result = static_cast<Result>( getDispatcher()->vkWriteMicromapsPropertiesEXT( static_cast<VkDevice>( m_device ),
-                                                                                             micromaps.size(),
-                                                                                             reinterpret_cast<VkMicromapEXT const *>( micromaps.data() ),
-                                                                                             static_cast<VkQueryType>( queryType ),
-                                                                                             sizeof( DataType ),
-                                                                                             reinterpret_cast<void *>( &data ),
-                                                                                             stride ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::writeMicromapsPropertyEXT" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
     // wrapper function for command vkCmdCopyMicromapEXT, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdCopyMicromapEXT.html
     VULKAN_HPP_INLINE void CommandBuffer::copyMicromapEXT( CopyMicromapInfoEXT const & info ) const VULKAN_HPP_NOEXCEPT
     {
@@ -27430,24 +26223,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryRequirements;
     }
 
-    // wrapper function for command vkGetDeviceBufferMemoryRequirementsKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceBufferMemoryRequirementsKHR.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-                                           Device::getBufferMemoryRequirementsKHR( DeviceBufferMemoryRequirements const & info ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDeviceBufferMemoryRequirementsKHR &&
-                         "Function <vkGetDeviceBufferMemoryRequirementsKHR> requires <VK_KHR_maintenance4> or <VK_VERSION_1_3>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
-      getDispatcher()->vkGetDeviceBufferMemoryRequirementsKHR( static_cast<VkDevice>( m_device ),
-                                                               reinterpret_cast<VkDeviceBufferMemoryRequirements const *>( &info ),
-                                                               reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetDeviceImageMemoryRequirementsKHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceImageMemoryRequirementsKHR.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE MemoryRequirements2
@@ -27464,24 +26239,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryRequirements;
     }
 
-    // wrapper function for command vkGetDeviceImageMemoryRequirementsKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceImageMemoryRequirementsKHR.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-                                           Device::getImageMemoryRequirementsKHR( DeviceImageMemoryRequirements const & info ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDeviceImageMemoryRequirementsKHR &&
-                         "Function <vkGetDeviceImageMemoryRequirementsKHR> requires <VK_KHR_maintenance4> or <VK_VERSION_1_3>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
-      getDispatcher()->vkGetDeviceImageMemoryRequirementsKHR( static_cast<VkDevice>( m_device ),
-                                                              reinterpret_cast<VkDeviceImageMemoryRequirements const *>( &info ),
-                                                              reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetDeviceImageSparseMemoryRequirementsKHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceImageSparseMemoryRequirementsKHR.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::vector<SparseImageMemoryRequirements2>
@@ -27629,24 +26386,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryRequirements;
     }
 
-    // wrapper function for command vkGetPipelineIndirectMemoryRequirementsNV, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPipelineIndirectMemoryRequirementsNV.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-      Device::getPipelineIndirectMemoryRequirementsNV( ComputePipelineCreateInfo const & createInfo ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPipelineIndirectMemoryRequirementsNV &&
-                         "Function <vkGetPipelineIndirectMemoryRequirementsNV> requires <VK_NV_device_generated_commands_compute>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
-      getDispatcher()->vkGetPipelineIndirectMemoryRequirementsNV( static_cast<VkDevice>( m_device ),
-                                                                  reinterpret_cast<VkComputePipelineCreateInfo const *>( &createInfo ),
-                                                                  reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkCmdUpdatePipelineIndirectBufferNV, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdUpdatePipelineIndirectBufferNV.html
     VULKAN_HPP_INLINE void CommandBuffer::updatePipelineIndirectBufferNV( PipelineBindPoint              pipelineBindPoint,
@@ -27673,7 +26412,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return static_cast<DeviceAddress>( result );
     }
 
-#  if defined( VK_USE_PLATFORM_OHOS )
+#    if defined( VK_USE_PLATFORM_OHOS )
     //=== VK_OHOS_external_memory ===
 
     // wrapper function for command vkGetNativeBufferPropertiesOHOS, see
@@ -27691,23 +26430,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( properties ) );
     }
 
-    // wrapper function for command vkGetNativeBufferPropertiesOHOS, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetNativeBufferPropertiesOHOS.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<StructureChain<X, Y, Z...>>::type
-                         Device::getNativeBufferPropertiesOHOS( struct OH_NativeBuffer const & buffer ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetNativeBufferPropertiesOHOS && "Function <vkGetNativeBufferPropertiesOHOS> requires <VK_OHOS_external_memory>" );
-
-      StructureChain<X, Y, Z...>   structureChain;
-      NativeBufferPropertiesOHOS & properties = structureChain.template get<NativeBufferPropertiesOHOS>();
-      Result                       result     = static_cast<Result>( getDispatcher()->vkGetNativeBufferPropertiesOHOS(
-        static_cast<VkDevice>( m_device ), &buffer, reinterpret_cast<VkNativeBufferPropertiesOHOS *>( &properties ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getNativeBufferPropertiesOHOS" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChain ) );
-    }
-
     // wrapper function for command vkGetMemoryNativeBufferOHOS, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetMemoryNativeBufferOHOS.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<struct OH_NativeBuffer *>::type
                          Device::getMemoryNativeBufferOHOS( MemoryGetNativeBufferInfoOHOS const & info ) const
@@ -27721,7 +26443,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( buffer ) );
     }
-#  endif /*VK_USE_PLATFORM_OHOS*/
+#    endif /*VK_USE_PLATFORM_OHOS*/
 
     //=== VK_EXT_extended_dynamic_state3 ===
 
@@ -27759,15 +26481,15 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkCmdSetSampleMaskEXT &&
                          "Function <vkCmdSetSampleMaskEXT> requires <VK_EXT_extended_dynamic_state3> or <VK_EXT_shader_object>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( sampleMask.size() == ( static_cast<uint32_t>( samples ) + 31 ) / 32 );
-#  else
+#    else
       if ( sampleMask.size() != ( static_cast<uint32_t>( samples ) + 31 ) / 32 )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING
                           "::CommandBuffer::setSampleMaskEXT: sampleMask.size() != ( static_cast<uint32_t>( samples ) + 31 ) / 32" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       getDispatcher()->vkCmdSetSampleMaskEXT( static_cast<VkCommandBuffer>( m_commandBuffer ),
                                               static_cast<VkSampleCountFlagBits>( samples ),
@@ -28119,23 +26841,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryRequirements;
     }
 
-    // wrapper function for command vkGetTensorMemoryRequirementsARM, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetTensorMemoryRequirementsARM.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-                                           Device::getTensorMemoryRequirementsARM( TensorMemoryRequirementsInfoARM const & info ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetTensorMemoryRequirementsARM && "Function <vkGetTensorMemoryRequirementsARM> requires <VK_ARM_tensors>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
-      getDispatcher()->vkGetTensorMemoryRequirementsARM( static_cast<VkDevice>( m_device ),
-                                                         reinterpret_cast<VkTensorMemoryRequirementsInfoARM const *>( &info ),
-                                                         reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkBindTensorMemoryARM, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkBindTensorMemoryARM.html
     VULKAN_HPP_INLINE typename ResultValueType<void>::type Device::bindTensorMemoryARM( ArrayProxy<BindTensorMemoryInfoARM const> const & bindInfos ) const
     {
@@ -28164,24 +26869,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryRequirements;
     }
 
-    // wrapper function for command vkGetDeviceTensorMemoryRequirementsARM, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceTensorMemoryRequirementsARM.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-                                           Device::getTensorMemoryRequirementsARM( DeviceTensorMemoryRequirementsARM const & info ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDeviceTensorMemoryRequirementsARM &&
-                         "Function <vkGetDeviceTensorMemoryRequirementsARM> requires <VK_ARM_tensors>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
-      getDispatcher()->vkGetDeviceTensorMemoryRequirementsARM( static_cast<VkDevice>( m_device ),
-                                                               reinterpret_cast<VkDeviceTensorMemoryRequirementsARM const *>( &info ),
-                                                               reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkCmdCopyTensorARM, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdCopyTensorARM.html
     VULKAN_HPP_INLINE void CommandBuffer::copyTensorARM( CopyTensorInfoARM const & copyTensorInfo ) const VULKAN_HPP_NOEXCEPT
     {
@@ -28206,40 +26893,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return externalTensorProperties;
     }
 
-    // wrapper function for command vkGetTensorOpaqueCaptureDescriptorDataARM, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetTensorOpaqueCaptureDescriptorDataARM.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
-                         Device::getTensorOpaqueCaptureDescriptorDataARM( TensorCaptureDescriptorDataInfoARM const & info ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetTensorOpaqueCaptureDescriptorDataARM &&
-                         "Function <vkGetTensorOpaqueCaptureDescriptorDataARM> requires <VK_ARM_tensors>" );
-
-      DataType data;
-      Result   result = static_cast<Result>( getDispatcher()->vkGetTensorOpaqueCaptureDescriptorDataARM(
-        static_cast<VkDevice>( m_device ), reinterpret_cast<VkTensorCaptureDescriptorDataInfoARM const *>( &info ), &data ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getTensorOpaqueCaptureDescriptorDataARM" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
-    // wrapper function for command vkGetTensorViewOpaqueCaptureDescriptorDataARM, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetTensorViewOpaqueCaptureDescriptorDataARM.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
-                         Device::getTensorViewOpaqueCaptureDescriptorDataARM( TensorViewCaptureDescriptorDataInfoARM const & info ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetTensorViewOpaqueCaptureDescriptorDataARM &&
-                         "Function <vkGetTensorViewOpaqueCaptureDescriptorDataARM> requires <VK_ARM_tensors>" );
-
-      DataType data;
-      Result   result = static_cast<Result>( getDispatcher()->vkGetTensorViewOpaqueCaptureDescriptorDataARM(
-        static_cast<VkDevice>( m_device ), reinterpret_cast<VkTensorViewCaptureDescriptorDataInfoARM const *>( &info ), &data ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getTensorViewOpaqueCaptureDescriptorDataARM" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
-    }
-
     //=== VK_EXT_shader_module_identifier ===
 
     // wrapper function for command vkGetShaderModuleIdentifierEXT, see
@@ -28408,24 +27061,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return layout;
     }
 
-    // wrapper function for command vkGetDeviceImageSubresourceLayoutKHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceImageSubresourceLayoutKHR.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-                                           Device::getImageSubresourceLayoutKHR( DeviceImageSubresourceInfo const & info ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDeviceImageSubresourceLayoutKHR &&
-                         "Function <vkGetDeviceImageSubresourceLayoutKHR> requires <VK_KHR_maintenance5> or <VK_VERSION_1_4>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      SubresourceLayout2 &       layout = structureChain.template get<SubresourceLayout2>();
-      getDispatcher()->vkGetDeviceImageSubresourceLayoutKHR( static_cast<VkDevice>( m_device ),
-                                                             reinterpret_cast<VkDeviceImageSubresourceInfo const *>( &info ),
-                                                             reinterpret_cast<VkSubresourceLayout2 *>( &layout ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkGetImageSubresourceLayout2KHR, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageSubresourceLayout2KHR.html
     VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE SubresourceLayout2 Image::getSubresourceLayout2KHR( ImageSubresource2 const & subresource ) const VULKAN_HPP_NOEXCEPT
@@ -28443,26 +27078,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return layout;
     }
 
-    // wrapper function for command vkGetImageSubresourceLayout2KHR, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageSubresourceLayout2KHR.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-                                           Image::getSubresourceLayout2KHR( ImageSubresource2 const & subresource ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT(
-        getDispatcher()->vkGetImageSubresourceLayout2KHR &&
-        "Function <vkGetImageSubresourceLayout2KHR> requires <VK_EXT_host_image_copy> or <VK_EXT_image_compression_control> or <VK_KHR_maintenance5> or <VK_VERSION_1_4>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      SubresourceLayout2 &       layout = structureChain.template get<SubresourceLayout2>();
-      getDispatcher()->vkGetImageSubresourceLayout2KHR( static_cast<VkDevice>( m_device ),
-                                                        static_cast<VkImage>( m_image ),
-                                                        reinterpret_cast<VkImageSubresource2 const *>( &subresource ),
-                                                        reinterpret_cast<VkSubresourceLayout2 *>( &layout ) );
-
-      return structureChain;
-    }
-
     //=== VK_AMD_anti_lag ===
 
     // wrapper function for command vkAntiLagUpdateAMD, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkAntiLagUpdateAMD.html
@@ -28484,14 +27099,13 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                   static_cast<VkSwapchainKHR>( m_swapchainKHR ),
                                                                                   reinterpret_cast<VkPresentWait2InfoKHR const *>( &presentWait2Info ) ) );
 
-#  if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result,
-                                                 VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::waitForPresent2",
-                                                 { Result::eSuccess, Result::eTimeout, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR } );
-#  else
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::waitForPresent2", { Result::eSuccess, Result::eTimeout, Result::eSuboptimalKHR } );
-#  endif
+#    if defined( VULKAN_HPP_HANDLE_ERROR_OUT_OF_DATE_AS_SUCCESS )
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eTimeout, Result::eSuboptimalKHR, Result::eErrorOutOfDateKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::waitForPresent2" );
+#    else
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eTimeout, Result::eSuboptimalKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::SwapchainKHR::waitForPresent2" );
+#    endif
 
       return static_cast<Result>( result );
     }
@@ -28510,8 +27124,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                 reinterpret_cast<VkShaderCreateInfoEXT const *>( createInfos.data() ),
                                                                                 reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                                 reinterpret_cast<VkShaderEXT *>( shaders.data() ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createShadersEXT", { Result::eSuccess, Result::eIncompatibleShaderBinaryEXT } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eIncompatibleShaderBinaryEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createShadersEXT" );
       std::vector<ShaderEXT> shadersRAII;
       if ( result == Result::eSuccess )
       {
@@ -28537,8 +27151,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                                 reinterpret_cast<VkShaderCreateInfoEXT const *>( &createInfo ),
                                                                                 reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                                 reinterpret_cast<VkShaderEXT *>( &shader ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createShaderEXT", { Result::eSuccess, Result::eIncompatibleShaderBinaryEXT } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eIncompatibleShaderBinaryEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createShaderEXT" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, ShaderEXT( *this, *reinterpret_cast<VkShaderEXT *>( &shader ), allocator, result ) );
     }
 
@@ -28575,14 +27189,14 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                           ArrayProxy<VULKAN_HPP_NAMESPACE::ShaderEXT const> const & shaders ) const
     {
       VULKAN_HPP_ASSERT( getDispatcher()->vkCmdBindShadersEXT && "Function <vkCmdBindShadersEXT> requires <VK_EXT_shader_object>" );
-#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+#    ifdef VULKAN_HPP_NO_EXCEPTIONS
       VULKAN_HPP_ASSERT( stages.size() == shaders.size() );
-#  else
+#    else
       if ( stages.size() != shaders.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::bindShadersEXT: stages.size() != shaders.size()" );
       }
-#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+#    endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       getDispatcher()->vkCmdBindShadersEXT( static_cast<VkCommandBuffer>( m_commandBuffer ),
                                             stages.size(),
@@ -28642,9 +27256,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         }
       }
 
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result,
-                                                 VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createPipelineBinariesKHR",
-                                                 { Result::eSuccess, Result::eIncomplete, Result::ePipelineBinaryMissingKHR } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eIncomplete, Result::ePipelineBinaryMissingKHR>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createPipelineBinariesKHR" );
       std::vector<PipelineBinaryKHR> pipelineBinariesRAII;
       if ( result == Result::eSuccess )
       {
@@ -28827,8 +27440,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       Result result = static_cast<Result>( getDispatcher()->vkConvertCooperativeVectorMatrixNV(
         static_cast<VkDevice>( m_device ), reinterpret_cast<VkConvertCooperativeVectorMatrixInfoNV const *>( &info ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::convertCooperativeVectorMatrixNV", { Result::eSuccess, Result::eIncomplete } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eIncomplete>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::convertCooperativeVectorMatrixNV" );
 
       return static_cast<Result>( result );
     }
@@ -28952,8 +27565,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                              reinterpret_cast<VkDataGraphPipelineCreateInfoARM const *>( createInfos.data() ),
                                                                              reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                              reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createDataGraphPipelinesARM", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createDataGraphPipelinesARM" );
       std::vector<Pipeline> pipelinesRAII;
       if ( result == Result::eSuccess )
       {
@@ -28985,8 +27598,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                              reinterpret_cast<VkDataGraphPipelineCreateInfoARM const *>( &createInfo ),
                                                                              reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
                                                                              reinterpret_cast<VkPipeline *>( &pipeline ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createDataGraphPipelineARM", { Result::eSuccess, Result::ePipelineCompileRequiredEXT } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createDataGraphPipelineARM" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, Pipeline( *this, *reinterpret_cast<VkPipeline *>( &pipeline ), allocator, result ) );
     }
 
@@ -29064,25 +27677,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryRequirements;
     }
 
-    // wrapper function for command vkGetDataGraphPipelineSessionMemoryRequirementsARM, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDataGraphPipelineSessionMemoryRequirementsARM.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-      Device::getDataGraphPipelineSessionMemoryRequirementsARM( DataGraphPipelineSessionMemoryRequirementsInfoARM const & info ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDataGraphPipelineSessionMemoryRequirementsARM &&
-                         "Function <vkGetDataGraphPipelineSessionMemoryRequirementsARM> requires <VK_ARM_data_graph>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
-      getDispatcher()->vkGetDataGraphPipelineSessionMemoryRequirementsARM(
-        static_cast<VkDevice>( m_device ),
-        reinterpret_cast<VkDataGraphPipelineSessionMemoryRequirementsInfoARM const *>( &info ),
-        reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkBindDataGraphPipelineSessionMemoryARM, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkBindDataGraphPipelineSessionMemoryARM.html
     VULKAN_HPP_INLINE typename ResultValueType<void>::type
@@ -29248,7 +27842,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
                                                                 static_cast<VkImageAspectFlags>( aspectMask ) );
     }
 
-#  if defined( VK_USE_PLATFORM_SCREEN_QNX )
+#    if defined( VK_USE_PLATFORM_SCREEN_QNX )
     //=== VK_QNX_external_memory_screen_buffer ===
 
     // wrapper function for command vkGetScreenBufferPropertiesQNX, see
@@ -29266,25 +27860,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( properties ) );
     }
-
-    // wrapper function for command vkGetScreenBufferPropertiesQNX, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetScreenBufferPropertiesQNX.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<StructureChain<X, Y, Z...>>::type
-                         Device::getScreenBufferPropertiesQNX( struct _screen_buffer const & buffer ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetScreenBufferPropertiesQNX &&
-                         "Function <vkGetScreenBufferPropertiesQNX> requires <VK_QNX_external_memory_screen_buffer>" );
-
-      StructureChain<X, Y, Z...>  structureChain;
-      ScreenBufferPropertiesQNX & properties = structureChain.template get<ScreenBufferPropertiesQNX>();
-      Result                      result     = static_cast<Result>( getDispatcher()->vkGetScreenBufferPropertiesQNX(
-        static_cast<VkDevice>( m_device ), &buffer, reinterpret_cast<VkScreenBufferPropertiesQNX *>( &properties ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getScreenBufferPropertiesQNX" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChain ) );
-    }
-#  endif /*VK_USE_PLATFORM_SCREEN_QNX*/
+#    endif /*VK_USE_PLATFORM_SCREEN_QNX*/
 
     //=== VK_KHR_line_rasterization ===
 
@@ -29524,23 +28100,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
         result, ExternalComputeQueueNV( *this, *reinterpret_cast<VkExternalComputeQueueNV *>( &externalQueue ), allocator ) );
     }
 
-    // wrapper function for command vkGetExternalComputeQueueDataNV, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetExternalComputeQueueDataNV.html
-    template <typename DataType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::pair<ExternalComputeQueueDataParamsNV, DataType> ExternalComputeQueueNV::getData() const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetExternalComputeQueueDataNV &&
-                         "Function <vkGetExternalComputeQueueDataNV> requires <VK_NV_external_compute_queue>" );
-
-      std::pair<ExternalComputeQueueDataParamsNV, DataType> data_;
-      ExternalComputeQueueDataParamsNV &                    arams = data_.first;
-      DataType &                                            data  = data_.second;
-      getDispatcher()->vkGetExternalComputeQueueDataNV(
-        static_cast<VkExternalComputeQueueNV>( m_externalComputeQueueNV ), reinterpret_cast<VkExternalComputeQueueDataParamsNV *>( &arams ), &data );
-
-      return data_;
-    }
-
     //=== VK_NV_cluster_acceleration_structure ===
 
     // wrapper function for command vkGetClusterAccelerationStructureBuildSizesNV, see
@@ -29620,24 +28179,6 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return memoryRequirements;
     }
 
-    // wrapper function for command vkGetGeneratedCommandsMemoryRequirementsEXT, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetGeneratedCommandsMemoryRequirementsEXT.html
-    template <typename X, typename Y, typename... Z>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
-      Device::getGeneratedCommandsMemoryRequirementsEXT( GeneratedCommandsMemoryRequirementsInfoEXT const & info ) const VULKAN_HPP_NOEXCEPT
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetGeneratedCommandsMemoryRequirementsEXT &&
-                         "Function <vkGetGeneratedCommandsMemoryRequirementsEXT> requires <VK_EXT_device_generated_commands>" );
-
-      StructureChain<X, Y, Z...> structureChain;
-      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
-      getDispatcher()->vkGetGeneratedCommandsMemoryRequirementsEXT( static_cast<VkDevice>( m_device ),
-                                                                    reinterpret_cast<VkGeneratedCommandsMemoryRequirementsInfoEXT const *>( &info ),
-                                                                    reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
-
-      return structureChain;
-    }
-
     // wrapper function for command vkCmdPreprocessGeneratedCommandsEXT, see
     // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdPreprocessGeneratedCommandsEXT.html
     VULKAN_HPP_INLINE void CommandBuffer::preprocessGeneratedCommandsEXT( GeneratedCommandsInfoEXT const &    generatedCommandsInfo,
@@ -29752,8 +28293,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
             static_cast<VkDevice>( m_device ), timeout, &faultCounts, reinterpret_cast<VkDeviceFaultInfoKHR *>( faultInfo.data() ) ) );
         }
       } while ( result == Result::eIncomplete );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck(
-        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getFaultReportsKHR", { Result::eSuccess, Result::eIncomplete, Result::eTimeout } );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eIncomplete, Result::eTimeout>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getFaultReportsKHR" );
       VULKAN_HPP_ASSERT( faultCounts <= faultInfo.size() );
       if ( faultCounts < faultInfo.size() )
       {
@@ -29770,7 +28311,8 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return static_cast<Result>(
         getDispatcher()->vkGetDeviceFaultDebugInfoKHR( static_cast<VkDevice>( m_device ), reinterpret_cast<VkDeviceFaultDebugInfoKHR *>( pDebugInfo ) ) );
     }
-#  if defined( VK_USE_PLATFORM_OHOS )
+
+#    if defined( VK_USE_PLATFORM_OHOS )
     //=== VK_OHOS_surface ===
 
     // wrapper function for command vkCreateSurfaceOHOS, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateSurfaceOHOS.html
@@ -29788,7 +28330,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Instance::createSurfaceOHOS" );
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, SurfaceKHR( *this, *reinterpret_cast<VkSurfaceKHR *>( &surface ), allocator ) );
     }
-#  endif /*VK_USE_PLATFORM_OHOS*/
+#    endif /*VK_USE_PLATFORM_OHOS*/
 
     //=== VK_NV_cooperative_matrix2 ===
 
@@ -29826,7 +28368,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( properties ) );
     }
 
-#  if defined( VK_USE_PLATFORM_METAL_EXT )
+#    if defined( VK_USE_PLATFORM_METAL_EXT )
     //=== VK_EXT_external_memory_metal ===
 
     // wrapper function for command vkGetMemoryMetalHandleEXT, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetMemoryMetalHandleEXT.html
@@ -29842,27 +28384,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( handle ) );
     }
-
-    // wrapper function for command vkGetMemoryMetalHandlePropertiesEXT, see
-    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetMemoryMetalHandlePropertiesEXT.html
-    template <typename HandleType>
-    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<MemoryMetalHandlePropertiesEXT>::type
-                         Device::getMemoryMetalHandlePropertiesEXT( ExternalMemoryHandleTypeFlagBits handleType, HandleType const & handle ) const
-    {
-      VULKAN_HPP_ASSERT( getDispatcher()->vkGetMemoryMetalHandlePropertiesEXT &&
-                         "Function <vkGetMemoryMetalHandlePropertiesEXT> requires <VK_EXT_external_memory_metal>" );
-
-      MemoryMetalHandlePropertiesEXT memoryMetalHandleProperties;
-      Result                         result = static_cast<Result>(
-        getDispatcher()->vkGetMemoryMetalHandlePropertiesEXT( static_cast<VkDevice>( m_device ),
-                                                              static_cast<VkExternalMemoryHandleTypeFlagBits>( handleType ),
-                                                              reinterpret_cast<void const *>( &handle ),
-                                                              reinterpret_cast<VkMemoryMetalHandlePropertiesEXT *>( &memoryMetalHandleProperties ) ) );
-      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getMemoryMetalHandlePropertiesEXT" );
-
-      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( memoryMetalHandleProperties ) );
-    }
-#  endif /*VK_USE_PLATFORM_METAL_EXT*/
+#    endif /*VK_USE_PLATFORM_METAL_EXT*/
 
     //=== VK_ARM_performance_counters_by_region ===
 
@@ -30143,7 +28665,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( properties ) );
     }
 
-#  if defined( VK_USE_PLATFORM_UBM_SEC )
+#    if defined( VK_USE_PLATFORM_UBM_SEC )
     //=== VK_SEC_ubm_surface ===
 
     // wrapper function for command vkCreateUbmSurfaceSEC, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateUbmSurfaceSEC.html
@@ -30176,7 +28698,7 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
 
       return { result, device };
     }
-#  endif /*VK_USE_PLATFORM_UBM_SEC*/
+#    endif /*VK_USE_PLATFORM_UBM_SEC*/
 
     //=== VK_EXT_primitive_restart_index ===
 
@@ -30190,6 +28712,2129 @@ VULKAN_HPP_EXPORT namespace VULKAN_HPP_NAMESPACE
       getDispatcher()->vkCmdSetPrimitiveRestartIndexEXT( static_cast<VkCommandBuffer>( m_commandBuffer ), primitiveRestartIndex );
     }
 
+#    if defined( VULKAN_HPP_COMPILED_DEFINITIONS )
+#      pragma pop_macro( "VULKAN_HPP_INLINE" )
+#    endif
+#  endif
+
+    //====================================
+    //=== COMMAND Template Definitions ===
+    //====================================
+
+    //=== VK_VERSION_1_0 ===
+
+    // wrapper function for command vkGetQueryPoolResults, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueryPoolResults.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE ResultValue<std::vector<DataType>>
+      QueryPool::getResults( uint32_t firstQuery, uint32_t queryCount, size_t dataSize, DeviceSize stride, QueryResultFlags flags ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetQueryPoolResults && "Function <vkGetQueryPoolResults> requires <VK_VERSION_1_0>" );
+
+      VULKAN_HPP_ASSERT( dataSize % sizeof( DataType ) == 0 );
+      std::vector<DataType> data( dataSize / sizeof( DataType ) );
+      Result                result = static_cast<Result>( getDispatcher()->vkGetQueryPoolResults( static_cast<VkDevice>( m_device ),
+                                                                                                  static_cast<VkQueryPool>( m_queryPool ),
+                                                                                                  firstQuery,
+                                                                                                  queryCount,
+                                                                                                  data.size() * sizeof( DataType ),
+                                                                                                  reinterpret_cast<void *>( data.data() ),
+                                                                                                  static_cast<VkDeviceSize>( stride ),
+                                                                                                  static_cast<VkQueryResultFlags>( flags ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eNotReady>( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::QueryPool::getResults" );
+
+      return { result, data };
+    }
+
+    // wrapper function for command vkGetQueryPoolResults, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueryPoolResults.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE ResultValue<DataType>
+                                           QueryPool::getResult( uint32_t firstQuery, uint32_t queryCount, DeviceSize stride, QueryResultFlags flags ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetQueryPoolResults && "Function <vkGetQueryPoolResults> requires <VK_VERSION_1_0>" );
+
+      DataType data;
+      Result   result = static_cast<Result>( getDispatcher()->vkGetQueryPoolResults( static_cast<VkDevice>( m_device ),
+                                                                                     static_cast<VkQueryPool>( m_queryPool ),
+                                                                                     firstQuery,
+                                                                                     queryCount,
+                                                                                     sizeof( DataType ),
+                                                                                     reinterpret_cast<void *>( &data ),
+                                                                                     static_cast<VkDeviceSize>( stride ),
+                                                                                     static_cast<VkQueryResultFlags>( flags ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eNotReady>( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::QueryPool::getResult" );
+
+      return { result, data };
+    }
+
+    // wrapper function for command vkGetQueryPoolResults, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueryPoolResults.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE ResultValue<QueryResultView<DataType>>
+      QueryPool::getResults( uint32_t firstQuery, uint32_t queryCount, ArrayProxyNoTemporaries<uint32_t> const & data, QueryResultFlags flags ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetQueryPoolResults && "Function <vkGetQueryPoolResults> requires <VK_VERSION_1_0>" );
+
+      // e64 follows from the storage, the stride from DataType and the availability or status word
+      flags &= ~QueryResultFlagBits::e64;
+      uint32_t stride = QueryResultView<DataType>::queryStride( flags );
+      VULKAN_HPP_ASSERT( queryCount * stride <= data.size() * sizeof( uint32_t ) );
+      Result result = static_cast<Result>( getDispatcher()->vkGetQueryPoolResults( static_cast<VkDevice>( m_device ),
+                                                                                   static_cast<VkQueryPool>( m_queryPool ),
+                                                                                   firstQuery,
+                                                                                   queryCount,
+                                                                                   data.size() * sizeof( uint32_t ),
+                                                                                   reinterpret_cast<void *>( data.data() ),
+                                                                                   static_cast<VkDeviceSize>( stride ),
+                                                                                   static_cast<VkQueryResultFlags>( flags ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eNotReady>( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::QueryPool::getResults" );
+
+      return { result, QueryResultView<DataType>( queryCount, reinterpret_cast<DataType const *>( data.data() ), flags ) };
+    }
+
+    // wrapper function for command vkGetQueryPoolResults, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetQueryPoolResults.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE ResultValue<QueryResultView<DataType>>
+      QueryPool::getResults( uint32_t firstQuery, uint32_t queryCount, ArrayProxyNoTemporaries<uint64_t> const & data, QueryResultFlags flags ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetQueryPoolResults && "Function <vkGetQueryPoolResults> requires <VK_VERSION_1_0>" );
+
+      // e64 follows from the storage, the stride from DataType and the availability or status word
+      flags |= QueryResultFlagBits::e64;
+      uint32_t stride = QueryResultView<DataType>::queryStride( flags );
+      VULKAN_HPP_ASSERT( queryCount * stride <= data.size() * sizeof( uint64_t ) );
+      Result result = static_cast<Result>( getDispatcher()->vkGetQueryPoolResults( static_cast<VkDevice>( m_device ),
+                                                                                   static_cast<VkQueryPool>( m_queryPool ),
+                                                                                   firstQuery,
+                                                                                   queryCount,
+                                                                                   data.size() * sizeof( uint64_t ),
+                                                                                   reinterpret_cast<void *>( data.data() ),
+                                                                                   static_cast<VkDeviceSize>( stride ),
+                                                                                   static_cast<VkQueryResultFlags>( flags ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eNotReady>( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::QueryPool::getResults" );
+
+      return { result, QueryResultView<DataType>( queryCount, reinterpret_cast<DataType const *>( data.data() ), flags ) };
+    }
+
+    // wrapper function for command vkCmdUpdateBuffer, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdUpdateBuffer.html
+    template <typename DataType>
+    VULKAN_HPP_INLINE void CommandBuffer::updateBuffer( VULKAN_HPP_NAMESPACE::Buffer       dstBuffer,
+                                                        DeviceSize                         dstOffset,
+                                                        ArrayProxy<DataType const> const & data ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkCmdUpdateBuffer && "Function <vkCmdUpdateBuffer> requires <VK_VERSION_1_0>" );
+
+      getDispatcher()->vkCmdUpdateBuffer( static_cast<VkCommandBuffer>( m_commandBuffer ),
+                                          static_cast<VkBuffer>( dstBuffer ),
+                                          static_cast<VkDeviceSize>( dstOffset ),
+                                          data.size() * sizeof( DataType ),
+                                          reinterpret_cast<void const *>( data.data() ) );
+    }
+
+    // wrapper function for command vkCmdPushConstants, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdPushConstants.html
+    template <typename ValuesType>
+    VULKAN_HPP_INLINE void CommandBuffer::pushConstants( VULKAN_HPP_NAMESPACE::PipelineLayout layout,
+                                                         ShaderStageFlags                     stageFlags,
+                                                         uint32_t                             offset,
+                                                         ArrayProxy<ValuesType const> const & values ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkCmdPushConstants && "Function <vkCmdPushConstants> requires <VK_VERSION_1_0>" );
+
+      getDispatcher()->vkCmdPushConstants( static_cast<VkCommandBuffer>( m_commandBuffer ),
+                                           static_cast<VkPipelineLayout>( layout ),
+                                           static_cast<VkShaderStageFlags>( stageFlags ),
+                                           offset,
+                                           values.size() * sizeof( ValuesType ),
+                                           reinterpret_cast<void const *>( values.data() ) );
+    }
+
+    // wrapper function for command vkEnumeratePhysicalDevices, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkEnumeratePhysicalDevices.html
+    template <typename PhysicalDeviceAllocator,
+              typename std::enable_if<std::is_same<typename PhysicalDeviceAllocator::value_type, PhysicalDevice>::value, int>::type>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<PhysicalDevice, PhysicalDeviceAllocator>>::type
+                         Instance::enumeratePhysicalDevices( PhysicalDeviceAllocator const & physicalDeviceAllocator ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkEnumeratePhysicalDevices && "Function <vkEnumeratePhysicalDevices> requires <VK_VERSION_1_0>" );
+
+      std::vector<VULKAN_HPP_NAMESPACE::PhysicalDevice,
+                  typename std::allocator_traits<PhysicalDeviceAllocator>::template rebind_alloc<VULKAN_HPP_NAMESPACE::PhysicalDevice>>
+        physicalDevices( physicalDeviceAllocator );
+      uint32_t physicalDeviceCount;
+      Result   result;
+      do
+      {
+        result = static_cast<Result>( getDispatcher()->vkEnumeratePhysicalDevices( static_cast<VkInstance>( m_instance ), &physicalDeviceCount, nullptr ) );
+        if ( ( result == Result::eSuccess ) && physicalDeviceCount )
+        {
+          physicalDevices.resize( physicalDeviceCount );
+          result = static_cast<Result>( getDispatcher()->vkEnumeratePhysicalDevices(
+            static_cast<VkInstance>( m_instance ), &physicalDeviceCount, reinterpret_cast<VkPhysicalDevice *>( physicalDevices.data() ) ) );
+        }
+      } while ( result == Result::eIncomplete );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Instance::enumeratePhysicalDevices" );
+      std::vector<PhysicalDevice, PhysicalDeviceAllocator> physicalDevicesRAII( physicalDeviceAllocator );
+      if ( result == Result::eSuccess )
+      {
+        physicalDevicesRAII.reserve( physicalDevices.size() );
+        for ( auto & physicalDevice : physicalDevices )
+        {
+          physicalDevicesRAII.emplace_back( *this, *reinterpret_cast<VkPhysicalDevice *>( &physicalDevice ) );
+        }
+      }
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( physicalDevicesRAII ) );
+    }
+
+    // wrapper function for command vkAllocateCommandBuffers, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkAllocateCommandBuffers.html
+    template <typename CommandBufferAllocator,
+              typename std::enable_if<std::is_same<typename CommandBufferAllocator::value_type, CommandBuffer>::value, int>::type>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<CommandBuffer, CommandBufferAllocator>>::type
+                         Device::allocateCommandBuffers( CommandBufferAllocateInfo const & allocateInfo,
+                                                         CommandBufferAllocator const &    commandBufferAllocator ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkAllocateCommandBuffers && "Function <vkAllocateCommandBuffers> requires <VK_VERSION_1_0>" );
+
+      std::vector<VULKAN_HPP_NAMESPACE::CommandBuffer,
+                  typename std::allocator_traits<CommandBufferAllocator>::template rebind_alloc<VULKAN_HPP_NAMESPACE::CommandBuffer>>
+        commandBuffers( allocateInfo.commandBufferCount, {}, commandBufferAllocator );
+      Result result = static_cast<Result>( getDispatcher()->vkAllocateCommandBuffers( static_cast<VkDevice>( m_device ),
+                                                                                      reinterpret_cast<VkCommandBufferAllocateInfo const *>( &allocateInfo ),
+                                                                                      reinterpret_cast<VkCommandBuffer *>( commandBuffers.data() ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::allocateCommandBuffers" );
+      std::vector<CommandBuffer, CommandBufferAllocator> commandBuffersRAII( commandBufferAllocator );
+      if ( result == Result::eSuccess )
+      {
+        commandBuffersRAII.reserve( commandBuffers.size() );
+        for ( auto & commandBuffer : commandBuffers )
+        {
+          commandBuffersRAII.emplace_back(
+            *this, *reinterpret_cast<VkCommandBuffer *>( &commandBuffer ), static_cast<VkCommandPool>( allocateInfo.commandPool ) );
+        }
+      }
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( commandBuffersRAII ) );
+    }
+
+    // wrapper function for command vkCreateComputePipelines, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateComputePipelines.html
+    template <typename PipelineAllocator, typename std::enable_if<std::is_same<typename PipelineAllocator::value_type, Pipeline>::value, int>::type>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<Pipeline, PipelineAllocator>>::type
+                         Device::createComputePipelines( Optional<PipelineCache const> const &         pipelineCache,
+                                                         ArrayProxy<ComputePipelineCreateInfo> const & createInfos,
+                                                         Optional<AllocationCallbacks const>           allocator,
+                                                         PipelineAllocator const &                     pipelineAllocator ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkCreateComputePipelines && "Function <vkCreateComputePipelines> requires <VK_VERSION_1_0>" );
+
+      std::vector<VULKAN_HPP_NAMESPACE::Pipeline, typename std::allocator_traits<PipelineAllocator>::template rebind_alloc<VULKAN_HPP_NAMESPACE::Pipeline>>
+        pipelines( createInfos.size(), {}, pipelineAllocator );
+      Result result =
+        static_cast<Result>( getDispatcher()->vkCreateComputePipelines( static_cast<VkDevice>( m_device ),
+                                                                        pipelineCache ? static_cast<VkPipelineCache>( **pipelineCache ) : 0,
+                                                                        createInfos.size(),
+                                                                        reinterpret_cast<VkComputePipelineCreateInfo const *>( createInfos.data() ),
+                                                                        reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
+                                                                        reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createComputePipelines" );
+      std::vector<Pipeline, PipelineAllocator> pipelinesRAII( pipelineAllocator );
+      if ( result == Result::eSuccess )
+      {
+        pipelinesRAII.reserve( pipelines.size() );
+        for ( auto & pipeline : pipelines )
+        {
+          pipelinesRAII.emplace_back( *this, *reinterpret_cast<VkPipeline *>( &pipeline ), allocator, result );
+        }
+      }
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( pipelinesRAII ) );
+    }
+
+    // wrapper function for command vkAllocateDescriptorSets, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkAllocateDescriptorSets.html
+    template <typename DescriptorSetAllocator,
+              typename std::enable_if<std::is_same<typename DescriptorSetAllocator::value_type, DescriptorSet>::value, int>::type>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<DescriptorSet, DescriptorSetAllocator>>::type
+                         Device::allocateDescriptorSets( DescriptorSetAllocateInfo const & allocateInfo,
+                                                         DescriptorSetAllocator const &    descriptorSetAllocator ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkAllocateDescriptorSets && "Function <vkAllocateDescriptorSets> requires <VK_VERSION_1_0>" );
+
+      std::vector<VULKAN_HPP_NAMESPACE::DescriptorSet,
+                  typename std::allocator_traits<DescriptorSetAllocator>::template rebind_alloc<VULKAN_HPP_NAMESPACE::DescriptorSet>>
+        descriptorSets( allocateInfo.descriptorSetCount, {}, descriptorSetAllocator );
+      Result result = static_cast<Result>( getDispatcher()->vkAllocateDescriptorSets( static_cast<VkDevice>( m_device ),
+                                                                                      reinterpret_cast<VkDescriptorSetAllocateInfo const *>( &allocateInfo ),
+                                                                                      reinterpret_cast<VkDescriptorSet *>( descriptorSets.data() ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::allocateDescriptorSets" );
+      std::vector<DescriptorSet, DescriptorSetAllocator> descriptorSetsRAII( descriptorSetAllocator );
+      if ( result == Result::eSuccess )
+      {
+        descriptorSetsRAII.reserve( descriptorSets.size() );
+        for ( auto & descriptorSet : descriptorSets )
+        {
+          descriptorSetsRAII.emplace_back(
+            *this, *reinterpret_cast<VkDescriptorSet *>( &descriptorSet ), static_cast<VkDescriptorPool>( allocateInfo.descriptorPool ) );
+        }
+      }
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( descriptorSetsRAII ) );
+    }
+
+    // wrapper function for command vkCreateGraphicsPipelines, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateGraphicsPipelines.html
+    template <typename PipelineAllocator, typename std::enable_if<std::is_same<typename PipelineAllocator::value_type, Pipeline>::value, int>::type>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<Pipeline, PipelineAllocator>>::type
+                         Device::createGraphicsPipelines( Optional<PipelineCache const> const &          pipelineCache,
+                                                          ArrayProxy<GraphicsPipelineCreateInfo> const & createInfos,
+                                                          Optional<AllocationCallbacks const>            allocator,
+                                                          PipelineAllocator const &                      pipelineAllocator ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkCreateGraphicsPipelines && "Function <vkCreateGraphicsPipelines> requires <VK_VERSION_1_0>" );
+
+      std::vector<VULKAN_HPP_NAMESPACE::Pipeline, typename std::allocator_traits<PipelineAllocator>::template rebind_alloc<VULKAN_HPP_NAMESPACE::Pipeline>>
+        pipelines( createInfos.size(), {}, pipelineAllocator );
+      Result result =
+        static_cast<Result>( getDispatcher()->vkCreateGraphicsPipelines( static_cast<VkDevice>( m_device ),
+                                                                         pipelineCache ? static_cast<VkPipelineCache>( **pipelineCache ) : 0,
+                                                                         createInfos.size(),
+                                                                         reinterpret_cast<VkGraphicsPipelineCreateInfo const *>( createInfos.data() ),
+                                                                         reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
+                                                                         reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createGraphicsPipelines" );
+      std::vector<Pipeline, PipelineAllocator> pipelinesRAII( pipelineAllocator );
+      if ( result == Result::eSuccess )
+      {
+        pipelinesRAII.reserve( pipelines.size() );
+        for ( auto & pipeline : pipelines )
+        {
+          pipelinesRAII.emplace_back( *this, *reinterpret_cast<VkPipeline *>( &pipeline ), allocator, result );
+        }
+      }
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( pipelinesRAII ) );
+    }
+
+    //=== VK_VERSION_1_1 ===
+
+    // wrapper function for command vkGetImageMemoryRequirements2, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageMemoryRequirements2.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+                                           Device::getImageMemoryRequirements2( ImageMemoryRequirementsInfo2 const & info ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetImageMemoryRequirements2 &&
+                         "Function <vkGetImageMemoryRequirements2> requires <VK_KHR_get_memory_requirements2> or <VK_VERSION_1_1>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
+      getDispatcher()->vkGetImageMemoryRequirements2( static_cast<VkDevice>( m_device ),
+                                                      reinterpret_cast<VkImageMemoryRequirementsInfo2 const *>( &info ),
+                                                      reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkGetBufferMemoryRequirements2, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetBufferMemoryRequirements2.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+                                           Device::getBufferMemoryRequirements2( BufferMemoryRequirementsInfo2 const & info ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetBufferMemoryRequirements2 &&
+                         "Function <vkGetBufferMemoryRequirements2> requires <VK_KHR_get_memory_requirements2> or <VK_VERSION_1_1>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
+      getDispatcher()->vkGetBufferMemoryRequirements2( static_cast<VkDevice>( m_device ),
+                                                       reinterpret_cast<VkBufferMemoryRequirementsInfo2 const *>( &info ),
+                                                       reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkGetPhysicalDeviceFeatures2, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceFeatures2.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...> PhysicalDevice::getFeatures2() const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceFeatures2 &&
+                         "Function <vkGetPhysicalDeviceFeatures2> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      PhysicalDeviceFeatures2 &  features = structureChain.template get<PhysicalDeviceFeatures2>();
+      getDispatcher()->vkGetPhysicalDeviceFeatures2( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                     reinterpret_cast<VkPhysicalDeviceFeatures2 *>( &features ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkGetPhysicalDeviceProperties2, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceProperties2.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...> PhysicalDevice::getProperties2() const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceProperties2 &&
+                         "Function <vkGetPhysicalDeviceProperties2> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
+
+      StructureChain<X, Y, Z...>  structureChain;
+      PhysicalDeviceProperties2 & properties = structureChain.template get<PhysicalDeviceProperties2>();
+      getDispatcher()->vkGetPhysicalDeviceProperties2( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                       reinterpret_cast<VkPhysicalDeviceProperties2 *>( &properties ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkGetPhysicalDeviceFormatProperties2, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceFormatProperties2.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...> PhysicalDevice::getFormatProperties2( Format format ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceFormatProperties2 &&
+                         "Function <vkGetPhysicalDeviceFormatProperties2> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      FormatProperties2 &        formatProperties = structureChain.template get<FormatProperties2>();
+      getDispatcher()->vkGetPhysicalDeviceFormatProperties2(
+        static_cast<VkPhysicalDevice>( m_physicalDevice ), static_cast<VkFormat>( format ), reinterpret_cast<VkFormatProperties2 *>( &formatProperties ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkGetPhysicalDeviceImageFormatProperties2, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceImageFormatProperties2.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<StructureChain<X, Y, Z...>>::type
+                         PhysicalDevice::getImageFormatProperties2( PhysicalDeviceImageFormatInfo2 const & imageFormatInfo ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceImageFormatProperties2 &&
+                         "Function <vkGetPhysicalDeviceImageFormatProperties2> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      ImageFormatProperties2 &   imageFormatProperties = structureChain.template get<ImageFormatProperties2>();
+      Result                     result                = static_cast<Result>(
+        getDispatcher()->vkGetPhysicalDeviceImageFormatProperties2( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                                    reinterpret_cast<VkPhysicalDeviceImageFormatInfo2 const *>( &imageFormatInfo ),
+                                                                    reinterpret_cast<VkImageFormatProperties2 *>( &imageFormatProperties ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getImageFormatProperties2" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChain ) );
+    }
+
+    // wrapper function for command vkGetPhysicalDeviceQueueFamilyProperties2, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceQueueFamilyProperties2.html
+    template <typename StructureChain>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::vector<StructureChain> PhysicalDevice::getQueueFamilyProperties2() const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceQueueFamilyProperties2 &&
+                         "Function <vkGetPhysicalDeviceQueueFamilyProperties2> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
+
+      std::vector<StructureChain>         structureChains;
+      std::vector<QueueFamilyProperties2> queueFamilyProperties;
+      uint32_t                            queueFamilyPropertyCount;
+      getDispatcher()->vkGetPhysicalDeviceQueueFamilyProperties2( static_cast<VkPhysicalDevice>( m_physicalDevice ), &queueFamilyPropertyCount, nullptr );
+      structureChains.resize( queueFamilyPropertyCount );
+      queueFamilyProperties.resize( queueFamilyPropertyCount );
+      for ( uint32_t i = 0; i < queueFamilyPropertyCount; i++ )
+      {
+        queueFamilyProperties[i].pNext = structureChains[i].template get<QueueFamilyProperties2>().pNext;
+      }
+      getDispatcher()->vkGetPhysicalDeviceQueueFamilyProperties2( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                                  &queueFamilyPropertyCount,
+                                                                  reinterpret_cast<VkQueueFamilyProperties2 *>( queueFamilyProperties.data() ) );
+
+      VULKAN_HPP_ASSERT( queueFamilyPropertyCount <= queueFamilyProperties.size() );
+      if ( queueFamilyPropertyCount < queueFamilyProperties.size() )
+      {
+        structureChains.resize( queueFamilyPropertyCount );
+      }
+      for ( uint32_t i = 0; i < queueFamilyPropertyCount; i++ )
+      {
+        structureChains[i].template get<QueueFamilyProperties2>() = queueFamilyProperties[i];
+      }
+      return structureChains;
+    }
+
+    // wrapper function for command vkGetPhysicalDeviceMemoryProperties2, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceMemoryProperties2.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...> PhysicalDevice::getMemoryProperties2() const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceMemoryProperties2 &&
+                         "Function <vkGetPhysicalDeviceMemoryProperties2> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
+
+      StructureChain<X, Y, Z...>        structureChain;
+      PhysicalDeviceMemoryProperties2 & memoryProperties = structureChain.template get<PhysicalDeviceMemoryProperties2>();
+      getDispatcher()->vkGetPhysicalDeviceMemoryProperties2( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                             reinterpret_cast<VkPhysicalDeviceMemoryProperties2 *>( &memoryProperties ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkUpdateDescriptorSetWithTemplate, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkUpdateDescriptorSetWithTemplate.html
+    template <typename DataType>
+    VULKAN_HPP_INLINE void DescriptorSet::updateWithTemplate( VULKAN_HPP_NAMESPACE::DescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                              DataType const &                               data ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkUpdateDescriptorSetWithTemplate &&
+                         "Function <vkUpdateDescriptorSetWithTemplate> requires <VK_KHR_descriptor_update_template> or <VK_VERSION_1_1>" );
+
+      getDispatcher()->vkUpdateDescriptorSetWithTemplate( static_cast<VkDevice>( m_device ),
+                                                          static_cast<VkDescriptorSet>( m_descriptorSet ),
+                                                          static_cast<VkDescriptorUpdateTemplate>( descriptorUpdateTemplate ),
+                                                          reinterpret_cast<void const *>( &data ) );
+    }
+
+    // wrapper function for command vkGetDescriptorSetLayoutSupport, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDescriptorSetLayoutSupport.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+                                           Device::getDescriptorSetLayoutSupport( DescriptorSetLayoutCreateInfo const & createInfo ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDescriptorSetLayoutSupport &&
+                         "Function <vkGetDescriptorSetLayoutSupport> requires <VK_KHR_maintenance3> or <VK_VERSION_1_1>" );
+
+      StructureChain<X, Y, Z...>   structureChain;
+      DescriptorSetLayoutSupport & support = structureChain.template get<DescriptorSetLayoutSupport>();
+      getDispatcher()->vkGetDescriptorSetLayoutSupport( static_cast<VkDevice>( m_device ),
+                                                        reinterpret_cast<VkDescriptorSetLayoutCreateInfo const *>( &createInfo ),
+                                                        reinterpret_cast<VkDescriptorSetLayoutSupport *>( &support ) );
+
+      return structureChain;
+    }
+
+    //=== VK_VERSION_1_3 ===
+
+    // wrapper function for command vkGetDeviceBufferMemoryRequirements, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceBufferMemoryRequirements.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+                                           Device::getBufferMemoryRequirements( DeviceBufferMemoryRequirements const & info ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDeviceBufferMemoryRequirements &&
+                         "Function <vkGetDeviceBufferMemoryRequirements> requires <VK_KHR_maintenance4> or <VK_VERSION_1_3>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
+      getDispatcher()->vkGetDeviceBufferMemoryRequirements( static_cast<VkDevice>( m_device ),
+                                                            reinterpret_cast<VkDeviceBufferMemoryRequirements const *>( &info ),
+                                                            reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkGetDeviceImageMemoryRequirements, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceImageMemoryRequirements.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+                                           Device::getImageMemoryRequirements( DeviceImageMemoryRequirements const & info ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDeviceImageMemoryRequirements &&
+                         "Function <vkGetDeviceImageMemoryRequirements> requires <VK_KHR_maintenance4> or <VK_VERSION_1_3>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
+      getDispatcher()->vkGetDeviceImageMemoryRequirements( static_cast<VkDevice>( m_device ),
+                                                           reinterpret_cast<VkDeviceImageMemoryRequirements const *>( &info ),
+                                                           reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
+
+      return structureChain;
+    }
+
+    //=== VK_VERSION_1_4 ===
+
+    // wrapper function for command vkGetDeviceImageSubresourceLayout, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceImageSubresourceLayout.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+                                           Device::getImageSubresourceLayout( DeviceImageSubresourceInfo const & info ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDeviceImageSubresourceLayout &&
+                         "Function <vkGetDeviceImageSubresourceLayout> requires <VK_KHR_maintenance5> or <VK_VERSION_1_4>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      SubresourceLayout2 &       layout = structureChain.template get<SubresourceLayout2>();
+      getDispatcher()->vkGetDeviceImageSubresourceLayout( static_cast<VkDevice>( m_device ),
+                                                          reinterpret_cast<VkDeviceImageSubresourceInfo const *>( &info ),
+                                                          reinterpret_cast<VkSubresourceLayout2 *>( &layout ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkGetImageSubresourceLayout2, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageSubresourceLayout2.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+                                           Image::getSubresourceLayout2( ImageSubresource2 const & subresource ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT(
+        getDispatcher()->vkGetImageSubresourceLayout2 &&
+        "Function <vkGetImageSubresourceLayout2> requires <VK_EXT_host_image_copy> or <VK_EXT_image_compression_control> or <VK_KHR_maintenance5> or <VK_VERSION_1_4>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      SubresourceLayout2 &       layout = structureChain.template get<SubresourceLayout2>();
+      getDispatcher()->vkGetImageSubresourceLayout2( static_cast<VkDevice>( m_device ),
+                                                     static_cast<VkImage>( m_image ),
+                                                     reinterpret_cast<VkImageSubresource2 const *>( &subresource ),
+                                                     reinterpret_cast<VkSubresourceLayout2 *>( &layout ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkCmdPushDescriptorSetWithTemplate, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdPushDescriptorSetWithTemplate.html
+    template <typename DataType>
+    VULKAN_HPP_INLINE void CommandBuffer::pushDescriptorSetWithTemplate( VULKAN_HPP_NAMESPACE::DescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                                         VULKAN_HPP_NAMESPACE::PipelineLayout           layout,
+                                                                         uint32_t                                       set,
+                                                                         DataType const &                               data ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT(
+        getDispatcher()->vkCmdPushDescriptorSetWithTemplate &&
+        "Function <vkCmdPushDescriptorSetWithTemplate> requires <VK_KHR_descriptor_update_template> or <VK_KHR_push_descriptor> or <VK_VERSION_1_4>" );
+
+      getDispatcher()->vkCmdPushDescriptorSetWithTemplate( static_cast<VkCommandBuffer>( m_commandBuffer ),
+                                                           static_cast<VkDescriptorUpdateTemplate>( descriptorUpdateTemplate ),
+                                                           static_cast<VkPipelineLayout>( layout ),
+                                                           set,
+                                                           reinterpret_cast<void const *>( &data ) );
+    }
+
+    //=== VK_KHR_display ===
+
+    // wrapper function for command vkGetDisplayPlaneSupportedDisplaysKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDisplayPlaneSupportedDisplaysKHR.html
+    template <typename DisplayKHRAllocator, typename std::enable_if<std::is_same<typename DisplayKHRAllocator::value_type, DisplayKHR>::value, int>::type>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<DisplayKHR, DisplayKHRAllocator>>::type
+                         PhysicalDevice::getDisplayPlaneSupportedDisplaysKHR( uint32_t planeIndex, DisplayKHRAllocator const & displayKHRAllocator ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDisplayPlaneSupportedDisplaysKHR &&
+                         "Function <vkGetDisplayPlaneSupportedDisplaysKHR> requires <VK_KHR_display>" );
+
+      std::vector<VULKAN_HPP_NAMESPACE::DisplayKHR,
+                  typename std::allocator_traits<DisplayKHRAllocator>::template rebind_alloc<VULKAN_HPP_NAMESPACE::DisplayKHR>>
+        displays( displayKHRAllocator );
+      uint32_t displayCount;
+      Result   result;
+      do
+      {
+        result = static_cast<Result>(
+          getDispatcher()->vkGetDisplayPlaneSupportedDisplaysKHR( static_cast<VkPhysicalDevice>( m_physicalDevice ), planeIndex, &displayCount, nullptr ) );
+        if ( ( result == Result::eSuccess ) && displayCount )
+        {
+          displays.resize( displayCount );
+          result = static_cast<Result>( getDispatcher()->vkGetDisplayPlaneSupportedDisplaysKHR(
+            static_cast<VkPhysicalDevice>( m_physicalDevice ), planeIndex, &displayCount, reinterpret_cast<VkDisplayKHR *>( displays.data() ) ) );
+        }
+      } while ( result == Result::eIncomplete );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getDisplayPlaneSupportedDisplaysKHR" );
+      std::vector<DisplayKHR, DisplayKHRAllocator> displaysRAII( displayKHRAllocator );
+      if ( result == Result::eSuccess )
+      {
+        displaysRAII.reserve( displays.size() );
+        for ( auto & display : displays )
+        {
+          displaysRAII.emplace_back( *this, *reinterpret_cast<VkDisplayKHR *>( &display ) );
+        }
+      }
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( displaysRAII ) );
+    }
+
+    //=== VK_KHR_display_swapchain ===
+
+    // wrapper function for command vkCreateSharedSwapchainsKHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateSharedSwapchainsKHR.html
+    template <typename SwapchainKHRAllocator, typename std::enable_if<std::is_same<typename SwapchainKHRAllocator::value_type, SwapchainKHR>::value, int>::type>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<SwapchainKHR, SwapchainKHRAllocator>>::type
+                         Device::createSharedSwapchainsKHR( ArrayProxy<SwapchainCreateInfoKHR> const & createInfos,
+                                                            Optional<AllocationCallbacks const>        allocator,
+                                                            SwapchainKHRAllocator const &              swapchainKHRAllocator ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkCreateSharedSwapchainsKHR && "Function <vkCreateSharedSwapchainsKHR> requires <VK_KHR_display_swapchain>" );
+
+      std::vector<VULKAN_HPP_NAMESPACE::SwapchainKHR,
+                  typename std::allocator_traits<SwapchainKHRAllocator>::template rebind_alloc<VULKAN_HPP_NAMESPACE::SwapchainKHR>>
+        swapchains( createInfos.size(), {}, swapchainKHRAllocator );
+      Result result =
+        static_cast<Result>( getDispatcher()->vkCreateSharedSwapchainsKHR( static_cast<VkDevice>( m_device ),
+                                                                           createInfos.size(),
+                                                                           reinterpret_cast<VkSwapchainCreateInfoKHR const *>( createInfos.data() ),
+                                                                           reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
+                                                                           reinterpret_cast<VkSwapchainKHR *>( swapchains.data() ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createSharedSwapchainsKHR" );
+      std::vector<SwapchainKHR, SwapchainKHRAllocator> swapchainsRAII( swapchainKHRAllocator );
+      if ( result == Result::eSuccess )
+      {
+        swapchainsRAII.reserve( swapchains.size() );
+        for ( auto & swapchain : swapchains )
+        {
+          swapchainsRAII.emplace_back( *this, *reinterpret_cast<VkSwapchainKHR *>( &swapchain ), allocator );
+        }
+      }
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( swapchainsRAII ) );
+    }
+
+    //=== VK_KHR_video_queue ===
+
+    // wrapper function for command vkGetPhysicalDeviceVideoCapabilitiesKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceVideoCapabilitiesKHR.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<StructureChain<X, Y, Z...>>::type
+                         PhysicalDevice::getVideoCapabilitiesKHR( VideoProfileInfoKHR const & videoProfile ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceVideoCapabilitiesKHR &&
+                         "Function <vkGetPhysicalDeviceVideoCapabilitiesKHR> requires <VK_KHR_video_queue>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      VideoCapabilitiesKHR &     capabilities = structureChain.template get<VideoCapabilitiesKHR>();
+      Result                     result =
+        static_cast<Result>( getDispatcher()->vkGetPhysicalDeviceVideoCapabilitiesKHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                                                       reinterpret_cast<VkVideoProfileInfoKHR const *>( &videoProfile ),
+                                                                                       reinterpret_cast<VkVideoCapabilitiesKHR *>( &capabilities ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getVideoCapabilitiesKHR" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChain ) );
+    }
+
+    // wrapper function for command vkGetPhysicalDeviceVideoFormatPropertiesKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceVideoFormatPropertiesKHR.html
+    template <typename StructureChain>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<StructureChain>>::type
+                         PhysicalDevice::getVideoFormatPropertiesKHR( PhysicalDeviceVideoFormatInfoKHR const & videoFormatInfo ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceVideoFormatPropertiesKHR &&
+                         "Function <vkGetPhysicalDeviceVideoFormatPropertiesKHR> requires <VK_KHR_video_queue>" );
+
+      std::vector<StructureChain>           structureChains;
+      std::vector<VideoFormatPropertiesKHR> videoFormatProperties;
+      uint32_t                              videoFormatPropertyCount;
+      Result                                result;
+      do
+      {
+        result = static_cast<Result>(
+          getDispatcher()->vkGetPhysicalDeviceVideoFormatPropertiesKHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                                        reinterpret_cast<VkPhysicalDeviceVideoFormatInfoKHR const *>( &videoFormatInfo ),
+                                                                        &videoFormatPropertyCount,
+                                                                        nullptr ) );
+        if ( ( result == Result::eSuccess ) && videoFormatPropertyCount )
+        {
+          structureChains.resize( videoFormatPropertyCount );
+          videoFormatProperties.resize( videoFormatPropertyCount );
+          for ( uint32_t i = 0; i < videoFormatPropertyCount; i++ )
+          {
+            videoFormatProperties[i].pNext = structureChains[i].template get<VideoFormatPropertiesKHR>().pNext;
+          }
+          result = static_cast<Result>(
+            getDispatcher()->vkGetPhysicalDeviceVideoFormatPropertiesKHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                                          reinterpret_cast<VkPhysicalDeviceVideoFormatInfoKHR const *>( &videoFormatInfo ),
+                                                                          &videoFormatPropertyCount,
+                                                                          reinterpret_cast<VkVideoFormatPropertiesKHR *>( videoFormatProperties.data() ) ) );
+        }
+      } while ( result == Result::eIncomplete );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getVideoFormatPropertiesKHR" );
+      VULKAN_HPP_ASSERT( videoFormatPropertyCount <= videoFormatProperties.size() );
+      if ( videoFormatPropertyCount < videoFormatProperties.size() )
+      {
+        structureChains.resize( videoFormatPropertyCount );
+      }
+      for ( uint32_t i = 0; i < videoFormatPropertyCount; i++ )
+      {
+        structureChains[i].template get<VideoFormatPropertiesKHR>() = videoFormatProperties[i];
+      }
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChains ) );
+    }
+
+    //=== VK_KHR_get_physical_device_properties2 ===
+
+    // wrapper function for command vkGetPhysicalDeviceFeatures2KHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceFeatures2KHR.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...> PhysicalDevice::getFeatures2KHR() const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceFeatures2KHR &&
+                         "Function <vkGetPhysicalDeviceFeatures2KHR> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      PhysicalDeviceFeatures2 &  features = structureChain.template get<PhysicalDeviceFeatures2>();
+      getDispatcher()->vkGetPhysicalDeviceFeatures2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                        reinterpret_cast<VkPhysicalDeviceFeatures2 *>( &features ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkGetPhysicalDeviceProperties2KHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceProperties2KHR.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...> PhysicalDevice::getProperties2KHR() const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceProperties2KHR &&
+                         "Function <vkGetPhysicalDeviceProperties2KHR> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
+
+      StructureChain<X, Y, Z...>  structureChain;
+      PhysicalDeviceProperties2 & properties = structureChain.template get<PhysicalDeviceProperties2>();
+      getDispatcher()->vkGetPhysicalDeviceProperties2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                          reinterpret_cast<VkPhysicalDeviceProperties2 *>( &properties ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkGetPhysicalDeviceFormatProperties2KHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceFormatProperties2KHR.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...> PhysicalDevice::getFormatProperties2KHR( Format format ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceFormatProperties2KHR &&
+                         "Function <vkGetPhysicalDeviceFormatProperties2KHR> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      FormatProperties2 &        formatProperties = structureChain.template get<FormatProperties2>();
+      getDispatcher()->vkGetPhysicalDeviceFormatProperties2KHR(
+        static_cast<VkPhysicalDevice>( m_physicalDevice ), static_cast<VkFormat>( format ), reinterpret_cast<VkFormatProperties2 *>( &formatProperties ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkGetPhysicalDeviceImageFormatProperties2KHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceImageFormatProperties2KHR.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<StructureChain<X, Y, Z...>>::type
+                         PhysicalDevice::getImageFormatProperties2KHR( PhysicalDeviceImageFormatInfo2 const & imageFormatInfo ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceImageFormatProperties2KHR &&
+                         "Function <vkGetPhysicalDeviceImageFormatProperties2KHR> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      ImageFormatProperties2 &   imageFormatProperties = structureChain.template get<ImageFormatProperties2>();
+      Result                     result                = static_cast<Result>(
+        getDispatcher()->vkGetPhysicalDeviceImageFormatProperties2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                                       reinterpret_cast<VkPhysicalDeviceImageFormatInfo2 const *>( &imageFormatInfo ),
+                                                                       reinterpret_cast<VkImageFormatProperties2 *>( &imageFormatProperties ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getImageFormatProperties2KHR" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChain ) );
+    }
+
+    // wrapper function for command vkGetPhysicalDeviceQueueFamilyProperties2KHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceQueueFamilyProperties2KHR.html
+    template <typename StructureChain>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::vector<StructureChain> PhysicalDevice::getQueueFamilyProperties2KHR() const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceQueueFamilyProperties2KHR &&
+                         "Function <vkGetPhysicalDeviceQueueFamilyProperties2KHR> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
+
+      std::vector<StructureChain>         structureChains;
+      std::vector<QueueFamilyProperties2> queueFamilyProperties;
+      uint32_t                            queueFamilyPropertyCount;
+      getDispatcher()->vkGetPhysicalDeviceQueueFamilyProperties2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ), &queueFamilyPropertyCount, nullptr );
+      structureChains.resize( queueFamilyPropertyCount );
+      queueFamilyProperties.resize( queueFamilyPropertyCount );
+      for ( uint32_t i = 0; i < queueFamilyPropertyCount; i++ )
+      {
+        queueFamilyProperties[i].pNext = structureChains[i].template get<QueueFamilyProperties2>().pNext;
+      }
+      getDispatcher()->vkGetPhysicalDeviceQueueFamilyProperties2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                                     &queueFamilyPropertyCount,
+                                                                     reinterpret_cast<VkQueueFamilyProperties2 *>( queueFamilyProperties.data() ) );
+
+      VULKAN_HPP_ASSERT( queueFamilyPropertyCount <= queueFamilyProperties.size() );
+      if ( queueFamilyPropertyCount < queueFamilyProperties.size() )
+      {
+        structureChains.resize( queueFamilyPropertyCount );
+      }
+      for ( uint32_t i = 0; i < queueFamilyPropertyCount; i++ )
+      {
+        structureChains[i].template get<QueueFamilyProperties2>() = queueFamilyProperties[i];
+      }
+      return structureChains;
+    }
+
+    // wrapper function for command vkGetPhysicalDeviceMemoryProperties2KHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceMemoryProperties2KHR.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...> PhysicalDevice::getMemoryProperties2KHR() const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceMemoryProperties2KHR &&
+                         "Function <vkGetPhysicalDeviceMemoryProperties2KHR> requires <VK_KHR_get_physical_device_properties2> or <VK_VERSION_1_1>" );
+
+      StructureChain<X, Y, Z...>        structureChain;
+      PhysicalDeviceMemoryProperties2 & memoryProperties = structureChain.template get<PhysicalDeviceMemoryProperties2>();
+      getDispatcher()->vkGetPhysicalDeviceMemoryProperties2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                                reinterpret_cast<VkPhysicalDeviceMemoryProperties2 *>( &memoryProperties ) );
+
+      return structureChain;
+    }
+
+    //=== VK_KHR_push_descriptor ===
+
+    // wrapper function for command vkCmdPushDescriptorSetWithTemplateKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdPushDescriptorSetWithTemplateKHR.html
+    template <typename DataType>
+    VULKAN_HPP_INLINE void CommandBuffer::pushDescriptorSetWithTemplateKHR( VULKAN_HPP_NAMESPACE::DescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                                            VULKAN_HPP_NAMESPACE::PipelineLayout           layout,
+                                                                            uint32_t                                       set,
+                                                                            DataType const &                               data ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT(
+        getDispatcher()->vkCmdPushDescriptorSetWithTemplateKHR &&
+        "Function <vkCmdPushDescriptorSetWithTemplateKHR> requires <VK_KHR_descriptor_update_template> or <VK_KHR_push_descriptor> or <VK_VERSION_1_4>" );
+
+      getDispatcher()->vkCmdPushDescriptorSetWithTemplateKHR( static_cast<VkCommandBuffer>( m_commandBuffer ),
+                                                              static_cast<VkDescriptorUpdateTemplate>( descriptorUpdateTemplate ),
+                                                              static_cast<VkPipelineLayout>( layout ),
+                                                              set,
+                                                              reinterpret_cast<void const *>( &data ) );
+    }
+
+    //=== VK_KHR_descriptor_update_template ===
+
+    // wrapper function for command vkUpdateDescriptorSetWithTemplateKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkUpdateDescriptorSetWithTemplateKHR.html
+    template <typename DataType>
+    VULKAN_HPP_INLINE void DescriptorSet::updateWithTemplateKHR( VULKAN_HPP_NAMESPACE::DescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                                 DataType const &                               data ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkUpdateDescriptorSetWithTemplateKHR &&
+                         "Function <vkUpdateDescriptorSetWithTemplateKHR> requires <VK_KHR_descriptor_update_template> or <VK_VERSION_1_1>" );
+
+      getDispatcher()->vkUpdateDescriptorSetWithTemplateKHR( static_cast<VkDevice>( m_device ),
+                                                             static_cast<VkDescriptorSet>( m_descriptorSet ),
+                                                             static_cast<VkDescriptorUpdateTemplate>( descriptorUpdateTemplate ),
+                                                             reinterpret_cast<void const *>( &data ) );
+    }
+
+    //=== VK_KHR_get_surface_capabilities2 ===
+
+    // wrapper function for command vkGetPhysicalDeviceSurfaceCapabilities2KHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceSurfaceCapabilities2KHR.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<StructureChain<X, Y, Z...>>::type
+                         PhysicalDevice::getSurfaceCapabilities2KHR( PhysicalDeviceSurfaceInfo2KHR const & surfaceInfo ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceSurfaceCapabilities2KHR &&
+                         "Function <vkGetPhysicalDeviceSurfaceCapabilities2KHR> requires <VK_KHR_get_surface_capabilities2>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      SurfaceCapabilities2KHR &  surfaceCapabilities = structureChain.template get<SurfaceCapabilities2KHR>();
+      Result                     result              = static_cast<Result>(
+        getDispatcher()->vkGetPhysicalDeviceSurfaceCapabilities2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                                     reinterpret_cast<VkPhysicalDeviceSurfaceInfo2KHR const *>( &surfaceInfo ),
+                                                                     reinterpret_cast<VkSurfaceCapabilities2KHR *>( &surfaceCapabilities ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getSurfaceCapabilities2KHR" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChain ) );
+    }
+
+    // wrapper function for command vkGetPhysicalDeviceSurfaceFormats2KHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceSurfaceFormats2KHR.html
+    template <typename StructureChain>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<StructureChain>>::type
+                         PhysicalDevice::getSurfaceFormats2KHR( PhysicalDeviceSurfaceInfo2KHR const & surfaceInfo ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceSurfaceFormats2KHR &&
+                         "Function <vkGetPhysicalDeviceSurfaceFormats2KHR> requires <VK_KHR_get_surface_capabilities2>" );
+
+      std::vector<StructureChain>    structureChains;
+      std::vector<SurfaceFormat2KHR> surfaceFormats;
+      uint32_t                       surfaceFormatCount;
+      Result                         result;
+      do
+      {
+        result = static_cast<Result>(
+          getDispatcher()->vkGetPhysicalDeviceSurfaceFormats2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                                  reinterpret_cast<VkPhysicalDeviceSurfaceInfo2KHR const *>( &surfaceInfo ),
+                                                                  &surfaceFormatCount,
+                                                                  nullptr ) );
+        if ( ( result == Result::eSuccess ) && surfaceFormatCount )
+        {
+          structureChains.resize( surfaceFormatCount );
+          surfaceFormats.resize( surfaceFormatCount );
+          for ( uint32_t i = 0; i < surfaceFormatCount; i++ )
+          {
+            surfaceFormats[i].pNext = structureChains[i].template get<SurfaceFormat2KHR>().pNext;
+          }
+          result = static_cast<Result>(
+            getDispatcher()->vkGetPhysicalDeviceSurfaceFormats2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                                    reinterpret_cast<VkPhysicalDeviceSurfaceInfo2KHR const *>( &surfaceInfo ),
+                                                                    &surfaceFormatCount,
+                                                                    reinterpret_cast<VkSurfaceFormat2KHR *>( surfaceFormats.data() ) ) );
+        }
+      } while ( result == Result::eIncomplete );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getSurfaceFormats2KHR" );
+      VULKAN_HPP_ASSERT( surfaceFormatCount <= surfaceFormats.size() );
+      if ( surfaceFormatCount < surfaceFormats.size() )
+      {
+        structureChains.resize( surfaceFormatCount );
+      }
+      for ( uint32_t i = 0; i < surfaceFormatCount; i++ )
+      {
+        structureChains[i].template get<SurfaceFormat2KHR>() = surfaceFormats[i];
+      }
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChains ) );
+    }
+
+    //=== VK_KHR_get_display_properties2 ===
+
+    // wrapper function for command vkGetDisplayModeProperties2KHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDisplayModeProperties2KHR.html
+    template <typename StructureChain>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<StructureChain>>::type DisplayKHR::getModeProperties2() const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDisplayModeProperties2KHR &&
+                         "Function <vkGetDisplayModeProperties2KHR> requires <VK_KHR_get_display_properties2>" );
+
+      std::vector<StructureChain>            structureChains;
+      std::vector<DisplayModeProperties2KHR> properties;
+      uint32_t                               propertyCount;
+      Result                                 result;
+      do
+      {
+        result = static_cast<Result>( getDispatcher()->vkGetDisplayModeProperties2KHR(
+          static_cast<VkPhysicalDevice>( m_physicalDevice ), static_cast<VkDisplayKHR>( m_displayKHR ), &propertyCount, nullptr ) );
+        if ( ( result == Result::eSuccess ) && propertyCount )
+        {
+          structureChains.resize( propertyCount );
+          properties.resize( propertyCount );
+          for ( uint32_t i = 0; i < propertyCount; i++ )
+          {
+            properties[i].pNext = structureChains[i].template get<DisplayModeProperties2KHR>().pNext;
+          }
+          result =
+            static_cast<Result>( getDispatcher()->vkGetDisplayModeProperties2KHR( static_cast<VkPhysicalDevice>( m_physicalDevice ),
+                                                                                  static_cast<VkDisplayKHR>( m_displayKHR ),
+                                                                                  &propertyCount,
+                                                                                  reinterpret_cast<VkDisplayModeProperties2KHR *>( properties.data() ) ) );
+        }
+      } while ( result == Result::eIncomplete );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::DisplayKHR::getModeProperties2" );
+      VULKAN_HPP_ASSERT( propertyCount <= properties.size() );
+      if ( propertyCount < properties.size() )
+      {
+        structureChains.resize( propertyCount );
+      }
+      for ( uint32_t i = 0; i < propertyCount; i++ )
+      {
+        structureChains[i].template get<DisplayModeProperties2KHR>() = properties[i];
+      }
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChains ) );
+    }
+
+    //=== VK_EXT_debug_utils ===
+
+    // wrapper function for command vkSetDebugUtilsObjectNameEXT, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkSetDebugUtilsObjectNameEXT.html
+    template <typename HandleType>
+    VULKAN_HPP_INLINE typename ResultValueType<void>::type Device::setDebugUtilsObjectNameEXT( HandleType const & handle, std::string const & name ) const
+    {
+      VULKAN_HPP_STATIC_ASSERT( VULKAN_HPP_NAMESPACE::isVulkanHandleType<HandleType>::value, "HandleType must be a Vulkan handle type" );
+      // It might be, that neither constructors, nor setters, nor designated initializers are available... need to explicitly set member by member
+      VULKAN_HPP_NAMESPACE::DebugUtilsObjectNameInfoEXT nameInfo;
+      nameInfo.objectType = handle.objectType;
+#  if ( VK_USE_64_BIT_PTR_DEFINES == 1 )
+      nameInfo.objectHandle = reinterpret_cast<uint64_t>( static_cast<typename HandleType::CType>( handle ) );
+#  else
+      nameInfo.objectHandle = static_cast<typename HandleType::CType>( handle );
+#  endif
+      nameInfo.pObjectName = name.c_str();
+      return setDebugUtilsObjectNameEXT( nameInfo );
+    }
+
+    // wrapper function for command vkSetDebugUtilsObjectTagEXT, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkSetDebugUtilsObjectTagEXT.html
+    template <typename HandleType, typename TagType>
+    VULKAN_HPP_INLINE typename ResultValueType<void>::type
+      Device::setDebugUtilsObjectTagEXT( HandleType const & handle, uint64_t name, TagType const & tag ) const
+    {
+      VULKAN_HPP_STATIC_ASSERT( VULKAN_HPP_NAMESPACE::isVulkanHandleType<HandleType>::value, "HandleType must be a Vulkan handle type" );
+      // It might be, that neither constructors, nor setters, nor designated initializers are available... need to explicitly set member by member
+      VULKAN_HPP_NAMESPACE::DebugUtilsObjectTagInfoEXT tagInfo;
+      tagInfo.objectType = handle.objectType;
+#  if ( VK_USE_64_BIT_PTR_DEFINES == 1 )
+      tagInfo.objectHandle = reinterpret_cast<uint64_t>( static_cast<typename HandleType::CType>( handle ) );
+#  else
+      tagInfo.objectHandle = static_cast<typename HandleType::CType>( handle );
+#  endif
+      tagInfo.tagName = name;
+      tagInfo.tagSize = sizeof( TagType );
+      tagInfo.pTag    = &tag;
+      return setDebugUtilsObjectTagEXT( tagInfo );
+    }
+
+#  if defined( VK_USE_PLATFORM_ANDROID_KHR )
+    //=== VK_ANDROID_external_memory_android_hardware_buffer ===
+
+    // wrapper function for command vkGetAndroidHardwareBufferPropertiesANDROID, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetAndroidHardwareBufferPropertiesANDROID.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<StructureChain<X, Y, Z...>>::type
+                         Device::getAndroidHardwareBufferPropertiesANDROID( struct AHardwareBuffer const & buffer ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetAndroidHardwareBufferPropertiesANDROID &&
+                         "Function <vkGetAndroidHardwareBufferPropertiesANDROID> requires <VK_ANDROID_external_memory_android_hardware_buffer>" );
+
+      StructureChain<X, Y, Z...>               structureChain;
+      AndroidHardwareBufferPropertiesANDROID & properties = structureChain.template get<AndroidHardwareBufferPropertiesANDROID>();
+      Result                                   result     = static_cast<Result>( getDispatcher()->vkGetAndroidHardwareBufferPropertiesANDROID(
+        static_cast<VkDevice>( m_device ), &buffer, reinterpret_cast<VkAndroidHardwareBufferPropertiesANDROID *>( &properties ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getAndroidHardwareBufferPropertiesANDROID" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChain ) );
+    }
+#  endif /*VK_USE_PLATFORM_ANDROID_KHR*/
+
+#  if defined( VK_ENABLE_BETA_EXTENSIONS )
+    //=== VK_AMDX_shader_enqueue ===
+
+    // wrapper function for command vkCreateExecutionGraphPipelinesAMDX, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateExecutionGraphPipelinesAMDX.html
+    template <typename PipelineAllocator, typename std::enable_if<std::is_same<typename PipelineAllocator::value_type, Pipeline>::value, int>::type>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<Pipeline, PipelineAllocator>>::type
+                         Device::createExecutionGraphPipelinesAMDX( Optional<PipelineCache const> const &                    pipelineCache,
+                                                                    ArrayProxy<ExecutionGraphPipelineCreateInfoAMDX> const & createInfos,
+                                                                    Optional<AllocationCallbacks const>                      allocator,
+                                                                    PipelineAllocator const &                                pipelineAllocator ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkCreateExecutionGraphPipelinesAMDX &&
+                         "Function <vkCreateExecutionGraphPipelinesAMDX> requires <VK_AMDX_shader_enqueue>" );
+
+      std::vector<VULKAN_HPP_NAMESPACE::Pipeline, typename std::allocator_traits<PipelineAllocator>::template rebind_alloc<VULKAN_HPP_NAMESPACE::Pipeline>>
+        pipelines( createInfos.size(), {}, pipelineAllocator );
+      Result result = static_cast<Result>(
+        getDispatcher()->vkCreateExecutionGraphPipelinesAMDX( static_cast<VkDevice>( m_device ),
+                                                              pipelineCache ? static_cast<VkPipelineCache>( **pipelineCache ) : 0,
+                                                              createInfos.size(),
+                                                              reinterpret_cast<VkExecutionGraphPipelineCreateInfoAMDX const *>( createInfos.data() ),
+                                                              reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
+                                                              reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createExecutionGraphPipelinesAMDX" );
+      std::vector<Pipeline, PipelineAllocator> pipelinesRAII( pipelineAllocator );
+      if ( result == Result::eSuccess )
+      {
+        pipelinesRAII.reserve( pipelines.size() );
+        for ( auto & pipeline : pipelines )
+        {
+          pipelinesRAII.emplace_back( *this, *reinterpret_cast<VkPipeline *>( &pipeline ), allocator, result );
+        }
+      }
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( pipelinesRAII ) );
+    }
+#  endif /*VK_ENABLE_BETA_EXTENSIONS*/
+
+    //=== VK_KHR_get_memory_requirements2 ===
+
+    // wrapper function for command vkGetImageMemoryRequirements2KHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageMemoryRequirements2KHR.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+                                           Device::getImageMemoryRequirements2KHR( ImageMemoryRequirementsInfo2 const & info ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetImageMemoryRequirements2KHR &&
+                         "Function <vkGetImageMemoryRequirements2KHR> requires <VK_KHR_get_memory_requirements2> or <VK_VERSION_1_1>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
+      getDispatcher()->vkGetImageMemoryRequirements2KHR( static_cast<VkDevice>( m_device ),
+                                                         reinterpret_cast<VkImageMemoryRequirementsInfo2 const *>( &info ),
+                                                         reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkGetBufferMemoryRequirements2KHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetBufferMemoryRequirements2KHR.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+                                           Device::getBufferMemoryRequirements2KHR( BufferMemoryRequirementsInfo2 const & info ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetBufferMemoryRequirements2KHR &&
+                         "Function <vkGetBufferMemoryRequirements2KHR> requires <VK_KHR_get_memory_requirements2> or <VK_VERSION_1_1>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
+      getDispatcher()->vkGetBufferMemoryRequirements2KHR( static_cast<VkDevice>( m_device ),
+                                                          reinterpret_cast<VkBufferMemoryRequirementsInfo2 const *>( &info ),
+                                                          reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
+
+      return structureChain;
+    }
+
+    //=== VK_KHR_acceleration_structure ===
+
+    // wrapper function for command vkWriteAccelerationStructuresPropertiesKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkWriteAccelerationStructuresPropertiesKHR.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<DataType>>::type
+      Device::writeAccelerationStructuresPropertiesKHR( ArrayProxy<VULKAN_HPP_NAMESPACE::AccelerationStructureKHR const> const & accelerationStructures,
+                                                        QueryType                                                                queryType,
+                                                        size_t                                                                   dataSize,
+                                                        size_t                                                                   stride ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkWriteAccelerationStructuresPropertiesKHR &&
+                         "Function <vkWriteAccelerationStructuresPropertiesKHR> requires <VK_KHR_acceleration_structure>" );
+
+      VULKAN_HPP_ASSERT( dataSize % sizeof( DataType ) == 0 );
+      std::vector<DataType> data( dataSize / sizeof( DataType ) );
+      Result                result = static_cast<Result>(
+        getDispatcher()->vkWriteAccelerationStructuresPropertiesKHR( static_cast<VkDevice>( m_device ),
+                                                                     accelerationStructures.size(),
+                                                                     reinterpret_cast<VkAccelerationStructureKHR const *>( accelerationStructures.data() ),
+                                                                     static_cast<VkQueryType>( queryType ),
+                                                                     data.size() * sizeof( DataType ),
+                                                                     reinterpret_cast<void *>( data.data() ),
+                                                                     stride ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::writeAccelerationStructuresPropertiesKHR" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    // wrapper function for command vkWriteAccelerationStructuresPropertiesKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkWriteAccelerationStructuresPropertiesKHR.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type Device::writeAccelerationStructuresPropertyKHR(
+      ArrayProxy<VULKAN_HPP_NAMESPACE::AccelerationStructureKHR const> const & accelerationStructures, QueryType queryType, size_t stride ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkWriteAccelerationStructuresPropertiesKHR &&
+                         "Function <vkWriteAccelerationStructuresPropertiesKHR> requires <VK_KHR_acceleration_structure>" );
+
+      DataType data;
+      Result   result = static_cast<Result>(
+        getDispatcher()->vkWriteAccelerationStructuresPropertiesKHR( static_cast<VkDevice>( m_device ),
+                                                                     accelerationStructures.size(),
+                                                                     reinterpret_cast<VkAccelerationStructureKHR const *>( accelerationStructures.data() ),
+                                                                     static_cast<VkQueryType>( queryType ),
+                                                                     sizeof( DataType ),
+                                                                     reinterpret_cast<void *>( &data ),
+                                                                     stride ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::writeAccelerationStructuresPropertyKHR" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    //=== VK_KHR_ray_tracing_pipeline ===
+
+    // wrapper function for command vkGetRayTracingShaderGroupHandlesKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetRayTracingShaderGroupHandlesKHR.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<DataType>>::type
+                         Pipeline::getRayTracingShaderGroupHandlesKHR( uint32_t firstGroup, uint32_t groupCount, size_t dataSize ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetRayTracingShaderGroupHandlesKHR &&
+                         "Function <vkGetRayTracingShaderGroupHandlesKHR> requires <VK_KHR_ray_tracing_pipeline> or <VK_NV_ray_tracing>" );
+
+      VULKAN_HPP_ASSERT( dataSize % sizeof( DataType ) == 0 );
+      std::vector<DataType> data( dataSize / sizeof( DataType ) );
+      Result                result = static_cast<Result>( getDispatcher()->vkGetRayTracingShaderGroupHandlesKHR( static_cast<VkDevice>( m_device ),
+                                                                                                                 static_cast<VkPipeline>( m_pipeline ),
+                                                                                                                 firstGroup,
+                                                                                                                 groupCount,
+                                                                                                                 data.size() * sizeof( DataType ),
+                                                                                                                 reinterpret_cast<void *>( data.data() ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Pipeline::getRayTracingShaderGroupHandlesKHR" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    // wrapper function for command vkGetRayTracingShaderGroupHandlesKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetRayTracingShaderGroupHandlesKHR.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type Pipeline::getRayTracingShaderGroupHandleKHR( uint32_t firstGroup,
+                                                                                                                                 uint32_t groupCount ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetRayTracingShaderGroupHandlesKHR &&
+                         "Function <vkGetRayTracingShaderGroupHandlesKHR> requires <VK_KHR_ray_tracing_pipeline> or <VK_NV_ray_tracing>" );
+
+      DataType data;
+      Result   result = static_cast<Result>( getDispatcher()->vkGetRayTracingShaderGroupHandlesKHR( static_cast<VkDevice>( m_device ),
+                                                                                                    static_cast<VkPipeline>( m_pipeline ),
+                                                                                                    firstGroup,
+                                                                                                    groupCount,
+                                                                                                    sizeof( DataType ),
+                                                                                                    reinterpret_cast<void *>( &data ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Pipeline::getRayTracingShaderGroupHandleKHR" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    // wrapper function for command vkGetRayTracingCaptureReplayShaderGroupHandlesKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetRayTracingCaptureReplayShaderGroupHandlesKHR.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<DataType>>::type
+                         Pipeline::getRayTracingCaptureReplayShaderGroupHandlesKHR( uint32_t firstGroup, uint32_t groupCount, size_t dataSize ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetRayTracingCaptureReplayShaderGroupHandlesKHR &&
+                         "Function <vkGetRayTracingCaptureReplayShaderGroupHandlesKHR> requires <VK_KHR_ray_tracing_pipeline>" );
+
+      VULKAN_HPP_ASSERT( dataSize % sizeof( DataType ) == 0 );
+      std::vector<DataType> data( dataSize / sizeof( DataType ) );
+      Result result = static_cast<Result>( getDispatcher()->vkGetRayTracingCaptureReplayShaderGroupHandlesKHR( static_cast<VkDevice>( m_device ),
+                                                                                                               static_cast<VkPipeline>( m_pipeline ),
+                                                                                                               firstGroup,
+                                                                                                               groupCount,
+                                                                                                               data.size() * sizeof( DataType ),
+                                                                                                               reinterpret_cast<void *>( data.data() ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Pipeline::getRayTracingCaptureReplayShaderGroupHandlesKHR" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    // wrapper function for command vkGetRayTracingCaptureReplayShaderGroupHandlesKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetRayTracingCaptureReplayShaderGroupHandlesKHR.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
+                         Pipeline::getRayTracingCaptureReplayShaderGroupHandleKHR( uint32_t firstGroup, uint32_t groupCount ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetRayTracingCaptureReplayShaderGroupHandlesKHR &&
+                         "Function <vkGetRayTracingCaptureReplayShaderGroupHandlesKHR> requires <VK_KHR_ray_tracing_pipeline>" );
+
+      DataType data;
+      Result   result = static_cast<Result>( getDispatcher()->vkGetRayTracingCaptureReplayShaderGroupHandlesKHR( static_cast<VkDevice>( m_device ),
+                                                                                                                 static_cast<VkPipeline>( m_pipeline ),
+                                                                                                                 firstGroup,
+                                                                                                                 groupCount,
+                                                                                                                 sizeof( DataType ),
+                                                                                                                 reinterpret_cast<void *>( &data ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Pipeline::getRayTracingCaptureReplayShaderGroupHandleKHR" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    // wrapper function for command vkCreateRayTracingPipelinesKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateRayTracingPipelinesKHR.html
+    template <typename PipelineAllocator, typename std::enable_if<std::is_same<typename PipelineAllocator::value_type, Pipeline>::value, int>::type>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<Pipeline, PipelineAllocator>>::type
+                         Device::createRayTracingPipelinesKHR( Optional<DeferredOperationKHR const> const &        deferredOperation,
+                                                               Optional<PipelineCache const> const &               pipelineCache,
+                                                               ArrayProxy<RayTracingPipelineCreateInfoKHR> const & createInfos,
+                                                               Optional<AllocationCallbacks const>                 allocator,
+                                                               PipelineAllocator const &                           pipelineAllocator ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkCreateRayTracingPipelinesKHR &&
+                         "Function <vkCreateRayTracingPipelinesKHR> requires <VK_KHR_ray_tracing_pipeline>" );
+
+      std::vector<VULKAN_HPP_NAMESPACE::Pipeline, typename std::allocator_traits<PipelineAllocator>::template rebind_alloc<VULKAN_HPP_NAMESPACE::Pipeline>>
+        pipelines( createInfos.size(), {}, pipelineAllocator );
+      Result result = static_cast<Result>(
+        getDispatcher()->vkCreateRayTracingPipelinesKHR( static_cast<VkDevice>( m_device ),
+                                                         deferredOperation ? static_cast<VkDeferredOperationKHR>( **deferredOperation ) : 0,
+                                                         pipelineCache ? static_cast<VkPipelineCache>( **pipelineCache ) : 0,
+                                                         createInfos.size(),
+                                                         reinterpret_cast<VkRayTracingPipelineCreateInfoKHR const *>( createInfos.data() ),
+                                                         reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
+                                                         reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eOperationDeferredKHR, Result::eOperationNotDeferredKHR, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createRayTracingPipelinesKHR" );
+      std::vector<Pipeline, PipelineAllocator> pipelinesRAII( pipelineAllocator );
+      if ( result == Result::eSuccess )
+      {
+        pipelinesRAII.reserve( pipelines.size() );
+        for ( auto & pipeline : pipelines )
+        {
+          pipelinesRAII.emplace_back( *this, *reinterpret_cast<VkPipeline *>( &pipeline ), allocator, result );
+        }
+      }
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( pipelinesRAII ) );
+    }
+
+    //=== VK_NV_ray_tracing ===
+
+    // wrapper function for command vkGetAccelerationStructureMemoryRequirementsNV, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetAccelerationStructureMemoryRequirementsNV.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+      Device::getAccelerationStructureMemoryRequirementsNV( AccelerationStructureMemoryRequirementsInfoNV const & info ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetAccelerationStructureMemoryRequirementsNV &&
+                         "Function <vkGetAccelerationStructureMemoryRequirementsNV> requires <VK_NV_ray_tracing>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
+      getDispatcher()->vkGetAccelerationStructureMemoryRequirementsNV( static_cast<VkDevice>( m_device ),
+                                                                       reinterpret_cast<VkAccelerationStructureMemoryRequirementsInfoNV const *>( &info ),
+                                                                       reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkGetRayTracingShaderGroupHandlesNV, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetRayTracingShaderGroupHandlesNV.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<DataType>>::type
+                         Pipeline::getRayTracingShaderGroupHandlesNV( uint32_t firstGroup, uint32_t groupCount, size_t dataSize ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetRayTracingShaderGroupHandlesNV &&
+                         "Function <vkGetRayTracingShaderGroupHandlesNV> requires <VK_KHR_ray_tracing_pipeline> or <VK_NV_ray_tracing>" );
+
+      VULKAN_HPP_ASSERT( dataSize % sizeof( DataType ) == 0 );
+      std::vector<DataType> data( dataSize / sizeof( DataType ) );
+      Result                result = static_cast<Result>( getDispatcher()->vkGetRayTracingShaderGroupHandlesNV( static_cast<VkDevice>( m_device ),
+                                                                                                                static_cast<VkPipeline>( m_pipeline ),
+                                                                                                                firstGroup,
+                                                                                                                groupCount,
+                                                                                                                data.size() * sizeof( DataType ),
+                                                                                                                reinterpret_cast<void *>( data.data() ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Pipeline::getRayTracingShaderGroupHandlesNV" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    // wrapper function for command vkGetRayTracingShaderGroupHandlesNV, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetRayTracingShaderGroupHandlesNV.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type Pipeline::getRayTracingShaderGroupHandleNV( uint32_t firstGroup,
+                                                                                                                                uint32_t groupCount ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetRayTracingShaderGroupHandlesNV &&
+                         "Function <vkGetRayTracingShaderGroupHandlesNV> requires <VK_KHR_ray_tracing_pipeline> or <VK_NV_ray_tracing>" );
+
+      DataType data;
+      Result   result = static_cast<Result>( getDispatcher()->vkGetRayTracingShaderGroupHandlesNV( static_cast<VkDevice>( m_device ),
+                                                                                                   static_cast<VkPipeline>( m_pipeline ),
+                                                                                                   firstGroup,
+                                                                                                   groupCount,
+                                                                                                   sizeof( DataType ),
+                                                                                                   reinterpret_cast<void *>( &data ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Pipeline::getRayTracingShaderGroupHandleNV" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    // wrapper function for command vkGetAccelerationStructureHandleNV, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetAccelerationStructureHandleNV.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<DataType>>::type AccelerationStructureNV::getHandle( size_t dataSize ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetAccelerationStructureHandleNV && "Function <vkGetAccelerationStructureHandleNV> requires <VK_NV_ray_tracing>" );
+
+      VULKAN_HPP_ASSERT( dataSize % sizeof( DataType ) == 0 );
+      std::vector<DataType> data( dataSize / sizeof( DataType ) );
+      Result                result =
+        static_cast<Result>( getDispatcher()->vkGetAccelerationStructureHandleNV( static_cast<VkDevice>( m_device ),
+                                                                                  static_cast<VkAccelerationStructureNV>( m_accelerationStructureNV ),
+                                                                                  data.size() * sizeof( DataType ),
+                                                                                  reinterpret_cast<void *>( data.data() ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::AccelerationStructureNV::getHandle" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    // wrapper function for command vkGetAccelerationStructureHandleNV, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetAccelerationStructureHandleNV.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type AccelerationStructureNV::getHandle() const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetAccelerationStructureHandleNV && "Function <vkGetAccelerationStructureHandleNV> requires <VK_NV_ray_tracing>" );
+
+      DataType data;
+      Result   result =
+        static_cast<Result>( getDispatcher()->vkGetAccelerationStructureHandleNV( static_cast<VkDevice>( m_device ),
+                                                                                  static_cast<VkAccelerationStructureNV>( m_accelerationStructureNV ),
+                                                                                  sizeof( DataType ),
+                                                                                  reinterpret_cast<void *>( &data ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::AccelerationStructureNV::getHandle" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    // wrapper function for command vkCreateRayTracingPipelinesNV, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateRayTracingPipelinesNV.html
+    template <typename PipelineAllocator, typename std::enable_if<std::is_same<typename PipelineAllocator::value_type, Pipeline>::value, int>::type>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<Pipeline, PipelineAllocator>>::type
+                         Device::createRayTracingPipelinesNV( Optional<PipelineCache const> const &              pipelineCache,
+                                                              ArrayProxy<RayTracingPipelineCreateInfoNV> const & createInfos,
+                                                              Optional<AllocationCallbacks const>                allocator,
+                                                              PipelineAllocator const &                          pipelineAllocator ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkCreateRayTracingPipelinesNV && "Function <vkCreateRayTracingPipelinesNV> requires <VK_NV_ray_tracing>" );
+
+      std::vector<VULKAN_HPP_NAMESPACE::Pipeline, typename std::allocator_traits<PipelineAllocator>::template rebind_alloc<VULKAN_HPP_NAMESPACE::Pipeline>>
+        pipelines( createInfos.size(), {}, pipelineAllocator );
+      Result result =
+        static_cast<Result>( getDispatcher()->vkCreateRayTracingPipelinesNV( static_cast<VkDevice>( m_device ),
+                                                                             pipelineCache ? static_cast<VkPipelineCache>( **pipelineCache ) : 0,
+                                                                             createInfos.size(),
+                                                                             reinterpret_cast<VkRayTracingPipelineCreateInfoNV const *>( createInfos.data() ),
+                                                                             reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
+                                                                             reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createRayTracingPipelinesNV" );
+      std::vector<Pipeline, PipelineAllocator> pipelinesRAII( pipelineAllocator );
+      if ( result == Result::eSuccess )
+      {
+        pipelinesRAII.reserve( pipelines.size() );
+        for ( auto & pipeline : pipelines )
+        {
+          pipelinesRAII.emplace_back( *this, *reinterpret_cast<VkPipeline *>( &pipeline ), allocator, result );
+        }
+      }
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( pipelinesRAII ) );
+    }
+
+    //=== VK_KHR_maintenance3 ===
+
+    // wrapper function for command vkGetDescriptorSetLayoutSupportKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDescriptorSetLayoutSupportKHR.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+      Device::getDescriptorSetLayoutSupportKHR( DescriptorSetLayoutCreateInfo const & createInfo ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDescriptorSetLayoutSupportKHR &&
+                         "Function <vkGetDescriptorSetLayoutSupportKHR> requires <VK_KHR_maintenance3> or <VK_VERSION_1_1>" );
+
+      StructureChain<X, Y, Z...>   structureChain;
+      DescriptorSetLayoutSupport & support = structureChain.template get<DescriptorSetLayoutSupport>();
+      getDispatcher()->vkGetDescriptorSetLayoutSupportKHR( static_cast<VkDevice>( m_device ),
+                                                           reinterpret_cast<VkDescriptorSetLayoutCreateInfo const *>( &createInfo ),
+                                                           reinterpret_cast<VkDescriptorSetLayoutSupport *>( &support ) );
+
+      return structureChain;
+    }
+
+    //=== VK_NV_device_diagnostic_checkpoints ===
+
+    // wrapper function for command vkCmdSetCheckpointNV, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdSetCheckpointNV.html
+    template <typename CheckpointMarkerType>
+    VULKAN_HPP_INLINE void CommandBuffer::setCheckpointNV( CheckpointMarkerType const & checkpointMarker ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkCmdSetCheckpointNV && "Function <vkCmdSetCheckpointNV> requires <VK_NV_device_diagnostic_checkpoints>" );
+
+      getDispatcher()->vkCmdSetCheckpointNV( static_cast<VkCommandBuffer>( m_commandBuffer ), reinterpret_cast<void const *>( &checkpointMarker ) );
+    }
+
+    //=== VK_EXT_host_image_copy ===
+
+    // wrapper function for command vkGetImageSubresourceLayout2EXT, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageSubresourceLayout2EXT.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+                                           Image::getSubresourceLayout2EXT( ImageSubresource2 const & subresource ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT(
+        getDispatcher()->vkGetImageSubresourceLayout2EXT &&
+        "Function <vkGetImageSubresourceLayout2EXT> requires <VK_EXT_host_image_copy> or <VK_EXT_image_compression_control> or <VK_KHR_maintenance5> or <VK_VERSION_1_4>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      SubresourceLayout2 &       layout = structureChain.template get<SubresourceLayout2>();
+      getDispatcher()->vkGetImageSubresourceLayout2EXT( static_cast<VkDevice>( m_device ),
+                                                        static_cast<VkImage>( m_image ),
+                                                        reinterpret_cast<VkImageSubresource2 const *>( &subresource ),
+                                                        reinterpret_cast<VkSubresourceLayout2 *>( &layout ) );
+
+      return structureChain;
+    }
+
+    //=== VK_NV_device_generated_commands ===
+
+    // wrapper function for command vkGetGeneratedCommandsMemoryRequirementsNV, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetGeneratedCommandsMemoryRequirementsNV.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+      Device::getGeneratedCommandsMemoryRequirementsNV( GeneratedCommandsMemoryRequirementsInfoNV const & info ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetGeneratedCommandsMemoryRequirementsNV &&
+                         "Function <vkGetGeneratedCommandsMemoryRequirementsNV> requires <VK_NV_device_generated_commands>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
+      getDispatcher()->vkGetGeneratedCommandsMemoryRequirementsNV( static_cast<VkDevice>( m_device ),
+                                                                   reinterpret_cast<VkGeneratedCommandsMemoryRequirementsInfoNV const *>( &info ),
+                                                                   reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
+
+      return structureChain;
+    }
+
+    //=== VK_KHR_video_encode_queue ===
+
+    // wrapper function for command vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<StructureChain<X, Y, Z...>>::type
+                         PhysicalDevice::getVideoEncodeQualityLevelPropertiesKHR( PhysicalDeviceVideoEncodeQualityLevelInfoKHR const & qualityLevelInfo ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR &&
+                         "Function <vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR> requires <VK_KHR_video_encode_queue>" );
+
+      StructureChain<X, Y, Z...>             structureChain;
+      VideoEncodeQualityLevelPropertiesKHR & qualityLevelProperties = structureChain.template get<VideoEncodeQualityLevelPropertiesKHR>();
+      Result                                 result = static_cast<Result>( getDispatcher()->vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR(
+        static_cast<VkPhysicalDevice>( m_physicalDevice ),
+        reinterpret_cast<VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR const *>( &qualityLevelInfo ),
+        reinterpret_cast<VkVideoEncodeQualityLevelPropertiesKHR *>( &qualityLevelProperties ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::PhysicalDevice::getVideoEncodeQualityLevelPropertiesKHR" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChain ) );
+    }
+
+    // wrapper function for command vkGetEncodedVideoSessionParametersKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetEncodedVideoSessionParametersKHR.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::pair<StructureChain<X, Y, Z...>, std::vector<uint8_t>>>::type
+                         Device::getEncodedVideoSessionParametersKHR( VideoEncodeSessionParametersGetInfoKHR const & videoSessionParametersInfo ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetEncodedVideoSessionParametersKHR &&
+                         "Function <vkGetEncodedVideoSessionParametersKHR> requires <VK_KHR_video_encode_queue>" );
+
+      std::pair<StructureChain<X, Y, Z...>, std::vector<uint8_t>> data_;
+      VideoEncodeSessionParametersFeedbackInfoKHR &               feedbackInfo = data_.first.template get<VideoEncodeSessionParametersFeedbackInfoKHR>();
+      std::vector<uint8_t> &                                      data         = data_.second;
+      size_t                                                      dataSize;
+      Result                                                      result;
+      do
+      {
+        result = static_cast<Result>( getDispatcher()->vkGetEncodedVideoSessionParametersKHR(
+          static_cast<VkDevice>( m_device ),
+          reinterpret_cast<VkVideoEncodeSessionParametersGetInfoKHR const *>( &videoSessionParametersInfo ),
+          reinterpret_cast<VkVideoEncodeSessionParametersFeedbackInfoKHR *>( &feedbackInfo ),
+          &dataSize,
+          nullptr ) );
+        if ( ( result == Result::eSuccess ) && dataSize )
+        {
+          data.resize( dataSize );
+          result = static_cast<Result>( getDispatcher()->vkGetEncodedVideoSessionParametersKHR(
+            static_cast<VkDevice>( m_device ),
+            reinterpret_cast<VkVideoEncodeSessionParametersGetInfoKHR const *>( &videoSessionParametersInfo ),
+            reinterpret_cast<VkVideoEncodeSessionParametersFeedbackInfoKHR *>( &feedbackInfo ),
+            &dataSize,
+            reinterpret_cast<void *>( data.data() ) ) );
+        }
+      } while ( result == Result::eIncomplete );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getEncodedVideoSessionParametersKHR" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data_ ) );
+    }
+
+    //=== VK_NV_low_latency ===
+
+    // wrapper function for command vkGetLatencyTimingsLegacyNV, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetLatencyTimingsLegacyNV.html
+    template <typename TimingsType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE TimingsType Device::getLatencyTimingsLegacyNV() const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetLatencyTimingsLegacyNV && "Function <vkGetLatencyTimingsLegacyNV> requires <VK_NV_low_latency>" );
+
+      TimingsType timings;
+      getDispatcher()->vkGetLatencyTimingsLegacyNV( static_cast<VkDevice>( m_device ), &timings );
+
+      return timings;
+    }
+
+    //=== VK_EXT_descriptor_buffer ===
+
+    // wrapper function for command vkGetDescriptorEXT, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDescriptorEXT.html
+    template <typename DescriptorType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE DescriptorType Device::getDescriptorEXT( DescriptorGetInfoEXT const & descriptorInfo ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDescriptorEXT && "Function <vkGetDescriptorEXT> requires <VK_EXT_descriptor_buffer>" );
+
+      DescriptorType descriptor;
+      getDispatcher()->vkGetDescriptorEXT( static_cast<VkDevice>( m_device ),
+                                           reinterpret_cast<VkDescriptorGetInfoEXT const *>( &descriptorInfo ),
+                                           sizeof( DescriptorType ),
+                                           reinterpret_cast<void *>( &descriptor ) );
+
+      return descriptor;
+    }
+
+    // wrapper function for command vkGetBufferOpaqueCaptureDescriptorDataEXT, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetBufferOpaqueCaptureDescriptorDataEXT.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
+                         Device::getBufferOpaqueCaptureDescriptorDataEXT( BufferCaptureDescriptorDataInfoEXT const & info ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetBufferOpaqueCaptureDescriptorDataEXT &&
+                         "Function <vkGetBufferOpaqueCaptureDescriptorDataEXT> requires <VK_EXT_descriptor_buffer>" );
+
+      DataType data;
+      Result   result = static_cast<Result>( getDispatcher()->vkGetBufferOpaqueCaptureDescriptorDataEXT(
+        static_cast<VkDevice>( m_device ), reinterpret_cast<VkBufferCaptureDescriptorDataInfoEXT const *>( &info ), &data ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getBufferOpaqueCaptureDescriptorDataEXT" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    // wrapper function for command vkGetImageOpaqueCaptureDescriptorDataEXT, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageOpaqueCaptureDescriptorDataEXT.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
+                         Device::getImageOpaqueCaptureDescriptorDataEXT( ImageCaptureDescriptorDataInfoEXT const & info ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetImageOpaqueCaptureDescriptorDataEXT &&
+                         "Function <vkGetImageOpaqueCaptureDescriptorDataEXT> requires <VK_EXT_descriptor_buffer>" );
+
+      DataType data;
+      Result   result = static_cast<Result>( getDispatcher()->vkGetImageOpaqueCaptureDescriptorDataEXT(
+        static_cast<VkDevice>( m_device ), reinterpret_cast<VkImageCaptureDescriptorDataInfoEXT const *>( &info ), &data ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getImageOpaqueCaptureDescriptorDataEXT" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    // wrapper function for command vkGetImageViewOpaqueCaptureDescriptorDataEXT, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageViewOpaqueCaptureDescriptorDataEXT.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
+                         Device::getImageViewOpaqueCaptureDescriptorDataEXT( ImageViewCaptureDescriptorDataInfoEXT const & info ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetImageViewOpaqueCaptureDescriptorDataEXT &&
+                         "Function <vkGetImageViewOpaqueCaptureDescriptorDataEXT> requires <VK_EXT_descriptor_buffer>" );
+
+      DataType data;
+      Result   result = static_cast<Result>( getDispatcher()->vkGetImageViewOpaqueCaptureDescriptorDataEXT(
+        static_cast<VkDevice>( m_device ), reinterpret_cast<VkImageViewCaptureDescriptorDataInfoEXT const *>( &info ), &data ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getImageViewOpaqueCaptureDescriptorDataEXT" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    // wrapper function for command vkGetSamplerOpaqueCaptureDescriptorDataEXT, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetSamplerOpaqueCaptureDescriptorDataEXT.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
+                         Device::getSamplerOpaqueCaptureDescriptorDataEXT( SamplerCaptureDescriptorDataInfoEXT const & info ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetSamplerOpaqueCaptureDescriptorDataEXT &&
+                         "Function <vkGetSamplerOpaqueCaptureDescriptorDataEXT> requires <VK_EXT_descriptor_buffer>" );
+
+      DataType data;
+      Result   result = static_cast<Result>( getDispatcher()->vkGetSamplerOpaqueCaptureDescriptorDataEXT(
+        static_cast<VkDevice>( m_device ), reinterpret_cast<VkSamplerCaptureDescriptorDataInfoEXT const *>( &info ), &data ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getSamplerOpaqueCaptureDescriptorDataEXT" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    // wrapper function for command vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
+                         Device::getAccelerationStructureOpaqueCaptureDescriptorDataEXT( AccelerationStructureCaptureDescriptorDataInfoEXT const & info ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT &&
+                         "Function <vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT> requires <VK_EXT_descriptor_buffer>" );
+
+      DataType data;
+      Result   result = static_cast<Result>( getDispatcher()->vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT(
+        static_cast<VkDevice>( m_device ), reinterpret_cast<VkAccelerationStructureCaptureDescriptorDataInfoEXT const *>( &info ), &data ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getAccelerationStructureOpaqueCaptureDescriptorDataEXT" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    //=== VK_KHR_device_address_commands ===
+
+    // wrapper function for command vkCmdUpdateMemoryKHR, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdUpdateMemoryKHR.html
+    template <typename DataType>
+    VULKAN_HPP_INLINE void CommandBuffer::updateMemoryKHR( DeviceAddressRangeKHR const &      dstRange,
+                                                           AddressCommandFlagsKHR             dstFlags,
+                                                           ArrayProxy<DataType const> const & data ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkCmdUpdateMemoryKHR && "Function <vkCmdUpdateMemoryKHR> requires <VK_KHR_device_address_commands>" );
+
+      getDispatcher()->vkCmdUpdateMemoryKHR( static_cast<VkCommandBuffer>( m_commandBuffer ),
+                                             reinterpret_cast<VkDeviceAddressRangeKHR const *>( &dstRange ),
+                                             static_cast<VkAddressCommandFlagsKHR>( dstFlags ),
+                                             data.size() * sizeof( DataType ),
+                                             reinterpret_cast<void const *>( data.data() ) );
+    }
+
+    //=== VK_EXT_opacity_micromap ===
+
+    // wrapper function for command vkWriteMicromapsPropertiesEXT, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkWriteMicromapsPropertiesEXT.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<DataType>>::type Device::writeMicromapsPropertiesEXT(
+      ArrayProxy<VULKAN_HPP_NAMESPACE::MicromapEXT const> const & micromaps, QueryType queryType, size_t dataSize, size_t stride ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkWriteMicromapsPropertiesEXT && "Function <vkWriteMicromapsPropertiesEXT> requires <VK_EXT_opacity_micromap>" );
+
+      VULKAN_HPP_ASSERT( dataSize % sizeof( DataType ) == 0 );
+      std::vector<DataType> data( dataSize / sizeof( DataType ) );
+      Result result = static_cast<Result>( getDispatcher()->vkWriteMicromapsPropertiesEXT( static_cast<VkDevice>( m_device ),
+                                                                                           micromaps.size(),
+                                                                                           reinterpret_cast<VkMicromapEXT const *>( micromaps.data() ),
+                                                                                           static_cast<VkQueryType>( queryType ),
+                                                                                           data.size() * sizeof( DataType ),
+                                                                                           reinterpret_cast<void *>( data.data() ),
+                                                                                           stride ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::writeMicromapsPropertiesEXT" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    // wrapper function for command vkWriteMicromapsPropertiesEXT, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkWriteMicromapsPropertiesEXT.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
+      Device::writeMicromapsPropertyEXT( ArrayProxy<VULKAN_HPP_NAMESPACE::MicromapEXT const> const & micromaps, QueryType queryType, size_t stride ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkWriteMicromapsPropertiesEXT && "Function <vkWriteMicromapsPropertiesEXT> requires <VK_EXT_opacity_micromap>" );
+
+      DataType data;
+      Result   result = static_cast<Result>( getDispatcher()->vkWriteMicromapsPropertiesEXT( static_cast<VkDevice>( m_device ),
+                                                                                             micromaps.size(),
+                                                                                             reinterpret_cast<VkMicromapEXT const *>( micromaps.data() ),
+                                                                                             static_cast<VkQueryType>( queryType ),
+                                                                                             sizeof( DataType ),
+                                                                                             reinterpret_cast<void *>( &data ),
+                                                                                             stride ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::writeMicromapsPropertyEXT" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    //=== VK_KHR_maintenance4 ===
+
+    // wrapper function for command vkGetDeviceBufferMemoryRequirementsKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceBufferMemoryRequirementsKHR.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+                                           Device::getBufferMemoryRequirementsKHR( DeviceBufferMemoryRequirements const & info ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDeviceBufferMemoryRequirementsKHR &&
+                         "Function <vkGetDeviceBufferMemoryRequirementsKHR> requires <VK_KHR_maintenance4> or <VK_VERSION_1_3>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
+      getDispatcher()->vkGetDeviceBufferMemoryRequirementsKHR( static_cast<VkDevice>( m_device ),
+                                                               reinterpret_cast<VkDeviceBufferMemoryRequirements const *>( &info ),
+                                                               reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkGetDeviceImageMemoryRequirementsKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceImageMemoryRequirementsKHR.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+                                           Device::getImageMemoryRequirementsKHR( DeviceImageMemoryRequirements const & info ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDeviceImageMemoryRequirementsKHR &&
+                         "Function <vkGetDeviceImageMemoryRequirementsKHR> requires <VK_KHR_maintenance4> or <VK_VERSION_1_3>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
+      getDispatcher()->vkGetDeviceImageMemoryRequirementsKHR( static_cast<VkDevice>( m_device ),
+                                                              reinterpret_cast<VkDeviceImageMemoryRequirements const *>( &info ),
+                                                              reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
+
+      return structureChain;
+    }
+
+    //=== VK_NV_device_generated_commands_compute ===
+
+    // wrapper function for command vkGetPipelineIndirectMemoryRequirementsNV, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetPipelineIndirectMemoryRequirementsNV.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+      Device::getPipelineIndirectMemoryRequirementsNV( ComputePipelineCreateInfo const & createInfo ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetPipelineIndirectMemoryRequirementsNV &&
+                         "Function <vkGetPipelineIndirectMemoryRequirementsNV> requires <VK_NV_device_generated_commands_compute>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
+      getDispatcher()->vkGetPipelineIndirectMemoryRequirementsNV( static_cast<VkDevice>( m_device ),
+                                                                  reinterpret_cast<VkComputePipelineCreateInfo const *>( &createInfo ),
+                                                                  reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
+
+      return structureChain;
+    }
+
+#  if defined( VK_USE_PLATFORM_OHOS )
+    //=== VK_OHOS_external_memory ===
+
+    // wrapper function for command vkGetNativeBufferPropertiesOHOS, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetNativeBufferPropertiesOHOS.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<StructureChain<X, Y, Z...>>::type
+                         Device::getNativeBufferPropertiesOHOS( struct OH_NativeBuffer const & buffer ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetNativeBufferPropertiesOHOS && "Function <vkGetNativeBufferPropertiesOHOS> requires <VK_OHOS_external_memory>" );
+
+      StructureChain<X, Y, Z...>   structureChain;
+      NativeBufferPropertiesOHOS & properties = structureChain.template get<NativeBufferPropertiesOHOS>();
+      Result                       result     = static_cast<Result>( getDispatcher()->vkGetNativeBufferPropertiesOHOS(
+        static_cast<VkDevice>( m_device ), &buffer, reinterpret_cast<VkNativeBufferPropertiesOHOS *>( &properties ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getNativeBufferPropertiesOHOS" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChain ) );
+    }
+#  endif /*VK_USE_PLATFORM_OHOS*/
+
+    //=== VK_ARM_tensors ===
+
+    // wrapper function for command vkGetTensorMemoryRequirementsARM, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetTensorMemoryRequirementsARM.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+                                           Device::getTensorMemoryRequirementsARM( TensorMemoryRequirementsInfoARM const & info ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetTensorMemoryRequirementsARM && "Function <vkGetTensorMemoryRequirementsARM> requires <VK_ARM_tensors>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
+      getDispatcher()->vkGetTensorMemoryRequirementsARM( static_cast<VkDevice>( m_device ),
+                                                         reinterpret_cast<VkTensorMemoryRequirementsInfoARM const *>( &info ),
+                                                         reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkGetDeviceTensorMemoryRequirementsARM, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceTensorMemoryRequirementsARM.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+                                           Device::getTensorMemoryRequirementsARM( DeviceTensorMemoryRequirementsARM const & info ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDeviceTensorMemoryRequirementsARM &&
+                         "Function <vkGetDeviceTensorMemoryRequirementsARM> requires <VK_ARM_tensors>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
+      getDispatcher()->vkGetDeviceTensorMemoryRequirementsARM( static_cast<VkDevice>( m_device ),
+                                                               reinterpret_cast<VkDeviceTensorMemoryRequirementsARM const *>( &info ),
+                                                               reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkGetTensorOpaqueCaptureDescriptorDataARM, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetTensorOpaqueCaptureDescriptorDataARM.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
+                         Device::getTensorOpaqueCaptureDescriptorDataARM( TensorCaptureDescriptorDataInfoARM const & info ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetTensorOpaqueCaptureDescriptorDataARM &&
+                         "Function <vkGetTensorOpaqueCaptureDescriptorDataARM> requires <VK_ARM_tensors>" );
+
+      DataType data;
+      Result   result = static_cast<Result>( getDispatcher()->vkGetTensorOpaqueCaptureDescriptorDataARM(
+        static_cast<VkDevice>( m_device ), reinterpret_cast<VkTensorCaptureDescriptorDataInfoARM const *>( &info ), &data ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getTensorOpaqueCaptureDescriptorDataARM" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    // wrapper function for command vkGetTensorViewOpaqueCaptureDescriptorDataARM, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetTensorViewOpaqueCaptureDescriptorDataARM.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<DataType>::type
+                         Device::getTensorViewOpaqueCaptureDescriptorDataARM( TensorViewCaptureDescriptorDataInfoARM const & info ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetTensorViewOpaqueCaptureDescriptorDataARM &&
+                         "Function <vkGetTensorViewOpaqueCaptureDescriptorDataARM> requires <VK_ARM_tensors>" );
+
+      DataType data;
+      Result   result = static_cast<Result>( getDispatcher()->vkGetTensorViewOpaqueCaptureDescriptorDataARM(
+        static_cast<VkDevice>( m_device ), reinterpret_cast<VkTensorViewCaptureDescriptorDataInfoARM const *>( &info ), &data ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getTensorViewOpaqueCaptureDescriptorDataARM" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( data ) );
+    }
+
+    //=== VK_KHR_maintenance5 ===
+
+    // wrapper function for command vkGetDeviceImageSubresourceLayoutKHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDeviceImageSubresourceLayoutKHR.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+                                           Device::getImageSubresourceLayoutKHR( DeviceImageSubresourceInfo const & info ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDeviceImageSubresourceLayoutKHR &&
+                         "Function <vkGetDeviceImageSubresourceLayoutKHR> requires <VK_KHR_maintenance5> or <VK_VERSION_1_4>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      SubresourceLayout2 &       layout = structureChain.template get<SubresourceLayout2>();
+      getDispatcher()->vkGetDeviceImageSubresourceLayoutKHR( static_cast<VkDevice>( m_device ),
+                                                             reinterpret_cast<VkDeviceImageSubresourceInfo const *>( &info ),
+                                                             reinterpret_cast<VkSubresourceLayout2 *>( &layout ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkGetImageSubresourceLayout2KHR, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetImageSubresourceLayout2KHR.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+                                           Image::getSubresourceLayout2KHR( ImageSubresource2 const & subresource ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT(
+        getDispatcher()->vkGetImageSubresourceLayout2KHR &&
+        "Function <vkGetImageSubresourceLayout2KHR> requires <VK_EXT_host_image_copy> or <VK_EXT_image_compression_control> or <VK_KHR_maintenance5> or <VK_VERSION_1_4>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      SubresourceLayout2 &       layout = structureChain.template get<SubresourceLayout2>();
+      getDispatcher()->vkGetImageSubresourceLayout2KHR( static_cast<VkDevice>( m_device ),
+                                                        static_cast<VkImage>( m_image ),
+                                                        reinterpret_cast<VkImageSubresource2 const *>( &subresource ),
+                                                        reinterpret_cast<VkSubresourceLayout2 *>( &layout ) );
+
+      return structureChain;
+    }
+
+    //=== VK_EXT_shader_object ===
+
+    // wrapper function for command vkCreateShadersEXT, see https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateShadersEXT.html
+    template <typename ShaderEXTAllocator, typename std::enable_if<std::is_same<typename ShaderEXTAllocator::value_type, ShaderEXT>::value, int>::type>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<ShaderEXT, ShaderEXTAllocator>>::type
+                         Device::createShadersEXT( ArrayProxy<ShaderCreateInfoEXT> const & createInfos,
+                                                   Optional<AllocationCallbacks const>     allocator,
+                                                   ShaderEXTAllocator const &              shaderEXTAllocator ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkCreateShadersEXT && "Function <vkCreateShadersEXT> requires <VK_EXT_shader_object>" );
+
+      std::vector<VULKAN_HPP_NAMESPACE::ShaderEXT, typename std::allocator_traits<ShaderEXTAllocator>::template rebind_alloc<VULKAN_HPP_NAMESPACE::ShaderEXT>>
+        shaders( createInfos.size(), {}, shaderEXTAllocator );
+      Result result = static_cast<Result>( getDispatcher()->vkCreateShadersEXT( static_cast<VkDevice>( m_device ),
+                                                                                createInfos.size(),
+                                                                                reinterpret_cast<VkShaderCreateInfoEXT const *>( createInfos.data() ),
+                                                                                reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
+                                                                                reinterpret_cast<VkShaderEXT *>( shaders.data() ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::eIncompatibleShaderBinaryEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createShadersEXT" );
+      std::vector<ShaderEXT, ShaderEXTAllocator> shadersRAII( shaderEXTAllocator );
+      if ( result == Result::eSuccess )
+      {
+        shadersRAII.reserve( shaders.size() );
+        for ( auto & shader : shaders )
+        {
+          shadersRAII.emplace_back( *this, *reinterpret_cast<VkShaderEXT *>( &shader ), allocator, result );
+        }
+      }
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( shadersRAII ) );
+    }
+
+    //=== VK_ARM_data_graph ===
+
+    // wrapper function for command vkGetDataGraphPipelineSessionMemoryRequirementsARM, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetDataGraphPipelineSessionMemoryRequirementsARM.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+      Device::getDataGraphPipelineSessionMemoryRequirementsARM( DataGraphPipelineSessionMemoryRequirementsInfoARM const & info ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetDataGraphPipelineSessionMemoryRequirementsARM &&
+                         "Function <vkGetDataGraphPipelineSessionMemoryRequirementsARM> requires <VK_ARM_data_graph>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
+      getDispatcher()->vkGetDataGraphPipelineSessionMemoryRequirementsARM(
+        static_cast<VkDevice>( m_device ),
+        reinterpret_cast<VkDataGraphPipelineSessionMemoryRequirementsInfoARM const *>( &info ),
+        reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
+
+      return structureChain;
+    }
+
+    // wrapper function for command vkCreateDataGraphPipelinesARM, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkCreateDataGraphPipelinesARM.html
+    template <typename PipelineAllocator, typename std::enable_if<std::is_same<typename PipelineAllocator::value_type, Pipeline>::value, int>::type>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<std::vector<Pipeline, PipelineAllocator>>::type
+                         Device::createDataGraphPipelinesARM( Optional<DeferredOperationKHR const> const &       deferredOperation,
+                                                              Optional<PipelineCache const> const &              pipelineCache,
+                                                              ArrayProxy<DataGraphPipelineCreateInfoARM> const & createInfos,
+                                                              Optional<AllocationCallbacks const>                allocator,
+                                                              PipelineAllocator const &                          pipelineAllocator ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkCreateDataGraphPipelinesARM && "Function <vkCreateDataGraphPipelinesARM> requires <VK_ARM_data_graph>" );
+
+      std::vector<VULKAN_HPP_NAMESPACE::Pipeline, typename std::allocator_traits<PipelineAllocator>::template rebind_alloc<VULKAN_HPP_NAMESPACE::Pipeline>>
+        pipelines( createInfos.size(), {}, pipelineAllocator );
+      Result result =
+        static_cast<Result>( getDispatcher()->vkCreateDataGraphPipelinesARM( static_cast<VkDevice>( m_device ),
+                                                                             deferredOperation ? static_cast<VkDeferredOperationKHR>( **deferredOperation ) : 0,
+                                                                             pipelineCache ? static_cast<VkPipelineCache>( **pipelineCache ) : 0,
+                                                                             createInfos.size(),
+                                                                             reinterpret_cast<VkDataGraphPipelineCreateInfoARM const *>( createInfos.data() ),
+                                                                             reinterpret_cast<VkAllocationCallbacks const *>( allocator.get() ),
+                                                                             reinterpret_cast<VkPipeline *>( pipelines.data() ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck<Result::eSuccess, Result::ePipelineCompileRequiredEXT>(
+        result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::createDataGraphPipelinesARM" );
+      std::vector<Pipeline, PipelineAllocator> pipelinesRAII( pipelineAllocator );
+      if ( result == Result::eSuccess )
+      {
+        pipelinesRAII.reserve( pipelines.size() );
+        for ( auto & pipeline : pipelines )
+        {
+          pipelinesRAII.emplace_back( *this, *reinterpret_cast<VkPipeline *>( &pipeline ), allocator, result );
+        }
+      }
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( pipelinesRAII ) );
+    }
+
+#  if defined( VK_USE_PLATFORM_SCREEN_QNX )
+    //=== VK_QNX_external_memory_screen_buffer ===
+
+    // wrapper function for command vkGetScreenBufferPropertiesQNX, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetScreenBufferPropertiesQNX.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<StructureChain<X, Y, Z...>>::type
+                         Device::getScreenBufferPropertiesQNX( struct _screen_buffer const & buffer ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetScreenBufferPropertiesQNX &&
+                         "Function <vkGetScreenBufferPropertiesQNX> requires <VK_QNX_external_memory_screen_buffer>" );
+
+      StructureChain<X, Y, Z...>  structureChain;
+      ScreenBufferPropertiesQNX & properties = structureChain.template get<ScreenBufferPropertiesQNX>();
+      Result                      result     = static_cast<Result>( getDispatcher()->vkGetScreenBufferPropertiesQNX(
+        static_cast<VkDevice>( m_device ), &buffer, reinterpret_cast<VkScreenBufferPropertiesQNX *>( &properties ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getScreenBufferPropertiesQNX" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( structureChain ) );
+    }
+#  endif /*VK_USE_PLATFORM_SCREEN_QNX*/
+
+    //=== VK_NV_external_compute_queue ===
+
+    // wrapper function for command vkGetExternalComputeQueueDataNV, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetExternalComputeQueueDataNV.html
+    template <typename DataType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::pair<ExternalComputeQueueDataParamsNV, DataType> ExternalComputeQueueNV::getData() const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetExternalComputeQueueDataNV &&
+                         "Function <vkGetExternalComputeQueueDataNV> requires <VK_NV_external_compute_queue>" );
+
+      std::pair<ExternalComputeQueueDataParamsNV, DataType> data_;
+      ExternalComputeQueueDataParamsNV &                    arams = data_.first;
+      DataType &                                            data  = data_.second;
+      getDispatcher()->vkGetExternalComputeQueueDataNV(
+        static_cast<VkExternalComputeQueueNV>( m_externalComputeQueueNV ), reinterpret_cast<VkExternalComputeQueueDataParamsNV *>( &arams ), &data );
+
+      return data_;
+    }
+
+    //=== VK_EXT_device_generated_commands ===
+
+    // wrapper function for command vkGetGeneratedCommandsMemoryRequirementsEXT, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetGeneratedCommandsMemoryRequirementsEXT.html
+    template <typename X, typename Y, typename... Z>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE StructureChain<X, Y, Z...>
+      Device::getGeneratedCommandsMemoryRequirementsEXT( GeneratedCommandsMemoryRequirementsInfoEXT const & info ) const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetGeneratedCommandsMemoryRequirementsEXT &&
+                         "Function <vkGetGeneratedCommandsMemoryRequirementsEXT> requires <VK_EXT_device_generated_commands>" );
+
+      StructureChain<X, Y, Z...> structureChain;
+      MemoryRequirements2 &      memoryRequirements = structureChain.template get<MemoryRequirements2>();
+      getDispatcher()->vkGetGeneratedCommandsMemoryRequirementsEXT( static_cast<VkDevice>( m_device ),
+                                                                    reinterpret_cast<VkGeneratedCommandsMemoryRequirementsInfoEXT const *>( &info ),
+                                                                    reinterpret_cast<VkMemoryRequirements2 *>( &memoryRequirements ) );
+
+      return structureChain;
+    }
+
+#  if defined( VK_USE_PLATFORM_METAL_EXT )
+    //=== VK_EXT_external_memory_metal ===
+
+    // wrapper function for command vkGetMemoryMetalHandlePropertiesEXT, see
+    // https://registry.khronos.org/vulkan/specs/latest/man/html/vkGetMemoryMetalHandlePropertiesEXT.html
+    template <typename HandleType>
+    VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE typename ResultValueType<MemoryMetalHandlePropertiesEXT>::type
+                         Device::getMemoryMetalHandlePropertiesEXT( ExternalMemoryHandleTypeFlagBits handleType, HandleType const & handle ) const
+    {
+      VULKAN_HPP_ASSERT( getDispatcher()->vkGetMemoryMetalHandlePropertiesEXT &&
+                         "Function <vkGetMemoryMetalHandlePropertiesEXT> requires <VK_EXT_external_memory_metal>" );
+
+      MemoryMetalHandlePropertiesEXT memoryMetalHandleProperties;
+      Result                         result = static_cast<Result>(
+        getDispatcher()->vkGetMemoryMetalHandlePropertiesEXT( static_cast<VkDevice>( m_device ),
+                                                              static_cast<VkExternalMemoryHandleTypeFlagBits>( handleType ),
+                                                              reinterpret_cast<void const *>( &handle ),
+                                                              reinterpret_cast<VkMemoryMetalHandlePropertiesEXT *>( &memoryMetalHandleProperties ) ) );
+      VULKAN_HPP_NAMESPACE::detail::resultCheck( result, VULKAN_HPP_RAII_NAMESPACE_STRING "::Device::getMemoryMetalHandlePropertiesEXT" );
+
+      return VULKAN_HPP_NAMESPACE::detail::createResultValueType( result, std::move( memoryMetalHandleProperties ) );
+    }
+#  endif /*VK_USE_PLATFORM_METAL_EXT*/
+
     //====================
     //=== RAII Helpers ===
     //====================
@@ -0,0 +1,1172 @@
+// Copyright 2015-2026 The Khronos Group Inc.
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+//
+
+// This header is generated from the Khronos Vulkan XML API Registry.
+
+// NOTE: this copy is a partial placeholder, holding just the structures used by tests/Serialize and benchmarks/Serialization.
+// It is not installed; run the generator (VULKAN_HPP_RUN_GENERATOR) to get the complete header for all the serializable structures.
+
+#ifndef VULKAN_SERIALIZE_HPP
+#define VULKAN_SERIALIZE_HPP
+
+#include <vulkan/vulkan.hpp>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <vector>
+
+#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
+// Binary serialization of structures, including everything they point to:
+//  - vk::serialize( structure ) stores a structure into a compact sequence of bytes
+//  - vk::deserialize<Structure>( data ) rebuilds it in one single block of memory, owned by the returned vk::DeserializedStructure
+//  - the elements of pNext chains are tagged by their StructureType; counted arrays, strings, and pointed-to structures follow their owner
+//  - handles are stored by value, like all the other non-pointer members; they need to be replaced by valid ones after deserialization
+//  - deprecated members are not stored, and the data is only meant to be used on machines with the same byte order and size of size_t
+// Structures with members that can't be serialized (like opaque pointers, unions holding pointers, or mutually exclusive arrays) are not supported.
+namespace VULKAN_HPP_NAMESPACE
+{
+  namespace detail
+  {
+    //=====================
+    //=== Serialization ===
+    //=====================
+
+    struct SerializeHeader
+    {
+      uint32_t magic         = 0x5A53484B;  // "KHSZ"
+      uint32_t version       = 1;
+      uint64_t structureSize = 0;  // size of the serialized structure, as a simple plausibility check
+      uint64_t arenaSize     = 0;  // size of the memory block needed to deserialize it
+    };
+
+    class Serializer
+    {
+    public:
+      explicit Serializer( std::vector<uint8_t> & data ) : m_data( data ) {}
+
+      size_t getArenaSize() const VULKAN_HPP_NOEXCEPT
+      {
+        return m_arenaSize;
+      }
+
+      // keeps track of the memory the Deserializer will need, which allocates in the very same order
+      template <typename T>
+      void allocate( size_t count ) VULKAN_HPP_NOEXCEPT
+      {
+        m_arenaSize = ( m_arenaSize + alignof( T ) - 1 ) / alignof( T ) * alignof( T ) + count * sizeof( T );
+      }
+
+      void fail( char const * message )
+      {
+        m_failed = true;
+#  if defined( VULKAN_HPP_NO_EXCEPTIONS )
+        (void)message;
+#  else
+        throw LogicError( message );
+#  endif
+      }
+
+      bool hasFailed() const VULKAN_HPP_NOEXCEPT
+      {
+        return m_failed;
+      }
+
+      void write( void const * data, size_t size )
+      {
+        m_data.insert( m_data.end(), static_cast<uint8_t const *>( data ), static_cast<uint8_t const *>( data ) + size );
+      }
+
+      template <typename T>
+      void writeChainElement( T const & structure )
+      {
+        StructureType structureType = T::structureType;
+        writeValue( structureType );
+        allocate<T>( 1 );
+        serializeStructure( *this, structure );
+      }
+
+      void writeString( char const * string )
+      {
+        uint32_t length = string ? static_cast<uint32_t>( strlen( string ) + 1 ) : 0;
+        writeValue( length );
+        if ( length )
+        {
+          allocate<char>( length );
+          write( string, length - 1 );
+        }
+      }
+
+      void writeStrings( char const * const * strings, size_t count )
+      {
+        if ( writePresence( strings && count ) )
+        {
+          allocate<char const *>( count );
+          for ( size_t i = 0; i < count; ++i )
+          {
+            writeString( strings[i] );
+          }
+        }
+      }
+
+      template <typename T>
+      void writeStructures( T const * structures, size_t count )
+      {
+        if ( writePresence( structures && count ) )
+        {
+          allocate<T>( count );
+          for ( size_t i = 0; i < count; ++i )
+          {
+            serializeStructure( *this, structures[i] );
+          }
+        }
+      }
+
+      template <typename T>
+      void writeValue( T const & value )
+      {
+        write( &value, sizeof( T ) );
+      }
+
+      template <typename T>
+      void writeValues( T const * values, size_t count )
+      {
+        if ( writePresence( values && count ) )
+        {
+          allocate<T>( count );
+          write( values, count * sizeof( T ) );
+        }
+      }
+
+      // untyped data, with its size in bytes
+      void writeValues( void const * values, size_t size )
+      {
+        if ( writePresence( values && size ) )
+        {
+          allocate<uint64_t>( ( size + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t ) );
+          write( values, size );
+        }
+      }
+
+    private:
+      bool writePresence( bool present )
+      {
+        writeValue( static_cast<uint8_t>( present ) );
+        return present;
+      }
+
+    private:
+      std::vector<uint8_t> & m_data;
+      size_t                 m_arenaSize = 0;
+      bool                   m_failed    = false;
+    };
+
+    class Deserializer
+    {
+    public:
+      Deserializer( uint8_t const * data, size_t size ) VULKAN_HPP_NOEXCEPT
+        : m_data( data )
+        , m_size( size )
+      {
+      }
+
+      // all the memory is taken from one arena, which needs to be aligned for any type
+      template <typename T>
+      T * allocate( size_t count )
+      {
+        size_t offset = ( m_arenaOffset + alignof( T ) - 1 ) / alignof( T ) * alignof( T );
+        if ( m_failed || ( m_arenaSize < offset ) || ( ( m_arenaSize - offset ) / sizeof( T ) < count ) )
+        {
+          fail( VULKAN_HPP_NAMESPACE_STRING "::deserialize: the data is corrupt" );
+          return nullptr;
+        }
+        T * values = reinterpret_cast<T *>( m_arena + offset );
+        for ( size_t i = 0; i < count; ++i )
+        {
+          new ( values + i ) T();
+        }
+        m_arenaOffset = offset + count * sizeof( T );
+        return values;
+      }
+
+      void fail( char const * message )
+      {
+        m_failed = true;
+#  if defined( VULKAN_HPP_NO_EXCEPTIONS )
+        (void)message;
+#  else
+        throw LogicError( message );
+#  endif
+      }
+
+      bool hasFailed() const VULKAN_HPP_NOEXCEPT
+      {
+        return m_failed;
+      }
+
+      bool isAtEnd() const VULKAN_HPP_NOEXCEPT
+      {
+        return m_offset == m_size;
+      }
+
+      // on failure, the data read is zeroed
+      void read( void * data, size_t size )
+      {
+        if ( m_failed || ( m_size - m_offset < size ) )
+        {
+          memset( data, 0, size );
+          fail( VULKAN_HPP_NAMESPACE_STRING "::deserialize: unexpected end of data" );
+          return;
+        }
+        memcpy( data, m_data + m_offset, size );
+        m_offset += size;
+      }
+
+      template <typename T>
+      T * readChainElement()
+      {
+        T * structure = allocate<T>( 1 );
+        if ( structure )
+        {
+          deserializeStructure( *this, *structure );
+        }
+        return structure;
+      }
+
+      void readString( char const *& string )
+      {
+        uint32_t length = 0;
+        readValue( length );
+        string = nullptr;
+        if ( length )
+        {
+          char * characters = allocate<char>( length );
+          if ( characters )
+          {
+            read( characters, length - 1 );
+            string = characters;
+          }
+        }
+      }
+
+      void readStrings( char const * const *& strings, size_t count )
+      {
+        strings = nullptr;
+        if ( readPresence() )
+        {
+          char const ** s = allocate<char const *>( count );
+          if ( s )
+          {
+            for ( size_t i = 0; i < count; ++i )
+            {
+              readString( s[i] );
+            }
+            strings = s;
+          }
+        }
+      }
+
+      template <typename T>
+      void readStructures( T *& structures, size_t count )
+      {
+        structures = nullptr;
+        if ( readPresence() )
+        {
+          typename std::remove_const<T>::type * s = allocate<typename std::remove_const<T>::type>( count );
+          if ( s )
+          {
+            for ( size_t i = 0; i < count; ++i )
+            {
+              deserializeStructure( *this, s[i] );
+            }
+            structures = s;
+          }
+        }
+      }
+
+      template <typename T>
+      void readValue( T & value )
+      {
+        read( &value, sizeof( T ) );
+      }
+
+      template <typename T>
+      void readValues( T *& values, size_t count )
+      {
+        values = nullptr;
+        if ( readPresence() )
+        {
+          typename std::remove_const<T>::type * v = allocate<typename std::remove_const<T>::type>( count );
+          if ( v )
+          {
+            read( v, count * sizeof( T ) );
+            values = v;
+          }
+        }
+      }
+
+      // untyped data, with its size in bytes
+      void readValues( void const *& values, size_t size )
+      {
+        values = nullptr;
+        if ( readPresence() )
+        {
+          uint64_t * v = allocate<uint64_t>( ( size + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t ) );
+          if ( v )
+          {
+            read( v, size );
+            values = v;
+          }
+        }
+      }
+
+      void readValues( void *& values, size_t size )
+      {
+        void const * v;
+        readValues( v, size );
+        values = const_cast<void *>( v );
+      }
+
+      void setArena( void * arena, size_t arenaSize ) VULKAN_HPP_NOEXCEPT
+      {
+        m_arena       = static_cast<uint8_t *>( arena );
+        m_arenaSize   = arenaSize;
+        m_arenaOffset = 0;
+      }
+
+    private:
+      bool readPresence()
+      {
+        uint8_t present = 0;
+        readValue( present );
+        if ( 1 < present )
+        {
+          fail( VULKAN_HPP_NAMESPACE_STRING "::deserialize: the data is corrupt" );
+        }
+        return present == 1;
+      }
+
+    private:
+      uint8_t const * m_data;
+      size_t          m_size;
+      size_t          m_offset      = 0;
+      uint8_t *       m_arena       = nullptr;
+      size_t          m_arenaSize   = 0;
+      size_t          m_arenaOffset = 0;
+      bool            m_failed      = false;
+    };
+
+    void   serializeChain( Serializer & serializer, void const * pNext );
+    void * deserializeChain( Deserializer & deserializer );
+
+
+  //=== VK_VERSION_1_0 ===
+    void serializeStructure( Serializer & serializer, ApplicationInfo const & applicationInfo );
+    void deserializeStructure( Deserializer & deserializer, ApplicationInfo & applicationInfo );
+    void serializeStructure( Serializer & serializer, InstanceCreateInfo const & instanceCreateInfo );
+    void deserializeStructure( Deserializer & deserializer, InstanceCreateInfo & instanceCreateInfo );
+    void serializeStructure( Serializer & serializer, Offset2D const & offset2D );
+    void deserializeStructure( Deserializer & deserializer, Offset2D & offset2D );
+    void serializeStructure( Serializer & serializer, Extent2D const & extent2D );
+    void deserializeStructure( Deserializer & deserializer, Extent2D & extent2D );
+    void serializeStructure( Serializer & serializer, Rect2D const & rect2D );
+    void deserializeStructure( Deserializer & deserializer, Rect2D & rect2D );
+    void serializeStructure( Serializer & serializer, Viewport const & viewport );
+    void deserializeStructure( Deserializer & deserializer, Viewport & viewport );
+    void serializeStructure( Serializer & serializer, SpecializationMapEntry const & specializationMapEntry );
+    void deserializeStructure( Deserializer & deserializer, SpecializationMapEntry & specializationMapEntry );
+    void serializeStructure( Serializer & serializer, SpecializationInfo const & specializationInfo );
+    void deserializeStructure( Deserializer & deserializer, SpecializationInfo & specializationInfo );
+    void serializeStructure( Serializer & serializer, PipelineShaderStageCreateInfo const & pipelineShaderStageCreateInfo );
+    void deserializeStructure( Deserializer & deserializer, PipelineShaderStageCreateInfo & pipelineShaderStageCreateInfo );
+    void serializeStructure( Serializer & serializer, VertexInputBindingDescription const & vertexInputBindingDescription );
+    void deserializeStructure( Deserializer & deserializer, VertexInputBindingDescription & vertexInputBindingDescription );
+    void serializeStructure( Serializer & serializer, VertexInputAttributeDescription const & vertexInputAttributeDescription );
+    void deserializeStructure( Deserializer & deserializer, VertexInputAttributeDescription & vertexInputAttributeDescription );
+    void serializeStructure( Serializer & serializer, PipelineVertexInputStateCreateInfo const & pipelineVertexInputStateCreateInfo );
+    void deserializeStructure( Deserializer & deserializer, PipelineVertexInputStateCreateInfo & pipelineVertexInputStateCreateInfo );
+    void serializeStructure( Serializer & serializer, PipelineInputAssemblyStateCreateInfo const & pipelineInputAssemblyStateCreateInfo );
+    void deserializeStructure( Deserializer & deserializer, PipelineInputAssemblyStateCreateInfo & pipelineInputAssemblyStateCreateInfo );
+    void serializeStructure( Serializer & serializer, PipelineTessellationStateCreateInfo const & pipelineTessellationStateCreateInfo );
+    void deserializeStructure( Deserializer & deserializer, PipelineTessellationStateCreateInfo & pipelineTessellationStateCreateInfo );
+    void serializeStructure( Serializer & serializer, PipelineViewportStateCreateInfo const & pipelineViewportStateCreateInfo );
+    void deserializeStructure( Deserializer & deserializer, PipelineViewportStateCreateInfo & pipelineViewportStateCreateInfo );
+    void serializeStructure( Serializer & serializer, PipelineRasterizationStateCreateInfo const & pipelineRasterizationStateCreateInfo );
+    void deserializeStructure( Deserializer & deserializer, PipelineRasterizationStateCreateInfo & pipelineRasterizationStateCreateInfo );
+    void serializeStructure( Serializer & serializer, PipelineMultisampleStateCreateInfo const & pipelineMultisampleStateCreateInfo );
+    void deserializeStructure( Deserializer & deserializer, PipelineMultisampleStateCreateInfo & pipelineMultisampleStateCreateInfo );
+    void serializeStructure( Serializer & serializer, StencilOpState const & stencilOpState );
+    void deserializeStructure( Deserializer & deserializer, StencilOpState & stencilOpState );
+    void serializeStructure( Serializer & serializer, PipelineDepthStencilStateCreateInfo const & pipelineDepthStencilStateCreateInfo );
+    void deserializeStructure( Deserializer & deserializer, PipelineDepthStencilStateCreateInfo & pipelineDepthStencilStateCreateInfo );
+    void serializeStructure( Serializer & serializer, PipelineColorBlendAttachmentState const & pipelineColorBlendAttachmentState );
+    void deserializeStructure( Deserializer & deserializer, PipelineColorBlendAttachmentState & pipelineColorBlendAttachmentState );
+    void serializeStructure( Serializer & serializer, PipelineColorBlendStateCreateInfo const & pipelineColorBlendStateCreateInfo );
+    void deserializeStructure( Deserializer & deserializer, PipelineColorBlendStateCreateInfo & pipelineColorBlendStateCreateInfo );
+    void serializeStructure( Serializer & serializer, PipelineDynamicStateCreateInfo const & pipelineDynamicStateCreateInfo );
+    void deserializeStructure( Deserializer & deserializer, PipelineDynamicStateCreateInfo & pipelineDynamicStateCreateInfo );
+    void serializeStructure( Serializer & serializer, GraphicsPipelineCreateInfo const & graphicsPipelineCreateInfo );
+    void deserializeStructure( Deserializer & deserializer, GraphicsPipelineCreateInfo & graphicsPipelineCreateInfo );
+    void serializeStructure( Serializer & serializer, RenderPassBeginInfo const & renderPassBeginInfo );
+    void deserializeStructure( Deserializer & deserializer, RenderPassBeginInfo & renderPassBeginInfo );
+
+  //=== VK_VERSION_1_3 ===
+    void serializeStructure( Serializer & serializer, PipelineCreationFeedback const & pipelineCreationFeedback );
+    void deserializeStructure( Deserializer & deserializer, PipelineCreationFeedback & pipelineCreationFeedback );
+    void serializeStructure( Serializer & serializer, PipelineCreationFeedbackCreateInfo const & pipelineCreationFeedbackCreateInfo );
+    void deserializeStructure( Deserializer & deserializer, PipelineCreationFeedbackCreateInfo & pipelineCreationFeedbackCreateInfo );
+    void serializeStructure( Serializer & serializer, PipelineRenderingCreateInfo const & pipelineRenderingCreateInfo );
+    void deserializeStructure( Deserializer & deserializer, PipelineRenderingCreateInfo & pipelineRenderingCreateInfo );
+
+
+  //=== VK_VERSION_1_0 ===
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, ApplicationInfo const & applicationInfo )
+    {
+      serializeChain( serializer, applicationInfo.pNext );
+      serializer.writeString( applicationInfo.pApplicationName );
+      serializer.writeValue( applicationInfo.applicationVersion );
+      serializer.writeString( applicationInfo.pEngineName );
+      serializer.writeValue( applicationInfo.engineVersion );
+      serializer.writeValue( applicationInfo.apiVersion );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, ApplicationInfo & applicationInfo )
+    {
+      applicationInfo.pNext = deserializeChain( deserializer );
+      deserializer.readString( applicationInfo.pApplicationName );
+      deserializer.readValue( applicationInfo.applicationVersion );
+      deserializer.readString( applicationInfo.pEngineName );
+      deserializer.readValue( applicationInfo.engineVersion );
+      deserializer.readValue( applicationInfo.apiVersion );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, InstanceCreateInfo const & instanceCreateInfo )
+    {
+      serializeChain( serializer, instanceCreateInfo.pNext );
+      serializer.writeValue( instanceCreateInfo.flags );
+      serializer.writeStructures( instanceCreateInfo.pApplicationInfo, 1 );
+      serializer.writeValue( instanceCreateInfo.enabledLayerCount );
+      serializer.writeStrings( instanceCreateInfo.ppEnabledLayerNames, static_cast<size_t>( instanceCreateInfo.enabledLayerCount ) );
+      serializer.writeValue( instanceCreateInfo.enabledExtensionCount );
+      serializer.writeStrings( instanceCreateInfo.ppEnabledExtensionNames, static_cast<size_t>( instanceCreateInfo.enabledExtensionCount ) );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, InstanceCreateInfo & instanceCreateInfo )
+    {
+      instanceCreateInfo.pNext = deserializeChain( deserializer );
+      deserializer.readValue( instanceCreateInfo.flags );
+      deserializer.readStructures( instanceCreateInfo.pApplicationInfo, 1 );
+      deserializer.readValue( instanceCreateInfo.enabledLayerCount );
+      deserializer.readStrings( instanceCreateInfo.ppEnabledLayerNames, static_cast<size_t>( instanceCreateInfo.enabledLayerCount ) );
+      deserializer.readValue( instanceCreateInfo.enabledExtensionCount );
+      deserializer.readStrings( instanceCreateInfo.ppEnabledExtensionNames, static_cast<size_t>( instanceCreateInfo.enabledExtensionCount ) );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, Offset2D const & offset2D )
+    {
+      serializer.writeValue( offset2D.x );
+      serializer.writeValue( offset2D.y );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, Offset2D & offset2D )
+    {
+      deserializer.readValue( offset2D.x );
+      deserializer.readValue( offset2D.y );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, Extent2D const & extent2D )
+    {
+      serializer.writeValue( extent2D.width );
+      serializer.writeValue( extent2D.height );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, Extent2D & extent2D )
+    {
+      deserializer.readValue( extent2D.width );
+      deserializer.readValue( extent2D.height );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, Rect2D const & rect2D )
+    {
+      serializeStructure( serializer, rect2D.offset );
+      serializeStructure( serializer, rect2D.extent );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, Rect2D & rect2D )
+    {
+      deserializeStructure( deserializer, rect2D.offset );
+      deserializeStructure( deserializer, rect2D.extent );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, Viewport const & viewport )
+    {
+      serializer.writeValue( viewport.x );
+      serializer.writeValue( viewport.y );
+      serializer.writeValue( viewport.width );
+      serializer.writeValue( viewport.height );
+      serializer.writeValue( viewport.minDepth );
+      serializer.writeValue( viewport.maxDepth );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, Viewport & viewport )
+    {
+      deserializer.readValue( viewport.x );
+      deserializer.readValue( viewport.y );
+      deserializer.readValue( viewport.width );
+      deserializer.readValue( viewport.height );
+      deserializer.readValue( viewport.minDepth );
+      deserializer.readValue( viewport.maxDepth );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, SpecializationMapEntry const & specializationMapEntry )
+    {
+      serializer.writeValue( specializationMapEntry.constantID );
+      serializer.writeValue( specializationMapEntry.offset );
+      serializer.writeValue( specializationMapEntry.size );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, SpecializationMapEntry & specializationMapEntry )
+    {
+      deserializer.readValue( specializationMapEntry.constantID );
+      deserializer.readValue( specializationMapEntry.offset );
+      deserializer.readValue( specializationMapEntry.size );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, SpecializationInfo const & specializationInfo )
+    {
+      serializer.writeValue( specializationInfo.mapEntryCount );
+      serializer.writeStructures( specializationInfo.pMapEntries, static_cast<size_t>( specializationInfo.mapEntryCount ) );
+      serializer.writeValue( specializationInfo.dataSize );
+      serializer.writeValues( specializationInfo.pData, static_cast<size_t>( specializationInfo.dataSize ) );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, SpecializationInfo & specializationInfo )
+    {
+      deserializer.readValue( specializationInfo.mapEntryCount );
+      deserializer.readStructures( specializationInfo.pMapEntries, static_cast<size_t>( specializationInfo.mapEntryCount ) );
+      deserializer.readValue( specializationInfo.dataSize );
+      deserializer.readValues( specializationInfo.pData, static_cast<size_t>( specializationInfo.dataSize ) );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, PipelineShaderStageCreateInfo const & pipelineShaderStageCreateInfo )
+    {
+      serializeChain( serializer, pipelineShaderStageCreateInfo.pNext );
+      serializer.writeValue( pipelineShaderStageCreateInfo.flags );
+      serializer.writeValue( pipelineShaderStageCreateInfo.stage );
+      serializer.writeValue( pipelineShaderStageCreateInfo.module );
+      serializer.writeString( pipelineShaderStageCreateInfo.pName );
+      serializer.writeStructures( pipelineShaderStageCreateInfo.pSpecializationInfo, 1 );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, PipelineShaderStageCreateInfo & pipelineShaderStageCreateInfo )
+    {
+      pipelineShaderStageCreateInfo.pNext = deserializeChain( deserializer );
+      deserializer.readValue( pipelineShaderStageCreateInfo.flags );
+      deserializer.readValue( pipelineShaderStageCreateInfo.stage );
+      deserializer.readValue( pipelineShaderStageCreateInfo.module );
+      deserializer.readString( pipelineShaderStageCreateInfo.pName );
+      deserializer.readStructures( pipelineShaderStageCreateInfo.pSpecializationInfo, 1 );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, VertexInputBindingDescription const & vertexInputBindingDescription )
+    {
+      serializer.writeValue( vertexInputBindingDescription.binding );
+      serializer.writeValue( vertexInputBindingDescription.stride );
+      serializer.writeValue( vertexInputBindingDescription.inputRate );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, VertexInputBindingDescription & vertexInputBindingDescription )
+    {
+      deserializer.readValue( vertexInputBindingDescription.binding );
+      deserializer.readValue( vertexInputBindingDescription.stride );
+      deserializer.readValue( vertexInputBindingDescription.inputRate );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, VertexInputAttributeDescription const & vertexInputAttributeDescription )
+    {
+      serializer.writeValue( vertexInputAttributeDescription.location );
+      serializer.writeValue( vertexInputAttributeDescription.binding );
+      serializer.writeValue( vertexInputAttributeDescription.format );
+      serializer.writeValue( vertexInputAttributeDescription.offset );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, VertexInputAttributeDescription & vertexInputAttributeDescription )
+    {
+      deserializer.readValue( vertexInputAttributeDescription.location );
+      deserializer.readValue( vertexInputAttributeDescription.binding );
+      deserializer.readValue( vertexInputAttributeDescription.format );
+      deserializer.readValue( vertexInputAttributeDescription.offset );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, PipelineVertexInputStateCreateInfo const & pipelineVertexInputStateCreateInfo )
+    {
+      serializeChain( serializer, pipelineVertexInputStateCreateInfo.pNext );
+      serializer.writeValue( pipelineVertexInputStateCreateInfo.flags );
+      serializer.writeValue( pipelineVertexInputStateCreateInfo.vertexBindingDescriptionCount );
+      serializer.writeStructures( pipelineVertexInputStateCreateInfo.pVertexBindingDescriptions,
+                                  static_cast<size_t>( pipelineVertexInputStateCreateInfo.vertexBindingDescriptionCount ) );
+      serializer.writeValue( pipelineVertexInputStateCreateInfo.vertexAttributeDescriptionCount );
+      serializer.writeStructures( pipelineVertexInputStateCreateInfo.pVertexAttributeDescriptions,
+                                  static_cast<size_t>( pipelineVertexInputStateCreateInfo.vertexAttributeDescriptionCount ) );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, PipelineVertexInputStateCreateInfo & pipelineVertexInputStateCreateInfo )
+    {
+      pipelineVertexInputStateCreateInfo.pNext = deserializeChain( deserializer );
+      deserializer.readValue( pipelineVertexInputStateCreateInfo.flags );
+      deserializer.readValue( pipelineVertexInputStateCreateInfo.vertexBindingDescriptionCount );
+      deserializer.readStructures( pipelineVertexInputStateCreateInfo.pVertexBindingDescriptions,
+                                   static_cast<size_t>( pipelineVertexInputStateCreateInfo.vertexBindingDescriptionCount ) );
+      deserializer.readValue( pipelineVertexInputStateCreateInfo.vertexAttributeDescriptionCount );
+      deserializer.readStructures( pipelineVertexInputStateCreateInfo.pVertexAttributeDescriptions,
+                                   static_cast<size_t>( pipelineVertexInputStateCreateInfo.vertexAttributeDescriptionCount ) );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, PipelineInputAssemblyStateCreateInfo const & pipelineInputAssemblyStateCreateInfo )
+    {
+      serializeChain( serializer, pipelineInputAssemblyStateCreateInfo.pNext );
+      serializer.writeValue( pipelineInputAssemblyStateCreateInfo.flags );
+      serializer.writeValue( pipelineInputAssemblyStateCreateInfo.topology );
+      serializer.writeValue( pipelineInputAssemblyStateCreateInfo.primitiveRestartEnable );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, PipelineInputAssemblyStateCreateInfo & pipelineInputAssemblyStateCreateInfo )
+    {
+      pipelineInputAssemblyStateCreateInfo.pNext = deserializeChain( deserializer );
+      deserializer.readValue( pipelineInputAssemblyStateCreateInfo.flags );
+      deserializer.readValue( pipelineInputAssemblyStateCreateInfo.topology );
+      deserializer.readValue( pipelineInputAssemblyStateCreateInfo.primitiveRestartEnable );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, PipelineTessellationStateCreateInfo const & pipelineTessellationStateCreateInfo )
+    {
+      serializeChain( serializer, pipelineTessellationStateCreateInfo.pNext );
+      serializer.writeValue( pipelineTessellationStateCreateInfo.flags );
+      serializer.writeValue( pipelineTessellationStateCreateInfo.patchControlPoints );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, PipelineTessellationStateCreateInfo & pipelineTessellationStateCreateInfo )
+    {
+      pipelineTessellationStateCreateInfo.pNext = deserializeChain( deserializer );
+      deserializer.readValue( pipelineTessellationStateCreateInfo.flags );
+      deserializer.readValue( pipelineTessellationStateCreateInfo.patchControlPoints );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, PipelineViewportStateCreateInfo const & pipelineViewportStateCreateInfo )
+    {
+      serializeChain( serializer, pipelineViewportStateCreateInfo.pNext );
+      serializer.writeValue( pipelineViewportStateCreateInfo.flags );
+      serializer.writeValue( pipelineViewportStateCreateInfo.viewportCount );
+      serializer.writeStructures( pipelineViewportStateCreateInfo.pViewports, static_cast<size_t>( pipelineViewportStateCreateInfo.viewportCount ) );
+      serializer.writeValue( pipelineViewportStateCreateInfo.scissorCount );
+      serializer.writeStructures( pipelineViewportStateCreateInfo.pScissors, static_cast<size_t>( pipelineViewportStateCreateInfo.scissorCount ) );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, PipelineViewportStateCreateInfo & pipelineViewportStateCreateInfo )
+    {
+      pipelineViewportStateCreateInfo.pNext = deserializeChain( deserializer );
+      deserializer.readValue( pipelineViewportStateCreateInfo.flags );
+      deserializer.readValue( pipelineViewportStateCreateInfo.viewportCount );
+      deserializer.readStructures( pipelineViewportStateCreateInfo.pViewports, static_cast<size_t>( pipelineViewportStateCreateInfo.viewportCount ) );
+      deserializer.readValue( pipelineViewportStateCreateInfo.scissorCount );
+      deserializer.readStructures( pipelineViewportStateCreateInfo.pScissors, static_cast<size_t>( pipelineViewportStateCreateInfo.scissorCount ) );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, PipelineRasterizationStateCreateInfo const & pipelineRasterizationStateCreateInfo )
+    {
+      serializeChain( serializer, pipelineRasterizationStateCreateInfo.pNext );
+      serializer.writeValue( pipelineRasterizationStateCreateInfo.flags );
+      serializer.writeValue( pipelineRasterizationStateCreateInfo.depthClampEnable );
+      serializer.writeValue( pipelineRasterizationStateCreateInfo.rasterizerDiscardEnable );
+      serializer.writeValue( pipelineRasterizationStateCreateInfo.polygonMode );
+      serializer.writeValue( pipelineRasterizationStateCreateInfo.cullMode );
+      serializer.writeValue( pipelineRasterizationStateCreateInfo.frontFace );
+      serializer.writeValue( pipelineRasterizationStateCreateInfo.depthBiasEnable );
+      serializer.writeValue( pipelineRasterizationStateCreateInfo.depthBiasConstantFactor );
+      serializer.writeValue( pipelineRasterizationStateCreateInfo.depthBiasClamp );
+      serializer.writeValue( pipelineRasterizationStateCreateInfo.depthBiasSlopeFactor );
+      serializer.writeValue( pipelineRasterizationStateCreateInfo.lineWidth );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, PipelineRasterizationStateCreateInfo & pipelineRasterizationStateCreateInfo )
+    {
+      pipelineRasterizationStateCreateInfo.pNext = deserializeChain( deserializer );
+      deserializer.readValue( pipelineRasterizationStateCreateInfo.flags );
+      deserializer.readValue( pipelineRasterizationStateCreateInfo.depthClampEnable );
+      deserializer.readValue( pipelineRasterizationStateCreateInfo.rasterizerDiscardEnable );
+      deserializer.readValue( pipelineRasterizationStateCreateInfo.polygonMode );
+      deserializer.readValue( pipelineRasterizationStateCreateInfo.cullMode );
+      deserializer.readValue( pipelineRasterizationStateCreateInfo.frontFace );
+      deserializer.readValue( pipelineRasterizationStateCreateInfo.depthBiasEnable );
+      deserializer.readValue( pipelineRasterizationStateCreateInfo.depthBiasConstantFactor );
+      deserializer.readValue( pipelineRasterizationStateCreateInfo.depthBiasClamp );
+      deserializer.readValue( pipelineRasterizationStateCreateInfo.depthBiasSlopeFactor );
+      deserializer.readValue( pipelineRasterizationStateCreateInfo.lineWidth );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, PipelineMultisampleStateCreateInfo const & pipelineMultisampleStateCreateInfo )
+    {
+      serializeChain( serializer, pipelineMultisampleStateCreateInfo.pNext );
+      serializer.writeValue( pipelineMultisampleStateCreateInfo.flags );
+      serializer.writeValue( pipelineMultisampleStateCreateInfo.rasterizationSamples );
+      serializer.writeValue( pipelineMultisampleStateCreateInfo.sampleShadingEnable );
+      serializer.writeValue( pipelineMultisampleStateCreateInfo.minSampleShading );
+      serializer.writeValues( pipelineMultisampleStateCreateInfo.pSampleMask,
+                              ( static_cast<size_t>( pipelineMultisampleStateCreateInfo.rasterizationSamples ) + 31 ) / 32 );
+      serializer.writeValue( pipelineMultisampleStateCreateInfo.alphaToCoverageEnable );
+      serializer.writeValue( pipelineMultisampleStateCreateInfo.alphaToOneEnable );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, PipelineMultisampleStateCreateInfo & pipelineMultisampleStateCreateInfo )
+    {
+      pipelineMultisampleStateCreateInfo.pNext = deserializeChain( deserializer );
+      deserializer.readValue( pipelineMultisampleStateCreateInfo.flags );
+      deserializer.readValue( pipelineMultisampleStateCreateInfo.rasterizationSamples );
+      deserializer.readValue( pipelineMultisampleStateCreateInfo.sampleShadingEnable );
+      deserializer.readValue( pipelineMultisampleStateCreateInfo.minSampleShading );
+      deserializer.readValues( pipelineMultisampleStateCreateInfo.pSampleMask,
+                               ( static_cast<size_t>( pipelineMultisampleStateCreateInfo.rasterizationSamples ) + 31 ) / 32 );
+      deserializer.readValue( pipelineMultisampleStateCreateInfo.alphaToCoverageEnable );
+      deserializer.readValue( pipelineMultisampleStateCreateInfo.alphaToOneEnable );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, StencilOpState const & stencilOpState )
+    {
+      serializer.writeValue( stencilOpState.failOp );
+      serializer.writeValue( stencilOpState.passOp );
+      serializer.writeValue( stencilOpState.depthFailOp );
+      serializer.writeValue( stencilOpState.compareOp );
+      serializer.writeValue( stencilOpState.compareMask );
+      serializer.writeValue( stencilOpState.writeMask );
+      serializer.writeValue( stencilOpState.reference );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, StencilOpState & stencilOpState )
+    {
+      deserializer.readValue( stencilOpState.failOp );
+      deserializer.readValue( stencilOpState.passOp );
+      deserializer.readValue( stencilOpState.depthFailOp );
+      deserializer.readValue( stencilOpState.compareOp );
+      deserializer.readValue( stencilOpState.compareMask );
+      deserializer.readValue( stencilOpState.writeMask );
+      deserializer.readValue( stencilOpState.reference );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, PipelineDepthStencilStateCreateInfo const & pipelineDepthStencilStateCreateInfo )
+    {
+      serializeChain( serializer, pipelineDepthStencilStateCreateInfo.pNext );
+      serializer.writeValue( pipelineDepthStencilStateCreateInfo.flags );
+      serializer.writeValue( pipelineDepthStencilStateCreateInfo.depthTestEnable );
+      serializer.writeValue( pipelineDepthStencilStateCreateInfo.depthWriteEnable );
+      serializer.writeValue( pipelineDepthStencilStateCreateInfo.depthCompareOp );
+      serializer.writeValue( pipelineDepthStencilStateCreateInfo.depthBoundsTestEnable );
+      serializer.writeValue( pipelineDepthStencilStateCreateInfo.stencilTestEnable );
+      serializeStructure( serializer, pipelineDepthStencilStateCreateInfo.front );
+      serializeStructure( serializer, pipelineDepthStencilStateCreateInfo.back );
+      serializer.writeValue( pipelineDepthStencilStateCreateInfo.minDepthBounds );
+      serializer.writeValue( pipelineDepthStencilStateCreateInfo.maxDepthBounds );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, PipelineDepthStencilStateCreateInfo & pipelineDepthStencilStateCreateInfo )
+    {
+      pipelineDepthStencilStateCreateInfo.pNext = deserializeChain( deserializer );
+      deserializer.readValue( pipelineDepthStencilStateCreateInfo.flags );
+      deserializer.readValue( pipelineDepthStencilStateCreateInfo.depthTestEnable );
+      deserializer.readValue( pipelineDepthStencilStateCreateInfo.depthWriteEnable );
+      deserializer.readValue( pipelineDepthStencilStateCreateInfo.depthCompareOp );
+      deserializer.readValue( pipelineDepthStencilStateCreateInfo.depthBoundsTestEnable );
+      deserializer.readValue( pipelineDepthStencilStateCreateInfo.stencilTestEnable );
+      deserializeStructure( deserializer, pipelineDepthStencilStateCreateInfo.front );
+      deserializeStructure( deserializer, pipelineDepthStencilStateCreateInfo.back );
+      deserializer.readValue( pipelineDepthStencilStateCreateInfo.minDepthBounds );
+      deserializer.readValue( pipelineDepthStencilStateCreateInfo.maxDepthBounds );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, PipelineColorBlendAttachmentState const & pipelineColorBlendAttachmentState )
+    {
+      serializer.writeValue( pipelineColorBlendAttachmentState.blendEnable );
+      serializer.writeValue( pipelineColorBlendAttachmentState.srcColorBlendFactor );
+      serializer.writeValue( pipelineColorBlendAttachmentState.dstColorBlendFactor );
+      serializer.writeValue( pipelineColorBlendAttachmentState.colorBlendOp );
+      serializer.writeValue( pipelineColorBlendAttachmentState.srcAlphaBlendFactor );
+      serializer.writeValue( pipelineColorBlendAttachmentState.dstAlphaBlendFactor );
+      serializer.writeValue( pipelineColorBlendAttachmentState.alphaBlendOp );
+      serializer.writeValue( pipelineColorBlendAttachmentState.colorWriteMask );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, PipelineColorBlendAttachmentState & pipelineColorBlendAttachmentState )
+    {
+      deserializer.readValue( pipelineColorBlendAttachmentState.blendEnable );
+      deserializer.readValue( pipelineColorBlendAttachmentState.srcColorBlendFactor );
+      deserializer.readValue( pipelineColorBlendAttachmentState.dstColorBlendFactor );
+      deserializer.readValue( pipelineColorBlendAttachmentState.colorBlendOp );
+      deserializer.readValue( pipelineColorBlendAttachmentState.srcAlphaBlendFactor );
+      deserializer.readValue( pipelineColorBlendAttachmentState.dstAlphaBlendFactor );
+      deserializer.readValue( pipelineColorBlendAttachmentState.alphaBlendOp );
+      deserializer.readValue( pipelineColorBlendAttachmentState.colorWriteMask );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, PipelineColorBlendStateCreateInfo const & pipelineColorBlendStateCreateInfo )
+    {
+      serializeChain( serializer, pipelineColorBlendStateCreateInfo.pNext );
+      serializer.writeValue( pipelineColorBlendStateCreateInfo.flags );
+      serializer.writeValue( pipelineColorBlendStateCreateInfo.logicOpEnable );
+      serializer.writeValue( pipelineColorBlendStateCreateInfo.logicOp );
+      serializer.writeValue( pipelineColorBlendStateCreateInfo.attachmentCount );
+      serializer.writeStructures( pipelineColorBlendStateCreateInfo.pAttachments, static_cast<size_t>( pipelineColorBlendStateCreateInfo.attachmentCount ) );
+      serializer.writeValue( pipelineColorBlendStateCreateInfo.blendConstants );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, PipelineColorBlendStateCreateInfo & pipelineColorBlendStateCreateInfo )
+    {
+      pipelineColorBlendStateCreateInfo.pNext = deserializeChain( deserializer );
+      deserializer.readValue( pipelineColorBlendStateCreateInfo.flags );
+      deserializer.readValue( pipelineColorBlendStateCreateInfo.logicOpEnable );
+      deserializer.readValue( pipelineColorBlendStateCreateInfo.logicOp );
+      deserializer.readValue( pipelineColorBlendStateCreateInfo.attachmentCount );
+      deserializer.readStructures( pipelineColorBlendStateCreateInfo.pAttachments, static_cast<size_t>( pipelineColorBlendStateCreateInfo.attachmentCount ) );
+      deserializer.readValue( pipelineColorBlendStateCreateInfo.blendConstants );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, PipelineDynamicStateCreateInfo const & pipelineDynamicStateCreateInfo )
+    {
+      serializeChain( serializer, pipelineDynamicStateCreateInfo.pNext );
+      serializer.writeValue( pipelineDynamicStateCreateInfo.flags );
+      serializer.writeValue( pipelineDynamicStateCreateInfo.dynamicStateCount );
+      serializer.writeValues( pipelineDynamicStateCreateInfo.pDynamicStates, static_cast<size_t>( pipelineDynamicStateCreateInfo.dynamicStateCount ) );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, PipelineDynamicStateCreateInfo & pipelineDynamicStateCreateInfo )
+    {
+      pipelineDynamicStateCreateInfo.pNext = deserializeChain( deserializer );
+      deserializer.readValue( pipelineDynamicStateCreateInfo.flags );
+      deserializer.readValue( pipelineDynamicStateCreateInfo.dynamicStateCount );
+      deserializer.readValues( pipelineDynamicStateCreateInfo.pDynamicStates, static_cast<size_t>( pipelineDynamicStateCreateInfo.dynamicStateCount ) );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, GraphicsPipelineCreateInfo const & graphicsPipelineCreateInfo )
+    {
+      serializeChain( serializer, graphicsPipelineCreateInfo.pNext );
+      serializer.writeValue( graphicsPipelineCreateInfo.flags );
+      serializer.writeValue( graphicsPipelineCreateInfo.stageCount );
+      serializer.writeStructures( graphicsPipelineCreateInfo.pStages, static_cast<size_t>( graphicsPipelineCreateInfo.stageCount ) );
+      serializer.writeStructures( graphicsPipelineCreateInfo.pVertexInputState, 1 );
+      serializer.writeStructures( graphicsPipelineCreateInfo.pInputAssemblyState, 1 );
+      serializer.writeStructures( graphicsPipelineCreateInfo.pTessellationState, 1 );
+      serializer.writeStructures( graphicsPipelineCreateInfo.pViewportState, 1 );
+      serializer.writeStructures( graphicsPipelineCreateInfo.pRasterizationState, 1 );
+      serializer.writeStructures( graphicsPipelineCreateInfo.pMultisampleState, 1 );
+      serializer.writeStructures( graphicsPipelineCreateInfo.pDepthStencilState, 1 );
+      serializer.writeStructures( graphicsPipelineCreateInfo.pColorBlendState, 1 );
+      serializer.writeStructures( graphicsPipelineCreateInfo.pDynamicState, 1 );
+      serializer.writeValue( graphicsPipelineCreateInfo.layout );
+      serializer.writeValue( graphicsPipelineCreateInfo.renderPass );
+      serializer.writeValue( graphicsPipelineCreateInfo.subpass );
+      serializer.writeValue( graphicsPipelineCreateInfo.basePipelineHandle );
+      serializer.writeValue( graphicsPipelineCreateInfo.basePipelineIndex );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, GraphicsPipelineCreateInfo & graphicsPipelineCreateInfo )
+    {
+      graphicsPipelineCreateInfo.pNext = deserializeChain( deserializer );
+      deserializer.readValue( graphicsPipelineCreateInfo.flags );
+      deserializer.readValue( graphicsPipelineCreateInfo.stageCount );
+      deserializer.readStructures( graphicsPipelineCreateInfo.pStages, static_cast<size_t>( graphicsPipelineCreateInfo.stageCount ) );
+      deserializer.readStructures( graphicsPipelineCreateInfo.pVertexInputState, 1 );
+      deserializer.readStructures( graphicsPipelineCreateInfo.pInputAssemblyState, 1 );
+      deserializer.readStructures( graphicsPipelineCreateInfo.pTessellationState, 1 );
+      deserializer.readStructures( graphicsPipelineCreateInfo.pViewportState, 1 );
+      deserializer.readStructures( graphicsPipelineCreateInfo.pRasterizationState, 1 );
+      deserializer.readStructures( graphicsPipelineCreateInfo.pMultisampleState, 1 );
+      deserializer.readStructures( graphicsPipelineCreateInfo.pDepthStencilState, 1 );
+      deserializer.readStructures( graphicsPipelineCreateInfo.pColorBlendState, 1 );
+      deserializer.readStructures( graphicsPipelineCreateInfo.pDynamicState, 1 );
+      deserializer.readValue( graphicsPipelineCreateInfo.layout );
+      deserializer.readValue( graphicsPipelineCreateInfo.renderPass );
+      deserializer.readValue( graphicsPipelineCreateInfo.subpass );
+      deserializer.readValue( graphicsPipelineCreateInfo.basePipelineHandle );
+      deserializer.readValue( graphicsPipelineCreateInfo.basePipelineIndex );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, RenderPassBeginInfo const & renderPassBeginInfo )
+    {
+      serializeChain( serializer, renderPassBeginInfo.pNext );
+      serializer.writeValue( renderPassBeginInfo.renderPass );
+      serializer.writeValue( renderPassBeginInfo.framebuffer );
+      serializeStructure( serializer, renderPassBeginInfo.renderArea );
+      serializer.writeValue( renderPassBeginInfo.clearValueCount );
+      serializer.writeValues( renderPassBeginInfo.pClearValues, static_cast<size_t>( renderPassBeginInfo.clearValueCount ) );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, RenderPassBeginInfo & renderPassBeginInfo )
+    {
+      renderPassBeginInfo.pNext = deserializeChain( deserializer );
+      deserializer.readValue( renderPassBeginInfo.renderPass );
+      deserializer.readValue( renderPassBeginInfo.framebuffer );
+      deserializeStructure( deserializer, renderPassBeginInfo.renderArea );
+      deserializer.readValue( renderPassBeginInfo.clearValueCount );
+      deserializer.readValues( renderPassBeginInfo.pClearValues, static_cast<size_t>( renderPassBeginInfo.clearValueCount ) );
+    }
+
+  //=== VK_VERSION_1_3 ===
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, PipelineCreationFeedback const & pipelineCreationFeedback )
+    {
+      serializer.writeValue( pipelineCreationFeedback.flags );
+      serializer.writeValue( pipelineCreationFeedback.duration );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, PipelineCreationFeedback & pipelineCreationFeedback )
+    {
+      deserializer.readValue( pipelineCreationFeedback.flags );
+      deserializer.readValue( pipelineCreationFeedback.duration );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, PipelineCreationFeedbackCreateInfo const & pipelineCreationFeedbackCreateInfo )
+    {
+      serializeChain( serializer, pipelineCreationFeedbackCreateInfo.pNext );
+      serializer.writeStructures( pipelineCreationFeedbackCreateInfo.pPipelineCreationFeedback, 1 );
+      serializer.writeValue( pipelineCreationFeedbackCreateInfo.pipelineStageCreationFeedbackCount );
+      serializer.writeStructures( pipelineCreationFeedbackCreateInfo.pPipelineStageCreationFeedbacks,
+                                  static_cast<size_t>( pipelineCreationFeedbackCreateInfo.pipelineStageCreationFeedbackCount ) );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, PipelineCreationFeedbackCreateInfo & pipelineCreationFeedbackCreateInfo )
+    {
+      pipelineCreationFeedbackCreateInfo.pNext = deserializeChain( deserializer );
+      deserializer.readStructures( pipelineCreationFeedbackCreateInfo.pPipelineCreationFeedback, 1 );
+      deserializer.readValue( pipelineCreationFeedbackCreateInfo.pipelineStageCreationFeedbackCount );
+      deserializer.readStructures( pipelineCreationFeedbackCreateInfo.pPipelineStageCreationFeedbacks,
+                                   static_cast<size_t>( pipelineCreationFeedbackCreateInfo.pipelineStageCreationFeedbackCount ) );
+    }
+
+    VULKAN_HPP_INLINE void serializeStructure( Serializer & serializer, PipelineRenderingCreateInfo const & pipelineRenderingCreateInfo )
+    {
+      serializeChain( serializer, pipelineRenderingCreateInfo.pNext );
+      serializer.writeValue( pipelineRenderingCreateInfo.viewMask );
+      serializer.writeValue( pipelineRenderingCreateInfo.colorAttachmentCount );
+      serializer.writeValues( pipelineRenderingCreateInfo.pColorAttachmentFormats, static_cast<size_t>( pipelineRenderingCreateInfo.colorAttachmentCount ) );
+      serializer.writeValue( pipelineRenderingCreateInfo.depthAttachmentFormat );
+      serializer.writeValue( pipelineRenderingCreateInfo.stencilAttachmentFormat );
+    }
+
+    VULKAN_HPP_INLINE void deserializeStructure( Deserializer & deserializer, PipelineRenderingCreateInfo & pipelineRenderingCreateInfo )
+    {
+      pipelineRenderingCreateInfo.pNext = deserializeChain( deserializer );
+      deserializer.readValue( pipelineRenderingCreateInfo.viewMask );
+      deserializer.readValue( pipelineRenderingCreateInfo.colorAttachmentCount );
+      deserializer.readValues( pipelineRenderingCreateInfo.pColorAttachmentFormats, static_cast<size_t>( pipelineRenderingCreateInfo.colorAttachmentCount ) );
+      deserializer.readValue( pipelineRenderingCreateInfo.depthAttachmentFormat );
+      deserializer.readValue( pipelineRenderingCreateInfo.stencilAttachmentFormat );
+    }
+
+
+    VULKAN_HPP_INLINE void serializeChain( Serializer & serializer, void const * pNext )
+    {
+      // each element of the chain is tagged by its StructureType, and its serialization continues with the next element
+      StructureType const chainEnd = static_cast<StructureType>( 0x7FFFFFFF );
+      switch ( pNext ? static_cast<StructureType>( reinterpret_cast<VkBaseInStructure const *>( pNext )->sType ) : chainEnd )
+      {
+
+  //=== VK_VERSION_1_0 ===
+        case ApplicationInfo::structureType: serializer.writeChainElement( *reinterpret_cast<ApplicationInfo const *>( pNext ) ); break;
+        case InstanceCreateInfo::structureType: serializer.writeChainElement( *reinterpret_cast<InstanceCreateInfo const *>( pNext ) ); break;
+        case PipelineShaderStageCreateInfo::structureType:
+          serializer.writeChainElement( *reinterpret_cast<PipelineShaderStageCreateInfo const *>( pNext ) );
+          break;
+        case PipelineVertexInputStateCreateInfo::structureType:
+          serializer.writeChainElement( *reinterpret_cast<PipelineVertexInputStateCreateInfo const *>( pNext ) );
+          break;
+        case PipelineInputAssemblyStateCreateInfo::structureType:
+          serializer.writeChainElement( *reinterpret_cast<PipelineInputAssemblyStateCreateInfo const *>( pNext ) );
+          break;
+        case PipelineTessellationStateCreateInfo::structureType:
+          serializer.writeChainElement( *reinterpret_cast<PipelineTessellationStateCreateInfo const *>( pNext ) );
+          break;
+        case PipelineViewportStateCreateInfo::structureType:
+          serializer.writeChainElement( *reinterpret_cast<PipelineViewportStateCreateInfo const *>( pNext ) );
+          break;
+        case PipelineRasterizationStateCreateInfo::structureType:
+          serializer.writeChainElement( *reinterpret_cast<PipelineRasterizationStateCreateInfo const *>( pNext ) );
+          break;
+        case PipelineMultisampleStateCreateInfo::structureType:
+          serializer.writeChainElement( *reinterpret_cast<PipelineMultisampleStateCreateInfo const *>( pNext ) );
+          break;
+        case PipelineDepthStencilStateCreateInfo::structureType:
+          serializer.writeChainElement( *reinterpret_cast<PipelineDepthStencilStateCreateInfo const *>( pNext ) );
+          break;
+        case PipelineColorBlendStateCreateInfo::structureType:
+          serializer.writeChainElement( *reinterpret_cast<PipelineColorBlendStateCreateInfo const *>( pNext ) );
+          break;
+        case PipelineDynamicStateCreateInfo::structureType:
+          serializer.writeChainElement( *reinterpret_cast<PipelineDynamicStateCreateInfo const *>( pNext ) );
+          break;
+        case GraphicsPipelineCreateInfo::structureType: serializer.writeChainElement( *reinterpret_cast<GraphicsPipelineCreateInfo const *>( pNext ) ); break;
+        case RenderPassBeginInfo::structureType: serializer.writeChainElement( *reinterpret_cast<RenderPassBeginInfo const *>( pNext ) ); break;
+
+  //=== VK_VERSION_1_3 ===
+        case PipelineCreationFeedbackCreateInfo::structureType:
+          serializer.writeChainElement( *reinterpret_cast<PipelineCreationFeedbackCreateInfo const *>( pNext ) );
+          break;
+        case PipelineRenderingCreateInfo::structureType: serializer.writeChainElement( *reinterpret_cast<PipelineRenderingCreateInfo const *>( pNext ) ); break;
+
+        default:
+          if ( pNext )
+          {
+            serializer.fail( VULKAN_HPP_NAMESPACE_STRING "::serialize: the pNext chain holds a structure that can't be serialized" );
+          }
+          serializer.writeValue( chainEnd );
+          break;
+      }
+    }
+
+    VULKAN_HPP_INLINE void * deserializeChain( Deserializer & deserializer )
+    {
+      StructureType const chainEnd      = static_cast<StructureType>( 0x7FFFFFFF );
+      StructureType       structureType = chainEnd;
+      deserializer.readValue( structureType );
+      switch ( structureType )
+      {
+
+  //=== VK_VERSION_1_0 ===
+        case ApplicationInfo::structureType: return deserializer.readChainElement<ApplicationInfo>();
+        case InstanceCreateInfo::structureType: return deserializer.readChainElement<InstanceCreateInfo>();
+        case PipelineShaderStageCreateInfo::structureType: return deserializer.readChainElement<PipelineShaderStageCreateInfo>();
+        case PipelineVertexInputStateCreateInfo::structureType: return deserializer.readChainElement<PipelineVertexInputStateCreateInfo>();
+        case PipelineInputAssemblyStateCreateInfo::structureType: return deserializer.readChainElement<PipelineInputAssemblyStateCreateInfo>();
+        case PipelineTessellationStateCreateInfo::structureType: return deserializer.readChainElement<PipelineTessellationStateCreateInfo>();
+        case PipelineViewportStateCreateInfo::structureType: return deserializer.readChainElement<PipelineViewportStateCreateInfo>();
+        case PipelineRasterizationStateCreateInfo::structureType: return deserializer.readChainElement<PipelineRasterizationStateCreateInfo>();
+        case PipelineMultisampleStateCreateInfo::structureType: return deserializer.readChainElement<PipelineMultisampleStateCreateInfo>();
+        case PipelineDepthStencilStateCreateInfo::structureType: return deserializer.readChainElement<PipelineDepthStencilStateCreateInfo>();
+        case PipelineColorBlendStateCreateInfo::structureType: return deserializer.readChainElement<PipelineColorBlendStateCreateInfo>();
+        case PipelineDynamicStateCreateInfo::structureType: return deserializer.readChainElement<PipelineDynamicStateCreateInfo>();
+        case GraphicsPipelineCreateInfo::structureType: return deserializer.readChainElement<GraphicsPipelineCreateInfo>();
+        case RenderPassBeginInfo::structureType: return deserializer.readChainElement<RenderPassBeginInfo>();
+
+  //=== VK_VERSION_1_3 ===
+        case PipelineCreationFeedbackCreateInfo::structureType: return deserializer.readChainElement<PipelineCreationFeedbackCreateInfo>();
+        case PipelineRenderingCreateInfo::structureType: return deserializer.readChainElement<PipelineRenderingCreateInfo>();
+
+        default:
+          if ( structureType != chainEnd )
+          {
+            deserializer.fail( VULKAN_HPP_NAMESPACE_STRING "::deserialize: the pNext chain holds an unknown structure" );
+          }
+          return nullptr;
+      }
+    }
+  }  // namespace detail
+
+  // owns a deserialized structure, together with everything it points to
+  template <typename T>
+  class DeserializedStructure
+  {
+  public:
+    DeserializedStructure() = default;
+
+    DeserializedStructure( std::unique_ptr<std::max_align_t[]> && arena, T * structure ) VULKAN_HPP_NOEXCEPT
+      : m_arena( std::move( arena ) )
+      , m_structure( structure )
+    {
+    }
+
+    explicit operator bool() const VULKAN_HPP_NOEXCEPT
+    {
+      return m_structure != nullptr;
+    }
+
+    // the structure and all the data it points to can be modified, for example to replace the handles
+    T & get() VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( m_structure );
+      return *m_structure;
+    }
+
+    T const & get() const VULKAN_HPP_NOEXCEPT
+    {
+      VULKAN_HPP_ASSERT( m_structure );
+      return *m_structure;
+    }
+
+    T const & operator*() const VULKAN_HPP_NOEXCEPT
+    {
+      return get();
+    }
+
+    T const * operator->() const VULKAN_HPP_NOEXCEPT
+    {
+      return &get();
+    }
+
+  private:
+    std::unique_ptr<std::max_align_t[]> m_arena;
+    T *                                 m_structure = nullptr;
+  };
+
+  // with VULKAN_HPP_NO_EXCEPTIONS, a structure that can't be serialized as a whole results in empty data
+  template <typename T>
+  VULKAN_HPP_NODISCARD std::vector<uint8_t> serialize( T const & structure )
+  {
+    std::vector<uint8_t> data( sizeof( detail::SerializeHeader ) );
+    detail::Serializer   serializer( data );
+    serializer.allocate<T>( 1 );
+    serializeStructure( serializer, structure );
+    if ( serializer.hasFailed() )
+    {
+      return std::vector<uint8_t>();
+    }
+
+    detail::SerializeHeader header;
+    header.structureSize = sizeof( T );
+    header.arenaSize     = serializer.getArenaSize();
+    memcpy( data.data(), &header, sizeof( header ) );
+    return data;
+  }
+
+  // with VULKAN_HPP_NO_EXCEPTIONS, corrupt data results in an empty DeserializedStructure
+  template <typename T>
+  VULKAN_HPP_NODISCARD DeserializedStructure<T> deserialize( ArrayProxy<uint8_t const> const & data )
+  {
+    detail::Deserializer    deserializer( data.data(), data.size() );
+    detail::SerializeHeader header;
+    detail::SerializeHeader expected;
+    deserializer.readValue( header );
+    if ( !deserializer.hasFailed() &&
+         ( ( header.magic != expected.magic ) || ( header.version != expected.version ) || ( header.structureSize != sizeof( T ) ) ) )
+    {
+      deserializer.fail( VULKAN_HPP_NAMESPACE_STRING "::deserialize: the data does not hold a serialized structure of this type" );
+    }
+    // any serialized byte accounts for just a few bytes of the arena (a pointer takes one byte to mark its presence, plus some padding)
+    // -> don't even try to allocate the arena for corrupt data that claims to need more than that
+    if ( !deserializer.hasFailed() && ( ( data.size() - sizeof( header ) ) * 64 + sizeof( T ) < header.arenaSize ) )
+    {
+      deserializer.fail( VULKAN_HPP_NAMESPACE_STRING "::deserialize: the data is corrupt" );
+    }
+    if ( !deserializer.hasFailed() )
+    {
+      std::unique_ptr<std::max_align_t[]> arena(
+        new std::max_align_t[static_cast<size_t>( ( header.arenaSize + sizeof( std::max_align_t ) - 1 ) / sizeof( std::max_align_t ) )] );
+      deserializer.setArena( arena.get(), static_cast<size_t>( header.arenaSize ) );
+
+      T * structure = deserializer.allocate<T>( 1 );
+      if ( structure )
+      {
+        deserializeStructure( deserializer, *structure );
+      }
+      if ( !deserializer.hasFailed() && !deserializer.isAtEnd() )
+      {
+        deserializer.fail( VULKAN_HPP_NAMESPACE_STRING "::deserialize: unexpected data after the structure" );
+      }
+      if ( !deserializer.hasFailed() )
+      {
+        return DeserializedStructure<T>( std::move( arena ), structure );
+      }
+    }
+    return DeserializedStructure<T>();
+  }
+}  // namespace VULKAN_HPP_NAMESPACE
+#endif
+#endif